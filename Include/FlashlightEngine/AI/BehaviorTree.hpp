@@ -0,0 +1,127 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AI_BEHAVIORTREE_HPP
+#define FL_AI_BEHAVIORTREE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Utility/Delegate.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    enum class BehaviorNodeKind : UInt8 {
+        Sequence, //< Runs its children in order until one doesn't succeed
+        Selector, //< Runs its children in order until one doesn't fail
+        Inverter, //< Swaps the success and failure of its child
+        Succeeder, //< Turns the failure of its child into a success
+        Condition, //< Leaf succeeding or failing immediately
+        Action, //< Leaf which may keep running over several ticks
+
+        Max = Action
+    };
+
+    enum class BehaviorStatus : UInt8 {
+        Failure,
+        Success,
+        Running,
+
+        Max = Running
+    };
+
+    /**
+     * @brief Behavior tree flattened in a contiguous array of nodes, ticked for batches of agents at once.
+     *
+     * Nodes are stored in depth-first order, each one holding the index past its last descendant so that its children
+     * are reached without pointers. The tree doesn't keep any state between ticks: every tick starts over from the
+     * root, which lets actions of higher priority interrupt running ones.
+     *
+     * Agents are ticked BatchSize at a time, all of them walking down the tree together. Each node is visited once for
+     * the agents reaching it, and leaves receive these agents in a single call. Nodes are dispatched by kind through a
+     * table sized by EnumValueCount_v<BehaviorNodeKind>, without any virtual call.
+     */
+    class FL_API BehaviorTree {
+    public:
+        static constexpr std::size_t BatchSize = 64;
+        static constexpr std::size_t NodeKindCount = EnumValueCount_v<BehaviorNodeKind>;
+
+        /**
+         * @brief Callback of a leaf, filling the status of each agent it is given.
+         * @remark Conditions must not report BehaviorStatus::Running.
+         */
+        using LeafCallback = Delegate<void(std::span<const UInt32> agents, std::span<BehaviorStatus> statuses)>;
+
+        struct Node {
+            BehaviorNodeKind kind;
+            UInt32 end; //< Index past the last descendant
+            UInt32 leaf; //< Callback index of leaves
+        };
+
+        BehaviorTree() = default;
+        BehaviorTree(const BehaviorTree&) = delete;
+        BehaviorTree(BehaviorTree&&) noexcept = default;
+        ~BehaviorTree() = default;
+
+        /**
+         * @brief Appends a leaf to the node being built, or makes it the root.
+         * @param kind BehaviorNodeKind::Condition or BehaviorNodeKind::Action.
+         * @return Index of the node.
+         */
+        UInt32 AddLeaf(BehaviorNodeKind kind, LeafCallback callback);
+
+        /**
+         * @brief Appends a composite or decorator to the node being built, or makes it the root, then builds its
+         *        children until the matching EndNode().
+         * @return Index of the node.
+         */
+        UInt32 BeginNode(BehaviorNodeKind kind);
+
+        /**
+         * @brief Removes all nodes.
+         */
+        void Clear();
+
+        /**
+         * @brief Ends the node of the last unmatched BeginNode().
+         * @remark Decorators must have exactly one child.
+         */
+        void EndNode();
+
+        inline UInt32 GetDepth() const;
+        inline const Node& GetNode(UInt32 node) const;
+        inline std::span<const Node> GetNodes() const;
+
+        /**
+         * @brief Checks whether the tree has a root and every node was ended.
+         */
+        inline bool IsComplete() const;
+
+        /**
+         * @brief Ticks the tree for a set of agents.
+         * @param agents Agents to tick, handed to the leaves.
+         * @param statuses Receives the status of the root for each agent, as many as agents.
+         * @remark Thread-safe as long as the leaf callbacks are.
+         */
+        void Tick(std::span<const UInt32> agents, std::span<BehaviorStatus> statuses) const;
+
+        BehaviorTree& operator=(const BehaviorTree&) = delete;
+        BehaviorTree& operator=(BehaviorTree&&) noexcept = default;
+
+    private:
+        UInt32 AddNode(BehaviorNodeKind kind, UInt32 leaf);
+
+        std::vector<Node> m_nodes;
+        std::vector<LeafCallback> m_leaves;
+        std::vector<UInt32> m_openNodes; //< Nodes begun but not ended yet
+        UInt32 m_depth = 0;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/AI/BehaviorTree.inl>
+
+#endif // FL_AI_BEHAVIORTREE_HPP
@@ -0,0 +1,28 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/AI/BehaviorTree.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    inline UInt32 BehaviorTree::GetDepth() const {
+        return m_depth;
+    }
+
+    inline auto BehaviorTree::GetNode(const UInt32 node) const -> const Node& {
+        FlAssertMsg(node < m_nodes.size(), "[AI/BehaviorTree] Node index out of range.");
+        return m_nodes[node];
+    }
+
+    inline auto BehaviorTree::GetNodes() const -> std::span<const Node> {
+        return m_nodes;
+    }
+
+    inline bool BehaviorTree::IsComplete() const {
+        return !m_nodes.empty() && m_openNodes.empty();
+    }
+} // namespace Fl
@@ -0,0 +1,144 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AI_DECISIONSCHEDULER_HPP
+#define FL_AI_DECISIONSCHEDULER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Utility/Delegate.hpp>
+#include <FlashlightEngine/Utility/FixedVector.hpp>
+
+#include <array>
+#include <chrono>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Spreads the decision updates of agents over frames, within a time budget per frame.
+     *
+     * Each agent has a level of detail picked from its relevance, which sets the number of frames between two of its
+     * updates. Agents of a level are spread evenly over the frames of its interval as they are added, so that the
+     * same share of them is due every frame.
+     *
+     * Due agents are counting sorted and updated by batches, the latest first, then those of the most relevant levels,
+     * then by index. Batches are started as long as the time spent in the frame plus the estimated cost of the batch
+     * fits in the budget, the cost being measured on the previous batches. At least one batch is updated every frame,
+     * the others being deferred to the next frames where they come first. Staleness, the number of frames since the
+     * last update of an agent, measures how late updates get.
+     */
+    class FL_API DecisionScheduler {
+    public:
+        static constexpr std::size_t MaxLodCount = 8;
+        static constexpr UInt32 MaxSortedLateness = 255; //< Frames past the due frame told apart when sorting
+
+        struct LodLevel {
+            float minRelevance; //< Lowest relevance of the agents of the level
+            UInt32 updateInterval; //< Frames between two updates of an agent
+        };
+
+        struct Settings {
+            Clock::duration frameBudget = std::chrono::milliseconds(2);
+            FixedVector<LodLevel, MaxLodCount> lodLevels = {
+                {0.75f, 1}, {0.5f, 2}, {0.25f, 4}, {0.0f, 8}
+            }; //< By decreasing relevance, agents below the last level belonging to it
+            std::size_t batchSize = 64;
+        };
+
+        /**
+         * @brief Statistics of the last Update().
+         */
+        struct Statistics {
+            std::size_t agentCount;
+            std::size_t dueAgentCount;
+            std::size_t updatedAgentCount;
+            std::size_t deferredAgentCount; //< Due agents left to the next frames because of the budget
+            UInt32 maxStaleness; //< After the frame
+            float averageStaleness; //< After the frame
+            Clock::duration scheduleTime; //< Finding and sorting the due agents
+            Clock::duration updateTime;
+
+            inline Clock::duration GetFrameTime() const;
+        };
+
+        using UpdateCallback = Delegate<void(std::span<const UInt32> agents)>;
+
+        DecisionScheduler();
+        explicit DecisionScheduler(const Settings& settings);
+        DecisionScheduler(const DecisionScheduler&) = delete;
+        DecisionScheduler(DecisionScheduler&&) noexcept = default;
+        ~DecisionScheduler() = default;
+
+        /**
+         * @brief Adds an agent, first updated within the interval of its level.
+         * @return Index of the agent.
+         */
+        UInt32 AddAgent(float relevance);
+
+        /**
+         * @brief Removes all agents.
+         */
+        void Clear();
+
+        inline std::size_t GetAgentCount() const;
+        /**
+         * @brief Gets the number of Update() calls so far.
+         */
+        inline UInt32 GetFrameIndex() const;
+        inline UInt32 GetLod(UInt32 agent) const;
+        inline float GetRelevance(UInt32 agent) const;
+        inline const Settings& GetSettings() const;
+        /**
+         * @brief Gets the number of frames since the last update of an agent.
+         * @remark Agents never updated are counted as last updated up to an interval before they were added.
+         */
+        inline UInt32 GetStaleness(UInt32 agent) const;
+        inline const Statistics& GetStatistics() const;
+
+        void Reserve(std::size_t agentCount);
+
+        /**
+         * @brief Sets the relevance of an agent, moving it to the matching level.
+         * @remark The agent keeps the frame of its last update, it's due as soon as it's as stale as its new interval.
+         */
+        void SetRelevance(UInt32 agent, float relevance);
+
+        /**
+         * @brief Starts a frame and updates its due agents, within the budget.
+         * @param callback Called with each batch of agents to update.
+         * @param threadPool Thread pool updating the batches, or nullptr to update them on the calling thread. The
+         *                   callback must be thread-safe when one is given.
+         */
+        void Update(const UpdateCallback& callback, ThreadPool* threadPool = nullptr);
+
+        DecisionScheduler& operator=(const DecisionScheduler&) = delete;
+        DecisionScheduler& operator=(DecisionScheduler&&) noexcept = default;
+
+    private:
+        UInt8 FindLod(float relevance) const;
+        void FindDueAgents();
+
+        std::vector<float> m_relevances;
+        std::vector<UInt32> m_lastUpdateFrames;
+        std::vector<UInt8> m_lods;
+        std::vector<UInt32> m_bucketOffsets; //< Counting sort of the due agents, by lateness then level
+        std::vector<UInt32> m_dueAgents; //< In update order
+        std::vector<UInt32> m_dueCandidates; //< In index order
+        std::vector<UInt16> m_dueBuckets; //< Bucket of each candidate
+        std::array<UInt32, MaxLodCount> m_lodPhases; //< Frame offset given to the next agent of each level
+        Statistics m_statistics;
+        Settings m_settings;
+        double m_agentCost; //< Estimated update time of an agent, in nanoseconds
+        UInt32 m_frameIndex;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/AI/DecisionScheduler.inl>
+
+#endif // FL_AI_DECISIONSCHEDULER_HPP
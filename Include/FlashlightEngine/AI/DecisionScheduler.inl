@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/AI/DecisionScheduler.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    inline Clock::duration DecisionScheduler::Statistics::GetFrameTime() const {
+        return scheduleTime + updateTime;
+    }
+
+    inline std::size_t DecisionScheduler::GetAgentCount() const {
+        return m_relevances.size();
+    }
+
+    inline UInt32 DecisionScheduler::GetFrameIndex() const {
+        return m_frameIndex;
+    }
+
+    inline UInt32 DecisionScheduler::GetLod(const UInt32 agent) const {
+        FlAssertMsg(agent < m_lods.size(), "[AI/DecisionScheduler] Agent index out of range.");
+        return m_lods[agent];
+    }
+
+    inline float DecisionScheduler::GetRelevance(const UInt32 agent) const {
+        FlAssertMsg(agent < m_relevances.size(), "[AI/DecisionScheduler] Agent index out of range.");
+        return m_relevances[agent];
+    }
+
+    inline auto DecisionScheduler::GetSettings() const -> const Settings& {
+        return m_settings;
+    }
+
+    inline UInt32 DecisionScheduler::GetStaleness(const UInt32 agent) const {
+        FlAssertMsg(agent < m_lastUpdateFrames.size(), "[AI/DecisionScheduler] Agent index out of range.");
+        return m_frameIndex - m_lastUpdateFrames[agent];
+    }
+
+    inline auto DecisionScheduler::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+} // namespace Fl
@@ -0,0 +1,115 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AI_UTILITYEVALUATOR_HPP
+#define FL_AI_UTILITYEVALUATOR_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    enum class ResponseCurveKind : UInt8 {
+        Linear, //< slope * (x - offsetX) + offsetY
+        Polynomial, //< slope * max(x - offsetX, 0) ^ exponent + offsetY
+        Logistic, //< slope / (1 + e ^ (-exponent * (x - offsetX))) + offsetY
+        Step, //< slope + offsetY from offsetX, offsetY before
+
+        Max = Step
+    };
+
+    /**
+     * @brief Curve mapping an input in [0, 1] to a score in [0, 1], inputs and scores out of range being clamped.
+     */
+    struct FL_API ResponseCurve {
+        ResponseCurveKind kind = ResponseCurveKind::Linear;
+        float slope = 1.0f;
+        float exponent = 1.0f;
+        float offsetX = 0.0f;
+        float offsetY = 0.0f;
+
+        float Evaluate(float input) const;
+    };
+
+    /**
+     * @brief Picks the best option of agents by multiplying the scores of the considerations of each option.
+     *
+     * Options and their considerations are stored in flat arrays. Agents are evaluated BatchSize at a time, one
+     * consideration at a time: the curve of a consideration is picked once per batch from a table sized by
+     * EnumValueCount_v<ResponseCurveKind>, then applied to the inputs of all the agents.
+     *
+     * Scores of considerations are compensated for their count before being multiplied, so that options with many
+     * considerations don't lose against those with a few: a score s of an option with n considerations becomes
+     * s + s * (1 - s) * (1 - 1 / n). The product is then multiplied by the weight of the option.
+     */
+    class FL_API UtilityEvaluator {
+    public:
+        static constexpr std::size_t BatchSize = 64;
+        static constexpr std::size_t CurveKindCount = EnumValueCount_v<ResponseCurveKind>;
+
+        struct Consideration {
+            UInt32 input;
+            ResponseCurve curve;
+        };
+
+        UtilityEvaluator() = default;
+        UtilityEvaluator(const UtilityEvaluator&) = default;
+        UtilityEvaluator(UtilityEvaluator&&) noexcept = default;
+        ~UtilityEvaluator() = default;
+
+        /**
+         * @brief Adds a consideration to the last added option.
+         * @param input Index of the input the curve is applied to.
+         */
+        void AddConsideration(UInt32 input, const ResponseCurve& curve);
+
+        /**
+         * @brief Adds an option, scored by the considerations added until the next option.
+         * @remark Options without considerations score their weight.
+         * @return Index of the option.
+         */
+        UInt32 AddOption(float weight = 1.0f);
+
+        void Clear();
+
+        /**
+         * @brief Picks the best option of each agent.
+         * @param inputs Inputs of the agents, input-major: input i of agent a is at i * agentCount + a. There must be
+         *               GetInputCount() inputs per agent.
+         * @param choices Receives the best option of each agent, ties going to the first option. There must be one per
+         *                agent.
+         * @param scores Receives the score of the best option of each agent, as many as choices.
+         * @param threadPool Thread pool evaluating the batches, or nullptr to run on the calling thread.
+         */
+        void Evaluate(std::span<const float> inputs, std::span<UInt32> choices, std::span<float> scores,
+                      ThreadPool* threadPool = nullptr) const;
+
+        inline std::span<const Consideration> GetConsiderations(UInt32 option) const;
+        inline UInt32 GetInputCount() const;
+        inline std::size_t GetOptionCount() const;
+        inline float GetWeight(UInt32 option) const;
+
+        UtilityEvaluator& operator=(const UtilityEvaluator&) = default;
+        UtilityEvaluator& operator=(UtilityEvaluator&&) noexcept = default;
+
+    private:
+        void EvaluateBatch(std::span<const float> inputs, std::size_t agentCount, std::size_t first, std::size_t last,
+                           std::span<UInt32> choices, std::span<float> scores) const;
+
+        std::vector<Consideration> m_considerations;
+        std::vector<UInt32> m_considerationOffsets{0}; //< First consideration of each option, and the end
+        std::vector<float> m_weights;
+        UInt32 m_inputCount = 0;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/AI/UtilityEvaluator.inl>
+
+#endif // FL_AI_UTILITYEVALUATOR_HPP
@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/AI/UtilityEvaluator.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    inline auto UtilityEvaluator::GetConsiderations(const UInt32 option) const -> std::span<const Consideration> {
+        FlAssertMsg(option < m_weights.size(), "[AI/UtilityEvaluator] Option index out of range.");
+        const UInt32 first = m_considerationOffsets[option];
+        const UInt32 count = m_considerationOffsets[option + 1] - first;
+        return std::span<const Consideration>(m_considerations).subspan(first, count);
+    }
+
+    inline UInt32 UtilityEvaluator::GetInputCount() const {
+        return m_inputCount;
+    }
+
+    inline std::size_t UtilityEvaluator::GetOptionCount() const {
+        return m_weights.size();
+    }
+
+    inline float UtilityEvaluator::GetWeight(const UInt32 option) const {
+        FlAssertMsg(option < m_weights.size(), "[AI/UtilityEvaluator] Option index out of range.");
+        return m_weights[option];
+    }
+} // namespace Fl
@@ -0,0 +1,117 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_ANIMATION_ANIMATIONCLIP_HPP
+#define FL_ANIMATION_ANIMATIONCLIP_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/BaseObject.hpp>
+#include <FlashlightEngine/Math/Quaternion.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+#include <array>
+#include <vector>
+
+namespace Fl {
+    class LocalPose;
+
+    /**
+     * @brief Uncompressed animation, sampled at a fixed frame rate.
+     */
+    struct RawAnimation {
+        /**
+         * @brief Values of a joint at each frame, a single value meaning that it doesn't change.
+         */
+        struct JointTrack {
+            std::vector<Vector3> translations;
+            std::vector<Quaternion> rotations;
+            std::vector<Vector3> scales;
+        };
+
+        float frameRate = 30.0f;
+        UInt32 frameCount = 0; //< At most 65536
+        std::vector<JointTrack> tracks; //< One per joint of the skeleton
+
+        /**
+         * @brief Gets the size of the animation if it was stored with every value of every frame.
+         */
+        inline std::size_t GetSize() const;
+    };
+
+    /**
+     * @brief Compressed animation of the joints of a skeleton.
+     *
+     * Each joint has a translation, a rotation and a scale curve. The values are quantized to 16 bits per component:
+     * translations and scales relative to the range of their curve, rotations with the three smallest components of
+     * the quaternion. Curves are then reduced by removing the keys which linear interpolation (normalized for
+     * rotations) reconstructs within the tolerances, the reconstruction error including the quantization one.
+     *
+     * Sampling decodes the surrounding keys of SimdFloat4::Width joints into structure of arrays form, then
+     * interpolates them at once.
+     */
+    class FL_API AnimationClip final : public BaseObject {
+    public:
+        struct CompressionSettings {
+            float translationTolerance = 1e-3f; //< Distance
+            float rotationTolerance = 1e-3f; //< Angle, in radians
+            float scaleTolerance = 1e-3f;
+        };
+
+        AnimationClip() = default;
+        explicit AnimationClip(const RawAnimation& animation);
+        AnimationClip(const RawAnimation& animation, const CompressionSettings& settings);
+        AnimationClip(const AnimationClip&) = default;
+        AnimationClip(AnimationClip&&) noexcept = default;
+        ~AnimationClip() override = default;
+
+        /**
+         * @brief Gets the duration of the clip, from its first to its last frame.
+         * @return Duration in seconds.
+         */
+        inline float GetDuration() const;
+        inline float GetFrameRate() const;
+        inline std::size_t GetJointCount() const;
+        /**
+         * @brief Gets the number of keys kept by the compression, over all curves.
+         */
+        inline std::size_t GetKeyCount() const;
+        /**
+         * @brief Gets the memory used by the clip, including its arrays.
+         * @return Size in bytes.
+         */
+        std::size_t GetMemoryFootprint() const;
+
+        /**
+         * @brief Samples the clip.
+         * @param time Time from the start of the clip, clamped to its duration.
+         * @param pose Receives the transforms, with as many joints as the clip.
+         */
+        void Sample(float time, LocalPose& pose) const;
+
+        AnimationClip& operator=(const AnimationClip&) = default;
+        AnimationClip& operator=(AnimationClip&&) noexcept = default;
+
+        static constexpr std::size_t CurvesPerJoint = 3; //< Translation, rotation and scale
+
+    private:
+        struct Curve {
+            UInt32 firstKey;
+            UInt32 keyCount;
+            std::array<float, 3> offsets; //< Dequantization of translations and scales
+            std::array<float, 3> scales;
+        };
+
+        std::vector<Curve> m_curves; //< CurvesPerJoint per joint
+        std::vector<UInt16> m_keyFrames;
+        std::vector<UInt16> m_keyValues; //< 3 per key
+        float m_frameRate = 30.0f;
+        UInt32 m_frameCount = 0;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Animation/AnimationClip.inl>
+
+#endif // FL_ANIMATION_ANIMATIONCLIP_HPP
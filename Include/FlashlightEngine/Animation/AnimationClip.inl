@@ -0,0 +1,30 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Animation/AnimationClip.hpp>
+
+namespace Fl {
+    inline std::size_t RawAnimation::GetSize() const {
+        constexpr std::size_t FrameSize = 2 * sizeof(Vector3) + sizeof(Quaternion);
+        return tracks.size() * frameCount * FrameSize;
+    }
+
+    inline float AnimationClip::GetDuration() const {
+        return (m_frameCount > 1) ? static_cast<float>(m_frameCount - 1) / m_frameRate : 0.0f;
+    }
+
+    inline float AnimationClip::GetFrameRate() const {
+        return m_frameRate;
+    }
+
+    inline std::size_t AnimationClip::GetJointCount() const {
+        return m_curves.size() / CurvesPerJoint;
+    }
+
+    inline std::size_t AnimationClip::GetKeyCount() const {
+        return m_keyFrames.size();
+    }
+} // namespace Fl
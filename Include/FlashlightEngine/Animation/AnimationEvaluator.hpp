@@ -0,0 +1,77 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_ANIMATION_ANIMATIONEVALUATOR_HPP
+#define FL_ANIMATION_ANIMATIONEVALUATOR_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Math/Matrix4.hpp>
+
+#include <span>
+
+namespace Fl {
+    class AnimationClip;
+    class Skeleton;
+    class ThreadPool;
+
+    /**
+     * @brief Computes the model matrices of many animated characters, in parallel.
+     *
+     * Each character blends the clips of its layers by their weights, then converts the resulting pose to model
+     * space. Characters are split in batches of BatchSize, each batch reusing its own scratch poses.
+     */
+    class FL_API AnimationEvaluator {
+    public:
+        static constexpr std::size_t BatchSize = 16;
+
+        struct Layer {
+            const AnimationClip* clip;
+            float time;
+            float weight; //< Relative to the other layers of the character
+        };
+
+        struct Character {
+            const Skeleton* skeleton;
+            std::span<const Layer> layers; //< The bind pose is used without any weighted layer
+            std::span<Matrix4> modelMatrices; //< One per joint of the skeleton
+        };
+
+        /**
+         * @brief Statistics of the last Evaluate().
+         */
+        struct Statistics {
+            std::size_t characterCount;
+            std::size_t jointCount;
+            std::size_t sampledClipCount;
+            Clock::duration evaluationTime;
+        };
+
+        AnimationEvaluator() = default;
+        AnimationEvaluator(const AnimationEvaluator&) = default;
+        AnimationEvaluator(AnimationEvaluator&&) noexcept = default;
+        ~AnimationEvaluator() = default;
+
+        /**
+         * @brief Evaluates characters.
+         * @param characters Characters to evaluate, the matrices of different characters must not overlap.
+         * @param threadPool Thread pool evaluating the batches, or nullptr to run on the calling thread.
+         */
+        void Evaluate(std::span<const Character> characters, ThreadPool* threadPool = nullptr);
+
+        inline const Statistics& GetStatistics() const;
+
+        AnimationEvaluator& operator=(const AnimationEvaluator&) = default;
+        AnimationEvaluator& operator=(AnimationEvaluator&&) noexcept = default;
+
+    private:
+        Statistics m_statistics = {};
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Animation/AnimationEvaluator.inl>
+
+#endif // FL_ANIMATION_ANIMATIONEVALUATOR_HPP
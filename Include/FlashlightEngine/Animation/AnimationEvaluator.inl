@@ -0,0 +1,13 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Animation/AnimationEvaluator.hpp>
+
+namespace Fl {
+    inline auto AnimationEvaluator::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+} // namespace Fl
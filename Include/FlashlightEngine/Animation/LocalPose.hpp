@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_ANIMATION_LOCALPOSE_HPP
+#define FL_ANIMATION_LOCALPOSE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Matrix4.hpp>
+#include <FlashlightEngine/Math/Quaternion.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class Skeleton;
+
+    enum class PoseComponent {
+        TranslationX,
+        TranslationY,
+        TranslationZ,
+        RotationX,
+        RotationY,
+        RotationZ,
+        RotationW,
+        ScaleX,
+        ScaleY,
+        ScaleZ,
+
+        Max = ScaleZ
+    };
+
+    /**
+     * @brief Transforms of the joints of a skeleton relative to their parent, stored as structure of arrays.
+     *
+     * Every component has its own array, padded to a multiple of SimdFloat4::Width joints with identity transforms so
+     * that blending and matrix conversion process SimdFloat4::Width joints at once without remainder.
+     */
+    class FL_API LocalPose {
+    public:
+        LocalPose() = default;
+        /**
+         * @param jointCount Number of joints, initialized to identity transforms.
+         */
+        explicit LocalPose(std::size_t jointCount);
+        LocalPose(const LocalPose&) = default;
+        LocalPose(LocalPose&&) noexcept = default;
+        ~LocalPose() = default;
+
+        /**
+         * @brief Converts the local transforms to model space matrices.
+         * @remark Transforms are first converted to matrices SimdFloat4::Width joints at a time, then concatenated
+         *         with their parent's in hierarchy order.
+         * @param skeleton Skeleton giving the parent of each joint, with as many joints as the pose.
+         * @param matrices Receives the model matrix of each joint.
+         */
+        void ComputeModelMatrices(const Skeleton& skeleton, std::span<Matrix4> matrices) const;
+
+        inline std::span<float> GetComponents(PoseComponent component);
+        inline std::span<const float> GetComponents(PoseComponent component) const;
+        inline std::size_t GetJointCount() const;
+        /**
+         * @brief Gets the number of joints in the component arrays, padding included.
+         */
+        inline std::size_t GetPaddedJointCount() const;
+        Quaternion GetRotation(std::size_t joint) const;
+        Vector3 GetScale(std::size_t joint) const;
+        Vector3 GetTranslation(std::size_t joint) const;
+
+        /**
+         * @brief Changes the number of joints, new ones having identity transforms.
+         */
+        void Resize(std::size_t jointCount);
+
+        void SetTransform(std::size_t joint, const Vector3& translation, const Quaternion& rotation,
+                          const Vector3& scale);
+
+        LocalPose& operator=(const LocalPose&) = default;
+        LocalPose& operator=(LocalPose&&) noexcept = default;
+
+        /**
+         * @brief Interpolates two poses, linearly for translations and scales and with a normalized lerp along the
+         *        shortest path for rotations.
+         * @param first Pose at weight 0.
+         * @param second Pose at weight 1, with as many joints as the first one.
+         * @param weight Blend factor.
+         * @param output Receives the blended pose, may be one of the inputs.
+         */
+        static void Blend(const LocalPose& first, const LocalPose& second, float weight, LocalPose& output);
+
+    private:
+        std::array<std::vector<float>, EnumValueCount_v<PoseComponent>> m_components;
+        std::size_t m_jointCount = 0;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Animation/LocalPose.inl>
+
+#endif // FL_ANIMATION_LOCALPOSE_HPP
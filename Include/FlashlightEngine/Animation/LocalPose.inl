@@ -0,0 +1,25 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Animation/LocalPose.hpp>
+
+namespace Fl {
+    inline std::span<float> LocalPose::GetComponents(const PoseComponent component) {
+        return m_components[static_cast<std::size_t>(component)];
+    }
+
+    inline std::span<const float> LocalPose::GetComponents(const PoseComponent component) const {
+        return m_components[static_cast<std::size_t>(component)];
+    }
+
+    inline std::size_t LocalPose::GetJointCount() const {
+        return m_jointCount;
+    }
+
+    inline std::size_t LocalPose::GetPaddedJointCount() const {
+        return m_components[0].size();
+    }
+} // namespace Fl
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_ANIMATION_SKELETON_HPP
+#define FL_ANIMATION_SKELETON_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Animation/LocalPose.hpp>
+#include <FlashlightEngine/Core/BaseObject.hpp>
+
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Hierarchy of joints animated by AnimationClip, with its bind pose.
+     *
+     * Joints are sorted so that every parent comes before its children, which lets model matrices be computed in a
+     * single pass.
+     */
+    class FL_API Skeleton final : public BaseObject {
+    public:
+        static constexpr UInt32 InvalidJoint = std::numeric_limits<UInt32>::max();
+
+        struct Joint {
+            std::string name;
+            UInt32 parent = InvalidJoint; //< Lower than the index of the joint, or InvalidJoint for roots
+            Vector3 translation = Vector3::Zero();
+            Quaternion rotation = Quaternion::Identity();
+            Vector3 scale = Vector3::Unit();
+        };
+
+        Skeleton() = default;
+        explicit Skeleton(std::span<const Joint> joints);
+        Skeleton(const Skeleton&) = default;
+        Skeleton(Skeleton&&) noexcept = default;
+        ~Skeleton() override = default;
+
+        /**
+         * @brief Finds a joint by name.
+         * @return Index of the first joint with that name, or InvalidJoint.
+         */
+        UInt32 FindJoint(std::string_view name) const;
+
+        inline const LocalPose& GetBindPose() const;
+        inline std::size_t GetJointCount() const;
+        inline const std::string& GetJointName(UInt32 joint) const;
+        inline UInt32 GetParent(UInt32 joint) const;
+        inline std::span<const UInt32> GetParents() const;
+
+        Skeleton& operator=(const Skeleton&) = default;
+        Skeleton& operator=(Skeleton&&) noexcept = default;
+
+    private:
+        std::vector<std::string> m_names;
+        std::vector<UInt32> m_parents;
+        LocalPose m_bindPose;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Animation/Skeleton.inl>
+
+#endif // FL_ANIMATION_SKELETON_HPP
@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Animation/Skeleton.hpp>
+
+namespace Fl {
+    inline const LocalPose& Skeleton::GetBindPose() const {
+        return m_bindPose;
+    }
+
+    inline std::size_t Skeleton::GetJointCount() const {
+        return m_parents.size();
+    }
+
+    inline const std::string& Skeleton::GetJointName(const UInt32 joint) const {
+        return m_names[joint];
+    }
+
+    inline UInt32 Skeleton::GetParent(const UInt32 joint) const {
+        return m_parents[joint];
+    }
+
+    inline std::span<const UInt32> Skeleton::GetParents() const {
+        return m_parents;
+    }
+} // namespace Fl
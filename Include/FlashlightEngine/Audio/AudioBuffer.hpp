@@ -0,0 +1,67 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AUDIO_AUDIOBUFFER_HPP
+#define FL_AUDIO_AUDIOBUFFER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Mono sound in 32-bit float samples, played by the voices of an AudioMixer.
+     *
+     * Voices are panned in the stereo field by the mixer, multichannel sounds are mixed down to mono when loaded.
+     */
+    class FL_API AudioBuffer {
+    public:
+        AudioBuffer() = default;
+        /**
+         * @param samples Samples, nominally in [-1, 1].
+         * @param sampleRate Number of samples per second.
+         */
+        AudioBuffer(std::vector<float> samples, UInt32 sampleRate);
+        AudioBuffer(const AudioBuffer&) = default;
+        AudioBuffer(AudioBuffer&&) noexcept = default;
+        ~AudioBuffer() = default;
+
+        /**
+         * @brief Gets the duration of the sound.
+         * @return Duration in seconds.
+         */
+        inline double GetDuration() const;
+        inline std::size_t GetSampleCount() const;
+        inline UInt32 GetSampleRate() const;
+        inline std::span<const float> GetSamples() const;
+
+        inline bool IsValid() const;
+
+        AudioBuffer& operator=(const AudioBuffer&) = default;
+        AudioBuffer& operator=(AudioBuffer&&) noexcept = default;
+
+        /**
+         * @brief Loads a WAV file holding 8, 16, 24 or 32-bit integer PCM or 32-bit float samples.
+         * @remark The channels are averaged into a single one.
+         * @param filePath UTF-8 path of the file.
+         * @param errorMessage Receives the reason of a failure, may be nullptr.
+         * @return Loaded sound, or std::nullopt on failure.
+         */
+        static std::optional<AudioBuffer> LoadFromFile(std::string_view filePath, std::string* errorMessage = nullptr);
+
+    private:
+        std::vector<float> m_samples;
+        UInt32 m_sampleRate = 0;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Audio/AudioBuffer.inl>
+
+#endif // FL_AUDIO_AUDIOBUFFER_HPP
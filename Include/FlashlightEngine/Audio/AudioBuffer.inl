@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Audio/AudioBuffer.hpp>
+
+namespace Fl {
+    inline double AudioBuffer::GetDuration() const {
+        return IsValid() ? static_cast<double>(m_samples.size()) / m_sampleRate : 0.0;
+    }
+
+    inline std::size_t AudioBuffer::GetSampleCount() const {
+        return m_samples.size();
+    }
+
+    inline UInt32 AudioBuffer::GetSampleRate() const {
+        return m_sampleRate;
+    }
+
+    inline std::span<const float> AudioBuffer::GetSamples() const {
+        return m_samples;
+    }
+
+    inline bool AudioBuffer::IsValid() const {
+        return m_sampleRate > 0 && !m_samples.empty();
+    }
+} // namespace Fl
@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AUDIO_AUDIODEVICE_HPP
+#define FL_AUDIO_AUDIODEVICE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <span>
+#include <string>
+
+namespace Fl {
+    class AudioDevice;
+
+    // Functions exported with C linkage by the device plugins, see AudioDeviceLibrary
+    using AudioDeviceCreateFunc = AudioDevice* (*)(const char* options);
+    using AudioDeviceDestroyFunc = void (*)(AudioDevice* device);
+
+    /**
+     * @brief Output receiving the stereo frames mixed by an AudioMixer.
+     *
+     * Backends are either instantiated directly or loaded at runtime from a plugin through AudioDeviceLibrary, which
+     * makes them interchangeable without linking the engine to any platform audio library.
+     */
+    class FL_API AudioDevice {
+    public:
+        static constexpr UInt32 ChannelCount = 2;
+
+        static constexpr const char* CreateFunctionName = "FlCreateAudioDevice";
+        static constexpr const char* DestroyFunctionName = "FlDestroyAudioDevice";
+
+        AudioDevice() = default;
+        AudioDevice(const AudioDevice&) = delete;
+        AudioDevice(AudioDevice&&) = delete;
+        virtual ~AudioDevice();
+
+        virtual void Close() = 0;
+
+        /**
+         * @brief Gets the number of frames written since the device was opened.
+         */
+        virtual UInt64 GetFrameCount() const = 0;
+        /**
+         * @brief Gets the sample rate the device was opened with.
+         * @return Frames per second, or 0 if the device is closed.
+         */
+        virtual UInt32 GetSampleRate() const = 0;
+
+        virtual bool IsOpen() const = 0;
+
+        /**
+         * @brief Opens the device, closing it first if needed.
+         * @param sampleRate Frames per second.
+         * @param errorMessage Receives the reason of a failure, may be nullptr.
+         * @return Whether the device was opened.
+         */
+        virtual bool Open(UInt32 sampleRate, std::string* errorMessage = nullptr) = 0;
+
+        /**
+         * @brief Queues frames for playback, blocking while the device can't accept them.
+         * @param samples Interleaved frames of ChannelCount samples.
+         * @return Whether the frames were queued, the mixer thread stops writing after a failure.
+         */
+        virtual bool Write(std::span<const float> samples) = 0;
+
+        AudioDevice& operator=(const AudioDevice&) = delete;
+        AudioDevice& operator=(AudioDevice&&) = delete;
+    };
+} // namespace Fl
+
+#endif // FL_AUDIO_AUDIODEVICE_HPP
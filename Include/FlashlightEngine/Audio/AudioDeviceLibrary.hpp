@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AUDIO_AUDIODEVICELIBRARY_HPP
+#define FL_AUDIO_AUDIODEVICELIBRARY_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Audio/AudioDevice.hpp>
+#include <FlashlightEngine/Core/DynLib.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace Fl {
+    /**
+     * @brief Audio device backend loaded from a plugin.
+     *
+     * A plugin is a shared library exporting, with C linkage:
+     * - AudioDevice* FlCreateAudioDevice(const char* options), returning nullptr on failure;
+     * - void FlDestroyAudioDevice(AudioDevice* device).
+     *
+     * The meaning of the options string is up to the backend (an output path for the WAV device for instance).
+     * Devices are destroyed by the plugin which created them, and must be destroyed before the library is unloaded.
+     */
+    class FL_API AudioDeviceLibrary {
+    public:
+        struct DeviceDeleter {
+            AudioDeviceDestroyFunc destroy;
+
+            void operator()(AudioDevice* device) const;
+        };
+
+        using DevicePtr = std::unique_ptr<AudioDevice, DeviceDeleter>;
+
+        AudioDeviceLibrary() = default;
+        AudioDeviceLibrary(const AudioDeviceLibrary&) = delete;
+        AudioDeviceLibrary(AudioDeviceLibrary&&) noexcept = default;
+        ~AudioDeviceLibrary() = default;
+
+        /**
+         * @brief Creates a device of the loaded backend.
+         * @param options Backend-specific options.
+         * @return Created device, or nullptr if the plugin failed to create it.
+         */
+        DevicePtr CreateDevice(const char* options = "") const;
+
+        inline bool IsLoaded() const;
+
+        /**
+         * @brief Loads a plugin, unloading the current one first.
+         * @param libraryPath Path of the library, its extension being added when missing.
+         * @param errorMessage Receives the reason of a failure, may be nullptr.
+         * @return Whether the library was loaded and exports the plugin functions.
+         */
+        bool Load(const std::filesystem::path& libraryPath, std::string* errorMessage = nullptr);
+        void Unload();
+
+        AudioDeviceLibrary& operator=(const AudioDeviceLibrary&) = delete;
+        AudioDeviceLibrary& operator=(AudioDeviceLibrary&&) noexcept = default;
+
+    private:
+        DynLib m_library;
+        AudioDeviceCreateFunc m_create = nullptr;
+        AudioDeviceDestroyFunc m_destroy = nullptr;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Audio/AudioDeviceLibrary.inl>
+
+#endif // FL_AUDIO_AUDIODEVICELIBRARY_HPP
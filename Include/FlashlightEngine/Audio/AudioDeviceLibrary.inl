@@ -0,0 +1,13 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Audio/AudioDeviceLibrary.hpp>
+
+namespace Fl {
+    inline bool AudioDeviceLibrary::IsLoaded() const {
+        return m_create != nullptr;
+    }
+} // namespace Fl
@@ -0,0 +1,233 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AUDIO_AUDIOMIXER_HPP
+#define FL_AUDIO_AUDIOMIXER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Utility/SpscQueue.hpp>
+
+#include <atomic>
+#include <limits>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace Fl {
+    class AudioBuffer;
+    class AudioDevice;
+
+    /**
+     * @brief Mixes voices playing mono sounds through a graph of buses into stereo frames.
+     *
+     * The mixer is driven by commands: playing a voice or changing its parameters from the game thread only pushes a
+     * command in a lock-free queue, applied by the mixing thread at the start of the next block. Voices end by
+     * themselves or when stopped, their identifiers becoming invalid once the mixing thread released them.
+     *
+     * Frames are mixed in blocks of Settings::blockFrameCount. The parameters of the playing voices are stored as
+     * structures of arrays, their pan and gain being turned into channel gains SimdFloat4::Width voices at once.
+     * Each voice is then resampled with linear interpolation and accumulated into its bus SimdFloat4::Width frames at
+     * a time, the channel gains ramping over the block so that parameter changes don't click.
+     *
+     * Buses form a tree rooted at MasterBus: every bus is scaled by its gain and added to its parent. The master bus
+     * gives the output, without clipping.
+     *
+     * Either Start() a thread writing the blocks to an AudioDevice, or call Render() to mix on the calling thread.
+     * Game-side functions (Play(), Set*(), IsPlaying()...) must all be called from the same thread.
+     */
+    class FL_API AudioMixer {
+    public:
+        using BusId = UInt32;
+        using VoiceId = UInt32;
+
+        static constexpr BusId InvalidBus = std::numeric_limits<BusId>::max();
+        static constexpr VoiceId InvalidVoice = std::numeric_limits<VoiceId>::max();
+        static constexpr BusId MasterBus = 0;
+
+        struct Settings {
+            UInt32 sampleRate = 48000;
+            UInt32 blockFrameCount = 256; //< Multiple of SimdFloat4::Width
+            UInt32 maxVoiceCount = 1024; //< At most 65535
+            UInt32 maxBusCount = 32;
+            std::size_t commandCapacity = 4096; //< Commands waiting for the next block
+        };
+
+        struct VoiceParameters {
+            BusId bus = MasterBus;
+            float gain = 1.0f;
+            float pan = 0.0f; //< From -1 (left) to 1 (right), with a constant power pan law
+            float pitch = 1.0f; //< Playback speed factor, the sound being resampled to the mixer rate
+            bool isLooping = false;
+        };
+
+        /**
+         * @brief Statistics accumulated since the construction of the mixer.
+         * @remark Written by the mixing thread, only read them while it is stopped.
+         */
+        struct Statistics {
+            std::size_t blockCount;
+            std::size_t frameCount;
+            std::size_t voiceCount; //< Voices mixed, summed over the blocks
+            Clock::duration mixTime;
+
+            /**
+             * @brief Gets the number of voices mixed per millisecond, each one over a block.
+             */
+            inline double GetVoicesPerMillisecond() const;
+        };
+
+        AudioMixer();
+        explicit AudioMixer(const Settings& settings);
+        AudioMixer(const AudioMixer&) = delete;
+        AudioMixer(AudioMixer&&) = delete;
+        ~AudioMixer();
+
+        /**
+         * @brief Adds a bus to the graph.
+         * @param parent Bus receiving the output of the new one.
+         * @param gain Gain applied to the output of the bus.
+         * @return Identifier of the bus, or InvalidBus if Settings::maxBusCount was reached or the command queue is
+         *         full.
+         */
+        BusId CreateBus(BusId parent = MasterBus, float gain = 1.0f);
+
+        /**
+         * @brief Gets the number of voices which weren't released by the mixing thread yet.
+         */
+        UInt32 GetPlayingVoiceCount();
+        inline const Settings& GetSettings() const;
+        inline const Statistics& GetStatistics() const;
+
+        /**
+         * @brief Checks whether a voice is still playing, or about to.
+         */
+        bool IsPlaying(VoiceId voice);
+        /**
+         * @brief Checks whether a mixing thread was started.
+         */
+        inline bool IsRunning() const;
+
+        VoiceId Play(const AudioBuffer& buffer);
+        /**
+         * @brief Plays a sound from its beginning.
+         * @remark The buffer must outlive the voice.
+         * @param buffer Sound to play.
+         * @param parameters Initial parameters of the voice.
+         * @return Identifier of the voice, or InvalidVoice if Settings::maxVoiceCount voices are playing or the
+         *         command queue is full.
+         */
+        VoiceId Play(const AudioBuffer& buffer, const VoiceParameters& parameters);
+
+        /**
+         * @brief Applies the pending commands and mixes frames on the calling thread.
+         * @remark The mixing thread must be stopped.
+         * @param samples Receives interleaved stereo frames.
+         */
+        void Render(std::span<float> samples);
+
+        // Commands, returning false when the queue is full, commands targeting ended voices being ignored
+        bool SetBusGain(BusId bus, float gain);
+        bool SetVoiceGain(VoiceId voice, float gain);
+        bool SetVoicePan(VoiceId voice, float pan);
+        bool SetVoicePitch(VoiceId voice, float pitch);
+
+        /**
+         * @brief Starts a thread mixing blocks and writing them to a device.
+         * @remark The device must be open at the sample rate of the mixer, and outlive the thread.
+         * @param device Device receiving the blocks.
+         */
+        void Start(AudioDevice& device);
+        /**
+         * @brief Stops the mixing thread, if any, waiting for the last block to be written.
+         */
+        void Stop();
+        bool StopVoice(VoiceId voice);
+
+        AudioMixer& operator=(const AudioMixer&) = delete;
+        AudioMixer& operator=(AudioMixer&&) = delete;
+
+    private:
+        enum class CommandType : UInt8 {
+            CreateBus,
+            Play,
+            SetBusGain,
+            SetVoiceGain,
+            SetVoicePan,
+            SetVoicePitch,
+            StopVoice
+        };
+
+        struct Command {
+            CommandType type;
+            UInt32 target; //< Voice or bus
+            float value;
+            const AudioBuffer* buffer;
+            VoiceParameters parameters;
+        };
+
+        void ApplyCommand(const Command& command);
+        void ApplyCommands();
+        void CollectVoices();
+        UInt32 FindLane(VoiceId voice) const;
+        /**
+         * @brief Applies the pending commands, then mixes a block.
+         */
+        void MixBlock(float* samples, UInt32 frameCount);
+        /**
+         * @brief Resamples a voice and accumulates it into its bus.
+         * @return Whether the voice reached the end of its sound.
+         */
+        bool MixVoice(UInt32 lane, UInt32 frameCount, float* left, float* right);
+        bool PushCommand(const Command& command);
+        void ReleaseVoice(UInt32 lane);
+        void RunThread(AudioDevice& device);
+        void UpdateChannelGains();
+
+        static constexpr UInt32 InvalidLane = std::numeric_limits<UInt32>::max();
+
+        // Game thread
+        std::vector<UInt16> m_slotGenerations;
+        std::vector<UInt16> m_freeSlots;
+        UInt32 m_busCount = 1;
+
+        // Mixing thread, voices being packed in lanes
+        std::vector<const float*> m_voiceSamples;
+        std::vector<UInt64> m_voicePositions; //< 32.32 fixed point
+        std::vector<UInt64> m_voiceSteps; //< 32.32 fixed point
+        std::vector<double> m_voiceRateRatios; //< Sound sample rate over mixer sample rate
+        std::vector<float> m_voiceGains;
+        std::vector<float> m_voicePans;
+        std::vector<float> m_voiceLeftGains; //< Reached at the end of the previous block
+        std::vector<float> m_voiceRightGains;
+        std::vector<float> m_voiceTargetLeftGains; //< Reached at the end of the current block
+        std::vector<float> m_voiceTargetRightGains;
+        std::vector<VoiceId> m_voiceIds;
+        std::vector<UInt32> m_voiceLengths;
+        std::vector<BusId> m_voiceBuses;
+        std::vector<UInt8> m_voiceFlags;
+        std::vector<UInt32> m_slotLanes;
+        std::vector<UInt32> m_endedLanes;
+        std::vector<float> m_busSamples; //< Left then right channel of every bus
+        std::vector<float> m_busGains;
+        std::vector<float> m_busCurrentGains;
+        std::vector<BusId> m_busParents;
+        std::vector<UInt8> m_busUsed;
+        UInt32 m_laneCount = 0;
+        UInt32 m_mixerBusCount = 1;
+        Statistics m_statistics;
+
+        SpscQueue<Command> m_commands;
+        SpscQueue<VoiceId> m_releasedVoices;
+        std::atomic_bool m_isRunning = false;
+        std::thread m_thread;
+        Settings m_settings;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Audio/AudioMixer.inl>
+
+#endif // FL_AUDIO_AUDIOMIXER_HPP
@@ -0,0 +1,28 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Audio/AudioMixer.hpp>
+
+#include <chrono>
+
+namespace Fl {
+    inline double AudioMixer::Statistics::GetVoicesPerMillisecond() const {
+        const double milliseconds = std::chrono::duration<double, std::milli>(mixTime).count();
+        return (milliseconds > 0.0) ? static_cast<double>(voiceCount) / milliseconds : 0.0;
+    }
+
+    inline auto AudioMixer::GetSettings() const -> const Settings& {
+        return m_settings;
+    }
+
+    inline auto AudioMixer::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+
+    inline bool AudioMixer::IsRunning() const {
+        return m_thread.joinable();
+    }
+} // namespace Fl
@@ -0,0 +1,47 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AUDIO_NULLAUDIODEVICE_HPP
+#define FL_AUDIO_NULLAUDIODEVICE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Audio/AudioDevice.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+
+namespace Fl {
+    /**
+     * @brief Device discarding the frames, to run the mixer headless.
+     *
+     * Frames are accepted as fast as they are mixed, unless the device runs in real time: writes then block until the
+     * previous frames would have been played, like a hardware device would.
+     * The plugin version takes "realtime" as options to enable it.
+     */
+    class FL_API NullAudioDevice final : public AudioDevice {
+    public:
+        explicit NullAudioDevice(bool isRealTime = false);
+        ~NullAudioDevice() override = default;
+
+        void Close() override;
+
+        UInt64 GetFrameCount() const override;
+        UInt32 GetSampleRate() const override;
+
+        bool IsOpen() const override;
+        bool IsRealTime() const;
+
+        bool Open(UInt32 sampleRate, std::string* errorMessage = nullptr) override;
+
+        bool Write(std::span<const float> samples) override;
+
+    private:
+        Clock::time_point m_startTime;
+        UInt64 m_frameCount = 0;
+        UInt32 m_sampleRate = 0;
+        bool m_isRealTime;
+    };
+} // namespace Fl
+
+#endif // FL_AUDIO_NULLAUDIODEVICE_HPP
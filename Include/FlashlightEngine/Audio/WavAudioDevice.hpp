@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_AUDIO_WAVAUDIODEVICE_HPP
+#define FL_AUDIO_WAVAUDIODEVICE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Audio/AudioDevice.hpp>
+
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Device recording the frames into a 16-bit stereo WAV file.
+     *
+     * Samples are clamped to [-1, 1] and rounded. The sizes of the header are only valid once the device is closed,
+     * which the destructor does. The plugin version takes the UTF-8 file path as options.
+     */
+    class FL_API WavAudioDevice final : public AudioDevice {
+    public:
+        /**
+         * @param filePath UTF-8 path of the file, created or truncated when opening the device.
+         */
+        explicit WavAudioDevice(std::string_view filePath);
+        ~WavAudioDevice() override;
+
+        void Close() override;
+
+        UInt64 GetFrameCount() const override;
+        const std::string& GetFilePath() const;
+        UInt32 GetSampleRate() const override;
+
+        bool IsOpen() const override;
+
+        bool Open(UInt32 sampleRate, std::string* errorMessage = nullptr) override;
+
+        bool Write(std::span<const float> samples) override;
+
+    private:
+        std::ofstream m_file;
+        std::string m_filePath;
+        std::vector<UInt8> m_bytes;
+        UInt64 m_frameCount = 0;
+        UInt32 m_sampleRate = 0;
+    };
+} // namespace Fl
+
+#endif // FL_AUDIO_WAVAUDIODEVICE_HPP
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_CORE_CLOCK_HPP
+#define FL_CORE_CLOCK_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <chrono>
+
+namespace Fl {
+    /**
+     * @brief High-resolution monotonic clock, which isn't affected by NTP frequency adjustments.
+     *
+     * Uses CLOCK_MONOTONIC_RAW on Linux, CLOCK_UPTIME_RAW on macOS and QueryPerformanceCounter on Windows.
+     * It fulfills the standard Clock requirements and can be used with std::chrono, an instance also acts as a
+     * stopwatch started at construction.
+     */
+    class FL_API Clock {
+    public:
+        using rep = Int64;
+        using period = std::nano;
+        using duration = std::chrono::duration<rep, period>;
+        using time_point = std::chrono::time_point<Clock>;
+
+        static constexpr bool is_steady = true;
+
+        Clock();
+
+        /**
+         * @brief Gets the time elapsed since the construction of the clock or the last call to Restart().
+         * @return Elapsed time.
+         */
+        duration GetElapsedTime() const;
+        /**
+         * @brief Gets the time the clock was started at.
+         * @return Start time.
+         */
+        time_point GetStartTime() const;
+
+        /**
+         * @brief Restarts the stopwatch.
+         * @return Time elapsed since it was last started.
+         */
+        duration Restart();
+
+        /**
+         * @brief Reads the current time of the raw monotonic clock.
+         * @return Current time, from an unspecified epoch.
+         */
+        static time_point now() noexcept;
+
+    private:
+        time_point m_startTime;
+    };
+} // namespace Fl
+
+#endif // FL_CORE_CLOCK_HPP
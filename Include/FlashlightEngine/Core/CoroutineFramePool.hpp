@@ -0,0 +1,72 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_CORE_COROUTINEFRAMEPOOL_HPP
+#define FL_CORE_COROUTINEFRAMEPOOL_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Task.hpp>
+#include <FlashlightEngine/Utility/MpmcQueue.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Thread-safe pool recycling coroutine frames by size class.
+     *
+     * Freed frames are kept in a lock-free free list per size class (up to a maximum count) and reused by the next
+     * allocations of the same class, frames larger than the biggest class go straight to the global allocator.
+     * Frames can be freed from any thread, which happens when a coroutine ends after a thread hop.
+     */
+    class FL_API CoroutineFramePool {
+    public:
+        /**
+         * @param maxPooledFrameSize Size of the biggest frame handled by the pool (rounded up to a size class).
+         * @param maxFreeFramesPerClass Maximum number of free frames kept for each size class.
+         */
+        explicit CoroutineFramePool(std::size_t maxPooledFrameSize = 1024, std::size_t maxFreeFramesPerClass = 4096);
+        ~CoroutineFramePool();
+
+        CoroutineFramePool(const CoroutineFramePool&) = delete;
+        CoroutineFramePool(CoroutineFramePool&&) = delete;
+
+        void* Allocate(std::size_t size);
+        void Deallocate(void* ptr, std::size_t size) noexcept;
+
+        /**
+         * @brief Gets an allocator to give to SetCoroutineFrameAllocator, the pool has to outlive every frame
+         * allocated through it.
+         * @return Allocator using this pool.
+         */
+        CoroutineFrameAllocator GetAllocator() noexcept;
+        /**
+         * @brief Gets the number of frames currently in use.
+         * @return Live frame count.
+         */
+        std::size_t GetLiveFrameCount() const noexcept;
+        /**
+         * @brief Gets the number of allocations which had to be forwarded to the global allocator.
+         * @return Global allocation count since the creation of the pool.
+         */
+        std::size_t GetSystemAllocationCount() const noexcept;
+
+        CoroutineFramePool& operator=(const CoroutineFramePool&) = delete;
+        CoroutineFramePool& operator=(CoroutineFramePool&&) = delete;
+
+        static constexpr std::size_t SizeClassGranularity = 64;
+
+    private:
+        std::size_t GetSizeClass(std::size_t size) const noexcept;
+
+        std::atomic<std::size_t> m_liveFrameCount;
+        std::atomic<std::size_t> m_systemAllocationCount;
+        std::vector<std::unique_ptr<MpmcQueue<void*>>> m_freeLists;
+    };
+} // namespace Fl
+
+#endif // FL_CORE_COROUTINEFRAMEPOOL_HPP
@@ -0,0 +1,177 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_CORE_COROUTINESCHEDULER_HPP
+#define FL_CORE_COROUTINESCHEDULER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/MpmcQueue.hpp>
+
+#include <chrono>
+#include <coroutine>
+#include <filesystem>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Provides the awaitables Fl::Task coroutines use to wait for engine events.
+     *
+     * Coroutines waiting for the next frame, for a timer or for a hop back to the main thread are resumed by Update(),
+     * which has to be called once per frame from the thread which created the scheduler (the main thread).
+     * Thread hops and file reads are executed by the given thread pool.
+     */
+    class FL_API CoroutineScheduler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        class FL_API DelayAwaitable {
+        public:
+            DelayAwaitable(CoroutineScheduler& scheduler, Clock::time_point deadline);
+
+            bool await_ready() const noexcept;
+            void await_suspend(std::coroutine_handle<> handle);
+            void await_resume() const noexcept;
+
+        private:
+            CoroutineScheduler& m_scheduler;
+            Clock::time_point m_deadline;
+        };
+
+        class FL_API MainThreadAwaitable {
+        public:
+            explicit MainThreadAwaitable(CoroutineScheduler& scheduler);
+
+            bool await_ready() const noexcept;
+            void await_suspend(std::coroutine_handle<> handle);
+            void await_resume() const noexcept;
+
+        private:
+            CoroutineScheduler& m_scheduler;
+        };
+
+        class FL_API NextFrameAwaitable {
+        public:
+            explicit NextFrameAwaitable(CoroutineScheduler& scheduler);
+
+            bool await_ready() const noexcept;
+            void await_suspend(std::coroutine_handle<> handle);
+            void await_resume() const noexcept;
+
+        private:
+            CoroutineScheduler& m_scheduler;
+        };
+
+        class FL_API ReadFileAwaitable {
+        public:
+            ReadFileAwaitable(CoroutineScheduler& scheduler, std::filesystem::path path);
+
+            bool await_ready() const noexcept;
+            void await_suspend(std::coroutine_handle<> handle);
+            std::optional<std::vector<UInt8>> await_resume() noexcept;
+
+        private:
+            static void ReadJob(void* userdata);
+
+            CoroutineScheduler& m_scheduler;
+            std::coroutine_handle<> m_handle;
+            std::filesystem::path m_path;
+            std::optional<std::vector<UInt8>> m_content;
+        };
+
+        class FL_API ThreadPoolAwaitable {
+        public:
+            explicit ThreadPoolAwaitable(CoroutineScheduler& scheduler);
+
+            bool await_ready() const noexcept;
+            void await_suspend(std::coroutine_handle<> handle);
+            void await_resume() const noexcept;
+
+        private:
+            CoroutineScheduler& m_scheduler;
+        };
+
+        /**
+         * @param threadPool Thread pool executing thread hops and file reads, must outlive the scheduler.
+         * @param mainThreadQueueCapacity Maximum number of coroutines waiting to hop back to the main thread.
+         */
+        explicit CoroutineScheduler(ThreadPool& threadPool, std::size_t mainThreadQueueCapacity = 4096);
+        ~CoroutineScheduler();
+
+        CoroutineScheduler(const CoroutineScheduler&) = delete;
+        CoroutineScheduler(CoroutineScheduler&&) = delete;
+
+        /**
+         * @brief Suspends the coroutine until the first Update() happening after the given duration.
+         * @param duration Duration to wait.
+         * @return Awaitable object.
+         */
+        DelayAwaitable Delay(Clock::duration duration);
+        /**
+         * @brief Suspends the coroutine until the next call to Update().
+         * @return Awaitable object.
+         */
+        NextFrameAwaitable NextFrame();
+        /**
+         * @brief Reads a whole file on the thread pool, the coroutine is resumed on the main thread once it's done.
+         * @param path Path of the file to read.
+         * @return Awaitable object returning the content of the file, or std::nullopt if it couldn't be read.
+         */
+        ReadFileAwaitable ReadFile(std::filesystem::path path);
+        /**
+         * @brief Moves the coroutine to the main thread, resuming it during the next Update().
+         * @remark Doesn't suspend the coroutine if it's already running on the main thread.
+         * @return Awaitable object.
+         */
+        MainThreadAwaitable SwitchToMainThread();
+        /**
+         * @brief Moves the coroutine to one of the thread pool workers.
+         * @return Awaitable object.
+         */
+        ThreadPoolAwaitable SwitchToThreadPool();
+
+        /**
+         * @brief Gets the number of coroutines waiting for a frame or a timer.
+         * @return Number of coroutines suspended on this scheduler from the main thread.
+         */
+        std::size_t GetWaitingCount() const;
+        ThreadPool& GetThreadPool();
+
+        bool IsMainThread() const;
+
+        /**
+         * @brief Resumes the coroutines waiting for the next frame, whose timer expired or which hopped back to the
+         * main thread.
+         * @remark Must be called from the main thread.
+         */
+        void Update();
+        /**
+         * @brief Same as Update(), using the given time to check timers instead of the current time.
+         * @param now Current time.
+         */
+        void Update(Clock::time_point now);
+
+        CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+        CoroutineScheduler& operator=(CoroutineScheduler&&) = delete;
+
+    private:
+        struct Timer {
+            Clock::time_point deadline;
+            std::coroutine_handle<> handle;
+        };
+
+        ThreadPool& m_threadPool;
+        MpmcQueue<std::coroutine_handle<>> m_mainThreadQueue;
+        std::thread::id m_mainThreadId;
+        std::vector<std::coroutine_handle<>> m_nextFrame;
+        std::vector<std::coroutine_handle<>> m_resumeList;
+        std::vector<Timer> m_timers; //< Min-heap on deadline
+    };
+} // namespace Fl
+
+#endif // FL_CORE_COROUTINESCHEDULER_HPP
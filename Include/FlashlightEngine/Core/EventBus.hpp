@@ -0,0 +1,180 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_CORE_EVENTBUS_HPP
+#define FL_CORE_EVENTBUS_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Utility/Delegate.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Deferred event bus: events are stored per type in contiguous queues and handed to handlers in batches
+     * when Dispatch() is called.
+     *
+     * Publish() may be called from any number of threads at once, it only reserves a slot with an atomic increment and
+     * constructs the event in place. Queues only grow at dispatch time, when a frame published more events than they
+     * could hold, which means a bus that reached its steady state never allocates. Systems publishing a lot of events
+     * should use the span overload of Publish(), which only pays for the atomic increment once per batch.
+     *
+     * Dispatch() is a sync point: no thread may publish while it runs, except handlers themselves (their events are
+     * delivered at the next dispatch). Event types are dispatched in the order of the Events pack, handlers in the
+     * order they subscribed, and events of a given type in publication order for each thread.
+     *
+     * @tparam Events Distinct event types the bus can carry.
+     */
+    template <typename... Events>
+    class EventBus {
+        template <typename E>
+        static constexpr bool IsEvent = (std::is_same_v<E, Events> || ...);
+
+    public:
+        template <typename E>
+        using Handler = Delegate<void(std::span<const E> events)>;
+        using SubscriptionId = UInt32;
+
+        /**
+         * @param initialCapacity Number of events of each type the bus can hold before its first growth.
+         */
+        explicit EventBus(std::size_t initialCapacity = 1024);
+        EventBus(const EventBus&) = delete;
+        EventBus(EventBus&&) = delete;
+        ~EventBus() = default;
+
+        /**
+         * @brief Handles every pending event, type by type, then clears the queues.
+         * @remark Must not be called while other threads publish events.
+         */
+        void Dispatch();
+        /**
+         * @brief Handles every pending event of a given type.
+         * @tparam E Event type.
+         */
+        template <typename E>
+        void Dispatch();
+
+        /**
+         * @brief Gets the number of events of a given type waiting for the next dispatch.
+         * @tparam E Event type.
+         * @return Number of pending events.
+         */
+        template <typename E>
+        std::size_t GetPendingCount() const;
+
+        /**
+         * @brief Queues an event, constructed in place from the given arguments.
+         * @remark Thread-safe.
+         * @tparam E Event type.
+         * @param args Arguments forwarded to the event constructor.
+         */
+        template <typename E, typename... Args>
+        void Publish(Args&&... args);
+        /**
+         * @brief Queues copies of a range of events with a single reservation.
+         * @remark Thread-safe.
+         * @param events Events to publish.
+         */
+        template <typename E>
+        void Publish(std::span<const E> events);
+
+        /**
+         * @brief Registers a handler for one event type.
+         * @tparam E Event type.
+         * @param handler Callable taking either a const E& (called once per event) or a std::span<const E> (called
+         * once per batch), which must fit in a Delegate.
+         * @return Subscription identifier, to be used with Unsubscribe().
+         */
+        template <typename E, typename F>
+        SubscriptionId Subscribe(F&& handler);
+        /**
+         * @brief Registers a visitor (usually an Fl::Overloaded) for every event type it accepts.
+         * @param visitor Callable invocable with a const E& for at least one of the event types.
+         * @return Subscription identifier shared by all the registered event types.
+         */
+        template <typename F>
+        SubscriptionId SubscribeAll(F&& visitor);
+
+        /**
+         * @brief Removes every handler registered with the given subscription.
+         * @remark Subscribing and unsubscribing must not happen while events are dispatched.
+         * @param subscription Identifier returned by Subscribe() or SubscribeAll().
+         */
+        void Unsubscribe(SubscriptionId subscription);
+
+        EventBus& operator=(const EventBus&) = delete;
+        EventBus& operator=(EventBus&&) = delete;
+
+    private:
+        template <typename E>
+        class EventQueue {
+        public:
+            EventQueue() = default;
+            EventQueue(const EventQueue&) = delete;
+            EventQueue(EventQueue&&) = delete;
+            ~EventQueue();
+
+            // Destroys the events and grows the storage if some of them had to go to the overflow vector
+            void Clear();
+
+            template <typename... Args>
+            void Emplace(Args&&... args);
+            void Insert(std::span<const E> events);
+
+            std::span<const E> GetEvents() const;
+            std::span<const E> GetOverflowEvents() const;
+            std::size_t GetSize() const;
+
+            void Reserve(std::size_t capacity);
+
+            EventQueue& operator=(const EventQueue&) = delete;
+            EventQueue& operator=(EventQueue&&) = delete;
+
+        private:
+            E* m_storage = nullptr;
+            std::size_t m_capacity = 0;
+            alignas(CacheLineSize) std::atomic<std::size_t> m_reserved = 0;
+            alignas(CacheLineSize) std::mutex m_overflowMutex;
+            std::vector<E> m_overflow;
+        };
+
+        template <typename E>
+        struct Subscriber {
+            SubscriptionId id;
+            Handler<E> handler;
+        };
+
+        template <typename E>
+        struct Channel {
+            EventQueue<E> queues[2];
+            std::vector<Subscriber<E>> subscribers;
+            UInt32 writeQueue = 0;
+        };
+
+        template <typename E>
+        Channel<E>& GetChannel();
+        template <typename E>
+        const Channel<E>& GetChannel() const;
+
+        template <typename E, typename F>
+        void AddSubscriber(SubscriptionId subscription, F&& handler);
+
+        std::tuple<Channel<Events>...> m_channels;
+        SubscriptionId m_nextSubscriptionId;
+        bool m_isDispatching;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Core/EventBus.inl>
+
+#endif // FL_CORE_EVENTBUS_HPP
@@ -0,0 +1,236 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Core/EventBus.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    template <typename... Events>
+    EventBus<Events...>::EventBus(const std::size_t initialCapacity) :
+        m_nextSubscriptionId(1), m_isDispatching(false) {
+        (GetChannel<Events>().queues[0].Reserve(initialCapacity), ...);
+        (GetChannel<Events>().queues[1].Reserve(initialCapacity), ...);
+    }
+
+    template <typename... Events>
+    void EventBus<Events...>::Dispatch() {
+        (Dispatch<Events>(), ...);
+    }
+
+    template <typename... Events>
+    template <typename E>
+    void EventBus<Events...>::Dispatch() {
+        static_assert(IsEvent<E>, "Type is not an event of this bus.");
+
+        Channel<E>& channel = GetChannel<E>();
+
+        // Events published by the handlers go to the other queue, they'll be dispatched next time
+        EventQueue<E>& queue = channel.queues[channel.writeQueue];
+        channel.writeQueue ^= 1;
+
+        m_isDispatching = true;
+        for (const std::span<const E> events : {queue.GetEvents(), queue.GetOverflowEvents()}) {
+            if (events.empty()) {
+                continue;
+            }
+
+            for (const Subscriber<E>& subscriber : channel.subscribers) {
+                subscriber.handler(events);
+            }
+        }
+        m_isDispatching = false;
+
+        queue.Clear();
+    }
+
+    template <typename... Events>
+    template <typename E>
+    std::size_t EventBus<Events...>::GetPendingCount() const {
+        static_assert(IsEvent<E>, "Type is not an event of this bus.");
+
+        const Channel<E>& channel = GetChannel<E>();
+        return channel.queues[channel.writeQueue].GetSize();
+    }
+
+    template <typename... Events>
+    template <typename E, typename... Args>
+    void EventBus<Events...>::Publish(Args&&... args) {
+        static_assert(IsEvent<E>, "Type is not an event of this bus.");
+
+        Channel<E>& channel = GetChannel<E>();
+        channel.queues[channel.writeQueue].Emplace(std::forward<Args>(args)...);
+    }
+
+    template <typename... Events>
+    template <typename E>
+    void EventBus<Events...>::Publish(const std::span<const E> events) {
+        static_assert(IsEvent<E>, "Type is not an event of this bus.");
+
+        Channel<E>& channel = GetChannel<E>();
+        channel.queues[channel.writeQueue].Insert(events);
+    }
+
+    template <typename... Events>
+    template <typename E, typename F>
+    auto EventBus<Events...>::Subscribe(F&& handler) -> SubscriptionId {
+        static_assert(IsEvent<E>, "Type is not an event of this bus.");
+
+        const SubscriptionId subscription = m_nextSubscriptionId++;
+        AddSubscriber<E>(subscription, std::forward<F>(handler));
+
+        return subscription;
+    }
+
+    template <typename... Events>
+    template <typename F>
+    auto EventBus<Events...>::SubscribeAll(F&& visitor) -> SubscriptionId {
+        static_assert((std::is_invocable_v<std::decay_t<F>&, const Events&> || ...),
+                      "Visitor doesn't handle any of the bus events.");
+
+        const SubscriptionId subscription = m_nextSubscriptionId++;
+
+        // Each event type gets its own copy of the visitor
+        const auto addIfInvocable = [&]<typename E>() {
+            if constexpr (std::is_invocable_v<std::decay_t<F>&, const E&>) {
+                AddSubscriber<E>(subscription, visitor);
+            }
+        };
+        (addIfInvocable.template operator()<Events>(), ...);
+
+        return subscription;
+    }
+
+    template <typename... Events>
+    void EventBus<Events...>::Unsubscribe(const SubscriptionId subscription) {
+        FlAssertMsg(!m_isDispatching, "[Core/EventBus] Cannot unsubscribe while dispatching events.");
+
+        const auto removeFrom = [&](auto& channel) {
+            std::erase_if(channel.subscribers, [&](const auto& subscriber) { return subscriber.id == subscription; });
+        };
+        std::apply([&](auto&... channels) { (removeFrom(channels), ...); }, m_channels);
+    }
+
+    template <typename... Events>
+    template <typename E>
+    auto EventBus<Events...>::GetChannel() -> Channel<E>& {
+        return std::get<Channel<E>>(m_channels);
+    }
+
+    template <typename... Events>
+    template <typename E>
+    auto EventBus<Events...>::GetChannel() const -> const Channel<E>& {
+        return std::get<Channel<E>>(m_channels);
+    }
+
+    template <typename... Events>
+    template <typename E, typename F>
+    void EventBus<Events...>::AddSubscriber(const SubscriptionId subscription, F&& handler) {
+        FlAssertMsg(!m_isDispatching, "[Core/EventBus] Cannot subscribe while dispatching events.");
+
+        using Func = std::decay_t<F>;
+
+        Channel<E>& channel = GetChannel<E>();
+        if constexpr (std::is_invocable_v<Func&, std::span<const E>>) {
+            channel.subscribers.push_back({subscription, Handler<E>(std::forward<F>(handler))});
+        } else {
+            static_assert(std::is_invocable_v<Func&, const E&>, "Handler must take a const E& or a std::span<const E>.");
+
+            channel.subscribers.push_back({subscription, Handler<E>([func = Func(std::forward<F>(handler))](
+                                                                        const std::span<const E> events) mutable {
+                for (const E& event : events) {
+                    func(event);
+                }
+            })});
+        }
+    }
+
+    template <typename... Events>
+    template <typename E>
+    EventBus<Events...>::EventQueue<E>::~EventQueue() {
+        Clear();
+        std::allocator<E>().deallocate(m_storage, m_capacity);
+    }
+
+    template <typename... Events>
+    template <typename E>
+    void EventBus<Events...>::EventQueue<E>::Clear() {
+        const std::size_t reserved = m_reserved.load(std::memory_order_relaxed);
+        std::destroy_n(m_storage, std::min(reserved, m_capacity));
+        m_overflow.clear();
+
+        m_reserved.store(0, std::memory_order_relaxed);
+
+        if (reserved > m_capacity) {
+            Reserve(std::max(reserved, 2 * m_capacity));
+        }
+    }
+
+    template <typename... Events>
+    template <typename E>
+    template <typename... Args>
+    void EventBus<Events...>::EventQueue<E>::Emplace(Args&&... args) {
+        const std::size_t index = m_reserved.fetch_add(1, std::memory_order_relaxed);
+        if FL_LIKELY (index < m_capacity) {
+            std::construct_at(m_storage + index, std::forward<Args>(args)...);
+            return;
+        }
+
+        std::scoped_lock lock(m_overflowMutex);
+        m_overflow.emplace_back(std::forward<Args>(args)...);
+    }
+
+    template <typename... Events>
+    template <typename E>
+    void EventBus<Events...>::EventQueue<E>::Insert(const std::span<const E> events) {
+        const std::size_t first = m_reserved.fetch_add(events.size(), std::memory_order_relaxed);
+
+        // A range crossing the end of the storage is split between it and the overflow vector
+        const std::size_t fitting = (first < m_capacity) ? std::min(events.size(), m_capacity - first) : 0;
+        std::uninitialized_copy_n(events.data(), fitting, m_storage + first);
+
+        if (fitting < events.size()) {
+            std::scoped_lock lock(m_overflowMutex);
+            m_overflow.insert(m_overflow.end(), events.begin() + fitting, events.end());
+        }
+    }
+
+    template <typename... Events>
+    template <typename E>
+    std::span<const E> EventBus<Events...>::EventQueue<E>::GetEvents() const {
+        return {m_storage, std::min(m_reserved.load(std::memory_order_relaxed), m_capacity)};
+    }
+
+    template <typename... Events>
+    template <typename E>
+    std::span<const E> EventBus<Events...>::EventQueue<E>::GetOverflowEvents() const {
+        return m_overflow;
+    }
+
+    template <typename... Events>
+    template <typename E>
+    std::size_t EventBus<Events...>::EventQueue<E>::GetSize() const {
+        return m_reserved.load(std::memory_order_relaxed);
+    }
+
+    template <typename... Events>
+    template <typename E>
+    void EventBus<Events...>::EventQueue<E>::Reserve(const std::size_t capacity) {
+        FlAssertMsg(m_reserved.load(std::memory_order_relaxed) == 0,
+                    "[Core/EventBus] Queue storage can only change while the queue is empty.");
+
+        if (capacity <= m_capacity) {
+            return;
+        }
+
+        std::allocator<E> allocator;
+        allocator.deallocate(m_storage, m_capacity);
+        m_storage = allocator.allocate(capacity);
+        m_capacity = capacity;
+    }
+} // namespace Fl
@@ -0,0 +1,136 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_CORE_GAMELOOP_HPP
+#define FL_CORE_GAMELOOP_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Utility/Delegate.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Main loop running the simulation with a fixed time step and the rest of the frame with a variable one.
+     *
+     * Each frame, the time elapsed since the previous one is accumulated and consumed by fixed updates. The remaining
+     * fraction of a step is given to the variable update as an interpolation factor between the last two simulation
+     * states. The number of fixed updates per frame is capped, extra time is dropped instead of making the next frame
+     * even slower (the "spiral of death").
+     *
+     * When a target frame time is set, frames are paced by sleeping until shortly before the deadline then spinning
+     * until it's reached, as sleeping alone overshoots by up to the scheduler granularity.
+     */
+    class FL_API GameLoop {
+    public:
+        using FixedUpdateCallback = Delegate<void(Clock::duration step)>;
+        using UpdateCallback = Delegate<void(Clock::duration frameTime, float alpha)>;
+
+        struct Settings {
+            Clock::duration fixedStep = std::chrono::nanoseconds(16'666'667);
+            Clock::duration targetFrameTime = Clock::duration::zero(); //< Zero means no frame rate limit
+            Clock::duration spinThreshold = std::chrono::milliseconds(2); //< Time before the deadline spent spinning
+            Clock::duration hitchThreshold = Clock::duration::zero(); //< Zero means twice the target frame time
+            UInt32 maxCatchUpSteps = 5;
+            std::size_t statisticsWindow = 240; //< Number of frames the statistics are computed on
+        };
+
+        struct FrameStatistics {
+            Clock::duration averageFrameTime;
+            Clock::duration minFrameTime;
+            Clock::duration maxFrameTime;
+            Clock::duration medianFrameTime;
+            Clock::duration percentile95FrameTime;
+            Clock::duration percentile99FrameTime;
+            std::size_t windowFrameCount;
+            std::size_t windowHitchCount;
+            UInt64 frameCount; //< Since the loop was created
+            UInt64 hitchCount; //< Since the loop was created
+            UInt64 droppedStepCount; //< Fixed steps skipped because of the catch-up cap, since the loop was created
+        };
+
+        GameLoop();
+        explicit GameLoop(const Settings& settings);
+        GameLoop(const GameLoop&) = delete;
+        GameLoop(GameLoop&&) = delete;
+        ~GameLoop() = default;
+
+        /**
+         * @brief Gets the interpolation factor of the last frame, the fraction of a fixed step left in the accumulator.
+         * @return Value in [0, 1).
+         */
+        float GetAlpha() const;
+        /**
+         * @brief Gets the duration of the frame at the given percentile of the statistics window.
+         * @param percentile Percentile, between 0 and 100.
+         * @return Frame time, zero if no frame was measured yet.
+         */
+        Clock::duration GetFrameTimePercentile(double percentile) const;
+        /**
+         * @brief Computes statistics on the frames of the rolling window.
+         * @remark Frames taking longer than the hitch threshold are counted as hitches. When no threshold is set, it
+         * defaults to twice the target frame time, or twice the fixed step if the frame rate isn't limited.
+         * @return Frame statistics.
+         */
+        FrameStatistics GetStatistics() const;
+        const Settings& GetSettings() const;
+
+        bool IsRunning() const;
+
+        /**
+         * @brief Runs frames until Stop() is called, pacing them if a target frame time is set.
+         * @param fixedUpdate Called for each fixed simulation step.
+         * @param update Called once per frame, after the fixed updates.
+         */
+        void Run(const FixedUpdateCallback& fixedUpdate, const UpdateCallback& update);
+
+        /**
+         * @brief Makes Run() return after the current frame.
+         * @remark Thread-safe.
+         */
+        void Stop();
+
+        /**
+         * @brief Runs a single frame at the given time, without any pacing.
+         * @param now Time of the frame, must not decrease from one call to the next.
+         * @param fixedUpdate Called for each fixed simulation step.
+         * @param update Called once, after the fixed updates.
+         * @return Number of fixed steps executed.
+         */
+        UInt32 Tick(Clock::time_point now, const FixedUpdateCallback& fixedUpdate, const UpdateCallback& update);
+
+        /**
+         * @brief Blocks until the next frame should start according to the target frame time.
+         * Sleeps until the deadline is closer than the spin threshold, then spins.
+         */
+        void WaitForNextFrame();
+
+        GameLoop& operator=(const GameLoop&) = delete;
+        GameLoop& operator=(GameLoop&&) = delete;
+
+    private:
+        void RecordFrameTime(Clock::duration frameTime);
+
+        Settings m_settings;
+        std::vector<Clock::duration> m_frameTimes; //< Ring buffer
+        mutable std::vector<Clock::duration> m_sortedFrameTimes;
+        Clock::duration m_accumulator;
+        Clock::time_point m_previousFrameTime;
+        Clock::time_point m_nextFrameDeadline;
+        std::atomic_bool m_isRunning;
+        std::size_t m_nextFrameTimeIndex;
+        UInt64 m_droppedStepCount;
+        UInt64 m_frameCount;
+        UInt64 m_hitchCount;
+        float m_alpha;
+        bool m_hasPreviousFrame;
+    };
+} // namespace Fl
+
+#endif // FL_CORE_GAMELOOP_HPP
@@ -0,0 +1,150 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_CORE_TASK_HPP
+#define FL_CORE_TASK_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+
+namespace Fl {
+    /**
+     * @brief Functions used to allocate and free every coroutine frame of Fl::Task.
+     * Each frame remembers the deallocation function it was allocated with, so the allocator can be changed while
+     * tasks are alive.
+     */
+    struct CoroutineFrameAllocator {
+        void* (*allocate)(std::size_t size, void* userdata);
+        void (*deallocate)(void* ptr, std::size_t size, void* userdata);
+        void* userdata;
+    };
+
+    /**
+     * @brief Replaces the allocator used for the frames of Fl::Task coroutines created afterward.
+     * @remark Must not be called while other threads are creating tasks.
+     * @param allocator New allocator, the default one uses the global operator new/delete.
+     */
+    FL_API void SetCoroutineFrameAllocator(const CoroutineFrameAllocator& allocator);
+    /**
+     * @brief Restores the default allocator (global operator new/delete) for Fl::Task coroutine frames.
+     */
+    FL_API void ResetCoroutineFrameAllocator();
+
+    template <typename T>
+    class Task;
+
+    namespace Detail {
+        FL_API void* AllocateCoroutineFrame(std::size_t size);
+        FL_API void DeallocateCoroutineFrame(void* ptr, std::size_t size) noexcept;
+
+        class TaskPromiseBase {
+        public:
+            struct FinalAwaiter {
+                bool await_ready() const noexcept;
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept;
+                void await_resume() const noexcept;
+            };
+
+            std::suspend_always initial_suspend() const noexcept;
+            FinalAwaiter final_suspend() const noexcept;
+
+            void unhandled_exception() noexcept;
+
+            static void* operator new(std::size_t size);
+            static void operator delete(void* ptr, std::size_t size) noexcept;
+
+            std::coroutine_handle<> continuation;
+
+        protected:
+            void RethrowIfFailed() const;
+
+            std::exception_ptr m_exception;
+        };
+
+        template <typename T>
+        class TaskPromise final : public TaskPromiseBase {
+        public:
+            Task<T> get_return_object() noexcept;
+
+            template <typename U>
+            void return_value(U&& value);
+
+            T TakeResult();
+
+        private:
+            std::optional<T> m_result;
+        };
+
+        template <>
+        class TaskPromise<void> final : public TaskPromiseBase {
+        public:
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept;
+
+            void TakeResult() const;
+        };
+    } // namespace Detail
+
+    /**
+     * @brief Lazily started coroutine returning a value of type T.
+     *
+     * Awaiting a task starts it and suspends the awaiting coroutine until it completes, control is handed over with
+     * symmetric transfer in both directions so long chains of tasks don't grow the stack.
+     * A task which is not awaited by another coroutine can be started with Start(), the Task object owns the coroutine
+     * frame and has to outlive it.
+     * Frames are allocated through the allocator set with SetCoroutineFrameAllocator.
+     * @tparam T Type of the returned value.
+     */
+    template <typename T = void>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = Detail::TaskPromise<T>;
+
+        Task() noexcept = default;
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+        ~Task();
+
+        Task(const Task&) = delete;
+        Task(Task&& task) noexcept;
+
+        /**
+         * @brief Gets the value returned by the task, rethrowing the exception it exited with if any.
+         * @remark The task must be done, the result is moved out of the task.
+         * @return Value returned by the coroutine.
+         */
+        T GetResult();
+
+        /**
+         * @brief Checks whether the coroutine ran to completion.
+         * @return Whether the task is done.
+         */
+        bool IsDone() const noexcept;
+        bool IsValid() const noexcept;
+
+        /**
+         * @brief Starts the task on the calling thread, running it until its first suspension point.
+         * @remark Only for tasks which are not awaited by another coroutine.
+         */
+        void Start();
+
+        auto operator co_await() && noexcept;
+
+        Task& operator=(const Task&) = delete;
+        Task& operator=(Task&& task) noexcept;
+
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Core/Task.inl>
+
+#endif // FL_CORE_TASK_HPP
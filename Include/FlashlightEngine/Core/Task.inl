@@ -0,0 +1,162 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Core/Task.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <utility>
+
+namespace Fl {
+    namespace Detail {
+        inline bool TaskPromiseBase::FinalAwaiter::await_ready() const noexcept {
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(
+            std::coroutine_handle<Promise> handle) noexcept {
+            // Symmetric transfer back to the awaiting coroutine
+            if (std::coroutine_handle<> continuation = handle.promise().continuation) {
+                return continuation;
+            }
+
+            return std::noop_coroutine();
+        }
+
+        inline void TaskPromiseBase::FinalAwaiter::await_resume() const noexcept {
+        }
+
+        inline std::suspend_always TaskPromiseBase::initial_suspend() const noexcept {
+            return {};
+        }
+
+        inline auto TaskPromiseBase::final_suspend() const noexcept -> FinalAwaiter {
+            return {};
+        }
+
+        inline void TaskPromiseBase::unhandled_exception() noexcept {
+            m_exception = std::current_exception();
+        }
+
+        inline void* TaskPromiseBase::operator new(const std::size_t size) {
+            return AllocateCoroutineFrame(size);
+        }
+
+        inline void TaskPromiseBase::operator delete(void* ptr, const std::size_t size) noexcept {
+            DeallocateCoroutineFrame(ptr, size);
+        }
+
+        inline void TaskPromiseBase::RethrowIfFailed() const {
+            if (m_exception) {
+                std::rethrow_exception(m_exception);
+            }
+        }
+
+        template <typename T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept {
+            return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+        }
+
+        template <typename T>
+        template <typename U>
+        void TaskPromise<T>::return_value(U&& value) {
+            m_result.emplace(std::forward<U>(value));
+        }
+
+        template <typename T>
+        T TaskPromise<T>::TakeResult() {
+            RethrowIfFailed();
+
+            FlAssertMsg(m_result.has_value(), "[Core/Task] Task has no result.");
+            return std::move(*m_result);
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+            return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+        }
+
+        inline void TaskPromise<void>::return_void() const noexcept {
+        }
+
+        inline void TaskPromise<void>::TakeResult() const {
+            RethrowIfFailed();
+        }
+    } // namespace Detail
+
+    template <typename T>
+    Task<T>::Task(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {
+    }
+
+    template <typename T>
+    Task<T>::~Task() {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    template <typename T>
+    Task<T>::Task(Task&& task) noexcept : m_handle(std::exchange(task.m_handle, nullptr)) {
+    }
+
+    template <typename T>
+    T Task<T>::GetResult() {
+        FlAssertMsg(IsDone(), "[Core/Task] Task is not done.");
+        return m_handle.promise().TakeResult();
+    }
+
+    template <typename T>
+    bool Task<T>::IsDone() const noexcept {
+        return m_handle && m_handle.done();
+    }
+
+    template <typename T>
+    bool Task<T>::IsValid() const noexcept {
+        return static_cast<bool>(m_handle);
+    }
+
+    template <typename T>
+    void Task<T>::Start() {
+        FlAssertMsg(m_handle && !m_handle.done(), "[Core/Task] Task is invalid or already done.");
+        m_handle.resume();
+    }
+
+    template <typename T>
+    auto Task<T>::operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept {
+                // Symmetric transfer to the awaited task, which transfers back once done
+                handle.promise().continuation = awaitingCoroutine;
+                return handle;
+            }
+
+            T await_resume() {
+                return handle.promise().TakeResult();
+            }
+        };
+
+        return Awaiter{m_handle};
+    }
+
+    template <typename T>
+    Task<T>& Task<T>::operator=(Task&& task) noexcept {
+        if (this != &task) {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+
+            m_handle = std::exchange(task.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+} // namespace Fl
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_CORE_THREADPOOL_HPP
+#define FL_CORE_THREADPOOL_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Utility/MpmcQueue.hpp>
+
+#include <coroutine>
+#include <thread>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Fixed set of worker threads executing jobs pushed in a shared lock-free queue.
+     *
+     * Jobs are a function pointer and a user pointer, submitting one never allocates.
+     * Threads waiting on jobs they submitted (like ParallelFor does) execute queued jobs in the meantime, which makes
+     * nested parallel calls from worker threads safe.
+     */
+    class FL_API ThreadPool {
+    public:
+        struct Job {
+            void (*function)(void* userdata);
+            void* userdata;
+        };
+
+        /**
+         * @param workerCount Number of worker threads to start, must be at least one.
+         * @param queueCapacity Maximum number of jobs waiting to be executed before Submit starts helping.
+         */
+        explicit ThreadPool(std::size_t workerCount = GetDefaultWorkerCount(), std::size_t queueCapacity = 4096);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+
+        /**
+         * @brief Gets the number of worker threads.
+         * @return Worker thread count.
+         */
+        std::size_t GetWorkerCount() const;
+
+        /**
+         * @brief Splits [0, count) in batches of batchSize elements processed by the workers and the calling thread.
+         * The batches boundaries only depend on count and batchSize, only the thread processing each of them varies.
+         * Returns once all batches were processed.
+         * @param count Number of elements.
+         * @param batchSize Maximum number of elements processed by a single call to func.
+         * @param func Function called as func(first, last) for each batch.
+         */
+        template <typename F>
+        void ParallelFor(std::size_t count, std::size_t batchSize, F&& func);
+
+        /**
+         * @brief Queues a job, executing already queued jobs on the calling thread while the queue is full.
+         * @param job Job to queue.
+         */
+        void Submit(const Job& job);
+        /**
+         * @brief Queues the resumption of a suspended coroutine on a worker thread.
+         * @param handle Coroutine to resume.
+         */
+        void Submit(std::coroutine_handle<> handle);
+
+        /**
+         * @brief Pops and executes a single job if one is queued.
+         * @return Whether a job was executed.
+         */
+        bool TryExecuteJob();
+
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /**
+         * @brief Gets the default number of workers, one per hardware thread minus the main thread (at least one).
+         * @return Default worker count.
+         */
+        static std::size_t GetDefaultWorkerCount();
+
+    private:
+        void WorkerMain();
+
+        MpmcQueue<Job> m_jobs;
+        std::vector<std::thread> m_workers;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Core/ThreadPool.inl>
+
+#endif // FL_CORE_THREADPOOL_HPP
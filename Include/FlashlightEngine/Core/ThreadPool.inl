@@ -0,0 +1,77 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace Fl {
+    namespace Detail {
+        template <typename F>
+        struct ParallelForContext {
+            F* func;
+            std::size_t count;
+            std::size_t batchSize;
+            std::atomic<std::size_t> nextBatch;
+            std::atomic<std::size_t> pendingHelpers;
+
+            void ProcessBatches() {
+                const std::size_t batchCount = (count + batchSize - 1) / batchSize;
+
+                std::size_t batch;
+                while ((batch = nextBatch.fetch_add(1, std::memory_order_relaxed)) < batchCount) {
+                    const std::size_t first = batch * batchSize;
+                    (*func)(first, std::min(first + batchSize, count));
+                }
+            }
+
+            static void RunHelper(void* userdata) {
+                auto* context = static_cast<ParallelForContext*>(userdata);
+                context->ProcessBatches();
+
+                // The context lives on the stack of the calling thread, it must not be touched after this
+                context->pendingHelpers.fetch_sub(1, std::memory_order_release);
+            }
+        };
+    } // namespace Detail
+
+    template <typename F>
+    void ThreadPool::ParallelFor(const std::size_t count, const std::size_t batchSize, F&& func) {
+        FlAssertMsg(batchSize > 0, "[Core/ThreadPool] Batch size must be greater than zero.");
+
+        if (count == 0) {
+            return;
+        }
+
+        const std::size_t batchCount = (count + batchSize - 1) / batchSize;
+        if (batchCount == 1) {
+            func(std::size_t(0), count);
+            return;
+        }
+
+        using Context = Detail::ParallelForContext<std::remove_reference_t<F>>;
+
+        Context context{&func, count, batchSize, 0, 0};
+
+        const std::size_t helperCount = std::min(m_workers.size(), batchCount - 1);
+        context.pendingHelpers.store(helperCount, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < helperCount; ++i) {
+            Submit(Job{&Context::RunHelper, &context});
+        }
+
+        context.ProcessBatches();
+
+        // Helpers may still be queued behind other jobs, execute those while waiting
+        while (context.pendingHelpers.load(std::memory_order_acquire) > 0) {
+            if (!TryExecuteJob()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+} // namespace Fl
@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_IMAGE_BLOCKCOMPRESSOR_HPP
+#define FL_IMAGE_BLOCKCOMPRESSOR_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Image/Image.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    enum class BlockFormat {
+        BC1, //< RGB at 4 bits per pixel, with 1-bit alpha
+        BC3, //< BC1 color with BC4 alpha, 8 bits per pixel
+        BC4, //< Red channel at 4 bits per pixel
+        BC5, //< Red and green channels at 8 bits per pixel
+        BC7, //< RGBA at 8 bits per pixel, with eight block modes
+
+        Max = BC7
+    };
+
+    enum class CompressionQuality {
+        Fast, //< Endpoints fitted to the bounding box or principal axis, BC7 mode 6 only
+        Normal, //< Least squares refinement, BC7 modes chosen from the block content and best estimated partitions
+        Exhaustive, //< Every BC7 mode, partition, rotation and index selection, endpoints refined by local search
+
+        Max = Exhaustive
+    };
+
+    /**
+     * @brief Encoder of images into GPU block-compressed formats.
+     *
+     * Images are split in 4x4 blocks, partial blocks on the right and bottom edges repeating the last column and row.
+     * Every block is encoded independently: block rows are spread over the thread pool, and encoding the same image
+     * gives the same blocks whatever the thread count.
+     *
+     * Encoding fits two endpoints per subset of pixels then selects the palette index of every pixel. The index search
+     * evaluates SimdFloat4::Width pixels at once, and the fits are refined by least squares from the selected indices.
+     * Errors are the sum of squared differences over the encoded channels, in the color space of the image: sRGB
+     * images are compressed as is, for sRGB texture formats.
+     */
+    class FL_API BlockCompressor {
+    public:
+        static constexpr UInt32 BlockDimension = 4;
+
+        struct Settings {
+            BlockFormat format = BlockFormat::BC7;
+            CompressionQuality quality = CompressionQuality::Normal;
+        };
+
+        /**
+         * @brief Statistics of the last Compress().
+         */
+        struct Statistics {
+            std::size_t blockCount;
+            std::size_t pixelCount; //< Including the padding of partial blocks
+            Clock::duration compressionTime;
+
+            inline double GetMegapixelsPerSecond() const;
+        };
+
+        BlockCompressor();
+        explicit BlockCompressor(const Settings& settings);
+        BlockCompressor(const BlockCompressor&) = default;
+        BlockCompressor(BlockCompressor&&) noexcept = default;
+        ~BlockCompressor() = default;
+
+        /**
+         * @brief Compresses a level of an image.
+         * @param image Image to compress, converted to RGBA8 first if needed.
+         * @param level Mip level to compress.
+         * @param threadPool Thread pool encoding the block rows, or nullptr to encode them on the calling thread.
+         * @return Blocks row by row, as uploaded to GPUs.
+         */
+        std::vector<UInt8> Compress(const Image& image, UInt32 level = 0, ThreadPool* threadPool = nullptr);
+
+        inline const Settings& GetSettings() const;
+        inline const Statistics& GetStatistics() const;
+
+        BlockCompressor& operator=(const BlockCompressor&) = default;
+        BlockCompressor& operator=(BlockCompressor&&) noexcept = default;
+
+        /**
+         * @brief Decodes blocks into an RGBA8 image, missing channels being 0 for colors and 255 for alpha.
+         * @param blocks Blocks row by row, GetCompressedSize() bytes.
+         * @param colorSpace Color space given to the image, the pixels aren't converted.
+         */
+        static Image Decompress(std::span<const UInt8> blocks, UInt32 width, UInt32 height, BlockFormat format,
+                                ColorSpace colorSpace = ColorSpace::Linear);
+
+        /**
+         * @brief Decodes a block.
+         * @param block Block of GetBlockByteSize() bytes.
+         * @param pixels Receives the 16 RGBA8 pixels of the block, row by row.
+         */
+        static void DecodeBlock(const UInt8* block, BlockFormat format, UInt8* pixels);
+
+        /**
+         * @brief Encodes a block.
+         * @param pixels 16 RGBA8 pixels, row by row.
+         * @param block Receives GetBlockByteSize() bytes.
+         */
+        static void EncodeBlock(const UInt8* pixels, BlockFormat format, CompressionQuality quality, UInt8* block);
+
+        static std::size_t GetBlockByteSize(BlockFormat format);
+        static std::size_t GetCompressedSize(UInt32 width, UInt32 height, BlockFormat format);
+
+    private:
+        Statistics m_statistics;
+        Settings m_settings;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Image/BlockCompressor.inl>
+
+#endif // FL_IMAGE_BLOCKCOMPRESSOR_HPP
@@ -0,0 +1,24 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Image/BlockCompressor.hpp>
+
+#include <chrono>
+
+namespace Fl {
+    inline double BlockCompressor::Statistics::GetMegapixelsPerSecond() const {
+        const double seconds = std::chrono::duration<double>(compressionTime).count();
+        return (seconds > 0.0) ? static_cast<double>(pixelCount) / (seconds * 1e6) : 0.0;
+    }
+
+    inline auto BlockCompressor::GetSettings() const -> const Settings& {
+        return m_settings;
+    }
+
+    inline auto BlockCompressor::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+} // namespace Fl
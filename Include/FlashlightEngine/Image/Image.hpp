@@ -0,0 +1,174 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_IMAGE_IMAGE_HPP
+#define FL_IMAGE_IMAGE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Color.hpp>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    enum class ImageFormat {
+        RGBA8, //< 8 bits unsigned normalized per channel
+        RGBA16F, //< IEEE 754 half-precision floats
+        RGBA32F,
+
+        Max = RGBA32F
+    };
+
+    enum class ColorSpace {
+        Linear,
+        Srgb, //< Color channels encoded with the sRGB transfer function, alpha staying linear
+
+        Max = Srgb
+    };
+
+    enum class ImageFilter {
+        Box,
+        Triangle,
+        Kaiser, //< Kaiser-windowed sinc of radius 3, sharp with little ringing
+        Lanczos3,
+
+        Max = Lanczos3
+    };
+
+    /**
+     * @brief RGBA image with its mip levels, stored row by row.
+     *
+     * All the levels share a single allocation, every row starting on its own cache line so that rows written by
+     * different threads never share one.
+     *
+     * Processing decodes rows to linear floats (one SimdFloat4 per pixel), works in that space and encodes the result
+     * back, so that sRGB images are filtered and premultiplied in linear light. Images are processed in bands of
+     * BandHeight output rows spanning the whole width, the bands being spread over the thread pool. Resampling is
+     * separable: a band filters the source rows it needs horizontally, then combines them vertically, its working
+     * memory staying proportional to the band and not to the image.
+     */
+    class FL_API Image {
+    public:
+        static constexpr UInt32 BandHeight = 32;
+        static constexpr std::size_t RowAlignment = 64;
+
+        Image();
+        /**
+         * @brief Creates an image with all pixels set to zero.
+         * @param levelCount Number of mip levels, 0 for a full chain down to 1x1.
+         */
+        Image(UInt32 width, UInt32 height, ImageFormat format, ColorSpace colorSpace = ColorSpace::Linear,
+              UInt32 levelCount = 1);
+        Image(const Image&) = default;
+        Image(Image&&) noexcept = default;
+        ~Image() = default;
+
+        /**
+         * @brief Converts all the levels to another format or color space.
+         * @remark Values are clamped to [0, 1] when converted to RGBA8, and to the largest finite half when converted
+         * to RGBA16F.
+         */
+        Image Convert(ImageFormat format, ColorSpace colorSpace, ThreadPool* threadPool = nullptr) const;
+
+        /**
+         * @brief Computes the mip levels after the first, each level being downsampled from the previous one.
+         * @param filter Filter of the downsampling, Box averaging the pixels covered by each destination pixel.
+         * @param levelCount Number of levels including the first, 0 for a full chain down to 1x1. Changing the level
+         * count reallocates the image.
+         * @param threadPool Thread pool processing the bands of each level, or nullptr to process them on the calling
+         * thread.
+         */
+        void GenerateMipmaps(ImageFilter filter = ImageFilter::Box, UInt32 levelCount = 0,
+                             ThreadPool* threadPool = nullptr);
+
+        inline ColorSpace GetColorSpace() const;
+        inline ImageFormat GetFormat() const;
+        inline UInt32 GetHeight(UInt32 level = 0) const;
+        inline UInt32 GetLevelCount() const;
+        /**
+         * @brief Gets a pixel decoded to linear floats.
+         */
+        Color GetPixel(UInt32 x, UInt32 y, UInt32 level = 0) const;
+        inline UInt8* GetRow(UInt32 y, UInt32 level = 0);
+        inline const UInt8* GetRow(UInt32 y, UInt32 level = 0) const;
+        /**
+         * @brief Gets the distance between the start of two rows, a multiple of RowAlignment.
+         * @return Row pitch in bytes.
+         */
+        inline std::size_t GetRowPitch(UInt32 level = 0) const;
+        inline UInt32 GetWidth(UInt32 level = 0) const;
+
+        inline bool IsValid() const;
+
+        /**
+         * @brief Multiplies the color channels of all the levels by their alpha, in linear space.
+         */
+        void Premultiply(ThreadPool* threadPool = nullptr);
+
+        /**
+         * @brief Resamples the first level with a separable filter.
+         * @return Image with a single level, in the same format and color space.
+         * @remark Filters with negative lobes may overshoot, results being clamped like in Convert().
+         */
+        Image Resize(UInt32 width, UInt32 height, ImageFilter filter = ImageFilter::Kaiser,
+                     ThreadPool* threadPool = nullptr) const;
+
+        /**
+         * @brief Saves the first level as a binary PAM file (RGBA8, in the color space of the image).
+         * @param filePath UTF-8 path of the file.
+         * @param errorMessage Receives the reason of the failure, if not nullptr.
+         * @return Whether the file was written.
+         */
+        bool SaveToFile(std::string_view filePath, std::string* errorMessage = nullptr) const;
+
+        /**
+         * @brief Encodes a linear color into a pixel.
+         */
+        void SetPixel(UInt32 x, UInt32 y, const Color& color, UInt32 level = 0);
+
+        Image& operator=(const Image&) = default;
+        Image& operator=(Image&&) noexcept = default;
+
+        static std::size_t GetBytesPerPixel(ImageFormat format);
+        /**
+         * @brief Gets the number of levels of a full mip chain, down to 1x1.
+         */
+        static UInt32 GetFullLevelCount(UInt32 width, UInt32 height);
+
+        /**
+         * @brief Loads a binary PPM (P6) or PAM (P7) file with 8 bits per channel, as RGBA8 in the sRGB color space.
+         * @param filePath UTF-8 path of the file.
+         * @param errorMessage Receives the reason of the failure, if not nullptr.
+         * @return Loaded image, or std::nullopt on failure.
+         */
+        static std::optional<Image> LoadFromFile(std::string_view filePath, std::string* errorMessage = nullptr);
+
+    private:
+        struct alignas(RowAlignment) CacheLine {
+            UInt8 bytes[RowAlignment];
+        };
+
+        struct Level {
+            std::size_t offset; //< In bytes from the start of the image
+            std::size_t rowPitch;
+            UInt32 width;
+            UInt32 height;
+        };
+
+        std::vector<CacheLine> m_data;
+        std::vector<Level> m_levels;
+        ColorSpace m_colorSpace;
+        ImageFormat m_format;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Image/Image.inl>
+
+#endif // FL_IMAGE_IMAGE_HPP
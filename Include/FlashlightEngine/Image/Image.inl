@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Image/Image.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    inline ColorSpace Image::GetColorSpace() const {
+        return m_colorSpace;
+    }
+
+    inline ImageFormat Image::GetFormat() const {
+        return m_format;
+    }
+
+    inline UInt32 Image::GetHeight(const UInt32 level) const {
+        FlAssertMsg(level < m_levels.size(), "[Image/Image] Level out of range.");
+
+        return m_levels[level].height;
+    }
+
+    inline UInt32 Image::GetLevelCount() const {
+        return static_cast<UInt32>(m_levels.size());
+    }
+
+    inline UInt8* Image::GetRow(const UInt32 y, const UInt32 level) {
+        FlAssertMsg(level < m_levels.size() && y < m_levels[level].height, "[Image/Image] Row out of range.");
+
+        const Level& levelInfo = m_levels[level];
+        return m_data.front().bytes + levelInfo.offset + y * levelInfo.rowPitch;
+    }
+
+    inline const UInt8* Image::GetRow(const UInt32 y, const UInt32 level) const {
+        FlAssertMsg(level < m_levels.size() && y < m_levels[level].height, "[Image/Image] Row out of range.");
+
+        const Level& levelInfo = m_levels[level];
+        return m_data.front().bytes + levelInfo.offset + y * levelInfo.rowPitch;
+    }
+
+    inline std::size_t Image::GetRowPitch(const UInt32 level) const {
+        FlAssertMsg(level < m_levels.size(), "[Image/Image] Level out of range.");
+
+        return m_levels[level].rowPitch;
+    }
+
+    inline UInt32 Image::GetWidth(const UInt32 level) const {
+        FlAssertMsg(level < m_levels.size(), "[Image/Image] Level out of range.");
+
+        return m_levels[level].width;
+    }
+
+    inline bool Image::IsValid() const {
+        return !m_levels.empty();
+    }
+} // namespace Fl
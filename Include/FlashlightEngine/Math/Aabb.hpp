@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_AABB_HPP
+#define FL_MATH_AABB_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Ray.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+namespace Fl {
+    /**
+     * @brief Axis-aligned bounding box, defined by its minimum and maximum corners.
+     */
+    struct Aabb {
+        Vector3 min;
+        Vector3 max;
+
+        constexpr bool Contains(const Vector3& point) const;
+        constexpr bool Contains(const Aabb& box) const;
+
+        constexpr Vector3 GetCenter() const;
+        constexpr Vector3 GetExtents() const;
+        /**
+         * @brief Computes the surface area of the box, used by surface area heuristics.
+         * @return Surface area, zero for empty boxes.
+         */
+        constexpr float GetSurfaceArea() const;
+
+        /**
+         * @brief Intersects a ray with the box using the slab method.
+         * @param ray Ray, its direction doesn't have to be normalized.
+         * @param maxDistance Maximum distance along the ray, in multiples of its direction.
+         * @param hitDistance Receives the distance to the entry point (zero if the origin is inside the box).
+         * @return True if the ray hits the box before maxDistance.
+         */
+        inline bool Intersect(const Ray& ray, float maxDistance, float& hitDistance) const;
+
+        constexpr bool IsValid() const;
+
+        /**
+         * @brief Grows the box to contain another one.
+         */
+        constexpr Aabb& Merge(const Aabb& box);
+        constexpr Aabb& Merge(const Vector3& point);
+
+        constexpr bool Overlaps(const Aabb& box) const;
+
+        constexpr bool operator==(const Aabb& box) const = default;
+
+        /**
+         * @brief Returns an inverted box (min = +inf, max = -inf) which any merge replaces.
+         */
+        static constexpr Aabb Empty();
+        static constexpr Aabb FromCenterExtents(const Vector3& center, const Vector3& extents);
+        static constexpr Aabb Merge(const Aabb& lhs, const Aabb& rhs);
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Math/Aabb.inl>
+
+#endif // FL_MATH_AABB_HPP
@@ -0,0 +1,110 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Math/Aabb.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace Fl {
+    constexpr bool Aabb::Contains(const Vector3& point) const {
+        return point.x >= min.x && point.y >= min.y && point.z >= min.z &&
+               point.x <= max.x && point.y <= max.y && point.z <= max.z;
+    }
+
+    constexpr bool Aabb::Contains(const Aabb& box) const {
+        return Contains(box.min) && Contains(box.max);
+    }
+
+    constexpr Vector3 Aabb::GetCenter() const {
+        return (min + max) * 0.5f;
+    }
+
+    constexpr Vector3 Aabb::GetExtents() const {
+        return (max - min) * 0.5f;
+    }
+
+    constexpr float Aabb::GetSurfaceArea() const {
+        if (!IsValid()) {
+            return 0.f;
+        }
+
+        const Vector3 size = max - min;
+        return 2.f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    inline bool Aabb::Intersect(const Ray& ray, const float maxDistance, float& hitDistance) const {
+        float near = 0.f;
+        float far = maxDistance;
+
+        const float origins[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+        const float directions[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+        const float mins[3] = {min.x, min.y, min.z};
+        const float maxs[3] = {max.x, max.y, max.z};
+
+        for (int axis = 0; axis < 3; ++axis) {
+            if (directions[axis] == 0.f) {
+                if (origins[axis] < mins[axis] || origins[axis] > maxs[axis]) {
+                    return false;
+                }
+
+                continue;
+            }
+
+            const float invDirection = 1.f / directions[axis];
+            float t1 = (mins[axis] - origins[axis]) * invDirection;
+            float t2 = (maxs[axis] - origins[axis]) * invDirection;
+            if (t1 > t2) {
+                std::swap(t1, t2);
+            }
+
+            near = std::max(near, t1);
+            far = std::min(far, t2);
+            if (near > far) {
+                return false;
+            }
+        }
+
+        hitDistance = near;
+        return true;
+    }
+
+    constexpr bool Aabb::IsValid() const {
+        return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+    }
+
+    constexpr Aabb& Aabb::Merge(const Aabb& box) {
+        min = Vector3::Min(min, box.min);
+        max = Vector3::Max(max, box.max);
+
+        return *this;
+    }
+
+    constexpr Aabb& Aabb::Merge(const Vector3& point) {
+        min = Vector3::Min(min, point);
+        max = Vector3::Max(max, point);
+
+        return *this;
+    }
+
+    constexpr bool Aabb::Overlaps(const Aabb& box) const {
+        return min.x <= box.max.x && min.y <= box.max.y && min.z <= box.max.z &&
+               max.x >= box.min.x && max.y >= box.min.y && max.z >= box.min.z;
+    }
+
+    constexpr Aabb Aabb::Empty() {
+        constexpr float Infinity = std::numeric_limits<float>::infinity();
+        return {Vector3(Infinity), Vector3(-Infinity)};
+    }
+
+    constexpr Aabb Aabb::FromCenterExtents(const Vector3& center, const Vector3& extents) {
+        return {center - extents, center + extents};
+    }
+
+    constexpr Aabb Aabb::Merge(const Aabb& lhs, const Aabb& rhs) {
+        return {Vector3::Min(lhs.min, rhs.min), Vector3::Max(lhs.max, rhs.max)};
+    }
+} // namespace Fl
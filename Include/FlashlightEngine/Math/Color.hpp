@@ -0,0 +1,44 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_COLOR_HPP
+#define FL_MATH_COLOR_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+namespace Fl {
+    /**
+     * @brief Linear RGBA color, components being usually in [0, 1].
+     */
+    struct Color {
+        float r;
+        float g;
+        float b;
+        float a;
+
+        constexpr Color() = default;
+        constexpr Color(float r, float g, float b, float a = 1.f);
+
+        constexpr bool operator==(const Color& color) const = default;
+
+        static constexpr Color Black();
+        static constexpr Color White();
+    };
+
+    constexpr Color::Color(const float r, const float g, const float b, const float a) :
+        r(r), g(g), b(b), a(a) {
+    }
+
+    constexpr Color Color::Black() {
+        return {0.f, 0.f, 0.f, 1.f};
+    }
+
+    constexpr Color Color::White() {
+        return {1.f, 1.f, 1.f, 1.f};
+    }
+} // namespace Fl
+
+#endif // FL_MATH_COLOR_HPP
@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_FRUSTUM_HPP
+#define FL_MATH_FRUSTUM_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Aabb.hpp>
+#include <FlashlightEngine/Math/Matrix4.hpp>
+#include <FlashlightEngine/Math/Plane.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <array>
+
+namespace Fl {
+    enum class FrustumPlane {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+
+        Max = Far
+    };
+
+    enum class IntersectionType {
+        Outside,
+        Intersecting,
+        Inside
+    };
+
+    /**
+     * @brief Convex volume bounded by six planes whose normals point inwards.
+     */
+    struct Frustum {
+        std::array<Plane, EnumValueCount_v<FrustumPlane>> planes;
+
+        inline const Plane& GetPlane(FrustumPlane plane) const;
+
+        /**
+         * @brief Classifies a box against the frustum.
+         * @remark Conservative: boxes outside the frustum but crossing several planes near a corner are reported as
+         * intersecting.
+         */
+        inline IntersectionType Intersect(const Aabb& box) const;
+        inline IntersectionType Intersect(const Vector3& center, float radius) const;
+
+        /**
+         * @brief Extracts the planes of a view-projection matrix.
+         * @param viewProjection Matrix mapping world space to a clip space with a [0, 1] depth range.
+         * @return Frustum with normalized planes.
+         */
+        static inline Frustum FromMatrix(const Matrix4& viewProjection);
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Math/Frustum.inl>
+
+#endif // FL_MATH_FRUSTUM_HPP
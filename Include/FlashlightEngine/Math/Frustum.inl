@@ -0,0 +1,86 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Math/Frustum.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    inline const Plane& Frustum::GetPlane(const FrustumPlane plane) const {
+        return planes[static_cast<std::size_t>(plane)];
+    }
+
+    inline IntersectionType Frustum::Intersect(const Aabb& box) const {
+        const Vector3 center = box.GetCenter();
+        const Vector3 extents = box.GetExtents();
+
+        IntersectionType result = IntersectionType::Inside;
+        for (const Plane& plane : planes) {
+            // Projection of the extents on the plane normal
+            const float radius = std::abs(plane.normal.x) * extents.x + std::abs(plane.normal.y) * extents.y +
+                                 std::abs(plane.normal.z) * extents.z;
+
+            const float distance = plane.GetSignedDistance(center);
+            if (distance < -radius) {
+                return IntersectionType::Outside;
+            }
+
+            if (distance < radius) {
+                result = IntersectionType::Intersecting;
+            }
+        }
+
+        return result;
+    }
+
+    inline IntersectionType Frustum::Intersect(const Vector3& center, const float radius) const {
+        IntersectionType result = IntersectionType::Inside;
+        for (const Plane& plane : planes) {
+            const float distance = plane.GetSignedDistance(center);
+            if (distance < -radius) {
+                return IntersectionType::Outside;
+            }
+
+            if (distance < radius) {
+                result = IntersectionType::Intersecting;
+            }
+        }
+
+        return result;
+    }
+
+    inline Frustum Frustum::FromMatrix(const Matrix4& viewProjection) {
+        const auto getRow = [&](const std::size_t row) {
+            return Plane{{viewProjection.GetElement(row, 0), viewProjection.GetElement(row, 1),
+                          viewProjection.GetElement(row, 2)},
+                         viewProjection.GetElement(row, 3)};
+        };
+
+        const auto add = [](const Plane& lhs, const Plane& rhs) {
+            return Plane{lhs.normal + rhs.normal, lhs.distance + rhs.distance};
+        };
+
+        const auto subtract = [](const Plane& lhs, const Plane& rhs) {
+            return Plane{lhs.normal - rhs.normal, lhs.distance - rhs.distance};
+        };
+
+        // A clip space point is inside when -w <= x <= w, -w <= y <= w and 0 <= z <= w
+        const Plane x = getRow(0);
+        const Plane y = getRow(1);
+        const Plane z = getRow(2);
+        const Plane w = getRow(3);
+
+        Frustum frustum;
+        frustum.planes[static_cast<std::size_t>(FrustumPlane::Left)] = add(w, x).GetNormalized();
+        frustum.planes[static_cast<std::size_t>(FrustumPlane::Right)] = subtract(w, x).GetNormalized();
+        frustum.planes[static_cast<std::size_t>(FrustumPlane::Bottom)] = add(w, y).GetNormalized();
+        frustum.planes[static_cast<std::size_t>(FrustumPlane::Top)] = subtract(w, y).GetNormalized();
+        frustum.planes[static_cast<std::size_t>(FrustumPlane::Near)] = z.GetNormalized();
+        frustum.planes[static_cast<std::size_t>(FrustumPlane::Far)] = subtract(w, z).GetNormalized();
+
+        return frustum;
+    }
+} // namespace Fl
@@ -0,0 +1,58 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_MATRIX4_HPP
+#define FL_MATH_MATRIX4_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Quaternion.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+namespace Fl {
+    /**
+     * @brief 4x4 float matrix stored column-major, each column being loaded as a SimdFloat4 for products.
+     * Vectors are column vectors: a point is transformed by M * p.
+     */
+    struct alignas(16) Matrix4 {
+        float data[16]; //< data[column * 4 + row]
+
+        constexpr bool ApproxEqual(const Matrix4& matrix, float epsilon = 1e-5f) const;
+
+        inline SimdFloat4 GetColumn(std::size_t column) const;
+        constexpr float GetElement(std::size_t row, std::size_t column) const;
+        constexpr Vector3 GetTranslation() const;
+
+        inline void SetColumn(std::size_t column, const SimdFloat4& value);
+
+        /**
+         * @brief Transforms a point, using 1 as its w component.
+         */
+        inline Vector3 TransformPoint(const Vector3& point) const;
+
+        inline Matrix4 operator*(const Matrix4& matrix) const;
+
+        /**
+         * @brief Builds the matrix applying a scale, a rotation and a translation, in that order.
+         */
+        static inline Matrix4 FromTransform(const Vector3& translation, const Quaternion& rotation,
+                                            const Vector3& scale);
+        static constexpr Matrix4 Identity();
+        /**
+         * @brief Builds a right-handed perspective projection looking down -Z, mapping depth to [0, 1].
+         * @param fovY Vertical field of view, in radians.
+         * @param aspectRatio Width divided by height.
+         * @param zNear Distance to the near plane.
+         * @param zFar Distance to the far plane.
+         */
+        static inline Matrix4 Perspective(float fovY, float aspectRatio, float zNear, float zFar);
+        static constexpr Matrix4 Translate(const Vector3& translation);
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Math/Matrix4.inl>
+
+#endif // FL_MATH_MATRIX4_HPP
@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Math/Matrix4.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    constexpr bool Matrix4::ApproxEqual(const Matrix4& matrix, const float epsilon) const {
+        for (std::size_t i = 0; i < 16; ++i) {
+            const float difference = data[i] - matrix.data[i];
+            if (difference > epsilon || difference < -epsilon) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    inline SimdFloat4 Matrix4::GetColumn(const std::size_t column) const {
+        FlAssert(column < 4);
+        return SimdFloat4::LoadAligned(&data[column * 4]);
+    }
+
+    constexpr float Matrix4::GetElement(const std::size_t row, const std::size_t column) const {
+        return data[column * 4 + row];
+    }
+
+    constexpr Vector3 Matrix4::GetTranslation() const {
+        return {data[12], data[13], data[14]};
+    }
+
+    inline void Matrix4::SetColumn(const std::size_t column, const SimdFloat4& value) {
+        FlAssert(column < 4);
+        value.StoreAligned(&data[column * 4]);
+    }
+
+    inline Vector3 Matrix4::TransformPoint(const Vector3& point) const {
+        SimdFloat4 result = GetColumn(3);
+        result = SimdFloat4::MultiplyAdd(GetColumn(0), SimdFloat4::Splat(point.x), result);
+        result = SimdFloat4::MultiplyAdd(GetColumn(1), SimdFloat4::Splat(point.y), result);
+        result = SimdFloat4::MultiplyAdd(GetColumn(2), SimdFloat4::Splat(point.z), result);
+
+        alignas(16) float values[4];
+        result.StoreAligned(values);
+
+        return {values[0], values[1], values[2]};
+    }
+
+    inline Matrix4 Matrix4::operator*(const Matrix4& matrix) const {
+        const SimdFloat4 column0 = GetColumn(0);
+        const SimdFloat4 column1 = GetColumn(1);
+        const SimdFloat4 column2 = GetColumn(2);
+        const SimdFloat4 column3 = GetColumn(3);
+
+        // Each result column is a linear combination of our columns, weighted by the other matrix's column
+        Matrix4 result;
+        for (std::size_t i = 0; i < 4; ++i) {
+            const SimdFloat4 weights = matrix.GetColumn(i);
+
+            SimdFloat4 resultColumn = column0 * weights.Broadcast<0>();
+            resultColumn = SimdFloat4::MultiplyAdd(column1, weights.Broadcast<1>(), resultColumn);
+            resultColumn = SimdFloat4::MultiplyAdd(column2, weights.Broadcast<2>(), resultColumn);
+            resultColumn = SimdFloat4::MultiplyAdd(column3, weights.Broadcast<3>(), resultColumn);
+
+            result.SetColumn(i, resultColumn);
+        }
+
+        return result;
+    }
+
+    inline Matrix4 Matrix4::FromTransform(const Vector3& translation, const Quaternion& rotation,
+                                          const Vector3& scale) {
+        const float xx = rotation.x * rotation.x;
+        const float yy = rotation.y * rotation.y;
+        const float zz = rotation.z * rotation.z;
+        const float xy = rotation.x * rotation.y;
+        const float xz = rotation.x * rotation.z;
+        const float yz = rotation.y * rotation.z;
+        const float wx = rotation.w * rotation.x;
+        const float wy = rotation.w * rotation.y;
+        const float wz = rotation.w * rotation.z;
+
+        Matrix4 result;
+        result.SetColumn(0, SimdFloat4(1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy), 0.f) *
+                                SimdFloat4::Splat(scale.x));
+        result.SetColumn(1, SimdFloat4(2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx), 0.f) *
+                                SimdFloat4::Splat(scale.y));
+        result.SetColumn(2, SimdFloat4(2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy), 0.f) *
+                                SimdFloat4::Splat(scale.z));
+        result.SetColumn(3, SimdFloat4(translation.x, translation.y, translation.z, 1.f));
+
+        return result;
+    }
+
+    constexpr Matrix4 Matrix4::Identity() {
+        return Matrix4{{1.f, 0.f, 0.f, 0.f,
+                        0.f, 1.f, 0.f, 0.f,
+                        0.f, 0.f, 1.f, 0.f,
+                        0.f, 0.f, 0.f, 1.f}};
+    }
+
+    inline Matrix4 Matrix4::Perspective(const float fovY, const float aspectRatio, const float zNear,
+                                        const float zFar) {
+        const float focalLength = 1.f / std::tan(fovY * 0.5f);
+
+        return Matrix4{{focalLength / aspectRatio, 0.f, 0.f, 0.f,
+                        0.f, focalLength, 0.f, 0.f,
+                        0.f, 0.f, zFar / (zNear - zFar), -1.f,
+                        0.f, 0.f, zNear * zFar / (zNear - zFar), 0.f}};
+    }
+
+    constexpr Matrix4 Matrix4::Translate(const Vector3& translation) {
+        return Matrix4{{1.f, 0.f, 0.f, 0.f,
+                        0.f, 1.f, 0.f, 0.f,
+                        0.f, 0.f, 1.f, 0.f,
+                        translation.x, translation.y, translation.z, 1.f}};
+    }
+} // namespace Fl
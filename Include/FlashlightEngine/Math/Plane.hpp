@@ -0,0 +1,35 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_PLANE_HPP
+#define FL_MATH_PLANE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+namespace Fl {
+    /**
+     * @brief Plane of equation dot(normal, p) + distance = 0, points on the normal side having a positive distance.
+     */
+    struct Plane {
+        Vector3 normal;
+        float distance;
+
+        inline Plane GetNormalized() const;
+        constexpr float GetSignedDistance(const Vector3& point) const;
+    };
+
+    inline Plane Plane::GetNormalized() const {
+        const float invLength = 1.f / normal.GetLength();
+        return {normal * invLength, distance * invLength};
+    }
+
+    constexpr float Plane::GetSignedDistance(const Vector3& point) const {
+        return normal.Dot(point) + distance;
+    }
+} // namespace Fl
+
+#endif // FL_MATH_PLANE_HPP
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_QUATERNION_HPP
+#define FL_MATH_QUATERNION_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+namespace Fl {
+    /**
+     * @brief Rotation quaternion, w being the real part.
+     */
+    struct Quaternion {
+        float x;
+        float y;
+        float z;
+        float w;
+
+        constexpr Quaternion() = default;
+        constexpr Quaternion(float x, float y, float z, float w);
+
+        constexpr bool ApproxEqual(const Quaternion& quat, float epsilon = 1e-5f) const;
+
+        constexpr Quaternion GetConjugate() const;
+        inline Quaternion GetNormal() const;
+
+        /**
+         * @brief Combines two rotations, the right one being applied first.
+         */
+        constexpr Quaternion operator*(const Quaternion& quat) const;
+        /**
+         * @brief Rotates a vector.
+         */
+        constexpr Vector3 operator*(const Vector3& vec) const;
+
+        constexpr bool operator==(const Quaternion& quat) const = default;
+
+        /**
+         * @brief Builds a rotation around an axis.
+         * @param axis Normalized rotation axis.
+         * @param angle Angle, in radians.
+         */
+        static inline Quaternion FromAxisAngle(const Vector3& axis, float angle);
+        static constexpr Quaternion Identity();
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Math/Quaternion.inl>
+
+#endif // FL_MATH_QUATERNION_HPP
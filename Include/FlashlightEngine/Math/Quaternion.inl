@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Math/Quaternion.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    constexpr Quaternion::Quaternion(const float x, const float y, const float z, const float w) :
+        x(x), y(y), z(z), w(w) {
+    }
+
+    constexpr bool Quaternion::ApproxEqual(const Quaternion& quat, const float epsilon) const {
+        const auto near = [epsilon](const float a, const float b) { return a - b <= epsilon && b - a <= epsilon; };
+        return near(x, quat.x) && near(y, quat.y) && near(z, quat.z) && near(w, quat.w);
+    }
+
+    constexpr Quaternion Quaternion::GetConjugate() const {
+        return {-x, -y, -z, w};
+    }
+
+    inline Quaternion Quaternion::GetNormal() const {
+        const float length = std::sqrt(x * x + y * y + z * z + w * w);
+        if (length <= 0.f) {
+            return Identity();
+        }
+
+        const float invLength = 1.f / length;
+        return {x * invLength, y * invLength, z * invLength, w * invLength};
+    }
+
+    constexpr Quaternion Quaternion::operator*(const Quaternion& quat) const {
+        return {w * quat.x + x * quat.w + y * quat.z - z * quat.y,
+                w * quat.y + y * quat.w + z * quat.x - x * quat.z,
+                w * quat.z + z * quat.w + x * quat.y - y * quat.x,
+                w * quat.w - x * quat.x - y * quat.y - z * quat.z};
+    }
+
+    constexpr Vector3 Quaternion::operator*(const Vector3& vec) const {
+        // v' = v + 2w(q x v) + 2(q x (q x v))
+        const Vector3 axis(x, y, z);
+        const Vector3 t = axis.Cross(vec) * 2.f;
+        return vec + t * w + axis.Cross(t);
+    }
+
+    inline Quaternion Quaternion::FromAxisAngle(const Vector3& axis, const float angle) {
+        const float halfAngle = angle * 0.5f;
+        const float sine = std::sin(halfAngle);
+
+        return {axis.x * sine, axis.y * sine, axis.z * sine, std::cos(halfAngle)};
+    }
+
+    constexpr Quaternion Quaternion::Identity() {
+        return {0.f, 0.f, 0.f, 1.f};
+    }
+} // namespace Fl
@@ -0,0 +1,29 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_RAY_HPP
+#define FL_MATH_RAY_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+namespace Fl {
+    /**
+     * @brief Half-line starting at origin, distances along it are expressed in multiples of direction.
+     */
+    struct Ray {
+        Vector3 origin;
+        Vector3 direction;
+
+        constexpr Vector3 GetPoint(float distance) const;
+    };
+
+    constexpr Vector3 Ray::GetPoint(const float distance) const {
+        return origin + direction * distance;
+    }
+} // namespace Fl
+
+#endif // FL_MATH_RAY_HPP
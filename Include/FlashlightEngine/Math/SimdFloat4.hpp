@@ -0,0 +1,135 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_SIMDFLOAT4_HPP
+#define FL_MATH_SIMDFLOAT4_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+// SIMD backend selection, SSE2 is part of the x86_64 baseline and NEON of the aarch64 one
+// FL_SIMD_FORCE_SCALAR selects the portable implementation, it must be defined the same way for the whole program
+#if defined(FL_SIMD_FORCE_SCALAR)
+#   define FL_SIMD_SCALAR
+#elif defined(FL_ARCH_x86_64) || \
+      (defined(FL_ARCH_x86) && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#   define FL_SIMD_SSE2
+#   include <emmintrin.h>
+#elif defined(FL_ARCH_aarch64)
+#   define FL_SIMD_NEON
+#   include <arm_neon.h>
+#else
+#   define FL_SIMD_SCALAR
+#endif
+
+namespace Fl {
+    /**
+     * @brief Four packed floats, mapped to an SSE or NEON register when the architecture supports it.
+     *
+     * Comparisons return masks (all bits of a lane set when true) to be used with Select(), bitwise operators and
+     * GetMoveMask().
+     */
+    class SimdFloat4 {
+    public:
+#if defined(FL_SIMD_SSE2)
+        using NativeType = __m128;
+#elif defined(FL_SIMD_NEON)
+        using NativeType = float32x4_t;
+#else
+        struct alignas(16) NativeType {
+            float lanes[4];
+        };
+#endif
+
+        static constexpr std::size_t Width = 4;
+
+        SimdFloat4() = default;
+        inline explicit SimdFloat4(NativeType value);
+        inline SimdFloat4(float x, float y, float z, float w);
+
+        /**
+         * @brief Broadcasts one of the lanes to all lanes.
+         * @tparam Lane Index of the lane to broadcast.
+         * @return Vector with all lanes equal to the given one.
+         */
+        template <int Lane>
+        SimdFloat4 Broadcast() const;
+
+        inline float GetLane(std::size_t index) const;
+        /**
+         * @brief Gets a bit mask made of the sign bit of each lane, lane 0 being the least significant bit.
+         * @return Bit mask in [0, 15].
+         */
+        inline int GetMoveMask() const;
+        inline NativeType GetNative() const;
+        inline float GetX() const;
+
+        /**
+         * @brief Computes the sum of the four lanes.
+         * @return Horizontal sum.
+         */
+        inline float HorizontalSum() const;
+
+        /**
+         * @brief Moves the lanes toward the higher indices, lane i receiving lane i - Count and the first lanes zero.
+         * @tparam Count Number of lanes to shift by.
+         * @return Shifted vector.
+         */
+        template <int Count>
+        SimdFloat4 ShiftLanesUp() const;
+
+        inline void Store(float* ptr) const;
+        inline void StoreAligned(float* ptr) const;
+
+        inline SimdFloat4 operator-() const;
+
+        inline SimdFloat4& operator+=(const SimdFloat4& vec);
+        inline SimdFloat4& operator-=(const SimdFloat4& vec);
+        inline SimdFloat4& operator*=(const SimdFloat4& vec);
+        inline SimdFloat4& operator/=(const SimdFloat4& vec);
+
+        inline friend SimdFloat4 operator+(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        inline friend SimdFloat4 operator-(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        inline friend SimdFloat4 operator*(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        inline friend SimdFloat4 operator/(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        inline friend SimdFloat4 operator&(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        inline friend SimdFloat4 operator|(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        inline friend SimdFloat4 operator^(const SimdFloat4& lhs, const SimdFloat4& rhs);
+
+        static inline SimdFloat4 Abs(const SimdFloat4& vec);
+        /**
+         * @brief Computes ~lhs & rhs.
+         */
+        static inline SimdFloat4 AndNot(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        static inline SimdFloat4 Equal(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        static inline SimdFloat4 Greater(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        static inline SimdFloat4 GreaterEqual(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        static inline SimdFloat4 Less(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        static inline SimdFloat4 LessEqual(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        static inline SimdFloat4 Load(const float* ptr);
+        static inline SimdFloat4 LoadAligned(const float* ptr);
+        static inline SimdFloat4 Max(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        static inline SimdFloat4 Min(const SimdFloat4& lhs, const SimdFloat4& rhs);
+        /**
+         * @brief Computes a * b + c, fused when the target supports it.
+         */
+        static inline SimdFloat4 MultiplyAdd(const SimdFloat4& a, const SimdFloat4& b, const SimdFloat4& c);
+        /**
+         * @brief Picks lanes from ifTrue where mask is set, from ifFalse elsewhere.
+         * @param mask Comparison result.
+         */
+        static inline SimdFloat4 Select(const SimdFloat4& mask, const SimdFloat4& ifTrue, const SimdFloat4& ifFalse);
+        static inline SimdFloat4 Splat(float value);
+        static inline SimdFloat4 Sqrt(const SimdFloat4& vec);
+        static inline SimdFloat4 Zero();
+
+    private:
+        NativeType m_value;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Math/SimdFloat4.inl>
+
+#endif // FL_MATH_SIMDFLOAT4_HPP
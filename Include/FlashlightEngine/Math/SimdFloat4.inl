@@ -0,0 +1,412 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+
+#include <cmath>
+
+namespace Fl {
+#if defined(FL_SIMD_SCALAR)
+    namespace Detail {
+        template <typename F>
+        SimdFloat4::NativeType SimdScalarApply(const SimdFloat4::NativeType& lhs, const SimdFloat4::NativeType& rhs,
+                                               F&& func) {
+            SimdFloat4::NativeType result;
+            for (int i = 0; i < 4; ++i) {
+                result.lanes[i] = func(lhs.lanes[i], rhs.lanes[i]);
+            }
+
+            return result;
+        }
+
+        template <typename F>
+        SimdFloat4::NativeType SimdScalarBitwise(const SimdFloat4::NativeType& lhs, const SimdFloat4::NativeType& rhs,
+                                                 F&& func) {
+            return SimdScalarApply(lhs, rhs, [&](const float a, const float b) {
+                return BitCast<float>(static_cast<UInt32>(func(BitCast<UInt32>(a), BitCast<UInt32>(b))));
+            });
+        }
+
+        inline float SimdScalarMask(const bool condition) {
+            return BitCast<float>(condition ? 0xFFFFFFFFu : 0u);
+        }
+    } // namespace Detail
+#endif
+
+    inline SimdFloat4::SimdFloat4(const NativeType value) :
+        m_value(value) {
+    }
+
+    inline SimdFloat4::SimdFloat4(const float x, const float y, const float z, const float w) {
+#if defined(FL_SIMD_SSE2)
+        m_value = _mm_setr_ps(x, y, z, w);
+#elif defined(FL_SIMD_NEON)
+        alignas(16) const float values[4] = {x, y, z, w};
+        m_value = vld1q_f32(values);
+#else
+        m_value = {{x, y, z, w}};
+#endif
+    }
+
+    template <int Lane>
+    SimdFloat4 SimdFloat4::Broadcast() const {
+        static_assert(Lane >= 0 && Lane < 4, "Lane index out of range.");
+
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_shuffle_ps(m_value, m_value, _MM_SHUFFLE(Lane, Lane, Lane, Lane)));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vdupq_laneq_f32(m_value, Lane));
+#else
+        return Splat(m_value.lanes[Lane]);
+#endif
+    }
+
+    inline float SimdFloat4::GetLane(const std::size_t index) const {
+        alignas(16) float values[4];
+        StoreAligned(values);
+
+        return values[index];
+    }
+
+    inline int SimdFloat4::GetMoveMask() const {
+#if defined(FL_SIMD_SSE2)
+        return _mm_movemask_ps(m_value);
+#elif defined(FL_SIMD_NEON)
+        static constexpr int32_t Shifts[4] = {0, 1, 2, 3};
+        const uint32x4_t signs = vshrq_n_u32(vreinterpretq_u32_f32(m_value), 31);
+        return static_cast<int>(vaddvq_u32(vshlq_u32(signs, vld1q_s32(Shifts))));
+#else
+        int mask = 0;
+        for (int i = 0; i < 4; ++i) {
+            mask |= static_cast<int>(BitCast<UInt32>(m_value.lanes[i]) >> 31) << i;
+        }
+
+        return mask;
+#endif
+    }
+
+    inline auto SimdFloat4::GetNative() const -> NativeType {
+        return m_value;
+    }
+
+    inline float SimdFloat4::GetX() const {
+#if defined(FL_SIMD_SSE2)
+        return _mm_cvtss_f32(m_value);
+#elif defined(FL_SIMD_NEON)
+        return vgetq_lane_f32(m_value, 0);
+#else
+        return m_value.lanes[0];
+#endif
+    }
+
+    inline float SimdFloat4::HorizontalSum() const {
+#if defined(FL_SIMD_SSE2)
+        const __m128 shuffled = _mm_shuffle_ps(m_value, m_value, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m128 sums = _mm_add_ps(m_value, shuffled);
+        return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(shuffled, sums)));
+#elif defined(FL_SIMD_NEON)
+        return vaddvq_f32(m_value);
+#else
+        return (m_value.lanes[0] + m_value.lanes[1]) + (m_value.lanes[2] + m_value.lanes[3]);
+#endif
+    }
+
+    template <int Count>
+    SimdFloat4 SimdFloat4::ShiftLanesUp() const {
+        static_assert(Count >= 0 && Count <= 4, "Shift count out of range.");
+
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(m_value), Count * 4)));
+#elif defined(FL_SIMD_NEON)
+        if constexpr (Count == 0) {
+            return *this;
+        } else {
+            return SimdFloat4(vextq_f32(vdupq_n_f32(0.f), m_value, 4 - Count));
+        }
+#else
+        NativeType result{};
+        for (int i = Count; i < 4; ++i) {
+            result.lanes[i] = m_value.lanes[i - Count];
+        }
+
+        return SimdFloat4(result);
+#endif
+    }
+
+    inline void SimdFloat4::Store(float* ptr) const {
+#if defined(FL_SIMD_SSE2)
+        _mm_storeu_ps(ptr, m_value);
+#elif defined(FL_SIMD_NEON)
+        vst1q_f32(ptr, m_value);
+#else
+        for (int i = 0; i < 4; ++i) {
+            ptr[i] = m_value.lanes[i];
+        }
+#endif
+    }
+
+    inline void SimdFloat4::StoreAligned(float* ptr) const {
+#if defined(FL_SIMD_SSE2)
+        _mm_store_ps(ptr, m_value);
+#else
+        Store(ptr);
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::operator-() const {
+        return Zero() - *this;
+    }
+
+    inline SimdFloat4& SimdFloat4::operator+=(const SimdFloat4& vec) {
+        *this = *this + vec;
+        return *this;
+    }
+
+    inline SimdFloat4& SimdFloat4::operator-=(const SimdFloat4& vec) {
+        *this = *this - vec;
+        return *this;
+    }
+
+    inline SimdFloat4& SimdFloat4::operator*=(const SimdFloat4& vec) {
+        *this = *this * vec;
+        return *this;
+    }
+
+    inline SimdFloat4& SimdFloat4::operator/=(const SimdFloat4& vec) {
+        *this = *this / vec;
+        return *this;
+    }
+
+    inline SimdFloat4 operator+(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_add_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vaddq_f32(lhs.m_value, rhs.m_value));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value, [](float a, float b) { return a + b; }));
+#endif
+    }
+
+    inline SimdFloat4 operator-(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_sub_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vsubq_f32(lhs.m_value, rhs.m_value));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value, [](float a, float b) { return a - b; }));
+#endif
+    }
+
+    inline SimdFloat4 operator*(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_mul_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vmulq_f32(lhs.m_value, rhs.m_value));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value, [](float a, float b) { return a * b; }));
+#endif
+    }
+
+    inline SimdFloat4 operator/(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_div_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vdivq_f32(lhs.m_value, rhs.m_value));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value, [](float a, float b) { return a / b; }));
+#endif
+    }
+
+    inline SimdFloat4 operator&(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_and_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vreinterpretq_f32_u32(
+            vandq_u32(vreinterpretq_u32_f32(lhs.m_value), vreinterpretq_u32_f32(rhs.m_value))));
+#else
+        return SimdFloat4(
+            Detail::SimdScalarBitwise(lhs.m_value, rhs.m_value, [](UInt32 a, UInt32 b) { return a & b; }));
+#endif
+    }
+
+    inline SimdFloat4 operator|(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_or_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vreinterpretq_f32_u32(
+            vorrq_u32(vreinterpretq_u32_f32(lhs.m_value), vreinterpretq_u32_f32(rhs.m_value))));
+#else
+        return SimdFloat4(
+            Detail::SimdScalarBitwise(lhs.m_value, rhs.m_value, [](UInt32 a, UInt32 b) { return a | b; }));
+#endif
+    }
+
+    inline SimdFloat4 operator^(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_xor_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vreinterpretq_f32_u32(
+            veorq_u32(vreinterpretq_u32_f32(lhs.m_value), vreinterpretq_u32_f32(rhs.m_value))));
+#else
+        return SimdFloat4(
+            Detail::SimdScalarBitwise(lhs.m_value, rhs.m_value, [](UInt32 a, UInt32 b) { return a ^ b; }));
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Abs(const SimdFloat4& vec) {
+#if defined(FL_SIMD_NEON)
+        return SimdFloat4(vabsq_f32(vec.m_value));
+#else
+        return AndNot(Splat(-0.f), vec);
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::AndNot(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_andnot_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vreinterpretq_f32_u32(
+            vbicq_u32(vreinterpretq_u32_f32(rhs.m_value), vreinterpretq_u32_f32(lhs.m_value))));
+#else
+        return SimdFloat4(
+            Detail::SimdScalarBitwise(lhs.m_value, rhs.m_value, [](UInt32 a, UInt32 b) { return ~a & b; }));
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Equal(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_cmpeq_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vreinterpretq_f32_u32(vceqq_f32(lhs.m_value, rhs.m_value)));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value,
+                                                  [](float a, float b) { return Detail::SimdScalarMask(a == b); }));
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Greater(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+        return Less(rhs, lhs);
+    }
+
+    inline SimdFloat4 SimdFloat4::GreaterEqual(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+        return LessEqual(rhs, lhs);
+    }
+
+    inline SimdFloat4 SimdFloat4::Less(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_cmplt_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vreinterpretq_f32_u32(vcltq_f32(lhs.m_value, rhs.m_value)));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value,
+                                                  [](float a, float b) { return Detail::SimdScalarMask(a < b); }));
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::LessEqual(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_cmple_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vreinterpretq_f32_u32(vcleq_f32(lhs.m_value, rhs.m_value)));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value,
+                                                  [](float a, float b) { return Detail::SimdScalarMask(a <= b); }));
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Load(const float* ptr) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_loadu_ps(ptr));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vld1q_f32(ptr));
+#else
+        return SimdFloat4(ptr[0], ptr[1], ptr[2], ptr[3]);
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::LoadAligned(const float* ptr) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_load_ps(ptr));
+#else
+        return Load(ptr);
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Max(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_max_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vmaxq_f32(lhs.m_value, rhs.m_value));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value,
+                                                  [](float a, float b) { return (a > b) ? a : b; }));
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Min(const SimdFloat4& lhs, const SimdFloat4& rhs) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_min_ps(lhs.m_value, rhs.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vminq_f32(lhs.m_value, rhs.m_value));
+#else
+        return SimdFloat4(Detail::SimdScalarApply(lhs.m_value, rhs.m_value,
+                                                  [](float a, float b) { return (a < b) ? a : b; }));
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::MultiplyAdd(const SimdFloat4& a, const SimdFloat4& b, const SimdFloat4& c) {
+#if defined(FL_SIMD_NEON)
+        return SimdFloat4(vfmaq_f32(c.m_value, a.m_value, b.m_value));
+#else
+        // FMA isn't part of the enabled x86 extensions
+        return a * b + c;
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Select(const SimdFloat4& mask, const SimdFloat4& ifTrue,
+                                         const SimdFloat4& ifFalse) {
+#if defined(FL_SIMD_NEON)
+        return SimdFloat4(vbslq_f32(vreinterpretq_u32_f32(mask.m_value), ifTrue.m_value, ifFalse.m_value));
+#else
+        return (mask & ifTrue) | AndNot(mask, ifFalse);
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Splat(const float value) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_set1_ps(value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vdupq_n_f32(value));
+#else
+        return SimdFloat4(value, value, value, value);
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Sqrt(const SimdFloat4& vec) {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_sqrt_ps(vec.m_value));
+#elif defined(FL_SIMD_NEON)
+        return SimdFloat4(vsqrtq_f32(vec.m_value));
+#else
+        NativeType result;
+        for (int i = 0; i < 4; ++i) {
+            result.lanes[i] = std::sqrt(vec.m_value.lanes[i]);
+        }
+
+        return SimdFloat4(result);
+#endif
+    }
+
+    inline SimdFloat4 SimdFloat4::Zero() {
+#if defined(FL_SIMD_SSE2)
+        return SimdFloat4(_mm_setzero_ps());
+#else
+        return Splat(0.f);
+#endif
+    }
+} // namespace Fl
@@ -0,0 +1,64 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_MATH_VECTOR3_HPP
+#define FL_MATH_VECTOR3_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+namespace Fl {
+    struct Vector3 {
+        float x;
+        float y;
+        float z;
+
+        constexpr Vector3() = default;
+        constexpr Vector3(float x, float y, float z);
+        explicit constexpr Vector3(float value);
+
+        /**
+         * @brief Checks whether each component is within epsilon of the other vector's.
+         */
+        constexpr bool ApproxEqual(const Vector3& vec, float epsilon = 1e-5f) const;
+
+        constexpr float Dot(const Vector3& vec) const;
+        constexpr Vector3 Cross(const Vector3& vec) const;
+
+        inline float GetLength() const;
+        inline Vector3 GetNormal() const;
+        constexpr float GetSquaredLength() const;
+
+        constexpr Vector3 operator-() const;
+
+        constexpr Vector3 operator+(const Vector3& vec) const;
+        constexpr Vector3 operator-(const Vector3& vec) const;
+        constexpr Vector3 operator*(const Vector3& vec) const;
+        constexpr Vector3 operator/(const Vector3& vec) const;
+        constexpr Vector3 operator*(float scale) const;
+        constexpr Vector3 operator/(float scale) const;
+
+        constexpr Vector3& operator+=(const Vector3& vec);
+        constexpr Vector3& operator-=(const Vector3& vec);
+        constexpr Vector3& operator*=(const Vector3& vec);
+        constexpr Vector3& operator*=(float scale);
+
+        constexpr bool operator==(const Vector3& vec) const = default;
+
+        static constexpr Vector3 Max(const Vector3& lhs, const Vector3& rhs);
+        static constexpr Vector3 Min(const Vector3& lhs, const Vector3& rhs);
+        static constexpr Vector3 Unit();
+        static constexpr Vector3 UnitX();
+        static constexpr Vector3 UnitY();
+        static constexpr Vector3 UnitZ();
+        static constexpr Vector3 Zero();
+    };
+
+    constexpr Vector3 operator*(float scale, const Vector3& vec);
+} // namespace Fl
+
+#include <FlashlightEngine/Math/Vector3.inl>
+
+#endif // FL_MATH_VECTOR3_HPP
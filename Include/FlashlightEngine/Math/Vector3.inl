@@ -0,0 +1,127 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    constexpr Vector3::Vector3(const float x, const float y, const float z) :
+        x(x), y(y), z(z) {
+    }
+
+    constexpr Vector3::Vector3(const float value) :
+        x(value), y(value), z(value) {
+    }
+
+    constexpr bool Vector3::ApproxEqual(const Vector3& vec, const float epsilon) const {
+        const Vector3 difference = *this - vec;
+        return (difference.x <= epsilon && difference.x >= -epsilon) &&
+               (difference.y <= epsilon && difference.y >= -epsilon) &&
+               (difference.z <= epsilon && difference.z >= -epsilon);
+    }
+
+    constexpr float Vector3::Dot(const Vector3& vec) const {
+        return x * vec.x + y * vec.y + z * vec.z;
+    }
+
+    constexpr Vector3 Vector3::Cross(const Vector3& vec) const {
+        return {y * vec.z - z * vec.y, z * vec.x - x * vec.z, x * vec.y - y * vec.x};
+    }
+
+    inline float Vector3::GetLength() const {
+        return std::sqrt(GetSquaredLength());
+    }
+
+    inline Vector3 Vector3::GetNormal() const {
+        const float length = GetLength();
+        return (length > 0.f) ? *this / length : Zero();
+    }
+
+    constexpr float Vector3::GetSquaredLength() const {
+        return Dot(*this);
+    }
+
+    constexpr Vector3 Vector3::operator-() const {
+        return {-x, -y, -z};
+    }
+
+    constexpr Vector3 Vector3::operator+(const Vector3& vec) const {
+        return {x + vec.x, y + vec.y, z + vec.z};
+    }
+
+    constexpr Vector3 Vector3::operator-(const Vector3& vec) const {
+        return {x - vec.x, y - vec.y, z - vec.z};
+    }
+
+    constexpr Vector3 Vector3::operator*(const Vector3& vec) const {
+        return {x * vec.x, y * vec.y, z * vec.z};
+    }
+
+    constexpr Vector3 Vector3::operator/(const Vector3& vec) const {
+        return {x / vec.x, y / vec.y, z / vec.z};
+    }
+
+    constexpr Vector3 Vector3::operator*(const float scale) const {
+        return {x * scale, y * scale, z * scale};
+    }
+
+    constexpr Vector3 Vector3::operator/(const float scale) const {
+        return {x / scale, y / scale, z / scale};
+    }
+
+    constexpr Vector3& Vector3::operator+=(const Vector3& vec) {
+        *this = *this + vec;
+        return *this;
+    }
+
+    constexpr Vector3& Vector3::operator-=(const Vector3& vec) {
+        *this = *this - vec;
+        return *this;
+    }
+
+    constexpr Vector3& Vector3::operator*=(const Vector3& vec) {
+        *this = *this * vec;
+        return *this;
+    }
+
+    constexpr Vector3& Vector3::operator*=(const float scale) {
+        *this = *this * scale;
+        return *this;
+    }
+
+    constexpr Vector3 Vector3::Max(const Vector3& lhs, const Vector3& rhs) {
+        return {(lhs.x > rhs.x) ? lhs.x : rhs.x, (lhs.y > rhs.y) ? lhs.y : rhs.y, (lhs.z > rhs.z) ? lhs.z : rhs.z};
+    }
+
+    constexpr Vector3 Vector3::Min(const Vector3& lhs, const Vector3& rhs) {
+        return {(lhs.x < rhs.x) ? lhs.x : rhs.x, (lhs.y < rhs.y) ? lhs.y : rhs.y, (lhs.z < rhs.z) ? lhs.z : rhs.z};
+    }
+
+    constexpr Vector3 Vector3::Unit() {
+        return Vector3(1.f);
+    }
+
+    constexpr Vector3 Vector3::UnitX() {
+        return {1.f, 0.f, 0.f};
+    }
+
+    constexpr Vector3 Vector3::UnitY() {
+        return {0.f, 1.f, 0.f};
+    }
+
+    constexpr Vector3 Vector3::UnitZ() {
+        return {0.f, 0.f, 1.f};
+    }
+
+    constexpr Vector3 Vector3::Zero() {
+        return Vector3(0.f);
+    }
+
+    constexpr Vector3 operator*(const float scale, const Vector3& vec) {
+        return vec * scale;
+    }
+} // namespace Fl
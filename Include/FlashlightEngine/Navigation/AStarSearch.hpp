@@ -0,0 +1,83 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_NAVIGATION_ASTARSEARCH_HPP
+#define FL_NAVIGATION_ASTARSEARCH_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief A* search state over a graph whose nodes are identified by consecutive integers.
+     *
+     * The graph is only described by the callbacks given to Search(), so the same state serves any graph. Nodes are
+     * stamped with the search that reached them, which avoids clearing the per-node arrays between searches: a search
+     * only costs the nodes it touches. A state must not be shared by concurrent searches.
+     */
+    class AStarSearch {
+    public:
+        using NodeId = UInt32;
+
+        static constexpr NodeId InvalidNode = std::numeric_limits<NodeId>::max();
+
+        AStarSearch() = default;
+        AStarSearch(const AStarSearch&) = default;
+        AStarSearch(AStarSearch&&) noexcept = default;
+        ~AStarSearch() = default;
+
+        /**
+         * @brief Gets the cost of the cheapest path found by the last search from its start to a node.
+         * @return Cost, or infinity if the node wasn't reached.
+         */
+        inline float GetCost(NodeId node) const;
+        /**
+         * @brief Gets the number of nodes expanded by the last search.
+         */
+        inline std::size_t GetExpandedNodeCount() const;
+        /**
+         * @brief Gets the path found by the last search from its start to a reached node.
+         * @param path Receives the nodes from the start to the given node, its previous content being replaced.
+         */
+        inline void GetPath(NodeId node, std::vector<NodeId>& path) const;
+
+        /**
+         * @brief Finds the cheapest path between two nodes.
+         * @param nodeCount Number of nodes of the graph, every identifier being lower.
+         * @param start Node the search starts from.
+         * @param goal Node to reach, or InvalidNode to compute the cost of every reachable node (heuristic ignored).
+         * @param forEachNeighbor Called as forEachNeighbor(node, visit), which calls visit(neighbor, cost) for every
+         *        edge leaving the node, costs being non-negative.
+         * @param heuristic Called as heuristic(node), never overestimating the cost from the node to the goal.
+         * @return Whether the goal was reached, always true without goal.
+         */
+        template <typename F, typename H>
+        bool Search(std::size_t nodeCount, NodeId start, NodeId goal, F&& forEachNeighbor, H&& heuristic);
+
+        AStarSearch& operator=(const AStarSearch&) = default;
+        AStarSearch& operator=(AStarSearch&&) noexcept = default;
+
+    private:
+        struct OpenNode {
+            float estimatedCost; //< Cost from the start plus heuristic
+            float cost;
+            NodeId node;
+        };
+
+        std::vector<float> m_costs;
+        std::vector<NodeId> m_parents;
+        std::vector<UInt32> m_stamps; //< Search which last reached each node
+        std::vector<OpenNode> m_openNodes; //< Binary heap
+        std::size_t m_expandedNodeCount = 0;
+        UInt32 m_stamp = 0;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Navigation/AStarSearch.inl>
+
+#endif // FL_NAVIGATION_ASTARSEARCH_HPP
@@ -0,0 +1,101 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Navigation/AStarSearch.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    inline float AStarSearch::GetCost(const NodeId node) const {
+        if (node >= m_stamps.size() || m_stamps[node] != m_stamp) {
+            return std::numeric_limits<float>::infinity();
+        }
+
+        return m_costs[node];
+    }
+
+    inline std::size_t AStarSearch::GetExpandedNodeCount() const {
+        return m_expandedNodeCount;
+    }
+
+    inline void AStarSearch::GetPath(const NodeId node, std::vector<NodeId>& path) const {
+        FlAssertMsg(node < m_stamps.size() && m_stamps[node] == m_stamp, "[Navigation/AStarSearch] Node not reached.");
+
+        path.clear();
+        for (NodeId current = node; current != InvalidNode; current = m_parents[current]) {
+            path.push_back(current);
+        }
+
+        std::reverse(path.begin(), path.end());
+    }
+
+    template <typename F, typename H>
+    bool AStarSearch::Search(const std::size_t nodeCount, const NodeId start, const NodeId goal, F&& forEachNeighbor,
+                             H&& heuristic) {
+        FlAssertMsg(start < nodeCount, "[Navigation/AStarSearch] Invalid start node.");
+
+        if (m_stamps.size() < nodeCount) {
+            m_costs.resize(nodeCount);
+            m_parents.resize(nodeCount);
+            m_stamps.resize(nodeCount, 0);
+        }
+
+        // Stamps wrapped around, the oldest ones could be taken for the current search
+        if (++m_stamp == 0) {
+            std::fill(m_stamps.begin(), m_stamps.end(), 0);
+            m_stamp = 1;
+        }
+
+        // Cheapest estimate first, the deepest node breaking ties
+        const auto compare = [](const OpenNode& lhs, const OpenNode& rhs) {
+            return lhs.estimatedCost > rhs.estimatedCost ||
+                   (lhs.estimatedCost == rhs.estimatedCost && lhs.cost < rhs.cost);
+        };
+
+        m_openNodes.clear();
+        m_expandedNodeCount = 0;
+
+        m_costs[start] = 0.0f;
+        m_parents[start] = InvalidNode;
+        m_stamps[start] = m_stamp;
+        m_openNodes.push_back({(goal != InvalidNode) ? heuristic(start) : 0.0f, 0.0f, start});
+
+        while (!m_openNodes.empty()) {
+            std::pop_heap(m_openNodes.begin(), m_openNodes.end(), compare);
+            const OpenNode openNode = m_openNodes.back();
+            m_openNodes.pop_back();
+
+            // A cheaper path to the node was found after it was queued
+            if (openNode.cost != m_costs[openNode.node]) {
+                continue;
+            }
+
+            if (openNode.node == goal) {
+                return true;
+            }
+
+            ++m_expandedNodeCount;
+            forEachNeighbor(openNode.node, [&](const NodeId neighbor, const float cost) {
+                const float neighborCost = openNode.cost + cost;
+                if (m_stamps[neighbor] == m_stamp && m_costs[neighbor] <= neighborCost) {
+                    return;
+                }
+
+                m_costs[neighbor] = neighborCost;
+                m_parents[neighbor] = openNode.node;
+                m_stamps[neighbor] = m_stamp;
+
+                const float estimatedCost = neighborCost + ((goal != InvalidNode) ? heuristic(neighbor) : 0.0f);
+                m_openNodes.push_back({estimatedCost, neighborCost, neighbor});
+                std::push_heap(m_openNodes.begin(), m_openNodes.end(), compare);
+            });
+        }
+
+        return goal == InvalidNode;
+    }
+} // namespace Fl
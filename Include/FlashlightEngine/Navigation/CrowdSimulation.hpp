@@ -0,0 +1,155 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_NAVIGATION_CROWDSIMULATION_HPP
+#define FL_NAVIGATION_CROWDSIMULATION_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Local collision avoidance of agents moving on the XZ plane, with optimal reciprocal collision avoidance
+     *        (ORCA).
+     *
+     * Every step, each agent picks the velocity closest to its preferred one among those avoiding its nearest
+     * neighbors for the time horizon, assuming they take half of the avoidance effort. Each neighbor forbids a
+     * half-plane of velocities, solved by an incremental 2D linear program; when the half-planes leave no velocity
+     * below the maximum speed, the one violating them the least is taken.
+     *
+     * Neighbors are found through a spatial hash whose cells are as large as the neighbor distance, wrapped around a
+     * grid of buckets. It is rebuilt at every step by a counting sort of the agents by bucket, counted and scattered
+     * in parallel blocks. Positions are copied in bucket order: neighboring cells of a row are contiguous and their
+     * agents tested SimdFloat4::Width at once, and agents are solved in this spatially coherent order.
+     *
+     * Velocities only depend on the state at the start of the step and neighbors are ordered by distance then index,
+     * so the results depend neither on the thread count nor on the path (SIMD or scalar) taken.
+     */
+    class FL_API CrowdSimulation {
+    public:
+#if defined(FL_ARCH_x86_64) || defined(FL_ARCH_aarch64)
+        static constexpr bool HasSimdPath = true;
+#else
+        static constexpr bool HasSimdPath = false;
+#endif
+
+        static constexpr std::size_t BatchSize = 256; //< Agents solved by a job
+        static constexpr std::size_t MaxNeighbors = 16;
+
+        struct Settings {
+            float neighborDistance = 4.0f; //< Also the size of the hash cells
+            float timeHorizon = 2.0f; //< Time for which collisions with the neighbors are avoided
+            UInt32 maxNeighbors = 10; //< At most MaxNeighbors
+            UInt32 bucketCount = 1 << 16; //< Power of two, at least 16
+            bool useSimd = HasSimdPath; //< Ignored without SIMD path
+        };
+
+        /**
+         * @brief Statistics of the last Step().
+         */
+        struct Statistics {
+            std::size_t agentCount;
+            std::size_t neighborCount; //< Summed over all agents
+            Clock::duration hashTime;
+            Clock::duration solveTime; //< Including the integration of the positions
+
+            inline Clock::duration GetStepTime() const;
+        };
+
+        CrowdSimulation();
+        explicit CrowdSimulation(const Settings& settings);
+        CrowdSimulation(const CrowdSimulation&) = delete;
+        CrowdSimulation(CrowdSimulation&&) noexcept = default;
+        ~CrowdSimulation() = default;
+
+        /**
+         * @brief Adds a motionless agent.
+         * @param position Position of the agent, which keeps its Y coordinate.
+         * @param radius Radius of the agent.
+         * @param maxSpeed Maximum speed of the agent.
+         * @return Index of the agent.
+         */
+        UInt32 AddAgent(const Vector3& position, float radius, float maxSpeed);
+
+        void Clear();
+
+        inline std::size_t GetAgentCount() const;
+        inline float GetMaxSpeed(UInt32 agent) const;
+        /**
+         * @brief Gets the neighbors avoided by an agent during the last Step(), nearest first.
+         */
+        inline std::span<const UInt32> GetNeighbors(UInt32 agent) const;
+        inline Vector3 GetPosition(UInt32 agent) const;
+        inline float GetRadius(UInt32 agent) const;
+        inline const Settings& GetSettings() const;
+        inline const Statistics& GetStatistics() const;
+        inline Vector3 GetVelocity(UInt32 agent) const;
+        inline bool IsUsingSimd() const;
+
+        void Reserve(std::size_t capacity);
+
+        void SetPosition(UInt32 agent, const Vector3& position);
+        /**
+         * @brief Sets the velocity an agent would take without neighbors, its Y coordinate being ignored.
+         */
+        void SetPreferredVelocity(UInt32 agent, const Vector3& velocity);
+
+        /**
+         * @brief Solves the velocities of the agents then moves them.
+         * @param deltaTime Duration of the step, in seconds.
+         * @param threadPool Thread pool building the hash and solving the batches, or nullptr to run on the calling
+         *        thread.
+         */
+        void Step(float deltaTime, ThreadPool* threadPool = nullptr);
+
+        CrowdSimulation& operator=(const CrowdSimulation&) = delete;
+        CrowdSimulation& operator=(CrowdSimulation&&) noexcept = default;
+
+    private:
+        void BuildHash(ThreadPool* threadPool);
+        template <bool UseSimd>
+        std::size_t FindNeighbors(UInt32 agent, UInt32* neighbors) const;
+        inline Int32 GetCell(float coordinate) const;
+        inline UInt32 HashCell(Int32 cellX, Int32 cellZ) const;
+        template <bool UseSimd>
+        void SolveBatch(std::size_t first, std::size_t last, float deltaTime);
+
+        // Agent state, by agent index
+        std::vector<float> m_positionX;
+        std::vector<float> m_positionY;
+        std::vector<float> m_positionZ;
+        std::vector<float> m_velocityX;
+        std::vector<float> m_velocityZ;
+        std::vector<float> m_preferredVelocityX;
+        std::vector<float> m_preferredVelocityZ;
+        std::vector<float> m_radii;
+        std::vector<float> m_maxSpeeds;
+        std::vector<float> m_newVelocityX;
+        std::vector<float> m_newVelocityZ;
+        std::vector<UInt32> m_neighbors; //< MaxNeighbors per agent
+        std::vector<UInt8> m_neighborCounts;
+        // Spatial hash, agents sorted by bucket with their positions padded by SimdFloat4::Width
+        std::vector<UInt32> m_agentBuckets;
+        std::vector<UInt32> m_blockOffsets; //< Per bucket then per block, counts then scatter positions
+        std::vector<UInt32> m_bucketOffsets;
+        std::vector<UInt32> m_sortedAgents;
+        std::vector<float> m_sortedPositionX;
+        std::vector<float> m_sortedPositionZ;
+        Statistics m_statistics;
+        Settings m_settings;
+        UInt32 m_bucketCountX; //< Buckets along X of the wrapped grid
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Navigation/CrowdSimulation.inl>
+
+#endif // FL_NAVIGATION_CROWDSIMULATION_HPP
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Navigation/CrowdSimulation.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    inline Clock::duration CrowdSimulation::Statistics::GetStepTime() const {
+        return hashTime + solveTime;
+    }
+
+    inline std::size_t CrowdSimulation::GetAgentCount() const {
+        return m_positionX.size();
+    }
+
+    inline float CrowdSimulation::GetMaxSpeed(const UInt32 agent) const {
+        FlAssertMsg(agent < GetAgentCount(), "[Navigation/CrowdSimulation] Invalid agent.");
+        return m_maxSpeeds[agent];
+    }
+
+    inline std::span<const UInt32> CrowdSimulation::GetNeighbors(const UInt32 agent) const {
+        FlAssertMsg(agent < GetAgentCount(), "[Navigation/CrowdSimulation] Invalid agent.");
+        return {&m_neighbors[std::size_t(agent) * MaxNeighbors], m_neighborCounts[agent]};
+    }
+
+    inline Vector3 CrowdSimulation::GetPosition(const UInt32 agent) const {
+        FlAssertMsg(agent < GetAgentCount(), "[Navigation/CrowdSimulation] Invalid agent.");
+        return {m_positionX[agent], m_positionY[agent], m_positionZ[agent]};
+    }
+
+    inline float CrowdSimulation::GetRadius(const UInt32 agent) const {
+        FlAssertMsg(agent < GetAgentCount(), "[Navigation/CrowdSimulation] Invalid agent.");
+        return m_radii[agent];
+    }
+
+    inline auto CrowdSimulation::GetSettings() const -> const Settings& {
+        return m_settings;
+    }
+
+    inline auto CrowdSimulation::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+
+    inline Vector3 CrowdSimulation::GetVelocity(const UInt32 agent) const {
+        FlAssertMsg(agent < GetAgentCount(), "[Navigation/CrowdSimulation] Invalid agent.");
+        return {m_velocityX[agent], 0.0f, m_velocityZ[agent]};
+    }
+
+    inline bool CrowdSimulation::IsUsingSimd() const {
+        return HasSimdPath && m_settings.useSimd;
+    }
+
+    inline Int32 CrowdSimulation::GetCell(const float coordinate) const {
+        return static_cast<Int32>(std::floor(coordinate / m_settings.neighborDistance));
+    }
+
+    inline UInt32 CrowdSimulation::HashCell(const Int32 cellX, const Int32 cellZ) const {
+        // Cells wrap around a grid of buckets, distant cells sharing a bucket being rejected by distance
+        const UInt32 bucketCountZ = m_settings.bucketCount / m_bucketCountX;
+        return (static_cast<UInt32>(cellZ) & (bucketCountZ - 1)) * m_bucketCountX +
+               (static_cast<UInt32>(cellX) & (m_bucketCountX - 1));
+    }
+} // namespace Fl
@@ -0,0 +1,93 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_NAVIGATION_NAVIGATIONGRAPH_HPP
+#define FL_NAVIGATION_NAVIGATIONGRAPH_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+#include <FlashlightEngine/Navigation/AStarSearch.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Walkable space searched by PathfindingService.
+     *
+     * Paths are found in two steps: a corridor of nodes (grid cells, navigation mesh polygons) linking the node of the
+     * start to the node of the goal, then the points to follow through it. Corridors don't depend on the exact start
+     * and goal positions, which is what gets cached.
+     *
+     * Nodes are grouped in regions, whose versions are incremented when their nodes change. A cached corridor stays
+     * valid while the regions it crosses keep their version, and while the graph version, incremented by the changes
+     * which may open shorter paths, doesn't change.
+     *
+     * Queries are const and may run concurrently, each thread with its own AStarSearch, as long as the graph isn't
+     * modified meanwhile.
+     */
+    class FL_API NavigationGraph {
+    public:
+        using NodeId = AStarSearch::NodeId;
+        using RegionId = UInt32;
+
+        static constexpr NodeId InvalidNode = AStarSearch::InvalidNode;
+
+        virtual ~NavigationGraph() = default;
+
+        /**
+         * @brief Builds the points to follow through a corridor.
+         * @param corridor Nodes found by FindCorridor().
+         * @param start Start position, in the first node of the corridor.
+         * @param goal Goal position, in the last node of the corridor.
+         * @param path Receives the points from start to goal, its previous content being replaced.
+         */
+        virtual void BuildPath(std::span<const NodeId> corridor, const Vector3& start, const Vector3& goal,
+                               std::vector<Vector3>& path) const = 0;
+
+        /**
+         * @brief Finds the nodes to traverse from a node to another.
+         * @param search Search state, which must not be used concurrently.
+         * @param corridor Receives the nodes from start to goal, its previous content being replaced.
+         * @return Whether the goal can be reached.
+         */
+        virtual bool FindCorridor(NodeId start, NodeId goal, AStarSearch& search,
+                                  std::vector<NodeId>& corridor) const = 0;
+        /**
+         * @brief Finds the node containing a position.
+         * @return Node, or InvalidNode if the position isn't walkable.
+         */
+        virtual NodeId FindNode(const Vector3& position) const = 0;
+
+        virtual RegionId GetRegion(NodeId node) const = 0;
+        inline std::size_t GetRegionCount() const;
+        inline UInt64 GetRegionVersion(RegionId region) const;
+        inline UInt64 GetVersion() const;
+
+    protected:
+        NavigationGraph() = default;
+        NavigationGraph(const NavigationGraph&) = default;
+        NavigationGraph(NavigationGraph&&) noexcept = default;
+
+        /**
+         * @brief Records a change of the nodes of a region.
+         * @param mayShortenPaths Whether the change made some nodes cheaper to cross, which may improve any path.
+         */
+        inline void InvalidateRegion(RegionId region, bool mayShortenPaths);
+        inline void SetRegionCount(std::size_t regionCount);
+
+        NavigationGraph& operator=(const NavigationGraph&) = default;
+        NavigationGraph& operator=(NavigationGraph&&) noexcept = default;
+
+    private:
+        std::vector<UInt64> m_regionVersions;
+        UInt64 m_version = 0;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Navigation/NavigationGraph.inl>
+
+#endif // FL_NAVIGATION_NAVIGATIONGRAPH_HPP
@@ -0,0 +1,38 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Navigation/NavigationGraph.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    inline std::size_t NavigationGraph::GetRegionCount() const {
+        return m_regionVersions.size();
+    }
+
+    inline UInt64 NavigationGraph::GetRegionVersion(const RegionId region) const {
+        FlAssertMsg(region < m_regionVersions.size(), "[Navigation/NavigationGraph] Invalid region.");
+
+        return m_regionVersions[region];
+    }
+
+    inline UInt64 NavigationGraph::GetVersion() const {
+        return m_version;
+    }
+
+    inline void NavigationGraph::InvalidateRegion(const RegionId region, const bool mayShortenPaths) {
+        FlAssertMsg(region < m_regionVersions.size(), "[Navigation/NavigationGraph] Invalid region.");
+
+        ++m_regionVersions[region];
+        if (mayShortenPaths) {
+            ++m_version;
+        }
+    }
+
+    inline void NavigationGraph::SetRegionCount(const std::size_t regionCount) {
+        m_regionVersions.resize(regionCount, 0);
+    }
+} // namespace Fl
@@ -0,0 +1,139 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_NAVIGATION_NAVIGATIONGRID_HPP
+#define FL_NAVIGATION_NAVIGATIONGRID_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Navigation/NavigationGraph.hpp>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Grid of weighted cells on the XZ plane, searched with hierarchical pathfinding (HPA*).
+     *
+     * The grid is split in square clusters. Where two neighboring clusters have walkable cells on both sides of their
+     * border, entrances are placed (one in the middle of short openings, one at each end of long ones). Entrances
+     * form an abstract graph: entrances facing each other are linked across the border, entrances of the same
+     * cluster are linked by the cost of the cheapest path between them inside the cluster.
+     *
+     * A search links the start and goal cells to the entrances of their clusters, runs A* on the abstract graph, then
+     * refines the path with A* restricted to the clusters it crosses. Paths are close to optimal (only the choice of
+     * clusters depends on the entrances), for a cost growing with the number of clusters crossed rather than the
+     * number of cells.
+     *
+     * Cells move to their 8 neighbors without cutting corners, a step costing its length times the average cost of
+     * both cells. Cost changes take effect on Update(), which only rebuilds the clusters around the changed cells.
+     * Each cluster is a region of the graph.
+     */
+    class FL_API NavigationGrid final : public NavigationGraph {
+    public:
+        static constexpr UInt8 BlockedCell = 0;
+
+        struct Settings {
+            UInt32 width = 256; //< Cells along X
+            UInt32 depth = 256; //< Cells along Z
+            UInt32 clusterSize = 16; //< Cells along each side of a cluster
+            float cellSize = 1.0f;
+            Vector3 origin = Vector3::Zero(); //< Corner of the first cell
+        };
+
+        /**
+         * @param settings Dimensions of the grid.
+         * @param cellCosts Cost of each cell, row by row along X, or empty for cells of cost 1.
+         * @param threadPool Thread pool building the clusters, or nullptr to run on the calling thread.
+         */
+        explicit NavigationGrid(const Settings& settings, std::span<const UInt8> cellCosts = {},
+                                ThreadPool* threadPool = nullptr);
+        NavigationGrid(const NavigationGrid&) = default;
+        NavigationGrid(NavigationGrid&&) noexcept = default;
+        ~NavigationGrid() override = default;
+
+        /**
+         * @brief Builds the centers of the cells where the corridor turns, between start and goal.
+         */
+        void BuildPath(std::span<const NodeId> corridor, const Vector3& start, const Vector3& goal,
+                       std::vector<Vector3>& path) const override;
+
+        /**
+         * @brief Finds the cells to traverse from a cell to another.
+         * @param search Search state, reused by the abstract search then by the refinement.
+         * @param corridor Receives adjacent cells.
+         */
+        bool FindCorridor(NodeId start, NodeId goal, AStarSearch& search,
+                          std::vector<NodeId>& corridor) const override;
+        NodeId FindNode(const Vector3& position) const override;
+
+        inline NodeId GetCell(UInt32 x, UInt32 z) const;
+        Vector3 GetCellCenter(NodeId cell) const;
+        inline UInt8 GetCellCost(UInt32 x, UInt32 z) const;
+        inline std::size_t GetClusterCount() const;
+        inline UInt32 GetDepth() const;
+        /**
+         * @brief Gets the number of entrances of the abstract graph, as of the last Update().
+         */
+        inline std::size_t GetEntranceCount() const;
+        RegionId GetRegion(NodeId node) const override;
+        inline const Settings& GetSettings() const;
+        inline UInt32 GetWidth() const;
+
+        /**
+         * @brief Changes the cost of a cell, taken into account by the next Update().
+         * @param cost Cost of crossing the cell, or BlockedCell.
+         */
+        void SetCellCost(UInt32 x, UInt32 z, UInt8 cost);
+
+        /**
+         * @brief Rebuilds the entrances and the paths inside the clusters around the cells changed since the last
+         *        update.
+         * @param threadPool Thread pool building the clusters, or nullptr to run on the calling thread.
+         */
+        void Update(ThreadPool* threadPool = nullptr);
+
+        NavigationGrid& operator=(const NavigationGrid&) = default;
+        NavigationGrid& operator=(NavigationGrid&&) noexcept = default;
+
+    private:
+        struct CellEdge {
+            NodeId from;
+            NodeId to;
+            float cost;
+        };
+
+        struct Edge {
+            NodeId node;
+            float cost;
+        };
+
+        inline std::span<const NodeId> GetClusterEntrances(RegionId cluster) const;
+        void FindClusterCosts(NodeId from, AStarSearch& search, std::span<const NodeId> targets,
+                              std::vector<float>& costs) const;
+        bool FindPathInClusters(NodeId from, NodeId to, std::span<const RegionId> clusters, AStarSearch& search,
+                                std::vector<NodeId>& cells) const;
+        std::vector<CellEdge> FindEntrances(std::vector<std::vector<NodeId>>& clusterEntrances) const;
+        template <typename F>
+        void ForEachNeighbor(UInt32 x, UInt32 z, F&& func) const;
+
+        std::vector<UInt8> m_cellCosts;
+        std::vector<std::vector<CellEdge>> m_clusterEdges; //< Paths between the entrances of each cluster
+        std::vector<UInt8> m_dirtyClusters;
+        // Abstract graph, whose nodes are the entrances sorted by cluster
+        std::vector<NodeId> m_entranceCells;
+        std::vector<NodeId> m_cellEntrances; //< InvalidNode for cells without entrance
+        std::vector<UInt32> m_clusterEntranceOffsets;
+        std::vector<UInt32> m_edgeOffsets;
+        std::vector<Edge> m_edges;
+        Settings m_settings;
+        UInt32 m_clusterCountX;
+        UInt32 m_clusterCountZ;
+        bool m_mayShortenPaths;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Navigation/NavigationGrid.inl>
+
+#endif // FL_NAVIGATION_NAVIGATIONGRID_HPP
@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Navigation/NavigationGrid.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    inline auto NavigationGrid::GetCell(const UInt32 x, const UInt32 z) const -> NodeId {
+        FlAssertMsg(x < m_settings.width && z < m_settings.depth, "[Navigation/NavigationGrid] Cell out of the grid.");
+
+        return z * m_settings.width + x;
+    }
+
+    inline UInt8 NavigationGrid::GetCellCost(const UInt32 x, const UInt32 z) const {
+        return m_cellCosts[GetCell(x, z)];
+    }
+
+    inline std::size_t NavigationGrid::GetClusterCount() const {
+        return static_cast<std::size_t>(m_clusterCountX) * m_clusterCountZ;
+    }
+
+    inline UInt32 NavigationGrid::GetDepth() const {
+        return m_settings.depth;
+    }
+
+    inline std::size_t NavigationGrid::GetEntranceCount() const {
+        return m_entranceCells.size();
+    }
+
+    inline auto NavigationGrid::GetSettings() const -> const Settings& {
+        return m_settings;
+    }
+
+    inline UInt32 NavigationGrid::GetWidth() const {
+        return m_settings.width;
+    }
+
+    inline auto NavigationGrid::GetClusterEntrances(const RegionId cluster) const -> std::span<const NodeId> {
+        const UInt32 first = m_clusterEntranceOffsets[cluster];
+        return std::span(m_entranceCells).subspan(first, m_clusterEntranceOffsets[cluster + 1] - first);
+    }
+} // namespace Fl
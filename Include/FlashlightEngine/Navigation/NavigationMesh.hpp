@@ -0,0 +1,99 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_NAVIGATION_NAVIGATIONMESH_HPP
+#define FL_NAVIGATION_NAVIGATIONMESH_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Navigation/NavigationGraph.hpp>
+
+namespace Fl {
+    /**
+     * @brief Walkable surface made of convex polygons, searched with A* over their adjacency.
+     *
+     * Polygons sharing an edge (the same two vertex indices) are linked through it. Moving from a polygon to a
+     * neighbor costs the distance from its center to the middle of the shared edge, then to the center of the
+     * neighbor, each part scaled by the cost of the polygon it crosses.
+     *
+     * Paths are pulled taut through the edges of the corridor with the funnel algorithm, on the XZ plane, so they only
+     * turn at polygon vertices. Each polygon is a region of the graph.
+     */
+    class FL_API NavigationMesh final : public NavigationGraph {
+    public:
+        /**
+         * @param vertices Vertex positions.
+         * @param indices Vertex indices of the polygons one after the other, each counter-clockwise seen from above.
+         * @param polygonSizes Vertex count of each polygon, at least 3.
+         */
+        NavigationMesh(std::span<const Vector3> vertices, std::span<const UInt32> indices,
+                       std::span<const UInt32> polygonSizes);
+        NavigationMesh(const NavigationMesh&) = default;
+        NavigationMesh(NavigationMesh&&) noexcept = default;
+        ~NavigationMesh() override = default;
+
+        void BuildPath(std::span<const NodeId> corridor, const Vector3& start, const Vector3& goal,
+                       std::vector<Vector3>& path) const override;
+
+        bool FindCorridor(NodeId start, NodeId goal, AStarSearch& search,
+                          std::vector<NodeId>& corridor) const override;
+        /**
+         * @brief Finds the polygon containing a position seen from above, the closest vertically if several do.
+         */
+        NodeId FindNode(const Vector3& position) const override;
+
+        inline std::size_t GetPolygonCount() const;
+        inline const Vector3& GetPolygonCenter(NodeId polygon) const;
+        inline float GetPolygonCost(NodeId polygon) const;
+        RegionId GetRegion(NodeId node) const override;
+
+        /**
+         * @brief Changes the cost of crossing a polygon.
+         * @param cost Multiplier of the distances travelled in the polygon, at least 1, or infinity to block it.
+         */
+        void SetPolygonCost(NodeId polygon, float cost);
+
+        NavigationMesh& operator=(const NavigationMesh&) = default;
+        NavigationMesh& operator=(NavigationMesh&&) noexcept = default;
+
+    private:
+        struct Link {
+            NodeId polygon;
+            UInt32 leftVertex; //< Ends of the shared edge, seen from the polygon the link leaves
+            UInt32 rightVertex;
+            float fromDistance; //< From the center of the polygon the link leaves to the middle of the edge
+            float toDistance;
+        };
+
+        struct Polygon {
+            Vector3 center;
+            float cost;
+            UInt32 firstIndex;
+            UInt32 indexCount;
+            UInt32 firstLink;
+            UInt32 linkCount;
+        };
+
+        bool ContainsPoint(const Polygon& polygon, const Vector3& position) const;
+
+        std::vector<Vector3> m_vertices;
+        std::vector<UInt32> m_indices;
+        std::vector<Polygon> m_polygons;
+        std::vector<Link> m_links;
+        // Polygons overlapping each bucket of a uniform grid on the XZ plane, to find the polygon of a position
+        std::vector<UInt32> m_bucketOffsets;
+        std::vector<NodeId> m_bucketPolygons;
+        float m_bucketMinX;
+        float m_bucketMinZ;
+        float m_bucketSizeX;
+        float m_bucketSizeZ;
+        UInt32 m_bucketCountX;
+        UInt32 m_bucketCountZ;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Navigation/NavigationMesh.inl>
+
+#endif // FL_NAVIGATION_NAVIGATIONMESH_HPP
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Navigation/NavigationMesh.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    inline std::size_t NavigationMesh::GetPolygonCount() const {
+        return m_polygons.size();
+    }
+
+    inline const Vector3& NavigationMesh::GetPolygonCenter(const NodeId polygon) const {
+        FlAssertMsg(polygon < m_polygons.size(), "[Navigation/NavigationMesh] Invalid polygon.");
+
+        return m_polygons[polygon].center;
+    }
+
+    inline float NavigationMesh::GetPolygonCost(const NodeId polygon) const {
+        FlAssertMsg(polygon < m_polygons.size(), "[Navigation/NavigationMesh] Invalid polygon.");
+
+        return m_polygons[polygon].cost;
+    }
+} // namespace Fl
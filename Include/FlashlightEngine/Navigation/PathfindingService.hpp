@@ -0,0 +1,162 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_NAVIGATION_PATHFINDINGSERVICE_HPP
+#define FL_NAVIGATION_PATHFINDINGSERVICE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Navigation/NavigationGraph.hpp>
+
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Answers path requests over a navigation graph in time-budgeted batches.
+     *
+     * Requests are queued by RequestPath() and answered by Update(), in submission order. Each update processes rounds
+     * of up to BatchSize requests per thread until its time budget is spent, so that path searches never cause a
+     * spike on the calling thread, however many are requested at once.
+     *
+     * Found corridors are cached by their start and goal nodes, and reused while the graph regions they cross are
+     * unchanged (see NavigationGraph). The cache keeps the most recently used corridors.
+     */
+    class FL_API PathfindingService {
+    public:
+        using RequestId = UInt64;
+
+        static constexpr RequestId InvalidRequest = 0;
+        static constexpr std::size_t BatchSize = 8;
+
+        enum class PathStatus {
+            Pending,
+            Found,
+            NotFound, //< Start or goal not walkable, or no path between them
+            Unknown, //< Never requested, cancelled or already polled
+
+            Max = Unknown
+        };
+
+        struct Settings {
+            std::size_t cacheCapacity = 1024; //< Corridors kept in the cache, 0 disabling it
+        };
+
+        /**
+         * @brief Statistics of the last Update().
+         */
+        struct Statistics {
+            std::size_t requestCount; //< Requests answered
+            std::size_t cacheHitCount;
+            std::size_t failedRequestCount;
+            Clock::duration updateTime;
+
+            /**
+             * @brief Gets the number of requests answered per second of update.
+             */
+            inline double GetPathsPerSecond() const;
+        };
+
+        /**
+         * @param graph Graph searched, which must outlive the service.
+         */
+        explicit PathfindingService(const NavigationGraph& graph);
+        PathfindingService(const NavigationGraph& graph, const Settings& settings);
+        PathfindingService(const PathfindingService&) = delete;
+        PathfindingService(PathfindingService&&) = delete;
+        ~PathfindingService() = default;
+
+        /**
+         * @brief Forgets a request, whether it was answered or not.
+         */
+        void CancelRequest(RequestId request);
+        void ClearCache();
+
+        inline std::size_t GetCachedCorridorCount() const;
+        inline std::size_t GetPendingRequestCount() const;
+        inline const Statistics& GetStatistics() const;
+
+        /**
+         * @brief Gets the answer to a request, which is forgotten once answered.
+         * @param request Request to poll.
+         * @param path Receives the points from start to goal if a path was found, untouched otherwise.
+         * @return Status of the request.
+         */
+        PathStatus PollPath(RequestId request, std::vector<Vector3>& path);
+
+        /**
+         * @brief Queues a path request.
+         * @return Identifier of the request, never reused.
+         */
+        RequestId RequestPath(const Vector3& start, const Vector3& goal);
+
+        /**
+         * @brief Answers queued requests until the time budget is spent.
+         *
+         * Cached corridors are reused on the calling thread, the other requests of a round being searched in parallel.
+         * The budget is checked after each round, at least one round being processed. The graph must not be modified
+         * during the update.
+         *
+         * @param timeBudget Time after which no new round starts.
+         * @param threadPool Thread pool searching the paths, or nullptr to run on the calling thread.
+         */
+        void Update(Clock::duration timeBudget, ThreadPool* threadPool = nullptr);
+
+        PathfindingService& operator=(const PathfindingService&) = delete;
+        PathfindingService& operator=(PathfindingService&&) = delete;
+
+    private:
+        using NodeId = NavigationGraph::NodeId;
+        using RegionId = NavigationGraph::RegionId;
+
+        struct CachedCorridor {
+            std::vector<NodeId> nodes;
+            std::vector<std::pair<RegionId, UInt64>> regionVersions; //< Of the regions crossed, when cached
+            std::list<UInt64>::iterator usePosition;
+            UInt64 graphVersion;
+        };
+
+        struct Request {
+            Vector3 start;
+            Vector3 goal;
+            std::vector<Vector3> path;
+            PathStatus status;
+        };
+
+        struct Search {
+            Request* request;
+            std::vector<NodeId> corridor;
+            UInt64 key; //< Start node then goal node
+            NodeId start;
+            NodeId goal;
+            bool isFound;
+        };
+
+        void AddCachedCorridor(UInt64 key, std::span<const NodeId> corridor);
+        const std::vector<NodeId>* FindCachedCorridor(UInt64 key);
+
+        std::unordered_map<UInt64, CachedCorridor> m_cache;
+        std::list<UInt64> m_cacheUseOrder; //< Most recently used first
+        std::unordered_map<RequestId, Request> m_requests;
+        std::deque<RequestId> m_pendingRequests; //< May hold cancelled requests
+        std::vector<AStarSearch> m_searchStates; //< One per thread
+        std::vector<Search> m_searches;
+        const NavigationGraph& m_graph;
+        Settings m_settings;
+        Statistics m_statistics;
+        RequestId m_nextRequest;
+        std::size_t m_pendingRequestCount;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Navigation/PathfindingService.inl>
+
+#endif // FL_NAVIGATION_PATHFINDINGSERVICE_HPP
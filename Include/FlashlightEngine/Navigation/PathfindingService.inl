@@ -0,0 +1,26 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Navigation/PathfindingService.hpp>
+
+namespace Fl {
+    inline double PathfindingService::Statistics::GetPathsPerSecond() const {
+        const double seconds = std::chrono::duration<double>(updateTime).count();
+        return (seconds > 0.0) ? static_cast<double>(requestCount) / seconds : 0.0;
+    }
+
+    inline std::size_t PathfindingService::GetCachedCorridorCount() const {
+        return m_cache.size();
+    }
+
+    inline std::size_t PathfindingService::GetPendingRequestCount() const {
+        return m_pendingRequestCount;
+    }
+
+    inline auto PathfindingService::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+} // namespace Fl
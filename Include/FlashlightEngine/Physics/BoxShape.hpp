@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_BOXSHAPE_HPP
+#define FL_PHYSICS_BOXSHAPE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Physics/Shape.hpp>
+
+namespace Fl {
+    /**
+     * @brief Box centered on the shape origin.
+     */
+    class FL_API BoxShape final : public Shape {
+    public:
+        static constexpr ShapeType Type = ShapeType::Box;
+
+        explicit BoxShape(const Vector3& halfExtents);
+        BoxShape(const BoxShape&) = default;
+        BoxShape(BoxShape&&) noexcept = default;
+        ~BoxShape() override = default;
+
+        Aabb ComputeBounds(const Vector3& position, const Quaternion& rotation) const override;
+
+        inline const Vector3& GetHalfExtents() const;
+        inline float GetRoundingRadius() const;
+        /**
+         * @brief Gets the corner farthest along a direction, in local space.
+         */
+        inline Vector3 GetSupport(const Vector3& direction) const;
+        /**
+         * @brief Gets the points of the core shape farthest along a direction, in local space.
+         * @param direction Direction, not necessarily normalized.
+         * @param feature Receives the points, forming a vertex, an edge or a face.
+         */
+        inline void GetSupportingFeature(const Vector3& direction, ShapeFeature& feature) const;
+
+        BoxShape& operator=(const BoxShape&) = default;
+        BoxShape& operator=(BoxShape&&) noexcept = default;
+
+    private:
+        Vector3 m_halfExtents;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/BoxShape.inl>
+
+#endif // FL_PHYSICS_BOXSHAPE_HPP
@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/BoxShape.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    inline const Vector3& BoxShape::GetHalfExtents() const {
+        return m_halfExtents;
+    }
+
+    inline float BoxShape::GetRoundingRadius() const {
+        return 0.f;
+    }
+
+    inline Vector3 BoxShape::GetSupport(const Vector3& direction) const {
+        return {(direction.x >= 0.f) ? m_halfExtents.x : -m_halfExtents.x,
+                (direction.y >= 0.f) ? m_halfExtents.y : -m_halfExtents.y,
+                (direction.z >= 0.f) ? m_halfExtents.z : -m_halfExtents.z};
+    }
+
+    inline void BoxShape::GetSupportingFeature(const Vector3& direction, ShapeFeature& feature) const {
+        feature.clear();
+
+        const float halfExtents[3] = {m_halfExtents.x, m_halfExtents.y, m_halfExtents.z};
+        const float components[3] = {direction.x, direction.y, direction.z};
+
+        // Flipping the corner along an axis moves it back by 2 * halfExtent * |component|
+        float extent = 0.f;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            extent += 2.f * halfExtents[axis] * std::abs(components[axis]);
+        }
+
+        float corner[3];
+        UInt32 freeAxes = 0;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            corner[axis] = (components[axis] >= 0.f) ? halfExtents[axis] : -halfExtents[axis];
+            if (extent > 0.f && 2.f * halfExtents[axis] * std::abs(components[axis]) <= FeatureTolerance * extent) {
+                freeAxes |= 1u << axis;
+            }
+        }
+
+        // Corners of the edge or face spanned by the free axes
+        for (UInt32 flips = 0; flips < 8; ++flips) {
+            if ((flips & ~freeAxes) != 0) {
+                continue;
+            }
+
+            feature.push_back({(flips & 1u) ? -corner[0] : corner[0], (flips & 2u) ? -corner[1] : corner[1],
+                               (flips & 4u) ? -corner[2] : corner[2]});
+        }
+    }
+} // namespace Fl
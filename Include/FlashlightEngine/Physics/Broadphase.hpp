@@ -0,0 +1,122 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_BROADPHASE_HPP
+#define FL_PHYSICS_BROADPHASE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Aabb.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    struct BroadphasePair {
+        UInt32 first;  //< Always lower than second
+        UInt32 second;
+
+        /**
+         * @brief Gets a key ordering pairs by first then second proxy.
+         * @return 64-bit key.
+         */
+        constexpr UInt64 GetKey() const;
+
+        constexpr bool operator==(const BroadphasePair& pair) const = default;
+    };
+
+    /**
+     * @brief Finds the pairs of bodies whose bounds overlap, the first step of collision detection.
+     *
+     * Bodies are represented by proxies holding their bounds and a user value (typically the body handle). Backends
+     * only differ by their acceleration structure: they all report exactly the same pairs, sorted and without
+     * duplicates, whatever the thread count.
+     *
+     * Destroyed proxy identifiers are only recycled by the next FindPairs(), so that the backends can remove them
+     * lazily.
+     */
+    class FL_API Broadphase {
+    public:
+        using ProxyId = UInt32;
+
+        static constexpr ProxyId InvalidProxy = std::numeric_limits<ProxyId>::max();
+        static constexpr std::size_t BatchSize = 256;
+
+        virtual ~Broadphase() = default;
+
+        /**
+         * @brief Creates a proxy.
+         * @param bounds Bounds of the body.
+         * @param userData Value returned by GetUserData().
+         * @return Identifier of the new proxy.
+         */
+        virtual ProxyId CreateProxy(const Aabb& bounds, UInt64 userData) = 0;
+        virtual void DestroyProxy(ProxyId proxy) = 0;
+
+        /**
+         * @brief Finds all pairs of proxies whose bounds overlap.
+         * @param pairs Receives the pairs sorted by GetKey(), its previous content is replaced.
+         * @param threadPool Thread pool processing the proxies, or nullptr to run on the calling thread.
+         */
+        virtual void FindPairs(std::vector<BroadphasePair>& pairs, ThreadPool* threadPool = nullptr) = 0;
+
+        const Aabb& GetProxyBounds(ProxyId proxy) const;
+        /**
+         * @brief Gets the number of live proxies.
+         * @return Proxy count.
+         */
+        std::size_t GetProxyCount() const;
+        UInt64 GetUserData(ProxyId proxy) const;
+
+        bool IsValid(ProxyId proxy) const;
+
+        /**
+         * @brief Changes the bounds of a proxy.
+         * @param proxy Proxy to move.
+         * @param bounds New bounds of the body.
+         */
+        virtual void MoveProxy(ProxyId proxy, const Aabb& bounds) = 0;
+
+    protected:
+        Broadphase() = default;
+        Broadphase(const Broadphase&) = default;
+        Broadphase(Broadphase&&) noexcept = default;
+
+        ProxyId AllocateProxy(const Aabb& bounds, UInt64 userData);
+        void FreeProxy(ProxyId proxy);
+        /**
+         * @brief Splits [0, count) in batches, each appending its pairs to its own vector, and concatenates them in
+         * order so that the result doesn't depend on the thread count.
+         * @param count Number of elements.
+         * @param pairs Receives the pairs of all batches.
+         * @param threadPool Thread pool processing the batches, or nullptr to run on the calling thread.
+         * @param func Function called as func(output, first, last) for each batch.
+         */
+        template <typename F>
+        void FindPairsInBatches(std::size_t count, std::vector<BroadphasePair>& pairs, ThreadPool* threadPool,
+                                F&& func) const;
+        /**
+         * @brief Makes the identifiers of the proxies destroyed since the last call available again.
+         */
+        void RecycleProxies();
+
+        Broadphase& operator=(const Broadphase&) = default;
+        Broadphase& operator=(Broadphase&&) noexcept = default;
+
+        std::vector<Aabb> m_proxyBounds;
+        std::vector<UInt64> m_userData;
+        std::vector<UInt8> m_validProxies;
+
+    private:
+        std::vector<ProxyId> m_freeProxies;
+        std::vector<ProxyId> m_destroyedProxies;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/Broadphase.inl>
+
+#endif // FL_PHYSICS_BROADPHASE_HPP
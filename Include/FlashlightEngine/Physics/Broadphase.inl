@@ -0,0 +1,41 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/Broadphase.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+namespace Fl {
+    constexpr UInt64 BroadphasePair::GetKey() const {
+        return (static_cast<UInt64>(first) << 32) | second;
+    }
+
+    template <typename F>
+    void Broadphase::FindPairsInBatches(const std::size_t count, std::vector<BroadphasePair>& pairs,
+                                        ThreadPool* threadPool, F&& func) const {
+        pairs.clear();
+
+        if (!threadPool) {
+            func(pairs, std::size_t(0), count);
+            return;
+        }
+
+        std::vector<std::vector<BroadphasePair>> batchPairs((count + BatchSize - 1) / BatchSize);
+        threadPool->ParallelFor(count, BatchSize, [&](const std::size_t first, const std::size_t last) {
+            func(batchPairs[first / BatchSize], first, last);
+        });
+
+        std::size_t totalCount = 0;
+        for (const std::vector<BroadphasePair>& batch : batchPairs) {
+            totalCount += batch.size();
+        }
+
+        pairs.reserve(totalCount);
+        for (const std::vector<BroadphasePair>& batch : batchPairs) {
+            pairs.insert(pairs.end(), batch.begin(), batch.end());
+        }
+    }
+} // namespace Fl
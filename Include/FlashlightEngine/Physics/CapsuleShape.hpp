@@ -0,0 +1,57 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_CAPSULESHAPE_HPP
+#define FL_PHYSICS_CAPSULESHAPE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Physics/Shape.hpp>
+
+namespace Fl {
+    /**
+     * @brief Capsule along the local Y axis: a segment core inflated by the radius.
+     */
+    class FL_API CapsuleShape final : public Shape {
+    public:
+        static constexpr ShapeType Type = ShapeType::Capsule;
+
+        /**
+         * @param halfHeight Half length of the core segment, the total height being 2 * (halfHeight + radius).
+         * @param radius Radius of the capsule.
+         */
+        CapsuleShape(float halfHeight, float radius);
+        CapsuleShape(const CapsuleShape&) = default;
+        CapsuleShape(CapsuleShape&&) noexcept = default;
+        ~CapsuleShape() override = default;
+
+        Aabb ComputeBounds(const Vector3& position, const Quaternion& rotation) const override;
+
+        inline float GetHalfHeight() const;
+        inline float GetRadius() const;
+        inline float GetRoundingRadius() const;
+        /**
+         * @brief Gets the point of the core shape farthest along a direction, in local space.
+         */
+        inline Vector3 GetSupport(const Vector3& direction) const;
+        /**
+         * @brief Gets the points of the core shape farthest along a direction, in local space.
+         * @param direction Direction, not necessarily normalized.
+         * @param feature Receives the points, forming a vertex, an edge or a face.
+         */
+        inline void GetSupportingFeature(const Vector3& direction, ShapeFeature& feature) const;
+
+        CapsuleShape& operator=(const CapsuleShape&) = default;
+        CapsuleShape& operator=(CapsuleShape&&) noexcept = default;
+
+    private:
+        float m_halfHeight;
+        float m_radius;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/CapsuleShape.inl>
+
+#endif // FL_PHYSICS_CAPSULESHAPE_HPP
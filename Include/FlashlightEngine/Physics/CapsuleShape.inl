@@ -0,0 +1,39 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/CapsuleShape.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    inline float CapsuleShape::GetHalfHeight() const {
+        return m_halfHeight;
+    }
+
+    inline float CapsuleShape::GetRadius() const {
+        return m_radius;
+    }
+
+    inline float CapsuleShape::GetRoundingRadius() const {
+        return m_radius;
+    }
+
+    inline Vector3 CapsuleShape::GetSupport(const Vector3& direction) const {
+        return {0.f, (direction.y >= 0.f) ? m_halfHeight : -m_halfHeight, 0.f};
+    }
+
+    inline void CapsuleShape::GetSupportingFeature(const Vector3& direction, ShapeFeature& feature) const {
+        feature.clear();
+
+        // The whole segment when the direction is about perpendicular to it
+        if (std::abs(direction.y) <= FeatureTolerance * direction.GetLength()) {
+            feature.push_back({0.f, -m_halfHeight, 0.f});
+            feature.push_back({0.f, m_halfHeight, 0.f});
+        } else {
+            feature.push_back(GetSupport(direction));
+        }
+    }
+} // namespace Fl
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_CONTACTMANIFOLD_HPP
+#define FL_PHYSICS_CONTACTMANIFOLD_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+#include <array>
+
+namespace Fl {
+    /**
+     * @brief Contact point between two bodies, with the impulses the solver applied at it.
+     */
+    struct ContactPoint {
+        Vector3 localPointA; //< Point on the surface of the first body, in its local space
+        Vector3 localPointB; //< Point on the surface of the second body, in its local space
+        Vector3 position; //< World position, halfway between both surfaces
+        float depth; //< Penetration depth, negative when the surfaces are apart but within the contact margin
+        float normalImpulse = 0.f;
+        float tangentImpulses[2] = {};
+        UInt32 featureId; //< Identifies the point across steps, impulses are carried over between matching points
+    };
+
+    /**
+     * @brief Contact points between two bodies, sharing the same normal.
+     */
+    struct ContactManifold {
+        static constexpr std::size_t MaxPoints = 4;
+
+        /**
+         * @brief Gets a key identifying the pair of bodies, whatever their order in the manifold.
+         */
+        constexpr UInt64 GetKey() const;
+
+        UInt32 bodyA;
+        UInt32 bodyB;
+        Vector3 normal; //< Unit normal pointing from the first body toward the second one
+        UInt32 pointCount = 0;
+        std::array<ContactPoint, MaxPoints> points;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/ContactManifold.inl>
+
+#endif // FL_PHYSICS_CONTACTMANIFOLD_HPP
@@ -0,0 +1,15 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/ContactManifold.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    constexpr UInt64 ContactManifold::GetKey() const {
+        return (static_cast<UInt64>(std::min(bodyA, bodyB)) << 32) | std::max(bodyA, bodyB);
+    }
+} // namespace Fl
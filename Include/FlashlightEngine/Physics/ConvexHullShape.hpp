@@ -0,0 +1,59 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_CONVEXHULLSHAPE_HPP
+#define FL_PHYSICS_CONVEXHULLSHAPE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Physics/Shape.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Convex hull of a point cloud, collided through its support function.
+     *
+     * Points inside the hull are harmless but slow down the support queries, which scan every point.
+     */
+    class FL_API ConvexHullShape final : public Shape {
+    public:
+        static constexpr ShapeType Type = ShapeType::ConvexHull;
+
+        /**
+         * @param points Points of the hull in local space, at least four of them not coplanar.
+         */
+        explicit ConvexHullShape(std::span<const Vector3> points);
+        ConvexHullShape(const ConvexHullShape&) = default;
+        ConvexHullShape(ConvexHullShape&&) noexcept = default;
+        ~ConvexHullShape() override = default;
+
+        Aabb ComputeBounds(const Vector3& position, const Quaternion& rotation) const override;
+
+        inline std::span<const Vector3> GetPoints() const;
+        inline float GetRoundingRadius() const;
+        /**
+         * @brief Gets the point farthest along a direction, in local space.
+         */
+        inline Vector3 GetSupport(const Vector3& direction) const;
+        /**
+         * @brief Gets the points of the core shape farthest along a direction, in local space.
+         * @param direction Direction, not necessarily normalized.
+         * @param feature Receives the points, forming a vertex, an edge or a face.
+         */
+        inline void GetSupportingFeature(const Vector3& direction, ShapeFeature& feature) const;
+
+        ConvexHullShape& operator=(const ConvexHullShape&) = default;
+        ConvexHullShape& operator=(ConvexHullShape&&) noexcept = default;
+
+    private:
+        std::vector<Vector3> m_points;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/ConvexHullShape.inl>
+
+#endif // FL_PHYSICS_CONVEXHULLSHAPE_HPP
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/ConvexHullShape.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    inline std::span<const Vector3> ConvexHullShape::GetPoints() const {
+        return m_points;
+    }
+
+    inline float ConvexHullShape::GetRoundingRadius() const {
+        return 0.f;
+    }
+
+    inline Vector3 ConvexHullShape::GetSupport(const Vector3& direction) const {
+        std::size_t bestPoint = 0;
+        float bestDistance = m_points[0].Dot(direction);
+        for (std::size_t i = 1; i < m_points.size(); ++i) {
+            const float distance = m_points[i].Dot(direction);
+            if (distance > bestDistance) {
+                bestPoint = i;
+                bestDistance = distance;
+            }
+        }
+
+        return m_points[bestPoint];
+    }
+
+    inline void ConvexHullShape::GetSupportingFeature(const Vector3& direction, ShapeFeature& feature) const {
+        feature.clear();
+
+        float maxDistance = m_points[0].Dot(direction);
+        float minDistance = maxDistance;
+        for (std::size_t i = 1; i < m_points.size(); ++i) {
+            const float distance = m_points[i].Dot(direction);
+            maxDistance = std::max(maxDistance, distance);
+            minDistance = std::min(minDistance, distance);
+        }
+
+        const float threshold = maxDistance - FeatureTolerance * (maxDistance - minDistance);
+        for (const Vector3& point : m_points) {
+            if (point.Dot(direction) >= threshold) {
+                feature.push_back(point);
+            }
+        }
+    }
+} // namespace Fl
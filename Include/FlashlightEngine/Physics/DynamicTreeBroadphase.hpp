@@ -0,0 +1,88 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_DYNAMICTREEBROADPHASE_HPP
+#define FL_PHYSICS_DYNAMICTREEBROADPHASE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Physics/Broadphase.hpp>
+
+namespace Fl {
+    /**
+     * @brief Broadphase backed by a binary tree of fattened bounds.
+     *
+     * Each proxy is stored in the tree with its bounds enlarged by a margin, so that a body moving by less than the
+     * margin doesn't touch the tree at all. Leaves are inserted next to the sibling minimizing the surface area
+     * increase, and the nodes on the way back to the root swap children with grand-children when it shrinks them,
+     * which keeps the tree efficient whatever the insertion order.
+     *
+     * Finding pairs queries the tree with the bounds of every proxy, the queries being read-only they run in parallel.
+     * This backend handles proxies of very different sizes and sparse scenes well.
+     */
+    class FL_API DynamicTreeBroadphase final : public Broadphase {
+    public:
+        /**
+         * @param margin Distance by which the proxy bounds are enlarged in the tree.
+         */
+        explicit DynamicTreeBroadphase(float margin = 0.1f);
+        DynamicTreeBroadphase(const DynamicTreeBroadphase&) = default;
+        DynamicTreeBroadphase(DynamicTreeBroadphase&&) noexcept = default;
+        ~DynamicTreeBroadphase() override = default;
+
+        ProxyId CreateProxy(const Aabb& bounds, UInt64 userData) override;
+        void DestroyProxy(ProxyId proxy) override;
+
+        void FindPairs(std::vector<BroadphasePair>& pairs, ThreadPool* threadPool = nullptr) override;
+
+        /**
+         * @brief Gets the enlarged bounds stored in the tree for a proxy.
+         */
+        const Aabb& GetFatBounds(ProxyId proxy) const;
+        /**
+         * @brief Gets the height of the tree, a single leaf having a height of zero.
+         * @return Tree height, or -1 if the tree is empty.
+         */
+        Int32 GetHeight() const;
+        float GetMargin() const;
+
+        void MoveProxy(ProxyId proxy, const Aabb& bounds) override;
+
+        DynamicTreeBroadphase& operator=(const DynamicTreeBroadphase&) = default;
+        DynamicTreeBroadphase& operator=(DynamicTreeBroadphase&&) noexcept = default;
+
+    private:
+        struct Node {
+            Aabb bounds;
+            UInt32 parent;
+            UInt32 children[2]; //< InvalidNode for leaves
+            ProxyId proxy;
+            Int32 height;
+
+            inline bool IsLeaf() const;
+        };
+
+        UInt32 AllocateNode();
+        void FreeNode(UInt32 nodeIndex);
+        void InsertLeaf(UInt32 leaf);
+        void RemoveLeaf(UInt32 leaf);
+        void ReplaceChild(UInt32 parent, UInt32 oldChild, UInt32 newChild);
+        void RotateNode(UInt32 nodeIndex);
+        void UpdateNode(UInt32 nodeIndex);
+
+        static constexpr UInt32 InvalidNode = std::numeric_limits<UInt32>::max();
+
+        std::vector<Node> m_nodes;
+        std::vector<UInt32> m_freeNodes;
+        std::vector<UInt32> m_proxyLeaves;
+        std::vector<ProxyId> m_queryOrder;
+        UInt32 m_root = InvalidNode;
+        float m_margin;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/DynamicTreeBroadphase.inl>
+
+#endif // FL_PHYSICS_DYNAMICTREEBROADPHASE_HPP
@@ -0,0 +1,13 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/DynamicTreeBroadphase.hpp>
+
+namespace Fl {
+    inline bool DynamicTreeBroadphase::Node::IsLeaf() const {
+        return children[0] == InvalidNode;
+    }
+} // namespace Fl
@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_GJK_HPP
+#define FL_PHYSICS_GJK_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+#include <array>
+#include <optional>
+
+namespace Fl {
+    /**
+     * @brief Vertex of the Minkowski difference A - B, with the points of both shapes it comes from.
+     */
+    struct GjkSupportPoint {
+        Vector3 point; //< pointA - pointB
+        Vector3 pointA;
+        Vector3 pointB;
+    };
+
+    struct GjkSimplex {
+        std::array<GjkSupportPoint, 4> vertices;
+        std::size_t count = 0;
+    };
+
+    struct GjkResult {
+        Vector3 pointA; //< Point of the first shape closest to the second one
+        Vector3 pointB; //< Point of the second shape closest to the first one
+        float distance; //< Zero when the shapes overlap
+        bool overlapping;
+        GjkSimplex simplex; //< Last simplex, enclosing the origin when the shapes overlap
+    };
+
+    struct EpaResult {
+        Vector3 normal; //< Unit normal pointing from the first shape toward the second one
+        Vector3 pointA; //< Deepest point of the first shape inside the second one
+        Vector3 pointB; //< Deepest point of the second shape inside the first one
+        float depth; //< Distance to move the second shape along the normal to separate the shapes
+    };
+
+    /**
+     * @brief Computes the closest points of two convex shapes with the Gilbert-Johnson-Keerthi algorithm.
+     *
+     * Shapes are only known through their support functions, called as support(direction) and returning the world
+     * point of the shape farthest along the (not necessarily normalized) direction.
+     *
+     * @param supportA Support function of the first shape.
+     * @param supportB Support function of the second shape.
+     * @param initialDirection First search direction, the offset between both shapes converges faster.
+     * @return Closest points, or the simplex enclosing the origin to give to ComputeEpaPenetration().
+     */
+    template <typename SupportA, typename SupportB>
+    GjkResult ComputeGjkDistance(SupportA&& supportA, SupportB&& supportB, const Vector3& initialDirection);
+
+    /**
+     * @brief Computes the penetration of two overlapping convex shapes with the Expanding Polytope Algorithm.
+     * @param supportA Support function of the first shape.
+     * @param supportB Support function of the second shape.
+     * @param simplex Simplex enclosing the origin, as returned by ComputeGjkDistance().
+     * @return Penetration, or nothing if the shapes are flat and the polytope could not get a volume.
+     */
+    template <typename SupportA, typename SupportB>
+    std::optional<EpaResult> ComputeEpaPenetration(SupportA&& supportA, SupportB&& supportB,
+                                                   const GjkSimplex& simplex);
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/Gjk.inl>
+
+#endif // FL_PHYSICS_GJK_HPP
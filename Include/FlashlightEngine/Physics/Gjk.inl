@@ -0,0 +1,468 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/Gjk.hpp>
+
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Fl {
+    namespace Detail {
+        struct EpaFace {
+            UInt32 indices[3]; //< Counter-clockwise seen from outside the polytope
+            Vector3 normal;
+            float distance;
+        };
+
+        template <typename SupportA, typename SupportB>
+        GjkSupportPoint ComputeSupportPoint(SupportA& supportA, SupportB& supportB, const Vector3& direction) {
+            const Vector3 pointA = supportA(direction);
+            const Vector3 pointB = supportB(-direction);
+
+            return {pointA - pointB, pointA, pointB};
+        }
+
+        inline void SetGjkVertex(const GjkSupportPoint& a, GjkSimplex& simplex, std::array<float, 4>& weights) {
+            simplex.vertices[0] = a;
+            simplex.count = 1;
+            weights[0] = 1.f;
+        }
+
+        inline void SetGjkEdge(const GjkSupportPoint& a, const GjkSupportPoint& b, const float t, GjkSimplex& simplex,
+                               std::array<float, 4>& weights) {
+            simplex.vertices[0] = a;
+            simplex.vertices[1] = b;
+            simplex.count = 2;
+            weights[0] = 1.f - t;
+            weights[1] = t;
+        }
+
+        /**
+         * @brief Reduces a segment to its feature closest to the origin.
+         */
+        inline void ReduceGjkSegment(const GjkSupportPoint& a, const GjkSupportPoint& b, GjkSimplex& simplex,
+                                     std::array<float, 4>& weights) {
+            const Vector3 ab = b.point - a.point;
+            const float t = -a.point.Dot(ab);
+            const float squaredLength = ab.Dot(ab);
+
+            if (t <= 0.f) {
+                SetGjkVertex(a, simplex, weights);
+            } else if (t >= squaredLength) {
+                SetGjkVertex(b, simplex, weights);
+            } else {
+                SetGjkEdge(a, b, t / squaredLength, simplex, weights);
+            }
+        }
+
+        /**
+         * @brief Reduces a triangle to its feature closest to the origin, following the Voronoi regions of its
+         *        vertices and edges.
+         */
+        inline void ReduceGjkTriangle(const GjkSupportPoint& a, const GjkSupportPoint& b, const GjkSupportPoint& c,
+                                      GjkSimplex& simplex, std::array<float, 4>& weights) {
+            const Vector3 ab = b.point - a.point;
+            const Vector3 ac = c.point - a.point;
+
+            const float d1 = -ab.Dot(a.point);
+            const float d2 = -ac.Dot(a.point);
+            if (d1 <= 0.f && d2 <= 0.f) {
+                SetGjkVertex(a, simplex, weights);
+                return;
+            }
+
+            const float d3 = -ab.Dot(b.point);
+            const float d4 = -ac.Dot(b.point);
+            if (d3 >= 0.f && d4 <= d3) {
+                SetGjkVertex(b, simplex, weights);
+                return;
+            }
+
+            const float vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+                SetGjkEdge(a, b, d1 / (d1 - d3), simplex, weights);
+                return;
+            }
+
+            const float d5 = -ab.Dot(c.point);
+            const float d6 = -ac.Dot(c.point);
+            if (d6 >= 0.f && d5 <= d6) {
+                SetGjkVertex(c, simplex, weights);
+                return;
+            }
+
+            const float vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+                SetGjkEdge(a, c, d2 / (d2 - d6), simplex, weights);
+                return;
+            }
+
+            const float va = d3 * d6 - d5 * d4;
+            if (va <= 0.f && d4 - d3 >= 0.f && d5 - d6 >= 0.f) {
+                SetGjkEdge(b, c, (d4 - d3) / ((d4 - d3) + (d5 - d6)), simplex, weights);
+                return;
+            }
+
+            const float area = va + vb + vc;
+            if (area <= std::numeric_limits<float>::min()) {
+                // Degenerate triangle, its longest edge covers it
+                const float lengths[3] = {ab.GetSquaredLength(), ac.GetSquaredLength(),
+                                          (c.point - b.point).GetSquaredLength()};
+                if (lengths[0] >= lengths[1] && lengths[0] >= lengths[2]) {
+                    ReduceGjkSegment(a, b, simplex, weights);
+                } else if (lengths[1] >= lengths[2]) {
+                    ReduceGjkSegment(a, c, simplex, weights);
+                } else {
+                    ReduceGjkSegment(b, c, simplex, weights);
+                }
+
+                return;
+            }
+
+            simplex.vertices[0] = a;
+            simplex.vertices[1] = b;
+            simplex.vertices[2] = c;
+            simplex.count = 3;
+            weights[1] = vb / area;
+            weights[2] = vc / area;
+            weights[0] = 1.f - weights[1] - weights[2];
+        }
+
+        /**
+         * @brief Reduces a tetrahedron to its face closest to the origin, or keeps it whole if it encloses the origin.
+         */
+        inline void ReduceGjkTetrahedron(GjkSimplex& simplex, std::array<float, 4>& weights) {
+            constexpr std::size_t Faces[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0}};
+
+            const std::array<GjkSupportPoint, 4> vertices = simplex.vertices;
+            float bestSquaredDistance = std::numeric_limits<float>::infinity();
+            bool enclosed = true;
+
+            for (const auto& face : Faces) {
+                const Vector3& a = vertices[face[0]].point;
+                const Vector3 normal = (vertices[face[1]].point - a).Cross(vertices[face[2]].point - a);
+
+                // Faces having the origin and the opposite vertex on the same side don't see the origin, a flat
+                // tetrahedron sees it from all of its faces
+                if (-a.Dot(normal) * (vertices[face[3]].point - a).Dot(normal) > 0.f) {
+                    continue;
+                }
+
+                enclosed = false;
+
+                GjkSimplex faceSimplex;
+                std::array<float, 4> faceWeights;
+                ReduceGjkTriangle(vertices[face[0]], vertices[face[1]], vertices[face[2]], faceSimplex, faceWeights);
+
+                Vector3 closest = Vector3::Zero();
+                for (std::size_t i = 0; i < faceSimplex.count; ++i) {
+                    closest += faceSimplex.vertices[i].point * faceWeights[i];
+                }
+
+                if (closest.GetSquaredLength() < bestSquaredDistance) {
+                    bestSquaredDistance = closest.GetSquaredLength();
+                    simplex = faceSimplex;
+                    weights = faceWeights;
+                }
+            }
+
+            if (enclosed) {
+                simplex.count = 4;
+            }
+        }
+
+        /**
+         * @brief Adds vertices to a degenerate simplex enclosing the origin until it becomes a tetrahedron.
+         * @return False if the Minkowski difference is flat.
+         */
+        template <typename SupportA, typename SupportB>
+        bool ExpandEpaSimplex(SupportA& supportA, SupportB& supportB, SmallVector<GjkSupportPoint, 32>& vertices) {
+            constexpr float MinDistance = 1e-5f;
+            constexpr Vector3 Axes[3] = {Vector3::UnitX(), Vector3::UnitY(), Vector3::UnitZ()};
+
+            while (vertices.size() < 4) {
+                const Vector3& origin = vertices[0].point;
+
+                // Directions away from the current affine hull of the simplex
+                Vector3 hullDirection = Vector3::Zero();
+                SmallVector<Vector3, 6> directions;
+                if (vertices.size() == 1) {
+                    for (const Vector3& axis : Axes) {
+                        directions.push_back(axis);
+                        directions.push_back(-axis);
+                    }
+                } else if (vertices.size() == 2) {
+                    hullDirection = vertices[1].point - origin;
+                    for (const Vector3& axis : Axes) {
+                        directions.push_back(hullDirection.Cross(axis));
+                        directions.push_back(-hullDirection.Cross(axis));
+                    }
+                } else {
+                    hullDirection = (vertices[1].point - origin).Cross(vertices[2].point - origin);
+                    directions.push_back(hullDirection);
+                    directions.push_back(-hullDirection);
+                }
+
+                float bestDistance = MinDistance;
+                std::optional<GjkSupportPoint> bestVertex;
+                for (const Vector3& direction : directions) {
+                    if (direction.GetSquaredLength() <= std::numeric_limits<float>::min()) {
+                        continue;
+                    }
+
+                    const GjkSupportPoint vertex = ComputeSupportPoint(supportA, supportB, direction);
+                    const Vector3 offset = vertex.point - origin;
+
+                    float distance;
+                    if (vertices.size() == 1) {
+                        distance = offset.GetLength();
+                    } else if (vertices.size() == 2) {
+                        distance = offset.Cross(hullDirection).GetLength() / hullDirection.GetLength();
+                    } else {
+                        distance = std::abs(offset.Dot(hullDirection)) / hullDirection.GetLength();
+                    }
+
+                    if (distance > bestDistance) {
+                        bestDistance = distance;
+                        bestVertex = vertex;
+                    }
+                }
+
+                if (!bestVertex) {
+                    return false;
+                }
+
+                vertices.push_back(*bestVertex);
+            }
+
+            return true;
+        }
+
+        inline EpaFace MakeEpaFace(const SmallVector<GjkSupportPoint, 32>& vertices, const UInt32 a, const UInt32 b,
+                                   const UInt32 c) {
+            EpaFace face{{a, b, c}, Vector3::Zero(), std::numeric_limits<float>::infinity()};
+
+            // Degenerate faces are never expanded
+            const Vector3 normal = (vertices[b].point - vertices[a].point).Cross(vertices[c].point - vertices[a].point);
+            const float length = normal.GetLength();
+            if (length > std::numeric_limits<float>::min()) {
+                face.normal = normal / length;
+                face.distance = face.normal.Dot(vertices[a].point);
+            }
+
+            return face;
+        }
+
+        inline void AddHorizonEdge(SmallVector<std::pair<UInt32, UInt32>, 32>& edges, const UInt32 a, const UInt32 b) {
+            // An edge shared by two removed faces is inside the hole, it appears once in each direction
+            for (std::size_t i = 0; i < edges.size(); ++i) {
+                if (edges[i].first == b && edges[i].second == a) {
+                    edges[i] = edges.back();
+                    edges.pop_back();
+                    return;
+                }
+            }
+
+            edges.emplace_back(a, b);
+        }
+    } // namespace Detail
+
+    template <typename SupportA, typename SupportB>
+    GjkResult ComputeGjkDistance(SupportA&& supportA, SupportB&& supportB, const Vector3& initialDirection) {
+        constexpr std::size_t MaxIterations = 64;
+        constexpr float RelativeTolerance = 1e-6f;
+        constexpr float SquaredOverlapDistance = 1e-10f;
+
+        GjkResult result;
+        GjkSimplex& simplex = result.simplex;
+        std::array<float, 4> weights = {1.f};
+
+        const Vector3 direction = (initialDirection.GetSquaredLength() > 0.f) ? initialDirection : Vector3::UnitX();
+        simplex.vertices[0] = Detail::ComputeSupportPoint(supportA, supportB, direction);
+        simplex.count = 1;
+
+        Vector3 closest = simplex.vertices[0].point;
+        float squaredDistance = closest.GetSquaredLength();
+        result.overlapping = false;
+
+        for (std::size_t iteration = 0; iteration < MaxIterations; ++iteration) {
+            if (squaredDistance <= SquaredOverlapDistance) {
+                result.overlapping = true;
+                break;
+            }
+
+            // The vertex farthest toward the origin must bring the simplex closer to it, or we found the closest point
+            const GjkSupportPoint vertex = Detail::ComputeSupportPoint(supportA, supportB, -closest);
+            if (squaredDistance - closest.Dot(vertex.point) <= RelativeTolerance * squaredDistance) {
+                break;
+            }
+
+            bool duplicate = false;
+            for (std::size_t i = 0; i < simplex.count; ++i) {
+                duplicate |= (simplex.vertices[i].point - vertex.point).GetSquaredLength() <= SquaredOverlapDistance;
+            }
+
+            if (duplicate) {
+                break;
+            }
+
+            simplex.vertices[simplex.count++] = vertex;
+            switch (simplex.count) {
+                case 2:
+                    Detail::ReduceGjkSegment(simplex.vertices[0], simplex.vertices[1], simplex, weights);
+                    break;
+
+                case 3:
+                    Detail::ReduceGjkTriangle(simplex.vertices[0], simplex.vertices[1], simplex.vertices[2], simplex,
+                                              weights);
+                    break;
+
+                default:
+                    Detail::ReduceGjkTetrahedron(simplex, weights);
+                    break;
+            }
+
+            if (simplex.count == 4) {
+                result.overlapping = true;
+                break;
+            }
+
+            closest = Vector3::Zero();
+            for (std::size_t i = 0; i < simplex.count; ++i) {
+                closest += simplex.vertices[i].point * weights[i];
+            }
+
+            // Rounding errors may stop the distance from decreasing
+            const float previousSquaredDistance = squaredDistance;
+            squaredDistance = closest.GetSquaredLength();
+            if (squaredDistance >= previousSquaredDistance) {
+                break;
+            }
+        }
+
+        result.pointA = Vector3::Zero();
+        result.pointB = Vector3::Zero();
+        if (result.overlapping) {
+            result.distance = 0.f;
+            return result;
+        }
+
+        for (std::size_t i = 0; i < simplex.count; ++i) {
+            result.pointA += simplex.vertices[i].pointA * weights[i];
+            result.pointB += simplex.vertices[i].pointB * weights[i];
+        }
+
+        result.distance = std::sqrt(squaredDistance);
+        return result;
+    }
+
+    template <typename SupportA, typename SupportB>
+    std::optional<EpaResult> ComputeEpaPenetration(SupportA&& supportA, SupportB&& supportB,
+                                                   const GjkSimplex& simplex) {
+        constexpr std::size_t MaxIterations = 64;
+        constexpr float Tolerance = 1e-4f;
+
+        const auto simplexEnd = simplex.vertices.begin() + static_cast<std::ptrdiff_t>(simplex.count);
+        SmallVector<GjkSupportPoint, 32> vertices(simplex.vertices.begin(), simplexEnd);
+        if (!Detail::ExpandEpaSimplex(supportA, supportB, vertices)) {
+            return std::nullopt;
+        }
+
+        // Starting tetrahedron, its faces wound to face away from its center
+        const Vector3 center = (vertices[0].point + vertices[1].point + vertices[2].point + vertices[3].point) * 0.25f;
+        const bool flipped = (vertices[1].point - vertices[0].point)
+                                 .Cross(vertices[2].point - vertices[0].point)
+                                 .Dot(vertices[0].point - center) < 0.f;
+
+        SmallVector<Detail::EpaFace, 64> faces;
+        constexpr UInt32 Tetrahedron[4][3] = {{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}};
+        for (const auto& face : Tetrahedron) {
+            faces.push_back(flipped ? Detail::MakeEpaFace(vertices, face[0], face[2], face[1])
+                                    : Detail::MakeEpaFace(vertices, face[0], face[1], face[2]));
+        }
+
+        SmallVector<std::pair<UInt32, UInt32>, 32> horizon;
+        std::size_t bestFace = 0;
+        for (std::size_t iteration = 0;; ++iteration) {
+            bestFace = 0;
+            for (std::size_t i = 1; i < faces.size(); ++i) {
+                if (faces[i].distance < faces[bestFace].distance) {
+                    bestFace = i;
+                }
+            }
+
+            // The face closest to the origin can't be pushed further, it is on the boundary of the difference
+            const Detail::EpaFace face = faces[bestFace];
+            const GjkSupportPoint vertex = Detail::ComputeSupportPoint(supportA, supportB, face.normal);
+            if (iteration == MaxIterations || vertex.point.Dot(face.normal) - face.distance <= Tolerance) {
+                break;
+            }
+
+            // Faces seen from the new vertex are replaced by a fan joining it to their outline
+            const auto vertexIndex = static_cast<UInt32>(vertices.size());
+            vertices.push_back(vertex);
+
+            horizon.clear();
+            for (std::size_t i = 0; i < faces.size();) {
+                const Detail::EpaFace& candidate = faces[i];
+                if (candidate.normal.Dot(vertex.point - vertices[candidate.indices[0]].point) <= 0.f) {
+                    ++i;
+                    continue;
+                }
+
+                for (std::size_t edge = 0; edge < 3; ++edge) {
+                    Detail::AddHorizonEdge(horizon, candidate.indices[edge], candidate.indices[(edge + 1) % 3]);
+                }
+
+                faces[i] = faces.back();
+                faces.pop_back();
+            }
+
+            for (const auto& [first, second] : horizon) {
+                faces.push_back(Detail::MakeEpaFace(vertices, first, second, vertexIndex));
+            }
+
+            if (faces.empty()) {
+                return std::nullopt;
+            }
+        }
+
+        const Detail::EpaFace& face = faces[bestFace];
+        if (face.distance == std::numeric_limits<float>::infinity()) {
+            return std::nullopt;
+        }
+
+        // Barycentric coordinates of the origin projected on the face
+        const GjkSupportPoint& a = vertices[face.indices[0]];
+        const GjkSupportPoint& b = vertices[face.indices[1]];
+        const GjkSupportPoint& c = vertices[face.indices[2]];
+
+        const Vector3 ab = b.point - a.point;
+        const Vector3 ac = c.point - a.point;
+        const Vector3 ap = face.normal * face.distance - a.point;
+        const float d00 = ab.Dot(ab);
+        const float d01 = ab.Dot(ac);
+        const float d11 = ac.Dot(ac);
+        const float d20 = ap.Dot(ab);
+        const float d21 = ap.Dot(ac);
+        const float denominator = d00 * d11 - d01 * d01;
+
+        const float v = (d11 * d20 - d01 * d21) / denominator;
+        const float w = (d00 * d21 - d01 * d20) / denominator;
+        const float u = 1.f - v - w;
+
+        EpaResult result;
+        result.normal = face.normal;
+        result.pointA = a.pointA * u + b.pointA * v + c.pointA * w;
+        result.pointB = a.pointB * u + b.pointB * v + c.pointB * w;
+        result.depth = std::max(face.distance, 0.f);
+
+        return result;
+    }
+} // namespace Fl
@@ -0,0 +1,198 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_ISLANDSOLVER_HPP
+#define FL_PHYSICS_ISLANDSOLVER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Quaternion.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+#include <FlashlightEngine/Physics/ContactManifold.hpp>
+
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Dynamic state and mass properties of a rigid body, as seen by the solver.
+     */
+    struct RigidBody {
+        Vector3 position = Vector3::Zero();
+        Quaternion rotation = Quaternion::Identity();
+        Vector3 linearVelocity = Vector3::Zero();
+        Vector3 angularVelocity = Vector3::Zero();
+        Vector3 inverseInertia = Vector3::Zero(); //< Inverse of the principal moments of inertia, in local space
+        float inverseMass = 0.f; //< Zero for static bodies
+        float friction = 0.5f;
+        float restitution = 0.f;
+
+        inline bool IsStatic() const;
+    };
+
+    /**
+     * @brief Projected Gauss-Seidel contact solver working island by island.
+     *
+     * Dynamic bodies are split in islands, the groups of bodies touching each other directly or through other dynamic
+     * bodies, with a union-find over the contact manifolds. Static bodies don't join islands. Islands are independent
+     * and solved in parallel, each iterating over its contacts with warm started impulses, then integrating its bodies.
+     *
+     * Contacts of an island are greedily colored so that no two contacts of a color share a dynamic body. A color is
+     * solved SimdFloat4::Width contacts at a time, and large islands spread the batches of each color over the thread
+     * pool. Colors and batches only depend on the bodies and the manifolds, never on the threads, which makes the
+     * results the same whatever the thread pool.
+     *
+     * An island whose bodies all stayed still long enough falls asleep: it keeps its bodies and costs nothing until an
+     * awake body touches one of them or it is woken explicitly.
+     */
+    class FL_API IslandSolver {
+    public:
+        static constexpr std::size_t MaxColors = 64; //< Contacts past the last color are solved one by one
+
+        struct Settings {
+            Vector3 gravity = Vector3(0.f, -9.81f, 0.f);
+            UInt32 velocityIterations = 8;
+            UInt32 largeIslandContactCount = 128; //< Islands with more contacts are solved on the thread pool
+            float baumgarteFactor = 0.2f; //< Fraction of the penetration removed each step
+            float linearSlop = 0.005f; //< Penetration left uncorrected, avoiding jitter of resting contacts
+            float restitutionThreshold = 1.f; //< Approach speed under which contacts don't bounce
+            float sleepLinearVelocity = 0.05f;
+            float sleepAngularVelocity = 0.05f;
+            float timeToSleep = 0.5f; //< Time an island must stay under the sleep velocities to fall asleep
+        };
+
+        struct Statistics {
+            std::size_t awakeBodyCount;
+            std::size_t islandCount; //< Awake islands
+            std::size_t largeIslandCount;
+            std::size_t sleepingIslandCount;
+            std::size_t contactCount; //< Manifolds solved
+            std::size_t colorCount; //< Highest number of colors of an island
+            std::size_t batchCount;
+        };
+
+        IslandSolver();
+        explicit IslandSolver(const Settings& settings);
+        IslandSolver(const IslandSolver&) = default;
+        IslandSolver(IslandSolver&&) noexcept = default;
+        ~IslandSolver() = default;
+
+        const Settings& GetSettings() const;
+        /**
+         * @brief Gets statistics on the last step.
+         */
+        const Statistics& GetStatistics() const;
+
+        /**
+         * @brief Checks whether a body belongs to a sleeping island.
+         * @remark Static bodies and bodies the solver didn't step yet are never sleeping. Pairs of bodies which are
+         *         each either sleeping or static can be skipped by the narrowphase.
+         */
+        bool IsSleeping(UInt32 body) const;
+
+        /**
+         * @brief Steps the bodies, solving their contacts.
+         * @param bodies Bodies, indexed by the manifolds. Bodies can be added between steps but not removed.
+         * @param manifolds Manifolds of the touching pairs, their impulses are read to warm start and written back.
+         * @param deltaTime Duration of the step, in seconds.
+         * @param threadPool Thread pool to solve the islands on, nullptr to solve them on the calling thread. The
+         *                   results don't depend on it.
+         */
+        void Step(std::span<RigidBody> bodies, std::span<ContactManifold> manifolds, float deltaTime,
+                  ThreadPool* threadPool = nullptr);
+
+        /**
+         * @brief Wakes the island of a body, if it's sleeping.
+         */
+        void WakeBody(UInt32 body);
+
+        IslandSolver& operator=(const IslandSolver&) = default;
+        IslandSolver& operator=(IslandSolver&&) noexcept = default;
+
+    private:
+        static constexpr std::size_t Width = SimdFloat4::Width;
+        static constexpr std::size_t RowCount = 3; //< Normal, then the two tangents
+        static constexpr UInt32 InvalidIsland = std::numeric_limits<UInt32>::max();
+
+        // Up to Width contacts of a color, in structure of arrays form. Points and lanes past the used ones have a
+        // zero mass, which makes their impulses zero
+        struct alignas(16) Batch {
+            float directions[RowCount][3][Width];
+            float angularA[ContactManifold::MaxPoints][RowCount][3][Width]; //< rA x direction
+            float angularB[ContactManifold::MaxPoints][RowCount][3][Width];
+            float inertiaAngularA[ContactManifold::MaxPoints][RowCount][3][Width]; //< Inverse inertia * angularA
+            float inertiaAngularB[ContactManifold::MaxPoints][RowCount][3][Width];
+            float masses[ContactManifold::MaxPoints][RowCount][Width];
+            float impulses[ContactManifold::MaxPoints][RowCount][Width];
+            float biases[ContactManifold::MaxPoints][Width];
+            float inverseMassA[Width];
+            float inverseMassB[Width];
+            float friction[Width];
+            UInt32 bodyA[Width];
+            UInt32 bodyB[Width];
+            UInt32 manifoldIndices[Width];
+            UInt32 laneCount;
+            UInt32 pointCount; //< Highest point count of the lanes
+
+            void Prepare(std::span<const RigidBody> bodies, std::span<const ContactManifold> manifolds,
+                         const Settings& settings, float deltaTime);
+            void Solve(std::span<RigidBody> bodies);
+            void StoreImpulses(std::span<ContactManifold> manifolds) const;
+            void WarmStart(std::span<RigidBody> bodies) const;
+        };
+
+        struct Color {
+            UInt32 firstBatch;
+            UInt32 batchCount;
+            bool isSequential; //< Batches of the last color may share bodies
+        };
+
+        struct Island {
+            UInt32 firstBody;
+            UInt32 bodyCount;
+            UInt32 firstContact;
+            UInt32 contactCount;
+            UInt32 firstColor;
+            UInt32 colorCount;
+            UInt32 firstBatch;
+            UInt32 batchCount;
+            bool fallsAsleep;
+        };
+
+        void BuildIslands(std::span<const RigidBody> bodies, std::span<const ContactManifold> manifolds);
+        void ColorIslands(std::span<const RigidBody> bodies, std::span<const ContactManifold> manifolds);
+        inline bool IsAwakeDynamic(std::span<const RigidBody> bodies, UInt32 body) const;
+        void PutIslandsToSleep(std::span<RigidBody> bodies);
+        void SolveIsland(Island& island, std::span<RigidBody> bodies, std::span<ContactManifold> manifolds,
+                         float deltaTime, ThreadPool* threadPool);
+        void WakeIsland(UInt32 sleepingIsland);
+        void WakeTouchedIslands(std::span<const RigidBody> bodies, std::span<const ContactManifold> manifolds);
+
+        std::vector<Batch> m_batches;
+        std::vector<Color> m_colors;
+        std::vector<Island> m_islands;
+        std::vector<std::vector<UInt32>> m_sleepingIslands; //< Bodies of each sleeping island
+        std::vector<UInt32> m_freeSleepingIslands;
+        std::vector<UInt32> m_awakeBodies;
+        std::vector<UInt32> m_bodySleepingIslands; //< Sleeping island of each body, or InvalidIsland
+        std::vector<UInt32> m_bodyIslands; //< Awake island of each awake body, valid during a step
+        std::vector<UInt32> m_islandBodies;
+        std::vector<UInt32> m_islandContacts; //< Manifolds of the islands
+        std::vector<UInt32> m_parents; //< Union-find forest over the awake bodies
+        std::vector<UInt64> m_colorMasks; //< Colors used by the contacts of each body
+        std::vector<UInt8> m_contactColors;
+        std::vector<float> m_sleepTimers;
+        Settings m_settings;
+        Statistics m_statistics;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/IslandSolver.inl>
+
+#endif // FL_PHYSICS_ISLANDSOLVER_HPP
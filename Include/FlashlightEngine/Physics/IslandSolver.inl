@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/IslandSolver.hpp>
+
+namespace Fl {
+    inline bool RigidBody::IsStatic() const {
+        return inverseMass == 0.f;
+    }
+
+    inline bool IslandSolver::IsAwakeDynamic(const std::span<const RigidBody> bodies, const UInt32 body) const {
+        return !bodies[body].IsStatic() && m_bodySleepingIslands[body] == InvalidIsland;
+    }
+} // namespace Fl
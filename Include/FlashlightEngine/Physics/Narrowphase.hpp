@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_NARROWPHASE_HPP
+#define FL_PHYSICS_NARROWPHASE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Physics/Broadphase.hpp>
+#include <FlashlightEngine/Physics/ContactManifold.hpp>
+#include <FlashlightEngine/Physics/Shape.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Placed shape of a body, as seen by the narrowphase.
+     */
+    struct CollisionBody {
+        const Shape* shape; //< Shape of the body, null for unused body slots
+        Vector3 position;
+        Quaternion rotation;
+    };
+
+    /**
+     * @brief Computes the contact manifolds of the pairs found by a broadphase.
+     *
+     * Pairs are first grouped by the shape types of their bodies, then each group is handed to the collision routine
+     * of its type pair, picked from a table built at compile time. Spheres against spheres, capsules and boxes are
+     * collided SimdFloat4::Width pairs at a time. Other pairs run GJK and EPA on the core shapes, then clip the
+     * features of both shapes facing each other to build a manifold of up to four points in a single step.
+     *
+     * Manifolds persist from one step to the next: new points close to a point of the previous step of the same pair
+     * take its feature identifier and its impulses, so that the solver can warm start from them.
+     */
+    class FL_API Narrowphase {
+    public:
+        static constexpr std::size_t BatchSize = 64;
+        static constexpr std::size_t ShapeTypeCount = EnumValueCount_v<ShapeType>;
+
+        /**
+         * @param contactMargin Distance under which surfaces apart from each other still generate contact points.
+         */
+        explicit Narrowphase(float contactMargin = 0.02f);
+        Narrowphase(const Narrowphase&) = default;
+        Narrowphase(Narrowphase&&) noexcept = default;
+        ~Narrowphase() = default;
+
+        /**
+         * @brief Computes the contact manifolds of a set of pairs, replacing those of the previous call.
+         * @param bodies Bodies, indexed by the pairs.
+         * @param pairs Pairs to collide, sorted by key as FindPairs() returns them.
+         * @param threadPool Thread pool to collide the pairs on, nullptr to collide them on the calling thread. The
+         *                   manifolds don't depend on it.
+         */
+        void Collide(std::span<const CollisionBody> bodies, std::span<const BroadphasePair> pairs,
+                     ThreadPool* threadPool = nullptr);
+
+        /**
+         * @brief Finds the manifold of a pair of bodies.
+         * @return Manifold of the pair, or nullptr if its bodies don't touch.
+         */
+        const ContactManifold* FindManifold(UInt32 bodyA, UInt32 bodyB) const;
+
+        float GetContactMargin() const;
+        /**
+         * @brief Gets the manifolds of the touching pairs, sorted by key.
+         * @remark Impulses written in the manifolds are used to warm start the next step.
+         */
+        std::span<ContactManifold> GetManifolds();
+        std::span<const ContactManifold> GetManifolds() const;
+
+        /**
+         * @brief Gets the type of a shape from its class identifier.
+         */
+        static ShapeType GetShapeType(const Shape& shape);
+
+        Narrowphase& operator=(const Narrowphase&) = default;
+        Narrowphase& operator=(Narrowphase&&) noexcept = default;
+
+    private:
+        void BuildTasks(std::span<const CollisionBody> bodies, std::span<const BroadphasePair> pairs);
+        void MatchPreviousManifolds(std::span<const BroadphasePair> pairs);
+        void WarmStart(std::size_t firstTask, std::size_t lastTask);
+
+        std::array<UInt32, ShapeTypeCount * ShapeTypeCount + 1> m_groupOffsets;
+        std::vector<BroadphasePair> m_tasks; //< Pairs grouped by type pair, bodies ordered by shape type
+        std::vector<ContactManifold> m_manifolds;
+        std::vector<ContactManifold> m_pairManifolds;
+        std::vector<ContactManifold> m_previousManifolds;
+        std::vector<UInt32> m_previousIndices; //< Previous manifold of each pair
+        std::vector<UInt32> m_taskPairs; //< Pair collided by each task
+        float m_contactMargin;
+    };
+} // namespace Fl
+
+#endif // FL_PHYSICS_NARROWPHASE_HPP
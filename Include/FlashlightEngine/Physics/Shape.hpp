@@ -0,0 +1,79 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_SHAPE_HPP
+#define FL_PHYSICS_SHAPE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/BaseObject.hpp>
+#include <FlashlightEngine/Math/Aabb.hpp>
+#include <FlashlightEngine/Math/Quaternion.hpp>
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+namespace Fl {
+    /**
+     * @brief Collision shape types known by the narrowphase, in the order of its dispatch tables.
+     */
+    enum class ShapeType {
+        Sphere,
+        Capsule,
+        Box,
+        ConvexHull,
+
+        Max = ConvexHull
+    };
+
+    /**
+     * @brief Points of a core shape farthest along a direction, forming a vertex, an edge or a face.
+     */
+    using ShapeFeature = SmallVector<Vector3, 8>;
+
+    /**
+     * @brief Base class of the convex collision shapes.
+     *
+     * Shapes are described as a core shape (a point, a segment, a box or a hull) inflated by a rounding radius, which
+     * is what the GJK based collision routines expect. Each shape type identifies itself with the class ID given by
+     * BaseObject::GetInfo(), the narrowphase uses it to pick the collision routine of a pair without a virtual call.
+     *
+     * Concrete shapes expose the non-virtual GetSupport(), GetSupportingFeature() and GetRoundingRadius() used by
+     * the collision routines, which are instantiated for each pair of shape types.
+     */
+    class FL_API Shape : public BaseObject {
+    public:
+        /**
+         * @brief Tolerance below which a direction is considered aligned with an edge or a face, relative to the extent
+         *        of the shape along the direction.
+         */
+        static constexpr float FeatureTolerance = 0.05f;
+
+        ~Shape() override = default;
+
+        /**
+         * @brief Computes the bounds of the shape placed in the world.
+         * @param position Position of the shape origin.
+         * @param rotation Rotation of the shape.
+         * @return World bounds.
+         */
+        virtual Aabb ComputeBounds(const Vector3& position, const Quaternion& rotation) const = 0;
+
+        inline UInt64 GetClassId() const;
+
+    protected:
+        inline explicit Shape(UInt64 classId);
+        Shape(const Shape&) = default;
+        Shape(Shape&&) noexcept = default;
+
+        Shape& operator=(const Shape&) = default;
+        Shape& operator=(Shape&&) noexcept = default;
+
+    private:
+        UInt64 m_classId;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/Shape.inl>
+
+#endif // FL_PHYSICS_SHAPE_HPP
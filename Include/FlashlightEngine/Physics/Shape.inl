@@ -0,0 +1,17 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/Shape.hpp>
+
+namespace Fl {
+    inline UInt64 Shape::GetClassId() const {
+        return m_classId;
+    }
+
+    inline Shape::Shape(const UInt64 classId) :
+    m_classId(classId) {
+    }
+} // namespace Fl
@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_PHYSICS_SPHERESHAPE_HPP
+#define FL_PHYSICS_SPHERESHAPE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Physics/Shape.hpp>
+
+namespace Fl {
+    /**
+     * @brief Sphere centered on the shape origin: a point core inflated by the radius.
+     */
+    class FL_API SphereShape final : public Shape {
+    public:
+        static constexpr ShapeType Type = ShapeType::Sphere;
+
+        explicit SphereShape(float radius);
+        SphereShape(const SphereShape&) = default;
+        SphereShape(SphereShape&&) noexcept = default;
+        ~SphereShape() override = default;
+
+        Aabb ComputeBounds(const Vector3& position, const Quaternion& rotation) const override;
+
+        inline float GetRadius() const;
+        inline float GetRoundingRadius() const;
+        /**
+         * @brief Gets the point of the core shape farthest along a direction, in local space.
+         */
+        inline Vector3 GetSupport(const Vector3& direction) const;
+        /**
+         * @brief Gets the points of the core shape farthest along a direction, in local space.
+         * @param direction Direction, not necessarily normalized.
+         * @param feature Receives the points, forming a vertex, an edge or a face.
+         */
+        inline void GetSupportingFeature(const Vector3& direction, ShapeFeature& feature) const;
+
+        SphereShape& operator=(const SphereShape&) = default;
+        SphereShape& operator=(SphereShape&&) noexcept = default;
+
+    private:
+        float m_radius;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Physics/SphereShape.inl>
+
+#endif // FL_PHYSICS_SPHERESHAPE_HPP
@@ -0,0 +1,26 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Physics/SphereShape.hpp>
+
+namespace Fl {
+    inline float SphereShape::GetRadius() const {
+        return m_radius;
+    }
+
+    inline float SphereShape::GetRoundingRadius() const {
+        return m_radius;
+    }
+
+    inline Vector3 SphereShape::GetSupport(const Vector3&) const {
+        return Vector3::Zero();
+    }
+
+    inline void SphereShape::GetSupportingFeature(const Vector3&, ShapeFeature& feature) const {
+        feature.clear();
+        feature.push_back(Vector3::Zero());
+    }
+} // namespace Fl
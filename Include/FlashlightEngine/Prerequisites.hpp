@@ -483,6 +483,13 @@ namespace Fl {
     using Float32 = float;
     using Float64 = double;
 
+    // Used to align data accessed by different threads on separate cache lines (to prevent false sharing)
+#if defined(FL_ARCH_aarch64) && (defined(FL_PLATFORM_MACOS) || defined(FL_PLATFORM_IOS))
+    constexpr std::size_t CacheLineSize = 128;
+#else
+    constexpr std::size_t CacheLineSize = 64;
+#endif
+
     struct UnreachableError {};
 
     FL_API bool IsDebuggerAttached();
@@ -0,0 +1,100 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_RENDERER_FRAMEBUFFER_HPP
+#define FL_RENDERER_FRAMEBUFFER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Color.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    enum class ColorFormat {
+        RGBA8, //< 8 bits unsigned normalized per channel
+        BGRA8,
+        RGBA32F,
+
+        Max = RGBA32F
+    };
+
+    enum class DepthFormat {
+        D16, //< 16 bits unsigned normalized
+        D32F,
+
+        Max = D32F
+    };
+
+    /**
+     * @brief In-memory color and depth images, stored row by row and transferred to rasterizers tile by tile.
+     *
+     * Rasterizers work on tiles in a single floating-point layout, one plane per channel, whatever the formats of the
+     * framebuffer. Formats are only involved when a tile is loaded from or stored to the framebuffer.
+     */
+    class FL_API Framebuffer {
+    public:
+        static constexpr UInt32 TileSize = 64;
+
+        /**
+         * @brief Tile of the framebuffer, in planes of TileSize rows of TileSize pixels.
+         */
+        struct alignas(16) Tile {
+            float colors[4][TileSize * TileSize]; //< Red, green, blue and alpha planes
+            float depths[TileSize * TileSize];
+        };
+
+        Framebuffer(UInt32 width, UInt32 height, ColorFormat colorFormat = ColorFormat::RGBA8,
+                    DepthFormat depthFormat = DepthFormat::D32F);
+        Framebuffer(const Framebuffer&) = default;
+        Framebuffer(Framebuffer&&) noexcept = default;
+        ~Framebuffer() = default;
+
+        void Clear(const Color& color, float depth = 1.f);
+
+        Color GetColor(UInt32 x, UInt32 y) const;
+        std::span<const UInt8> GetColorData() const;
+        ColorFormat GetColorFormat() const;
+        float GetDepth(UInt32 x, UInt32 y) const;
+        std::span<const UInt8> GetDepthData() const;
+        DepthFormat GetDepthFormat() const;
+        UInt32 GetHeight() const;
+        UInt32 GetTileCountX() const;
+        UInt32 GetTileCountY() const;
+        UInt32 GetWidth() const;
+
+        /**
+         * @brief Converts a tile of the framebuffer to the floating-point layout.
+         * @remark Pixels of the tile past the framebuffer edges are left untouched.
+         */
+        void LoadTile(UInt32 tileX, UInt32 tileY, Tile& tile) const;
+
+        void SetColor(UInt32 x, UInt32 y, const Color& color);
+        void SetDepth(UInt32 x, UInt32 y, float depth);
+
+        /**
+         * @brief Converts a tile back to the formats of the framebuffer, clamping values to the representable range.
+         */
+        void StoreTile(UInt32 tileX, UInt32 tileY, const Tile& tile);
+
+        static std::size_t GetBytesPerPixel(ColorFormat format);
+        static std::size_t GetBytesPerPixel(DepthFormat format);
+
+        Framebuffer& operator=(const Framebuffer&) = default;
+        Framebuffer& operator=(Framebuffer&&) noexcept = default;
+
+    private:
+        std::vector<UInt8> m_colorData;
+        std::vector<UInt8> m_depthData;
+        ColorFormat m_colorFormat;
+        DepthFormat m_depthFormat;
+        UInt32 m_height;
+        UInt32 m_width;
+    };
+} // namespace Fl
+
+#endif // FL_RENDERER_FRAMEBUFFER_HPP
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_RENDERER_RENDERCOMMANDSTREAM_HPP
+#define FL_RENDERER_RENDERCOMMANDSTREAM_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <vector>
+
+namespace Fl {
+    enum class RenderCommandType {
+        BeginPass, //< Starts a pass of a layer, unbinding the material
+        SetMaterial,
+        Draw, //< Draws instances of a mesh with the current material
+
+        Max = Draw
+    };
+
+    /**
+     * @brief Backend-agnostic command, the fields a command type doesn't use being those of the previous command.
+     */
+    struct RenderCommand {
+        RenderCommandType type;
+        UInt8 layer;
+        UInt8 pass;
+        UInt16 material;
+        UInt16 mesh;
+        UInt32 firstInstance; //< Into RenderCommandStream::instances
+        UInt32 instanceCount;
+    };
+
+    /**
+     * @brief Commands replayed by a backend in order, and the instances the draws refer to.
+     */
+    struct RenderCommandStream {
+        std::vector<RenderCommand> commands;
+        std::vector<UInt32> instances; //< Instance data indices given when recording the draws
+
+        inline void Clear();
+    };
+
+    inline void RenderCommandStream::Clear() {
+        commands.clear();
+        instances.clear();
+    }
+} // namespace Fl
+
+#endif // FL_RENDERER_RENDERCOMMANDSTREAM_HPP
@@ -0,0 +1,55 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_RENDERER_RENDERKEY_HPP
+#define FL_RENDERER_RENDERKEY_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+namespace Fl {
+    enum class DepthOrder {
+        FrontToBack, //< Opaque draws, sorted by state first
+        BackToFront, //< Blended draws, sorted by depth first
+
+        Max = BackToFront
+    };
+
+    /**
+     * @brief Fields of a draw, packed into a 64-bit key whose integer order is the draw order.
+     *
+     * From the most significant bits, keys hold the layer (8 bits) and the pass (8 bits), then for FrontToBack passes
+     * the material, the mesh and the depth (16 bits each), and for BackToFront passes the reversed depth, the material
+     * and the mesh. Depth keeps the 16 most significant bits of its floating-point representation, whose integer
+     * order matches the order of positive floats.
+     */
+    struct RenderKey {
+        UInt8 layer;
+        UInt8 pass;
+        UInt16 material;
+        UInt16 mesh;
+        float depth; //< Positive distance to the camera
+
+        inline UInt64 Encode(DepthOrder depthOrder) const;
+
+        static inline RenderKey Decode(UInt64 key, DepthOrder depthOrder);
+        static inline UInt8 DecodeLayer(UInt64 key);
+        static inline UInt8 DecodePass(UInt64 key);
+        /**
+         * @brief Builds a key from wider integers, debug builds asserting that they fit their bit ranges.
+         */
+        static inline RenderKey Make(UInt32 layer, UInt32 pass, UInt32 material, UInt32 mesh, float depth);
+        /**
+         * @brief Gets the depth as stored in encoded keys.
+         * @param depth Positive distance to the camera.
+         * @return Depth rounded toward zero to 8 significant bits.
+         */
+        static inline float QuantizeDepth(float depth);
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Renderer/RenderKey.inl>
+
+#endif // FL_RENDERER_RENDERKEY_HPP
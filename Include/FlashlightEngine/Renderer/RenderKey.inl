@@ -0,0 +1,77 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Renderer/RenderKey.hpp>
+
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    namespace Detail {
+        inline UInt16 EncodeDepth(const float depth) {
+            FlAssertMsg(depth >= 0.f, "[Renderer/RenderKey] Depth must be positive.");
+
+            // Adding zero turns -0 into +0, whose sign bit would overflow the 16 bits
+            return SafeCast<UInt16>(BitCast<UInt32>(depth + 0.f) >> 16);
+        }
+
+        inline float DecodeDepth(const UInt16 bits) {
+            return BitCast<float>(static_cast<UInt32>(bits) << 16);
+        }
+    } // namespace Detail
+
+    inline UInt64 RenderKey::Encode(const DepthOrder depthOrder) const {
+        const UInt64 header = (static_cast<UInt64>(layer) << 56) | (static_cast<UInt64>(pass) << 48);
+        const UInt16 depthBits = Detail::EncodeDepth(depth);
+
+        if (depthOrder == DepthOrder::FrontToBack) {
+            return header | (static_cast<UInt64>(material) << 32) | (static_cast<UInt64>(mesh) << 16) | depthBits;
+        }
+
+        return header | (static_cast<UInt64>(static_cast<UInt16>(~depthBits)) << 32) |
+               (static_cast<UInt64>(material) << 16) | mesh;
+    }
+
+    inline RenderKey RenderKey::Decode(const UInt64 key, const DepthOrder depthOrder) {
+        const auto field = [key](const int shift) {
+            return static_cast<UInt16>(key >> shift);
+        };
+
+        RenderKey renderKey;
+        renderKey.layer = DecodeLayer(key);
+        renderKey.pass = DecodePass(key);
+
+        if (depthOrder == DepthOrder::FrontToBack) {
+            renderKey.material = field(32);
+            renderKey.mesh = field(16);
+            renderKey.depth = Detail::DecodeDepth(field(0));
+        } else {
+            renderKey.depth = Detail::DecodeDepth(static_cast<UInt16>(~field(32)));
+            renderKey.material = field(16);
+            renderKey.mesh = field(0);
+        }
+
+        return renderKey;
+    }
+
+    inline UInt8 RenderKey::DecodeLayer(const UInt64 key) {
+        return static_cast<UInt8>(key >> 56);
+    }
+
+    inline UInt8 RenderKey::DecodePass(const UInt64 key) {
+        return static_cast<UInt8>(key >> 48);
+    }
+
+    inline RenderKey RenderKey::Make(const UInt32 layer, const UInt32 pass, const UInt32 material, const UInt32 mesh,
+                                     const float depth) {
+        return RenderKey{SafeCast<UInt8>(layer), SafeCast<UInt8>(pass), SafeCast<UInt16>(material),
+                         SafeCast<UInt16>(mesh), depth};
+    }
+
+    inline float RenderKey::QuantizeDepth(const float depth) {
+        return Detail::DecodeDepth(Detail::EncodeDepth(depth));
+    }
+} // namespace Fl
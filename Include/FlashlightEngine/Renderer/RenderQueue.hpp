@@ -0,0 +1,139 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_RENDERER_RENDERQUEUE_HPP
+#define FL_RENDERER_RENDERQUEUE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Renderer/RenderCommandStream.hpp>
+#include <FlashlightEngine/Renderer/RenderKey.hpp>
+#include <FlashlightEngine/Utility/ScratchAllocator.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Draws recorded from several threads, sorted by key and replayed as a command stream.
+     *
+     * Every thread records into its own Recorder without synchronization. Sorting gathers the recorders in order and
+     * runs a parallel LSD radix sort on the 64-bit keys (see RadixSortByKey), one 8-bit digit per pass, skipping the
+     * digits shared by all the keys. The sort being stable, draws with the same key keep the order of their recorders,
+     * then their recording order. Its scratch memory comes from an arena reused from one frame to the next.
+     *
+     * Replaying walks the sorted draws once, emitting a command whenever the pass or the material changes and merging
+     * consecutive draws of the same mesh into a single instanced draw.
+     */
+    class FL_API RenderQueue {
+    public:
+        static constexpr std::size_t RecordBatchSize = 1024;
+
+        struct DrawItem {
+            UInt64 key;
+            UInt32 instance;
+        };
+
+        /**
+         * @brief Draws recorded by a single thread.
+         */
+        class Recorder {
+        public:
+            inline explicit Recorder(const RenderQueue& queue);
+
+            inline std::size_t GetItemCount() const;
+
+            /**
+             * @brief Records a draw, its key being encoded with the depth order of its pass.
+             * @param key Draw key.
+             * @param instance Index of the instance data of the draw, copied to the command stream.
+             */
+            inline void Push(const RenderKey& key, UInt32 instance);
+
+        private:
+            friend RenderQueue;
+
+            std::vector<DrawItem> m_items;
+            const RenderQueue* m_queue;
+        };
+
+        struct Statistics {
+            std::size_t itemCount;
+            std::size_t radixPassCount; //< Digits differing between keys, the others being skipped
+            std::size_t commandCount;
+            std::size_t drawCommandCount;
+            Clock::duration sortTime;
+            Clock::duration replayTime;
+        };
+
+        RenderQueue();
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue(RenderQueue&&) = delete; //< Recorders point to their queue
+        ~RenderQueue() = default;
+
+        /**
+         * @brief Removes the recorded and sorted draws, keeping the recorders and their memory.
+         */
+        void Clear();
+
+        inline DepthOrder GetDepthOrder(UInt8 pass) const;
+        /**
+         * @brief Gets a recorder, creating it and those before it if needed.
+         * @remark Not thread-safe, recorders must be created before recording from several threads.
+         */
+        Recorder& GetRecorder(std::size_t index);
+        inline std::size_t GetRecorderCount() const;
+        /**
+         * @brief Gets the draws sorted by the last Sort().
+         */
+        inline std::span<const DrawItem> GetSortedItems() const;
+        inline const Statistics& GetStatistics() const;
+
+        /**
+         * @brief Records draws in batches of RecordBatchSize, each batch recording into its own recorder.
+         * @param count Number of elements to record draws for.
+         * @param threadPool Thread pool processing the batches, or nullptr to record on the calling thread.
+         * @param func Function called as func(recorder, first, last) for each batch.
+         */
+        template <typename F>
+        void Record(std::size_t count, ThreadPool* threadPool, F&& func);
+
+        /**
+         * @brief Converts the draws sorted by the last Sort() to commands.
+         * @param stream Stream receiving the commands, cleared first.
+         */
+        void Replay(RenderCommandStream& stream);
+
+        /**
+         * @brief Sets how the draws of a pass are sorted.
+         * @remark Only affects the draws recorded afterward.
+         */
+        void SetDepthOrder(UInt8 pass, DepthOrder depthOrder);
+
+        /**
+         * @brief Gathers the draws of all recorders and sorts them by key.
+         * @param threadPool Thread pool to sort on, or nullptr to sort on the calling thread.
+         */
+        void Sort(ThreadPool* threadPool = nullptr);
+
+        RenderQueue& operator=(const RenderQueue&) = delete;
+        RenderQueue& operator=(RenderQueue&&) = delete;
+
+    private:
+        std::vector<Recorder> m_recorders;
+        std::vector<DrawItem> m_items;
+        std::array<DepthOrder, 256> m_depthOrders;
+        Statistics m_statistics;
+        ScratchBuffer m_scratchBuffer;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Renderer/RenderQueue.inl>
+
+#endif // FL_RENDERER_RENDERQUEUE_HPP
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Renderer/RenderQueue.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    inline RenderQueue::Recorder::Recorder(const RenderQueue& queue) :
+    m_queue(&queue) {
+    }
+
+    inline std::size_t RenderQueue::Recorder::GetItemCount() const {
+        return m_items.size();
+    }
+
+    inline void RenderQueue::Recorder::Push(const RenderKey& key, const UInt32 instance) {
+        m_items.push_back({key.Encode(m_queue->GetDepthOrder(key.pass)), instance});
+    }
+
+    inline DepthOrder RenderQueue::GetDepthOrder(const UInt8 pass) const {
+        return m_depthOrders[pass];
+    }
+
+    inline std::size_t RenderQueue::GetRecorderCount() const {
+        return m_recorders.size();
+    }
+
+    inline std::span<const RenderQueue::DrawItem> RenderQueue::GetSortedItems() const {
+        return m_items;
+    }
+
+    inline auto RenderQueue::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+
+    template <typename F>
+    void RenderQueue::Record(const std::size_t count, ThreadPool* threadPool, F&& func) {
+        const std::size_t batchCount = (count + RecordBatchSize - 1) / RecordBatchSize;
+        if (batchCount > m_recorders.size()) {
+            GetRecorder(batchCount - 1);
+        }
+
+        const auto recordBatch = [&](const std::size_t first, const std::size_t last) {
+            func(m_recorders[first / RecordBatchSize], first, last);
+        };
+
+        if (threadPool) {
+            threadPool->ParallelFor(count, RecordBatchSize, recordBatch);
+        } else {
+            for (std::size_t first = 0; first < count; first += RecordBatchSize) {
+                recordBatch(first, std::min(first + RecordBatchSize, count));
+            }
+        }
+    }
+} // namespace Fl
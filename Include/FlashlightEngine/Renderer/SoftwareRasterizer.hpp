@@ -0,0 +1,176 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_RENDERER_SOFTWARERASTERIZER_HPP
+#define FL_RENDERER_SOFTWARERASTERIZER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Renderer/Framebuffer.hpp>
+#include <FlashlightEngine/Utility/Delegate.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    enum class CullMode {
+        None,
+        Back, //< Triangles are front-facing when counter-clockwise in normalized device coordinates
+        Front,
+
+        Max = Front
+    };
+
+    /**
+     * @brief Triangle rasterizer running on the CPU, for machines without a GPU.
+     *
+     * A draw runs in three stages:
+     * - Vertices are shaded in parallel, each one giving a clip-space position (depth in [0, w]) and varyings.
+     * - Triangles are clipped against the near plane and a guard band, culled, set up and binned into the tiles of
+     *   the framebuffer they touch. Batches of triangles are set up in parallel, the bins keep the submission order.
+     * - Tiles are rasterized in parallel, each by a single thread, in the floating-point layout of Framebuffer::Tile.
+     *
+     * Edge functions are evaluated on SimdFloat4::Width pixels of a row at once. Vertices are snapped to 1/16 of a
+     * pixel and each edge is evaluated from the same endpoint by both triangles sharing it, which makes the edge
+     * functions of the two triangles exact opposites: with the top-left fill rule, meshes are drawn without gaps or
+     * overlaps. Depth is interpolated linearly in screen space, varyings are perspective-correct.
+     *
+     * Results don't depend on the thread pool.
+     */
+    class FL_API SoftwareRasterizer {
+    public:
+        static constexpr std::size_t MaxVaryings = 8;
+        static constexpr std::size_t SetupBatchSize = 256; //< Triangles set up by a thread at once
+
+        struct ClipVertex {
+            float x;
+            float y;
+            float z;
+            float w;
+            std::array<float, MaxVaryings> varyings;
+        };
+
+        /**
+         * @brief SimdFloat4::Width horizontally adjacent pixels of a triangle.
+         */
+        struct Fragments {
+            SimdFloat4 x; //< Pixel centers
+            SimdFloat4 y;
+            SimdFloat4 depth;
+            std::array<SimdFloat4, MaxVaryings> varyings;
+            int mask; //< Covered pixels passing the depth test, one bit per lane
+        };
+
+        struct FragmentColors {
+            SimdFloat4 r;
+            SimdFloat4 g;
+            SimdFloat4 b;
+            SimdFloat4 a;
+        };
+
+        using FragmentShader = Delegate<void(const Fragments& fragments, FragmentColors& colors)>;
+        using VertexShader = Delegate<void(UInt32 vertex, ClipVertex& output)>;
+
+        /**
+         * @brief Indexed triangle list and its shaders, called concurrently from several threads.
+         */
+        struct DrawCall {
+            std::span<const UInt32> indices;
+            UInt32 vertexCount = 0;
+            UInt32 varyingCount = 0;
+            VertexShader vertexShader;
+            FragmentShader fragmentShader;
+            CullMode cullMode = CullMode::Back;
+            bool depthTest = true; //< Fragments pass when closer than the stored depth
+            bool depthWrite = true;
+        };
+
+        struct Statistics {
+            std::size_t triangleCount;
+            std::size_t culledTriangleCount; //< Back-facing, degenerate, out of the screen or clipped away
+            std::size_t clippedTriangleCount; //< Triangles crossing the near plane or the guard band
+            std::size_t binnedTriangleCount; //< Sum over the tiles of the triangles binned into them
+            std::size_t tileCount; //< Tiles touched by at least one triangle
+        };
+
+        SoftwareRasterizer() = default;
+        SoftwareRasterizer(const SoftwareRasterizer&) = delete;
+        SoftwareRasterizer(SoftwareRasterizer&&) noexcept = default;
+        ~SoftwareRasterizer() = default;
+
+        /**
+         * @brief Draws triangles into a framebuffer, its whole surface being the viewport.
+         * @param framebuffer Framebuffer to draw into.
+         * @param drawCall Triangles to draw.
+         * @param threadPool Thread pool to draw on, nullptr to draw on the calling thread.
+         */
+        void Draw(Framebuffer& framebuffer, const DrawCall& drawCall, ThreadPool* threadPool = nullptr);
+
+        /**
+         * @brief Gets statistics on the last draw.
+         */
+        const Statistics& GetStatistics() const;
+
+        SoftwareRasterizer& operator=(const SoftwareRasterizer&) = delete;
+        SoftwareRasterizer& operator=(SoftwareRasterizer&&) noexcept = default;
+
+    private:
+        static constexpr std::size_t PlaneCount = 2 + MaxVaryings; //< Depth, 1/w, then the varyings divided by w
+
+        // Edge functions are A * (x - X) + B * (y - Y), positive inside, and interpolated values are planes
+        // value + dx * (x - referenceX) + dy * (y - referenceY)
+        struct TriangleSetup {
+            std::array<float, 3> edgeA;
+            std::array<float, 3> edgeB;
+            std::array<float, 3> edgeX;
+            std::array<float, 3> edgeY;
+            std::array<std::array<float, 3>, PlaneCount> planes; //< Value, d/dx and d/dy
+            float referenceX;
+            float referenceY;
+            UInt32 minX;
+            UInt32 minY;
+            UInt32 maxX;
+            UInt32 maxY;
+            UInt32 topLeftEdges; //< Edges whose pixel centers exactly on them are covered, one bit per edge
+        };
+
+        struct BinEntry {
+            UInt32 tile;
+            UInt32 triangle;
+        };
+
+        struct SetupBatch {
+            std::vector<TriangleSetup> triangles;
+            std::vector<BinEntry> binEntries;
+            std::size_t culledTriangleCount;
+            std::size_t clippedTriangleCount;
+        };
+
+        struct TriangleRef {
+            UInt32 batch;
+            UInt32 triangle;
+        };
+
+        void BinTriangles(const Framebuffer& framebuffer, const DrawCall& drawCall, ThreadPool* threadPool);
+        void RasterizeTile(const DrawCall& drawCall, UInt32 tile, Framebuffer::Tile& tileData) const;
+
+        static bool SetupTriangle(const std::array<const ClipVertex*, 3>& vertices, const DrawCall& drawCall,
+                                  UInt32 width, UInt32 height, TriangleSetup& setup);
+
+        std::vector<ClipVertex> m_vertices;
+        std::vector<SetupBatch> m_setupBatches;
+        std::vector<TriangleRef> m_tileTriangles; //< Triangles binned in each tile, in submission order
+        std::vector<UInt32> m_tileOffsets;
+        std::vector<UInt32> m_activeTiles;
+        Statistics m_statistics = {};
+        UInt32 m_tileCountX = 0;
+    };
+} // namespace Fl
+
+#endif // FL_RENDERER_SOFTWARERASTERIZER_HPP
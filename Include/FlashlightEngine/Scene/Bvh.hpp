@@ -0,0 +1,186 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_SCENE_BVH_HPP
+#define FL_SCENE_BVH_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Aabb.hpp>
+#include <FlashlightEngine/Math/Ray.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    struct BvhRayHit {
+        UInt32 primitive = std::numeric_limits<UInt32>::max();
+        float distance = std::numeric_limits<float>::infinity();
+    };
+
+    /**
+     * @brief Bounding volume hierarchy over axis-aligned boxes, with wide nodes tested against all their children at
+     * once.
+     *
+     * Each node stores the bounds of its (up to NodeWidth) children as structure of arrays, so that a ray or a box is
+     * tested against all of them with a few SIMD instructions. The width follows the SIMD backend selected from the
+     * FL_ARCH_* macros (SSE2 on x86, NEON on aarch64).
+     *
+     * The tree is built with a binned surface area heuristic. Moving primitives only refits the nodes above them, and
+     * the refit swaps children with grand-children when it reduces the surface of a node, which keeps the traversal
+     * cost close to the one of a fresh build while objects move around.
+     */
+    class FL_API Bvh {
+    public:
+        static constexpr std::size_t NodeWidth = SimdFloat4::Width;
+        static constexpr UInt32 InvalidPrimitive = std::numeric_limits<UInt32>::max();
+
+        Bvh() = default;
+        Bvh(const Bvh&) = default;
+        Bvh(Bvh&&) noexcept = default;
+        ~Bvh() = default;
+
+        /**
+         * @brief Builds the hierarchy, primitives being identified by their index in the given span.
+         * @param primitiveBounds Bounds of every primitive.
+         */
+        void Build(std::span<const Aabb> primitiveBounds);
+        void Clear();
+
+        /**
+         * @brief Gets the bounds of the whole hierarchy.
+         * @remark Only up-to-date after Refit() when primitives moved.
+         * @return Root bounds, empty if there is no primitive.
+         */
+        Aabb GetBounds() const;
+        std::size_t GetNodeCount() const;
+        const Aabb& GetPrimitiveBounds(UInt32 primitive) const;
+        std::size_t GetPrimitiveCount() const;
+        /**
+         * @brief Computes the surface area heuristic cost of the hierarchy: the summed area of every child bounds,
+         * relative to the root area.
+         * @return Cost proportional to the expected number of child tests of a random ray.
+         */
+        float GetSahCost() const;
+
+        /**
+         * @brief Finds all primitives whose bounds overlap a box.
+         * @param box Query box.
+         * @param callback Function called as callback(primitive) for each overlapping primitive.
+         */
+        template <typename F>
+        void QueryOverlaps(const Aabb& box, F&& callback) const;
+        /**
+         * @brief Finds the primitives overlapping each box of a batch.
+         * @param boxes Query boxes.
+         * @param primitives Receives the overlapping primitives, grouped by query.
+         * @param offsets Receives boxes.size() + 1 offsets, the results of box i being in
+         * [offsets[i], offsets[i + 1]).
+         * @param threadPool Thread pool processing the queries, or nullptr to run on the calling thread.
+         */
+        void QueryOverlaps(std::span<const Aabb> boxes, std::vector<UInt32>& primitives, std::vector<UInt32>& offsets,
+                           ThreadPool* threadPool = nullptr) const;
+
+        /**
+         * @brief Finds the closest primitive hit by a ray.
+         * @param ray Ray to cast.
+         * @param maxDistance Maximum distance along the ray.
+         * @param intersect Function called as intersect(primitive, ray, maxDistance) for primitives whose bounds are
+         * hit, returning the hit distance or infinity.
+         * @return Closest hit, primitive being InvalidPrimitive if nothing was hit.
+         */
+        template <typename F>
+        BvhRayHit RayCast(const Ray& ray, float maxDistance, F&& intersect) const;
+        /**
+         * @brief Finds the closest primitive bounds hit by a ray.
+         */
+        BvhRayHit RayCast(const Ray& ray, float maxDistance = std::numeric_limits<float>::infinity()) const;
+        /**
+         * @brief Casts a batch of rays against the primitive bounds.
+         * @param rays Rays to cast.
+         * @param hits Receives the closest hit of each ray, must be as large as rays.
+         * @param maxDistance Maximum distance along the rays.
+         * @param threadPool Thread pool processing the rays, or nullptr to run on the calling thread.
+         */
+        void RayCast(std::span<const Ray> rays, std::span<BvhRayHit> hits,
+                     float maxDistance = std::numeric_limits<float>::infinity(), ThreadPool* threadPool = nullptr) const;
+
+        /**
+         * @brief Refits the nodes above the primitives which moved since the last refit.
+         * @param allowRotations Whether to swap children with grand-children when it reduces the node areas.
+         */
+        void Refit(bool allowRotations = true);
+
+        /**
+         * @brief Changes the bounds of a primitive, the hierarchy being updated by the next Refit().
+         * @param primitive Primitive index.
+         * @param bounds New bounds.
+         */
+        void UpdatePrimitive(UInt32 primitive, const Aabb& bounds);
+
+        Bvh& operator=(const Bvh&) = default;
+        Bvh& operator=(Bvh&&) noexcept = default;
+
+        static constexpr std::size_t BatchSize = 256;
+
+    private:
+        struct Node {
+            // Child bounds, lanes past childCount are unused
+            alignas(16) float minX[NodeWidth];
+            alignas(16) float minY[NodeWidth];
+            alignas(16) float minZ[NodeWidth];
+            alignas(16) float maxX[NodeWidth];
+            alignas(16) float maxY[NodeWidth];
+            alignas(16) float maxZ[NodeWidth];
+            UInt32 children[NodeWidth]; //< Node index, or primitive index with PrimitiveBit set
+            UInt32 parent;
+            UInt32 childCount;
+        };
+
+        struct BuildPrimitive {
+            SimdFloat4 boundsMin;
+            SimdFloat4 boundsMax;
+            UInt32 index;
+
+            inline SimdFloat4 GetCentroid() const;
+        };
+
+        struct BuildRange {
+            UInt32 first;
+            UInt32 last;
+            Aabb bounds;
+            Aabb centroidBounds;
+        };
+
+        UInt32 AllocateNode(UInt32 parent);
+        void BuildNode(UInt32 nodeIndex, const BuildRange& range);
+        BuildRange ComputeRange(UInt32 first, UInt32 last) const;
+        Aabb GetChildBounds(const Node& node, std::size_t slot) const;
+        Aabb GetNodeBounds(const Node& node) const;
+        void RefitNode(UInt32 nodeIndex, bool allowRotations);
+        void RotateNode(UInt32 nodeIndex);
+        void SetChild(UInt32 nodeIndex, std::size_t slot, UInt32 child, const Aabb& bounds);
+        void SetChildBounds(Node& node, std::size_t slot, const Aabb& bounds);
+        void SplitRange(const BuildRange& range, BuildRange& left, BuildRange& right);
+
+        static constexpr UInt32 InvalidNode = std::numeric_limits<UInt32>::max();
+        static constexpr UInt32 PrimitiveBit = 1u << 31;
+        static constexpr std::size_t BinCount = 16;
+
+        std::vector<Node> m_nodes;
+        std::vector<Aabb> m_primitiveBounds;
+        std::vector<UInt32> m_primitiveSlots; //< Node index * NodeWidth + slot holding each primitive
+        std::vector<UInt8> m_dirtyNodes;
+        std::vector<BuildPrimitive> m_buildPrimitives; //< Partitioned in place during builds
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Scene/Bvh.inl>
+
+#endif // FL_SCENE_BVH_HPP
@@ -0,0 +1,156 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Scene/Bvh.hpp>
+
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    namespace Detail {
+        // Replaces null direction components by a tiny value, so the slab test never computes 0 * inf
+        inline float SafeInverse(const float value) {
+            constexpr float Epsilon = 1e-30f;
+            return 1.f / ((std::abs(value) > Epsilon) ? value : std::copysign(Epsilon, value));
+        }
+    } // namespace Detail
+
+    inline SimdFloat4 Bvh::BuildPrimitive::GetCentroid() const {
+        return (boundsMin + boundsMax) * SimdFloat4::Splat(0.5f);
+    }
+
+    template <typename F>
+    void Bvh::QueryOverlaps(const Aabb& box, F&& callback) const {
+        if (m_nodes.empty()) {
+            return;
+        }
+
+        const SimdFloat4 queryMinX = SimdFloat4::Splat(box.min.x);
+        const SimdFloat4 queryMinY = SimdFloat4::Splat(box.min.y);
+        const SimdFloat4 queryMinZ = SimdFloat4::Splat(box.min.z);
+        const SimdFloat4 queryMaxX = SimdFloat4::Splat(box.max.x);
+        const SimdFloat4 queryMaxY = SimdFloat4::Splat(box.max.y);
+        const SimdFloat4 queryMaxZ = SimdFloat4::Splat(box.max.z);
+
+        SmallVector<UInt32, 64> stack;
+        stack.push_back(0);
+
+        while (!stack.empty()) {
+            const Node& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            const SimdFloat4 overlapX = SimdFloat4::LessEqual(SimdFloat4::LoadAligned(node.minX), queryMaxX) &
+                                        SimdFloat4::GreaterEqual(SimdFloat4::LoadAligned(node.maxX), queryMinX);
+            const SimdFloat4 overlapY = SimdFloat4::LessEqual(SimdFloat4::LoadAligned(node.minY), queryMaxY) &
+                                        SimdFloat4::GreaterEqual(SimdFloat4::LoadAligned(node.maxY), queryMinY);
+            const SimdFloat4 overlapZ = SimdFloat4::LessEqual(SimdFloat4::LoadAligned(node.minZ), queryMaxZ) &
+                                        SimdFloat4::GreaterEqual(SimdFloat4::LoadAligned(node.maxZ), queryMinZ);
+
+            int mask = (overlapX & overlapY & overlapZ).GetMoveMask() & ((1 << node.childCount) - 1);
+            for (std::size_t slot = 0; mask != 0; ++slot, mask >>= 1) {
+                if (!(mask & 1)) {
+                    continue;
+                }
+
+                const UInt32 child = node.children[slot];
+                if (child & PrimitiveBit) {
+                    callback(child & ~PrimitiveBit);
+                } else {
+                    stack.push_back(child);
+                }
+            }
+        }
+    }
+
+    template <typename F>
+    BvhRayHit Bvh::RayCast(const Ray& ray, const float maxDistance, F&& intersect) const {
+        BvhRayHit hit;
+        if (m_nodes.empty()) {
+            return hit;
+        }
+
+        hit.distance = maxDistance;
+
+        const SimdFloat4 originX = SimdFloat4::Splat(ray.origin.x);
+        const SimdFloat4 originY = SimdFloat4::Splat(ray.origin.y);
+        const SimdFloat4 originZ = SimdFloat4::Splat(ray.origin.z);
+        const SimdFloat4 invDirectionX = SimdFloat4::Splat(Detail::SafeInverse(ray.direction.x));
+        const SimdFloat4 invDirectionY = SimdFloat4::Splat(Detail::SafeInverse(ray.direction.y));
+        const SimdFloat4 invDirectionZ = SimdFloat4::Splat(Detail::SafeInverse(ray.direction.z));
+
+        SmallVector<UInt32, 64> stack;
+        stack.push_back(0);
+
+        while (!stack.empty()) {
+            const Node& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            const SimdFloat4 x1 = (SimdFloat4::LoadAligned(node.minX) - originX) * invDirectionX;
+            const SimdFloat4 x2 = (SimdFloat4::LoadAligned(node.maxX) - originX) * invDirectionX;
+            const SimdFloat4 y1 = (SimdFloat4::LoadAligned(node.minY) - originY) * invDirectionY;
+            const SimdFloat4 y2 = (SimdFloat4::LoadAligned(node.maxY) - originY) * invDirectionY;
+            const SimdFloat4 z1 = (SimdFloat4::LoadAligned(node.minZ) - originZ) * invDirectionZ;
+            const SimdFloat4 z2 = (SimdFloat4::LoadAligned(node.maxZ) - originZ) * invDirectionZ;
+
+            const SimdFloat4 near = SimdFloat4::Max(SimdFloat4::Max(SimdFloat4::Min(x1, x2), SimdFloat4::Min(y1, y2)),
+                                                    SimdFloat4::Max(SimdFloat4::Min(z1, z2), SimdFloat4::Zero()));
+            const SimdFloat4 far = SimdFloat4::Min(SimdFloat4::Min(SimdFloat4::Max(x1, x2), SimdFloat4::Max(y1, y2)),
+                                                   SimdFloat4::Min(SimdFloat4::Max(z1, z2),
+                                                                   SimdFloat4::Splat(hit.distance)));
+
+            int mask = SimdFloat4::LessEqual(near, far).GetMoveMask() & ((1 << node.childCount) - 1);
+            if (mask == 0) {
+                continue;
+            }
+
+            alignas(16) float nearDistances[NodeWidth];
+            near.StoreAligned(nearDistances);
+
+            // Children nodes are pushed farthest first, so the closest one is visited next
+            std::size_t hitNodeCount = 0;
+            UInt32 hitNodes[NodeWidth];
+            float hitDistances[NodeWidth];
+
+            for (std::size_t slot = 0; mask != 0; ++slot, mask >>= 1) {
+                if (!(mask & 1)) {
+                    continue;
+                }
+
+                const UInt32 child = node.children[slot];
+                if (child & PrimitiveBit) {
+                    const UInt32 primitive = child & ~PrimitiveBit;
+                    const float distance = intersect(primitive, ray, hit.distance);
+                    if (distance < hit.distance) {
+                        hit.primitive = primitive;
+                        hit.distance = distance;
+                    }
+
+                    continue;
+                }
+
+                std::size_t position = hitNodeCount++;
+                for (; position > 0 && hitDistances[position - 1] < nearDistances[slot]; --position) {
+                    hitNodes[position] = hitNodes[position - 1];
+                    hitDistances[position] = hitDistances[position - 1];
+                }
+
+                hitNodes[position] = child;
+                hitDistances[position] = nearDistances[slot];
+            }
+
+            for (std::size_t i = 0; i < hitNodeCount; ++i) {
+                stack.push_back(hitNodes[i]);
+            }
+        }
+
+        if (hit.primitive == InvalidPrimitive) {
+            hit.distance = std::numeric_limits<float>::infinity();
+        }
+
+        return hit;
+    }
+} // namespace Fl
@@ -0,0 +1,149 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_SCENE_FRUSTUMCULLER_HPP
+#define FL_SCENE_FRUSTUMCULLER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Aabb.hpp>
+#include <FlashlightEngine/Math/Frustum.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    enum class BoundingVolumeType {
+        Box,
+        Sphere,
+
+        Max = Sphere
+    };
+
+    /**
+     * @brief Culls bounding volumes stored as structure of arrays against one or more frusta.
+     *
+     * Objects are grouped in clusters of ClusterSize consecutive indices, each with bounds enclosing its objects.
+     * Clusters entirely outside a frustum are skipped and clusters entirely inside are accepted without testing their
+     * objects, the others testing SimdFloat4::Width objects per iteration. Adding spatially close objects next to each
+     * other makes the early-outs much more frequent.
+     *
+     * Work is split in batches of BatchSize objects, each batch writing the indices of its visible objects to its own
+     * region of the visibility lists: worker threads never share an output and the result doesn't depend on the
+     * thread count.
+     */
+    class FL_API FrustumCuller {
+    public:
+        class FL_API VisibilityList {
+            friend FrustumCuller;
+
+        public:
+            VisibilityList() = default;
+
+            /**
+             * @brief Copies the visible indices, in increasing order.
+             * @param indices Vector receiving the indices, its previous content is replaced.
+             */
+            void CopyTo(std::vector<UInt32>& indices) const;
+
+            /**
+             * @brief Calls a function for each visible index, in increasing order.
+             * @param func Function called as func(index).
+             */
+            template <typename F>
+            void ForEach(F&& func) const;
+
+            /**
+             * @brief Gets the visible indices of a batch, as written by the thread which processed it.
+             * @param batch Batch index.
+             * @return Compacted visible indices.
+             */
+            inline std::span<const UInt32> GetBatch(std::size_t batch) const;
+            inline std::size_t GetBatchCount() const;
+            std::size_t GetCount() const;
+
+        private:
+            std::vector<UInt32> m_indices; //< Batch i writes from i * BatchSize
+            std::vector<UInt32> m_batchCounts;
+        };
+
+        struct Statistics {
+            UInt32 acceptedClusters = 0; //< Clusters entirely inside a frustum
+            UInt32 rejectedClusters = 0; //< Clusters entirely outside a frustum
+            UInt32 testedClusters = 0;   //< Clusters whose objects were tested one by one
+        };
+
+        static constexpr std::size_t ClusterSize = 64;
+        static constexpr std::size_t BatchSize = 16 * ClusterSize;
+
+        explicit FrustumCuller(BoundingVolumeType volumeType);
+        FrustumCuller(const FrustumCuller&) = delete;
+        FrustumCuller(FrustumCuller&&) noexcept = default;
+        ~FrustumCuller() = default;
+
+        UInt32 AddBox(const Aabb& box);
+        UInt32 AddSphere(const Vector3& center, float radius);
+
+        void Clear();
+
+        /**
+         * @brief Culls all objects against several frusta, each cluster being tested against all of them in a row.
+         * @param frusta Frusta to test.
+         * @param visibilityLists Lists receiving the visible objects of each frustum, as many as frusta.
+         * @param threadPool Thread pool processing the batches, or nullptr to run on the calling thread.
+         * @return Cluster statistics, summed over all frusta.
+         */
+        Statistics Cull(std::span<const Frustum> frusta, std::span<VisibilityList> visibilityLists,
+                        ThreadPool* threadPool = nullptr);
+        inline Statistics Cull(const Frustum& frustum, VisibilityList& visibilityList,
+                               ThreadPool* threadPool = nullptr);
+
+        /**
+         * @brief Gets the bounds of an object, spheres returning their enclosing box.
+         */
+        Aabb GetBounds(UInt32 index) const;
+        std::size_t GetCount() const;
+        BoundingVolumeType GetVolumeType() const;
+
+        void Reserve(std::size_t capacity);
+
+        void SetBox(UInt32 index, const Aabb& box);
+        void SetSphere(UInt32 index, const Vector3& center, float radius);
+
+        FrustumCuller& operator=(const FrustumCuller&) = delete;
+        FrustumCuller& operator=(FrustumCuller&&) noexcept = default;
+
+    private:
+        struct SimdFrustum;
+
+        UInt32 AddObject(const Vector3& center, const Vector3& extents);
+        Statistics CullBatch(std::span<const SimdFrustum> frusta, std::span<VisibilityList> visibilityLists,
+                             std::size_t first, std::size_t last) const;
+        template <bool IsSphere>
+        std::size_t CullObjects(const SimdFrustum& frustum, std::size_t first, std::size_t last, UInt32* output) const;
+        void SetObject(UInt32 index, const Vector3& center, const Vector3& extents);
+        void UpdateClusters();
+
+        // Padded to a multiple of SimdFloat4::Width, spheres store their radius as extentX
+        std::vector<float> m_centerX;
+        std::vector<float> m_centerY;
+        std::vector<float> m_centerZ;
+        std::vector<float> m_extentX;
+        std::vector<float> m_extentY;
+        std::vector<float> m_extentZ;
+        std::vector<Aabb> m_clusterBounds;
+        std::vector<UInt8> m_dirtyClusters;
+        std::size_t m_count = 0;
+        BoundingVolumeType m_volumeType;
+        bool m_hasDirtyClusters = false;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Scene/FrustumCuller.inl>
+
+#endif // FL_SCENE_FRUSTUMCULLER_HPP
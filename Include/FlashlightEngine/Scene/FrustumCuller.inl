@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Scene/FrustumCuller.hpp>
+
+namespace Fl {
+    template <typename F>
+    void FrustumCuller::VisibilityList::ForEach(F&& func) const {
+        for (std::size_t batch = 0; batch < m_batchCounts.size(); ++batch) {
+            for (const UInt32 index : GetBatch(batch)) {
+                func(index);
+            }
+        }
+    }
+
+    inline std::span<const UInt32> FrustumCuller::VisibilityList::GetBatch(const std::size_t batch) const {
+        return {m_indices.data() + batch * BatchSize, m_batchCounts[batch]};
+    }
+
+    inline std::size_t FrustumCuller::VisibilityList::GetBatchCount() const {
+        return m_batchCounts.size();
+    }
+
+    inline auto FrustumCuller::Cull(const Frustum& frustum, VisibilityList& visibilityList, ThreadPool* threadPool)
+        -> Statistics {
+        return Cull(std::span(&frustum, 1), std::span(&visibilityList, 1), threadPool);
+    }
+} // namespace Fl
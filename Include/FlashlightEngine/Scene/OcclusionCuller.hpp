@@ -0,0 +1,178 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_SCENE_OCCLUSIONCULLER_HPP
+#define FL_SCENE_OCCLUSIONCULLER_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Core/Clock.hpp>
+#include <FlashlightEngine/Math/Aabb.hpp>
+#include <FlashlightEngine/Math/Matrix4.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Software occlusion culling against a low-resolution depth buffer and its min-max hierarchy.
+     *
+     * Occluders are rasterized at the pixel centers, writing the furthest depth of the triangle over the pixel. The
+     * buffer is split in tiles rasterized in parallel, then reduced into a hierarchy whose texels hold the nearest and
+     * furthest depths of the pixels below them.
+     *
+     * Occludees are tested by their screen-space bounds and nearest depth, starting from the level where they cover at
+     * most 2x2 texels: texels entirely in front of the occludee are hidden, the others are refined until a visible
+     * pixel is found. An object is never culled while visible through a pixel center, but gaps between occluders
+     * thinner than a pixel may be missed.
+     *
+     * Depth goes from 0 on the near plane to 1 on the far one, as projected by Matrix4::Perspective(). Objects crossing
+     * the near plane or out of the screen are reported visible, frustum culling is left to FrustumCuller.
+     *
+     * The SIMD path evaluates SimdFloat4::Width pixels or box corners at once on x86_64 and aarch64. Both paths give
+     * the same results, the scalar one being selectable to check it.
+     */
+    class FL_API OcclusionCuller {
+    public:
+#if defined(FL_ARCH_x86_64) || defined(FL_ARCH_aarch64)
+        static constexpr bool HasSimdPath = true;
+#else
+        static constexpr bool HasSimdPath = false;
+#endif
+
+        static constexpr UInt32 TileWidth = 32;
+        static constexpr UInt32 TileHeight = 16;
+        static constexpr std::size_t OccludeeBatchSize = 256;
+
+        struct Settings {
+            UInt32 width = 256; //< Multiple of TileWidth
+            UInt32 height = 144; //< Multiple of TileHeight
+            bool useSimd = HasSimdPath; //< Ignored without SIMD path
+        };
+
+        /**
+         * @brief Statistics of the current frame, reset by BeginFrame().
+         */
+        struct Statistics {
+            std::size_t occluderTriangleCount;
+            std::size_t rasterizedTriangleCount; //< Occluder triangles covering at least one pixel center
+            std::size_t occludeeCount;
+            std::size_t culledOccludeeCount;
+            Clock::duration rasterizationTime; //< Including the hierarchy build
+            Clock::duration testTime;
+
+            inline float GetCulledFraction() const;
+        };
+
+        OcclusionCuller();
+        explicit OcclusionCuller(const Settings& settings);
+        OcclusionCuller(const OcclusionCuller&) = delete;
+        OcclusionCuller(OcclusionCuller&&) noexcept = default;
+        ~OcclusionCuller() = default;
+
+        /**
+         * @brief Adds the triangles of a mesh to the occluders of the frame.
+         * @param positions Vertex positions.
+         * @param indices Triangle list indexing the positions.
+         * @param worldViewProjection Matrix transforming the positions to clip space.
+         */
+        void AddOccluder(std::span<const Vector3> positions, std::span<const UInt32> indices,
+                         const Matrix4& worldViewProjection);
+
+        /**
+         * @brief Clears the occluders and the depth buffer.
+         * @param viewProjection Matrix transforming the occludees to clip space.
+         */
+        void BeginFrame(const Matrix4& viewProjection);
+
+        /**
+         * @brief Gets the depth of a pixel of the last RenderOccluders().
+         */
+        inline float GetDepth(UInt32 x, UInt32 y) const;
+        inline std::span<const float> GetDepths() const;
+        inline UInt32 GetHeight() const;
+        inline std::size_t GetLevelCount() const;
+        /**
+         * @brief Gets the furthest depth of the pixels below a texel of the hierarchy.
+         * @param level Level of the hierarchy, the depth buffer being level 0.
+         */
+        float GetMaxDepth(std::size_t level, UInt32 x, UInt32 y) const;
+        float GetMinDepth(std::size_t level, UInt32 x, UInt32 y) const;
+        inline const Statistics& GetStatistics() const;
+        inline UInt32 GetWidth() const;
+        inline bool IsUsingSimd() const;
+
+        /**
+         * @brief Tests whether a box is hidden by the occluders rendered by the last RenderOccluders().
+         * @remark Doesn't update the statistics.
+         */
+        bool IsOccluded(const Aabb& box) const;
+
+        /**
+         * @brief Rasterizes the occluders added since BeginFrame() and builds the depth hierarchy.
+         * @param threadPool Thread pool rasterizing the tiles, or nullptr to run on the calling thread.
+         */
+        void RenderOccluders(ThreadPool* threadPool = nullptr);
+
+        /**
+         * @brief Tests boxes against the occluders, in batches of OccludeeBatchSize.
+         * @param boxes Boxes to test.
+         * @param visibility Receives 1 for every visible box and 0 for every hidden one, as many as boxes.
+         * @param threadPool Thread pool testing the batches, or nullptr to run on the calling thread.
+         * @return Number of hidden boxes.
+         */
+        std::size_t TestOccludees(std::span<const Aabb> boxes, std::span<UInt8> visibility,
+                                  ThreadPool* threadPool = nullptr);
+
+        OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+        OcclusionCuller& operator=(OcclusionCuller&&) noexcept = default;
+
+    private:
+        // Pixel centers are covered where the three edge functions A * x + B * y + C are positive, the depth over the
+        // pixel being at most depthX * x + depthY * y + depthC
+        struct OccluderTriangle {
+            std::array<float, 3> edgeA;
+            std::array<float, 3> edgeB;
+            std::array<float, 3> edgeC;
+            float depthX;
+            float depthY;
+            float depthC;
+            UInt32 minX;
+            UInt32 minY;
+            UInt32 maxX;
+            UInt32 maxY;
+        };
+
+        struct Level {
+            UInt32 width;
+            UInt32 height;
+            std::vector<float> minDepths;
+            std::vector<float> maxDepths;
+        };
+
+        void AddTriangle(const std::array<std::array<float, 4>, 3>& vertices);
+        void BuildHierarchy();
+        template <bool UseSimd>
+        bool IsOccludedImpl(const Aabb& box) const;
+        template <bool UseSimd>
+        void RasterizeTile(UInt32 tile);
+
+        std::vector<float> m_depths;
+        std::vector<Level> m_levels; //< From level 1
+        std::vector<OccluderTriangle> m_triangles;
+        std::vector<UInt32> m_tileTriangles; //< Triangles binned in each tile, in submission order
+        std::vector<UInt32> m_tileOffsets;
+        Matrix4 m_viewProjection;
+        Statistics m_statistics;
+        Settings m_settings;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Scene/OcclusionCuller.inl>
+
+#endif // FL_SCENE_OCCLUSIONCULLER_HPP
@@ -0,0 +1,41 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Scene/OcclusionCuller.hpp>
+
+namespace Fl {
+    inline float OcclusionCuller::Statistics::GetCulledFraction() const {
+        return (occludeeCount > 0) ? static_cast<float>(culledOccludeeCount) / static_cast<float>(occludeeCount) : 0.f;
+    }
+
+    inline float OcclusionCuller::GetDepth(const UInt32 x, const UInt32 y) const {
+        return m_depths[std::size_t(y) * m_settings.width + x];
+    }
+
+    inline std::span<const float> OcclusionCuller::GetDepths() const {
+        return m_depths;
+    }
+
+    inline UInt32 OcclusionCuller::GetHeight() const {
+        return m_settings.height;
+    }
+
+    inline std::size_t OcclusionCuller::GetLevelCount() const {
+        return 1 + m_levels.size();
+    }
+
+    inline auto OcclusionCuller::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+
+    inline UInt32 OcclusionCuller::GetWidth() const {
+        return m_settings.width;
+    }
+
+    inline bool OcclusionCuller::IsUsingSimd() const {
+        return HasSimdPath && m_settings.useSimd;
+    }
+} // namespace Fl
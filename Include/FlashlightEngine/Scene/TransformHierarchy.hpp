@@ -0,0 +1,137 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_SCENE_TRANSFORMHIERARCHY_HPP
+#define FL_SCENE_TRANSFORMHIERARCHY_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Math/Matrix4.hpp>
+#include <FlashlightEngine/Math/Quaternion.hpp>
+#include <FlashlightEngine/Math/Vector3.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Transform hierarchy stored as structure of arrays, sorted by depth.
+     *
+     * Transforms are referenced by stable identifiers, while their data lives in dense arrays where every parent comes
+     * before its children. Update() walks the depth levels in order, each level being split in batches which can run
+     * in parallel since they only read the (already updated) previous level.
+     *
+     * Modifying a local transform marks it dirty, which propagates to its descendants during the update: only the
+     * world matrices of the changed subtrees are recomputed. Structural changes (creation, destruction, reparenting)
+     * are deferred and sort the arrays again during the next update.
+     */
+    class FL_API TransformHierarchy {
+    public:
+        using TransformId = UInt32;
+
+        static constexpr TransformId InvalidId = std::numeric_limits<TransformId>::max();
+
+        TransformHierarchy() = default;
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy(TransformHierarchy&&) noexcept = default;
+        ~TransformHierarchy() = default;
+
+        /**
+         * @brief Creates a transform with an identity local transform.
+         * @param parent Parent transform, or InvalidId to create a root.
+         * @return Identifier of the new transform.
+         */
+        TransformId Create(TransformId parent = InvalidId);
+        /**
+         * @brief Destroys a transform and all of its descendants.
+         * @remark The identifiers of the descendants stay valid until the next update.
+         * @param id Transform to destroy.
+         */
+        void Destroy(TransformId id);
+
+        /**
+         * @brief Gets the number of transforms, destroyed ones being removed during the next update.
+         * @return Transform count.
+         */
+        std::size_t GetCount() const;
+        /**
+         * @brief Gets the number of depth levels, as of the last update.
+         * @return Depth level count.
+         */
+        std::size_t GetDepthCount() const;
+        const Vector3& GetLocalPosition(TransformId id) const;
+        const Quaternion& GetLocalRotation(TransformId id) const;
+        const Vector3& GetLocalScale(TransformId id) const;
+        TransformId GetParent(TransformId id) const;
+        /**
+         * @brief Gets the world matrix of a transform.
+         * @remark Only up-to-date after Update().
+         * @param id Transform.
+         * @return World matrix.
+         */
+        const Matrix4& GetWorldMatrix(TransformId id) const;
+
+        bool IsValid(TransformId id) const;
+
+        /**
+         * @brief Reserves memory for the given number of transforms.
+         * @param capacity Transform count.
+         */
+        void Reserve(std::size_t capacity);
+
+        void SetLocalPosition(TransformId id, const Vector3& position);
+        void SetLocalRotation(TransformId id, const Quaternion& rotation);
+        void SetLocalScale(TransformId id, const Vector3& scale);
+        void SetLocalTransform(TransformId id, const Vector3& position, const Quaternion& rotation,
+                               const Vector3& scale);
+        /**
+         * @brief Moves a transform (and its subtree) under another parent, keeping its local transform.
+         * @param id Transform to move.
+         * @param parent New parent, or InvalidId to make it a root. Must not be a descendant of the transform.
+         */
+        void SetParent(TransformId id, TransformId parent);
+
+        /**
+         * @brief Applies structural changes and recomputes the world matrices of dirty subtrees.
+         * @param threadPool Thread pool processing the batches of each depth level, or nullptr to run on the calling
+         * thread.
+         */
+        void Update(ThreadPool* threadPool = nullptr);
+
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(TransformHierarchy&&) noexcept = default;
+
+        static constexpr std::size_t BatchSize = 1024;
+
+    private:
+        UInt32 GetIndex(TransformId id) const;
+        void MarkDirty(UInt32 index);
+        void Rebuild();
+        void UpdateRange(UInt32 first, UInt32 last);
+
+        static constexpr UInt32 InvalidIndex = std::numeric_limits<UInt32>::max();
+        static constexpr UInt8 DirtyFlag = 1 << 0;
+        static constexpr UInt8 DestroyedFlag = 1 << 1;
+
+        // Dense arrays, sorted by depth after each rebuild
+        std::vector<Matrix4> m_worldMatrices;
+        std::vector<Quaternion> m_localRotations;
+        std::vector<Vector3> m_localPositions;
+        std::vector<Vector3> m_localScales;
+        std::vector<UInt32> m_parentIndices;
+        std::vector<TransformId> m_ids;
+        std::vector<UInt8> m_flags;
+
+        std::vector<UInt32> m_depthOffsets; //< First index of each depth level, plus the total count
+        std::vector<UInt32> m_idToIndex;
+        std::vector<TransformId> m_freeIds;
+        bool m_isStructureDirty = false;
+        bool m_hasDirtyTransforms = false;
+    };
+} // namespace Fl
+
+#endif // FL_SCENE_TRANSFORMHIERARCHY_HPP
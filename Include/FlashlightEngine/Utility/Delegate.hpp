@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_UTILITY_DELEGATE_HPP
+#define FL_UTILITY_DELEGATE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Fl {
+    template <typename Signature, std::size_t BufferSize = 4 * sizeof(void*)>
+    class Delegate;
+
+    /**
+     * @brief Move-only type-erased callable stored in an inline buffer, it never allocates.
+     *
+     * Callables which don't fit in BufferSize bytes (or require a stricter alignment than std::max_align_t) are
+     * rejected at compile time, capture a pointer to the state instead.
+     */
+    template <typename R, typename... Args, std::size_t BufferSize>
+    class Delegate<R(Args...), BufferSize> {
+    public:
+        static constexpr std::size_t BufferCapacity = BufferSize;
+
+        Delegate() noexcept;
+        Delegate(std::nullptr_t) noexcept;
+        template <typename F>
+            requires(!std::is_same_v<std::remove_cvref_t<F>, Delegate> && std::is_invocable_r_v<R, F&, Args...>)
+        Delegate(F&& func);
+        Delegate(const Delegate&) = delete;
+        Delegate(Delegate&& delegate) noexcept;
+        ~Delegate();
+
+        /**
+         * @brief Checks whether a callable is stored.
+         * @return True if the delegate can be called.
+         */
+        bool IsValid() const noexcept;
+
+        /**
+         * @brief Destroys the stored callable, if any.
+         */
+        void Reset() noexcept;
+
+        explicit operator bool() const noexcept;
+
+        R operator()(Args... args) const;
+
+        Delegate& operator=(const Delegate&) = delete;
+        Delegate& operator=(Delegate&& delegate) noexcept;
+
+        template <typename F>
+        static constexpr bool Fits = sizeof(F) <= BufferSize && alignof(F) <= alignof(std::max_align_t) &&
+                                     std::is_nothrow_move_constructible_v<F>;
+
+    private:
+        struct Operations {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*relocate)(void* destination, void* source) noexcept; //< Move-constructs then destroys source
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename F>
+        static constexpr Operations OperationsFor = {
+            [](void* storage, Args&&... args) -> R {
+                return static_cast<R>(std::invoke(*static_cast<F*>(storage), std::forward<Args>(args)...));
+            },
+            [](void* destination, void* source) noexcept {
+                F* func = static_cast<F*>(source);
+                new (destination) F(std::move(*func));
+                func->~F();
+            },
+            [](void* storage) noexcept { static_cast<F*>(storage)->~F(); }};
+
+        alignas(std::max_align_t) mutable std::byte m_storage[BufferSize];
+        const Operations* m_operations;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Utility/Delegate.inl>
+
+#endif // FL_UTILITY_DELEGATE_HPP
@@ -0,0 +1,87 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Utility/Delegate.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    template <typename R, typename... Args, std::size_t BufferSize>
+    Delegate<R(Args...), BufferSize>::Delegate() noexcept :
+        m_operations(nullptr) {
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    Delegate<R(Args...), BufferSize>::Delegate(std::nullptr_t) noexcept :
+        Delegate() {
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, Delegate<R(Args...), BufferSize>> &&
+                 std::is_invocable_r_v<R, F&, Args...>)
+    Delegate<R(Args...), BufferSize>::Delegate(F&& func) {
+        using Func = std::decay_t<F>;
+        static_assert(Fits<Func>, "Callable doesn't fit in the delegate buffer or isn't nothrow movable.");
+
+        new (m_storage) Func(std::forward<F>(func));
+        m_operations = &OperationsFor<Func>;
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    Delegate<R(Args...), BufferSize>::Delegate(Delegate&& delegate) noexcept :
+        m_operations(delegate.m_operations) {
+        if (m_operations) {
+            m_operations->relocate(m_storage, delegate.m_storage);
+            delegate.m_operations = nullptr;
+        }
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    Delegate<R(Args...), BufferSize>::~Delegate() {
+        Reset();
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    bool Delegate<R(Args...), BufferSize>::IsValid() const noexcept {
+        return m_operations != nullptr;
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    void Delegate<R(Args...), BufferSize>::Reset() noexcept {
+        if (m_operations) {
+            m_operations->destroy(m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    Delegate<R(Args...), BufferSize>::operator bool() const noexcept {
+        return IsValid();
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    R Delegate<R(Args...), BufferSize>::operator()(Args... args) const {
+        FlAssertMsg(m_operations, "[Utility/Delegate] Calling an empty delegate.");
+
+        return m_operations->invoke(m_storage, std::forward<Args>(args)...);
+    }
+
+    template <typename R, typename... Args, std::size_t BufferSize>
+    auto Delegate<R(Args...), BufferSize>::operator=(Delegate&& delegate) noexcept -> Delegate& {
+        if (this != &delegate) {
+            Reset();
+
+            if (delegate.m_operations) {
+                m_operations = delegate.m_operations;
+                m_operations->relocate(m_storage, delegate.m_storage);
+                delegate.m_operations = nullptr;
+            }
+        }
+
+        return *this;
+    }
+} // namespace Fl
@@ -0,0 +1,167 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_UTILITY_FIXEDVECTOR_HPP
+#define FL_UTILITY_FIXEDVECTOR_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Utility/ConstantEvaluated.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+namespace Fl {
+    /**
+     * @brief std::vector-like container with a fixed capacity of N elements stored inline, it never allocates.
+     *
+     * Growing the vector past its capacity is an error and triggers an assertion in debug.
+     * @tparam T Type of the elements.
+     * @tparam N Maximum number of elements.
+     */
+    template <typename T, std::size_t N>
+    class FixedVector {
+        static_assert(N > 0, "FixedVector requires a capacity of at least one element.");
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        FL_CONSTEXPR20 FixedVector() noexcept;
+        FL_CONSTEXPR20 explicit FixedVector(size_type count);
+        FL_CONSTEXPR20 FixedVector(size_type count, const T& value);
+        template <std::input_iterator InputIt>
+        FL_CONSTEXPR20 FixedVector(InputIt first, InputIt last);
+        FL_CONSTEXPR20 FixedVector(std::initializer_list<T> list);
+        FL_CONSTEXPR20 FixedVector(const FixedVector& vec);
+        FL_CONSTEXPR20 FixedVector(FixedVector&& vec) noexcept(std::is_nothrow_move_constructible_v<T>);
+        FL_CONSTEXPR20 ~FixedVector();
+
+        FL_CONSTEXPR20 void assign(size_type count, const T& value);
+        template <std::input_iterator InputIt>
+        FL_CONSTEXPR20 void assign(InputIt first, InputIt last);
+        FL_CONSTEXPR20 void assign(std::initializer_list<T> list);
+
+        FL_CONSTEXPR20 reference at(size_type pos);
+        FL_CONSTEXPR20 const_reference at(size_type pos) const;
+
+        FL_CONSTEXPR20 reference back() noexcept;
+        FL_CONSTEXPR20 const_reference back() const noexcept;
+
+        FL_CONSTEXPR20 iterator begin() noexcept;
+        FL_CONSTEXPR20 const_iterator begin() const noexcept;
+
+        static constexpr size_type capacity() noexcept;
+
+        FL_CONSTEXPR20 const_iterator cbegin() const noexcept;
+        FL_CONSTEXPR20 const_iterator cend() const noexcept;
+
+        FL_CONSTEXPR20 void clear() noexcept;
+
+        FL_CONSTEXPR20 const_reverse_iterator crbegin() const noexcept;
+        FL_CONSTEXPR20 const_reverse_iterator crend() const noexcept;
+
+        FL_CONSTEXPR20 T* data() noexcept;
+        FL_CONSTEXPR20 const T* data() const noexcept;
+
+        template <typename... Args>
+        FL_CONSTEXPR20 iterator emplace(const_iterator pos, Args&&... args);
+        template <typename... Args>
+        FL_CONSTEXPR20 T& emplace_back(Args&&... args);
+
+        [[nodiscard]] FL_CONSTEXPR20 bool empty() const noexcept;
+
+        FL_CONSTEXPR20 iterator end() noexcept;
+        FL_CONSTEXPR20 const_iterator end() const noexcept;
+
+        FL_CONSTEXPR20 iterator erase(const_iterator pos);
+        FL_CONSTEXPR20 iterator erase(const_iterator first, const_iterator last);
+
+        FL_CONSTEXPR20 reference front() noexcept;
+        FL_CONSTEXPR20 const_reference front() const noexcept;
+
+        FL_CONSTEXPR20 bool full() const noexcept;
+
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, const T& value);
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, T&& value);
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, size_type count, const T& value);
+        template <std::input_iterator InputIt>
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, InputIt first, InputIt last);
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, std::initializer_list<T> list);
+
+        static constexpr size_type max_size() noexcept;
+
+        FL_CONSTEXPR20 void pop_back();
+
+        FL_CONSTEXPR20 void push_back(const T& value);
+        FL_CONSTEXPR20 void push_back(T&& value);
+
+        FL_CONSTEXPR20 reverse_iterator rbegin() noexcept;
+        FL_CONSTEXPR20 const_reverse_iterator rbegin() const noexcept;
+
+        FL_CONSTEXPR20 reverse_iterator rend() noexcept;
+        FL_CONSTEXPR20 const_reverse_iterator rend() const noexcept;
+
+        FL_CONSTEXPR20 void reserve(size_type capacity);
+
+        FL_CONSTEXPR20 void resize(size_type count);
+        FL_CONSTEXPR20 void resize(size_type count, const T& value);
+
+        FL_CONSTEXPR20 void shrink_to_fit() noexcept;
+
+        FL_CONSTEXPR20 size_type size() const noexcept;
+
+        FL_CONSTEXPR20 void swap(FixedVector& other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                                             std::is_nothrow_move_constructible_v<T>);
+
+        FL_CONSTEXPR20 T& operator[](size_type pos) noexcept;
+        FL_CONSTEXPR20 const T& operator[](size_type pos) const noexcept;
+
+        FL_CONSTEXPR20 FixedVector& operator=(const FixedVector& vec);
+        FL_CONSTEXPR20 FixedVector& operator=(FixedVector&& vec) noexcept(std::is_nothrow_move_constructible_v<T>);
+        FL_CONSTEXPR20 FixedVector& operator=(std::initializer_list<T> list);
+
+    private:
+        FL_CONSTEXPR20 T* MakeGap(size_type index, size_type count);
+
+        static FL_CONSTEXPR20 void Relocate(T* first, T* last, T* dest) noexcept(std::is_nothrow_move_constructible_v<T>);
+        static FL_CONSTEXPR20 void RelocateBackward(T* first, T* last, T* destLast) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        union Storage {
+            constexpr Storage() noexcept {}
+            constexpr ~Storage() {}
+
+            T data[N];
+        };
+
+        size_type m_size;
+        Storage m_storage;
+    };
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 bool operator==(const FixedVector<T, N>& lhs, const FixedVector<T, N>& rhs);
+    template <typename T, std::size_t N>
+        requires std::three_way_comparable<T>
+    FL_CONSTEXPR20 auto operator<=>(const FixedVector<T, N>& lhs, const FixedVector<T, N>& rhs);
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void swap(FixedVector<T, N>& lhs, FixedVector<T, N>& rhs);
+} // namespace Fl
+
+#include <FlashlightEngine/Utility/FixedVector.inl>
+
+#endif // FL_UTILITY_FIXEDVECTOR_HPP
@@ -0,0 +1,519 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Utility/FixedVector.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace Fl {
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>::FixedVector() noexcept : m_size(0) {
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>::FixedVector(const size_type count) : FixedVector() {
+        resize(count);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>::FixedVector(const size_type count, const T& value) : FixedVector() {
+        resize(count, value);
+    }
+
+    template <typename T, std::size_t N>
+    template <std::input_iterator InputIt>
+    FL_CONSTEXPR20 FixedVector<T, N>::FixedVector(InputIt first, InputIt last) : FixedVector() {
+        insert(end(), first, last);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>::FixedVector(std::initializer_list<T> list) :
+        FixedVector(list.begin(), list.end()) {
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>::FixedVector(const FixedVector& vec) : FixedVector(vec.begin(), vec.end()) {
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>::FixedVector(FixedVector&& vec) noexcept(
+        std::is_nothrow_move_constructible_v<T>) :
+        FixedVector() {
+        Relocate(vec.begin(), vec.end(), data());
+        m_size = vec.m_size;
+        vec.m_size = 0;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>::~FixedVector() {
+        clear();
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::assign(const size_type count, const T& value) {
+        T copy(value); //< value may be one of our elements
+        clear();
+        resize(count, copy);
+    }
+
+    template <typename T, std::size_t N>
+    template <std::input_iterator InputIt>
+    FL_CONSTEXPR20 void FixedVector<T, N>::assign(InputIt first, InputIt last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::assign(std::initializer_list<T> list) {
+        assign(list.begin(), list.end());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::at(const size_type pos) -> reference {
+        if (pos >= m_size) {
+            throw std::out_of_range("FixedVector::at: index out of range");
+        }
+
+        return data()[pos];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::at(const size_type pos) const -> const_reference {
+        if (pos >= m_size) {
+            throw std::out_of_range("FixedVector::at: index out of range");
+        }
+
+        return data()[pos];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::back() noexcept -> reference {
+        FlAssertMsg(m_size > 0, "[Utility/FixedVector] back() called on an empty vector.");
+        return data()[m_size - 1];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::back() const noexcept -> const_reference {
+        FlAssertMsg(m_size > 0, "[Utility/FixedVector] back() called on an empty vector.");
+        return data()[m_size - 1];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::begin() noexcept -> iterator {
+        return data();
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::begin() const noexcept -> const_iterator {
+        return data();
+    }
+
+    template <typename T, std::size_t N>
+    constexpr auto FixedVector<T, N>::capacity() noexcept -> size_type {
+        return N;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::cbegin() const noexcept -> const_iterator {
+        return data();
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::cend() const noexcept -> const_iterator {
+        return data() + m_size;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::clear() noexcept {
+        std::destroy(data(), data() + m_size);
+        m_size = 0;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::crbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(cend());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::crend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(cbegin());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 T* FixedVector<T, N>::data() noexcept {
+        return m_storage.data;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 const T* FixedVector<T, N>::data() const noexcept {
+        return m_storage.data;
+    }
+
+    template <typename T, std::size_t N>
+    template <typename... Args>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::emplace(const_iterator pos, Args&&... args) -> iterator {
+        const size_type index = static_cast<size_type>(pos - data());
+        FlAssertMsg(index <= m_size, "[Utility/FixedVector] Iterator out of range.");
+
+        if (index == m_size) {
+            emplace_back(std::forward<Args>(args)...);
+            return data() + index;
+        }
+
+        T value(std::forward<Args>(args)...); //< args may reference one of our elements
+        T* gap = MakeGap(index, 1);
+        std::construct_at(gap, std::move(value));
+        ++m_size;
+
+        return gap;
+    }
+
+    template <typename T, std::size_t N>
+    template <typename... Args>
+    FL_CONSTEXPR20 T& FixedVector<T, N>::emplace_back(Args&&... args) {
+        FlAssertMsg(m_size < N, "[Utility/FixedVector] Capacity exceeded.");
+
+        T* element = std::construct_at(data() + m_size, std::forward<Args>(args)...);
+        ++m_size;
+
+        return *element;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 bool FixedVector<T, N>::empty() const noexcept {
+        return m_size == 0;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::end() noexcept -> iterator {
+        return data() + m_size;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::end() const noexcept -> const_iterator {
+        return data() + m_size;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::erase(const_iterator pos) -> iterator {
+        return erase(pos, pos + 1);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::erase(const_iterator first, const_iterator last) -> iterator {
+        const size_type index = static_cast<size_type>(first - data());
+        const size_type count = static_cast<size_type>(last - first);
+        FlAssertMsg(first <= last && index + count <= m_size, "[Utility/FixedVector] Iterator out of range.");
+
+        T* eraseFirst = data() + index;
+        std::destroy(eraseFirst, eraseFirst + count);
+        Relocate(eraseFirst + count, data() + m_size, eraseFirst);
+        m_size -= count;
+
+        return eraseFirst;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::front() noexcept -> reference {
+        FlAssertMsg(m_size > 0, "[Utility/FixedVector] front() called on an empty vector.");
+        return data()[0];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::front() const noexcept -> const_reference {
+        FlAssertMsg(m_size > 0, "[Utility/FixedVector] front() called on an empty vector.");
+        return data()[0];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 bool FixedVector<T, N>::full() const noexcept {
+        return m_size == N;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::insert(const_iterator pos, const T& value) -> iterator {
+        return emplace(pos, value);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::insert(const_iterator pos, T&& value) -> iterator {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::insert(const_iterator pos, const size_type count, const T& value)
+        -> iterator {
+        const size_type index = static_cast<size_type>(pos - data());
+        FlAssertMsg(index <= m_size, "[Utility/FixedVector] Iterator out of range.");
+
+        if (count == 0) {
+            return data() + index;
+        }
+
+        T copy(value); //< value may be one of our elements
+        T* gap = MakeGap(index, count);
+        for (size_type i = 0; i < count; ++i) {
+            std::construct_at(gap + i, copy);
+        }
+
+        m_size += count;
+
+        return gap;
+    }
+
+    template <typename T, std::size_t N>
+    template <std::input_iterator InputIt>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::insert(const_iterator pos, InputIt first, InputIt last) -> iterator {
+        const size_type index = static_cast<size_type>(pos - data());
+        FlAssertMsg(index <= m_size, "[Utility/FixedVector] Iterator out of range.");
+
+        if constexpr (std::forward_iterator<InputIt>) {
+            const auto count = static_cast<size_type>(std::distance(first, last));
+            if (count == 0) {
+                return data() + index;
+            }
+
+            T* gap = MakeGap(index, count);
+            for (size_type i = 0; i < count; ++i, ++first) {
+                std::construct_at(gap + i, *first);
+            }
+
+            m_size += count;
+
+            return gap;
+        } else {
+            // Single pass iterators: append then rotate into place
+            const size_type oldSize = m_size;
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+
+            std::rotate(data() + index, data() + oldSize, data() + m_size);
+
+            return data() + index;
+        }
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::insert(const_iterator pos, std::initializer_list<T> list) -> iterator {
+        return insert(pos, list.begin(), list.end());
+    }
+
+    template <typename T, std::size_t N>
+    constexpr auto FixedVector<T, N>::max_size() noexcept -> size_type {
+        return N;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::pop_back() {
+        FlAssertMsg(m_size > 0, "[Utility/FixedVector] pop_back() called on an empty vector.");
+
+        --m_size;
+        std::destroy_at(data() + m_size);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::reserve([[maybe_unused]] const size_type capacity) {
+        FlAssertMsg(capacity <= N, "[Utility/FixedVector] Capacity exceeded.");
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::resize(const size_type count) {
+        FlAssertMsg(count <= N, "[Utility/FixedVector] Capacity exceeded.");
+
+        if (count < m_size) {
+            std::destroy(data() + count, data() + m_size);
+        } else {
+            for (size_type i = m_size; i < count; ++i) {
+                std::construct_at(data() + i);
+            }
+        }
+
+        m_size = count;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::resize(const size_type count, const T& value) {
+        if (count < m_size) {
+            std::destroy(data() + count, data() + m_size);
+            m_size = count;
+        } else if (count > m_size) {
+            insert(end(), count - m_size, value);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::shrink_to_fit() noexcept {
+        // Storage is fixed, nothing to release
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 auto FixedVector<T, N>::size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::swap(FixedVector& other) noexcept(
+        std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>) {
+        if (this == &other) {
+            return;
+        }
+
+        FixedVector& shorter = (m_size < other.m_size) ? *this : other;
+        FixedVector& longer = (m_size < other.m_size) ? other : *this;
+
+        const size_type commonSize = shorter.m_size;
+        for (size_type i = 0; i < commonSize; ++i) {
+            using std::swap;
+            swap(shorter.data()[i], longer.data()[i]);
+        }
+
+        Relocate(longer.data() + commonSize, longer.data() + longer.m_size, shorter.data() + commonSize);
+        std::swap(m_size, other.m_size);
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 T& FixedVector<T, N>::operator[](const size_type pos) noexcept {
+        FlAssertMsg(pos < m_size, "[Utility/FixedVector] Index out of range.");
+        return data()[pos];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 const T& FixedVector<T, N>::operator[](const size_type pos) const noexcept {
+        FlAssertMsg(pos < m_size, "[Utility/FixedVector] Index out of range.");
+        return data()[pos];
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>& FixedVector<T, N>::operator=(const FixedVector& vec) {
+        if (this != &vec) {
+            assign(vec.begin(), vec.end());
+        }
+
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>& FixedVector<T, N>::operator=(FixedVector&& vec) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if (this != &vec) {
+            clear();
+            Relocate(vec.begin(), vec.end(), data());
+            m_size = vec.m_size;
+            vec.m_size = 0;
+        }
+
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 FixedVector<T, N>& FixedVector<T, N>::operator=(std::initializer_list<T> list) {
+        assign(list.begin(), list.end());
+        return *this;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 T* FixedVector<T, N>::MakeGap(const size_type index, const size_type count) {
+        FlAssertMsg(m_size + count <= N, "[Utility/FixedVector] Capacity exceeded.");
+
+        RelocateBackward(data() + index, data() + m_size, data() + m_size + count);
+        return data() + index;
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::Relocate(T* first, T* last, T* dest) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            if FL_IS_RUNTIME_EVAL() {
+                if (first != last) {
+                    std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+                                 static_cast<std::size_t>(last - first) * sizeof(T));
+                }
+
+                return;
+            }
+        }
+
+        for (; first != last; ++first, ++dest) {
+            std::construct_at(dest, std::move(*first));
+            std::destroy_at(first);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void FixedVector<T, N>::RelocateBackward(T* first, T* last, T* destLast) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            if FL_IS_RUNTIME_EVAL() {
+                if (first != last) {
+                    const auto count = static_cast<std::size_t>(last - first);
+                    std::memmove(static_cast<void*>(destLast - count), static_cast<const void*>(first),
+                                 count * sizeof(T));
+                }
+
+                return;
+            }
+        }
+
+        while (last != first) {
+            --last;
+            --destLast;
+            std::construct_at(destLast, std::move(*last));
+            std::destroy_at(last);
+        }
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 bool operator==(const FixedVector<T, N>& lhs, const FixedVector<T, N>& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N>
+        requires std::three_way_comparable<T>
+    FL_CONSTEXPR20 auto operator<=>(const FixedVector<T, N>& lhs, const FixedVector<T, N>& rhs) {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N>
+    FL_CONSTEXPR20 void swap(FixedVector<T, N>& lhs, FixedVector<T, N>& rhs) {
+        lhs.swap(rhs);
+    }
+} // namespace Fl
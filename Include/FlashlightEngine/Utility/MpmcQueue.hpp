@@ -0,0 +1,121 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_UTILITY_MPMCQUEUE_HPP
+#define FL_UTILITY_MPMCQUEUE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace Fl {
+    /**
+     * @brief Bounded lock-free queue usable by any number of producer and consumer threads.
+     *
+     * The queue is a power-of-two ring buffer where each cell holds a sequence number telling which lap of the ring it
+     * is ready for, producers and consumers claim cells by moving the tail (or head) index forward, and those indices
+     * live on separate cache lines.
+     * Push and Pop reserve a cell unconditionally and wait on its sequence number with std::atomic::wait, the Try*
+     * variants never block.
+     * @tparam T Type of the elements.
+     */
+    template <typename T>
+    class MpmcQueue {
+    public:
+        /**
+         * @param capacity Minimum number of elements the queue can hold, rounded up to the next power of two.
+         */
+        explicit MpmcQueue(std::size_t capacity);
+        ~MpmcQueue();
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue(MpmcQueue&&) = delete;
+
+        /**
+         * @brief Gets the maximum number of elements the queue can hold.
+         * @return Capacity of the queue.
+         */
+        std::size_t GetCapacity() const noexcept;
+        /**
+         * @brief Gets the number of elements in the queue.
+         * @remark The value may already be outdated when returned if other threads are working on the queue.
+         * @return Approximate number of elements.
+         */
+        std::size_t GetSize() const noexcept;
+
+        bool IsEmpty() const noexcept;
+
+        /**
+         * @brief Pops an element, waiting for one to be pushed if the queue is empty.
+         * @return The popped element.
+         */
+        T Pop();
+
+        /**
+         * @brief Pushes an element, waiting for some space if the queue is full.
+         */
+        template <typename... Args>
+        void Push(Args&&... args);
+
+        /**
+         * @brief Tries to construct an element at the end of the queue.
+         * @return Whether the element could be pushed (false if the queue is full).
+         */
+        template <typename... Args>
+        bool TryEmplace(Args&&... args);
+
+        /**
+         * @brief Tries to pop an element from the queue.
+         * @param value Element receiving the popped value.
+         * @return Whether an element was popped (false if the queue is empty).
+         */
+        bool TryPop(T& value);
+        /**
+         * @brief Pops as many contiguous elements as possible (up to the size of the output span).
+         * The cells are claimed with a single atomic operation on the head index.
+         * @param values Span receiving the popped values.
+         * @return Number of elements popped.
+         */
+        std::size_t TryPopBatch(std::span<T> values);
+
+        bool TryPush(const T& value);
+        bool TryPush(T&& value);
+        /**
+         * @brief Pushes as many elements as possible (up to the size of the input span).
+         * The cells are claimed with a single atomic operation on the tail index.
+         * @param values Elements to push.
+         * @return Number of elements pushed, starting from the beginning of the span.
+         */
+        std::size_t TryPushBatch(std::span<const T> values);
+
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+    private:
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            alignas(T) std::byte storage[sizeof(T)];
+
+            T* GetValue() noexcept;
+        };
+
+        Cell& GetCell(std::size_t index) const noexcept;
+        std::size_t ClaimCells(std::atomic<std::size_t>& index, std::size_t sequenceOffset, std::size_t maxCount,
+                               std::size_t& firstPosition) const;
+
+        alignas(CacheLineSize) std::atomic<std::size_t> m_head;
+        alignas(CacheLineSize) std::atomic<std::size_t> m_tail;
+        alignas(CacheLineSize) std::size_t m_mask;
+        std::unique_ptr<Cell[]> m_cells;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Utility/MpmcQueue.inl>
+
+#endif // FL_UTILITY_MPMCQUEUE_HPP
@@ -0,0 +1,207 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Utility/MpmcQueue.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <bit>
+#include <utility>
+
+namespace Fl {
+    template <typename T>
+    MpmcQueue<T>::MpmcQueue(const std::size_t capacity) : m_head(0), m_tail(0) {
+        FlAssertMsg(capacity > 0, "[Utility/MpmcQueue] Capacity must be greater than zero.");
+
+        const std::size_t bufferSize = std::bit_ceil(capacity);
+        m_mask = bufferSize - 1;
+        m_cells = std::make_unique<Cell[]>(bufferSize);
+
+        // A cell is ready to receive the value of position P once its sequence is P, and holds a value once it is P + 1
+        for (std::size_t i = 0; i < bufferSize; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T>
+    MpmcQueue<T>::~MpmcQueue() {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        for (std::size_t i = m_head.load(std::memory_order_relaxed); i < tail; ++i) {
+            Cell& cell = GetCell(i);
+            if (cell.sequence.load(std::memory_order_relaxed) == i + 1) {
+                std::destroy_at(cell.GetValue());
+            }
+        }
+    }
+
+    template <typename T>
+    std::size_t MpmcQueue<T>::GetCapacity() const noexcept {
+        return m_mask + 1;
+    }
+
+    template <typename T>
+    std::size_t MpmcQueue<T>::GetSize() const noexcept {
+        const std::size_t head = m_head.load(std::memory_order_acquire);
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+
+        // Blocked consumers move the head past the tail
+        return (tail >= head) ? tail - head : 0;
+    }
+
+    template <typename T>
+    bool MpmcQueue<T>::IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    template <typename T>
+    T MpmcQueue<T>::Pop() {
+        const std::size_t position = m_head.fetch_add(1, std::memory_order_relaxed);
+        Cell& cell = GetCell(position);
+
+        std::size_t sequence;
+        while ((sequence = cell.sequence.load(std::memory_order_acquire)) != position + 1) {
+            cell.sequence.wait(sequence, std::memory_order_acquire);
+        }
+
+        T value = std::move(*cell.GetValue());
+        std::destroy_at(cell.GetValue());
+
+        cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+        cell.sequence.notify_all();
+
+        return value;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void MpmcQueue<T>::Push(Args&&... args) {
+        const std::size_t position = m_tail.fetch_add(1, std::memory_order_relaxed);
+        Cell& cell = GetCell(position);
+
+        std::size_t sequence;
+        while ((sequence = cell.sequence.load(std::memory_order_acquire)) != position) {
+            cell.sequence.wait(sequence, std::memory_order_acquire);
+        }
+
+        std::construct_at(cell.GetValue(), std::forward<Args>(args)...);
+
+        cell.sequence.store(position + 1, std::memory_order_release);
+        cell.sequence.notify_all();
+    }
+
+    template <typename T>
+    template <typename... Args>
+    bool MpmcQueue<T>::TryEmplace(Args&&... args) {
+        std::size_t position;
+        if (ClaimCells(m_tail, 0, 1, position) == 0) {
+            return false;
+        }
+
+        Cell& cell = GetCell(position);
+        std::construct_at(cell.GetValue(), std::forward<Args>(args)...);
+
+        cell.sequence.store(position + 1, std::memory_order_release);
+        cell.sequence.notify_all();
+
+        return true;
+    }
+
+    template <typename T>
+    bool MpmcQueue<T>::TryPop(T& value) {
+        return TryPopBatch(std::span<T>(&value, 1)) == 1;
+    }
+
+    template <typename T>
+    std::size_t MpmcQueue<T>::TryPopBatch(std::span<T> values) {
+        std::size_t firstPosition;
+        const std::size_t count = ClaimCells(m_head, 1, values.size(), firstPosition);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t position = firstPosition + i;
+            Cell& cell = GetCell(position);
+
+            values[i] = std::move(*cell.GetValue());
+            std::destroy_at(cell.GetValue());
+
+            cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+            cell.sequence.notify_all();
+        }
+
+        return count;
+    }
+
+    template <typename T>
+    bool MpmcQueue<T>::TryPush(const T& value) {
+        return TryEmplace(value);
+    }
+
+    template <typename T>
+    bool MpmcQueue<T>::TryPush(T&& value) {
+        return TryEmplace(std::move(value));
+    }
+
+    template <typename T>
+    std::size_t MpmcQueue<T>::TryPushBatch(std::span<const T> values) {
+        std::size_t firstPosition;
+        const std::size_t count = ClaimCells(m_tail, 0, values.size(), firstPosition);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t position = firstPosition + i;
+            Cell& cell = GetCell(position);
+
+            std::construct_at(cell.GetValue(), values[i]);
+
+            cell.sequence.store(position + 1, std::memory_order_release);
+            cell.sequence.notify_all();
+        }
+
+        return count;
+    }
+
+    template <typename T>
+    auto MpmcQueue<T>::GetCell(const std::size_t index) const noexcept -> Cell& {
+        return m_cells[index & m_mask];
+    }
+
+    template <typename T>
+    std::size_t MpmcQueue<T>::ClaimCells(std::atomic<std::size_t>& index, const std::size_t sequenceOffset,
+                                         const std::size_t maxCount, std::size_t& firstPosition) const {
+        std::size_t position = index.load(std::memory_order_relaxed);
+        for (;;) {
+            // Count how many consecutive cells are ready, starting at the current position
+            std::size_t count = 0;
+            bool outdated = false;
+            for (; count < maxCount; ++count) {
+                const std::size_t sequence = GetCell(position + count).sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(sequence - (position + count + sequenceOffset));
+                if (diff != 0) {
+                    // A cell ahead of our position means another thread claimed it already
+                    outdated = (diff > 0 && count == 0);
+                    break;
+                }
+            }
+
+            if (outdated) {
+                position = index.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (count == 0) {
+                return 0;
+            }
+
+            if (index.compare_exchange_weak(position, position + count, std::memory_order_relaxed)) {
+                firstPosition = position;
+                return count;
+            }
+        }
+    }
+
+    template <typename T>
+    T* MpmcQueue<T>::Cell::GetValue() noexcept {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+} // namespace Fl
@@ -0,0 +1,165 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_UTILITY_PARALLELALGORITHM_HPP
+#define FL_UTILITY_PARALLELALGORITHM_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <functional>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace Fl {
+    class ThreadPool;
+
+    /**
+     * @brief Elements processed by a single job of the parallel algorithms, also their unit of SIMD processing.
+     *
+     * Arrays of up to this many elements are processed on the calling thread even when given a thread pool.
+     */
+    constexpr std::size_t ParallelBlockSize = 16 * 1024;
+
+    /**
+     * @brief Computes the running totals of the elements, each output excluding its own input.
+     *
+     * With a thread pool the blocks are reduced in parallel, their totals scanned on the calling thread, then the
+     * blocks are scanned in parallel starting from the total of the previous ones. Floats summed with std::plus are
+     * scanned SimdFloat4::Width at a time.
+     * @param input Elements to scan.
+     * @param output Running totals, with as many elements as the input, may be the input itself.
+     * @param init Value of the first output.
+     * @param op Associative operation.
+     * @param threadPool Thread pool to scan on, or nullptr to scan on the calling thread.
+     * @remark Floating-point totals are grouped differently with and without a thread pool and may differ slightly.
+     */
+    template <typename T, typename Op = std::plus<>>
+    void ExclusiveScan(std::span<const std::type_identity_t<T>> input, std::span<T> output,
+                       std::type_identity_t<T> init, Op op = {}, ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Copies the elements satisfying a predicate, keeping their order.
+     *
+     * The serial loop writes every element and only advances the output past the kept ones, which doesn't branch on
+     * the predicate. With a thread pool the kept elements of every block are counted first, the blocks then writing
+     * their elements after those of the previous blocks.
+     * @param input Elements to filter.
+     * @param output Kept elements, at least as large as the input and not overlapping it.
+     * @param predicate Function called as predicate(element), returning whether to keep it.
+     * @param threadPool Thread pool to filter on, or nullptr to filter on the calling thread.
+     * @return Number of kept elements.
+     * @remark With a thread pool the predicate is called twice per element.
+     */
+    template <typename T, typename Predicate>
+    std::size_t Compact(std::span<const std::type_identity_t<T>> input, std::span<T> output, Predicate predicate,
+                        ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Computes the running totals of the elements, each output including its own input.
+     * @see ExclusiveScan
+     */
+    template <typename T, typename Op = std::plus<>>
+    void InclusiveScan(std::span<const std::type_identity_t<T>> input, std::span<T> output, Op op = {},
+                       ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Stable sort merging sorted runs two by two.
+     *
+     * Runs of 32 elements are sorted by insertion, then each round merges pairs of runs into a buffer. Every merge is
+     * split in chunks of ParallelBlockSize outputs, the elements of both runs going to a chunk being found by binary
+     * search, so that the rounds merging a few large runs stay parallel.
+     * @param values Elements to sort.
+     * @param compare Strict weak ordering.
+     * @param threadPool Thread pool to sort on, or nullptr to sort on the calling thread.
+     * @param allocator Allocator of the buffer, rebound to T.
+     * @remark T must be default constructible and move assignable.
+     */
+    template <typename T, typename Compare = std::less<>, typename Allocator = std::allocator<std::byte>>
+    void MergeSort(std::span<T> values, Compare compare = {}, ThreadPool* threadPool = nullptr,
+                   const Allocator& allocator = Allocator());
+
+    /**
+     * @brief Stable LSD radix sort of integers or floats by value, one 8-bit digit per pass.
+     *
+     * Signed integers and floats are mapped to unsigned keys sorting in the same order, negative floats sorting
+     * before positive ones (including -0 before +0).
+     * @param values Elements to sort, floats must not be NaN.
+     * @param threadPool Thread pool to sort on, or nullptr to sort on the calling thread.
+     * @param allocator Allocator of the scratch memory.
+     * @return Number of passes, the digits shared by all keys being skipped.
+     * @see RadixSortByKey
+     */
+    template <typename T, typename Allocator = std::allocator<std::byte>>
+    std::size_t RadixSort(std::span<T> values, ThreadPool* threadPool = nullptr,
+                          const Allocator& allocator = Allocator());
+
+    /**
+     * @brief Sorts keys and moves the values along with them.
+     * @param keys Integers or floats to sort by.
+     * @param values Values associated to each key, trivially copyable.
+     * @param threadPool Thread pool to sort on, or nullptr to sort on the calling thread.
+     * @param allocator Allocator of the scratch memory.
+     * @return Number of passes.
+     * @see RadixSort
+     */
+    template <typename K, typename V, typename Allocator = std::allocator<std::byte>>
+    std::size_t RadixSort(std::span<K> keys, std::span<V> values, ThreadPool* threadPool = nullptr,
+                          const Allocator& allocator = Allocator());
+
+    /**
+     * @brief Stable LSD radix sort of elements by an unsigned integer key, one 8-bit digit per pass.
+     *
+     * A first pass finds the bits differing between the keys, digits shared by all of them being skipped. With a
+     * thread pool the array is split in one block per thread, each pass counting the digits of every block in
+     * parallel then scattering them, every block writing the elements of a digit after those of the previous blocks.
+     * @param values Elements to sort, trivially copyable.
+     * @param getKey Function called as getKey(element), returning its unsigned integer key.
+     * @param threadPool Thread pool to sort on, or nullptr to sort on the calling thread.
+     * @param allocator Allocator of the scratch memory.
+     * @return Number of passes.
+     */
+    template <typename T, typename GetKey, typename Allocator = std::allocator<std::byte>>
+    std::size_t RadixSortByKey(std::span<T> values, GetKey getKey, ThreadPool* threadPool = nullptr,
+                               const Allocator& allocator = Allocator());
+
+    /**
+     * @brief Combines all the elements with an operation.
+     *
+     * With a thread pool every block is reduced in parallel, then the block results in order. Floats summed with
+     * std::plus are accumulated in several SimdFloat4 at once.
+     * @param values Elements to reduce.
+     * @param init Value the elements are combined with.
+     * @param op Associative and commutative operation.
+     * @param threadPool Thread pool to reduce on, or nullptr to reduce on the calling thread.
+     * @return Result of the reduction, init if there are no elements.
+     * @remark Floating-point sums are grouped differently with and without a thread pool and may differ slightly.
+     */
+    template <typename T, typename Op = std::plus<>>
+    T Reduce(std::span<const std::type_identity_t<T>> values, T init, Op op = {}, ThreadPool* threadPool = nullptr);
+
+    /**
+     * @brief Moves the elements satisfying a predicate before the others, keeping their order in both groups.
+     *
+     * On the calling thread, trivially copyable elements are copied to both groups without branching on the
+     * predicate. With a thread pool the elements of every group are counted per block, then every block scatters
+     * them after those of the previous blocks.
+     * @param values Elements to partition.
+     * @param predicate Function called as predicate(element).
+     * @param threadPool Thread pool to partition on, or nullptr to partition on the calling thread.
+     * @param allocator Allocator of the buffer, rebound to T.
+     * @return Number of elements satisfying the predicate.
+     * @remark T must be default constructible and move assignable. With a thread pool the predicate is called twice
+     * per element.
+     */
+    template <typename T, typename Predicate, typename Allocator = std::allocator<std::byte>>
+    std::size_t StablePartition(std::span<T> values, Predicate predicate, ThreadPool* threadPool = nullptr,
+                                const Allocator& allocator = Allocator());
+} // namespace Fl
+
+#include <FlashlightEngine/Utility/ParallelAlgorithm.inl>
+
+#endif // FL_UTILITY_PARALLELALGORITHM_HPP
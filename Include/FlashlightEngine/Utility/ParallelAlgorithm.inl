@@ -0,0 +1,661 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Utility/ParallelAlgorithm.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace Fl {
+    namespace Detail {
+        constexpr std::size_t MergeSortRunSize = 32;
+
+        template <typename T, typename Op>
+        constexpr bool IsSimdFloatSum =
+            std::is_same_v<T, float> && (std::is_same_v<Op, std::plus<>> || std::is_same_v<Op, std::plus<float>>);
+
+        /**
+         * @brief Uninitialized array of trivially copyable elements obtained from a rebound allocator.
+         */
+        template <typename T, typename Allocator>
+        class ScratchArray {
+            using AllocatorType = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+            using Traits = std::allocator_traits<AllocatorType>;
+
+            static_assert(std::is_trivially_copyable_v<T>, "Scratch arrays hold trivially copyable elements.");
+
+        public:
+            ScratchArray(const std::size_t size, const Allocator& allocator) :
+            m_allocator(allocator),
+            m_data(Traits::allocate(m_allocator, size)),
+            m_size(size) {
+            }
+
+            ScratchArray(const ScratchArray&) = delete;
+            ScratchArray(ScratchArray&&) = delete;
+
+            ~ScratchArray() {
+                Traits::deallocate(m_allocator, m_data, m_size);
+            }
+
+            T* GetData() const {
+                return m_data;
+            }
+
+            std::span<T> GetSpan() const {
+                return {m_data, m_size};
+            }
+
+            ScratchArray& operator=(const ScratchArray&) = delete;
+            ScratchArray& operator=(ScratchArray&&) = delete;
+
+            T& operator[](const std::size_t index) const {
+                return m_data[index];
+            }
+
+        private:
+            AllocatorType m_allocator;
+            T* m_data;
+            std::size_t m_size;
+        };
+
+        /**
+         * @brief Splits [0, count) in blocks, processed by the thread pool or in order on the calling thread.
+         * @param func Function called as func(block, first, last) for each block.
+         */
+        template <typename F>
+        void ForEachBlock(ThreadPool* threadPool, const std::size_t count, const std::size_t blockSize, F&& func) {
+            const auto processBlocks = [&](const std::size_t firstBlock, const std::size_t lastBlock) {
+                for (std::size_t block = firstBlock; block < lastBlock; ++block) {
+                    const std::size_t first = block * blockSize;
+                    func(block, first, std::min(first + blockSize, count));
+                }
+            };
+
+            const std::size_t blockCount = (count + blockSize - 1) / blockSize;
+            if (threadPool) {
+                threadPool->ParallelFor(blockCount, 1, processBlocks);
+            } else {
+                processBlocks(0, blockCount);
+            }
+        }
+
+        inline std::size_t GetBlockCount(const std::size_t count) {
+            return (count + ParallelBlockSize - 1) / ParallelBlockSize;
+        }
+
+        template <typename T, typename Compare>
+        void InsertionSort(const std::span<T> values, Compare& compare) {
+            for (std::size_t i = 1; i < values.size(); ++i) {
+                if (!compare(values[i], values[i - 1])) {
+                    continue;
+                }
+
+                T value = std::move(values[i]);
+
+                std::size_t position = i;
+                for (; position > 0 && compare(value, values[position - 1]); --position) {
+                    values[position] = std::move(values[position - 1]);
+                }
+
+                values[position] = std::move(value);
+            }
+        }
+
+        /**
+         * @brief Finds how many elements of left come before an output index of the stable merge of left and right.
+         */
+        template <typename T, typename Compare>
+        std::size_t MergePathSplit(const std::span<T> left, const std::span<T> right, const std::size_t output,
+                                   Compare& compare) {
+            std::size_t low = (output > right.size()) ? output - right.size() : 0;
+            std::size_t high = std::min(output, left.size());
+            while (low < high) {
+                const std::size_t leftCount = low + (high - low) / 2;
+
+                // Ties go to the left run, its element belongs before the output unless strictly greater
+                if (!compare(right[output - leftCount - 1], left[leftCount])) {
+                    low = leftCount + 1;
+                } else {
+                    high = leftCount;
+                }
+            }
+
+            return low;
+        }
+
+        template <typename T, typename Op>
+        T ReduceRange(const T* values, const std::size_t count, T result, Op& op) {
+            std::size_t i = 0;
+            if constexpr (IsSimdFloatSum<T, Op>) {
+                // Independent accumulators hide the latency of the additions
+                constexpr std::size_t Step = 4 * SimdFloat4::Width;
+                SimdFloat4 sums[4] = {SimdFloat4::Zero(), SimdFloat4::Zero(), SimdFloat4::Zero(), SimdFloat4::Zero()};
+                for (; i + Step <= count; i += Step) {
+                    for (std::size_t sum = 0; sum < 4; ++sum) {
+                        sums[sum] += SimdFloat4::Load(values + i + sum * SimdFloat4::Width);
+                    }
+                }
+
+                result += ((sums[0] + sums[1]) + (sums[2] + sums[3])).HorizontalSum();
+            }
+
+            for (; i < count; ++i) {
+                result = op(std::move(result), values[i]);
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief Scans a range starting from the running total of the elements before it.
+         * @return Running total including the last element of the range.
+         */
+        template <bool Inclusive, typename T, typename Op>
+        T ScanRange(const T* input, T* output, const std::size_t count, T total, Op& op) {
+            std::size_t i = 0;
+            if constexpr (IsSimdFloatSum<T, Op>) {
+                SimdFloat4 totals = SimdFloat4::Splat(total);
+                for (; i + SimdFloat4::Width <= count; i += SimdFloat4::Width) {
+                    // Running totals within the vector in two shifted additions, then offset by the previous ones
+                    SimdFloat4 sums = SimdFloat4::Load(input + i);
+                    sums += sums.template ShiftLanesUp<1>();
+                    sums += sums.template ShiftLanesUp<2>();
+
+                    if constexpr (Inclusive) {
+                        sums += totals;
+                        sums.Store(output + i);
+                        totals = sums.template Broadcast<3>();
+                    } else {
+                        (sums.template ShiftLanesUp<1>() + totals).Store(output + i);
+                        totals = (sums + totals).template Broadcast<3>();
+                    }
+                }
+
+                total = totals.GetX();
+            }
+
+            for (; i < count; ++i) {
+                if constexpr (Inclusive) {
+                    total = op(std::move(total), input[i]);
+                    output[i] = total;
+                } else {
+                    T value = input[i];
+                    output[i] = total;
+                    total = op(std::move(total), std::move(value));
+                }
+            }
+
+            return total;
+        }
+
+        template <bool Inclusive, typename T, typename Op>
+        void Scan(const std::span<const T> input, const std::span<T> output, T init, Op& op, ThreadPool* threadPool) {
+            FlAssertMsg(output.size() == input.size(), "[Utility/ParallelAlgorithm] Output and input sizes differ.");
+
+            const std::size_t count = input.size();
+            const std::size_t blockCount = GetBlockCount(count);
+            if (!threadPool || blockCount < 2) {
+                ScanRange<Inclusive>(input.data(), output.data(), count, std::move(init), op);
+                return;
+            }
+
+            // Totals of every block, turned into the running total before each of them
+            SmallVector<T, 64> totals(blockCount, init);
+            ForEachBlock(threadPool, count, ParallelBlockSize,
+                         [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                             totals[block] = ReduceRange(input.data() + first + 1, last - first - 1, input[first], op);
+                         });
+
+            T total = std::move(init);
+            for (T& blockTotal : totals) {
+                T blockSum = std::move(blockTotal);
+                blockTotal = total;
+                total = op(std::move(total), std::move(blockSum));
+            }
+
+            ForEachBlock(threadPool, count, ParallelBlockSize,
+                         [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                             ScanRange<Inclusive>(input.data() + first, output.data() + first, last - first,
+                                                  totals[block], op);
+                         });
+        }
+
+        template <typename T>
+        auto ToRadixKey(const T value) {
+            static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "Radix keys must be numbers.");
+
+            if constexpr (std::is_floating_point_v<T>) {
+                using Key = std::conditional_t<sizeof(T) == sizeof(UInt32), UInt32, UInt64>;
+                static_assert(sizeof(T) == sizeof(Key), "Unsupported floating-point type.");
+
+                // Negative floats sort backward, all their bits are flipped, positive ones only get the sign bit
+                constexpr Key SignBit = Key(1) << (sizeof(Key) * 8 - 1);
+                const Key bits = BitCast<Key>(value);
+                return static_cast<Key>(bits ^ (static_cast<Key>(Key(0) - (bits >> (sizeof(Key) * 8 - 1))) | SignBit));
+            } else if constexpr (std::is_signed_v<T>) {
+                using Key = std::make_unsigned_t<T>;
+
+                constexpr Key SignBit = Key(1) << (sizeof(Key) * 8 - 1);
+                return static_cast<Key>(static_cast<Key>(value) ^ SignBit);
+            } else {
+                return value;
+            }
+        }
+    } // namespace Detail
+
+    template <typename T, typename Predicate>
+    std::size_t Compact(const std::span<const std::type_identity_t<T>> input, const std::span<T> output,
+                        Predicate predicate, ThreadPool* threadPool) {
+        FlAssertMsg(output.size() >= input.size(), "[Utility/ParallelAlgorithm] Output is smaller than the input.");
+
+        // Every element is written, the next one overwriting it unless it was kept. The write index never passes
+        // the read index, so it stays within the output
+        const auto compactRange = [&](const std::size_t first, const std::size_t last, std::size_t outputIndex) {
+            for (std::size_t i = first; i < last; ++i) {
+                output[outputIndex] = input[i];
+                outputIndex += predicate(input[i]) ? 1 : 0;
+            }
+
+            return outputIndex;
+        };
+
+        const std::size_t count = input.size();
+        if (!threadPool || Detail::GetBlockCount(count) < 2) {
+            return compactRange(0, count, 0);
+        }
+
+        // A block writes a rejected element past its last kept one, where the next block starts, so it stops there
+        SmallVector<std::size_t, 64> offsets(Detail::GetBlockCount(count));
+        SmallVector<std::size_t, 64> keptEnds(Detail::GetBlockCount(count));
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 std::size_t keptCount = 0;
+                                 std::size_t keptEnd = first;
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     const bool isKept = predicate(input[i]);
+                                     keptCount += isKept ? 1 : 0;
+                                     keptEnd = isKept ? i + 1 : keptEnd;
+                                 }
+
+                                 offsets[block] = keptCount;
+                                 keptEnds[block] = keptEnd;
+                             });
+
+        std::size_t keptCount = 0;
+        for (std::size_t& offset : offsets) {
+            const std::size_t blockKeptCount = offset;
+            offset = keptCount;
+            keptCount += blockKeptCount;
+        }
+
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](const std::size_t block, const std::size_t first, std::size_t) {
+                                 compactRange(first, keptEnds[block], offsets[block]);
+                             });
+
+        return keptCount;
+    }
+
+    template <typename T, typename Op>
+    void ExclusiveScan(const std::span<const std::type_identity_t<T>> input, const std::span<T> output,
+                       std::type_identity_t<T> init, Op op, ThreadPool* threadPool) {
+        Detail::Scan<false>(input, output, std::move(init), op, threadPool);
+    }
+
+    template <typename T, typename Op>
+    void InclusiveScan(const std::span<const std::type_identity_t<T>> input, const std::span<T> output, Op op,
+                       ThreadPool* threadPool) {
+        if (input.empty()) {
+            return;
+        }
+
+        // The first element is the initial total of the others
+        output[0] = input[0];
+        Detail::Scan<true>(input.subspan(1), output.subspan(1), T(output[0]), op, threadPool);
+    }
+
+    template <typename T, typename Compare, typename Allocator>
+    void MergeSort(const std::span<T> values, Compare compare, ThreadPool* threadPool, const Allocator& allocator) {
+        constexpr std::size_t RunSize = Detail::MergeSortRunSize;
+
+        const std::size_t count = values.size();
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](std::size_t, const std::size_t first, const std::size_t last) {
+                                 for (std::size_t run = first; run < last; run += RunSize) {
+                                     Detail::InsertionSort(values.subspan(run, std::min(RunSize, last - run)), compare);
+                                 }
+                             });
+
+        if (count <= RunSize) {
+            return;
+        }
+
+        using BufferAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+        std::vector<T, BufferAllocator> buffer(count, BufferAllocator(allocator));
+
+        std::span<T> source = values;
+        std::span<T> destination(buffer);
+        for (std::size_t runSize = RunSize; runSize < count; runSize *= 2) {
+            // Large merges are split in chunks, small ones are grouped in batches of about ParallelBlockSize elements
+            const std::size_t mergeSize = 2 * runSize;
+            const std::size_t mergeCount = (count + mergeSize - 1) / mergeSize;
+            const std::size_t chunkCount = std::max<std::size_t>(mergeSize / ParallelBlockSize, 1);
+            const std::size_t batchSize = std::max<std::size_t>(ParallelBlockSize / mergeSize, 1);
+
+            const auto getRuns = [&](const std::size_t task) {
+                const std::size_t begin = (task / chunkCount) * mergeSize;
+                const std::size_t middle = std::min(begin + runSize, count);
+                const std::size_t end = std::min(begin + mergeSize, count);
+
+                return std::pair(source.subspan(begin, middle - begin), source.subspan(middle, end - middle));
+            };
+
+            // Chunk boundaries are all found first, merging moves the elements out of the runs
+            SmallVector<std::size_t, 64> chunkSplits((chunkCount > 1) ? mergeCount * chunkCount : 0);
+            const auto splitChunks = [&](const std::size_t firstTask, const std::size_t lastTask) {
+                for (std::size_t task = firstTask; task < lastTask; ++task) {
+                    const auto [left, right] = getRuns(task);
+                    const std::size_t firstOutput = (left.size() + right.size()) * (task % chunkCount) / chunkCount;
+                    chunkSplits[task] = Detail::MergePathSplit(left, right, firstOutput, compare);
+                }
+            };
+
+            const auto mergeChunks = [&](const std::size_t firstTask, const std::size_t lastTask) {
+                for (std::size_t task = firstTask; task < lastTask; ++task) {
+                    const auto [left, right] = getRuns(task);
+                    const std::size_t size = left.size() + right.size();
+
+                    const std::size_t chunk = task % chunkCount;
+                    const std::size_t firstOutput = size * chunk / chunkCount;
+                    const std::size_t lastOutput = size * (chunk + 1) / chunkCount;
+                    const std::size_t firstLeft = (chunkCount > 1) ? chunkSplits[task] : 0;
+                    const std::size_t lastLeft = (chunk + 1 < chunkCount) ? chunkSplits[task + 1] : left.size();
+
+                    std::merge(std::make_move_iterator(left.data() + firstLeft),
+                               std::make_move_iterator(left.data() + lastLeft),
+                               std::make_move_iterator(right.data() + (firstOutput - firstLeft)),
+                               std::make_move_iterator(right.data() + (lastOutput - lastLeft)),
+                               destination.data() + (left.data() - source.data()) + firstOutput, compare);
+                }
+            };
+
+            if (threadPool) {
+                if (chunkCount > 1) {
+                    threadPool->ParallelFor(mergeCount * chunkCount, 1, splitChunks);
+                }
+
+                threadPool->ParallelFor(mergeCount * chunkCount, batchSize, mergeChunks);
+            } else {
+                if (chunkCount > 1) {
+                    splitChunks(0, mergeCount * chunkCount);
+                }
+
+                mergeChunks(0, mergeCount * chunkCount);
+            }
+
+            std::swap(source, destination);
+        }
+
+        if (source.data() != values.data()) {
+            Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                                 [&](std::size_t, const std::size_t first, const std::size_t last) {
+                                     std::move(source.data() + first, source.data() + last, values.data() + first);
+                                 });
+        }
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t RadixSort(const std::span<T> values, ThreadPool* threadPool, const Allocator& allocator) {
+        return RadixSortByKey(values, [](const T value) { return Detail::ToRadixKey(value); }, threadPool, allocator);
+    }
+
+    template <typename K, typename V, typename Allocator>
+    std::size_t RadixSort(const std::span<K> keys, const std::span<V> values, ThreadPool* threadPool,
+                          const Allocator& allocator) {
+        FlAssertMsg(keys.size() == values.size(), "[Utility/ParallelAlgorithm] Keys and values sizes differ.");
+
+        struct Element {
+            K key;
+            V value;
+        };
+
+        // Keys and values are interleaved so that each pass moves them at once
+        const std::size_t count = keys.size();
+        Detail::ScratchArray<Element, Allocator> elements(count, allocator);
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](std::size_t, const std::size_t first, const std::size_t last) {
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     elements[i] = {keys[i], values[i]};
+                                 }
+                             });
+
+        const std::size_t passCount = RadixSortByKey(
+            elements.GetSpan(), [](const Element& element) { return Detail::ToRadixKey(element.key); }, threadPool,
+            allocator);
+
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](std::size_t, const std::size_t first, const std::size_t last) {
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     keys[i] = elements[i].key;
+                                     values[i] = elements[i].value;
+                                 }
+                             });
+
+        return passCount;
+    }
+
+    template <typename T, typename GetKey, typename Allocator>
+    std::size_t RadixSortByKey(const std::span<T> values, GetKey getKey, ThreadPool* threadPool,
+                               const Allocator& allocator) {
+        using Key = std::remove_cvref_t<std::invoke_result_t<GetKey&, const T&>>;
+        using Histogram = std::array<std::size_t, 256>;
+        static_assert(std::is_unsigned_v<Key> && !std::is_same_v<Key, bool>, "Keys must be unsigned integers.");
+        static_assert(std::is_trivially_copyable_v<T>, "Sorted elements must be trivially copyable.");
+
+        const std::size_t count = values.size();
+        if (count < 2) {
+            return 0;
+        }
+
+        // One block per thread, histograms being per block and not per batch
+        const std::size_t maxBlockCount = threadPool ? threadPool->GetWorkerCount() + 1 : 1;
+        const std::size_t blockCount = std::clamp<std::size_t>(count / ParallelBlockSize, 1, maxBlockCount);
+        const std::size_t blockSize = (count + blockCount - 1) / blockCount;
+
+        // Bits differing from the first key somewhere in the array
+        const Key firstKey = getKey(values[0]);
+        Detail::ScratchArray<Key, Allocator> blockDifferences(blockCount, allocator);
+        Detail::ForEachBlock(threadPool, count, blockSize,
+                             [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 Key differences = 0;
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     differences |= static_cast<Key>(getKey(values[i]) ^ firstKey);
+                                 }
+
+                                 blockDifferences[block] = differences;
+                             });
+
+        Key differences = 0;
+        for (std::size_t block = 0; block < blockCount; ++block) {
+            differences |= blockDifferences[block];
+        }
+
+        Detail::ScratchArray<T, Allocator> scratch(count, allocator);
+        Detail::ScratchArray<Histogram, Allocator> histograms(blockCount, allocator);
+        T* source = values.data();
+        T* destination = scratch.GetData();
+
+        std::size_t passCount = 0;
+        for (std::size_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+            if (((differences >> shift) & 0xFF) == 0) {
+                continue;
+            }
+
+            Detail::ForEachBlock(threadPool, count, blockSize,
+                                 [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                     Histogram& histogram = histograms[block];
+                                     histogram.fill(0);
+                                     for (std::size_t i = first; i < last; ++i) {
+                                         ++histogram[(getKey(source[i]) >> shift) & 0xFF];
+                                     }
+                                 });
+
+            // Each block writes its elements of a digit after those of the previous blocks
+            std::size_t offset = 0;
+            for (std::size_t digit = 0; digit < 256; ++digit) {
+                for (std::size_t block = 0; block < blockCount; ++block) {
+                    const std::size_t digitCount = histograms[block][digit];
+                    histograms[block][digit] = offset;
+                    offset += digitCount;
+                }
+            }
+
+            Detail::ForEachBlock(threadPool, count, blockSize,
+                                 [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                     Histogram& offsets = histograms[block];
+                                     for (std::size_t i = first; i < last; ++i) {
+                                         destination[offsets[(getKey(source[i]) >> shift) & 0xFF]++] = source[i];
+                                     }
+                                 });
+
+            std::swap(source, destination);
+            ++passCount;
+        }
+
+        // An odd number of passes leaves the elements in the scratch memory
+        if (source != values.data()) {
+            Detail::ForEachBlock(threadPool, count, blockSize,
+                                 [&](std::size_t, const std::size_t first, const std::size_t last) {
+                                     std::memcpy(values.data() + first, source + first, (last - first) * sizeof(T));
+                                 });
+        }
+
+        return passCount;
+    }
+
+    template <typename T, typename Op>
+    T Reduce(const std::span<const std::type_identity_t<T>> values, T init, Op op, ThreadPool* threadPool) {
+        const std::size_t count = values.size();
+        if (!threadPool || Detail::GetBlockCount(count) < 2) {
+            return Detail::ReduceRange(values.data(), count, std::move(init), op);
+        }
+
+        SmallVector<T, 64> totals(Detail::GetBlockCount(count), init);
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 totals[block] = Detail::ReduceRange(values.data() + first + 1, last - first - 1,
+                                                                     values[first], op);
+                             });
+
+        for (T& total : totals) {
+            init = op(std::move(init), std::move(total));
+        }
+
+        return init;
+    }
+
+    template <typename T, typename Predicate, typename Allocator>
+    std::size_t StablePartition(const std::span<T> values, Predicate predicate, ThreadPool* threadPool,
+                                const Allocator& allocator) {
+        using BufferAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+        const std::size_t count = values.size();
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (!threadPool || Detail::GetBlockCount(count) < 2) {
+                // Every element is copied to both groups, only the end of its own group moving forward. Kept elements
+                // are written in place, never past the one being read
+                Detail::ScratchArray<T, Allocator> rejected(count, allocator);
+
+                std::size_t keptCount = 0;
+                std::size_t rejectedCount = 0;
+                for (std::size_t i = 0; i < count; ++i) {
+                    const T value = values[i];
+                    const bool isKept = predicate(value);
+
+                    values[keptCount] = value;
+                    rejected[rejectedCount] = value;
+                    keptCount += isKept ? 1 : 0;
+                    rejectedCount += isKept ? 0 : 1;
+                }
+
+                if (rejectedCount > 0) {
+                    std::memcpy(values.data() + keptCount, rejected.GetData(), rejectedCount * sizeof(T));
+                }
+
+                return keptCount;
+            }
+        }
+
+        std::vector<T, BufferAllocator> buffer{BufferAllocator(allocator)};
+        if (!threadPool || Detail::GetBlockCount(count) < 2) {
+            // Kept elements move toward the front in place, the others wait in the buffer
+            buffer.reserve(count);
+
+            std::size_t keptCount = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!predicate(values[i])) {
+                    buffer.push_back(std::move(values[i]));
+                } else if (keptCount++ != i) {
+                    values[keptCount - 1] = std::move(values[i]);
+                }
+            }
+
+            std::move(buffer.begin(), buffer.end(), values.data() + keptCount);
+            return keptCount;
+        }
+
+        SmallVector<std::size_t, 64> keptOffsets(Detail::GetBlockCount(count));
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 std::size_t keptCount = 0;
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     keptCount += predicate(values[i]) ? 1 : 0;
+                                 }
+
+                                 keptOffsets[block] = keptCount;
+                             });
+
+        std::size_t keptCount = 0;
+        for (std::size_t& offset : keptOffsets) {
+            const std::size_t blockKeptCount = offset;
+            offset = keptCount;
+            keptCount += blockKeptCount;
+        }
+
+        // Both groups of every block are scattered after those of the previous blocks, then moved back
+        buffer.resize(count);
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](const std::size_t block, const std::size_t first, const std::size_t last) {
+                                 std::size_t keptIndex = keptOffsets[block];
+                                 std::size_t rejectedIndex = keptCount + first - keptOffsets[block];
+                                 for (std::size_t i = first; i < last; ++i) {
+                                     if (predicate(values[i])) {
+                                         buffer[keptIndex++] = std::move(values[i]);
+                                     } else {
+                                         buffer[rejectedIndex++] = std::move(values[i]);
+                                     }
+                                 }
+                             });
+
+        Detail::ForEachBlock(threadPool, count, ParallelBlockSize,
+                             [&](std::size_t, const std::size_t first, const std::size_t last) {
+                                 std::move(buffer.data() + first, buffer.data() + last, values.data() + first);
+                             });
+
+        return keptCount;
+    }
+} // namespace Fl
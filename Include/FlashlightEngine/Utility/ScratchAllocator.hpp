@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_UTILITY_SCRATCHALLOCATOR_HPP
+#define FL_UTILITY_SCRATCHALLOCATOR_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Fl {
+    /**
+     * @brief Memory arena handing out temporary buffers by bumping an offset in a single block.
+     *
+     * Allocations not fitting in the block get their own memory. Once every allocation was released the arena
+     * rewinds, and grows its block to the largest amount used at once so that the next uses fit in it. Algorithms
+     * called every frame thus stop allocating after the first few frames.
+     * @remark Not thread-safe, allocations must come from a single thread at a time.
+     */
+    class FL_API ScratchBuffer {
+    public:
+        ScratchBuffer() = default;
+        ScratchBuffer(const ScratchBuffer&) = delete;
+        ScratchBuffer(ScratchBuffer&&) = delete; //< Allocators point to their buffer
+        ~ScratchBuffer();
+
+        /**
+         * @brief Allocates uninitialized memory.
+         * @param size Size in bytes.
+         * @param alignment Alignment in bytes, a power of two up to BlockAlignment.
+         * @return Pointer to the memory, released with Deallocate().
+         */
+        void* Allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Releases memory returned by Allocate(), rewinding the arena if it was the last allocation alive.
+         */
+        void Deallocate(void* pointer);
+
+        inline std::size_t GetCapacity() const;
+
+        ScratchBuffer& operator=(const ScratchBuffer&) = delete;
+        ScratchBuffer& operator=(ScratchBuffer&&) = delete;
+
+        static constexpr std::size_t BlockAlignment = 64;
+
+    private:
+        void Rewind();
+
+        std::vector<void*> m_overflowBlocks;
+        std::byte* m_block = nullptr;
+        std::size_t m_capacity = 0;
+        std::size_t m_offset = 0;
+        std::size_t m_usedSize = 0;
+        std::size_t m_allocationCount = 0;
+    };
+
+    /**
+     * @brief Standard allocator adapter allocating from a ScratchBuffer.
+     * @tparam T Type of the elements.
+     */
+    template <typename T>
+    class ScratchAllocator {
+    public:
+        using value_type = T;
+
+        inline explicit ScratchAllocator(ScratchBuffer& buffer) noexcept;
+        template <typename U>
+        ScratchAllocator(const ScratchAllocator<U>& allocator) noexcept;
+
+        T* allocate(std::size_t count);
+        void deallocate(T* pointer, std::size_t count) noexcept;
+
+        inline ScratchBuffer& GetBuffer() const noexcept;
+
+        template <typename U>
+        bool operator==(const ScratchAllocator<U>& allocator) const noexcept;
+
+    private:
+        ScratchBuffer* m_buffer;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Utility/ScratchAllocator.inl>
+
+#endif // FL_UTILITY_SCRATCHALLOCATOR_HPP
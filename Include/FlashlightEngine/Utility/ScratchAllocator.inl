@@ -0,0 +1,45 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Utility/ScratchAllocator.hpp>
+
+namespace Fl {
+    inline std::size_t ScratchBuffer::GetCapacity() const {
+        return m_capacity;
+    }
+
+    template <typename T>
+    ScratchAllocator<T>::ScratchAllocator(ScratchBuffer& buffer) noexcept :
+    m_buffer(&buffer) {
+    }
+
+    template <typename T>
+    template <typename U>
+    ScratchAllocator<T>::ScratchAllocator(const ScratchAllocator<U>& allocator) noexcept :
+    m_buffer(&allocator.GetBuffer()) {
+    }
+
+    template <typename T>
+    T* ScratchAllocator<T>::allocate(const std::size_t count) {
+        return static_cast<T*>(m_buffer->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    template <typename T>
+    void ScratchAllocator<T>::deallocate(T* pointer, std::size_t) noexcept {
+        m_buffer->Deallocate(pointer);
+    }
+
+    template <typename T>
+    ScratchBuffer& ScratchAllocator<T>::GetBuffer() const noexcept {
+        return *m_buffer;
+    }
+
+    template <typename T>
+    template <typename U>
+    bool ScratchAllocator<T>::operator==(const ScratchAllocator<U>& allocator) const noexcept {
+        return m_buffer == &allocator.GetBuffer();
+    }
+} // namespace Fl
@@ -0,0 +1,193 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_UTILITY_SMALLVECTOR_HPP
+#define FL_UTILITY_SMALLVECTOR_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+#include <FlashlightEngine/Utility/ConstantEvaluated.hpp>
+#include <FlashlightEngine/Utility/TypeTraits.hpp>
+
+#include <compare>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+namespace Fl {
+    /**
+     * @brief std::vector-like container storing up to N elements inline, spilling to the heap past that.
+     *
+     * Elements are stored contiguously either in the inline buffer or in a heap buffer obtained from the allocator,
+     * the heap is only used when the size grows past N. Relocations of trivially relocatable types are done using
+     * memcpy.
+     * @tparam T Type of the elements.
+     * @tparam N Number of elements stored inline.
+     * @tparam Allocator Allocator used once the inline storage is exhausted.
+     */
+    template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+    class SmallVector {
+        static_assert(N > 0, "SmallVector requires an inline capacity of at least one element.");
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        FL_CONSTEXPR20 SmallVector() noexcept(noexcept(Allocator()));
+        FL_CONSTEXPR20 explicit SmallVector(const Allocator& allocator) noexcept;
+        FL_CONSTEXPR20 explicit SmallVector(size_type count, const Allocator& allocator = Allocator());
+        FL_CONSTEXPR20 SmallVector(size_type count, const T& value, const Allocator& allocator = Allocator());
+        template <std::input_iterator InputIt>
+        FL_CONSTEXPR20 SmallVector(InputIt first, InputIt last, const Allocator& allocator = Allocator());
+        FL_CONSTEXPR20 SmallVector(std::initializer_list<T> list, const Allocator& allocator = Allocator());
+        FL_CONSTEXPR20 SmallVector(const SmallVector& vec);
+        FL_CONSTEXPR20 SmallVector(SmallVector&& vec) noexcept(std::is_nothrow_move_constructible_v<T>);
+        FL_CONSTEXPR20 ~SmallVector();
+
+        FL_CONSTEXPR20 void assign(size_type count, const T& value);
+        template <std::input_iterator InputIt>
+        FL_CONSTEXPR20 void assign(InputIt first, InputIt last);
+        FL_CONSTEXPR20 void assign(std::initializer_list<T> list);
+
+        FL_CONSTEXPR20 reference at(size_type pos);
+        FL_CONSTEXPR20 const_reference at(size_type pos) const;
+
+        FL_CONSTEXPR20 reference back() noexcept;
+        FL_CONSTEXPR20 const_reference back() const noexcept;
+
+        FL_CONSTEXPR20 iterator begin() noexcept;
+        FL_CONSTEXPR20 const_iterator begin() const noexcept;
+
+        FL_CONSTEXPR20 size_type capacity() const noexcept;
+
+        FL_CONSTEXPR20 const_iterator cbegin() const noexcept;
+        FL_CONSTEXPR20 const_iterator cend() const noexcept;
+
+        FL_CONSTEXPR20 void clear() noexcept;
+
+        FL_CONSTEXPR20 const_reverse_iterator crbegin() const noexcept;
+        FL_CONSTEXPR20 const_reverse_iterator crend() const noexcept;
+
+        FL_CONSTEXPR20 T* data() noexcept;
+        FL_CONSTEXPR20 const T* data() const noexcept;
+
+        template <typename... Args>
+        FL_CONSTEXPR20 iterator emplace(const_iterator pos, Args&&... args);
+        template <typename... Args>
+        FL_CONSTEXPR20 T& emplace_back(Args&&... args);
+
+        [[nodiscard]] FL_CONSTEXPR20 bool empty() const noexcept;
+
+        FL_CONSTEXPR20 iterator end() noexcept;
+        FL_CONSTEXPR20 const_iterator end() const noexcept;
+
+        FL_CONSTEXPR20 iterator erase(const_iterator pos);
+        FL_CONSTEXPR20 iterator erase(const_iterator first, const_iterator last);
+
+        FL_CONSTEXPR20 reference front() noexcept;
+        FL_CONSTEXPR20 const_reference front() const noexcept;
+
+        FL_CONSTEXPR20 allocator_type get_allocator() const noexcept;
+
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, const T& value);
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, T&& value);
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, size_type count, const T& value);
+        template <std::input_iterator InputIt>
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, InputIt first, InputIt last);
+        FL_CONSTEXPR20 iterator insert(const_iterator pos, std::initializer_list<T> list);
+
+        /**
+         * @brief Checks whether the elements are currently stored in the inline buffer.
+         * @return True if no heap allocation is currently owned by the vector.
+         */
+        FL_CONSTEXPR20 bool is_inline() const noexcept;
+
+        FL_CONSTEXPR20 size_type max_size() const noexcept;
+
+        FL_CONSTEXPR20 void pop_back();
+
+        FL_CONSTEXPR20 void push_back(const T& value);
+        FL_CONSTEXPR20 void push_back(T&& value);
+
+        FL_CONSTEXPR20 reverse_iterator rbegin() noexcept;
+        FL_CONSTEXPR20 const_reverse_iterator rbegin() const noexcept;
+
+        FL_CONSTEXPR20 reverse_iterator rend() noexcept;
+        FL_CONSTEXPR20 const_reverse_iterator rend() const noexcept;
+
+        FL_CONSTEXPR20 void reserve(size_type capacity);
+
+        FL_CONSTEXPR20 void resize(size_type count);
+        FL_CONSTEXPR20 void resize(size_type count, const T& value);
+
+        /**
+         * @brief Releases unused heap memory, moving the elements back to the inline buffer if they fit.
+         */
+        FL_CONSTEXPR20 void shrink_to_fit();
+
+        FL_CONSTEXPR20 size_type size() const noexcept;
+
+        FL_CONSTEXPR20 void swap(SmallVector& other);
+
+        FL_CONSTEXPR20 T& operator[](size_type pos) noexcept;
+        FL_CONSTEXPR20 const T& operator[](size_type pos) const noexcept;
+
+        FL_CONSTEXPR20 SmallVector& operator=(const SmallVector& vec);
+        FL_CONSTEXPR20 SmallVector& operator=(SmallVector&& vec) noexcept(std::is_nothrow_move_constructible_v<T>);
+        FL_CONSTEXPR20 SmallVector& operator=(std::initializer_list<T> list);
+
+        static constexpr size_type InlineCapacity = N;
+
+    private:
+        using AllocatorTraits = std::allocator_traits<Allocator>;
+
+        FL_CONSTEXPR20 void DestroyAndDeallocate() noexcept;
+        FL_CONSTEXPR20 size_type GrowCapacity(size_type minCapacity) const noexcept;
+        FL_CONSTEXPR20 T* InlineData() noexcept;
+        FL_CONSTEXPR20 const T* InlineData() const noexcept;
+        FL_CONSTEXPR20 T* MakeGap(size_type index, size_type count);
+        FL_CONSTEXPR20 void Reallocate(size_type capacity);
+        FL_CONSTEXPR20 void StealOrRelocate(SmallVector& vec) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        static FL_CONSTEXPR20 void Relocate(T* first, T* last, T* dest) noexcept(std::is_nothrow_move_constructible_v<T>);
+        static FL_CONSTEXPR20 void RelocateBackward(T* first, T* last, T* destLast) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        union Storage {
+            constexpr Storage() noexcept {}
+            constexpr ~Storage() {}
+
+            T data[N];
+        };
+
+        T* m_data;
+        size_type m_size;
+        size_type m_capacity;
+        [[no_unique_address]] Allocator m_allocator;
+        Storage m_storage;
+    };
+
+    template <typename T, std::size_t N, typename A>
+    FL_CONSTEXPR20 bool operator==(const SmallVector<T, N, A>& lhs, const SmallVector<T, N, A>& rhs);
+    template <typename T, std::size_t N, typename A>
+        requires std::three_way_comparable<T>
+    FL_CONSTEXPR20 auto operator<=>(const SmallVector<T, N, A>& lhs, const SmallVector<T, N, A>& rhs);
+
+    template <typename T, std::size_t N, typename A>
+    FL_CONSTEXPR20 void swap(SmallVector<T, N, A>& lhs, SmallVector<T, N, A>& rhs);
+} // namespace Fl
+
+#include <FlashlightEngine/Utility/SmallVector.inl>
+
+#endif // FL_UTILITY_SMALLVECTOR_HPP
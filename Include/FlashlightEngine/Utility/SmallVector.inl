@@ -0,0 +1,677 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace Fl {
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector() noexcept(noexcept(Allocator())) :
+        SmallVector(Allocator()) {
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector(const Allocator& allocator) noexcept :
+        m_data(m_storage.data), m_size(0), m_capacity(N), m_allocator(allocator) {
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector(const size_type count, const Allocator& allocator) :
+        SmallVector(allocator) {
+        resize(count);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector(const size_type count, const T& value,
+                                                             const Allocator& allocator) :
+        SmallVector(allocator) {
+        resize(count, value);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    template <std::input_iterator InputIt>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector(InputIt first, InputIt last,
+                                                             const Allocator& allocator) :
+        SmallVector(allocator) {
+        insert(end(), first, last);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector(std::initializer_list<T> list,
+                                                             const Allocator& allocator) :
+        SmallVector(list.begin(), list.end(), allocator) {
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector(const SmallVector& vec) :
+        SmallVector(vec.begin(), vec.end(), AllocatorTraits::select_on_container_copy_construction(vec.m_allocator)) {
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::SmallVector(SmallVector&& vec) noexcept(
+        std::is_nothrow_move_constructible_v<T>) :
+        SmallVector(std::move(vec.m_allocator)) {
+        StealOrRelocate(vec);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>::~SmallVector() {
+        DestroyAndDeallocate();
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::assign(const size_type count, const T& value) {
+        T copy(value); //< value may be one of our elements
+        clear();
+        resize(count, copy);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    template <std::input_iterator InputIt>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::assign(InputIt first, InputIt last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::assign(std::initializer_list<T> list) {
+        assign(list.begin(), list.end());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::at(const size_type pos) -> reference {
+        if (pos >= m_size) {
+            throw std::out_of_range("SmallVector::at: index out of range");
+        }
+
+        return m_data[pos];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::at(const size_type pos) const -> const_reference {
+        if (pos >= m_size) {
+            throw std::out_of_range("SmallVector::at: index out of range");
+        }
+
+        return m_data[pos];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::back() noexcept -> reference {
+        FlAssertMsg(m_size > 0, "[Utility/SmallVector] back() called on an empty vector.");
+        return m_data[m_size - 1];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::back() const noexcept -> const_reference {
+        FlAssertMsg(m_size > 0, "[Utility/SmallVector] back() called on an empty vector.");
+        return m_data[m_size - 1];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::begin() noexcept -> iterator {
+        return m_data;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::begin() const noexcept -> const_iterator {
+        return m_data;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::capacity() const noexcept -> size_type {
+        return m_capacity;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::cbegin() const noexcept -> const_iterator {
+        return m_data;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::cend() const noexcept -> const_iterator {
+        return m_data + m_size;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::clear() noexcept {
+        std::destroy(m_data, m_data + m_size);
+        m_size = 0;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::crbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(cend());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::crend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(cbegin());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 T* SmallVector<T, N, Allocator>::data() noexcept {
+        return m_data;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 const T* SmallVector<T, N, Allocator>::data() const noexcept {
+        return m_data;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    template <typename... Args>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::emplace(const_iterator pos, Args&&... args) -> iterator {
+        const size_type index = static_cast<size_type>(pos - m_data);
+        FlAssertMsg(index <= m_size, "[Utility/SmallVector] Iterator out of range.");
+
+        if (index == m_size) {
+            emplace_back(std::forward<Args>(args)...);
+            return m_data + index;
+        }
+
+        T value(std::forward<Args>(args)...); //< args may reference one of our elements
+        T* gap = MakeGap(index, 1);
+        std::construct_at(gap, std::move(value));
+        ++m_size;
+
+        return gap;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    template <typename... Args>
+    FL_CONSTEXPR20 T& SmallVector<T, N, Allocator>::emplace_back(Args&&... args) {
+        if FL_LIKELY (m_size < m_capacity) {
+            T* element = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+            ++m_size;
+
+            return *element;
+        }
+
+        // Construct the new element before relocating the old ones, as args may reference them
+        const size_type newCapacity = GrowCapacity(m_size + 1);
+        T* newData = AllocatorTraits::allocate(m_allocator, newCapacity);
+        T* element = std::construct_at(newData + m_size, std::forward<Args>(args)...);
+        Relocate(m_data, m_data + m_size, newData);
+
+        if (!is_inline()) {
+            AllocatorTraits::deallocate(m_allocator, m_data, m_capacity);
+        }
+
+        m_data = newData;
+        m_capacity = newCapacity;
+        ++m_size;
+
+        return *element;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 bool SmallVector<T, N, Allocator>::empty() const noexcept {
+        return m_size == 0;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::end() noexcept -> iterator {
+        return m_data + m_size;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::end() const noexcept -> const_iterator {
+        return m_data + m_size;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::erase(const_iterator pos) -> iterator {
+        return erase(pos, pos + 1);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::erase(const_iterator first, const_iterator last) -> iterator {
+        const size_type index = static_cast<size_type>(first - m_data);
+        const size_type count = static_cast<size_type>(last - first);
+        FlAssertMsg(first <= last && index + count <= m_size, "[Utility/SmallVector] Iterator out of range.");
+
+        T* eraseFirst = m_data + index;
+        std::destroy(eraseFirst, eraseFirst + count);
+        Relocate(eraseFirst + count, m_data + m_size, eraseFirst);
+        m_size -= count;
+
+        return eraseFirst;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::front() noexcept -> reference {
+        FlAssertMsg(m_size > 0, "[Utility/SmallVector] front() called on an empty vector.");
+        return m_data[0];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::front() const noexcept -> const_reference {
+        FlAssertMsg(m_size > 0, "[Utility/SmallVector] front() called on an empty vector.");
+        return m_data[0];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::get_allocator() const noexcept -> allocator_type {
+        return m_allocator;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::insert(const_iterator pos, const T& value) -> iterator {
+        return emplace(pos, value);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::insert(const_iterator pos, T&& value) -> iterator {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::insert(const_iterator pos, const size_type count,
+                                                             const T& value) -> iterator {
+        const size_type index = static_cast<size_type>(pos - m_data);
+        FlAssertMsg(index <= m_size, "[Utility/SmallVector] Iterator out of range.");
+
+        if (count == 0) {
+            return m_data + index;
+        }
+
+        T copy(value); //< value may be one of our elements
+        T* gap = MakeGap(index, count);
+        for (size_type i = 0; i < count; ++i) {
+            std::construct_at(gap + i, copy);
+        }
+
+        m_size += count;
+
+        return gap;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    template <std::input_iterator InputIt>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::insert(const_iterator pos, InputIt first, InputIt last)
+        -> iterator {
+        const size_type index = static_cast<size_type>(pos - m_data);
+        FlAssertMsg(index <= m_size, "[Utility/SmallVector] Iterator out of range.");
+
+        if constexpr (std::forward_iterator<InputIt>) {
+            const auto count = static_cast<size_type>(std::distance(first, last));
+            if (count == 0) {
+                return m_data + index;
+            }
+
+            T* gap = MakeGap(index, count);
+            for (size_type i = 0; i < count; ++i, ++first) {
+                std::construct_at(gap + i, *first);
+            }
+
+            m_size += count;
+
+            return gap;
+        } else {
+            // Single pass iterators: append then rotate into place
+            const size_type oldSize = m_size;
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+
+            std::rotate(m_data + index, m_data + oldSize, m_data + m_size);
+
+            return m_data + index;
+        }
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::insert(const_iterator pos, std::initializer_list<T> list)
+        -> iterator {
+        return insert(pos, list.begin(), list.end());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 bool SmallVector<T, N, Allocator>::is_inline() const noexcept {
+        return m_data == InlineData();
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::max_size() const noexcept -> size_type {
+        return AllocatorTraits::max_size(m_allocator);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::pop_back() {
+        FlAssertMsg(m_size > 0, "[Utility/SmallVector] pop_back() called on an empty vector.");
+
+        --m_size;
+        std::destroy_at(m_data + m_size);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::reserve(const size_type capacity) {
+        if (capacity <= m_capacity) {
+            return;
+        }
+
+        if (capacity > max_size()) {
+            throw std::length_error("SmallVector::reserve: capacity exceeds max_size()");
+        }
+
+        Reallocate(capacity);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::resize(const size_type count) {
+        if (count < m_size) {
+            std::destroy(m_data + count, m_data + m_size);
+        } else if (count > m_size) {
+            if (count > m_capacity) {
+                Reallocate(GrowCapacity(count));
+            }
+
+            for (size_type i = m_size; i < count; ++i) {
+                std::construct_at(m_data + i);
+            }
+        }
+
+        m_size = count;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::resize(const size_type count, const T& value) {
+        if (count < m_size) {
+            std::destroy(m_data + count, m_data + m_size);
+            m_size = count;
+        } else if (count > m_size) {
+            insert(end(), count - m_size, value);
+        }
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::shrink_to_fit() {
+        if (is_inline() || m_size == m_capacity) {
+            return;
+        }
+
+        Reallocate(std::max(m_size, N));
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::size() const noexcept -> size_type {
+        return m_size;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::swap(SmallVector& other) {
+        if (this == &other) {
+            return;
+        }
+
+        if (!is_inline() && !other.is_inline()) {
+            // Both on the heap, no element has to move
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+
+            if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+                std::swap(m_allocator, other.m_allocator);
+            }
+
+            return;
+        }
+
+        SmallVector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 T& SmallVector<T, N, Allocator>::operator[](const size_type pos) noexcept {
+        FlAssertMsg(pos < m_size, "[Utility/SmallVector] Index out of range.");
+        return m_data[pos];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 const T& SmallVector<T, N, Allocator>::operator[](const size_type pos) const noexcept {
+        FlAssertMsg(pos < m_size, "[Utility/SmallVector] Index out of range.");
+        return m_data[pos];
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>& SmallVector<T, N, Allocator>::operator=(const SmallVector& vec) {
+        if (this != &vec) {
+            assign(vec.begin(), vec.end());
+        }
+
+        return *this;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>& SmallVector<T, N, Allocator>::operator=(SmallVector&& vec) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if (this == &vec) {
+            return *this;
+        }
+
+        DestroyAndDeallocate();
+        m_data = InlineData();
+        m_size = 0;
+        m_capacity = N;
+
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+            m_allocator = std::move(vec.m_allocator);
+        }
+
+        if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                      AllocatorTraits::is_always_equal::value) {
+            StealOrRelocate(vec);
+        } else {
+            if (vec.is_inline() || m_allocator == vec.m_allocator) {
+                StealOrRelocate(vec);
+            } else {
+                // We can't take ownership of memory coming from another allocator
+                reserve(vec.m_size);
+                Relocate(vec.m_data, vec.m_data + vec.m_size, m_data);
+                m_size = vec.m_size;
+                vec.m_size = 0;
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 SmallVector<T, N, Allocator>& SmallVector<T, N, Allocator>::operator=(
+        std::initializer_list<T> list) {
+        assign(list.begin(), list.end());
+        return *this;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::DestroyAndDeallocate() noexcept {
+        std::destroy(m_data, m_data + m_size);
+
+        if (!is_inline()) {
+            AllocatorTraits::deallocate(m_allocator, m_data, m_capacity);
+        }
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 auto SmallVector<T, N, Allocator>::GrowCapacity(const size_type minCapacity) const noexcept
+        -> size_type {
+        const size_type maxSize = max_size();
+        if (m_capacity > maxSize / 2) {
+            return maxSize;
+        }
+
+        return std::max(minCapacity, m_capacity * 2);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 T* SmallVector<T, N, Allocator>::InlineData() noexcept {
+        return m_storage.data;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 const T* SmallVector<T, N, Allocator>::InlineData() const noexcept {
+        return m_storage.data;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 T* SmallVector<T, N, Allocator>::MakeGap(const size_type index, const size_type count) {
+        const size_type newSize = m_size + count;
+        if (newSize <= m_capacity) {
+            RelocateBackward(m_data + index, m_data + m_size, m_data + newSize);
+            return m_data + index;
+        }
+
+        // Relocate directly to the final position in the new buffer, avoiding a second move of the tail
+        const size_type newCapacity = GrowCapacity(newSize);
+        T* newData = AllocatorTraits::allocate(m_allocator, newCapacity);
+        Relocate(m_data, m_data + index, newData);
+        Relocate(m_data + index, m_data + m_size, newData + index + count);
+
+        if (!is_inline()) {
+            AllocatorTraits::deallocate(m_allocator, m_data, m_capacity);
+        }
+
+        m_data = newData;
+        m_capacity = newCapacity;
+
+        return m_data + index;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::Reallocate(const size_type capacity) {
+        FlAssert(capacity >= m_size);
+
+        T* newData = (capacity <= N) ? InlineData() : AllocatorTraits::allocate(m_allocator, capacity);
+        if (newData == m_data) {
+            return;
+        }
+
+        Relocate(m_data, m_data + m_size, newData);
+
+        if (!is_inline()) {
+            AllocatorTraits::deallocate(m_allocator, m_data, m_capacity);
+        }
+
+        m_data = newData;
+        m_capacity = std::max(capacity, N);
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::StealOrRelocate(SmallVector& vec) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        FlAssert(is_inline() && m_size == 0);
+
+        if (!vec.is_inline()) {
+            m_data = vec.m_data;
+            m_capacity = vec.m_capacity;
+
+            vec.m_data = vec.InlineData();
+            vec.m_capacity = N;
+        } else {
+            Relocate(vec.m_data, vec.m_data + vec.m_size, m_data);
+        }
+
+        m_size = vec.m_size;
+        vec.m_size = 0;
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::Relocate(T* first, T* last, T* dest) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            if FL_IS_RUNTIME_EVAL() {
+                if (first != last) {
+                    std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+                                 static_cast<std::size_t>(last - first) * sizeof(T));
+                }
+
+                return;
+            }
+        }
+
+        for (; first != last; ++first, ++dest) {
+            std::construct_at(dest, std::move(*first));
+            std::destroy_at(first);
+        }
+    }
+
+    template <typename T, std::size_t N, typename Allocator>
+    FL_CONSTEXPR20 void SmallVector<T, N, Allocator>::RelocateBackward(T* first, T* last, T* destLast) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if constexpr (IsTriviallyRelocatable_v<T>) {
+            if FL_IS_RUNTIME_EVAL() {
+                if (first != last) {
+                    const auto count = static_cast<std::size_t>(last - first);
+                    std::memmove(static_cast<void*>(destLast - count), static_cast<const void*>(first),
+                                 count * sizeof(T));
+                }
+
+                return;
+            }
+        }
+
+        while (last != first) {
+            --last;
+            --destLast;
+            std::construct_at(destLast, std::move(*last));
+            std::destroy_at(last);
+        }
+    }
+
+    template <typename T, std::size_t N, typename A>
+    FL_CONSTEXPR20 bool operator==(const SmallVector<T, N, A>& lhs, const SmallVector<T, N, A>& rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N, typename A>
+        requires std::three_way_comparable<T>
+    FL_CONSTEXPR20 auto operator<=>(const SmallVector<T, N, A>& lhs, const SmallVector<T, N, A>& rhs) {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T, std::size_t N, typename A>
+    FL_CONSTEXPR20 void swap(SmallVector<T, N, A>& lhs, SmallVector<T, N, A>& rhs) {
+        lhs.swap(rhs);
+    }
+} // namespace Fl
@@ -0,0 +1,123 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#ifndef FL_UTILITY_SPSCQUEUE_HPP
+#define FL_UTILITY_SPSCQUEUE_HPP
+
+#include <FlashlightEngine/Prerequisites.hpp>
+
+#include <atomic>
+#include <memory>
+#include <span>
+
+namespace Fl {
+    /**
+     * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+     *
+     * The queue is a power-of-two ring buffer, head and tail indices live on separate cache lines and each side caches
+     * the last index it read from the other side so the shared cache lines are only touched when the queue looks full
+     * (or empty).
+     * Push and Pop block using std::atomic::wait when the queue is full (or empty), the Try* variants never block.
+     * @tparam T Type of the elements.
+     */
+    template <typename T>
+    class SpscQueue {
+    public:
+        /**
+         * @param capacity Minimum number of elements the queue can hold, rounded up to the next power of two.
+         */
+        explicit SpscQueue(std::size_t capacity);
+        ~SpscQueue();
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue(SpscQueue&&) = delete;
+
+        /**
+         * @brief Gets the maximum number of elements the queue can hold.
+         * @return Capacity of the queue.
+         */
+        std::size_t GetCapacity() const noexcept;
+        /**
+         * @brief Gets the number of elements in the queue.
+         * @remark The value may already be outdated when returned if the other side is working on the queue.
+         * @return Approximate number of elements.
+         */
+        std::size_t GetSize() const noexcept;
+
+        bool IsEmpty() const noexcept;
+
+        /**
+         * @brief Pops an element, waiting for one to be pushed if the queue is empty.
+         * @remark Consumer thread only.
+         * @return The popped element.
+         */
+        T Pop();
+
+        /**
+         * @brief Pushes an element, waiting for some space if the queue is full.
+         * @remark Producer thread only.
+         */
+        template <typename... Args>
+        void Push(Args&&... args);
+
+        /**
+         * @brief Tries to construct an element at the end of the queue.
+         * @remark Producer thread only.
+         * @return Whether the element could be pushed (false if the queue is full).
+         */
+        template <typename... Args>
+        bool TryEmplace(Args&&... args);
+
+        /**
+         * @brief Tries to pop an element from the queue.
+         * @remark Consumer thread only.
+         * @param value Element receiving the popped value.
+         * @return Whether an element was popped (false if the queue is empty).
+         */
+        bool TryPop(T& value);
+        /**
+         * @brief Pops as many elements as possible (up to the size of the output span).
+         * Only publishes the new head once, which is much cheaper than popping elements one by one.
+         * @remark Consumer thread only.
+         * @param values Span receiving the popped values.
+         * @return Number of elements popped.
+         */
+        std::size_t TryPopBatch(std::span<T> values);
+
+        bool TryPush(const T& value);
+        bool TryPush(T&& value);
+        /**
+         * @brief Pushes as many elements as possible (up to the size of the input span).
+         * Only publishes the new tail once, which is much cheaper than pushing elements one by one.
+         * @remark Producer thread only.
+         * @param values Elements to push.
+         * @return Number of elements pushed, starting from the beginning of the span.
+         */
+        std::size_t TryPushBatch(std::span<const T> values);
+
+        SpscQueue& operator=(const SpscQueue&) = delete;
+        SpscQueue& operator=(SpscQueue&&) = delete;
+
+    private:
+        T* GetSlot(std::size_t index) const noexcept;
+
+        // Consumer side
+        alignas(CacheLineSize) std::atomic<std::size_t> m_head;
+        std::size_t m_cachedTail;
+
+        // Producer side
+        alignas(CacheLineSize) std::atomic<std::size_t> m_tail;
+        std::size_t m_cachedHead;
+
+        // Read-only, shared by both sides
+        alignas(CacheLineSize) std::size_t m_mask;
+        T* m_buffer;
+    };
+} // namespace Fl
+
+#include <FlashlightEngine/Utility/SpscQueue.inl>
+
+#endif // FL_UTILITY_SPSCQUEUE_HPP
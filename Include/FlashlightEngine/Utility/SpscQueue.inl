@@ -0,0 +1,178 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#pragma once
+
+#include <FlashlightEngine/Utility/SpscQueue.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace Fl {
+    template <typename T>
+    SpscQueue<T>::SpscQueue(const std::size_t capacity) :
+        m_head(0), m_cachedTail(0), m_tail(0), m_cachedHead(0) {
+        FlAssertMsg(capacity > 0, "[Utility/SpscQueue] Capacity must be greater than zero.");
+
+        const std::size_t bufferSize = std::bit_ceil(capacity);
+        m_mask = bufferSize - 1;
+        m_buffer = std::allocator<T>().allocate(bufferSize);
+    }
+
+    template <typename T>
+    SpscQueue<T>::~SpscQueue() {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        for (std::size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i) {
+            std::destroy_at(GetSlot(i));
+        }
+
+        std::allocator<T>().deallocate(m_buffer, m_mask + 1);
+    }
+
+    template <typename T>
+    std::size_t SpscQueue<T>::GetCapacity() const noexcept {
+        return m_mask + 1;
+    }
+
+    template <typename T>
+    std::size_t SpscQueue<T>::GetSize() const noexcept {
+        const std::size_t head = m_head.load(std::memory_order_acquire);
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+
+        return (tail >= head) ? tail - head : 0;
+    }
+
+    template <typename T>
+    bool SpscQueue<T>::IsEmpty() const noexcept {
+        return GetSize() == 0;
+    }
+
+    template <typename T>
+    T SpscQueue<T>::Pop() {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+
+        std::size_t tail;
+        while ((tail = m_tail.load(std::memory_order_acquire)) == head) {
+            m_tail.wait(tail, std::memory_order_acquire);
+        }
+
+        m_cachedTail = tail;
+
+        T* slot = GetSlot(head);
+        T value = std::move(*slot);
+        std::destroy_at(slot);
+
+        m_head.store(head + 1, std::memory_order_release);
+        m_head.notify_one();
+
+        return value;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void SpscQueue<T>::Push(Args&&... args) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+        std::size_t head;
+        while (tail - (head = m_head.load(std::memory_order_acquire)) > m_mask) {
+            m_head.wait(head, std::memory_order_acquire);
+        }
+
+        m_cachedHead = head;
+
+        std::construct_at(GetSlot(tail), std::forward<Args>(args)...);
+
+        m_tail.store(tail + 1, std::memory_order_release);
+        m_tail.notify_one();
+    }
+
+    template <typename T>
+    template <typename... Args>
+    bool SpscQueue<T>::TryEmplace(Args&&... args) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead > m_mask) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead > m_mask) {
+                return false;
+            }
+        }
+
+        std::construct_at(GetSlot(tail), std::forward<Args>(args)...);
+
+        m_tail.store(tail + 1, std::memory_order_release);
+        m_tail.notify_one();
+
+        return true;
+    }
+
+    template <typename T>
+    bool SpscQueue<T>::TryPop(T& value) {
+        return TryPopBatch(std::span<T>(&value, 1)) == 1;
+    }
+
+    template <typename T>
+    std::size_t SpscQueue<T>::TryPopBatch(std::span<T> values) {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (m_cachedTail - head < values.size()) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        }
+
+        const std::size_t count = std::min(m_cachedTail - head, values.size());
+        if (count == 0) {
+            return 0;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            T* slot = GetSlot(head + i);
+            values[i] = std::move(*slot);
+            std::destroy_at(slot);
+        }
+
+        m_head.store(head + count, std::memory_order_release);
+        m_head.notify_one();
+
+        return count;
+    }
+
+    template <typename T>
+    bool SpscQueue<T>::TryPush(const T& value) {
+        return TryEmplace(value);
+    }
+
+    template <typename T>
+    bool SpscQueue<T>::TryPush(T&& value) {
+        return TryEmplace(std::move(value));
+    }
+
+    template <typename T>
+    std::size_t SpscQueue<T>::TryPushBatch(std::span<const T> values) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        const std::size_t capacity = m_mask + 1;
+        if (capacity - (tail - m_cachedHead) < values.size()) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+
+        const std::size_t count = std::min(capacity - (tail - m_cachedHead), values.size());
+        if (count == 0) {
+            return 0;
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            std::construct_at(GetSlot(tail + i), values[i]);
+        }
+
+        m_tail.store(tail + count, std::memory_order_release);
+        m_tail.notify_one();
+
+        return count;
+    }
+
+    template <typename T>
+    T* SpscQueue<T>::GetSlot(const std::size_t index) const noexcept {
+        return m_buffer + (index & m_mask);
+    }
+} // namespace Fl
@@ -171,6 +171,16 @@ namespace Fl {
 
     template<typename T, typename... Args>
     using PreventHiddenCopyMove = typename PreventHiddenCopyMoveImpl<T, Args...>::type;
+
+    /************************************************************************/
+
+    // Types which can be moved to a new address with a plain memcpy (and without calling the destructor of the
+    // source), can be specialized for types which are not trivially copyable but still relocatable (like std::unique_ptr)
+    template <typename T>
+    struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    template <typename T>
+    constexpr bool IsTriviallyRelocatable_v = IsTriviallyRelocatable<T>::value;
 } // namespace Fl
 
 #endif // FL_UTILITY_TYPETRAITS_HPP
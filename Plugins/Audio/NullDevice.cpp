@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+// Plugin exposing NullAudioDevice to AudioDeviceLibrary, options being "realtime" to pace the writes
+
+#include <FlashlightEngine/Audio/NullAudioDevice.hpp>
+
+#include <string_view>
+
+extern "C" {
+    FL_EXPORT Fl::AudioDevice* FlCreateAudioDevice(const char* options) {
+        return new Fl::NullAudioDevice(options && std::string_view(options) == "realtime");
+    }
+
+    FL_EXPORT void FlDestroyAudioDevice(Fl::AudioDevice* device) {
+        delete device;
+    }
+}
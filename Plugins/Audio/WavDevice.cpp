@@ -0,0 +1,21 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+// Plugin exposing WavAudioDevice to AudioDeviceLibrary, options being the UTF-8 path of the output file
+
+#include <FlashlightEngine/Audio/WavAudioDevice.hpp>
+
+extern "C" {
+    FL_EXPORT Fl::AudioDevice* FlCreateAudioDevice(const char* options) {
+        if (!options || *options == '\0') {
+            return nullptr;
+        }
+
+        return new Fl::WavAudioDevice(options);
+    }
+
+    FL_EXPORT void FlDestroyAudioDevice(Fl::AudioDevice* device) {
+        delete device;
+    }
+}
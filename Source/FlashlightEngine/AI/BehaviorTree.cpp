@@ -0,0 +1,196 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/AI/BehaviorTree.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr std::size_t BatchSize = BehaviorTree::BatchSize;
+
+        struct TickContext {
+            const BehaviorTree::Node* nodes;
+            const BehaviorTree::LeafCallback* leaves;
+            const UInt32* agents; //< Agents of the batch
+            BehaviorStatus* statuses; //< Status of each agent of the batch, written by the last node ticked for it
+        };
+
+        // Positions are indices in the batch of the agents reaching the node
+        void TickNode(const TickContext& context, UInt32 node, std::span<const UInt32> positions);
+
+        // Sequences go on with the agents their children succeeded for, selectors with those they failed for
+        template <BehaviorStatus Continue>
+        void TickComposite(const TickContext& context, const UInt32 node, std::span<const UInt32> positions) {
+            const UInt32 end = context.nodes[node].end;
+            if (node + 1 == end) {
+                for (const UInt32 position : positions) {
+                    context.statuses[position] = Continue;
+                }
+                return;
+            }
+
+            std::array<UInt32, BatchSize> remaining;
+            for (UInt32 child = node + 1;;) {
+                TickNode(context, child, positions);
+
+                child = context.nodes[child].end;
+                if (child == end) {
+                    return;
+                }
+
+                // Filtering in place is fine once positions point at remaining, writes never pass reads
+                std::size_t count = 0;
+                for (const UInt32 position : positions) {
+                    if (context.statuses[position] == Continue) {
+                        remaining[count++] = position;
+                    }
+                }
+
+                if (count == 0) {
+                    return;
+                }
+                positions = std::span<const UInt32>(remaining.data(), count);
+            }
+        }
+
+        void TickInverter(const TickContext& context, const UInt32 node, const std::span<const UInt32> positions) {
+            TickNode(context, node + 1, positions);
+
+            for (const UInt32 position : positions) {
+                BehaviorStatus& status = context.statuses[position];
+                if (status != BehaviorStatus::Running) {
+                    status = (status == BehaviorStatus::Success) ? BehaviorStatus::Failure : BehaviorStatus::Success;
+                }
+            }
+        }
+
+        void TickSucceeder(const TickContext& context, const UInt32 node, const std::span<const UInt32> positions) {
+            TickNode(context, node + 1, positions);
+
+            for (const UInt32 position : positions) {
+                BehaviorStatus& status = context.statuses[position];
+                if (status == BehaviorStatus::Failure) {
+                    status = BehaviorStatus::Success;
+                }
+            }
+        }
+
+        template <bool IsCondition>
+        void TickLeaf(const TickContext& context, const UInt32 node, const std::span<const UInt32> positions) {
+            std::array<UInt32, BatchSize> agents;
+            std::array<BehaviorStatus, BatchSize> statuses;
+            for (std::size_t i = 0; i < positions.size(); ++i) {
+                agents[i] = context.agents[positions[i]];
+            }
+
+            context.leaves[context.nodes[node].leaf](std::span<const UInt32>(agents.data(), positions.size()),
+                                                     std::span<BehaviorStatus>(statuses.data(), positions.size()));
+
+            for (std::size_t i = 0; i < positions.size(); ++i) {
+                FlAssertMsg(!IsCondition || statuses[i] != BehaviorStatus::Running,
+                            "[AI/BehaviorTree] Conditions can't be running.");
+                context.statuses[positions[i]] = statuses[i];
+            }
+        }
+
+        using NodeFunction = void (*)(const TickContext&, UInt32, std::span<const UInt32>);
+
+        // Tick function of each node kind, in the order of BehaviorNodeKind
+        constexpr auto NodeFunctions = std::to_array<NodeFunction>({
+            &TickComposite<BehaviorStatus::Success>, //< Sequence
+            &TickComposite<BehaviorStatus::Failure>, //< Selector
+            &TickInverter,
+            &TickSucceeder,
+            &TickLeaf<true>, //< Condition
+            &TickLeaf<false> //< Action
+        });
+
+        static_assert(NodeFunctions.size() == BehaviorTree::NodeKindCount, "Every node kind needs a tick function.");
+
+        void TickNode(const TickContext& context, const UInt32 node, const std::span<const UInt32> positions) {
+            NodeFunctions[static_cast<std::size_t>(context.nodes[node].kind)](context, node, positions);
+        }
+
+        constexpr bool IsLeaf(const BehaviorNodeKind kind) {
+            return kind == BehaviorNodeKind::Condition || kind == BehaviorNodeKind::Action;
+        }
+
+        constexpr bool IsDecorator(const BehaviorNodeKind kind) {
+            return kind == BehaviorNodeKind::Inverter || kind == BehaviorNodeKind::Succeeder;
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    UInt32 BehaviorTree::AddLeaf(const BehaviorNodeKind kind, LeafCallback callback) {
+        FlAssertMsg(IsLeaf(kind), "[AI/BehaviorTree] Only conditions and actions are leaves.");
+        FlAssertMsg(callback.IsValid(), "[AI/BehaviorTree] Leaves need a callback.");
+
+        const UInt32 node = AddNode(kind, static_cast<UInt32>(m_leaves.size()));
+        m_leaves.push_back(std::move(callback));
+
+        return node;
+    }
+
+    UInt32 BehaviorTree::BeginNode(const BehaviorNodeKind kind) {
+        FlAssertMsg(!IsLeaf(kind), "[AI/BehaviorTree] Leaves are added with AddLeaf().");
+
+        const UInt32 node = AddNode(kind, std::numeric_limits<UInt32>::max());
+        m_openNodes.push_back(node);
+
+        return node;
+    }
+
+    void BehaviorTree::Clear() {
+        m_nodes.clear();
+        m_leaves.clear();
+        m_openNodes.clear();
+        m_depth = 0;
+    }
+
+    void BehaviorTree::EndNode() {
+        FlAssertMsg(!m_openNodes.empty(), "[AI/BehaviorTree] No node to end.");
+
+        const UInt32 node = m_openNodes.back();
+        m_openNodes.pop_back();
+
+        const auto end = static_cast<UInt32>(m_nodes.size());
+        FlAssertMsg(!IsDecorator(m_nodes[node].kind) || (node + 1 < end && m_nodes[node + 1].end == end),
+                    "[AI/BehaviorTree] Decorators must have exactly one child.");
+        m_nodes[node].end = end;
+    }
+
+    void BehaviorTree::Tick(const std::span<const UInt32> agents, const std::span<BehaviorStatus> statuses) const {
+        FlAssertMsg(IsComplete(), "[AI/BehaviorTree] Tree isn't complete.");
+        FlAssertMsg(statuses.size() == agents.size(), "[AI/BehaviorTree] There must be a status per agent.");
+
+        std::array<UInt32, BatchSize> positions;
+        for (std::size_t i = 0; i < BatchSize; ++i) {
+            positions[i] = static_cast<UInt32>(i);
+        }
+
+        for (std::size_t first = 0; first < agents.size(); first += BatchSize) {
+            const std::size_t count = std::min(BatchSize, agents.size() - first);
+            const TickContext context{m_nodes.data(), m_leaves.data(), agents.data() + first, statuses.data() + first};
+
+            TickNode(context, 0, std::span<const UInt32>(positions.data(), count));
+        }
+    }
+
+    UInt32 BehaviorTree::AddNode(const BehaviorNodeKind kind, const UInt32 leaf) {
+        FlAssertMsg(m_nodes.empty() || !m_openNodes.empty(), "[AI/BehaviorTree] Tree already has a root.");
+        FlAssertMsg(m_openNodes.empty() || !IsDecorator(m_nodes[m_openNodes.back()].kind) ||
+                        m_openNodes.back() + 1 == m_nodes.size(),
+                    "[AI/BehaviorTree] Decorators must have exactly one child.");
+
+        const auto node = static_cast<UInt32>(m_nodes.size());
+        m_nodes.push_back({kind, node + 1, leaf});
+        m_depth = std::max(m_depth, static_cast<UInt32>(m_openNodes.size()) + 1);
+
+        return node;
+    }
+} // namespace Fl
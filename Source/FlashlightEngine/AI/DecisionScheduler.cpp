@@ -0,0 +1,176 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/AI/DecisionScheduler.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr double CostSmoothing = 0.25; //< Weight of the last batch in the estimated cost of an agent
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    DecisionScheduler::DecisionScheduler() :
+    DecisionScheduler(Settings{}) {
+    }
+
+    DecisionScheduler::DecisionScheduler(const Settings& settings) :
+    m_bucketOffsets((MaxSortedLateness + 1) * MaxLodCount + 1), m_lodPhases(), m_statistics(), m_settings(settings),
+    m_agentCost(0.0), m_frameIndex(0) {
+        FlAssertMsg(!settings.lodLevels.empty(), "[AI/DecisionScheduler] There must be at least one level.");
+        FlAssertMsg(settings.batchSize > 0, "[AI/DecisionScheduler] Batch size must be greater than zero.");
+        FlAssertMsg(std::ranges::all_of(settings.lodLevels,
+                                        [](const LodLevel& level) { return level.updateInterval > 0; }),
+                    "[AI/DecisionScheduler] Update intervals must be greater than zero.");
+        FlAssertMsg(std::ranges::is_sorted(settings.lodLevels, std::ranges::greater(), &LodLevel::minRelevance),
+                    "[AI/DecisionScheduler] Levels must be sorted by decreasing relevance.");
+    }
+
+    UInt32 DecisionScheduler::AddAgent(const float relevance) {
+        const auto agent = static_cast<UInt32>(m_relevances.size());
+        const UInt8 lod = FindLod(relevance);
+        const UInt32 interval = m_settings.lodLevels[lod].updateInterval;
+
+        // First due on the next frame plus the phase, as if updated an interval before
+        const UInt32 phase = m_lodPhases[lod];
+        m_lodPhases[lod] = (phase + 1) % interval;
+
+        m_relevances.push_back(relevance);
+        m_lastUpdateFrames.push_back(m_frameIndex + 1 + phase - interval);
+        m_lods.push_back(lod);
+
+        return agent;
+    }
+
+    void DecisionScheduler::Clear() {
+        m_relevances.clear();
+        m_lastUpdateFrames.clear();
+        m_lods.clear();
+        m_dueAgents.clear();
+        m_lodPhases.fill(0);
+    }
+
+    void DecisionScheduler::Reserve(const std::size_t agentCount) {
+        m_relevances.reserve(agentCount);
+        m_lastUpdateFrames.reserve(agentCount);
+        m_lods.reserve(agentCount);
+    }
+
+    void DecisionScheduler::SetRelevance(const UInt32 agent, const float relevance) {
+        FlAssertMsg(agent < m_relevances.size(), "[AI/DecisionScheduler] Agent index out of range.");
+
+        m_relevances[agent] = relevance;
+        m_lods[agent] = FindLod(relevance);
+    }
+
+    void DecisionScheduler::Update(const UpdateCallback& callback, ThreadPool* threadPool) {
+        FlAssertMsg(callback.IsValid(), "[AI/DecisionScheduler] Invalid update callback.");
+
+        const Clock frameClock;
+        ++m_frameIndex;
+        FindDueAgents();
+        m_statistics.scheduleTime = frameClock.GetElapsedTime();
+
+        // Without thread pool, waves are single batches
+        const std::size_t batchSize = m_settings.batchSize;
+        const std::size_t waveSize = threadPool ? batchSize * (threadPool->GetWorkerCount() + 1) : batchSize;
+        const auto budget = static_cast<double>(m_settings.frameBudget.count());
+
+        std::size_t updatedCount = 0;
+        while (updatedCount < m_dueAgents.size()) {
+            const std::size_t count = std::min(waveSize, m_dueAgents.size() - updatedCount);
+            const Clock::duration waveStart = frameClock.GetElapsedTime();
+            if (updatedCount > 0 &&
+                static_cast<double>(waveStart.count()) + m_agentCost * static_cast<double>(count) > budget) {
+                break;
+            }
+
+            const auto agents = std::span<const UInt32>(m_dueAgents).subspan(updatedCount, count);
+            if (threadPool) {
+                threadPool->ParallelFor(count, batchSize, [&](const std::size_t first, const std::size_t last) {
+                    callback(agents.subspan(first, last - first));
+                });
+            } else {
+                callback(agents);
+            }
+
+            const Clock::duration waveTime = frameClock.GetElapsedTime() - waveStart;
+            const double cost = static_cast<double>(waveTime.count()) / static_cast<double>(count);
+            m_agentCost = (m_agentCost > 0.0) ? m_agentCost + (cost - m_agentCost) * CostSmoothing : cost;
+
+            for (const UInt32 agent : agents) {
+                m_lastUpdateFrames[agent] = m_frameIndex;
+            }
+            updatedCount += count;
+        }
+
+        m_statistics.updateTime = frameClock.GetElapsedTime() - m_statistics.scheduleTime;
+
+        UInt32 maxStaleness = 0;
+        UInt64 totalStaleness = 0;
+        for (const UInt32 lastUpdateFrame : m_lastUpdateFrames) {
+            const UInt32 staleness = m_frameIndex - lastUpdateFrame;
+            maxStaleness = std::max(maxStaleness, staleness);
+            totalStaleness += staleness;
+        }
+
+        const std::size_t agentCount = m_relevances.size();
+        m_statistics.agentCount = agentCount;
+        m_statistics.dueAgentCount = m_dueAgents.size();
+        m_statistics.updatedAgentCount = updatedCount;
+        m_statistics.deferredAgentCount = m_dueAgents.size() - updatedCount;
+        m_statistics.maxStaleness = maxStaleness;
+        m_statistics.averageStaleness =
+            (agentCount > 0) ? static_cast<float>(totalStaleness) / static_cast<float>(agentCount) : 0.0f;
+    }
+
+    UInt8 DecisionScheduler::FindLod(const float relevance) const {
+        const std::size_t levelCount = m_settings.lodLevels.size();
+        for (std::size_t lod = 0; lod + 1 < levelCount; ++lod) {
+            if (relevance >= m_settings.lodLevels[lod].minRelevance) {
+                return static_cast<UInt8>(lod);
+            }
+        }
+
+        return static_cast<UInt8>(levelCount - 1);
+    }
+
+    void DecisionScheduler::FindDueAgents() {
+        std::array<UInt32, MaxLodCount> intervals;
+        for (std::size_t lod = 0; lod < m_settings.lodLevels.size(); ++lod) {
+            intervals[lod] = m_settings.lodLevels[lod].updateInterval;
+        }
+
+        // Buckets go from the latest agents of the most relevant level to the agents just due of the least relevant one
+        m_dueCandidates.clear();
+        m_dueBuckets.clear();
+        std::fill(m_bucketOffsets.begin(), m_bucketOffsets.end(), 0);
+        for (UInt32 agent = 0; agent < m_lastUpdateFrames.size(); ++agent) {
+            const UInt32 staleness = m_frameIndex - m_lastUpdateFrames[agent];
+            const UInt8 lod = m_lods[agent];
+            if (staleness >= intervals[lod]) {
+                const UInt32 lateness = std::min(staleness - intervals[lod], MaxSortedLateness);
+                const auto bucket = static_cast<UInt16>((MaxSortedLateness - lateness) * MaxLodCount + lod);
+
+                m_dueCandidates.push_back(agent);
+                m_dueBuckets.push_back(bucket);
+                ++m_bucketOffsets[bucket + 1];
+            }
+        }
+
+        for (std::size_t bucket = 1; bucket < m_bucketOffsets.size(); ++bucket) {
+            m_bucketOffsets[bucket] += m_bucketOffsets[bucket - 1];
+        }
+
+        // Candidates are scattered in index order, which keeps them sorted by index within their bucket
+        m_dueAgents.resize(m_dueCandidates.size());
+        for (std::size_t i = 0; i < m_dueCandidates.size(); ++i) {
+            m_dueAgents[m_bucketOffsets[m_dueBuckets[i]]++] = m_dueCandidates[i];
+        }
+    }
+} // namespace Fl
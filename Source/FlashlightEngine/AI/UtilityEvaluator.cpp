@@ -0,0 +1,151 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/AI/UtilityEvaluator.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        // Writes the unclamped curve values of clamped inputs
+        using CurveFunction = void (*)(const ResponseCurve&, const float* inputs, float* values, std::size_t count);
+
+        void EvaluateLinear(const ResponseCurve& curve, const float* inputs, float* values, const std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                values[i] = curve.slope * (std::clamp(inputs[i], 0.0f, 1.0f) - curve.offsetX) + curve.offsetY;
+            }
+        }
+
+        void EvaluatePolynomial(const ResponseCurve& curve, const float* inputs, float* values,
+                                const std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                const float x = std::max(std::clamp(inputs[i], 0.0f, 1.0f) - curve.offsetX, 0.0f);
+                values[i] = curve.slope * std::pow(x, curve.exponent) + curve.offsetY;
+            }
+        }
+
+        void EvaluateLogistic(const ResponseCurve& curve, const float* inputs, float* values, const std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                const float x = std::clamp(inputs[i], 0.0f, 1.0f) - curve.offsetX;
+                values[i] = curve.slope / (1.0f + std::exp(-curve.exponent * x)) + curve.offsetY;
+            }
+        }
+
+        void EvaluateStep(const ResponseCurve& curve, const float* inputs, float* values, const std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                const bool isAbove = std::clamp(inputs[i], 0.0f, 1.0f) >= curve.offsetX;
+                values[i] = (isAbove ? curve.slope : 0.0f) + curve.offsetY;
+            }
+        }
+
+        // Function of each curve kind, in the order of ResponseCurveKind
+        constexpr auto CurveFunctions = std::to_array<CurveFunction>({
+            &EvaluateLinear,
+            &EvaluatePolynomial,
+            &EvaluateLogistic,
+            &EvaluateStep
+        });
+
+        static_assert(CurveFunctions.size() == UtilityEvaluator::CurveKindCount, "Every curve kind needs a function.");
+
+        CurveFunction GetCurveFunction(const ResponseCurveKind kind) {
+            return CurveFunctions[static_cast<std::size_t>(kind)];
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    float ResponseCurve::Evaluate(const float input) const {
+        float value;
+        GetCurveFunction(kind)(*this, &input, &value, 1);
+
+        return std::clamp(value, 0.0f, 1.0f);
+    }
+
+    void UtilityEvaluator::AddConsideration(const UInt32 input, const ResponseCurve& curve) {
+        FlAssertMsg(!m_weights.empty(), "[AI/UtilityEvaluator] Considerations must be added after their option.");
+
+        m_considerations.push_back({input, curve});
+        m_considerationOffsets.back() = static_cast<UInt32>(m_considerations.size());
+        m_inputCount = std::max(m_inputCount, input + 1);
+    }
+
+    UInt32 UtilityEvaluator::AddOption(const float weight) {
+        FlAssertMsg(weight >= 0.0f, "[AI/UtilityEvaluator] Weights can't be negative.");
+
+        m_weights.push_back(weight);
+        m_considerationOffsets.push_back(static_cast<UInt32>(m_considerations.size()));
+
+        return static_cast<UInt32>(m_weights.size() - 1);
+    }
+
+    void UtilityEvaluator::Clear() {
+        m_considerations.clear();
+        m_considerationOffsets.assign(1, 0);
+        m_weights.clear();
+        m_inputCount = 0;
+    }
+
+    void UtilityEvaluator::Evaluate(const std::span<const float> inputs, const std::span<UInt32> choices,
+                                    const std::span<float> scores, ThreadPool* threadPool) const {
+        const std::size_t agentCount = choices.size();
+        FlAssertMsg(!m_weights.empty(), "[AI/UtilityEvaluator] There must be at least one option.");
+        FlAssertMsg(inputs.size() == m_inputCount * agentCount, "[AI/UtilityEvaluator] Wrong input count.");
+        FlAssertMsg(scores.size() == agentCount, "[AI/UtilityEvaluator] There must be a score per agent.");
+
+        const auto evaluateRange = [&](const std::size_t first, const std::size_t last) {
+            for (std::size_t batch = first; batch < last; batch += BatchSize) {
+                EvaluateBatch(inputs, agentCount, batch, std::min(batch + BatchSize, last), choices, scores);
+            }
+        };
+
+        if (threadPool && agentCount > BatchSize) {
+            threadPool->ParallelFor(agentCount, BatchSize, evaluateRange);
+        } else {
+            evaluateRange(0, agentCount);
+        }
+    }
+
+    void UtilityEvaluator::EvaluateBatch(const std::span<const float> inputs, const std::size_t agentCount,
+                                         const std::size_t first, const std::size_t last,
+                                         const std::span<UInt32> choices, const std::span<float> scores) const {
+        const std::size_t count = last - first;
+        std::array<float, BatchSize> bestScores;
+        std::array<float, BatchSize> optionScores;
+        std::array<float, BatchSize> values;
+        std::fill_n(bestScores.begin(), count, -std::numeric_limits<float>::infinity());
+
+        for (std::size_t option = 0; option < m_weights.size(); ++option) {
+            std::fill_n(optionScores.begin(), count, m_weights[option]);
+
+            const std::size_t considerationCount = m_considerationOffsets[option + 1] - m_considerationOffsets[option];
+            const float compensation = 1.0f - 1.0f / static_cast<float>(std::max<std::size_t>(considerationCount, 1));
+            for (UInt32 index = m_considerationOffsets[option]; index < m_considerationOffsets[option + 1]; ++index) {
+                const Consideration& consideration = m_considerations[index];
+                GetCurveFunction(consideration.curve.kind)(consideration.curve,
+                                                          &inputs[consideration.input * agentCount + first],
+                                                          values.data(), count);
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    const float value = std::clamp(values[i], 0.0f, 1.0f);
+                    optionScores[i] *= value + value * (1.0f - value) * compensation;
+                }
+            }
+
+            for (std::size_t i = 0; i < count; ++i) {
+                if (optionScores[i] > bestScores[i]) {
+                    bestScores[i] = optionScores[i];
+                    choices[first + i] = static_cast<UInt32>(option);
+                }
+            }
+        }
+
+        std::copy_n(bestScores.begin(), count, scores.begin() + static_cast<std::ptrdiff_t>(first));
+    }
+} // namespace Fl
@@ -0,0 +1,388 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Animation/AnimationClip.hpp>
+
+#include <FlashlightEngine/Animation/LocalPose.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <span>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        enum class CurveType {
+            Translation,
+            Rotation,
+            Scale
+        };
+
+        using CurveValue = std::array<float, 4>;
+
+        constexpr float MaxValue16 = 65535.0f;
+        constexpr float MaxValue15 = 32767.0f;
+        constexpr UInt16 RotationValueMask = 0x7FFF;
+
+        // The three smallest components of a unit quaternion are within [-1/sqrt(2), 1/sqrt(2)]
+        constexpr float SmallestThreeBound = std::numbers::sqrt2_v<float> / 2.0f;
+        constexpr float SmallestThreeScale = 2.0f * SmallestThreeBound * (32768.0f / MaxValue15);
+
+        /**
+         * @brief Decodes a 16-bit quantized value to [0, 65535 / 65536], by building 1 + value / 65536 in the mantissa
+         *        of a float.
+         */
+        float DecodeUnit16(const UInt16 value) {
+            return BitCast<float>(0x3F800000u | (static_cast<UInt32>(value) << 7)) - 1.0f;
+        }
+
+        /**
+         * @brief Decodes the 15 low bits of a quantized value to [0, 32767 / 32768].
+         */
+        float DecodeUnit15(const UInt16 value) {
+            return BitCast<float>(0x3F800000u | (static_cast<UInt32>(value & RotationValueMask) << 8)) - 1.0f;
+        }
+
+        UInt16 EncodeUnit(const float value, const float maxValue) {
+            return static_cast<UInt16>(std::lround(std::clamp(value, 0.0f, 1.0f) * maxValue));
+        }
+
+        std::array<UInt16, 3> EncodeRotation(const CurveValue& rotation) {
+            std::size_t largest = 0;
+            for (std::size_t i = 1; i < 4; ++i) {
+                if (std::abs(rotation[i]) > std::abs(rotation[largest])) {
+                    largest = i;
+                }
+            }
+
+            // The largest component is rebuilt positive, q and -q being the same rotation
+            const float sign = (rotation[largest] < 0.0f) ? -1.0f : 1.0f;
+
+            std::array<UInt16, 3> values;
+            for (std::size_t i = 0, j = 0; i < 4; ++i) {
+                if (i != largest) {
+                    const float value = (sign * rotation[i] + SmallestThreeBound) / (2.0f * SmallestThreeBound);
+                    values[j++] = EncodeUnit(value, MaxValue15);
+                }
+            }
+
+            values[0] |= static_cast<UInt16>((largest & 1) << 15);
+            values[1] |= static_cast<UInt16>((largest >> 1) << 15);
+            return values;
+        }
+
+        void DecodeRotation(const UInt16* values, float* rotation, const std::size_t stride) {
+            const std::size_t largest = (values[0] >> 15) | ((values[1] >> 15) << 1);
+
+            float squaredLength = 0.0f;
+            for (std::size_t i = 0, j = 0; i < 4; ++i) {
+                if (i != largest) {
+                    const float value = DecodeUnit15(values[j++]) * SmallestThreeScale - SmallestThreeBound;
+                    rotation[i * stride] = value;
+                    squaredLength += value * value;
+                }
+            }
+
+            rotation[largest * stride] = std::sqrt(std::max(1.0f - squaredLength, 0.0f));
+        }
+
+        CurveValue Interpolate(const CurveType type, const CurveValue& from, const CurveValue& to, const float alpha) {
+            CurveValue result;
+            if (type != CurveType::Rotation) {
+                for (std::size_t i = 0; i < 3; ++i) {
+                    result[i] = from[i] + (to[i] - from[i]) * alpha;
+                }
+
+                result[3] = 0.0f;
+                return result;
+            }
+
+            const float dot = from[0] * to[0] + from[1] * to[1] + from[2] * to[2] + from[3] * to[3];
+            const float toWeight = (dot < 0.0f) ? -alpha : alpha;
+
+            float squaredLength = 0.0f;
+            for (std::size_t i = 0; i < 4; ++i) {
+                result[i] = from[i] * (1.0f - alpha) + to[i] * toWeight;
+                squaredLength += result[i] * result[i];
+            }
+
+            const float inverseLength = 1.0f / std::sqrt(squaredLength);
+            for (float& component : result) {
+                component *= inverseLength;
+            }
+
+            return result;
+        }
+
+        float ComputeError(const CurveType type, const CurveValue& value, const CurveValue& reference) {
+            if (type != CurveType::Rotation) {
+                const float x = value[0] - reference[0];
+                const float y = value[1] - reference[1];
+                const float z = value[2] - reference[2];
+                return std::sqrt(x * x + y * y + z * z);
+            }
+
+            // Angle between the rotations from the chord between the quaternions, acos() being inaccurate near 1
+            const float dot = value[0] * reference[0] + value[1] * reference[1] + value[2] * reference[2] +
+                              value[3] * reference[3];
+            const float sign = (dot < 0.0f) ? -1.0f : 1.0f;
+
+            float squaredChord = 0.0f;
+            for (std::size_t i = 0; i < 4; ++i) {
+                const float difference = value[i] - sign * reference[i];
+                squaredChord += difference * difference;
+            }
+
+            return 4.0f * std::asin(std::min(std::sqrt(squaredChord) * 0.5f, 1.0f));
+        }
+
+        /**
+         * @brief Selects the keys of a curve, greedily extending each segment while the interpolation of its ends
+         *        stays within the tolerance of every frame it spans.
+         * @param values Raw values of every frame.
+         * @param decodedValues Values of every frame after quantization.
+         * @return Frames of the keys.
+         */
+        std::vector<UInt32> ReduceKeys(const CurveType type, const std::span<const CurveValue> values,
+                                       const std::span<const CurveValue> decodedValues, const float tolerance) {
+            const auto frameCount = static_cast<UInt32>(values.size());
+
+            const bool isConstant = std::all_of(values.begin(), values.end(), [&](const CurveValue& value) {
+                return ComputeError(type, decodedValues[0], value) <= tolerance;
+            });
+            if (isConstant) {
+                return {0};
+            }
+
+            std::vector<UInt32> keys = {0};
+            for (UInt32 first = 0; first + 1 < frameCount;) {
+                UInt32 last = first + 1;
+                for (UInt32 candidate = last + 1; candidate < frameCount; ++candidate) {
+                    bool isWithinTolerance = true;
+                    for (UInt32 frame = first + 1; frame < candidate && isWithinTolerance; ++frame) {
+                        const float alpha = static_cast<float>(frame - first) / static_cast<float>(candidate - first);
+                        const CurveValue value =
+                            Interpolate(type, decodedValues[first], decodedValues[candidate], alpha);
+                        isWithinTolerance = ComputeError(type, value, values[frame]) <= tolerance;
+                    }
+
+                    if (!isWithinTolerance) {
+                        break;
+                    }
+
+                    last = candidate;
+                }
+
+                keys.push_back(last);
+                first = last;
+            }
+
+            return keys;
+        }
+
+        CurveValue ToCurveValue(const Vector3& vector) {
+            return {vector.x, vector.y, vector.z, 0.0f};
+        }
+
+        CurveValue ToCurveValue(const Quaternion& quaternion) {
+            const Quaternion normal = quaternion.GetNormal();
+            return {normal.x, normal.y, normal.z, normal.w};
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    AnimationClip::AnimationClip(const RawAnimation& animation) : AnimationClip(animation, CompressionSettings{}) {}
+
+    AnimationClip::AnimationClip(const RawAnimation& animation, const CompressionSettings& settings) :
+    m_frameRate(animation.frameRate), m_frameCount(animation.frameCount) {
+        FlAssertMsg(animation.frameRate > 0.0f, "[Animation/AnimationClip] Invalid frame rate.");
+        FlAssertMsg(animation.frameCount > 0 && animation.frameCount <= 65536,
+                    "[Animation/AnimationClip] Frame count must be within [1, 65536].");
+
+        std::vector<CurveValue> values(m_frameCount);
+        std::vector<CurveValue> decodedValues(m_frameCount);
+        std::vector<std::array<UInt16, 3>> quantizedValues(m_frameCount);
+
+        const auto addCurve = [&](const CurveType type, const auto& rawValues, const float tolerance) {
+            FlAssertMsg(rawValues.size() == 1 || rawValues.size() == m_frameCount,
+                        "[Animation/AnimationClip] A track needs one value per frame, or a single one.");
+
+            for (UInt32 frame = 0; frame < m_frameCount; ++frame) {
+                values[frame] = ToCurveValue(rawValues[std::min<std::size_t>(frame, rawValues.size() - 1)]);
+            }
+
+            Curve curve = {};
+            curve.firstKey = static_cast<UInt32>(m_keyFrames.size());
+
+            if (type == CurveType::Rotation) {
+                for (UInt32 frame = 0; frame < m_frameCount; ++frame) {
+                    quantizedValues[frame] = EncodeRotation(values[frame]);
+                    DecodeRotation(quantizedValues[frame].data(), decodedValues[frame].data(), 1);
+                }
+            } else {
+                CurveValue minValue = values[0];
+                CurveValue maxValue = values[0];
+                for (const CurveValue& value : values) {
+                    for (std::size_t i = 0; i < 3; ++i) {
+                        minValue[i] = std::min(minValue[i], value[i]);
+                        maxValue[i] = std::max(maxValue[i], value[i]);
+                    }
+                }
+
+                // The largest quantized value decodes to 65535 / 65536
+                for (std::size_t i = 0; i < 3; ++i) {
+                    curve.offsets[i] = minValue[i];
+                    curve.scales[i] = (maxValue[i] - minValue[i]) * (65536.0f / MaxValue16);
+                }
+
+                for (UInt32 frame = 0; frame < m_frameCount; ++frame) {
+                    for (std::size_t i = 0; i < 3; ++i) {
+                        const float extent = maxValue[i] - minValue[i];
+                        const float unit = (extent > 0.0f) ? (values[frame][i] - minValue[i]) / extent : 0.0f;
+                        quantizedValues[frame][i] = EncodeUnit(unit, MaxValue16);
+                        decodedValues[frame][i] = curve.offsets[i] + curve.scales[i] *
+                                                                         DecodeUnit16(quantizedValues[frame][i]);
+                    }
+
+                    decodedValues[frame][3] = 0.0f;
+                }
+            }
+
+            const std::vector<UInt32> keys = ReduceKeys(type, values, decodedValues, tolerance);
+            for (const UInt32 frame : keys) {
+                m_keyFrames.push_back(static_cast<UInt16>(frame));
+                m_keyValues.insert(m_keyValues.end(), quantizedValues[frame].begin(), quantizedValues[frame].end());
+            }
+
+            curve.keyCount = static_cast<UInt32>(keys.size());
+            m_curves.push_back(curve);
+        };
+
+        m_curves.reserve(animation.tracks.size() * CurvesPerJoint);
+        for (const RawAnimation::JointTrack& track : animation.tracks) {
+            addCurve(CurveType::Translation, track.translations, settings.translationTolerance);
+            addCurve(CurveType::Rotation, track.rotations, settings.rotationTolerance);
+            addCurve(CurveType::Scale, track.scales, settings.scaleTolerance);
+        }
+
+        m_keyFrames.shrink_to_fit();
+        m_keyValues.shrink_to_fit();
+    }
+
+    std::size_t AnimationClip::GetMemoryFootprint() const {
+        return sizeof(*this) + m_curves.capacity() * sizeof(Curve) + m_keyFrames.capacity() * sizeof(UInt16) +
+               m_keyValues.capacity() * sizeof(UInt16);
+    }
+
+    void AnimationClip::Sample(const float time, LocalPose& pose) const {
+        const std::size_t jointCount = GetJointCount();
+        FlAssertMsg(pose.GetJointCount() == jointCount, "[Animation/AnimationClip] Pose doesn't match the clip.");
+
+        const float frame = std::clamp(time * m_frameRate, 0.0f, static_cast<float>(m_frameCount - 1));
+
+        constexpr std::size_t Width = SimdFloat4::Width;
+        alignas(16) float from[4][Width];
+        alignas(16) float to[4][Width];
+        alignas(16) float alphas[Width];
+
+        const SimdFloat4 zero = SimdFloat4::Zero();
+        const SimdFloat4 one = SimdFloat4::Splat(1.0f);
+
+        const PoseComponent firstComponents[] = {PoseComponent::TranslationX, PoseComponent::RotationX,
+                                                 PoseComponent::ScaleX};
+        for (std::size_t firstJoint = 0; firstJoint < jointCount; firstJoint += Width) {
+            for (std::size_t curveIndex = 0; curveIndex < CurvesPerJoint; ++curveIndex) {
+                const auto type = static_cast<CurveType>(curveIndex);
+
+                // Decodes the keys around the frame of each joint, as structure of arrays
+                for (std::size_t lane = 0; lane < Width; ++lane) {
+                    const std::size_t joint = firstJoint + lane;
+                    if (joint >= jointCount) {
+                        // Padding joints sample the identity transform
+                        const float identity = (type == CurveType::Scale) ? 1.0f : 0.0f;
+                        for (std::size_t i = 0; i < 4; ++i) {
+                            from[i][lane] = (type == CurveType::Rotation) ? ((i == 3) ? 1.0f : 0.0f) : identity;
+                            to[i][lane] = from[i][lane];
+                        }
+
+                        alphas[lane] = 0.0f;
+                        continue;
+                    }
+
+                    const Curve& curve = m_curves[joint * CurvesPerJoint + curveIndex];
+                    const UInt16* keyFrames = &m_keyFrames[curve.firstKey];
+                    const UInt16* keyFramesEnd = keyFrames + curve.keyCount;
+
+                    const UInt16* next = std::upper_bound(keyFrames, keyFramesEnd, frame,
+                                                          [](const float value, const UInt16 keyFrame) {
+                                                              return value < static_cast<float>(keyFrame);
+                                                          });
+                    const UInt16* previous = next - 1;
+                    if (next == keyFramesEnd) {
+                        next = previous;
+                        alphas[lane] = 0.0f;
+                    } else {
+                        alphas[lane] = (frame - static_cast<float>(*previous)) /
+                                       static_cast<float>(*next - *previous);
+                    }
+
+                    const UInt16* fromValues = &m_keyValues[3 * (curve.firstKey + (previous - keyFrames))];
+                    const UInt16* toValues = &m_keyValues[3 * (curve.firstKey + (next - keyFrames))];
+                    if (type == CurveType::Rotation) {
+                        DecodeRotation(fromValues, &from[0][lane], Width);
+                        DecodeRotation(toValues, &to[0][lane], Width);
+                    } else {
+                        for (std::size_t i = 0; i < 3; ++i) {
+                            from[i][lane] = curve.offsets[i] + curve.scales[i] * DecodeUnit16(fromValues[i]);
+                            to[i][lane] = curve.offsets[i] + curve.scales[i] * DecodeUnit16(toValues[i]);
+                        }
+                    }
+                }
+
+                const SimdFloat4 alpha = SimdFloat4::LoadAligned(alphas);
+                const auto firstComponent = static_cast<std::size_t>(firstComponents[curveIndex]);
+                const auto getOutput = [&](const std::size_t i) {
+                    return &pose.GetComponents(static_cast<PoseComponent>(firstComponent + i))[firstJoint];
+                };
+
+                if (type != CurveType::Rotation) {
+                    for (std::size_t i = 0; i < 3; ++i) {
+                        const SimdFloat4 first = SimdFloat4::LoadAligned(from[i]);
+                        const SimdFloat4 second = SimdFloat4::LoadAligned(to[i]);
+                        SimdFloat4::MultiplyAdd(second - first, alpha, first).Store(getOutput(i));
+                    }
+
+                    continue;
+                }
+
+                // Normalized lerp along the shortest path
+                SimdFloat4 dot = zero;
+                for (std::size_t i = 0; i < 4; ++i) {
+                    dot = SimdFloat4::MultiplyAdd(SimdFloat4::LoadAligned(from[i]), SimdFloat4::LoadAligned(to[i]),
+                                                  dot);
+                }
+
+                const SimdFloat4 toWeights = SimdFloat4::Select(SimdFloat4::Less(dot, zero), -alpha, alpha);
+                const SimdFloat4 fromWeights = one - alpha;
+
+                SimdFloat4 rotation[4];
+                SimdFloat4 squaredLength = zero;
+                for (std::size_t i = 0; i < 4; ++i) {
+                    rotation[i] = SimdFloat4::MultiplyAdd(SimdFloat4::LoadAligned(to[i]), toWeights,
+                                                          SimdFloat4::LoadAligned(from[i]) * fromWeights);
+                    squaredLength = SimdFloat4::MultiplyAdd(rotation[i], rotation[i], squaredLength);
+                }
+
+                const SimdFloat4 inverseLength = one / SimdFloat4::Sqrt(squaredLength);
+                for (std::size_t i = 0; i < 4; ++i) {
+                    (rotation[i] * inverseLength).Store(getOutput(i));
+                }
+            }
+        }
+    }
+} // namespace Fl
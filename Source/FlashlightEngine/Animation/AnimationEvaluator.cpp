@@ -0,0 +1,78 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Animation/AnimationEvaluator.hpp>
+
+#include <FlashlightEngine/Animation/AnimationClip.hpp>
+#include <FlashlightEngine/Animation/LocalPose.hpp>
+#include <FlashlightEngine/Animation/Skeleton.hpp>
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    void AnimationEvaluator::Evaluate(const std::span<const Character> characters, ThreadPool* threadPool) {
+        const Clock clock;
+
+        m_statistics = {};
+        m_statistics.characterCount = characters.size();
+        for (const Character& character : characters) {
+            FlAssertMsg(character.skeleton, "[Animation/AnimationEvaluator] Character without skeleton.");
+            FlAssertMsg(character.modelMatrices.size() >= character.skeleton->GetJointCount(),
+                        "[Animation/AnimationEvaluator] Not enough model matrices.");
+
+            m_statistics.jointCount += character.skeleton->GetJointCount();
+            for (const Layer& layer : character.layers) {
+                m_statistics.sampledClipCount += (layer.clip && layer.weight > 0.0f) ? 1 : 0;
+            }
+        }
+
+        const auto evaluateBatch = [&](const std::size_t first, const std::size_t last) {
+            LocalPose pose;
+            LocalPose sampledPose;
+
+            for (std::size_t i = first; i < last; ++i) {
+                const Character& character = characters[i];
+                const Skeleton& skeleton = *character.skeleton;
+
+                // Running blend: each layer takes its share of the weight accumulated so far
+                float accumulatedWeight = 0.0f;
+                for (const Layer& layer : character.layers) {
+                    if (!layer.clip || layer.weight <= 0.0f) {
+                        continue;
+                    }
+
+                    FlAssertMsg(layer.clip->GetJointCount() == skeleton.GetJointCount(),
+                                "[Animation/AnimationEvaluator] Clip doesn't match the skeleton.");
+
+                    if (accumulatedWeight == 0.0f) {
+                        pose.Resize(skeleton.GetJointCount());
+                        layer.clip->Sample(layer.time, pose);
+                        accumulatedWeight = layer.weight;
+                        continue;
+                    }
+
+                    accumulatedWeight += layer.weight;
+                    sampledPose.Resize(skeleton.GetJointCount());
+                    layer.clip->Sample(layer.time, sampledPose);
+                    LocalPose::Blend(pose, sampledPose, layer.weight / accumulatedWeight, pose);
+                }
+
+                const LocalPose& finalPose = (accumulatedWeight > 0.0f) ? pose : skeleton.GetBindPose();
+                finalPose.ComputeModelMatrices(skeleton, character.modelMatrices);
+            }
+        };
+
+        if (threadPool) {
+            threadPool->ParallelFor(characters.size(), BatchSize, evaluateBatch);
+        } else {
+            for (std::size_t first = 0; first < characters.size(); first += BatchSize) {
+                evaluateBatch(first, std::min(first + BatchSize, characters.size()));
+            }
+        }
+
+        m_statistics.evaluationTime = clock.GetElapsedTime();
+    }
+} // namespace Fl
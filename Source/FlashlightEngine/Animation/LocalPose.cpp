@@ -0,0 +1,203 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Animation/LocalPose.hpp>
+
+#include <FlashlightEngine/Animation/Skeleton.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr std::size_t ComponentCount = EnumValueCount_v<PoseComponent>;
+
+        constexpr std::array<float, ComponentCount> IdentityTransform = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+                                                                         1.0f, 1.0f, 1.0f};
+
+        std::size_t GetComponentIndex(const PoseComponent component) {
+            return static_cast<std::size_t>(component);
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    LocalPose::LocalPose(const std::size_t jointCount) {
+        Resize(jointCount);
+    }
+
+    void LocalPose::ComputeModelMatrices(const Skeleton& skeleton, const std::span<Matrix4> matrices) const {
+        FlAssertMsg(skeleton.GetJointCount() == m_jointCount, "[Animation/LocalPose] Skeleton doesn't match the pose.");
+        FlAssertMsg(matrices.size() >= m_jointCount, "[Animation/LocalPose] Not enough matrices.");
+
+        const auto load = [&](const PoseComponent component, const std::size_t joint) {
+            return SimdFloat4::Load(&m_components[GetComponentIndex(component)][joint]);
+        };
+
+        const SimdFloat4 one = SimdFloat4::Splat(1.0f);
+        const SimdFloat4 two = SimdFloat4::Splat(2.0f);
+        for (std::size_t joint = 0; joint < m_jointCount; joint += SimdFloat4::Width) {
+            const SimdFloat4 x = load(PoseComponent::RotationX, joint);
+            const SimdFloat4 y = load(PoseComponent::RotationY, joint);
+            const SimdFloat4 z = load(PoseComponent::RotationZ, joint);
+            const SimdFloat4 w = load(PoseComponent::RotationW, joint);
+            const SimdFloat4 scaleX = load(PoseComponent::ScaleX, joint);
+            const SimdFloat4 scaleY = load(PoseComponent::ScaleY, joint);
+            const SimdFloat4 scaleZ = load(PoseComponent::ScaleZ, joint);
+
+            const SimdFloat4 x2 = x * two;
+            const SimdFloat4 y2 = y * two;
+            const SimdFloat4 z2 = z * two;
+            const SimdFloat4 xx = x * x2;
+            const SimdFloat4 yy = y * y2;
+            const SimdFloat4 zz = z * z2;
+            const SimdFloat4 xy = x * y2;
+            const SimdFloat4 xz = x * z2;
+            const SimdFloat4 yz = y * z2;
+            const SimdFloat4 wx = w * x2;
+            const SimdFloat4 wy = w * y2;
+            const SimdFloat4 wz = w * z2;
+
+            // Upper 3x4 part of the matrix of each joint, as Matrix4::FromTransform() builds it
+            alignas(16) float elements[12][SimdFloat4::Width];
+            ((one - (yy + zz)) * scaleX).StoreAligned(elements[0]);
+            ((xy + wz) * scaleX).StoreAligned(elements[1]);
+            ((xz - wy) * scaleX).StoreAligned(elements[2]);
+            ((xy - wz) * scaleY).StoreAligned(elements[3]);
+            ((one - (xx + zz)) * scaleY).StoreAligned(elements[4]);
+            ((yz + wx) * scaleY).StoreAligned(elements[5]);
+            ((xz + wy) * scaleZ).StoreAligned(elements[6]);
+            ((yz - wx) * scaleZ).StoreAligned(elements[7]);
+            ((one - (xx + yy)) * scaleZ).StoreAligned(elements[8]);
+            load(PoseComponent::TranslationX, joint).StoreAligned(elements[9]);
+            load(PoseComponent::TranslationY, joint).StoreAligned(elements[10]);
+            load(PoseComponent::TranslationZ, joint).StoreAligned(elements[11]);
+
+            const std::size_t laneCount = std::min<std::size_t>(SimdFloat4::Width, m_jointCount - joint);
+            for (std::size_t lane = 0; lane < laneCount; ++lane) {
+                float* data = matrices[joint + lane].data;
+                for (std::size_t column = 0; column < 4; ++column) {
+                    data[column * 4 + 0] = elements[column * 3 + 0][lane];
+                    data[column * 4 + 1] = elements[column * 3 + 1][lane];
+                    data[column * 4 + 2] = elements[column * 3 + 2][lane];
+                    data[column * 4 + 3] = (column == 3) ? 1.0f : 0.0f;
+                }
+            }
+        }
+
+        // Parents come first, their model matrix is ready
+        const std::span<const UInt32> parents = skeleton.GetParents();
+        for (std::size_t joint = 0; joint < m_jointCount; ++joint) {
+            if (parents[joint] != Skeleton::InvalidJoint) {
+                matrices[joint] = matrices[parents[joint]] * matrices[joint];
+            }
+        }
+    }
+
+    Quaternion LocalPose::GetRotation(const std::size_t joint) const {
+        FlAssertMsg(joint < m_jointCount, "[Animation/LocalPose] Invalid joint.");
+
+        return {m_components[GetComponentIndex(PoseComponent::RotationX)][joint],
+                m_components[GetComponentIndex(PoseComponent::RotationY)][joint],
+                m_components[GetComponentIndex(PoseComponent::RotationZ)][joint],
+                m_components[GetComponentIndex(PoseComponent::RotationW)][joint]};
+    }
+
+    Vector3 LocalPose::GetScale(const std::size_t joint) const {
+        FlAssertMsg(joint < m_jointCount, "[Animation/LocalPose] Invalid joint.");
+
+        return {m_components[GetComponentIndex(PoseComponent::ScaleX)][joint],
+                m_components[GetComponentIndex(PoseComponent::ScaleY)][joint],
+                m_components[GetComponentIndex(PoseComponent::ScaleZ)][joint]};
+    }
+
+    Vector3 LocalPose::GetTranslation(const std::size_t joint) const {
+        FlAssertMsg(joint < m_jointCount, "[Animation/LocalPose] Invalid joint.");
+
+        return {m_components[GetComponentIndex(PoseComponent::TranslationX)][joint],
+                m_components[GetComponentIndex(PoseComponent::TranslationY)][joint],
+                m_components[GetComponentIndex(PoseComponent::TranslationZ)][joint]};
+    }
+
+    void LocalPose::Resize(const std::size_t jointCount) {
+        const std::size_t paddedCount = (jointCount + SimdFloat4::Width - 1) / SimdFloat4::Width * SimdFloat4::Width;
+        for (std::size_t component = 0; component < ComponentCount; ++component) {
+            std::vector<float>& values = m_components[component];
+
+            // Padding joints are identity transforms as well
+            values.resize(paddedCount);
+            std::fill(values.begin() + static_cast<std::ptrdiff_t>(std::min(m_jointCount, jointCount)), values.end(),
+                      IdentityTransform[component]);
+        }
+
+        m_jointCount = jointCount;
+    }
+
+    void LocalPose::SetTransform(const std::size_t joint, const Vector3& translation, const Quaternion& rotation,
+                                 const Vector3& scale) {
+        FlAssertMsg(joint < m_jointCount, "[Animation/LocalPose] Invalid joint.");
+
+        const std::array<float, ComponentCount> values = {translation.x, translation.y, translation.z, rotation.x,
+                                                          rotation.y,    rotation.z,    rotation.w,    scale.x,
+                                                          scale.y,       scale.z};
+        for (std::size_t component = 0; component < ComponentCount; ++component) {
+            m_components[component][joint] = values[component];
+        }
+    }
+
+    void LocalPose::Blend(const LocalPose& first, const LocalPose& second, const float weight, LocalPose& output) {
+        FlAssertMsg(first.m_jointCount == second.m_jointCount, "[Animation/LocalPose] Poses don't match.");
+
+        if (output.m_jointCount != first.m_jointCount) {
+            output.Resize(first.m_jointCount);
+        }
+
+        const SimdFloat4 weights = SimdFloat4::Splat(weight);
+        const SimdFloat4 zero = SimdFloat4::Zero();
+        const std::size_t jointCount = first.GetPaddedJointCount();
+
+        // Translations and scales
+        for (const PoseComponent component :
+             {PoseComponent::TranslationX, PoseComponent::TranslationY, PoseComponent::TranslationZ,
+              PoseComponent::ScaleX, PoseComponent::ScaleY, PoseComponent::ScaleZ}) {
+            const float* firstValues = first.GetComponents(component).data();
+            const float* secondValues = second.GetComponents(component).data();
+            float* outputValues = output.GetComponents(component).data();
+            for (std::size_t joint = 0; joint < jointCount; joint += SimdFloat4::Width) {
+                const SimdFloat4 from = SimdFloat4::Load(&firstValues[joint]);
+                const SimdFloat4 to = SimdFloat4::Load(&secondValues[joint]);
+                SimdFloat4::MultiplyAdd(to - from, weights, from).Store(&outputValues[joint]);
+            }
+        }
+
+        // Rotations, the second quaternion being negated when it is in the other hemisphere
+        const std::size_t rotationX = GetComponentIndex(PoseComponent::RotationX);
+        for (std::size_t joint = 0; joint < jointCount; joint += SimdFloat4::Width) {
+            SimdFloat4 from[4];
+            SimdFloat4 to[4];
+            SimdFloat4 dot = zero;
+            for (std::size_t i = 0; i < 4; ++i) {
+                from[i] = SimdFloat4::Load(&first.m_components[rotationX + i][joint]);
+                to[i] = SimdFloat4::Load(&second.m_components[rotationX + i][joint]);
+                dot = SimdFloat4::MultiplyAdd(from[i], to[i], dot);
+            }
+
+            const SimdFloat4 toWeights = SimdFloat4::Select(SimdFloat4::Less(dot, zero), -weights, weights);
+            const SimdFloat4 fromWeights = SimdFloat4::Splat(1.0f) - weights;
+
+            SimdFloat4 blended[4];
+            SimdFloat4 squaredLength = zero;
+            for (std::size_t i = 0; i < 4; ++i) {
+                blended[i] = SimdFloat4::MultiplyAdd(to[i], toWeights, from[i] * fromWeights);
+                squaredLength = SimdFloat4::MultiplyAdd(blended[i], blended[i], squaredLength);
+            }
+
+            const SimdFloat4 inverseLength = SimdFloat4::Splat(1.0f) / SimdFloat4::Sqrt(squaredLength);
+            for (std::size_t i = 0; i < 4; ++i) {
+                (blended[i] * inverseLength).Store(&output.m_components[rotationX + i][joint]);
+            }
+        }
+    }
+} // namespace Fl
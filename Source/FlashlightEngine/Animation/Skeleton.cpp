@@ -0,0 +1,33 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Animation/Skeleton.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    Skeleton::Skeleton(const std::span<const Joint> joints) : m_bindPose(joints.size()) {
+        m_names.reserve(joints.size());
+        m_parents.reserve(joints.size());
+        for (std::size_t joint = 0; joint < joints.size(); ++joint) {
+            const Joint& data = joints[joint];
+            FlAssertMsg(data.parent == InvalidJoint || data.parent < joint,
+                        "[Animation/Skeleton] Joints must come after their parent.");
+
+            m_names.push_back(data.name);
+            m_parents.push_back(data.parent);
+            m_bindPose.SetTransform(joint, data.translation, data.rotation, data.scale);
+        }
+    }
+
+    UInt32 Skeleton::FindJoint(const std::string_view name) const {
+        for (std::size_t joint = 0; joint < m_names.size(); ++joint) {
+            if (m_names[joint] == name) {
+                return static_cast<UInt32>(joint);
+            }
+        }
+
+        return InvalidJoint;
+    }
+} // namespace Fl
@@ -0,0 +1,141 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Audio/AudioBuffer.hpp>
+
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+#include <FlashlightEngine/Utility/PathUtils.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr UInt16 WavePcmFormat = 1;
+        constexpr UInt16 WaveFloatFormat = 3;
+        constexpr UInt16 WaveExtensibleFormat = 0xFFFE;
+
+        bool SetError(std::string* errorMessage, std::string message) {
+            if (errorMessage) {
+                *errorMessage = std::move(message);
+            }
+
+            return false;
+        }
+
+        UInt32 ReadLittleEndian(const UInt8* bytes, const std::size_t byteCount) {
+            UInt32 value = 0;
+            for (std::size_t i = 0; i < byteCount; ++i) {
+                value |= static_cast<UInt32>(bytes[i]) << (8 * i);
+            }
+
+            return value;
+        }
+
+        float DecodeSample(const UInt8* bytes, const UInt16 format, const UInt32 bitsPerSample) {
+            if (format == WaveFloatFormat) {
+                return BitCast<float>(ReadLittleEndian(bytes, 4));
+            }
+
+            // 8-bit samples are unsigned, wider ones are signed
+            const UInt32 value = ReadLittleEndian(bytes, bitsPerSample / 8);
+            if (bitsPerSample == 8) {
+                return (static_cast<float>(value) - 128.0f) / 128.0f;
+            }
+
+            const UInt32 shift = 32 - bitsPerSample;
+            const auto signedValue = static_cast<Int32>(value << shift) >> shift;
+            return static_cast<float>(signedValue) / static_cast<float>(UInt32(1) << (bitsPerSample - 1));
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    AudioBuffer::AudioBuffer(std::vector<float> samples, const UInt32 sampleRate) :
+    m_samples(std::move(samples)), m_sampleRate(sampleRate) {
+        FlAssertMsg(sampleRate > 0, "[Audio/AudioBuffer] Invalid sample rate.");
+    }
+
+    std::optional<AudioBuffer> AudioBuffer::LoadFromFile(const std::string_view filePath, std::string* errorMessage) {
+        const std::filesystem::path path = Utf8Path(filePath);
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            SetError(errorMessage, "Failed to open " + PathToString(path) + ".");
+            return std::nullopt;
+        }
+
+        const std::vector<UInt8> bytes{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        if (bytes.size() < 12 || std::memcmp(bytes.data(), "RIFF", 4) != 0 ||
+            std::memcmp(&bytes[8], "WAVE", 4) != 0) {
+            SetError(errorMessage, PathToString(path) + " isn't a WAV file.");
+            return std::nullopt;
+        }
+
+        UInt16 format = 0;
+        UInt32 channelCount = 0;
+        UInt32 sampleRate = 0;
+        UInt32 bitsPerSample = 0;
+        const UInt8* data = nullptr;
+        std::size_t dataSize = 0;
+
+        // Chunks are padded to an even size
+        for (std::size_t offset = 12; offset + 8 <= bytes.size();) {
+            const UInt8* chunk = &bytes[offset];
+            const std::size_t chunkSize =
+                std::min<std::size_t>(ReadLittleEndian(chunk + 4, 4), bytes.size() - offset - 8);
+
+            if (std::memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 16) {
+                format = static_cast<UInt16>(ReadLittleEndian(chunk + 8, 2));
+                channelCount = ReadLittleEndian(chunk + 10, 2);
+                sampleRate = ReadLittleEndian(chunk + 12, 4);
+                bitsPerSample = ReadLittleEndian(chunk + 22, 2);
+
+                // The sub-format GUID starts with the format tag
+                if (format == WaveExtensibleFormat && chunkSize >= 26) {
+                    format = static_cast<UInt16>(ReadLittleEndian(chunk + 32, 2));
+                }
+            } else if (std::memcmp(chunk, "data", 4) == 0) {
+                data = chunk + 8;
+                dataSize = chunkSize;
+            }
+
+            offset += 8 + chunkSize + (chunkSize & 1);
+        }
+
+        const bool isSupportedFormat =
+            (format == WavePcmFormat && (bitsPerSample == 8 || bitsPerSample == 16 || bitsPerSample == 24 ||
+                                         bitsPerSample == 32)) ||
+            (format == WaveFloatFormat && bitsPerSample == 32);
+        if (!isSupportedFormat || channelCount == 0 || sampleRate == 0) {
+            SetError(errorMessage, PathToString(path) + " has an unsupported sample format.");
+            return std::nullopt;
+        }
+
+        if (!data) {
+            SetError(errorMessage, PathToString(path) + " has no data chunk.");
+            return std::nullopt;
+        }
+
+        const std::size_t frameSize = static_cast<std::size_t>(channelCount) * (bitsPerSample / 8);
+        const std::size_t frameCount = dataSize / frameSize;
+        const float channelScale = 1.0f / static_cast<float>(channelCount);
+
+        std::vector<float> samples(frameCount);
+        for (std::size_t frame = 0; frame < frameCount; ++frame) {
+            const UInt8* frameBytes = data + frame * frameSize;
+
+            float sum = 0.0f;
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                sum += DecodeSample(frameBytes + channel * (bitsPerSample / 8), format, bitsPerSample);
+            }
+
+            samples[frame] = sum * channelScale;
+        }
+
+        return AudioBuffer(std::move(samples), sampleRate);
+    }
+} // namespace Fl
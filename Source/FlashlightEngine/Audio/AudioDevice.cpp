@@ -0,0 +1,9 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Audio/AudioDevice.hpp>
+
+namespace Fl {
+    AudioDevice::~AudioDevice() = default;
+} // namespace Fl
@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Audio/AudioDeviceLibrary.hpp>
+
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    void AudioDeviceLibrary::DeviceDeleter::operator()(AudioDevice* device) const {
+        destroy(device);
+    }
+
+    auto AudioDeviceLibrary::CreateDevice(const char* options) const -> DevicePtr {
+        FlAssertMsg(IsLoaded(), "[Audio/AudioDeviceLibrary] No plugin is loaded.");
+
+        return DevicePtr(m_create(options), DeviceDeleter{m_destroy});
+    }
+
+    bool AudioDeviceLibrary::Load(const std::filesystem::path& libraryPath, std::string* errorMessage) {
+        Unload();
+
+        DynLib library;
+        if (!library.Load(libraryPath)) {
+            if (errorMessage) {
+                *errorMessage = library.GetLastError();
+            }
+
+            return false;
+        }
+
+        const auto create = BitCast<AudioDeviceCreateFunc>(library.GetSymbol(AudioDevice::CreateFunctionName));
+        const auto destroy = BitCast<AudioDeviceDestroyFunc>(library.GetSymbol(AudioDevice::DestroyFunctionName));
+        if (!create || !destroy) {
+            if (errorMessage) {
+                *errorMessage = "The library doesn't export the audio device plugin functions.";
+            }
+
+            return false;
+        }
+
+        m_library = std::move(library);
+        m_create = create;
+        m_destroy = destroy;
+        return true;
+    }
+
+    void AudioDeviceLibrary::Unload() {
+        m_create = nullptr;
+        m_destroy = nullptr;
+        m_library.Unload();
+    }
+} // namespace Fl
@@ -0,0 +1,557 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Audio/AudioMixer.hpp>
+
+#include <FlashlightEngine/Audio/AudioBuffer.hpp>
+#include <FlashlightEngine/Audio/AudioDevice.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        // Voice identifiers hold the slot of the voice and the generation of the slot
+        constexpr UInt32 GenerationShift = 16;
+        constexpr UInt32 SlotMask = (1u << GenerationShift) - 1;
+
+        // Sound positions are 32.32 fixed point numbers
+        constexpr UInt64 FixedPointOne = UInt64(1) << 32;
+        constexpr float FixedPointFraction = 1.0f / static_cast<float>(FixedPointOne);
+
+        constexpr float MinPitch = 1.0f / 1024.0f;
+        constexpr float MaxPitch = 1024.0f;
+
+        enum VoiceFlag : UInt8 {
+            Looping = 1 << 0,
+            Stopping = 1 << 1 //< Faded out by the current block, then released
+        };
+
+        UInt64 ComputeStep(const double rateRatio, const float pitch) {
+            const double step = rateRatio * std::clamp(pitch, MinPitch, MaxPitch) * static_cast<double>(FixedPointOne);
+            return std::max<UInt64>(static_cast<UInt64>(step), 1);
+        }
+
+        // Constant power pan law, matching AudioMixer::UpdateChannelGains()
+        void ComputeChannelGains(const float gain, const float pan, float& left, float& right) {
+            const float clampedPan = std::clamp(pan, -1.0f, 1.0f);
+            left = gain * std::sqrt((1.0f - clampedPan) * 0.5f);
+            right = gain * std::sqrt((1.0f + clampedPan) * 0.5f);
+        }
+
+        float GetFraction(const UInt64 position) {
+            return static_cast<float>(position & (FixedPointOne - 1)) * FixedPointFraction;
+        }
+
+        /**
+         * @brief Accumulates a source into a destination, with a gain going linearly from start + step to
+         *        start + frameCount * step.
+         */
+        void AccumulateRamp(const float* source, float* destination, const UInt32 frameCount, const float start,
+                            const float step) {
+            const SimdFloat4 offsets(1.0f, 2.0f, 3.0f, 4.0f);
+            const SimdFloat4 gainStep = SimdFloat4::Splat(step);
+
+            UInt32 frame = 0;
+            for (; frame + SimdFloat4::Width <= frameCount; frame += SimdFloat4::Width) {
+                const SimdFloat4 gain =
+                    SimdFloat4::MultiplyAdd(SimdFloat4::Splat(static_cast<float>(frame)) + offsets, gainStep,
+                                            SimdFloat4::Splat(start));
+                const SimdFloat4 value = SimdFloat4::Load(&destination[frame]);
+                SimdFloat4::MultiplyAdd(SimdFloat4::Load(&source[frame]), gain, value).Store(&destination[frame]);
+            }
+
+            for (; frame < frameCount; ++frame) {
+                destination[frame] += source[frame] * (start + static_cast<float>(frame + 1) * step);
+            }
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    AudioMixer::AudioMixer() : AudioMixer(Settings{}) {}
+
+    AudioMixer::AudioMixer(const Settings& settings) :
+    m_statistics{}, m_commands(settings.commandCapacity), m_releasedVoices(settings.maxVoiceCount),
+    m_settings(settings) {
+        FlAssertMsg(settings.sampleRate > 0, "[Audio/AudioMixer] Invalid sample rate.");
+        FlAssertMsg(settings.blockFrameCount > 0 && settings.blockFrameCount % SimdFloat4::Width == 0,
+                    "[Audio/AudioMixer] Block frame count must be a non-zero multiple of the SIMD width.");
+        FlAssertMsg(settings.maxVoiceCount > 0 && settings.maxVoiceCount <= SlotMask,
+                    "[Audio/AudioMixer] Invalid maximum voice count.");
+        FlAssertMsg(settings.maxBusCount > 0, "[Audio/AudioMixer] At least the master bus is required.");
+
+        const UInt32 voiceCount = settings.maxVoiceCount;
+        m_slotGenerations.assign(voiceCount, 0);
+        m_freeSlots.resize(voiceCount);
+        for (UInt32 slot = 0; slot < voiceCount; ++slot) {
+            m_freeSlots[slot] = static_cast<UInt16>(voiceCount - 1 - slot);
+        }
+
+        // The channel gains are computed a SIMD group at a time, lanes past the last voice staying silent
+        const std::size_t laneCapacity = (voiceCount + SimdFloat4::Width - 1) / SimdFloat4::Width * SimdFloat4::Width;
+        m_voiceSamples.resize(voiceCount);
+        m_voicePositions.resize(voiceCount);
+        m_voiceSteps.resize(voiceCount);
+        m_voiceRateRatios.resize(voiceCount);
+        m_voiceGains.assign(laneCapacity, 0.0f);
+        m_voicePans.assign(laneCapacity, 0.0f);
+        m_voiceLeftGains.resize(voiceCount);
+        m_voiceRightGains.resize(voiceCount);
+        m_voiceTargetLeftGains.resize(laneCapacity);
+        m_voiceTargetRightGains.resize(laneCapacity);
+        m_voiceIds.resize(voiceCount);
+        m_voiceLengths.resize(voiceCount);
+        m_voiceBuses.resize(voiceCount);
+        m_voiceFlags.resize(voiceCount);
+        m_slotLanes.assign(voiceCount, InvalidLane);
+        m_endedLanes.reserve(voiceCount);
+
+        m_busSamples.resize(static_cast<std::size_t>(settings.maxBusCount) * 2 * settings.blockFrameCount);
+        m_busGains.assign(settings.maxBusCount, 1.0f);
+        m_busCurrentGains.assign(settings.maxBusCount, 1.0f);
+        m_busParents.assign(settings.maxBusCount, MasterBus);
+        m_busUsed.assign(settings.maxBusCount, 0);
+    }
+
+    AudioMixer::~AudioMixer() {
+        Stop();
+    }
+
+    auto AudioMixer::CreateBus(const BusId parent, const float gain) -> BusId {
+        FlAssertMsg(parent < m_busCount, "[Audio/AudioMixer] Invalid parent bus.");
+
+        if (m_busCount == m_settings.maxBusCount) {
+            return InvalidBus;
+        }
+
+        VoiceParameters parameters;
+        parameters.bus = parent;
+        if (!PushCommand({CommandType::CreateBus, m_busCount, gain, nullptr, parameters})) {
+            return InvalidBus;
+        }
+
+        return m_busCount++;
+    }
+
+    UInt32 AudioMixer::GetPlayingVoiceCount() {
+        CollectVoices();
+
+        return m_settings.maxVoiceCount - static_cast<UInt32>(m_freeSlots.size());
+    }
+
+    bool AudioMixer::IsPlaying(const VoiceId voice) {
+        CollectVoices();
+
+        // Released slots move to the next generation, which no identifier was given yet
+        const UInt32 slot = voice & SlotMask;
+        return slot < m_settings.maxVoiceCount && m_slotGenerations[slot] == voice >> GenerationShift;
+    }
+
+    auto AudioMixer::Play(const AudioBuffer& buffer) -> VoiceId {
+        return Play(buffer, VoiceParameters{});
+    }
+
+    auto AudioMixer::Play(const AudioBuffer& buffer, const VoiceParameters& parameters) -> VoiceId {
+        FlAssertMsg(buffer.IsValid(), "[Audio/AudioMixer] Invalid buffer.");
+        FlAssertMsg(buffer.GetSampleCount() < std::numeric_limits<UInt32>::max(),
+                    "[Audio/AudioMixer] Buffer too long.");
+        FlAssertMsg(parameters.bus < m_busCount, "[Audio/AudioMixer] Invalid bus.");
+
+        CollectVoices();
+        if (m_freeSlots.empty()) {
+            return InvalidVoice;
+        }
+
+        const UInt32 slot = m_freeSlots.back();
+        const VoiceId voice = (static_cast<UInt32>(m_slotGenerations[slot]) << GenerationShift) | slot;
+        if (!PushCommand({CommandType::Play, voice, 0.0f, &buffer, parameters})) {
+            return InvalidVoice;
+        }
+
+        m_freeSlots.pop_back();
+        return voice;
+    }
+
+    void AudioMixer::Render(const std::span<float> samples) {
+        FlAssertMsg(!IsRunning(), "[Audio/AudioMixer] Can't render while the mixing thread is running.");
+        FlAssertMsg(samples.size() % AudioDevice::ChannelCount == 0, "[Audio/AudioMixer] Incomplete frame.");
+
+        const std::size_t frameCount = samples.size() / AudioDevice::ChannelCount;
+        for (std::size_t frame = 0; frame < frameCount; frame += m_settings.blockFrameCount) {
+            const auto blockFrameCount =
+                static_cast<UInt32>(std::min<std::size_t>(frameCount - frame, m_settings.blockFrameCount));
+            MixBlock(&samples[frame * AudioDevice::ChannelCount], blockFrameCount);
+        }
+    }
+
+    bool AudioMixer::SetBusGain(const BusId bus, const float gain) {
+        FlAssertMsg(bus < m_busCount, "[Audio/AudioMixer] Invalid bus.");
+
+        return PushCommand({CommandType::SetBusGain, bus, gain, nullptr, {}});
+    }
+
+    bool AudioMixer::SetVoiceGain(const VoiceId voice, const float gain) {
+        return PushCommand({CommandType::SetVoiceGain, voice, gain, nullptr, {}});
+    }
+
+    bool AudioMixer::SetVoicePan(const VoiceId voice, const float pan) {
+        return PushCommand({CommandType::SetVoicePan, voice, pan, nullptr, {}});
+    }
+
+    bool AudioMixer::SetVoicePitch(const VoiceId voice, const float pitch) {
+        return PushCommand({CommandType::SetVoicePitch, voice, pitch, nullptr, {}});
+    }
+
+    void AudioMixer::Start(AudioDevice& device) {
+        FlAssertMsg(!IsRunning(), "[Audio/AudioMixer] The mixing thread is already running.");
+        FlAssertMsg(device.IsOpen() && device.GetSampleRate() == m_settings.sampleRate,
+                    "[Audio/AudioMixer] The device must be open at the sample rate of the mixer.");
+
+        m_isRunning.store(true, std::memory_order_relaxed);
+        m_thread = std::thread(&AudioMixer::RunThread, this, std::ref(device));
+    }
+
+    void AudioMixer::Stop() {
+        if (!IsRunning()) {
+            return;
+        }
+
+        m_isRunning.store(false, std::memory_order_relaxed);
+        m_thread.join();
+    }
+
+    bool AudioMixer::StopVoice(const VoiceId voice) {
+        return PushCommand({CommandType::StopVoice, voice, 0.0f, nullptr, {}});
+    }
+
+    void AudioMixer::ApplyCommand(const Command& command) {
+        if (command.type == CommandType::CreateBus) {
+            m_busParents[command.target] = command.parameters.bus;
+            m_busGains[command.target] = command.value;
+            m_busCurrentGains[command.target] = command.value;
+            m_mixerBusCount = command.target + 1;
+            return;
+        }
+
+        if (command.type == CommandType::SetBusGain) {
+            m_busGains[command.target] = command.value;
+            return;
+        }
+
+        if (command.type == CommandType::Play) {
+            const AudioBuffer& buffer = *command.buffer;
+            const VoiceParameters& parameters = command.parameters;
+
+            const UInt32 lane = m_laneCount++;
+            m_slotLanes[command.target & SlotMask] = lane;
+            m_voiceIds[lane] = command.target;
+            m_voiceSamples[lane] = buffer.GetSamples().data();
+            m_voiceLengths[lane] = static_cast<UInt32>(buffer.GetSampleCount());
+            m_voicePositions[lane] = 0;
+            m_voiceRateRatios[lane] = static_cast<double>(buffer.GetSampleRate()) / m_settings.sampleRate;
+            m_voiceSteps[lane] = ComputeStep(m_voiceRateRatios[lane], parameters.pitch);
+            m_voiceGains[lane] = parameters.gain;
+            m_voicePans[lane] = parameters.pan;
+            m_voiceBuses[lane] = parameters.bus;
+            m_voiceFlags[lane] = parameters.isLooping ? Looping : 0;
+
+            // Starts at its gains, the sound having its own attack
+            ComputeChannelGains(parameters.gain, parameters.pan, m_voiceLeftGains[lane], m_voiceRightGains[lane]);
+            return;
+        }
+
+        const UInt32 lane = FindLane(command.target);
+        if (lane == InvalidLane || (m_voiceFlags[lane] & Stopping)) {
+            return;
+        }
+
+        switch (command.type) {
+            case CommandType::SetVoiceGain:
+                m_voiceGains[lane] = command.value;
+                break;
+
+            case CommandType::SetVoicePan:
+                m_voicePans[lane] = command.value;
+                break;
+
+            case CommandType::SetVoicePitch:
+                m_voiceSteps[lane] = ComputeStep(m_voiceRateRatios[lane], command.value);
+                break;
+
+            case CommandType::StopVoice:
+                // Fades out over the block instead of clicking
+                m_voiceGains[lane] = 0.0f;
+                m_voiceFlags[lane] |= Stopping;
+                break;
+
+            case CommandType::CreateBus:
+            case CommandType::Play:
+            case CommandType::SetBusGain:
+                break;
+        }
+    }
+
+    void AudioMixer::ApplyCommands() {
+        Command commands[64];
+        for (;;) {
+            const std::size_t commandCount = m_commands.TryPopBatch(commands);
+            for (std::size_t i = 0; i < commandCount; ++i) {
+                ApplyCommand(commands[i]);
+            }
+
+            if (commandCount < std::size(commands)) {
+                break;
+            }
+        }
+    }
+
+    void AudioMixer::CollectVoices() {
+        VoiceId voice;
+        while (m_releasedVoices.TryPop(voice)) {
+            const UInt32 slot = voice & SlotMask;
+            ++m_slotGenerations[slot];
+            m_freeSlots.push_back(static_cast<UInt16>(slot));
+        }
+    }
+
+    UInt32 AudioMixer::FindLane(const VoiceId voice) const {
+        const UInt32 slot = voice & SlotMask;
+        if (slot >= m_settings.maxVoiceCount) {
+            return InvalidLane;
+        }
+
+        const UInt32 lane = m_slotLanes[slot];
+        return (lane != InvalidLane && m_voiceIds[lane] == voice) ? lane : InvalidLane;
+    }
+
+    void AudioMixer::MixBlock(float* samples, const UInt32 frameCount) {
+        const Clock clock;
+
+        ApplyCommands();
+        UpdateChannelGains();
+
+        const std::size_t busStride = 2 * static_cast<std::size_t>(m_settings.blockFrameCount);
+        const auto getBus = [&](const BusId bus) {
+            float* left = &m_busSamples[bus * busStride];
+            if (!m_busUsed[bus]) {
+                std::fill_n(left, frameCount, 0.0f);
+                std::fill_n(left + m_settings.blockFrameCount, frameCount, 0.0f);
+                m_busUsed[bus] = 1;
+            }
+
+            return left;
+        };
+
+        std::fill_n(m_busUsed.begin(), m_mixerBusCount, 0);
+
+        const UInt32 voiceCount = m_laneCount;
+        m_endedLanes.clear();
+        for (UInt32 lane = 0; lane < voiceCount; ++lane) {
+            float* left = getBus(m_voiceBuses[lane]);
+            if (MixVoice(lane, frameCount, left, left + m_settings.blockFrameCount)) {
+                m_endedLanes.push_back(lane);
+            }
+        }
+
+        // From the last lane, so that the lanes moved in the released ones didn't end
+        for (auto it = m_endedLanes.rbegin(); it != m_endedLanes.rend(); ++it) {
+            ReleaseVoice(*it);
+        }
+
+        // Children were created after their parent
+        const float rampScale = 1.0f / static_cast<float>(frameCount);
+        for (BusId bus = m_mixerBusCount; bus-- > 0;) {
+            const float gain = m_busCurrentGains[bus];
+            const float gainStep = (m_busGains[bus] - gain) * rampScale;
+            m_busCurrentGains[bus] = m_busGains[bus];
+
+            if (bus == MasterBus) {
+                const float* left = getBus(MasterBus);
+                const float* right = left + m_settings.blockFrameCount;
+                for (UInt32 frame = 0; frame < frameCount; ++frame) {
+                    const float frameGain = gain + static_cast<float>(frame + 1) * gainStep;
+                    samples[2 * frame] = left[frame] * frameGain;
+                    samples[2 * frame + 1] = right[frame] * frameGain;
+                }
+            } else if (m_busUsed[bus]) {
+                const float* left = &m_busSamples[bus * busStride];
+                float* parentLeft = getBus(m_busParents[bus]);
+                AccumulateRamp(left, parentLeft, frameCount, gain, gainStep);
+                AccumulateRamp(left + m_settings.blockFrameCount, parentLeft + m_settings.blockFrameCount, frameCount,
+                               gain, gainStep);
+            }
+        }
+
+        ++m_statistics.blockCount;
+        m_statistics.frameCount += frameCount;
+        m_statistics.voiceCount += voiceCount;
+        m_statistics.mixTime += clock.GetElapsedTime();
+    }
+
+    bool AudioMixer::MixVoice(const UInt32 lane, const UInt32 frameCount, float* left, float* right) {
+        const float* samples = m_voiceSamples[lane];
+        const UInt32 length = m_voiceLengths[lane];
+        const UInt64 step = m_voiceSteps[lane];
+        const bool isLooping = (m_voiceFlags[lane] & Looping) != 0;
+        UInt64 position = m_voicePositions[lane];
+
+        const float rampScale = 1.0f / static_cast<float>(frameCount);
+        const float leftGain = m_voiceLeftGains[lane];
+        const float rightGain = m_voiceRightGains[lane];
+        const float leftStep = (m_voiceTargetLeftGains[lane] - leftGain) * rampScale;
+        const float rightStep = (m_voiceTargetRightGains[lane] - rightGain) * rampScale;
+        m_voiceLeftGains[lane] = m_voiceTargetLeftGains[lane];
+        m_voiceRightGains[lane] = m_voiceTargetRightGains[lane];
+
+        const SimdFloat4 offsets(1.0f, 2.0f, 3.0f, 4.0f);
+        const SimdFloat4 leftGains = SimdFloat4::Splat(leftGain);
+        const SimdFloat4 rightGains = SimdFloat4::Splat(rightGain);
+        const SimdFloat4 leftSteps = SimdFloat4::Splat(leftStep);
+        const SimdFloat4 rightSteps = SimdFloat4::Splat(rightStep);
+
+        const auto accumulate = [&](const UInt32 frame, const float sample) {
+            const auto ramp = static_cast<float>(frame + 1);
+            left[frame] += sample * (leftGain + ramp * leftStep);
+            right[frame] += sample * (rightGain + ramp * rightStep);
+        };
+
+        // Frames before this position interpolate between two samples of the sound
+        const UInt64 interpolationEnd = static_cast<UInt64>(length - 1) << 32;
+
+        bool hasEnded = false;
+        UInt32 frame = 0;
+        while (frame < frameCount) {
+            UInt32 runEnd = frame;
+            if (position < interpolationEnd) {
+                const UInt64 runLength = (interpolationEnd - position + step - 1) / step;
+                runEnd += static_cast<UInt32>(std::min<UInt64>(runLength, frameCount - frame));
+            }
+
+            for (; frame + SimdFloat4::Width <= runEnd; frame += SimdFloat4::Width) {
+                SimdFloat4 first;
+                SimdFloat4 second;
+                SimdFloat4 fractions;
+                if (step == FixedPointOne) {
+                    // Original pitch at the mixer rate, the samples are contiguous
+                    const float* source = &samples[position >> 32];
+                    first = SimdFloat4::Load(source);
+                    second = SimdFloat4::Load(source + 1);
+                    fractions = SimdFloat4::Splat(GetFraction(position));
+                    position += SimdFloat4::Width * step;
+                } else {
+                    alignas(16) float firstValues[SimdFloat4::Width];
+                    alignas(16) float secondValues[SimdFloat4::Width];
+                    alignas(16) float fractionValues[SimdFloat4::Width];
+                    for (std::size_t i = 0; i < SimdFloat4::Width; ++i, position += step) {
+                        const std::size_t index = position >> 32;
+                        firstValues[i] = samples[index];
+                        secondValues[i] = samples[index + 1];
+                        fractionValues[i] = GetFraction(position);
+                    }
+
+                    first = SimdFloat4::LoadAligned(firstValues);
+                    second = SimdFloat4::LoadAligned(secondValues);
+                    fractions = SimdFloat4::LoadAligned(fractionValues);
+                }
+
+                const SimdFloat4 values = SimdFloat4::MultiplyAdd(second - first, fractions, first);
+                const SimdFloat4 ramps = SimdFloat4::Splat(static_cast<float>(frame)) + offsets;
+                const SimdFloat4 frameLeftGains = SimdFloat4::MultiplyAdd(ramps, leftSteps, leftGains);
+                const SimdFloat4 frameRightGains = SimdFloat4::MultiplyAdd(ramps, rightSteps, rightGains);
+                SimdFloat4::MultiplyAdd(values, frameLeftGains, SimdFloat4::Load(&left[frame])).Store(&left[frame]);
+                SimdFloat4::MultiplyAdd(values, frameRightGains, SimdFloat4::Load(&right[frame])).Store(&right[frame]);
+            }
+
+            for (; frame < runEnd; ++frame, position += step) {
+                const std::size_t index = position >> 32;
+                const float first = samples[index];
+                accumulate(frame, first + (samples[index + 1] - first) * GetFraction(position));
+            }
+
+            if (frame == frameCount) {
+                break;
+            }
+
+            // Last sample of the sound, or past it
+            std::size_t index = position >> 32;
+            if (index >= length) {
+                if (!isLooping) {
+                    hasEnded = true;
+                    break;
+                }
+
+                position %= static_cast<UInt64>(length) << 32;
+                index = position >> 32;
+                if (index + 1 < length) {
+                    continue;
+                }
+            }
+
+            const float first = samples[index];
+            const float second = (index + 1 < length) ? samples[index + 1] : (isLooping ? samples[0] : 0.0f);
+            accumulate(frame, first + (second - first) * GetFraction(position));
+
+            ++frame;
+            position += step;
+        }
+
+        m_voicePositions[lane] = position;
+        return hasEnded || (m_voiceFlags[lane] & Stopping) != 0;
+    }
+
+    bool AudioMixer::PushCommand(const Command& command) {
+        return m_commands.TryPush(command);
+    }
+
+    void AudioMixer::ReleaseVoice(const UInt32 lane) {
+        const VoiceId voice = m_voiceIds[lane];
+        m_slotLanes[voice & SlotMask] = InvalidLane;
+
+        const UInt32 lastLane = --m_laneCount;
+        if (lane != lastLane) {
+            m_voiceSamples[lane] = m_voiceSamples[lastLane];
+            m_voicePositions[lane] = m_voicePositions[lastLane];
+            m_voiceSteps[lane] = m_voiceSteps[lastLane];
+            m_voiceRateRatios[lane] = m_voiceRateRatios[lastLane];
+            m_voiceGains[lane] = m_voiceGains[lastLane];
+            m_voicePans[lane] = m_voicePans[lastLane];
+            m_voiceLeftGains[lane] = m_voiceLeftGains[lastLane];
+            m_voiceRightGains[lane] = m_voiceRightGains[lastLane];
+            m_voiceIds[lane] = m_voiceIds[lastLane];
+            m_voiceLengths[lane] = m_voiceLengths[lastLane];
+            m_voiceBuses[lane] = m_voiceBuses[lastLane];
+            m_voiceFlags[lane] = m_voiceFlags[lastLane];
+            m_slotLanes[m_voiceIds[lane] & SlotMask] = lane;
+        }
+
+        m_voiceGains[lastLane] = 0.0f;
+
+        [[maybe_unused]] const bool isPushed = m_releasedVoices.TryPush(voice);
+        FlAssertMsg(isPushed, "[Audio/AudioMixer] Released voice queue is full.");
+    }
+
+    void AudioMixer::RunThread(AudioDevice& device) {
+        std::vector<float> samples(static_cast<std::size_t>(m_settings.blockFrameCount) * AudioDevice::ChannelCount);
+        while (m_isRunning.load(std::memory_order_relaxed)) {
+            MixBlock(samples.data(), m_settings.blockFrameCount);
+            if (!device.Write(samples)) {
+                break;
+            }
+        }
+    }
+
+    void AudioMixer::UpdateChannelGains() {
+        const SimdFloat4 half = SimdFloat4::Splat(0.5f);
+        const SimdFloat4 one = SimdFloat4::Splat(1.0f);
+        for (UInt32 lane = 0; lane < m_laneCount; lane += SimdFloat4::Width) {
+            const SimdFloat4 gains = SimdFloat4::Load(&m_voiceGains[lane]);
+            const SimdFloat4 pans = SimdFloat4::Min(SimdFloat4::Max(SimdFloat4::Load(&m_voicePans[lane]), -one), one);
+            (gains * SimdFloat4::Sqrt((one - pans) * half)).Store(&m_voiceTargetLeftGains[lane]);
+            (gains * SimdFloat4::Sqrt((one + pans) * half)).Store(&m_voiceTargetRightGains[lane]);
+        }
+    }
+} // namespace Fl
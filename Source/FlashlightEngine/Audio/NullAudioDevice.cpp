@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Audio/NullAudioDevice.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <thread>
+
+namespace Fl {
+    NullAudioDevice::NullAudioDevice(const bool isRealTime) : m_isRealTime(isRealTime) {}
+
+    void NullAudioDevice::Close() {
+        m_sampleRate = 0;
+    }
+
+    UInt64 NullAudioDevice::GetFrameCount() const {
+        return m_frameCount;
+    }
+
+    UInt32 NullAudioDevice::GetSampleRate() const {
+        return m_sampleRate;
+    }
+
+    bool NullAudioDevice::IsOpen() const {
+        return m_sampleRate > 0;
+    }
+
+    bool NullAudioDevice::IsRealTime() const {
+        return m_isRealTime;
+    }
+
+    bool NullAudioDevice::Open(const UInt32 sampleRate, std::string* errorMessage) {
+        if (sampleRate == 0) {
+            if (errorMessage) {
+                *errorMessage = "Invalid sample rate.";
+            }
+
+            return false;
+        }
+
+        m_sampleRate = sampleRate;
+        m_frameCount = 0;
+        m_startTime = Clock::now();
+        return true;
+    }
+
+    bool NullAudioDevice::Write(const std::span<const float> samples) {
+        FlAssertMsg(IsOpen(), "[Audio/NullAudioDevice] Device is not open.");
+
+        // Blocks until the frames written before would have been played
+        if (m_isRealTime) {
+            const auto playedTime = std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(static_cast<double>(m_frameCount) / m_sampleRate));
+            std::this_thread::sleep_until(m_startTime + playedTime);
+        }
+
+        m_frameCount += samples.size() / ChannelCount;
+        return true;
+    }
+} // namespace Fl
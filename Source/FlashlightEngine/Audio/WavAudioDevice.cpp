@@ -0,0 +1,128 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Audio/WavAudioDevice.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+#include <FlashlightEngine/Utility/PathUtils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr UInt32 BytesPerSample = 2;
+        constexpr std::size_t HeaderSize = 44;
+
+        void WriteLittleEndian(UInt8* bytes, const UInt32 value, const std::size_t byteCount) {
+            for (std::size_t i = 0; i < byteCount; ++i) {
+                bytes[i] = static_cast<UInt8>(value >> (8 * i));
+            }
+        }
+
+        /**
+         * @brief Builds the header of a 16-bit PCM stereo file, sizes are clamped to the 4 GiB the format allows.
+         */
+        std::array<UInt8, HeaderSize> BuildHeader(const UInt32 sampleRate, const UInt64 frameCount) {
+            const UInt32 frameSize = AudioDevice::ChannelCount * BytesPerSample;
+            const UInt64 maxDataSize = std::numeric_limits<UInt32>::max() - HeaderSize;
+            const auto dataSize = static_cast<UInt32>(std::min(frameCount * frameSize, maxDataSize));
+
+            std::array<UInt8, HeaderSize> header;
+            std::memcpy(&header[0], "RIFF", 4);
+            WriteLittleEndian(&header[4], dataSize + HeaderSize - 8, 4);
+            std::memcpy(&header[8], "WAVEfmt ", 8);
+            WriteLittleEndian(&header[16], 16, 4);
+            WriteLittleEndian(&header[20], 1, 2); //< PCM
+            WriteLittleEndian(&header[22], AudioDevice::ChannelCount, 2);
+            WriteLittleEndian(&header[24], sampleRate, 4);
+            WriteLittleEndian(&header[28], sampleRate * frameSize, 4);
+            WriteLittleEndian(&header[32], frameSize, 2);
+            WriteLittleEndian(&header[34], 8 * BytesPerSample, 2);
+            std::memcpy(&header[36], "data", 4);
+            WriteLittleEndian(&header[40], dataSize, 4);
+
+            return header;
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    WavAudioDevice::WavAudioDevice(const std::string_view filePath) : m_filePath(filePath) {}
+
+    WavAudioDevice::~WavAudioDevice() {
+        Close();
+    }
+
+    void WavAudioDevice::Close() {
+        if (!IsOpen()) {
+            return;
+        }
+
+        const std::array<UInt8, HeaderSize> header = BuildHeader(m_sampleRate, m_frameCount);
+        m_file.seekp(0);
+        m_file.write(reinterpret_cast<const char*>(header.data()), header.size());
+        m_file.close();
+
+        m_sampleRate = 0;
+    }
+
+    UInt64 WavAudioDevice::GetFrameCount() const {
+        return m_frameCount;
+    }
+
+    const std::string& WavAudioDevice::GetFilePath() const {
+        return m_filePath;
+    }
+
+    UInt32 WavAudioDevice::GetSampleRate() const {
+        return m_sampleRate;
+    }
+
+    bool WavAudioDevice::IsOpen() const {
+        return m_sampleRate > 0;
+    }
+
+    bool WavAudioDevice::Open(const UInt32 sampleRate, std::string* errorMessage) {
+        Close();
+
+        const std::filesystem::path path = Utf8Path(m_filePath);
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        if (sampleRate == 0 || !m_file) {
+            if (errorMessage) {
+                *errorMessage = (sampleRate == 0) ? "Invalid sample rate." :
+                                                    "Failed to open " + PathToString(path) + " for writing.";
+            }
+
+            m_file.close();
+            return false;
+        }
+
+        // Sizes are written when closing
+        const std::array<UInt8, HeaderSize> header = BuildHeader(sampleRate, 0);
+        m_file.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+        m_sampleRate = sampleRate;
+        m_frameCount = 0;
+        return true;
+    }
+
+    bool WavAudioDevice::Write(const std::span<const float> samples) {
+        FlAssertMsg(IsOpen(), "[Audio/WavAudioDevice] Device is not open.");
+
+        m_bytes.resize(samples.size() * BytesPerSample);
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            const float sample = std::clamp(samples[i], -1.0f, 1.0f) * 32767.0f;
+            const auto value = static_cast<Int16>(std::lround(sample));
+            WriteLittleEndian(&m_bytes[i * BytesPerSample], static_cast<UInt16>(value), BytesPerSample);
+        }
+
+        m_file.write(reinterpret_cast<const char*>(m_bytes.data()), static_cast<std::streamsize>(m_bytes.size()));
+        m_frameCount += samples.size() / ChannelCount;
+        return static_cast<bool>(m_file);
+    }
+} // namespace Fl
@@ -0,0 +1,76 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/Clock.hpp>
+
+#if defined(FL_PLATFORM_WINDOWS)
+#   include <Windows.h>
+#elif defined(FL_PLATFORM_POSIX)
+#   include <time.h>
+#else
+#   error Current platform has no implementation for Clock
+#endif
+
+namespace Fl {
+#if defined(FL_PLATFORM_WINDOWS)
+    namespace FL_ANONYMOUS_NAMESPACE {
+        Int64 GetPerformanceFrequency() {
+            LARGE_INTEGER frequency;
+            QueryPerformanceFrequency(&frequency);
+
+            return frequency.QuadPart;
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+#endif
+
+    Clock::Clock() :
+        m_startTime(now()) {
+    }
+
+    Clock::duration Clock::GetElapsedTime() const {
+        return now() - m_startTime;
+    }
+
+    Clock::time_point Clock::GetStartTime() const {
+        return m_startTime;
+    }
+
+    Clock::duration Clock::Restart() {
+        const time_point currentTime = now();
+        const duration elapsed = currentTime - m_startTime;
+        m_startTime = currentTime;
+
+        return elapsed;
+    }
+
+    Clock::time_point Clock::now() noexcept {
+#if defined(FL_PLATFORM_WINDOWS)
+        static const Int64 frequency = GetPerformanceFrequency();
+
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+
+        // Split the conversion to avoid overflowing when multiplying by 1e9
+        const Int64 seconds = counter.QuadPart / frequency;
+        const Int64 remainder = counter.QuadPart % frequency;
+
+        return time_point(duration(seconds * 1'000'000'000 + remainder * 1'000'000'000 / frequency));
+#else
+#   if defined(FL_PLATFORM_MACOS)
+        constexpr clockid_t ClockId = CLOCK_UPTIME_RAW;
+#   elif defined(CLOCK_MONOTONIC_RAW)
+        constexpr clockid_t ClockId = CLOCK_MONOTONIC_RAW;
+#   else
+        constexpr clockid_t ClockId = CLOCK_MONOTONIC;
+#   endif
+
+        timespec time;
+        clock_gettime(ClockId, &time);
+
+        return time_point(duration(static_cast<Int64>(time.tv_sec) * 1'000'000'000 + time.tv_nsec));
+#endif
+    }
+} // namespace Fl
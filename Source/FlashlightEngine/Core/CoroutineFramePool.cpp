@@ -0,0 +1,91 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/CoroutineFramePool.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <new>
+
+namespace Fl {
+    CoroutineFramePool::CoroutineFramePool(const std::size_t maxPooledFrameSize,
+                                           const std::size_t maxFreeFramesPerClass) :
+        m_liveFrameCount(0), m_systemAllocationCount(0) {
+        const std::size_t classCount = (maxPooledFrameSize + SizeClassGranularity - 1) / SizeClassGranularity;
+
+        m_freeLists.reserve(classCount);
+        for (std::size_t i = 0; i < classCount; ++i) {
+            m_freeLists.push_back(std::make_unique<MpmcQueue<void*>>(maxFreeFramesPerClass));
+        }
+    }
+
+    CoroutineFramePool::~CoroutineFramePool() {
+        FlAssertMsg(m_liveFrameCount.load() == 0, "[Core/CoroutineFramePool] Pool destroyed while frames are alive.");
+
+        for (std::size_t i = 0; i < m_freeLists.size(); ++i) {
+            void* block;
+            while (m_freeLists[i]->TryPop(block)) {
+                ::operator delete(block, (i + 1) * SizeClassGranularity);
+            }
+        }
+    }
+
+    void* CoroutineFramePool::Allocate(const std::size_t size) {
+        m_liveFrameCount.fetch_add(1, std::memory_order_relaxed);
+
+        const std::size_t sizeClass = GetSizeClass(size);
+        if (sizeClass < m_freeLists.size()) {
+            void* block;
+            if (m_freeLists[sizeClass]->TryPop(block)) {
+                return block;
+            }
+
+            m_systemAllocationCount.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new((sizeClass + 1) * SizeClassGranularity);
+        }
+
+        m_systemAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    void CoroutineFramePool::Deallocate(void* ptr, const std::size_t size) noexcept {
+        m_liveFrameCount.fetch_sub(1, std::memory_order_relaxed);
+
+        const std::size_t sizeClass = GetSizeClass(size);
+        if (sizeClass < m_freeLists.size()) {
+            if (!m_freeLists[sizeClass]->TryPush(ptr)) {
+                ::operator delete(ptr, (sizeClass + 1) * SizeClassGranularity);
+            }
+
+            return;
+        }
+
+        ::operator delete(ptr, size);
+    }
+
+    CoroutineFrameAllocator CoroutineFramePool::GetAllocator() noexcept {
+        CoroutineFrameAllocator allocator;
+        allocator.allocate = [](const std::size_t size, void* userdata) {
+            return static_cast<CoroutineFramePool*>(userdata)->Allocate(size);
+        };
+        allocator.deallocate = [](void* ptr, const std::size_t size, void* userdata) {
+            static_cast<CoroutineFramePool*>(userdata)->Deallocate(ptr, size);
+        };
+        allocator.userdata = this;
+
+        return allocator;
+    }
+
+    std::size_t CoroutineFramePool::GetLiveFrameCount() const noexcept {
+        return m_liveFrameCount.load(std::memory_order_relaxed);
+    }
+
+    std::size_t CoroutineFramePool::GetSystemAllocationCount() const noexcept {
+        return m_systemAllocationCount.load(std::memory_order_relaxed);
+    }
+
+    std::size_t CoroutineFramePool::GetSizeClass(const std::size_t size) const noexcept {
+        return (size + SizeClassGranularity - 1) / SizeClassGranularity - 1;
+    }
+} // namespace Fl
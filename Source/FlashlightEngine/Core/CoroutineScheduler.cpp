@@ -0,0 +1,193 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/CoroutineScheduler.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        bool TimerCompare(const auto& lhs, const auto& rhs) {
+            // std heap functions build a max-heap
+            return lhs.deadline > rhs.deadline;
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    CoroutineScheduler::DelayAwaitable::DelayAwaitable(CoroutineScheduler& scheduler,
+                                                       const Clock::time_point deadline) :
+        m_scheduler(scheduler), m_deadline(deadline) {
+    }
+
+    bool CoroutineScheduler::DelayAwaitable::await_ready() const noexcept {
+        return false;
+    }
+
+    void CoroutineScheduler::DelayAwaitable::await_suspend(std::coroutine_handle<> handle) {
+        FlAssertMsg(m_scheduler.IsMainThread(), "[Core/CoroutineScheduler] Delay must be awaited on the main thread.");
+
+        m_scheduler.m_timers.push_back({m_deadline, handle});
+        std::push_heap(m_scheduler.m_timers.begin(), m_scheduler.m_timers.end(),
+                       &TimerCompare<Timer, Timer>);
+    }
+
+    void CoroutineScheduler::DelayAwaitable::await_resume() const noexcept {
+    }
+
+    CoroutineScheduler::MainThreadAwaitable::MainThreadAwaitable(CoroutineScheduler& scheduler) :
+        m_scheduler(scheduler) {
+    }
+
+    bool CoroutineScheduler::MainThreadAwaitable::await_ready() const noexcept {
+        return m_scheduler.IsMainThread();
+    }
+
+    void CoroutineScheduler::MainThreadAwaitable::await_suspend(std::coroutine_handle<> handle) {
+        m_scheduler.m_mainThreadQueue.Push(handle);
+    }
+
+    void CoroutineScheduler::MainThreadAwaitable::await_resume() const noexcept {
+    }
+
+    CoroutineScheduler::NextFrameAwaitable::NextFrameAwaitable(CoroutineScheduler& scheduler) :
+        m_scheduler(scheduler) {
+    }
+
+    bool CoroutineScheduler::NextFrameAwaitable::await_ready() const noexcept {
+        return false;
+    }
+
+    void CoroutineScheduler::NextFrameAwaitable::await_suspend(std::coroutine_handle<> handle) {
+        if (m_scheduler.IsMainThread()) {
+            m_scheduler.m_nextFrame.push_back(handle);
+        } else {
+            m_scheduler.m_mainThreadQueue.Push(handle);
+        }
+    }
+
+    void CoroutineScheduler::NextFrameAwaitable::await_resume() const noexcept {
+    }
+
+    CoroutineScheduler::ReadFileAwaitable::ReadFileAwaitable(CoroutineScheduler& scheduler,
+                                                             std::filesystem::path path) :
+        m_scheduler(scheduler), m_path(std::move(path)) {
+    }
+
+    bool CoroutineScheduler::ReadFileAwaitable::await_ready() const noexcept {
+        return false;
+    }
+
+    void CoroutineScheduler::ReadFileAwaitable::await_suspend(std::coroutine_handle<> handle) {
+        m_handle = handle;
+        m_scheduler.m_threadPool.Submit(ThreadPool::Job{&ReadJob, this});
+    }
+
+    std::optional<std::vector<UInt8>> CoroutineScheduler::ReadFileAwaitable::await_resume() noexcept {
+        return std::move(m_content);
+    }
+
+    void CoroutineScheduler::ReadFileAwaitable::ReadJob(void* userdata) {
+        auto* awaitable = static_cast<ReadFileAwaitable*>(userdata);
+
+        std::ifstream file(awaitable->m_path, std::ios::binary | std::ios::ate);
+        if (file) {
+            const std::streamsize size = file.tellg();
+            file.seekg(0);
+
+            std::vector<UInt8> content(static_cast<std::size_t>(size));
+            if (file.read(reinterpret_cast<char*>(content.data()), size)) {
+                awaitable->m_content = std::move(content);
+            }
+        }
+
+        awaitable->m_scheduler.m_mainThreadQueue.Push(awaitable->m_handle);
+    }
+
+    CoroutineScheduler::ThreadPoolAwaitable::ThreadPoolAwaitable(CoroutineScheduler& scheduler) :
+        m_scheduler(scheduler) {
+    }
+
+    bool CoroutineScheduler::ThreadPoolAwaitable::await_ready() const noexcept {
+        return false;
+    }
+
+    void CoroutineScheduler::ThreadPoolAwaitable::await_suspend(std::coroutine_handle<> handle) {
+        m_scheduler.m_threadPool.Submit(handle);
+    }
+
+    void CoroutineScheduler::ThreadPoolAwaitable::await_resume() const noexcept {
+    }
+
+    CoroutineScheduler::CoroutineScheduler(ThreadPool& threadPool, const std::size_t mainThreadQueueCapacity) :
+        m_threadPool(threadPool), m_mainThreadQueue(mainThreadQueueCapacity),
+        m_mainThreadId(std::this_thread::get_id()) {
+    }
+
+    CoroutineScheduler::~CoroutineScheduler() = default;
+
+    auto CoroutineScheduler::Delay(const Clock::duration duration) -> DelayAwaitable {
+        return DelayAwaitable(*this, Clock::now() + duration);
+    }
+
+    auto CoroutineScheduler::NextFrame() -> NextFrameAwaitable {
+        return NextFrameAwaitable(*this);
+    }
+
+    auto CoroutineScheduler::ReadFile(std::filesystem::path path) -> ReadFileAwaitable {
+        return ReadFileAwaitable(*this, std::move(path));
+    }
+
+    auto CoroutineScheduler::SwitchToMainThread() -> MainThreadAwaitable {
+        return MainThreadAwaitable(*this);
+    }
+
+    auto CoroutineScheduler::SwitchToThreadPool() -> ThreadPoolAwaitable {
+        return ThreadPoolAwaitable(*this);
+    }
+
+    std::size_t CoroutineScheduler::GetWaitingCount() const {
+        return m_nextFrame.size() + m_timers.size();
+    }
+
+    ThreadPool& CoroutineScheduler::GetThreadPool() {
+        return m_threadPool;
+    }
+
+    bool CoroutineScheduler::IsMainThread() const {
+        return std::this_thread::get_id() == m_mainThreadId;
+    }
+
+    void CoroutineScheduler::Update() {
+        Update(Clock::now());
+    }
+
+    void CoroutineScheduler::Update(const Clock::time_point now) {
+        FlAssertMsg(IsMainThread(), "[Core/CoroutineScheduler] Update must be called from the main thread.");
+
+        // Coroutines awaiting the next frame again while being resumed will go in the fresh list
+        m_resumeList.clear();
+        std::swap(m_resumeList, m_nextFrame);
+
+        while (!m_timers.empty() && m_timers.front().deadline <= now) {
+            std::pop_heap(m_timers.begin(), m_timers.end(), &TimerCompare<Timer, Timer>);
+            m_resumeList.push_back(m_timers.back().handle);
+            m_timers.pop_back();
+        }
+
+        // Only resume the coroutines queued before this update
+        std::size_t mainThreadCount = m_mainThreadQueue.GetSize();
+        std::coroutine_handle<> handle;
+        while (mainThreadCount-- > 0 && m_mainThreadQueue.TryPop(handle)) {
+            m_resumeList.push_back(handle);
+        }
+
+        for (std::coroutine_handle<> coroutine : m_resumeList) {
+            coroutine.resume();
+        }
+    }
+} // namespace Fl
@@ -0,0 +1,194 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/GameLoop.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace Fl {
+    GameLoop::GameLoop() :
+        GameLoop(Settings{}) {
+    }
+
+    GameLoop::GameLoop(const Settings& settings) :
+        m_settings(settings), m_accumulator(Clock::duration::zero()), m_isRunning(false), m_nextFrameTimeIndex(0),
+        m_droppedStepCount(0), m_frameCount(0), m_hitchCount(0), m_alpha(0.f), m_hasPreviousFrame(false) {
+        FlAssertMsg(m_settings.fixedStep > Clock::duration::zero(), "[Core/GameLoop] Fixed step must be positive.");
+        FlAssertMsg(m_settings.maxCatchUpSteps > 0, "[Core/GameLoop] At least one step per frame is required.");
+        FlAssertMsg(m_settings.statisticsWindow > 0, "[Core/GameLoop] Statistics window cannot be empty.");
+
+        if (m_settings.hitchThreshold == Clock::duration::zero()) {
+            const Clock::duration reference = (m_settings.targetFrameTime > Clock::duration::zero())
+                                                  ? m_settings.targetFrameTime
+                                                  : m_settings.fixedStep;
+            m_settings.hitchThreshold = 2 * reference;
+        }
+
+        m_frameTimes.reserve(m_settings.statisticsWindow);
+        m_sortedFrameTimes.reserve(m_settings.statisticsWindow);
+    }
+
+    float GameLoop::GetAlpha() const {
+        return m_alpha;
+    }
+
+    Clock::duration GameLoop::GetFrameTimePercentile(const double percentile) const {
+        if (m_frameTimes.empty()) {
+            return Clock::duration::zero();
+        }
+
+        // Nearest-rank method
+        const std::size_t count = m_frameTimes.size();
+        const auto rank = static_cast<std::size_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * count));
+        const std::size_t index = std::clamp<std::size_t>(rank, 1, count) - 1;
+
+        m_sortedFrameTimes.assign(m_frameTimes.begin(), m_frameTimes.end());
+        std::nth_element(m_sortedFrameTimes.begin(), m_sortedFrameTimes.begin() + index, m_sortedFrameTimes.end());
+
+        return m_sortedFrameTimes[index];
+    }
+
+    GameLoop::FrameStatistics GameLoop::GetStatistics() const {
+        FrameStatistics statistics{};
+        statistics.frameCount = m_frameCount;
+        statistics.hitchCount = m_hitchCount;
+        statistics.droppedStepCount = m_droppedStepCount;
+        statistics.windowFrameCount = m_frameTimes.size();
+
+        if (m_frameTimes.empty()) {
+            return statistics;
+        }
+
+        m_sortedFrameTimes.assign(m_frameTimes.begin(), m_frameTimes.end());
+        std::sort(m_sortedFrameTimes.begin(), m_sortedFrameTimes.end());
+
+        const std::size_t count = m_sortedFrameTimes.size();
+        const auto percentile = [&](const double p) {
+            const auto rank = static_cast<std::size_t>(std::ceil(p / 100.0 * count));
+            return m_sortedFrameTimes[std::clamp<std::size_t>(rank, 1, count) - 1];
+        };
+
+        Clock::duration total = Clock::duration::zero();
+        for (const Clock::duration frameTime : m_sortedFrameTimes) {
+            total += frameTime;
+        }
+
+        statistics.averageFrameTime = total / static_cast<Clock::rep>(count);
+        statistics.minFrameTime = m_sortedFrameTimes.front();
+        statistics.maxFrameTime = m_sortedFrameTimes.back();
+        statistics.medianFrameTime = percentile(50.0);
+        statistics.percentile95FrameTime = percentile(95.0);
+        statistics.percentile99FrameTime = percentile(99.0);
+        statistics.windowHitchCount = static_cast<std::size_t>(
+            m_sortedFrameTimes.end() -
+            std::upper_bound(m_sortedFrameTimes.begin(), m_sortedFrameTimes.end(), m_settings.hitchThreshold));
+
+        return statistics;
+    }
+
+    auto GameLoop::GetSettings() const -> const Settings& {
+        return m_settings;
+    }
+
+    bool GameLoop::IsRunning() const {
+        return m_isRunning.load(std::memory_order_relaxed);
+    }
+
+    void GameLoop::Run(const FixedUpdateCallback& fixedUpdate, const UpdateCallback& update) {
+        m_isRunning.store(true, std::memory_order_relaxed);
+
+        while (m_isRunning.load(std::memory_order_relaxed)) {
+            WaitForNextFrame();
+            Tick(Clock::now(), fixedUpdate, update);
+        }
+    }
+
+    void GameLoop::Stop() {
+        m_isRunning.store(false, std::memory_order_relaxed);
+    }
+
+    UInt32 GameLoop::Tick(const Clock::time_point now, const FixedUpdateCallback& fixedUpdate,
+                          const UpdateCallback& update) {
+        Clock::duration frameTime = Clock::duration::zero();
+        if (m_hasPreviousFrame) {
+            FlAssertMsg(now >= m_previousFrameTime, "[Core/GameLoop] Frame time went backwards.");
+
+            frameTime = now - m_previousFrameTime;
+            RecordFrameTime(frameTime);
+        }
+
+        m_previousFrameTime = now;
+        m_hasPreviousFrame = true;
+
+        m_accumulator += frameTime;
+
+        UInt32 stepCount = 0;
+        while (m_accumulator >= m_settings.fixedStep && stepCount < m_settings.maxCatchUpSteps) {
+            if (fixedUpdate) {
+                fixedUpdate(m_settings.fixedStep);
+            }
+
+            m_accumulator -= m_settings.fixedStep;
+            ++stepCount;
+        }
+
+        // Drop the time we couldn't catch up with, keeping the fraction of step used for interpolation
+        if (m_accumulator >= m_settings.fixedStep) {
+            m_droppedStepCount += static_cast<UInt64>(m_accumulator / m_settings.fixedStep);
+            m_accumulator %= m_settings.fixedStep;
+        }
+
+        m_alpha = static_cast<float>(static_cast<double>(m_accumulator.count()) /
+                                     static_cast<double>(m_settings.fixedStep.count()));
+
+        if (update) {
+            update(frameTime, m_alpha);
+        }
+
+        return stepCount;
+    }
+
+    void GameLoop::WaitForNextFrame() {
+        if (m_settings.targetFrameTime <= Clock::duration::zero()) {
+            return;
+        }
+
+        Clock::time_point now = Clock::now();
+
+        // Deadlines follow each other to avoid accumulating sleep overshoots, unless we're late by more than a frame
+        m_nextFrameDeadline += m_settings.targetFrameTime;
+        if (m_nextFrameDeadline + m_settings.targetFrameTime < now) {
+            m_nextFrameDeadline = now;
+            return;
+        }
+
+        const Clock::duration remaining = m_nextFrameDeadline - now;
+        if (remaining > m_settings.spinThreshold) {
+            std::this_thread::sleep_for(remaining - m_settings.spinThreshold);
+        }
+
+        while (Clock::now() < m_nextFrameDeadline) {
+            std::this_thread::yield();
+        }
+    }
+
+    void GameLoop::RecordFrameTime(const Clock::duration frameTime) {
+        ++m_frameCount;
+        if (frameTime > m_settings.hitchThreshold) {
+            ++m_hitchCount;
+        }
+
+        if (m_frameTimes.size() < m_settings.statisticsWindow) {
+            m_frameTimes.push_back(frameTime);
+            return;
+        }
+
+        m_frameTimes[m_nextFrameTimeIndex] = frameTime;
+        m_nextFrameTimeIndex = (m_nextFrameTimeIndex + 1) % m_settings.statisticsWindow;
+    }
+} // namespace Fl
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/Task.hpp>
+
+#include <atomic>
+#include <new>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        // Stored in front of every frame so it's freed with the allocator it was allocated with
+        struct FrameHeader {
+            void (*deallocate)(void* ptr, std::size_t size, void* userdata);
+            void* userdata;
+        };
+
+        constexpr std::size_t FrameHeaderSize =
+            (sizeof(FrameHeader) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+        void* DefaultAllocate(const std::size_t size, void* /*userdata*/) {
+            return ::operator new(size);
+        }
+
+        void DefaultDeallocate(void* ptr, const std::size_t size, void* /*userdata*/) {
+            ::operator delete(ptr, size);
+        }
+
+        constinit CoroutineFrameAllocator s_defaultAllocator{&DefaultAllocate, &DefaultDeallocate, nullptr};
+        std::atomic<const CoroutineFrameAllocator*> s_currentAllocator{&s_defaultAllocator};
+        CoroutineFrameAllocator s_userAllocator;
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    void SetCoroutineFrameAllocator(const CoroutineFrameAllocator& allocator) {
+        s_userAllocator = allocator;
+        s_currentAllocator.store(&s_userAllocator, std::memory_order_release);
+    }
+
+    void ResetCoroutineFrameAllocator() {
+        s_currentAllocator.store(&s_defaultAllocator, std::memory_order_release);
+    }
+
+    namespace Detail {
+        void* AllocateCoroutineFrame(const std::size_t size) {
+            const CoroutineFrameAllocator* allocator = s_currentAllocator.load(std::memory_order_acquire);
+
+            void* block = allocator->allocate(size + FrameHeaderSize, allocator->userdata);
+            if (!block) {
+                throw std::bad_alloc();
+            }
+
+            ::new (block) FrameHeader{allocator->deallocate, allocator->userdata};
+            return static_cast<std::byte*>(block) + FrameHeaderSize;
+        }
+
+        void DeallocateCoroutineFrame(void* ptr, const std::size_t size) noexcept {
+            void* block = static_cast<std::byte*>(ptr) - FrameHeaderSize;
+            const FrameHeader header = *static_cast<FrameHeader*>(block);
+
+            header.deallocate(block, size + FrameHeaderSize, header.userdata);
+        }
+    } // namespace Detail
+} // namespace Fl
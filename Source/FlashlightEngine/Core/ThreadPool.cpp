@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    ThreadPool::ThreadPool(const std::size_t workerCount, const std::size_t queueCapacity) : m_jobs(queueCapacity) {
+        FlAssertMsg(workerCount > 0, "[Core/ThreadPool] At least one worker is required.");
+
+        m_workers.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; ++i) {
+            m_workers.emplace_back(&ThreadPool::WorkerMain, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        // A job without function tells a worker to stop
+        for (std::size_t i = 0; i < m_workers.size(); ++i) {
+            m_jobs.Push(Job{nullptr, nullptr});
+        }
+
+        for (std::thread& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    std::size_t ThreadPool::GetWorkerCount() const {
+        return m_workers.size();
+    }
+
+    void ThreadPool::Submit(const Job& job) {
+        FlAssert(job.function != nullptr);
+
+        while (!m_jobs.TryPush(job)) {
+            if (!TryExecuteJob()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void ThreadPool::Submit(std::coroutine_handle<> handle) {
+        Submit(Job{[](void* address) { std::coroutine_handle<>::from_address(address).resume(); }, handle.address()});
+    }
+
+    bool ThreadPool::TryExecuteJob() {
+        Job job;
+        if (!m_jobs.TryPop(job)) {
+            return false;
+        }
+
+        if (!job.function) {
+            // Stop request meant for a worker
+            m_jobs.Push(job);
+            return false;
+        }
+
+        job.function(job.userdata);
+        return true;
+    }
+
+    std::size_t ThreadPool::GetDefaultWorkerCount() {
+        const std::size_t hardwareThreads = std::thread::hardware_concurrency();
+        return std::max<std::size_t>(hardwareThreads, 2) - 1;
+    }
+
+    void ThreadPool::WorkerMain() {
+        for (;;) {
+            const Job job = m_jobs.Pop();
+            if (!job.function) {
+                break;
+            }
+
+            job.function(job.userdata);
+        }
+    }
+} // namespace Fl
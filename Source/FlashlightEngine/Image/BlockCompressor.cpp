@@ -0,0 +1,1627 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Image/BlockCompressor.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <optional>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr UInt32 BlockPixelCount = 16;
+        constexpr float InfiniteError = std::numeric_limits<float>::infinity();
+
+        // Interpolation weights of the BC7 indices, out of 64
+        constexpr UInt8 Bc7Weights2[4] = {0, 21, 43, 64};
+        constexpr UInt8 Bc7Weights3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+        constexpr UInt8 Bc7Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        // Subset of every pixel of the two-subset partitions, one bit per pixel
+        constexpr UInt16 Bc7Partitions2[64] = {
+            0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8,
+            0xFF00, 0xFFF0, 0xF000, 0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110,
+            0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C, 0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696,
+            0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660, 0x0272, 0x04E4, 0x4E40, 0x2720,
+            0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22};
+
+        // Subset of every pixel of the three-subset partitions, two bits per pixel
+        constexpr UInt32 Bc7Partitions3[64] = {
+            0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+            0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+            0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+            0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+            0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+            0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+            0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+            0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254};
+
+        // Pixels whose index has an implicit zero most significant bit, besides the first one
+        constexpr UInt8 Bc7Anchors2[64] = {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2,
+            8, 8, 2, 2, 15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6, 6, 2, 6, 8, 15, 15, 2, 2, 15, 15,
+            15, 15, 15, 2, 2, 15};
+
+        constexpr UInt8 Bc7Anchors3Second[64] = {
+            3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3, 3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+            8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15, 3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12,
+            3, 3};
+
+        constexpr UInt8 Bc7Anchors3Third[64] = {
+            15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8, 15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15,
+            15, 10, 8, 15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8, 15, 3, 15, 15, 15, 15, 15, 15, 15, 15,
+            15, 15, 3, 15, 15, 8};
+
+        // Pixel 0 starts the first subset and every anchor belongs to the subset it flags
+        constexpr bool AreBc7AnchorsValid() {
+            for (UInt32 partition = 0; partition < 64; ++partition) {
+                const UInt32 partition2 = Bc7Partitions2[partition];
+                const UInt32 partition3 = Bc7Partitions3[partition];
+                if ((partition2 & 1u) != 0 || ((partition2 >> Bc7Anchors2[partition]) & 1u) != 1 ||
+                    (partition3 & 3u) != 0 || ((partition3 >> (2 * Bc7Anchors3Second[partition])) & 3u) != 1 ||
+                    ((partition3 >> (2 * Bc7Anchors3Third[partition])) & 3u) != 2) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        static_assert(AreBc7AnchorsValid(), "BC7 anchors must belong to their subsets");
+
+        enum class PBitMode {
+            None,
+            PerEndpoint,
+            Shared //< One p-bit for both endpoints of a subset
+        };
+
+        struct Bc7ModeInfo {
+            UInt32 subsetCount;
+            UInt32 partitionBits;
+            UInt32 rotationBits;
+            UInt32 indexSelectionBits;
+            UInt32 colorBits;
+            UInt32 alphaBits;
+            PBitMode pBitMode;
+            UInt32 indexBits;
+            UInt32 secondaryIndexBits; //< Modes with separate alpha indices
+        };
+
+        constexpr Bc7ModeInfo Bc7Modes[8] = {
+            {3, 4, 0, 0, 4, 0, PBitMode::PerEndpoint, 3, 0},
+            {2, 6, 0, 0, 6, 0, PBitMode::Shared, 3, 0},
+            {3, 6, 0, 0, 5, 0, PBitMode::None, 2, 0},
+            {2, 6, 0, 0, 7, 0, PBitMode::PerEndpoint, 2, 0},
+            {1, 0, 2, 1, 5, 6, PBitMode::None, 2, 3},
+            {1, 0, 2, 0, 7, 8, PBitMode::None, 2, 2},
+            {1, 0, 0, 0, 7, 7, PBitMode::PerEndpoint, 4, 0},
+            {2, 6, 0, 0, 5, 5, PBitMode::PerEndpoint, 2, 0}};
+
+        const UInt8* GetBc7Weights(const UInt32 indexBits) {
+            return (indexBits == 2) ? Bc7Weights2 : ((indexBits == 3) ? Bc7Weights3 : Bc7Weights4);
+        }
+
+        constexpr UInt32 GetBc7Subset(const UInt32 subsetCount, const UInt32 partition, const UInt32 pixel) {
+            if (subsetCount == 2) {
+                return (Bc7Partitions2[partition] >> pixel) & 1u;
+            }
+
+            if (subsetCount == 3) {
+                return (Bc7Partitions3[partition] >> (2 * pixel)) & 3u;
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief Subsets of every pixel as floats, the partitions of a pixel being contiguous to be loaded together.
+         */
+        struct Bc7SubsetTable {
+            alignas(16) float subsets[BlockPixelCount][64];
+        };
+
+        constexpr Bc7SubsetTable BuildBc7SubsetTable(const UInt32 subsetCount) {
+            Bc7SubsetTable table = {};
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                for (UInt32 partition = 0; partition < 64; ++partition) {
+                    table.subsets[pixel][partition] = static_cast<float>(GetBc7Subset(subsetCount, partition, pixel));
+                }
+            }
+
+            return table;
+        }
+
+        constexpr Bc7SubsetTable Bc7SubsetTables[2] = {BuildBc7SubsetTable(2), BuildBc7SubsetTable(3)};
+
+        UInt32 GetBc7Anchor(const UInt32 subsetCount, const UInt32 partition, const UInt32 subset) {
+            if (subset == 0) {
+                return 0;
+            }
+
+            if (subsetCount == 2) {
+                return Bc7Anchors2[partition];
+            }
+
+            return (subset == 1) ? Bc7Anchors3Second[partition] : Bc7Anchors3Third[partition];
+        }
+
+        /**
+         * @brief Bits of a 64 or 128-bit block, least significant first.
+         */
+        class BlockBits {
+        public:
+            BlockBits() = default;
+
+            explicit BlockBits(const UInt8* block, const std::size_t byteCount) {
+                for (std::size_t byte = 0; byte < byteCount; ++byte) {
+                    m_words[byte / 8] |= static_cast<UInt64>(block[byte]) << (8 * (byte % 8));
+                }
+            }
+
+            UInt32 Read(const UInt32 bitCount) {
+                UInt32 value = 0;
+                for (UInt32 bit = 0; bit < bitCount; ++bit, ++m_position) {
+                    value |= static_cast<UInt32>((m_words[m_position / 64] >> (m_position % 64)) & 1u) << bit;
+                }
+
+                return value;
+            }
+
+            void Store(UInt8* block, const std::size_t byteCount) const {
+                for (std::size_t byte = 0; byte < byteCount; ++byte) {
+                    block[byte] = static_cast<UInt8>(m_words[byte / 8] >> (8 * (byte % 8)));
+                }
+            }
+
+            void Write(const UInt32 value, const UInt32 bitCount) {
+                for (UInt32 bit = 0; bit < bitCount; ++bit, ++m_position) {
+                    m_words[m_position / 64] |= static_cast<UInt64>((value >> bit) & 1u) << (m_position % 64);
+                }
+            }
+
+        private:
+            UInt64 m_words[2] = {};
+            UInt32 m_position = 0;
+        };
+
+        /**
+         * @brief Pixels of a block as floats, channel by channel.
+         */
+        struct BlockChannels {
+            alignas(16) float values[4][BlockPixelCount];
+            float transparencyError; //< Error of encoding the alpha channel as opaque
+            bool isOpaque;
+        };
+
+        /**
+         * @brief Pixels sharing endpoints, channel by channel and padded to a multiple of SimdFloat4::Width.
+         */
+        struct SubsetPixels {
+            alignas(16) float values[4][BlockPixelCount];
+            alignas(16) float laneWeights[BlockPixelCount]; //< 0 for the padding
+            UInt8 pixels[BlockPixelCount]; //< Index of every pixel in the block
+            UInt32 count;
+        };
+
+        template <typename Predicate>
+        void GatherPixels(const BlockChannels& block, const UInt32* channels, const UInt32 channelCount,
+                          SubsetPixels& subset, Predicate&& isInSubset) {
+            subset.count = 0;
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                if (isInSubset(pixel)) {
+                    subset.pixels[subset.count++] = static_cast<UInt8>(pixel);
+                }
+            }
+
+            const UInt32 paddedCount = (subset.count + SimdFloat4::Width - 1) & ~UInt32(SimdFloat4::Width - 1);
+            for (UInt32 i = 0; i < paddedCount; ++i) {
+                const UInt32 pixel = subset.pixels[(i < subset.count) ? i : 0];
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    subset.values[channel][i] = block.values[channels[channel]][pixel];
+                }
+
+                subset.laneWeights[i] = (i < subset.count) ? 1.f : 0.f;
+            }
+        }
+
+        /**
+         * @brief Selects the nearest palette entry of every pixel, SimdFloat4::Width pixels at once.
+         * @return Sum of the squared errors.
+         */
+        float SelectIndices(const SubsetPixels& subset, const UInt32 channelCount, const float (*palette)[4],
+                            const UInt32 paletteSize, UInt8* indices) {
+            SimdFloat4 totalError = SimdFloat4::Zero();
+            for (UInt32 first = 0; first < subset.count; first += SimdFloat4::Width) {
+                SimdFloat4 values[4];
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    values[channel] = SimdFloat4::LoadAligned(&subset.values[channel][first]);
+                }
+
+                SimdFloat4 bestError = SimdFloat4::Splat(InfiniteError);
+                SimdFloat4 bestIndex = SimdFloat4::Zero();
+                for (UInt32 index = 0; index < paletteSize; ++index) {
+                    SimdFloat4 error = SimdFloat4::Zero();
+                    for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                        const SimdFloat4 difference = values[channel] - SimdFloat4::Splat(palette[index][channel]);
+                        error = SimdFloat4::MultiplyAdd(difference, difference, error);
+                    }
+
+                    const SimdFloat4 isBetter = SimdFloat4::Less(error, bestError);
+                    bestError = SimdFloat4::Select(isBetter, error, bestError);
+                    bestIndex = SimdFloat4::Select(isBetter, SimdFloat4::Splat(static_cast<float>(index)), bestIndex);
+                }
+
+                totalError = SimdFloat4::MultiplyAdd(bestError, SimdFloat4::LoadAligned(&subset.laneWeights[first]),
+                                                     totalError);
+
+                alignas(16) float laneIndices[SimdFloat4::Width];
+                bestIndex.StoreAligned(laneIndices);
+                for (UInt32 lane = 0; lane < SimdFloat4::Width; ++lane) {
+                    indices[first + lane] = static_cast<UInt8>(laneIndices[lane]);
+                }
+            }
+
+            return totalError.HorizontalSum();
+        }
+
+        void FitBoundingBox(const SubsetPixels& subset, const UInt32 channelCount, float (&endpoints)[2][4]) {
+            float minimums[4];
+            float maximums[4];
+            float means[4];
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                const float* values = subset.values[channel];
+                minimums[channel] = *std::min_element(values, values + subset.count);
+                maximums[channel] = *std::max_element(values, values + subset.count);
+                means[channel] = std::accumulate(values, values + subset.count, 0.f) / subset.count;
+            }
+
+            // The diagonal of the box follows the correlation of every channel with the widest one
+            UInt32 widestChannel = 0;
+            for (UInt32 channel = 1; channel < channelCount; ++channel) {
+                if (maximums[channel] - minimums[channel] > maximums[widestChannel] - minimums[widestChannel]) {
+                    widestChannel = channel;
+                }
+            }
+
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                float covariance = 0.f;
+                for (UInt32 i = 0; i < subset.count; ++i) {
+                    covariance += (subset.values[channel][i] - means[channel]) *
+                                  (subset.values[widestChannel][i] - means[widestChannel]);
+                }
+
+                // Pulled in by a sixteenth of the range, extremes being rare
+                const float inset = (maximums[channel] - minimums[channel]) / 16.f;
+                const float low = minimums[channel] + inset;
+                const float high = maximums[channel] - inset;
+                endpoints[0][channel] = (covariance >= 0.f) ? high : low;
+                endpoints[1][channel] = (covariance >= 0.f) ? low : high;
+            }
+        }
+
+        void FitPrincipalAxis(const SubsetPixels& subset, const UInt32 channelCount, float (&endpoints)[2][4]) {
+            float means[4] = {};
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                const float* values = subset.values[channel];
+                means[channel] = std::accumulate(values, values + subset.count, 0.f) / subset.count;
+            }
+
+            float covariance[4][4] = {};
+            for (UInt32 i = 0; i < subset.count; ++i) {
+                for (UInt32 row = 0; row < channelCount; ++row) {
+                    for (UInt32 column = row; column < channelCount; ++column) {
+                        covariance[row][column] +=
+                            (subset.values[row][i] - means[row]) * (subset.values[column][i] - means[column]);
+                    }
+                }
+            }
+
+            // Power iteration from the direction of the largest variance
+            float axis[4] = {};
+            UInt32 widestChannel = 0;
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                for (UInt32 column = 0; column < channel; ++column) {
+                    covariance[channel][column] = covariance[column][channel];
+                }
+
+                widestChannel = (covariance[channel][channel] > covariance[widestChannel][widestChannel])
+                                    ? channel
+                                    : widestChannel;
+            }
+
+            axis[widestChannel] = 1.f;
+            for (int iteration = 0; iteration < 4; ++iteration) {
+                float product[4] = {};
+                float length = 0.f;
+                for (UInt32 row = 0; row < channelCount; ++row) {
+                    for (UInt32 column = 0; column < channelCount; ++column) {
+                        product[row] += covariance[row][column] * axis[column];
+                    }
+
+                    length = std::max(length, std::abs(product[row]));
+                }
+
+                if (length < 1e-6f) {
+                    break;
+                }
+
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    axis[channel] = product[channel] / length;
+                }
+            }
+
+            float axisLengthSquared = 0.f;
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                axisLengthSquared += axis[channel] * axis[channel];
+            }
+
+            float minimum = 0.f;
+            float maximum = 0.f;
+            for (UInt32 i = 0; i < subset.count; ++i) {
+                float projection = 0.f;
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    projection += (subset.values[channel][i] - means[channel]) * axis[channel];
+                }
+
+                minimum = std::min(minimum, projection);
+                maximum = std::max(maximum, projection);
+            }
+
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                const float direction = axis[channel] / axisLengthSquared;
+                endpoints[0][channel] = std::clamp(means[channel] + direction * minimum, 0.f, 255.f);
+                endpoints[1][channel] = std::clamp(means[channel] + direction * maximum, 0.f, 255.f);
+            }
+        }
+
+        /**
+         * @brief Solves the endpoints minimizing the squared error of the selected indices.
+         * @param indexWeights Position of every index between the endpoints, negative for the indices not
+         * interpolating them.
+         * @return Whether the indices constrain both endpoints.
+         */
+        bool FitEndpointsToIndices(const SubsetPixels& subset, const UInt32 channelCount, const UInt8* indices,
+                                   const float* indexWeights, float (&endpoints)[2][4]) {
+            float a = 0.f;
+            float b = 0.f;
+            float c = 0.f;
+            float x[4] = {};
+            float y[4] = {};
+            for (UInt32 i = 0; i < subset.count; ++i) {
+                const float t = indexWeights[indices[i]];
+                if (t < 0.f) {
+                    continue;
+                }
+
+                const float s = 1.f - t;
+                a += s * s;
+                b += s * t;
+                c += t * t;
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    x[channel] += s * subset.values[channel][i];
+                    y[channel] += t * subset.values[channel][i];
+                }
+            }
+
+            const float determinant = a * c - b * b;
+            if (std::abs(determinant) < 1e-4f) {
+                return false;
+            }
+
+            for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                endpoints[0][channel] = std::clamp((c * x[channel] - b * y[channel]) / determinant, 0.f, 255.f);
+                endpoints[1][channel] = std::clamp((a * y[channel] - b * x[channel]) / determinant, 0.f, 255.f);
+            }
+
+            return true;
+        }
+
+        UInt32 ExpandBits(const UInt32 value, const UInt32 bitCount) {
+            return (bitCount >= 8) ? value : (value << (8 - bitCount)) | (value >> (2 * bitCount - 8));
+        }
+
+        // BC1 and BC3 colors
+
+        UInt16 QuantizeRgb565(const float (&color)[4]) {
+            const auto quantize = [](const float value, const float maximum) {
+                return static_cast<UInt32>(std::clamp(std::round(value * maximum / 255.f), 0.f, maximum));
+            };
+
+            return static_cast<UInt16>((quantize(color[0], 31.f) << 11) | (quantize(color[1], 63.f) << 5) |
+                                       quantize(color[2], 31.f));
+        }
+
+        void BuildBc1Palette(const UInt16 color0, const UInt16 color1, const bool isFourColor, Int32 (&palette)[4][3]) {
+            for (UInt32 endpoint = 0; endpoint < 2; ++endpoint) {
+                const UInt32 color = (endpoint == 0) ? color0 : color1;
+                palette[endpoint][0] = static_cast<Int32>(ExpandBits(color >> 11, 5));
+                palette[endpoint][1] = static_cast<Int32>(ExpandBits((color >> 5) & 63u, 6));
+                palette[endpoint][2] = static_cast<Int32>(ExpandBits(color & 31u, 5));
+            }
+
+            for (UInt32 channel = 0; channel < 3; ++channel) {
+                const Int32 first = palette[0][channel];
+                const Int32 second = palette[1][channel];
+                if (isFourColor) {
+                    palette[2][channel] = (2 * first + second + 1) / 3;
+                    palette[3][channel] = (first + 2 * second + 1) / 3;
+                } else {
+                    palette[2][channel] = (first + second + 1) / 2;
+                    palette[3][channel] = 0;
+                }
+            }
+        }
+
+        struct Bc1Encoding {
+            UInt8 indices[BlockPixelCount]; //< In subset order
+            UInt16 colors[2];
+            bool isFourColor;
+            float error = InfiniteError;
+        };
+
+        float EvaluateBc1(const SubsetPixels& subset, const UInt16 color0, const UInt16 color1, const bool isFourColor,
+                          UInt8* indices) {
+            Int32 palette[4][3];
+            BuildBc1Palette(color0, color1, isFourColor, palette);
+
+            float floatPalette[4][4];
+            for (UInt32 index = 0; index < 4; ++index) {
+                for (UInt32 channel = 0; channel < 3; ++channel) {
+                    floatPalette[index][channel] = static_cast<float>(palette[index][channel]);
+                }
+            }
+
+            // The fourth entry of three-color blocks is transparent
+            return SelectIndices(subset, 3, floatPalette, isFourColor ? 4 : 3, indices);
+        }
+
+        void TryBc1Colors(const SubsetPixels& subset, const UInt16 color0, const UInt16 color1, const bool isFourColor,
+                          Bc1Encoding& best) {
+            UInt8 indices[BlockPixelCount];
+            const float error = EvaluateBc1(subset, color0, color1, isFourColor, indices);
+            if (error < best.error) {
+                std::copy_n(indices, BlockPixelCount, best.indices);
+                best.colors[0] = color0;
+                best.colors[1] = color1;
+                best.isFourColor = isFourColor;
+                best.error = error;
+            }
+        }
+
+        void EncodeBc1Mode(const SubsetPixels& subset, const CompressionQuality quality, const bool isFourColor,
+                           Bc1Encoding& best) {
+            constexpr float FourColorWeights[4] = {0.f, 1.f, 1.f / 3.f, 2.f / 3.f};
+            constexpr float ThreeColorWeights[4] = {0.f, 1.f, 0.5f, -1.f};
+
+            float endpoints[2][4];
+            if (quality == CompressionQuality::Fast) {
+                FitBoundingBox(subset, 3, endpoints);
+            } else {
+                FitPrincipalAxis(subset, 3, endpoints);
+            }
+
+            Bc1Encoding encoding;
+            TryBc1Colors(subset, QuantizeRgb565(endpoints[0]), QuantizeRgb565(endpoints[1]), isFourColor, encoding);
+
+            const int refineIterations = (quality == CompressionQuality::Fast)
+                                             ? 0
+                                             : ((quality == CompressionQuality::Normal) ? 2 : 4);
+            for (int iteration = 0; iteration < refineIterations; ++iteration) {
+                const float previousError = encoding.error;
+                if (!FitEndpointsToIndices(subset, 3, encoding.indices,
+                                           isFourColor ? FourColorWeights : ThreeColorWeights, endpoints)) {
+                    break;
+                }
+
+                TryBc1Colors(subset, QuantizeRgb565(endpoints[0]), QuantizeRgb565(endpoints[1]), isFourColor,
+                             encoding);
+                if (encoding.error >= previousError) {
+                    break;
+                }
+            }
+
+            if (quality == CompressionQuality::Exhaustive) {
+                // Local search over the quantized channels of both endpoints
+                constexpr UInt32 Shifts[3] = {11, 5, 0};
+                constexpr UInt32 Masks[3] = {31, 63, 31};
+
+                for (int pass = 0; pass < 16; ++pass) {
+                    const float previousError = encoding.error;
+                    for (UInt32 endpoint = 0; endpoint < 2; ++endpoint) {
+                        for (UInt32 channel = 0; channel < 3; ++channel) {
+                            for (const int delta : {-1, 1}) {
+                                UInt16 colors[2] = {encoding.colors[0], encoding.colors[1]};
+                                const int value = static_cast<int>((colors[endpoint] >> Shifts[channel]) &
+                                                                   Masks[channel]) + delta;
+                                if (value < 0 || value > static_cast<int>(Masks[channel])) {
+                                    continue;
+                                }
+
+                                colors[endpoint] = static_cast<UInt16>(
+                                    (colors[endpoint] & ~(Masks[channel] << Shifts[channel])) |
+                                    (static_cast<UInt32>(value) << Shifts[channel]));
+                                TryBc1Colors(subset, colors[0], colors[1], isFourColor, encoding);
+                            }
+                        }
+                    }
+
+                    if (encoding.error >= previousError) {
+                        break;
+                    }
+                }
+            }
+
+            if (encoding.error < best.error) {
+                best = encoding;
+            }
+        }
+
+        /**
+         * @brief Encodes the colors of a block.
+         * @param allowTransparency Whether pixels with an alpha below 128 become transparent, which BC3 doesn't
+         * support: its color blocks always decode with four colors.
+         */
+        void EncodeBc1(const BlockChannels& block, const CompressionQuality quality, const bool allowTransparency,
+                       UInt8* output) {
+            constexpr UInt32 Channels[3] = {0, 1, 2};
+
+            SubsetPixels subset;
+            GatherPixels(block, Channels, 3, subset, [&](const UInt32 pixel) {
+                return !allowTransparency || block.values[3][pixel] >= 128.f;
+            });
+
+            const bool hasTransparentPixels = (subset.count < BlockPixelCount);
+
+            Bc1Encoding encoding;
+            if (subset.count == 0) {
+                encoding.colors[0] = 0;
+                encoding.colors[1] = 0;
+                encoding.isFourColor = false;
+            } else {
+                if (!hasTransparentPixels) {
+                    EncodeBc1Mode(subset, quality, true, encoding);
+                }
+
+                if (hasTransparentPixels || quality == CompressionQuality::Exhaustive) {
+                    EncodeBc1Mode(subset, quality, false, encoding);
+                }
+            }
+
+            UInt8 indices[BlockPixelCount];
+            std::fill_n(indices, BlockPixelCount, UInt8(3));
+            for (UInt32 i = 0; i < subset.count; ++i) {
+                indices[subset.pixels[i]] = encoding.indices[i];
+            }
+
+            // The order of the endpoints selects the mode, four colors needing the first one to be greater
+            UInt16 color0 = encoding.colors[0];
+            UInt16 color1 = encoding.colors[1];
+            if (encoding.isFourColor && color0 < color1) {
+                std::swap(color0, color1);
+                for (UInt8& index : indices) {
+                    index ^= 1;
+                }
+            } else if (encoding.isFourColor && color0 == color1) {
+                // Equal endpoints decode with three colors, where the last index is transparent
+                std::fill_n(indices, BlockPixelCount, UInt8(0));
+            } else if (!encoding.isFourColor && color0 > color1) {
+                std::swap(color0, color1);
+                for (UInt8& index : indices) {
+                    index = (index < 2) ? (index ^ 1) : index;
+                }
+            }
+
+            BlockBits bits;
+            bits.Write(color0, 16);
+            bits.Write(color1, 16);
+            for (const UInt8 index : indices) {
+                bits.Write(index, 2);
+            }
+
+            bits.Store(output, 8);
+        }
+
+        void DecodeBc1(const UInt8* block, const bool forceFourColor, UInt8* pixels) {
+            BlockBits bits(block, 8);
+            const auto color0 = static_cast<UInt16>(bits.Read(16));
+            const auto color1 = static_cast<UInt16>(bits.Read(16));
+            const bool isFourColor = forceFourColor || color0 > color1;
+
+            Int32 palette[4][3];
+            BuildBc1Palette(color0, color1, isFourColor, palette);
+
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                const UInt32 index = bits.Read(2);
+                for (UInt32 channel = 0; channel < 3; ++channel) {
+                    pixels[pixel * 4 + channel] = static_cast<UInt8>(palette[index][channel]);
+                }
+
+                pixels[pixel * 4 + 3] = (isFourColor || index != 3) ? 255 : 0;
+            }
+        }
+
+        // BC4 channels, also making the alpha of BC3 and both channels of BC5
+
+        void BuildBc4Palette(const UInt32 endpoint0, const UInt32 endpoint1, Int32 (&palette)[8]) {
+            const auto first = static_cast<Int32>(endpoint0);
+            const auto second = static_cast<Int32>(endpoint1);
+            palette[0] = first;
+            palette[1] = second;
+
+            // The order of the endpoints selects between eight interpolated values, and six with 0 and 255
+            if (endpoint0 > endpoint1) {
+                for (Int32 index = 2; index < 8; ++index) {
+                    palette[index] = ((8 - index) * first + (index - 1) * second + 3) / 7;
+                }
+            } else {
+                for (Int32 index = 2; index < 6; ++index) {
+                    palette[index] = ((6 - index) * first + (index - 1) * second + 2) / 5;
+                }
+
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+        }
+
+        struct Bc4Encoding {
+            UInt8 indices[BlockPixelCount];
+            UInt8 endpoints[2];
+            float error = InfiniteError;
+        };
+
+        void TryBc4Endpoints(const SubsetPixels& subset, const int endpoint0, const int endpoint1, Bc4Encoding& best) {
+            if (endpoint0 < 0 || endpoint0 > 255 || endpoint1 < 0 || endpoint1 > 255) {
+                return;
+            }
+
+            Int32 palette[8];
+            BuildBc4Palette(static_cast<UInt32>(endpoint0), static_cast<UInt32>(endpoint1), palette);
+
+            float floatPalette[8][4];
+            for (UInt32 index = 0; index < 8; ++index) {
+                floatPalette[index][0] = static_cast<float>(palette[index]);
+            }
+
+            UInt8 indices[BlockPixelCount];
+            const float error = SelectIndices(subset, 1, floatPalette, 8, indices);
+            if (error < best.error) {
+                std::copy_n(indices, BlockPixelCount, best.indices);
+                best.endpoints[0] = static_cast<UInt8>(endpoint0);
+                best.endpoints[1] = static_cast<UInt8>(endpoint1);
+                best.error = error;
+            }
+        }
+
+        void RefineBc4Endpoints(const SubsetPixels& subset, const bool isEightValue, Bc4Encoding& encoding) {
+            constexpr float EightValueWeights[8] = {0.f, 1.f, 1.f / 7.f, 2.f / 7.f, 3.f / 7.f, 4.f / 7.f, 5.f / 7.f,
+                                                    6.f / 7.f};
+            constexpr float SixValueWeights[8] = {0.f, 1.f, 0.2f, 0.4f, 0.6f, 0.8f, -1.f, -1.f};
+
+            for (int iteration = 0; iteration < 2; ++iteration) {
+                float endpoints[2][4];
+                if (!FitEndpointsToIndices(subset, 1, encoding.indices,
+                                           isEightValue ? EightValueWeights : SixValueWeights, endpoints)) {
+                    return;
+                }
+
+                const int low = static_cast<int>(std::round(std::min(endpoints[0][0], endpoints[1][0])));
+                const int high = static_cast<int>(std::round(std::max(endpoints[0][0], endpoints[1][0])));
+                const float previousError = encoding.error;
+                if (isEightValue) {
+                    TryBc4Endpoints(subset, high, low, encoding);
+                } else {
+                    TryBc4Endpoints(subset, low, high, encoding);
+                }
+
+                if (encoding.error >= previousError) {
+                    return;
+                }
+            }
+        }
+
+        void EncodeBc4(const BlockChannels& block, const UInt32 channel, const CompressionQuality quality,
+                       UInt8* output) {
+            SubsetPixels subset;
+            GatherPixels(block, &channel, 1, subset, [](UInt32) { return true; });
+
+            const float* values = subset.values[0];
+            const auto minimum = static_cast<int>(*std::min_element(values, values + BlockPixelCount));
+            const auto maximum = static_cast<int>(*std::max_element(values, values + BlockPixelCount));
+
+            Bc4Encoding encoding;
+            TryBc4Endpoints(subset, maximum, minimum, encoding);
+
+            if (quality != CompressionQuality::Fast && minimum != maximum) {
+                RefineBc4Endpoints(subset, true, encoding);
+
+                // Six interpolated values between the other pixels, when 0 or 255 are present
+                int innerMinimum = 255;
+                int innerMaximum = 0;
+                for (UInt32 i = 0; i < BlockPixelCount; ++i) {
+                    const auto value = static_cast<int>(values[i]);
+                    if (value != 0 && value != 255) {
+                        innerMinimum = std::min(innerMinimum, value);
+                        innerMaximum = std::max(innerMaximum, value);
+                    }
+                }
+
+                if ((minimum == 0 || maximum == 255) && innerMinimum <= innerMaximum) {
+                    Bc4Encoding sixValues;
+                    TryBc4Endpoints(subset, innerMinimum, innerMaximum, sixValues);
+                    RefineBc4Endpoints(subset, false, sixValues);
+                    if (sixValues.error < encoding.error) {
+                        encoding = sixValues;
+                    }
+                }
+            }
+
+            if (quality == CompressionQuality::Exhaustive && encoding.error > 0.f) {
+                for (int pass = 0; pass < 32; ++pass) {
+                    const float previousError = encoding.error;
+                    const int endpoint0 = encoding.endpoints[0];
+                    const int endpoint1 = encoding.endpoints[1];
+                    for (const int delta : {-2, -1, 1, 2}) {
+                        TryBc4Endpoints(subset, endpoint0 + delta, endpoint1, encoding);
+                        TryBc4Endpoints(subset, endpoint0, endpoint1 + delta, encoding);
+                        TryBc4Endpoints(subset, endpoint0 + delta, endpoint1 + delta, encoding);
+                    }
+
+                    if (encoding.error >= previousError) {
+                        break;
+                    }
+                }
+            }
+
+            BlockBits bits;
+            bits.Write(encoding.endpoints[0], 8);
+            bits.Write(encoding.endpoints[1], 8);
+            for (const UInt8 index : encoding.indices) {
+                bits.Write(index, 3);
+            }
+
+            bits.Store(output, 8);
+        }
+
+        void DecodeBc4(const UInt8* block, const UInt32 channel, UInt8* pixels) {
+            BlockBits bits(block, 8);
+            const UInt32 endpoint0 = bits.Read(8);
+            const UInt32 endpoint1 = bits.Read(8);
+
+            Int32 palette[8];
+            BuildBc4Palette(endpoint0, endpoint1, palette);
+
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                pixels[pixel * 4 + channel] = static_cast<UInt8>(palette[bits.Read(3)]);
+            }
+        }
+
+        // BC7
+
+        struct Bc7SubsetFormat {
+            UInt32 channelCount;
+            UInt32 channelBits[4];
+            PBitMode pBitMode;
+            UInt32 indexBits;
+        };
+
+        struct Bc7SubsetEncoding {
+            UInt8 indices[BlockPixelCount]; //< In subset order
+            UInt8 endpoints[2][4]; //< Quantized, without p-bits
+            UInt8 pBits[2];
+            float error = InfiniteError;
+        };
+
+        struct Bc7Effort {
+            UInt32 refineIterations;
+            bool tryAllPBits;
+            bool useLocalSearch;
+        };
+
+        float EvaluateBc7Subset(const SubsetPixels& subset, const Bc7SubsetFormat& format,
+                                const UInt8 (&endpoints)[2][4], const UInt8 (&pBits)[2], UInt8* indices) {
+            Int32 expanded[2][4];
+            for (UInt32 endpoint = 0; endpoint < 2; ++endpoint) {
+                for (UInt32 channel = 0; channel < format.channelCount; ++channel) {
+                    const UInt32 bitCount = format.channelBits[channel];
+                    expanded[endpoint][channel] = static_cast<Int32>(
+                        (format.pBitMode == PBitMode::None)
+                            ? ExpandBits(endpoints[endpoint][channel], bitCount)
+                            : ExpandBits((endpoints[endpoint][channel] << 1) | pBits[endpoint], bitCount + 1));
+                }
+            }
+
+            const UInt8* weights = GetBc7Weights(format.indexBits);
+            const UInt32 paletteSize = 1u << format.indexBits;
+
+            float palette[16][4];
+            for (UInt32 index = 0; index < paletteSize; ++index) {
+                for (UInt32 channel = 0; channel < format.channelCount; ++channel) {
+                    palette[index][channel] = static_cast<float>(
+                        ((64 - weights[index]) * expanded[0][channel] + weights[index] * expanded[1][channel] + 32) >>
+                        6);
+                }
+            }
+
+            return SelectIndices(subset, format.channelCount, palette, paletteSize, indices);
+        }
+
+        void TryBc7Subset(const SubsetPixels& subset, const Bc7SubsetFormat& format, const UInt8 (&endpoints)[2][4],
+                          const UInt8 (&pBits)[2], Bc7SubsetEncoding& best) {
+            UInt8 indices[BlockPixelCount];
+            const float error = EvaluateBc7Subset(subset, format, endpoints, pBits, indices);
+            if (error < best.error) {
+                std::copy_n(indices, BlockPixelCount, best.indices);
+                std::copy_n(&endpoints[0][0], 8, &best.endpoints[0][0]);
+                best.pBits[0] = pBits[0];
+                best.pBits[1] = pBits[1];
+                best.error = error;
+            }
+        }
+
+        /**
+         * @brief Quantizes unquantized endpoints and evaluates them.
+         * @param tryAllPBits Whether every p-bit combination is evaluated, instead of the p-bits best approximating the
+         * endpoints.
+         */
+        void TryBc7Endpoints(const SubsetPixels& subset, const Bc7SubsetFormat& format, const float (&endpoints)[2][4],
+                             const bool tryAllPBits, Bc7SubsetEncoding& best) {
+            // Endpoints quantized with either p-bit, and the squared error of their expansion
+            UInt8 quantized[2][2][4] = {};
+            float quantizationErrors[2][2] = {};
+            const UInt32 pBitCount = (format.pBitMode == PBitMode::None) ? 1 : 2;
+            for (UInt32 pBit = 0; pBit < pBitCount; ++pBit) {
+                for (UInt32 endpoint = 0; endpoint < 2; ++endpoint) {
+                    for (UInt32 channel = 0; channel < format.channelCount; ++channel) {
+                        const UInt32 bitCount = format.channelBits[channel];
+                        const auto maximum = static_cast<float>((1u << bitCount) - 1);
+                        const float value = endpoints[endpoint][channel];
+
+                        // With a p-bit, the stored value is the upper bits of a value one bit longer
+                        const float scaled = (format.pBitMode == PBitMode::None)
+                                                 ? value * maximum / 255.f
+                                                 : (value * (2.f * maximum + 1.f) / 255.f - pBit) * 0.5f;
+                        const auto code = static_cast<UInt32>(std::clamp(std::round(scaled), 0.f, maximum));
+                        const float error = value - static_cast<float>(
+                                                        (format.pBitMode == PBitMode::None)
+                                                            ? ExpandBits(code, bitCount)
+                                                            : ExpandBits((code << 1) | pBit, bitCount + 1));
+
+                        quantized[pBit][endpoint][channel] = static_cast<UInt8>(code);
+                        quantizationErrors[pBit][endpoint] += error * error;
+                    }
+                }
+            }
+
+            const auto tryPBits = [&](const UInt32 pBit0, const UInt32 pBit1) {
+                UInt8 candidate[2][4];
+                std::copy_n(quantized[pBit0][0], 4, candidate[0]);
+                std::copy_n(quantized[pBit1][1], 4, candidate[1]);
+
+                const UInt8 pBits[2] = {static_cast<UInt8>(pBit0), static_cast<UInt8>(pBit1)};
+                TryBc7Subset(subset, format, candidate, pBits, best);
+            };
+
+            if (format.pBitMode == PBitMode::None) {
+                tryPBits(0, 0);
+            } else if (format.pBitMode == PBitMode::Shared) {
+                const bool isOneBetter = quantizationErrors[1][0] + quantizationErrors[1][1] <
+                                         quantizationErrors[0][0] + quantizationErrors[0][1];
+                for (UInt32 pBit = 0; pBit < 2; ++pBit) {
+                    if (tryAllPBits || (pBit == 1) == isOneBetter) {
+                        tryPBits(pBit, pBit);
+                    }
+                }
+            } else if (tryAllPBits) {
+                for (UInt32 combination = 0; combination < 4; ++combination) {
+                    tryPBits(combination & 1u, combination >> 1);
+                }
+            } else {
+                tryPBits((quantizationErrors[1][0] < quantizationErrors[0][0]) ? 1 : 0,
+                         (quantizationErrors[1][1] < quantizationErrors[0][1]) ? 1 : 0);
+            }
+        }
+
+        void EncodeBc7Subset(const SubsetPixels& subset, const Bc7SubsetFormat& format, const Bc7Effort& effort,
+                             Bc7SubsetEncoding& encoding) {
+            float indexWeights[16];
+            const UInt8* weights = GetBc7Weights(format.indexBits);
+            for (UInt32 index = 0; index < (1u << format.indexBits); ++index) {
+                indexWeights[index] = weights[index] / 64.f;
+            }
+
+            float endpoints[2][4];
+            FitPrincipalAxis(subset, format.channelCount, endpoints);
+            TryBc7Endpoints(subset, format, endpoints, effort.tryAllPBits, encoding);
+
+            for (UInt32 iteration = 0; iteration < effort.refineIterations && encoding.error > 0.f; ++iteration) {
+                const float previousError = encoding.error;
+                if (!FitEndpointsToIndices(subset, format.channelCount, encoding.indices, indexWeights, endpoints)) {
+                    break;
+                }
+
+                TryBc7Endpoints(subset, format, endpoints, effort.tryAllPBits, encoding);
+                if (encoding.error >= previousError) {
+                    break;
+                }
+            }
+
+            if (!effort.useLocalSearch) {
+                return;
+            }
+
+            // Moves every quantized channel and p-bit by one step while it reduces the error
+            for (int pass = 0; pass < 16 && encoding.error > 0.f; ++pass) {
+                const float previousError = encoding.error;
+                for (UInt32 endpoint = 0; endpoint < 2; ++endpoint) {
+                    for (UInt32 channel = 0; channel < format.channelCount; ++channel) {
+                        const int maximum = static_cast<int>((1u << format.channelBits[channel]) - 1);
+                        for (const int delta : {-1, 1}) {
+                            const int value = encoding.endpoints[endpoint][channel] + delta;
+                            if (value < 0 || value > maximum) {
+                                continue;
+                            }
+
+                            UInt8 candidate[2][4];
+                            std::copy_n(&encoding.endpoints[0][0], 8, &candidate[0][0]);
+                            candidate[endpoint][channel] = static_cast<UInt8>(value);
+
+                            const UInt8 pBits[2] = {encoding.pBits[0], encoding.pBits[1]};
+                            TryBc7Subset(subset, format, candidate, pBits, encoding);
+                        }
+                    }
+
+                    if (format.pBitMode == PBitMode::PerEndpoint) {
+                        UInt8 pBits[2] = {encoding.pBits[0], encoding.pBits[1]};
+                        pBits[endpoint] ^= 1;
+                        TryBc7Subset(subset, format, encoding.endpoints, pBits, encoding);
+                    }
+                }
+
+                if (format.pBitMode == PBitMode::Shared) {
+                    const UInt8 pBits[2] = {UInt8(encoding.pBits[0] ^ 1), UInt8(encoding.pBits[1] ^ 1)};
+                    TryBc7Subset(subset, format, encoding.endpoints, pBits, encoding);
+                }
+
+                if (encoding.error >= previousError) {
+                    break;
+                }
+            }
+        }
+
+        struct Bc7Encoding {
+            UInt8 endpoints[3][2][4]; //< Quantized, in the channel order after rotation
+            UInt8 pBits[3][2];
+            UInt8 indices[BlockPixelCount];
+            UInt8 alphaIndices[BlockPixelCount]; //< Modes 4 and 5
+            UInt32 mode;
+            UInt32 partition;
+            UInt32 rotation;
+            UInt32 indexSelection;
+            float error = InfiniteError;
+        };
+
+        void EncodeBc7Mode(const BlockChannels& block, const UInt32 mode, const UInt32 partition, const UInt32 rotation,
+                           const UInt32 indexSelection, const Bc7Effort& effort, Bc7Encoding& best) {
+            const Bc7ModeInfo& info = Bc7Modes[mode];
+            const bool hasSeparateAlpha = (info.secondaryIndexBits > 0);
+
+            // Rotations swap the alpha channel with a color one, which then gets its own indices
+            UInt32 channels[4] = {0, 1, 2, 3};
+            if (rotation > 0) {
+                std::swap(channels[rotation - 1], channels[3]);
+            }
+
+            Bc7Encoding encoding;
+            encoding.mode = mode;
+            encoding.partition = partition;
+            encoding.rotation = rotation;
+            encoding.indexSelection = indexSelection;
+            encoding.error = (info.alphaBits == 0) ? block.transparencyError : 0.f;
+
+            Bc7SubsetFormat colorFormat;
+            colorFormat.channelCount = (info.alphaBits > 0 && !hasSeparateAlpha) ? 4 : 3;
+            colorFormat.channelBits[0] = info.colorBits;
+            colorFormat.channelBits[1] = info.colorBits;
+            colorFormat.channelBits[2] = info.colorBits;
+            colorFormat.channelBits[3] = info.alphaBits;
+            colorFormat.pBitMode = info.pBitMode;
+            colorFormat.indexBits = (indexSelection != 0) ? info.secondaryIndexBits : info.indexBits;
+
+            for (UInt32 subsetIndex = 0; subsetIndex < info.subsetCount; ++subsetIndex) {
+                SubsetPixels subset;
+                GatherPixels(block, channels, colorFormat.channelCount, subset, [&](const UInt32 pixel) {
+                    return GetBc7Subset(info.subsetCount, partition, pixel) == subsetIndex;
+                });
+
+                Bc7SubsetEncoding subsetEncoding;
+                EncodeBc7Subset(subset, colorFormat, effort, subsetEncoding);
+
+                encoding.error += subsetEncoding.error;
+                if (encoding.error >= best.error) {
+                    return;
+                }
+
+                std::copy_n(&subsetEncoding.endpoints[0][0], 8, &encoding.endpoints[subsetIndex][0][0]);
+                encoding.pBits[subsetIndex][0] = subsetEncoding.pBits[0];
+                encoding.pBits[subsetIndex][1] = subsetEncoding.pBits[1];
+                for (UInt32 i = 0; i < subset.count; ++i) {
+                    encoding.indices[subset.pixels[i]] = subsetEncoding.indices[i];
+                }
+            }
+
+            if (hasSeparateAlpha) {
+                Bc7SubsetFormat alphaFormat = {};
+                alphaFormat.channelCount = 1;
+                alphaFormat.channelBits[0] = info.alphaBits;
+                alphaFormat.pBitMode = PBitMode::None;
+                alphaFormat.indexBits = (indexSelection != 0) ? info.indexBits : info.secondaryIndexBits;
+
+                SubsetPixels subset;
+                GatherPixels(block, &channels[3], 1, subset, [](UInt32) { return true; });
+
+                Bc7SubsetEncoding alphaEncoding;
+                EncodeBc7Subset(subset, alphaFormat, effort, alphaEncoding);
+
+                encoding.error += alphaEncoding.error;
+                if (encoding.error >= best.error) {
+                    return;
+                }
+
+                encoding.endpoints[0][0][3] = alphaEncoding.endpoints[0][0];
+                encoding.endpoints[0][1][3] = alphaEncoding.endpoints[1][0];
+                std::copy_n(alphaEncoding.indices, BlockPixelCount, encoding.alphaIndices);
+            }
+
+            best = encoding;
+        }
+
+        void WriteBc7(Bc7Encoding encoding, UInt8* output) {
+            const Bc7ModeInfo& info = Bc7Modes[encoding.mode];
+            const bool hasSeparateAlpha = (info.secondaryIndexBits > 0);
+            const UInt32 colorIndexBits = (encoding.indexSelection != 0) ? info.secondaryIndexBits : info.indexBits;
+            const UInt32 alphaIndexBits = (encoding.indexSelection != 0) ? info.indexBits : info.secondaryIndexBits;
+
+            // Anchor indices are stored without their most significant bit, which must be zero: subsets whose anchor
+            // has it set swap their endpoints and invert their indices
+            for (UInt32 subset = 0; subset < info.subsetCount; ++subset) {
+                const UInt32 maximumIndex = (1u << colorIndexBits) - 1;
+                if (encoding.indices[GetBc7Anchor(info.subsetCount, encoding.partition, subset)] <= maximumIndex / 2) {
+                    continue;
+                }
+
+                const UInt32 channelCount = (info.alphaBits > 0 && !hasSeparateAlpha) ? 4 : 3;
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    std::swap(encoding.endpoints[subset][0][channel], encoding.endpoints[subset][1][channel]);
+                }
+
+                std::swap(encoding.pBits[subset][0], encoding.pBits[subset][1]);
+                for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                    if (GetBc7Subset(info.subsetCount, encoding.partition, pixel) == subset) {
+                        encoding.indices[pixel] = static_cast<UInt8>(maximumIndex - encoding.indices[pixel]);
+                    }
+                }
+            }
+
+            if (hasSeparateAlpha && encoding.alphaIndices[0] > ((1u << alphaIndexBits) - 1) / 2) {
+                std::swap(encoding.endpoints[0][0][3], encoding.endpoints[0][1][3]);
+                for (UInt8& index : encoding.alphaIndices) {
+                    index = static_cast<UInt8>((1u << alphaIndexBits) - 1 - index);
+                }
+            }
+
+            BlockBits bits;
+            bits.Write(1u << encoding.mode, encoding.mode + 1);
+            bits.Write(encoding.partition, info.partitionBits);
+            bits.Write(encoding.rotation, info.rotationBits);
+            bits.Write(encoding.indexSelection, info.indexSelectionBits);
+
+            for (UInt32 channel = 0; channel < 4; ++channel) {
+                const UInt32 bitCount = (channel < 3) ? info.colorBits : info.alphaBits;
+                for (UInt32 subset = 0; subset < info.subsetCount; ++subset) {
+                    bits.Write(encoding.endpoints[subset][0][channel], bitCount);
+                    bits.Write(encoding.endpoints[subset][1][channel], bitCount);
+                }
+            }
+
+            for (UInt32 subset = 0; subset < info.subsetCount; ++subset) {
+                if (info.pBitMode == PBitMode::PerEndpoint) {
+                    bits.Write(encoding.pBits[subset][0], 1);
+                    bits.Write(encoding.pBits[subset][1], 1);
+                } else if (info.pBitMode == PBitMode::Shared) {
+                    bits.Write(encoding.pBits[subset][0], 1);
+                }
+            }
+
+            // Mode 4 stores the indices of the channels selected by the index selection bit in the first field
+            const UInt8* primaryIndices = (encoding.indexSelection != 0) ? encoding.alphaIndices : encoding.indices;
+            const UInt8* secondaryIndices = (encoding.indexSelection != 0) ? encoding.indices : encoding.alphaIndices;
+
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                bool isAnchor = (pixel == 0);
+                for (UInt32 subset = 1; subset < info.subsetCount; ++subset) {
+                    isAnchor = isAnchor || (pixel == GetBc7Anchor(info.subsetCount, encoding.partition, subset));
+                }
+
+                bits.Write(primaryIndices[pixel], info.indexBits - (isAnchor ? 1 : 0));
+            }
+
+            if (hasSeparateAlpha) {
+                for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                    bits.Write(secondaryIndices[pixel], info.secondaryIndexBits - ((pixel == 0) ? 1 : 0));
+                }
+            }
+
+            bits.Store(output, 16);
+        }
+
+        /**
+         * @brief Estimates the squared error of fitting sets of pixels with lines, one set per lane, from their spread
+         * around their principal axis.
+         * @param sums Sums of the channels over the pixels.
+         * @param products Sums of the channel products over the pixels, upper triangle row by row.
+         */
+        SimdFloat4 EstimateLineErrors(const SimdFloat4* sums, const SimdFloat4* products, const SimdFloat4& count,
+                                      const UInt32 channelCount) {
+            const SimdFloat4 one = SimdFloat4::Splat(1.f);
+            const SimdFloat4 inverseCount = one / SimdFloat4::Max(count, one);
+
+            SimdFloat4 covariance[4][4];
+            SimdFloat4 trace = SimdFloat4::Zero();
+            for (UInt32 row = 0, product = 0; row < channelCount; ++row) {
+                for (UInt32 column = row; column < channelCount; ++column, ++product) {
+                    covariance[row][column] = products[product] - sums[row] * sums[column] * inverseCount;
+                    covariance[column][row] = covariance[row][column];
+                }
+
+                trace += covariance[row][row];
+            }
+
+            // Largest eigenvalue by power iteration, the rest of the variance being off the axis
+            const SimdFloat4 epsilon = SimdFloat4::Splat(1e-12f);
+            SimdFloat4 axis[4] = {one, one, one, one};
+            SimdFloat4 eigenvalue = SimdFloat4::Zero();
+            for (int iteration = 0; iteration < 3; ++iteration) {
+                SimdFloat4 product[4];
+                SimdFloat4 lengthSquared = SimdFloat4::Zero();
+                SimdFloat4 axisLengthSquared = SimdFloat4::Zero();
+                for (UInt32 row = 0; row < channelCount; ++row) {
+                    product[row] = SimdFloat4::Zero();
+                    for (UInt32 column = 0; column < channelCount; ++column) {
+                        product[row] = SimdFloat4::MultiplyAdd(covariance[row][column], axis[column], product[row]);
+                    }
+
+                    lengthSquared = SimdFloat4::MultiplyAdd(product[row], product[row], lengthSquared);
+                    axisLengthSquared = SimdFloat4::MultiplyAdd(axis[row], axis[row], axisLengthSquared);
+                }
+
+                eigenvalue = SimdFloat4::Sqrt(lengthSquared / SimdFloat4::Max(axisLengthSquared, epsilon));
+
+                const SimdFloat4 inverseLength = one / SimdFloat4::Sqrt(SimdFloat4::Max(lengthSquared, epsilon));
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    axis[channel] = product[channel] * inverseLength;
+                }
+            }
+
+            return SimdFloat4::Max(trace - eigenvalue, SimdFloat4::Zero());
+        }
+
+        /**
+         * @brief Sorts the partitions by the estimated error of their subsets, SimdFloat4::Width partitions at once.
+         * @return Number of partitions written.
+         */
+        UInt32 FindBestBc7Partitions(const BlockChannels& block, const UInt32 channelCount, const UInt32 subsetCount,
+                                     const UInt32 partitionCount, const UInt32 maxCount, UInt32* partitions) {
+            const UInt32 productCount = channelCount * (channelCount + 1) / 2;
+
+            float pixelProducts[BlockPixelCount][10];
+            float blockSums[4] = {};
+            float blockProducts[10] = {};
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                for (UInt32 row = 0, product = 0; row < channelCount; ++row) {
+                    blockSums[row] += block.values[row][pixel];
+                    for (UInt32 column = row; column < channelCount; ++column, ++product) {
+                        pixelProducts[pixel][product] = block.values[row][pixel] * block.values[column][pixel];
+                        blockProducts[product] += pixelProducts[pixel][product];
+                    }
+                }
+            }
+
+            std::array<std::pair<float, UInt32>, 64> estimates;
+            for (UInt32 first = 0; first < partitionCount; first += SimdFloat4::Width) {
+                SimdFloat4 sums[3][4];
+                SimdFloat4 products[3][10];
+                SimdFloat4 counts[3];
+                for (UInt32 subset = 1; subset < subsetCount; ++subset) {
+                    std::fill_n(sums[subset], channelCount, SimdFloat4::Zero());
+                    std::fill_n(products[subset], productCount, SimdFloat4::Zero());
+                    counts[subset] = SimdFloat4::Zero();
+                }
+
+                const Bc7SubsetTable& table = Bc7SubsetTables[subsetCount - 2];
+                for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                    const SimdFloat4 pixelSubsets = SimdFloat4::LoadAligned(&table.subsets[pixel][first]);
+                    for (UInt32 subset = 1; subset < subsetCount; ++subset) {
+                        const SimdFloat4 mask =
+                            SimdFloat4::Equal(pixelSubsets, SimdFloat4::Splat(static_cast<float>(subset))) &
+                            SimdFloat4::Splat(1.f);
+                        counts[subset] += mask;
+                        for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                            sums[subset][channel] = SimdFloat4::MultiplyAdd(
+                                SimdFloat4::Splat(block.values[channel][pixel]), mask, sums[subset][channel]);
+                        }
+
+                        for (UInt32 product = 0; product < productCount; ++product) {
+                            products[subset][product] = SimdFloat4::MultiplyAdd(
+                                SimdFloat4::Splat(pixelProducts[pixel][product]), mask, products[subset][product]);
+                        }
+                    }
+                }
+
+                // The first subset gets the pixels the others leave
+                counts[0] = SimdFloat4::Splat(static_cast<float>(BlockPixelCount));
+                for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                    sums[0][channel] = SimdFloat4::Splat(blockSums[channel]);
+                }
+
+                for (UInt32 product = 0; product < productCount; ++product) {
+                    products[0][product] = SimdFloat4::Splat(blockProducts[product]);
+                }
+
+                SimdFloat4 errors = SimdFloat4::Zero();
+                for (UInt32 subset = 1; subset < subsetCount; ++subset) {
+                    counts[0] -= counts[subset];
+                    for (UInt32 channel = 0; channel < channelCount; ++channel) {
+                        sums[0][channel] -= sums[subset][channel];
+                    }
+
+                    for (UInt32 product = 0; product < productCount; ++product) {
+                        products[0][product] -= products[subset][product];
+                    }
+
+                    errors += EstimateLineErrors(sums[subset], products[subset], counts[subset], channelCount);
+                }
+
+                errors += EstimateLineErrors(sums[0], products[0], counts[0], channelCount);
+                for (UInt32 lane = 0; lane < SimdFloat4::Width; ++lane) {
+                    estimates[first + lane] = {errors.GetLane(lane), first + lane};
+                }
+            }
+
+            const UInt32 count = std::min(maxCount, partitionCount);
+            std::partial_sort(estimates.begin(), estimates.begin() + count, estimates.begin() + partitionCount);
+            for (UInt32 i = 0; i < count; ++i) {
+                partitions[i] = estimates[i].second;
+            }
+
+            return count;
+        }
+
+        void EncodeBc7(const BlockChannels& block, const CompressionQuality quality, UInt8* output) {
+            Bc7Encoding best;
+
+            if (quality == CompressionQuality::Fast) {
+                EncodeBc7Mode(block, 6, 0, 0, 0, {1, false, false}, best);
+            } else if (quality == CompressionQuality::Normal) {
+                const Bc7Effort effort = {2, false, false};
+                EncodeBc7Mode(block, 6, 0, 0, 0, effort, best);
+
+                UInt32 partitions[2];
+                if (block.isOpaque) {
+                    const UInt32 count = FindBestBc7Partitions(block, 3, 2, 64, 2, partitions);
+                    for (UInt32 i = 0; i < count; ++i) {
+                        EncodeBc7Mode(block, 1, partitions[i], 0, 0, effort, best);
+                        EncodeBc7Mode(block, 3, partitions[i], 0, 0, effort, best);
+                    }
+
+                    FindBestBc7Partitions(block, 3, 3, 64, 1, partitions);
+                    EncodeBc7Mode(block, 2, partitions[0], 0, 0, effort, best);
+                } else {
+                    EncodeBc7Mode(block, 5, 0, 0, 0, effort, best);
+                    EncodeBc7Mode(block, 4, 0, 0, 0, effort, best);
+
+                    const UInt32 count = FindBestBc7Partitions(block, 4, 2, 64, 2, partitions);
+                    for (UInt32 i = 0; i < count; ++i) {
+                        EncodeBc7Mode(block, 7, partitions[i], 0, 0, effort, best);
+                    }
+                }
+            } else {
+                const Bc7Effort effort = {4, true, false};
+                for (UInt32 mode = 0; mode < 8; ++mode) {
+                    const Bc7ModeInfo& info = Bc7Modes[mode];
+                    for (UInt32 partition = 0; partition < (1u << info.partitionBits); ++partition) {
+                        for (UInt32 rotation = 0; rotation < (1u << info.rotationBits); ++rotation) {
+                            for (UInt32 selection = 0; selection < (1u << info.indexSelectionBits); ++selection) {
+                                EncodeBc7Mode(block, mode, partition, rotation, selection, effort, best);
+                            }
+                        }
+                    }
+                }
+
+                // Local search is too slow for every candidate, it refines the best one
+                const Bc7Encoding candidate = best;
+                EncodeBc7Mode(block, candidate.mode, candidate.partition, candidate.rotation, candidate.indexSelection,
+                              {4, true, true}, best);
+            }
+
+            WriteBc7(best, output);
+        }
+
+        void DecodeBc7(const UInt8* block, UInt8* pixels) {
+            BlockBits bits(block, 16);
+
+            UInt32 mode = 0;
+            while (mode < 8 && bits.Read(1) == 0) {
+                ++mode;
+            }
+
+            // Reserved mode
+            if (mode == 8) {
+                std::fill_n(pixels, BlockPixelCount * 4, UInt8(0));
+                return;
+            }
+
+            const Bc7ModeInfo& info = Bc7Modes[mode];
+            const UInt32 partition = bits.Read(info.partitionBits);
+            const UInt32 rotation = bits.Read(info.rotationBits);
+            const UInt32 indexSelection = bits.Read(info.indexSelectionBits);
+
+            UInt32 endpoints[3][2][4];
+            for (UInt32 channel = 0; channel < 4; ++channel) {
+                const UInt32 bitCount = (channel < 3) ? info.colorBits : info.alphaBits;
+                for (UInt32 subset = 0; subset < info.subsetCount; ++subset) {
+                    endpoints[subset][0][channel] = bits.Read(bitCount);
+                    endpoints[subset][1][channel] = bits.Read(bitCount);
+                }
+            }
+
+            for (UInt32 subset = 0; subset < info.subsetCount; ++subset) {
+                UInt32 pBits[2] = {0, 0};
+                if (info.pBitMode == PBitMode::PerEndpoint) {
+                    pBits[0] = bits.Read(1);
+                    pBits[1] = bits.Read(1);
+                } else if (info.pBitMode == PBitMode::Shared) {
+                    pBits[0] = pBits[1] = bits.Read(1);
+                }
+
+                for (UInt32 endpoint = 0; endpoint < 2; ++endpoint) {
+                    for (UInt32 channel = 0; channel < 4; ++channel) {
+                        UInt32& value = endpoints[subset][endpoint][channel];
+                        const UInt32 bitCount = (channel < 3) ? info.colorBits : info.alphaBits;
+                        if (bitCount == 0) {
+                            value = 255;
+                        } else if (info.pBitMode != PBitMode::None) {
+                            value = ExpandBits((value << 1) | pBits[endpoint], bitCount + 1);
+                        } else {
+                            value = ExpandBits(value, bitCount);
+                        }
+                    }
+                }
+            }
+
+            UInt32 primaryIndices[BlockPixelCount];
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                bool isAnchor = (pixel == 0);
+                for (UInt32 subset = 1; subset < info.subsetCount; ++subset) {
+                    isAnchor = isAnchor || (pixel == GetBc7Anchor(info.subsetCount, partition, subset));
+                }
+
+                primaryIndices[pixel] = bits.Read(info.indexBits - (isAnchor ? 1 : 0));
+            }
+
+            UInt32 secondaryIndices[BlockPixelCount] = {};
+            if (info.secondaryIndexBits > 0) {
+                for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                    secondaryIndices[pixel] = bits.Read(info.secondaryIndexBits - ((pixel == 0) ? 1 : 0));
+                }
+            }
+
+            for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                const UInt32 subset = GetBc7Subset(info.subsetCount, partition, pixel);
+
+                UInt32 colorWeight = GetBc7Weights(info.indexBits)[primaryIndices[pixel]];
+                UInt32 alphaWeight = colorWeight;
+                if (info.secondaryIndexBits > 0) {
+                    alphaWeight = GetBc7Weights(info.secondaryIndexBits)[secondaryIndices[pixel]];
+                    if (indexSelection != 0) {
+                        std::swap(colorWeight, alphaWeight);
+                    }
+                }
+
+                UInt8* output = &pixels[pixel * 4];
+                for (UInt32 channel = 0; channel < 4; ++channel) {
+                    const UInt32 weight = (channel < 3) ? colorWeight : alphaWeight;
+                    output[channel] = static_cast<UInt8>(((64 - weight) * endpoints[subset][0][channel] +
+                                                          weight * endpoints[subset][1][channel] + 32) >>
+                                                         6);
+                }
+
+                if (rotation > 0) {
+                    std::swap(output[rotation - 1], output[3]);
+                }
+            }
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    BlockCompressor::BlockCompressor() :
+    BlockCompressor(Settings{}) {}
+
+    BlockCompressor::BlockCompressor(const Settings& settings) :
+    m_statistics(),
+    m_settings(settings) {}
+
+    std::vector<UInt8> BlockCompressor::Compress(const Image& image, const UInt32 level, ThreadPool* threadPool) {
+        FlAssertMsg(image.IsValid() && level < image.GetLevelCount(), "[Image/BlockCompressor] Invalid image level.");
+
+        const Clock clock;
+
+        std::optional<Image> convertedImage;
+        if (image.GetFormat() != ImageFormat::RGBA8) {
+            convertedImage = image.Convert(ImageFormat::RGBA8, image.GetColorSpace(), threadPool);
+        }
+
+        const Image& source = convertedImage ? *convertedImage : image;
+        const UInt32 width = source.GetWidth(level);
+        const UInt32 height = source.GetHeight(level);
+        const UInt32 blockColumnCount = (width + BlockDimension - 1) / BlockDimension;
+        const UInt32 blockRowCount = (height + BlockDimension - 1) / BlockDimension;
+        const std::size_t blockByteSize = GetBlockByteSize(m_settings.format);
+
+        std::vector<UInt8> blocks(GetCompressedSize(width, height, m_settings.format));
+
+        const auto compressRows = [&](const std::size_t firstRow, const std::size_t lastRow) {
+            UInt8 pixels[BlockPixelCount * 4];
+            for (std::size_t blockRow = firstRow; blockRow < lastRow; ++blockRow) {
+                for (UInt32 blockColumn = 0; blockColumn < blockColumnCount; ++blockColumn) {
+                    // Partial blocks repeat the last row and column
+                    for (UInt32 y = 0; y < BlockDimension; ++y) {
+                        const UInt8* row =
+                            source.GetRow(std::min(static_cast<UInt32>(blockRow) * BlockDimension + y, height - 1),
+                                          level);
+                        for (UInt32 x = 0; x < BlockDimension; ++x) {
+                            const UInt32 column = std::min(blockColumn * BlockDimension + x, width - 1);
+                            std::copy_n(row + column * 4, 4, &pixels[(y * BlockDimension + x) * 4]);
+                        }
+                    }
+
+                    const std::size_t block = blockRow * blockColumnCount + blockColumn;
+                    EncodeBlock(pixels, m_settings.format, m_settings.quality, &blocks[block * blockByteSize]);
+                }
+            }
+        };
+
+        if (threadPool) {
+            threadPool->ParallelFor(blockRowCount, 1, compressRows);
+        } else {
+            compressRows(0, blockRowCount);
+        }
+
+        m_statistics.blockCount = static_cast<std::size_t>(blockColumnCount) * blockRowCount;
+        m_statistics.pixelCount = m_statistics.blockCount * BlockPixelCount;
+        m_statistics.compressionTime = clock.GetElapsedTime();
+
+        return blocks;
+    }
+
+    Image BlockCompressor::Decompress(const std::span<const UInt8> blocks, const UInt32 width, const UInt32 height,
+                                      const BlockFormat format, const ColorSpace colorSpace) {
+        FlAssertMsg(blocks.size() >= GetCompressedSize(width, height, format),
+                    "[Image/BlockCompressor] Not enough blocks for the image size.");
+
+        Image image(width, height, ImageFormat::RGBA8, colorSpace);
+
+        const UInt32 blockColumnCount = (width + BlockDimension - 1) / BlockDimension;
+        const UInt32 blockRowCount = (height + BlockDimension - 1) / BlockDimension;
+        const std::size_t blockByteSize = GetBlockByteSize(format);
+
+        UInt8 pixels[BlockPixelCount * 4];
+        for (UInt32 blockRow = 0; blockRow < blockRowCount; ++blockRow) {
+            for (UInt32 blockColumn = 0; blockColumn < blockColumnCount; ++blockColumn) {
+                const std::size_t block = static_cast<std::size_t>(blockRow) * blockColumnCount + blockColumn;
+                DecodeBlock(&blocks[block * blockByteSize], format, pixels);
+
+                for (UInt32 y = 0; y < BlockDimension && blockRow * BlockDimension + y < height; ++y) {
+                    UInt8* row = image.GetRow(blockRow * BlockDimension + y);
+                    for (UInt32 x = 0; x < BlockDimension && blockColumn * BlockDimension + x < width; ++x) {
+                        std::copy_n(&pixels[(y * BlockDimension + x) * 4], 4,
+                                    row + (blockColumn * BlockDimension + x) * 4);
+                    }
+                }
+            }
+        }
+
+        return image;
+    }
+
+    void BlockCompressor::DecodeBlock(const UInt8* block, const BlockFormat format, UInt8* pixels) {
+        switch (format) {
+            case BlockFormat::BC1:
+                DecodeBc1(block, false, pixels);
+                break;
+
+            case BlockFormat::BC3:
+                DecodeBc1(block + 8, true, pixels);
+                DecodeBc4(block, 3, pixels);
+                break;
+
+            case BlockFormat::BC4:
+            case BlockFormat::BC5:
+                for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+                    pixels[pixel * 4 + 1] = 0;
+                    pixels[pixel * 4 + 2] = 0;
+                    pixels[pixel * 4 + 3] = 255;
+                }
+
+                DecodeBc4(block, 0, pixels);
+                if (format == BlockFormat::BC5) {
+                    DecodeBc4(block + 8, 1, pixels);
+                }
+
+                break;
+
+            case BlockFormat::BC7:
+                DecodeBc7(block, pixels);
+                break;
+        }
+    }
+
+    void BlockCompressor::EncodeBlock(const UInt8* pixels, const BlockFormat format, const CompressionQuality quality,
+                                      UInt8* block) {
+        BlockChannels channels;
+        channels.transparencyError = 0.f;
+        channels.isOpaque = true;
+        for (UInt32 pixel = 0; pixel < BlockPixelCount; ++pixel) {
+            for (UInt32 channel = 0; channel < 4; ++channel) {
+                channels.values[channel][pixel] = static_cast<float>(pixels[pixel * 4 + channel]);
+            }
+
+            const float transparency = 255.f - channels.values[3][pixel];
+            channels.transparencyError += transparency * transparency;
+            channels.isOpaque = channels.isOpaque && pixels[pixel * 4 + 3] == 255;
+        }
+
+        switch (format) {
+            case BlockFormat::BC1:
+                EncodeBc1(channels, quality, true, block);
+                break;
+
+            case BlockFormat::BC3:
+                EncodeBc4(channels, 3, quality, block);
+                EncodeBc1(channels, quality, false, block + 8);
+                break;
+
+            case BlockFormat::BC4:
+                EncodeBc4(channels, 0, quality, block);
+                break;
+
+            case BlockFormat::BC5:
+                EncodeBc4(channels, 0, quality, block);
+                EncodeBc4(channels, 1, quality, block + 8);
+                break;
+
+            case BlockFormat::BC7:
+                EncodeBc7(channels, quality, block);
+                break;
+        }
+    }
+
+    std::size_t BlockCompressor::GetBlockByteSize(const BlockFormat format) {
+        return (format == BlockFormat::BC1 || format == BlockFormat::BC4) ? 8 : 16;
+    }
+
+    std::size_t BlockCompressor::GetCompressedSize(const UInt32 width, const UInt32 height, const BlockFormat format) {
+        const std::size_t blockColumnCount = (width + BlockDimension - 1) / BlockDimension;
+        const std::size_t blockRowCount = (height + BlockDimension - 1) / BlockDimension;
+
+        return blockColumnCount * blockRowCount * GetBlockByteSize(format);
+    }
+} // namespace Fl
@@ -0,0 +1,736 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Image/Image.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/PathUtils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numbers>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr float MaxHalf = 65504.f;
+
+        // Below this many destination pixels, a level isn't worth dispatching to the thread pool
+        constexpr std::size_t MinParallelPixelCount = 64 * 1024;
+
+        float SrgbToLinear(const float value) {
+            return (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSrgb(const float value) {
+            return (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+        }
+
+        struct SrgbTables {
+            static constexpr UInt32 BucketCount = 4096;
+
+            SrgbTables() {
+                for (std::size_t code = 0; code < 256; ++code) {
+                    decode[code] = SrgbToLinear(static_cast<float>(code) / 255.f);
+                    thresholds[code] = (code > 0) ? SrgbToLinear((static_cast<float>(code) - 0.5f) / 255.f)
+                                                  : -std::numeric_limits<float>::infinity();
+                }
+
+                thresholds[256] = std::numeric_limits<float>::infinity();
+
+                UInt32 code = 0;
+                for (UInt32 bucket = 0; bucket < BucketCount; ++bucket) {
+                    const float value = static_cast<float>(bucket) / (BucketCount - 1);
+                    while (thresholds[code + 1] <= value) {
+                        ++code;
+                    }
+
+                    buckets[bucket] = static_cast<UInt8>(code);
+                }
+            }
+
+            std::array<float, 256> decode;
+            std::array<float, 257> thresholds; //< Linear value from which a code is the nearest one
+            std::array<UInt8, BucketCount> buckets; //< Code at the start of evenly spaced linear values
+        };
+
+        const SrgbTables& GetSrgbTables() {
+            static const SrgbTables tables;
+            return tables;
+        }
+
+        UInt8 EncodeSrgb(const SrgbTables& tables, const float value) {
+            // Buckets are narrower than the codes, even where the transfer function is the steepest, so a value is at
+            // most one threshold away from the code of its bucket: rounding is exact without evaluating the transfer
+            // function. Out of range values saturate and NaNs give 0
+            const float clamped = std::max(0.f, std::min(value, 1.f));
+            UInt32 code = tables.buckets[static_cast<UInt32>(clamped * (SrgbTables::BucketCount - 1))];
+            code -= (clamped < tables.thresholds[code]) ? 1 : 0;
+            code += (tables.thresholds[code + 1] <= clamped) ? 1 : 0;
+
+            return static_cast<UInt8>(code);
+        }
+
+        // Conversions from "Half to float done quic" by Fabian Giesen, rounding to nearest even. All cases are computed
+        // and selected, which keeps the conversion loops free of branches for the auto-vectorizer
+
+        /**
+         * @brief Converts a float in [-MaxHalf, MaxHalf] to half.
+         */
+        UInt16 FloatToHalf(const float value) {
+            constexpr Int32 HalfMinNormal = 113 << 23;
+            constexpr Int32 SubnormalMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+            // Signed integers: SSE2 has no unsigned comparisons
+            const Int32 bits = BitCast<Int32>(value) & 0x7FFFFFFF;
+            const Int32 sign = (BitCast<Int32>(value) >> 16) & 0x8000;
+
+            // Adding the magic value aligns the subnormal mantissa bits at the bottom, the addition rounding them
+            const Int32 subnormal =
+                BitCast<Int32>(BitCast<float>(bits) + BitCast<float>(SubnormalMagic)) - SubnormalMagic;
+            const Int32 normal = (bits - ((127 - 15) << 23) + 0xFFF + ((bits >> 13) & 1)) >> 13;
+
+            return static_cast<UInt16>(((bits < HalfMinNormal) ? subnormal : normal) | sign);
+        }
+
+        float HalfToFloat(const UInt16 half) {
+            constexpr UInt32 ShiftedExponent = 0x7C00u << 13;
+            constexpr UInt32 SubnormalMagic = 113u << 23;
+
+            const UInt32 bits = (half & 0x7FFFu) << 13;
+            const UInt32 exponent = bits & ShiftedExponent;
+
+            const UInt32 normal = bits + ((127u - 15u) << 23);
+            const UInt32 special = normal + ((128u - 16u) << 23);
+            const UInt32 subnormal =
+                BitCast<UInt32>(BitCast<float>(normal + (1u << 23)) - BitCast<float>(SubnormalMagic));
+
+            UInt32 result = (exponent == 0) ? subnormal : normal;
+            result = (exponent == ShiftedExponent) ? special : result;
+
+            return BitCast<float>(result | ((half & 0x8000u) << 16));
+        }
+
+        /**
+         * @brief Decodes a row to linear floats, four per pixel.
+         */
+        void DecodeRow(const UInt8* row, const UInt32 width, const ImageFormat format, const ColorSpace colorSpace,
+                       float* output) {
+            const std::size_t count = static_cast<std::size_t>(width) * 4;
+            const bool isSrgb = (colorSpace == ColorSpace::Srgb);
+
+            switch (format) {
+                case ImageFormat::RGBA8: {
+                    if (!isSrgb) {
+                        for (std::size_t i = 0; i < count; ++i) {
+                            output[i] = static_cast<float>(row[i]) * (1.f / 255.f);
+                        }
+
+                        return;
+                    }
+
+                    const std::array<float, 256>& decode = GetSrgbTables().decode;
+                    for (std::size_t i = 0; i < count; i += 4) {
+                        output[i + 0] = decode[row[i + 0]];
+                        output[i + 1] = decode[row[i + 1]];
+                        output[i + 2] = decode[row[i + 2]];
+                        output[i + 3] = static_cast<float>(row[i + 3]) * (1.f / 255.f);
+                    }
+
+                    return;
+                }
+
+                case ImageFormat::RGBA16F: {
+                    for (std::size_t i = 0; i < count; ++i) {
+                        UInt16 half;
+                        std::memcpy(&half, row + i * 2, 2);
+                        output[i] = HalfToFloat(half);
+                    }
+
+                    break;
+                }
+
+                case ImageFormat::RGBA32F: {
+                    std::memcpy(output, row, count * 4);
+                    break;
+                }
+            }
+
+            if (isSrgb) {
+                for (std::size_t i = 0; i < count; i += 4) {
+                    for (std::size_t channel = 0; channel < 3; ++channel) {
+                        output[i + channel] = SrgbToLinear(output[i + channel]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Encodes linear floats, four per pixel, to a row.
+         * @remark Modifies the input when encoding floats to sRGB.
+         */
+        void EncodeRow(float* input, const UInt32 width, const ImageFormat format, const ColorSpace colorSpace,
+                       UInt8* row) {
+            const std::size_t count = static_cast<std::size_t>(width) * 4;
+            const bool isSrgb = (colorSpace == ColorSpace::Srgb);
+
+            if (format == ImageFormat::RGBA8) {
+                if (!isSrgb) {
+                    // NaNs fail both comparisons and end up as zero
+                    for (std::size_t i = 0; i < count; ++i) {
+                        row[i] = static_cast<UInt8>(std::max(0.f, std::min(input[i], 1.f)) * 255.f + 0.5f);
+                    }
+
+                    return;
+                }
+
+                const SrgbTables& tables = GetSrgbTables();
+                for (std::size_t i = 0; i < count; i += 4) {
+                    row[i + 0] = EncodeSrgb(tables, input[i + 0]);
+                    row[i + 1] = EncodeSrgb(tables, input[i + 1]);
+                    row[i + 2] = EncodeSrgb(tables, input[i + 2]);
+                    row[i + 3] = static_cast<UInt8>(std::max(0.f, std::min(input[i + 3], 1.f)) * 255.f + 0.5f);
+                }
+
+                return;
+            }
+
+            if (isSrgb) {
+                for (std::size_t i = 0; i < count; i += 4) {
+                    for (std::size_t channel = 0; channel < 3; ++channel) {
+                        input[i + channel] = LinearToSrgb(std::max(0.f, input[i + channel]));
+                    }
+                }
+            }
+
+            if (format == ImageFormat::RGBA16F) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    const UInt16 half = FloatToHalf(std::max(-MaxHalf, std::min(input[i], MaxHalf)));
+                    std::memcpy(row + i * 2, &half, 2);
+                }
+            } else {
+                std::memcpy(row, input, count * 4);
+            }
+        }
+
+        float GetFilterRadius(const ImageFilter filter) {
+            switch (filter) {
+                case ImageFilter::Box: return 0.5f;
+                case ImageFilter::Triangle: return 1.f;
+                case ImageFilter::Kaiser:
+                case ImageFilter::Lanczos3: return 3.f;
+            }
+
+            return 0.f;
+        }
+
+        double Sinc(const double x) {
+            if (std::abs(x) < 1e-6) {
+                return 1.0;
+            }
+
+            return std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+        }
+
+        // Zeroth order modified Bessel function of the first kind, from its power series
+        double BesselI0(const double x) {
+            double sum = 1.0;
+            double term = 1.0;
+            for (int k = 1; k < 32; ++k) {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+
+            return sum;
+        }
+
+        double EvaluateFilter(const ImageFilter filter, const double x) {
+            constexpr double KaiserAlpha = 4.0;
+
+            switch (filter) {
+                case ImageFilter::Box: return (std::abs(x) <= 0.5) ? 1.0 : 0.0;
+                case ImageFilter::Triangle: return std::max(0.0, 1.0 - std::abs(x));
+                case ImageFilter::Kaiser: {
+                    const double t = x / 3.0;
+                    if (std::abs(t) >= 1.0) {
+                        return 0.0;
+                    }
+
+                    return Sinc(x) * BesselI0(KaiserAlpha * std::sqrt(1.0 - t * t)) / BesselI0(KaiserAlpha);
+                }
+                case ImageFilter::Lanczos3: return (std::abs(x) < 3.0) ? Sinc(x) * Sinc(x / 3.0) : 0.0;
+            }
+
+            return 0.0;
+        }
+
+        /**
+         * @brief Contributions of the source pixels to every destination pixel along one axis.
+         *
+         * Every destination pixel reads tapCount consecutive source pixels from its first one, padded with zero
+         * weights, so that the filtering loops have no bounds to check. Samples outside the source are clamped to the
+         * edge, their weights being added to the edge pixels.
+         */
+        struct FilterWeights {
+            std::vector<UInt32> firsts;
+            std::vector<float> weights;
+            UInt32 tapCount;
+        };
+
+        FilterWeights ComputeFilterWeights(const UInt32 sourceSize, const UInt32 destinationSize,
+                                           const ImageFilter filter) {
+            const double scale = static_cast<double>(sourceSize) / destinationSize;
+            const double filterScale = std::max(scale, 1.0); // Upsampling interpolates, downsampling low-passes
+            const double support = GetFilterRadius(filter) * filterScale;
+
+            const auto windowSize = std::min(static_cast<UInt32>(std::ceil(2.0 * support)) + 2, sourceSize);
+            std::vector<double> window(windowSize);
+            std::vector<UInt32> windowFirsts(destinationSize);
+            std::vector<double> windowWeights(static_cast<std::size_t>(destinationSize) * windowSize);
+
+            // Sample windows first, then trim them to the widest range of non-zero weights
+            UInt32 tapCount = 1;
+            std::vector<std::pair<UInt32, UInt32>> nonZeroRanges(destinationSize);
+            for (UInt32 i = 0; i < destinationSize; ++i) {
+                const double center = (i + 0.5) * scale;
+                const auto start = static_cast<Int64>(std::floor(center - support - 0.5));
+                const auto end = static_cast<Int64>(std::ceil(center + support - 0.5));
+                const auto first = static_cast<UInt32>(std::clamp<Int64>(start, 0, sourceSize - windowSize));
+
+                std::fill(window.begin(), window.end(), 0.0);
+                double sum = 0.0;
+                for (Int64 j = start; j <= end; ++j) {
+                    // Box weights are the coverage of the source pixels, which handles non-integer scales exactly
+                    const auto position = static_cast<double>(j);
+                    const double weight =
+                        (filter == ImageFilter::Box)
+                            ? std::max(0.0, std::min(position + 1.0, center + support) -
+                                                std::max(position, center - support))
+                            : EvaluateFilter(filter, (position + 0.5 - center) / filterScale);
+                    window[std::clamp<Int64>(j, 0, sourceSize - 1) - first] += weight;
+                    sum += weight;
+                }
+
+                UInt32 nonZeroFirst = windowSize;
+                UInt32 nonZeroLast = 0;
+                for (UInt32 tap = 0; tap < windowSize; ++tap) {
+                    windowWeights[static_cast<std::size_t>(i) * windowSize + tap] = window[tap] / sum;
+                    if (window[tap] != 0.0) {
+                        nonZeroFirst = std::min(nonZeroFirst, tap);
+                        nonZeroLast = tap;
+                    }
+                }
+
+                windowFirsts[i] = first;
+                nonZeroRanges[i] = {nonZeroFirst, nonZeroLast};
+                if (nonZeroFirst <= nonZeroLast) {
+                    tapCount = std::max(tapCount, nonZeroLast - nonZeroFirst + 1);
+                }
+            }
+
+            FilterWeights filterWeights;
+            filterWeights.tapCount = tapCount;
+            filterWeights.firsts.resize(destinationSize);
+            filterWeights.weights.assign(static_cast<std::size_t>(destinationSize) * tapCount, 0.f);
+
+            for (UInt32 i = 0; i < destinationSize; ++i) {
+                const auto [nonZeroFirst, nonZeroLast] = nonZeroRanges[i];
+                const UInt32 first = (nonZeroFirst <= nonZeroLast)
+                                         ? std::min(windowFirsts[i] + nonZeroFirst, sourceSize - tapCount)
+                                         : windowFirsts[i];
+
+                filterWeights.firsts[i] = first;
+                for (UInt32 tap = nonZeroFirst; tap <= nonZeroLast; ++tap) {
+                    const UInt32 source = windowFirsts[i] + tap;
+                    filterWeights.weights[static_cast<std::size_t>(i) * tapCount + (source - first)] =
+                        static_cast<float>(windowWeights[static_cast<std::size_t>(i) * windowSize + tap]);
+                }
+            }
+
+            return filterWeights;
+        }
+
+        template <typename F>
+        void ForEachBand(const UInt32 rowCount, const std::size_t pixelCount, ThreadPool* threadPool, F&& func) {
+            const std::size_t bandCount = (rowCount + Image::BandHeight - 1) / Image::BandHeight;
+            const auto processBands = [&](const std::size_t first, const std::size_t last) {
+                for (std::size_t band = first; band < last; ++band) {
+                    const auto firstRow = static_cast<UInt32>(band * Image::BandHeight);
+                    func(firstRow, std::min(rowCount, firstRow + Image::BandHeight));
+                }
+            };
+
+            if (threadPool && bandCount > 1 && pixelCount >= MinParallelPixelCount) {
+                threadPool->ParallelFor(bandCount, 1, processBands);
+            } else {
+                processBands(0, bandCount);
+            }
+        }
+
+        void Resample(const Image& source, const UInt32 sourceLevel, Image& destination, const UInt32 destinationLevel,
+                      const ImageFilter filter, ThreadPool* threadPool) {
+            const UInt32 sourceWidth = source.GetWidth(sourceLevel);
+            const UInt32 width = destination.GetWidth(destinationLevel);
+            const UInt32 height = destination.GetHeight(destinationLevel);
+
+            const FilterWeights horizontal = ComputeFilterWeights(sourceWidth, width, filter);
+            const FilterWeights vertical = ComputeFilterWeights(source.GetHeight(sourceLevel), height, filter);
+            const std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+
+            const auto resampleBand = [&](const UInt32 firstRow, const UInt32 lastRow) {
+                // Source rows read by the band, filtered horizontally once
+                const UInt32 firstSourceRow = vertical.firsts[firstRow];
+                const UInt32 lastSourceRow = vertical.firsts[lastRow - 1] + vertical.tapCount;
+
+                std::vector<float> sourceRow(static_cast<std::size_t>(sourceWidth) * 4);
+                std::vector<float> filteredRows((lastSourceRow - firstSourceRow) * rowSize);
+                std::vector<float> outputRow(rowSize);
+
+                for (UInt32 sourceY = firstSourceRow; sourceY < lastSourceRow; ++sourceY) {
+                    DecodeRow(source.GetRow(sourceY, sourceLevel), sourceWidth, source.GetFormat(),
+                              source.GetColorSpace(), sourceRow.data());
+
+                    float* filteredRow = &filteredRows[(sourceY - firstSourceRow) * rowSize];
+                    for (UInt32 x = 0; x < width; ++x) {
+                        const float* pixels = &sourceRow[static_cast<std::size_t>(horizontal.firsts[x]) * 4];
+                        const float* weights = &horizontal.weights[static_cast<std::size_t>(x) * horizontal.tapCount];
+
+                        SimdFloat4 sum = SimdFloat4::Zero();
+                        for (UInt32 tap = 0; tap < horizontal.tapCount; ++tap) {
+                            sum = SimdFloat4::MultiplyAdd(SimdFloat4::Splat(weights[tap]),
+                                                          SimdFloat4::Load(pixels + tap * 4), sum);
+                        }
+
+                        sum.Store(filteredRow + static_cast<std::size_t>(x) * 4);
+                    }
+                }
+
+                for (UInt32 y = firstRow; y < lastRow; ++y) {
+                    const float* rows = &filteredRows[(vertical.firsts[y] - firstSourceRow) * rowSize];
+                    const float* weights = &vertical.weights[static_cast<std::size_t>(y) * vertical.tapCount];
+
+                    // Accumulated row by row, streaming through the filtered rows
+                    const SimdFloat4 firstWeight = SimdFloat4::Splat(weights[0]);
+                    for (std::size_t i = 0; i < rowSize; i += SimdFloat4::Width) {
+                        (firstWeight * SimdFloat4::Load(rows + i)).Store(&outputRow[i]);
+                    }
+
+                    for (UInt32 tap = 1; tap < vertical.tapCount; ++tap) {
+                        const SimdFloat4 weight = SimdFloat4::Splat(weights[tap]);
+                        const float* row = rows + tap * rowSize;
+                        for (std::size_t i = 0; i < rowSize; i += SimdFloat4::Width) {
+                            SimdFloat4::MultiplyAdd(weight, SimdFloat4::Load(row + i), SimdFloat4::Load(&outputRow[i]))
+                                .Store(&outputRow[i]);
+                        }
+                    }
+
+                    EncodeRow(outputRow.data(), width, destination.GetFormat(), destination.GetColorSpace(),
+                              destination.GetRow(y, destinationLevel));
+                }
+            };
+
+            ForEachBand(height, rowSize / 4 * height, threadPool, resampleBand);
+        }
+
+        bool SetError(std::string* errorMessage, std::string message) {
+            if (errorMessage) {
+                *errorMessage = std::move(message);
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief Reads a whitespace separated token of a PNM header, skipping comments.
+         */
+        std::string ReadHeaderToken(std::istream& stream) {
+            std::string token;
+            for (int character = stream.get(); character != std::char_traits<char>::eof(); character = stream.get()) {
+                if (character == '#' && token.empty()) {
+                    stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                } else if (std::isspace(character)) {
+                    if (!token.empty()) {
+                        break;
+                    }
+                } else {
+                    token.push_back(static_cast<char>(character));
+                }
+            }
+
+            return token;
+        }
+
+        bool ParseDimension(const std::string& token, UInt32& value) {
+            char* end = nullptr;
+            const unsigned long parsed = std::strtoul(token.c_str(), &end, 10);
+            if (token.empty() || *end != '\0' || parsed == 0 || parsed > 65536) {
+                return false;
+            }
+
+            value = static_cast<UInt32>(parsed);
+            return true;
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    Image::Image() :
+    m_colorSpace(ColorSpace::Linear),
+    m_format(ImageFormat::RGBA8) {}
+
+    Image::Image(const UInt32 width, const UInt32 height, const ImageFormat format, const ColorSpace colorSpace,
+                 const UInt32 levelCount) :
+    m_colorSpace(colorSpace),
+    m_format(format) {
+        FlAssertMsg(width > 0 && height > 0, "[Image/Image] Image must have pixels.");
+
+        const UInt32 fullLevelCount = GetFullLevelCount(width, height);
+        FlAssertMsg(levelCount <= fullLevelCount, "[Image/Image] Too many mip levels.");
+
+        std::size_t size = 0;
+        m_levels.resize((levelCount > 0) ? levelCount : fullLevelCount);
+        for (std::size_t level = 0; level < m_levels.size(); ++level) {
+            Level& levelInfo = m_levels[level];
+            levelInfo.width = std::max(width >> level, 1u);
+            levelInfo.height = std::max(height >> level, 1u);
+            levelInfo.rowPitch = (levelInfo.width * GetBytesPerPixel(format) + RowAlignment - 1) & ~(RowAlignment - 1);
+            levelInfo.offset = size;
+
+            size += levelInfo.rowPitch * levelInfo.height;
+        }
+
+        m_data.resize(size / RowAlignment);
+    }
+
+    Image Image::Convert(const ImageFormat format, const ColorSpace colorSpace, ThreadPool* threadPool) const {
+        FlAssertMsg(IsValid(), "[Image/Image] Invalid image.");
+
+        if (format == m_format && colorSpace == m_colorSpace) {
+            return *this;
+        }
+
+        Image image(GetWidth(), GetHeight(), format, colorSpace, GetLevelCount());
+        for (UInt32 level = 0; level < GetLevelCount(); ++level) {
+            const UInt32 width = GetWidth(level);
+            const auto convertBand = [&](const UInt32 firstRow, const UInt32 lastRow) {
+                std::vector<float> row(static_cast<std::size_t>(width) * 4);
+                for (UInt32 y = firstRow; y < lastRow; ++y) {
+                    DecodeRow(GetRow(y, level), width, m_format, m_colorSpace, row.data());
+                    EncodeRow(row.data(), width, format, colorSpace, image.GetRow(y, level));
+                }
+            };
+
+            ForEachBand(GetHeight(level), static_cast<std::size_t>(width) * GetHeight(level), threadPool, convertBand);
+        }
+
+        return image;
+    }
+
+    void Image::GenerateMipmaps(const ImageFilter filter, UInt32 levelCount, ThreadPool* threadPool) {
+        FlAssertMsg(IsValid(), "[Image/Image] Invalid image.");
+
+        const UInt32 fullLevelCount = GetFullLevelCount(GetWidth(), GetHeight());
+        FlAssertMsg(levelCount <= fullLevelCount, "[Image/Image] Too many mip levels.");
+
+        if (levelCount == 0) {
+            levelCount = fullLevelCount;
+        }
+
+        if (levelCount != GetLevelCount()) {
+            Image image(GetWidth(), GetHeight(), m_format, m_colorSpace, levelCount);
+            const std::size_t rowSize = GetWidth() * GetBytesPerPixel(m_format);
+            for (UInt32 y = 0; y < GetHeight(); ++y) {
+                std::memcpy(image.GetRow(y), GetRow(y), rowSize);
+            }
+
+            *this = std::move(image);
+        }
+
+        // Each level is filtered from the previous one, which reads a fraction of the pixels of the first level
+        for (UInt32 level = 1; level < levelCount; ++level) {
+            Resample(*this, level - 1, *this, level, filter, threadPool);
+        }
+    }
+
+    Color Image::GetPixel(const UInt32 x, const UInt32 y, const UInt32 level) const {
+        FlAssertMsg(x < GetWidth(level), "[Image/Image] Pixel out of range.");
+
+        float channels[4];
+        DecodeRow(GetRow(y, level) + x * GetBytesPerPixel(m_format), 1, m_format, m_colorSpace, channels);
+
+        return Color{channels[0], channels[1], channels[2], channels[3]};
+    }
+
+    void Image::Premultiply(ThreadPool* threadPool) {
+        FlAssertMsg(IsValid(), "[Image/Image] Invalid image.");
+
+        for (UInt32 level = 0; level < GetLevelCount(); ++level) {
+            const UInt32 width = GetWidth(level);
+            const auto premultiplyBand = [&](const UInt32 firstRow, const UInt32 lastRow) {
+                std::vector<float> row(static_cast<std::size_t>(width) * 4);
+                for (UInt32 y = firstRow; y < lastRow; ++y) {
+                    DecodeRow(GetRow(y, level), width, m_format, m_colorSpace, row.data());
+
+                    for (std::size_t i = 0; i < row.size(); i += 4) {
+                        const SimdFloat4 pixel = SimdFloat4::Load(&row[i]);
+                        const float alpha = row[i + 3];
+
+                        (pixel * pixel.Broadcast<3>()).Store(&row[i]);
+                        row[i + 3] = alpha;
+                    }
+
+                    EncodeRow(row.data(), width, m_format, m_colorSpace, GetRow(y, level));
+                }
+            };
+
+            ForEachBand(GetHeight(level), static_cast<std::size_t>(width) * GetHeight(level), threadPool,
+                        premultiplyBand);
+        }
+    }
+
+    Image Image::Resize(const UInt32 width, const UInt32 height, const ImageFilter filter,
+                        ThreadPool* threadPool) const {
+        FlAssertMsg(IsValid(), "[Image/Image] Invalid image.");
+
+        Image image(width, height, m_format, m_colorSpace);
+        Resample(*this, 0, image, 0, filter, threadPool);
+
+        return image;
+    }
+
+    bool Image::SaveToFile(const std::string_view filePath, std::string* errorMessage) const {
+        FlAssertMsg(IsValid(), "[Image/Image] Invalid image.");
+
+        const std::filesystem::path path = Utf8Path(filePath);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return SetError(errorMessage, "Failed to open " + PathToString(path) + " for writing.");
+        }
+
+        file << "P7\nWIDTH " << GetWidth() << "\nHEIGHT " << GetHeight()
+             << "\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n";
+
+        std::vector<float> pixels(static_cast<std::size_t>(GetWidth()) * 4);
+        std::vector<UInt8> row(pixels.size());
+        for (UInt32 y = 0; y < GetHeight(); ++y) {
+            const UInt8* data = GetRow(y);
+            if (m_format != ImageFormat::RGBA8) {
+                DecodeRow(data, GetWidth(), m_format, m_colorSpace, pixels.data());
+                EncodeRow(pixels.data(), GetWidth(), ImageFormat::RGBA8, m_colorSpace, row.data());
+                data = row.data();
+            }
+
+            file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(row.size()));
+        }
+
+        if (!file) {
+            return SetError(errorMessage, "Failed to write " + PathToString(path) + ".");
+        }
+
+        return true;
+    }
+
+    void Image::SetPixel(const UInt32 x, const UInt32 y, const Color& color, const UInt32 level) {
+        FlAssertMsg(x < GetWidth(level), "[Image/Image] Pixel out of range.");
+
+        float channels[4] = {color.r, color.g, color.b, color.a};
+        EncodeRow(channels, 1, m_format, m_colorSpace, GetRow(y, level) + x * GetBytesPerPixel(m_format));
+    }
+
+    std::size_t Image::GetBytesPerPixel(const ImageFormat format) {
+        switch (format) {
+            case ImageFormat::RGBA8: return 4;
+            case ImageFormat::RGBA16F: return 8;
+            case ImageFormat::RGBA32F: return 16;
+        }
+
+        return 0;
+    }
+
+    UInt32 Image::GetFullLevelCount(const UInt32 width, const UInt32 height) {
+        return static_cast<UInt32>(std::bit_width(std::max(width, height)));
+    }
+
+    std::optional<Image> Image::LoadFromFile(const std::string_view filePath, std::string* errorMessage) {
+        const std::filesystem::path path = Utf8Path(filePath);
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            SetError(errorMessage, "Failed to open " + PathToString(path) + ".");
+            return std::nullopt;
+        }
+
+        const std::string magic = ReadHeaderToken(file);
+        UInt32 width = 0;
+        UInt32 height = 0;
+        UInt32 channelCount = 3;
+        std::string maxValue;
+
+        if (magic == "P6") {
+            if (!ParseDimension(ReadHeaderToken(file), width) || !ParseDimension(ReadHeaderToken(file), height)) {
+                SetError(errorMessage, PathToString(path) + " has invalid dimensions.");
+                return std::nullopt;
+            }
+
+            maxValue = ReadHeaderToken(file);
+        } else if (magic == "P7") {
+            channelCount = 0;
+            for (std::string token = ReadHeaderToken(file); token != "ENDHDR"; token = ReadHeaderToken(file)) {
+                if (token.empty()) {
+                    SetError(errorMessage, PathToString(path) + " has a truncated header.");
+                    return std::nullopt;
+                }
+
+                const std::string value = ReadHeaderToken(file);
+                if (token == "WIDTH") {
+                    ParseDimension(value, width);
+                } else if (token == "HEIGHT") {
+                    ParseDimension(value, height);
+                } else if (token == "DEPTH") {
+                    channelCount = (value == "3" || value == "4") ? static_cast<UInt32>(value[0] - '0') : 0;
+                } else if (token == "MAXVAL") {
+                    maxValue = value;
+                }
+            }
+
+            if (width == 0 || height == 0 || channelCount == 0) {
+                SetError(errorMessage, PathToString(path) + " isn't an RGB or RGBA image.");
+                return std::nullopt;
+            }
+        } else {
+            SetError(errorMessage, PathToString(path) + " isn't a binary PPM or PAM file.");
+            return std::nullopt;
+        }
+
+        if (maxValue != "255") {
+            SetError(errorMessage, PathToString(path) + " doesn't have 8 bits per channel.");
+            return std::nullopt;
+        }
+
+        Image image(width, height, ImageFormat::RGBA8, ColorSpace::Srgb);
+        std::vector<UInt8> row(static_cast<std::size_t>(width) * channelCount);
+        for (UInt32 y = 0; y < height; ++y) {
+            if (!file.read(reinterpret_cast<char*>(row.data()), static_cast<std::streamsize>(row.size()))) {
+                SetError(errorMessage, PathToString(path) + " is truncated.");
+                return std::nullopt;
+            }
+
+            UInt8* pixels = image.GetRow(y);
+            for (UInt32 x = 0; x < width; ++x) {
+                for (UInt32 channel = 0; channel < 4; ++channel) {
+                    pixels[x * 4 + channel] = (channel < channelCount) ? row[x * channelCount + channel] : 255;
+                }
+            }
+        }
+
+        return image;
+    }
+} // namespace Fl
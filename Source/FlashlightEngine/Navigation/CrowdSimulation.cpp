@@ -0,0 +1,546 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Navigation/CrowdSimulation.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/FixedVector.hpp>
+#include <FlashlightEngine/Utility/ParallelAlgorithm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr float Epsilon = 1e-5f;
+        constexpr std::size_t MinHashBlockSize = 4096; //< Agents counted and scattered by a job
+
+        struct PlanarVector {
+            float x;
+            float z;
+        };
+
+        PlanarVector operator+(const PlanarVector& lhs, const PlanarVector& rhs) {
+            return {lhs.x + rhs.x, lhs.z + rhs.z};
+        }
+
+        PlanarVector operator-(const PlanarVector& lhs, const PlanarVector& rhs) {
+            return {lhs.x - rhs.x, lhs.z - rhs.z};
+        }
+
+        PlanarVector operator*(const PlanarVector& vec, const float scale) {
+            return {vec.x * scale, vec.z * scale};
+        }
+
+        float Determinant(const PlanarVector& lhs, const PlanarVector& rhs) {
+            return lhs.x * rhs.z - lhs.z * rhs.x;
+        }
+
+        float DotProduct(const PlanarVector& lhs, const PlanarVector& rhs) {
+            return lhs.x * rhs.x + lhs.z * rhs.z;
+        }
+
+        PlanarVector Normalize(const PlanarVector& vec) {
+            return vec * (1.0f / std::sqrt(DotProduct(vec, vec)));
+        }
+
+        /**
+         * @brief Velocities on the left of the line, looking along its direction, are allowed.
+         */
+        struct OrcaLine {
+            PlanarVector point;
+            PlanarVector direction;
+        };
+
+        using OrcaLines = FixedVector<OrcaLine, CrowdSimulation::MaxNeighbors>;
+
+        /**
+         * @brief Finds the velocity on a line closest to the optimal one, satisfying the previous lines.
+         * @param isDirection Whether the optimal velocity is a direction to go as far as possible along.
+         */
+        bool SolveOnLine(const OrcaLines& lines, const std::size_t line, const float maxSpeed,
+                         const PlanarVector& optimalVelocity, const bool isDirection, PlanarVector& result) {
+            const float dotProduct = DotProduct(lines[line].point, lines[line].direction);
+            const float discriminant =
+                dotProduct * dotProduct + maxSpeed * maxSpeed - DotProduct(lines[line].point, lines[line].point);
+
+            // The line doesn't cross the maximum speed circle
+            if (discriminant < 0.0f) {
+                return false;
+            }
+
+            const float sqrtDiscriminant = std::sqrt(discriminant);
+            float left = -dotProduct - sqrtDiscriminant;
+            float right = -dotProduct + sqrtDiscriminant;
+
+            for (std::size_t i = 0; i < line; ++i) {
+                const float denominator = Determinant(lines[line].direction, lines[i].direction);
+                const float numerator = Determinant(lines[i].direction, lines[line].point - lines[i].point);
+
+                // Parallel lines, the other one allowing all of this one or none of it
+                if (std::abs(denominator) <= Epsilon) {
+                    if (numerator < 0.0f) {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                const float t = numerator / denominator;
+                if (denominator >= 0.0f) {
+                    right = std::min(right, t);
+                } else {
+                    left = std::max(left, t);
+                }
+
+                if (left > right) {
+                    return false;
+                }
+            }
+
+            float t;
+            if (isDirection) {
+                t = (DotProduct(optimalVelocity, lines[line].direction) > 0.0f) ? right : left;
+            } else {
+                t = std::clamp(DotProduct(lines[line].direction, optimalVelocity - lines[line].point), left, right);
+            }
+
+            result = lines[line].point + lines[line].direction * t;
+            return true;
+        }
+
+        /**
+         * @brief Finds the velocity closest to the optimal one satisfying the lines, one line at a time.
+         * @return Index of the first line without solution, or the line count on success.
+         */
+        std::size_t SolveLines(const OrcaLines& lines, const float maxSpeed, const PlanarVector& optimalVelocity,
+                               const bool isDirection, PlanarVector& result) {
+            const float optimalSpeedSq = DotProduct(optimalVelocity, optimalVelocity);
+            if (isDirection) {
+                result = optimalVelocity * maxSpeed;
+            } else if (optimalSpeedSq > maxSpeed * maxSpeed) {
+                result = optimalVelocity * (maxSpeed / std::sqrt(optimalSpeedSq));
+            } else {
+                result = optimalVelocity;
+            }
+
+            for (std::size_t i = 0; i < lines.size(); ++i) {
+                // The current result violates this line, the new one lies on it
+                if (Determinant(lines[i].direction, lines[i].point - result) > 0.0f) {
+                    const PlanarVector previousResult = result;
+                    if (!SolveOnLine(lines, i, maxSpeed, optimalVelocity, isDirection, result)) {
+                        result = previousResult;
+                        return i;
+                    }
+                }
+            }
+
+            return lines.size();
+        }
+
+        /**
+         * @brief Finds the velocity minimizing the largest violation of the lines, starting from the first line
+         *        without solution.
+         */
+        void SolveInfeasibleLines(const OrcaLines& lines, const std::size_t firstLine, const float maxSpeed,
+                                  PlanarVector& result) {
+            float distance = 0.0f;
+
+            for (std::size_t i = firstLine; i < lines.size(); ++i) {
+                if (Determinant(lines[i].direction, lines[i].point - result) <= distance) {
+                    continue;
+                }
+
+                // Previous lines projected on this one, equally violated along their bisector
+                OrcaLines projectedLines;
+                for (std::size_t j = 0; j < i; ++j) {
+                    OrcaLine line;
+                    const float determinant = Determinant(lines[i].direction, lines[j].direction);
+
+                    if (std::abs(determinant) <= Epsilon) {
+                        // Lines in the same direction never are the most violated one together
+                        if (DotProduct(lines[i].direction, lines[j].direction) > 0.0f) {
+                            continue;
+                        }
+
+                        line.point = (lines[i].point + lines[j].point) * 0.5f;
+                    } else {
+                        const float t = Determinant(lines[j].direction, lines[i].point - lines[j].point) / determinant;
+                        line.point = lines[i].point + lines[i].direction * t;
+                    }
+
+                    line.direction = Normalize(lines[j].direction - lines[i].direction);
+                    projectedLines.push_back(line);
+                }
+
+                const PlanarVector previousResult = result;
+                const PlanarVector normal = {-lines[i].direction.z, lines[i].direction.x};
+                if (SolveLines(projectedLines, maxSpeed, normal, true, result) < projectedLines.size()) {
+                    // Only rounding errors can make it fail, the previous result stays the best one
+                    result = previousResult;
+                }
+
+                distance = Determinant(lines[i].direction, lines[i].point - result);
+            }
+        }
+
+        template <typename F>
+        void ForEachBatch(ThreadPool* threadPool, const std::size_t count, const std::size_t batchSize, F&& func) {
+            if (threadPool) {
+                threadPool->ParallelFor(count, batchSize, func);
+            } else if (count > 0) {
+                func(std::size_t(0), count);
+            }
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    CrowdSimulation::CrowdSimulation() :
+    CrowdSimulation(Settings{}) {
+    }
+
+    CrowdSimulation::CrowdSimulation(const Settings& settings) :
+    m_statistics(), m_settings(settings),
+    m_bucketCountX(1u << ((std::countr_zero(settings.bucketCount) + 1) / 2)) {
+        FlAssertMsg(settings.neighborDistance > 0.0f, "[Navigation/CrowdSimulation] Invalid neighbor distance.");
+        FlAssertMsg(settings.timeHorizon > 0.0f, "[Navigation/CrowdSimulation] Invalid time horizon.");
+        FlAssertMsg(settings.maxNeighbors <= MaxNeighbors, "[Navigation/CrowdSimulation] Too many neighbors.");
+        FlAssertMsg(std::has_single_bit(settings.bucketCount) && settings.bucketCount >= 16,
+                    "[Navigation/CrowdSimulation] Bucket count must be a power of two, at least 16.");
+    }
+
+    UInt32 CrowdSimulation::AddAgent(const Vector3& position, const float radius, const float maxSpeed) {
+        FlAssertMsg(radius >= 0.0f && maxSpeed >= 0.0f, "[Navigation/CrowdSimulation] Invalid agent.");
+
+        const auto agent = static_cast<UInt32>(GetAgentCount());
+        m_positionX.push_back(position.x);
+        m_positionY.push_back(position.y);
+        m_positionZ.push_back(position.z);
+        m_velocityX.push_back(0.0f);
+        m_velocityZ.push_back(0.0f);
+        m_preferredVelocityX.push_back(0.0f);
+        m_preferredVelocityZ.push_back(0.0f);
+        m_radii.push_back(radius);
+        m_maxSpeeds.push_back(maxSpeed);
+        m_neighbors.resize(m_neighbors.size() + MaxNeighbors);
+        m_neighborCounts.push_back(0);
+
+        return agent;
+    }
+
+    void CrowdSimulation::Clear() {
+        for (std::vector<float>* values : {&m_positionX, &m_positionY, &m_positionZ, &m_velocityX, &m_velocityZ,
+                                           &m_preferredVelocityX, &m_preferredVelocityZ, &m_radii, &m_maxSpeeds}) {
+            values->clear();
+        }
+
+        m_neighbors.clear();
+        m_neighborCounts.clear();
+    }
+
+    void CrowdSimulation::Reserve(const std::size_t capacity) {
+        for (std::vector<float>* values : {&m_positionX, &m_positionY, &m_positionZ, &m_velocityX, &m_velocityZ,
+                                           &m_preferredVelocityX, &m_preferredVelocityZ, &m_radii, &m_maxSpeeds}) {
+            values->reserve(capacity);
+        }
+
+        m_neighbors.reserve(capacity * MaxNeighbors);
+        m_neighborCounts.reserve(capacity);
+    }
+
+    void CrowdSimulation::SetPosition(const UInt32 agent, const Vector3& position) {
+        FlAssertMsg(agent < GetAgentCount(), "[Navigation/CrowdSimulation] Invalid agent.");
+
+        m_positionX[agent] = position.x;
+        m_positionY[agent] = position.y;
+        m_positionZ[agent] = position.z;
+    }
+
+    void CrowdSimulation::SetPreferredVelocity(const UInt32 agent, const Vector3& velocity) {
+        FlAssertMsg(agent < GetAgentCount(), "[Navigation/CrowdSimulation] Invalid agent.");
+
+        m_preferredVelocityX[agent] = velocity.x;
+        m_preferredVelocityZ[agent] = velocity.z;
+    }
+
+    void CrowdSimulation::Step(const float deltaTime, ThreadPool* threadPool) {
+        FlAssertMsg(deltaTime > 0.0f, "[Navigation/CrowdSimulation] Invalid time step.");
+
+        const std::size_t agentCount = GetAgentCount();
+        m_statistics = {};
+        m_statistics.agentCount = agentCount;
+
+        const Clock hashClock;
+        BuildHash(threadPool);
+        m_statistics.hashTime = hashClock.GetElapsedTime();
+
+        const Clock solveClock;
+        m_newVelocityX.resize(agentCount);
+        m_newVelocityZ.resize(agentCount);
+
+        // Batches of the sorted agents, whose neighbors are close in memory
+        ForEachBatch(threadPool, agentCount, BatchSize, [&](const std::size_t first, const std::size_t last) {
+            if (IsUsingSimd()) {
+                SolveBatch<true>(first, last, deltaTime);
+            } else {
+                SolveBatch<false>(first, last, deltaTime);
+            }
+        });
+
+        ForEachBatch(threadPool, agentCount, BatchSize, [&](const std::size_t first, const std::size_t last) {
+            for (std::size_t agent = first; agent < last; ++agent) {
+                m_velocityX[agent] = m_newVelocityX[agent];
+                m_velocityZ[agent] = m_newVelocityZ[agent];
+                m_positionX[agent] += m_velocityX[agent] * deltaTime;
+                m_positionZ[agent] += m_velocityZ[agent] * deltaTime;
+            }
+        });
+
+        m_statistics.solveTime = solveClock.GetElapsedTime();
+
+        for (const UInt8 neighborCount : m_neighborCounts) {
+            m_statistics.neighborCount += neighborCount;
+        }
+    }
+
+    void CrowdSimulation::BuildHash(ThreadPool* threadPool) {
+        const std::size_t agentCount = GetAgentCount();
+        const std::size_t bucketCount = m_settings.bucketCount;
+        const std::size_t blockCount =
+            (threadPool) ? std::clamp<std::size_t>(agentCount / MinHashBlockSize, 1, threadPool->GetWorkerCount()) : 1;
+        const auto forEachBlock = [&](auto&& func) {
+            ForEachBatch(threadPool, blockCount, 1, [&](const std::size_t firstBlock, const std::size_t lastBlock) {
+                for (std::size_t block = firstBlock; block < lastBlock; ++block) {
+                    func(block, block * agentCount / blockCount, (block + 1) * agentCount / blockCount);
+                }
+            });
+        };
+
+        // Agents of each bucket are counted per block, the counts being interleaved so that scanning them gives
+        // every block the position of its first agent in each bucket, after those of the previous blocks
+        m_agentBuckets.resize(agentCount);
+        m_blockOffsets.assign(bucketCount * blockCount, 0);
+        forEachBlock([&](const std::size_t block, const std::size_t first, const std::size_t last) {
+            for (std::size_t agent = first; agent < last; ++agent) {
+                const UInt32 bucket = HashCell(GetCell(m_positionX[agent]), GetCell(m_positionZ[agent]));
+                m_agentBuckets[agent] = bucket;
+                ++m_blockOffsets[bucket * blockCount + block];
+            }
+        });
+
+        ExclusiveScan<UInt32>(m_blockOffsets, m_blockOffsets, 0, std::plus<>(), threadPool);
+
+        m_bucketOffsets.resize(bucketCount + 1);
+        for (std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+            m_bucketOffsets[bucket] = m_blockOffsets[bucket * blockCount];
+        }
+
+        m_bucketOffsets[bucketCount] = static_cast<UInt32>(agentCount);
+
+        // Agents are scattered in index order within each block, which keeps the order independent of the blocks
+        m_sortedAgents.resize(agentCount);
+        m_sortedPositionX.assign(agentCount + SimdFloat4::Width, 0.0f);
+        m_sortedPositionZ.assign(agentCount + SimdFloat4::Width, 0.0f);
+        forEachBlock([&](const std::size_t block, const std::size_t first, const std::size_t last) {
+            for (std::size_t agent = first; agent < last; ++agent) {
+                const UInt32 position = m_blockOffsets[m_agentBuckets[agent] * blockCount + block]++;
+                m_sortedAgents[position] = static_cast<UInt32>(agent);
+                m_sortedPositionX[position] = m_positionX[agent];
+                m_sortedPositionZ[position] = m_positionZ[agent];
+            }
+        });
+    }
+
+    template <bool UseSimd>
+    std::size_t CrowdSimulation::FindNeighbors(const UInt32 agent, UInt32* neighbors) const {
+        const float positionX = m_positionX[agent];
+        const float positionZ = m_positionZ[agent];
+        const float rangeSq = m_settings.neighborDistance * m_settings.neighborDistance;
+        const Int32 cellX = GetCell(positionX);
+        const Int32 cellZ = GetCell(positionZ);
+
+        // Nearest neighbors first, ties broken by index so that the order doesn't depend on the buckets
+        std::array<float, MaxNeighbors> distancesSq;
+        std::size_t neighborCount = 0;
+        const auto addCandidate = [&](const UInt32 candidate, const float distanceSq) {
+            if (candidate == agent) {
+                return;
+            }
+
+            const auto isCloser = [&](const std::size_t i) {
+                return distanceSq < distancesSq[i] || (distanceSq == distancesSq[i] && candidate < neighbors[i]);
+            };
+
+            if (neighborCount == m_settings.maxNeighbors) {
+                if (neighborCount == 0 || !isCloser(neighborCount - 1)) {
+                    return;
+                }
+
+                --neighborCount;
+            }
+
+            std::size_t i = neighborCount++;
+            for (; i > 0 && isCloser(i - 1); --i) {
+                distancesSq[i] = distancesSq[i - 1];
+                neighbors[i] = neighbors[i - 1];
+            }
+
+            distancesSq[i] = distanceSq;
+            neighbors[i] = candidate;
+        };
+
+        // Cells as large as the neighbor distance, the neighbors lie in the 3x3 cells around the agent. Each row is
+        // a single range of agents unless it wraps around the grid of buckets
+        for (Int32 row = cellZ - 1; row <= cellZ + 1; ++row) {
+            const UInt32 firstBucket = HashCell(cellX - 1, row);
+            const UInt32 lastBucket = HashCell(cellX + 1, row);
+
+            std::array<std::pair<UInt32, UInt32>, 3> bucketRanges;
+            std::size_t rangeCount = 0;
+            if (firstBucket < lastBucket) {
+                bucketRanges[rangeCount++] = {firstBucket, lastBucket + 1};
+            } else {
+                const UInt32 middleBucket = HashCell(cellX, row);
+                bucketRanges[rangeCount++] = {firstBucket, firstBucket + 1};
+                bucketRanges[rangeCount++] = {middleBucket, middleBucket + 1};
+                bucketRanges[rangeCount++] = {lastBucket, lastBucket + 1};
+            }
+
+            for (std::size_t i = 0; i < rangeCount; ++i) {
+                const UInt32 first = m_bucketOffsets[bucketRanges[i].first];
+                const UInt32 last = m_bucketOffsets[bucketRanges[i].second];
+
+                if constexpr (UseSimd) {
+                    const SimdFloat4 x = SimdFloat4::Splat(positionX);
+                    const SimdFloat4 z = SimdFloat4::Splat(positionZ);
+                    const SimdFloat4 maxDistanceSq = SimdFloat4::Splat(rangeSq);
+
+                    for (UInt32 j = first; j < last; j += SimdFloat4::Width) {
+                        const SimdFloat4 offsetX = SimdFloat4::Load(&m_sortedPositionX[j]) - x;
+                        const SimdFloat4 offsetZ = SimdFloat4::Load(&m_sortedPositionZ[j]) - z;
+                        const SimdFloat4 distanceSq = offsetX * offsetX + offsetZ * offsetZ;
+
+                        // Lanes past the range read the next bucket or the padding
+                        const SimdFloat4 inRange = SimdFloat4::Less(distanceSq, maxDistanceSq);
+                        auto mask = static_cast<unsigned int>(inRange.GetMoveMask());
+                        if (last - j < SimdFloat4::Width) {
+                            mask &= (1u << (last - j)) - 1;
+                        }
+
+                        for (; mask != 0; mask &= mask - 1) {
+                            const auto lane = static_cast<std::size_t>(std::countr_zero(mask));
+                            addCandidate(m_sortedAgents[j + lane], distanceSq.GetLane(lane));
+                        }
+                    }
+                } else {
+                    for (UInt32 j = first; j < last; ++j) {
+                        const float offsetX = m_sortedPositionX[j] - positionX;
+                        const float offsetZ = m_sortedPositionZ[j] - positionZ;
+                        const float distanceSq = offsetX * offsetX + offsetZ * offsetZ;
+                        if (distanceSq < rangeSq) {
+                            addCandidate(m_sortedAgents[j], distanceSq);
+                        }
+                    }
+                }
+            }
+        }
+
+        return neighborCount;
+    }
+
+    template <bool UseSimd>
+    void CrowdSimulation::SolveBatch(const std::size_t first, const std::size_t last, const float deltaTime) {
+        const float inverseTimeHorizon = 1.0f / m_settings.timeHorizon;
+        const float inverseDeltaTime = 1.0f / deltaTime;
+
+        for (std::size_t i = first; i < last; ++i) {
+            const UInt32 agent = m_sortedAgents[i];
+            UInt32* neighbors = &m_neighbors[std::size_t(agent) * MaxNeighbors];
+            const std::size_t neighborCount = FindNeighbors<UseSimd>(agent, neighbors);
+            m_neighborCounts[agent] = static_cast<UInt8>(neighborCount);
+
+            const PlanarVector position = {m_positionX[agent], m_positionZ[agent]};
+            const PlanarVector velocity = {m_velocityX[agent], m_velocityZ[agent]};
+            const float radius = m_radii[agent];
+
+            OrcaLines lines;
+            for (std::size_t j = 0; j < neighborCount; ++j) {
+                const UInt32 neighbor = neighbors[j];
+                const PlanarVector relativePosition = PlanarVector{m_positionX[neighbor], m_positionZ[neighbor]} -
+                                                      position;
+                const PlanarVector relativeVelocity = velocity -
+                                                      PlanarVector{m_velocityX[neighbor], m_velocityZ[neighbor]};
+                const float distanceSq = DotProduct(relativePosition, relativePosition);
+                const float combinedRadius = radius + m_radii[neighbor];
+                const float combinedRadiusSq = combinedRadius * combinedRadius;
+
+                // u is the smallest change of relative velocity leaving the velocity obstacle
+                OrcaLine line;
+                PlanarVector u;
+                if (distanceSq > combinedRadiusSq) {
+                    // Velocity obstacle: a cone truncated by the disk of the positions reached at the time horizon
+                    const PlanarVector w = relativeVelocity - relativePosition * inverseTimeHorizon;
+                    const float wLengthSq = DotProduct(w, w);
+                    const float dotProduct = DotProduct(w, relativePosition);
+
+                    if (dotProduct < 0.0f && dotProduct * dotProduct > combinedRadiusSq * wLengthSq) {
+                        // Closest to the disk
+                        const float wLength = std::sqrt(wLengthSq);
+                        const PlanarVector unitW = w * (1.0f / wLength);
+                        line.direction = {unitW.z, -unitW.x};
+                        u = unitW * (combinedRadius * inverseTimeHorizon - wLength);
+                    } else {
+                        // Closest to a leg of the cone
+                        const float leg = std::sqrt(distanceSq - combinedRadiusSq);
+                        const PlanarVector& p = relativePosition;
+                        if (Determinant(relativePosition, w) > 0.0f) {
+                            // Left leg
+                            line.direction = PlanarVector{p.x * leg - p.z * combinedRadius,
+                                                          p.x * combinedRadius + p.z * leg} *
+                                             (1.0f / distanceSq);
+                        } else {
+                            // Right leg, pointing backward
+                            line.direction = PlanarVector{-p.x * leg - p.z * combinedRadius,
+                                                          p.x * combinedRadius - p.z * leg} *
+                                             (1.0f / distanceSq);
+                        }
+
+                        u = line.direction * DotProduct(relativeVelocity, line.direction) - relativeVelocity;
+                    }
+                } else {
+                    // Already colliding, separated within the step
+                    const PlanarVector w = relativeVelocity - relativePosition * inverseDeltaTime;
+                    const float wLength = std::sqrt(DotProduct(w, w));
+                    // Agents on top of each other with the same velocity are separated along X, in index order
+                    PlanarVector unitW = {(agent < neighbor) ? -1.0f : 1.0f, 0.0f};
+                    if (wLength > 0.0f) {
+                        unitW = w * (1.0f / wLength);
+                    }
+
+                    line.direction = {unitW.z, -unitW.x};
+                    u = unitW * (combinedRadius * inverseDeltaTime - wLength);
+                }
+
+                // Each agent takes half of the effort
+                line.point = velocity + u * 0.5f;
+                lines.push_back(line);
+            }
+
+            const float maxSpeed = m_maxSpeeds[agent];
+            const PlanarVector preferredVelocity = {m_preferredVelocityX[agent], m_preferredVelocityZ[agent]};
+
+            PlanarVector newVelocity;
+            const std::size_t failedLine = SolveLines(lines, maxSpeed, preferredVelocity, false, newVelocity);
+            if (failedLine < lines.size()) {
+                SolveInfeasibleLines(lines, failedLine, maxSpeed, newVelocity);
+            }
+
+            m_newVelocityX[agent] = newVelocity.x;
+            m_newVelocityZ[agent] = newVelocity.z;
+        }
+    }
+} // namespace Fl
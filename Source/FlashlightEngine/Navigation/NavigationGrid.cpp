@@ -0,0 +1,551 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Navigation/NavigationGrid.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr UInt32 LongEntranceLength = 6; //< Openings at least this long get an entrance at each end
+
+        struct ClusterBounds {
+            UInt32 minX;
+            UInt32 minZ;
+            UInt32 maxX; //< Exclusive
+            UInt32 maxZ;
+        };
+
+        ClusterBounds GetClusterBounds(const NavigationGrid::Settings& settings, const UInt32 clusterCountX,
+                                       const UInt32 cluster) {
+            const UInt32 minX = (cluster % clusterCountX) * settings.clusterSize;
+            const UInt32 minZ = (cluster / clusterCountX) * settings.clusterSize;
+            return {minX, minZ, std::min(minX + settings.clusterSize, settings.width),
+                    std::min(minZ + settings.clusterSize, settings.depth)};
+        }
+
+        /**
+         * @brief Gets the length of the shortest 8-connected path between two cells, a lower bound of its cost.
+         */
+        float GetOctileDistance(const UInt32 first, const UInt32 second, const UInt32 width) {
+            const auto dx = static_cast<float>(std::abs(static_cast<Int64>(first % width) - (second % width)));
+            const auto dz = static_cast<float>(std::abs(static_cast<Int64>(first / width) - (second / width)));
+            return std::max(dx, dz) + (std::numbers::sqrt2_v<float> - 1.0f) * std::min(dx, dz);
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    NavigationGrid::NavigationGrid(const Settings& settings, const std::span<const UInt8> cellCosts,
+                                   ThreadPool* threadPool) :
+    m_settings(settings), m_mayShortenPaths(false) {
+        FlAssertMsg(settings.width > 0 && settings.depth > 0, "[Navigation/NavigationGrid] Empty grid.");
+        FlAssertMsg(settings.clusterSize > 0, "[Navigation/NavigationGrid] Invalid cluster size.");
+        FlAssertMsg(cellCosts.empty() || cellCosts.size() == static_cast<std::size_t>(settings.width) * settings.depth,
+                    "[Navigation/NavigationGrid] Cell costs don't match the grid.");
+
+        const std::size_t cellCount = static_cast<std::size_t>(settings.width) * settings.depth;
+        if (cellCosts.empty()) {
+            m_cellCosts.assign(cellCount, 1);
+        } else {
+            m_cellCosts.assign(cellCosts.begin(), cellCosts.end());
+        }
+
+        m_clusterCountX = (settings.width + settings.clusterSize - 1) / settings.clusterSize;
+        m_clusterCountZ = (settings.depth + settings.clusterSize - 1) / settings.clusterSize;
+
+        const std::size_t clusterCount = GetClusterCount();
+        m_clusterEdges.resize(clusterCount);
+        m_dirtyClusters.assign(clusterCount, 1);
+        m_cellEntrances.assign(cellCount, InvalidNode);
+        SetRegionCount(clusterCount);
+
+        Update(threadPool);
+    }
+
+    void NavigationGrid::BuildPath(const std::span<const NodeId> corridor, const Vector3& start, const Vector3& goal,
+                                   std::vector<Vector3>& path) const {
+        FlAssertMsg(!corridor.empty(), "[Navigation/NavigationGrid] Empty corridor.");
+
+        const UInt32 width = m_settings.width;
+        const auto getStep = [&](const NodeId from, const NodeId to) {
+            return std::pair(static_cast<Int64>(to % width) - (from % width),
+                             static_cast<Int64>(to / width) - (from / width));
+        };
+
+        path.clear();
+        path.push_back(start);
+        for (std::size_t i = 1; i + 1 < corridor.size(); ++i) {
+            if (getStep(corridor[i - 1], corridor[i]) != getStep(corridor[i], corridor[i + 1])) {
+                path.push_back(GetCellCenter(corridor[i]));
+            }
+        }
+
+        path.push_back(goal);
+    }
+
+    bool NavigationGrid::FindCorridor(const NodeId start, const NodeId goal, AStarSearch& search,
+                                      std::vector<NodeId>& corridor) const {
+        FlAssertMsg(start < m_cellCosts.size() && goal < m_cellCosts.size(),
+                    "[Navigation/NavigationGrid] Invalid cell.");
+
+        corridor.clear();
+        if (m_cellCosts[start] == BlockedCell || m_cellCosts[goal] == BlockedCell) {
+            return false;
+        }
+
+        if (start == goal) {
+            corridor.push_back(start);
+            return true;
+        }
+
+        // The start and the goal are temporary nodes of the abstract graph, linked to the entrances of their
+        // clusters, and to each other when they share one
+        const RegionId startCluster = GetRegion(start);
+        const RegionId goalCluster = GetRegion(goal);
+        const bool isSameCluster = startCluster == goalCluster;
+
+        std::vector<NodeId> startTargets(GetClusterEntrances(startCluster).begin(),
+                                         GetClusterEntrances(startCluster).end());
+        if (isSameCluster) {
+            startTargets.push_back(goal);
+        }
+
+        std::vector<float> startCosts;
+        std::vector<float> goalCosts;
+        FindClusterCosts(start, search, startTargets, startCosts);
+        FindClusterCosts(goal, search, GetClusterEntrances(goalCluster), goalCosts);
+
+        const auto entranceCount = static_cast<NodeId>(m_entranceCells.size());
+        const NodeId startNode = entranceCount;
+        const NodeId goalNode = entranceCount + 1;
+        const UInt32 firstStartEntrance = m_clusterEntranceOffsets[startCluster];
+        const UInt32 firstGoalEntrance = m_clusterEntranceOffsets[goalCluster];
+
+        const auto getCell = [&](const NodeId node) {
+            return (node == startNode) ? start : ((node == goalNode) ? goal : m_entranceCells[node]);
+        };
+
+        const auto forEachNeighbor = [&](const NodeId node, auto&& visit) {
+            if (node == startNode) {
+                for (std::size_t i = 0; i < startCosts.size(); ++i) {
+                    if (std::isfinite(startCosts[i])) {
+                        const bool isGoal = isSameCluster && i + 1 == startCosts.size();
+                        visit(isGoal ? goalNode : firstStartEntrance + static_cast<NodeId>(i), startCosts[i]);
+                    }
+                }
+
+                return;
+            }
+
+            for (UInt32 edge = m_edgeOffsets[node]; edge < m_edgeOffsets[node + 1]; ++edge) {
+                visit(m_edges[edge].node, m_edges[edge].cost);
+            }
+
+            if (node >= firstGoalEntrance && node - firstGoalEntrance < goalCosts.size()) {
+                const float cost = goalCosts[node - firstGoalEntrance];
+                if (std::isfinite(cost)) {
+                    visit(goalNode, cost);
+                }
+            }
+        };
+
+        const auto heuristic = [&](const NodeId node) {
+            return GetOctileDistance(getCell(node), goal, m_settings.width);
+        };
+
+        if (!search.Search(entranceCount + 2, startNode, goalNode, forEachNeighbor, heuristic)) {
+            return false;
+        }
+
+        std::vector<NodeId> abstractPath;
+        search.GetPath(goalNode, abstractPath);
+
+        // The path is refined in the clusters crossed by the abstract one, free to cross their borders anywhere rather
+        // than at the entrances only: it can't cost more than the abstract path, which goes through them
+        std::vector<RegionId> clusters;
+        for (const NodeId node : abstractPath) {
+            clusters.push_back(GetRegion(getCell(node)));
+        }
+
+        std::sort(clusters.begin(), clusters.end());
+        clusters.erase(std::unique(clusters.begin(), clusters.end()), clusters.end());
+
+        [[maybe_unused]] const bool isFound = FindPathInClusters(start, goal, clusters, search, corridor);
+        FlAssertMsg(isFound, "[Navigation/NavigationGrid] Abstract path without refined path.");
+
+        return true;
+    }
+
+    auto NavigationGrid::FindNode(const Vector3& position) const -> NodeId {
+        const float x = (position.x - m_settings.origin.x) / m_settings.cellSize;
+        const float z = (position.z - m_settings.origin.z) / m_settings.cellSize;
+        if (!(x >= 0.0f && z >= 0.0f && x < static_cast<float>(m_settings.width) &&
+              z < static_cast<float>(m_settings.depth))) {
+            return InvalidNode;
+        }
+
+        const NodeId cell = GetCell(static_cast<UInt32>(x), static_cast<UInt32>(z));
+        return (m_cellCosts[cell] != BlockedCell) ? cell : InvalidNode;
+    }
+
+    Vector3 NavigationGrid::GetCellCenter(const NodeId cell) const {
+        FlAssertMsg(cell < m_cellCosts.size(), "[Navigation/NavigationGrid] Invalid cell.");
+
+        const auto x = static_cast<float>(cell % m_settings.width);
+        const auto z = static_cast<float>(cell / m_settings.width);
+        return {m_settings.origin.x + (x + 0.5f) * m_settings.cellSize, m_settings.origin.y,
+                m_settings.origin.z + (z + 0.5f) * m_settings.cellSize};
+    }
+
+    auto NavigationGrid::GetRegion(const NodeId node) const -> RegionId {
+        const UInt32 x = node % m_settings.width;
+        const UInt32 z = node / m_settings.width;
+        return (z / m_settings.clusterSize) * m_clusterCountX + x / m_settings.clusterSize;
+    }
+
+    void NavigationGrid::SetCellCost(const UInt32 x, const UInt32 z, const UInt8 cost) {
+        const NodeId cell = GetCell(x, z);
+        const UInt8 previousCost = m_cellCosts[cell];
+        if (cost == previousCost) {
+            return;
+        }
+
+        if (cost != BlockedCell && (previousCost == BlockedCell || cost < previousCost)) {
+            m_mayShortenPaths = true;
+        }
+
+        m_cellCosts[cell] = cost;
+        m_dirtyClusters[GetRegion(cell)] = 1;
+    }
+
+    void NavigationGrid::Update(ThreadPool* threadPool) {
+        if (std::find(m_dirtyClusters.begin(), m_dirtyClusters.end(), 1) == m_dirtyClusters.end()) {
+            return;
+        }
+
+        // Entrances only depend on the border cells, finding them all again is cheap
+        std::vector<std::vector<NodeId>> clusterEntrances(GetClusterCount());
+        const std::vector<CellEdge> borderEdges = FindEntrances(clusterEntrances);
+
+        // Paths inside a cluster change with its cells, or with its entrances when a neighbor changed
+        std::vector<RegionId> rebuiltClusters;
+        for (UInt32 cluster = 0; cluster < GetClusterCount(); ++cluster) {
+            const UInt32 x = cluster % m_clusterCountX;
+            const UInt32 z = cluster / m_clusterCountX;
+            const bool isRebuilt = m_dirtyClusters[cluster] || (x > 0 && m_dirtyClusters[cluster - 1]) ||
+                                   (x + 1 < m_clusterCountX && m_dirtyClusters[cluster + 1]) ||
+                                   (z > 0 && m_dirtyClusters[cluster - m_clusterCountX]) ||
+                                   (z + 1 < m_clusterCountZ && m_dirtyClusters[cluster + m_clusterCountX]);
+            if (isRebuilt) {
+                rebuiltClusters.push_back(cluster);
+            }
+        }
+
+        const auto buildClusters = [&](const std::size_t first, const std::size_t last) {
+            AStarSearch search;
+            std::vector<float> costs;
+            for (std::size_t i = first; i < last; ++i) {
+                const RegionId cluster = rebuiltClusters[i];
+                const std::vector<NodeId>& entrances = clusterEntrances[cluster];
+
+                std::vector<CellEdge>& edges = m_clusterEdges[cluster];
+                edges.clear();
+                for (std::size_t from = 0; from + 1 < entrances.size(); ++from) {
+                    const std::span<const NodeId> targets = std::span(entrances).subspan(from + 1);
+                    FindClusterCosts(entrances[from], search, targets, costs);
+
+                    for (std::size_t to = 0; to < targets.size(); ++to) {
+                        if (std::isfinite(costs[to])) {
+                            edges.push_back({entrances[from], targets[to], costs[to]});
+                        }
+                    }
+                }
+            }
+        };
+
+        if (threadPool) {
+            threadPool->ParallelFor(rebuiltClusters.size(), 4, buildClusters);
+        } else {
+            buildClusters(0, rebuiltClusters.size());
+        }
+
+        for (UInt32 cluster = 0; cluster < GetClusterCount(); ++cluster) {
+            if (m_dirtyClusters[cluster]) {
+                InvalidateRegion(cluster, m_mayShortenPaths);
+                m_dirtyClusters[cluster] = 0;
+            }
+        }
+
+        m_mayShortenPaths = false;
+
+        // Abstract graph, edges being stored for both directions
+        for (const NodeId cell : m_entranceCells) {
+            m_cellEntrances[cell] = InvalidNode;
+        }
+
+        m_entranceCells.clear();
+        m_clusterEntranceOffsets.assign(GetClusterCount() + 1, 0);
+        for (std::size_t cluster = 0; cluster < clusterEntrances.size(); ++cluster) {
+            m_clusterEntranceOffsets[cluster] = static_cast<UInt32>(m_entranceCells.size());
+            for (const NodeId cell : clusterEntrances[cluster]) {
+                m_cellEntrances[cell] = static_cast<NodeId>(m_entranceCells.size());
+                m_entranceCells.push_back(cell);
+            }
+        }
+
+        m_clusterEntranceOffsets.back() = static_cast<UInt32>(m_entranceCells.size());
+
+        m_edgeOffsets.assign(m_entranceCells.size() + 1, 0);
+        const auto forEachEdge = [&](auto&& func) {
+            for (const CellEdge& edge : borderEdges) {
+                func(edge);
+            }
+
+            for (const std::vector<CellEdge>& edges : m_clusterEdges) {
+                for (const CellEdge& edge : edges) {
+                    func(edge);
+                }
+            }
+        };
+
+        forEachEdge([&](const CellEdge& edge) {
+            ++m_edgeOffsets[m_cellEntrances[edge.from] + 1];
+            ++m_edgeOffsets[m_cellEntrances[edge.to] + 1];
+        });
+
+        for (std::size_t node = 0; node < m_entranceCells.size(); ++node) {
+            m_edgeOffsets[node + 1] += m_edgeOffsets[node];
+        }
+
+        std::vector<UInt32> edgeCounts(m_entranceCells.size(), 0);
+        m_edges.resize(m_edgeOffsets.back());
+        forEachEdge([&](const CellEdge& edge) {
+            const NodeId from = m_cellEntrances[edge.from];
+            const NodeId to = m_cellEntrances[edge.to];
+            m_edges[m_edgeOffsets[from] + edgeCounts[from]++] = {to, edge.cost};
+            m_edges[m_edgeOffsets[to] + edgeCounts[to]++] = {from, edge.cost};
+        });
+    }
+
+    void NavigationGrid::FindClusterCosts(const NodeId from, AStarSearch& search,
+                                          const std::span<const NodeId> targets, std::vector<float>& costs) const {
+        const RegionId cluster = GetRegion(from);
+        const ClusterBounds bounds = GetClusterBounds(m_settings, m_clusterCountX, cluster);
+        const UInt32 size = m_settings.clusterSize;
+        const UInt32 width = m_settings.width;
+
+        // Cells are searched with identifiers local to the cluster
+        const auto toLocal = [&](const NodeId cell) {
+            return (cell / width - bounds.minZ) * size + (cell % width - bounds.minX);
+        };
+
+        search.Search(
+            static_cast<std::size_t>(size) * size, toLocal(from), AStarSearch::InvalidNode,
+            [&](const NodeId local, auto&& visit) {
+                const UInt32 localZ = local / size;
+                ForEachNeighbor(bounds.minX + local - localZ * size, bounds.minZ + localZ,
+                                [&](const UInt32 neighborX, const UInt32 neighborZ, const float cost) {
+                                    if (neighborX >= bounds.minX && neighborX < bounds.maxX &&
+                                        neighborZ >= bounds.minZ && neighborZ < bounds.maxZ) {
+                                        visit((neighborZ - bounds.minZ) * size + neighborX - bounds.minX, cost);
+                                    }
+                                });
+            },
+            [](NodeId) { return 0.0f; });
+
+        costs.resize(targets.size());
+        for (std::size_t i = 0; i < targets.size(); ++i) {
+            costs[i] = search.GetCost(toLocal(targets[i]));
+        }
+    }
+
+    std::vector<NavigationGrid::CellEdge> NavigationGrid::FindEntrances(
+        std::vector<std::vector<NodeId>>& clusterEntrances) const {
+        std::vector<CellEdge> edges;
+
+        // Walks the cells along a border, cellA and cellB giving the cells on each side at a position
+        const auto addEntrances = [&](const RegionId clusterA, const RegionId clusterB, const UInt32 length,
+                                      auto&& getCellA, auto&& getCellB) {
+            const auto isOpen = [&](const UInt32 position) {
+                return m_cellCosts[getCellA(position)] != BlockedCell && m_cellCosts[getCellB(position)] != BlockedCell;
+            };
+
+            const auto addEntrance = [&](const UInt32 position) {
+                const NodeId cellA = getCellA(position);
+                const NodeId cellB = getCellB(position);
+                clusterEntrances[clusterA].push_back(cellA);
+                clusterEntrances[clusterB].push_back(cellB);
+                edges.push_back({cellA, cellB, 0.5f * (m_cellCosts[cellA] + m_cellCosts[cellB])});
+            };
+
+            for (UInt32 first = 0; first < length;) {
+                if (!isOpen(first)) {
+                    ++first;
+                    continue;
+                }
+
+                UInt32 last = first;
+                while (last + 1 < length && isOpen(last + 1)) {
+                    ++last;
+                }
+
+                if (last - first + 1 < LongEntranceLength) {
+                    addEntrance((first + last) / 2);
+                } else {
+                    addEntrance(first);
+                    addEntrance(last);
+                }
+
+                first = last + 1;
+            }
+        };
+
+        for (UInt32 cluster = 0; cluster < GetClusterCount(); ++cluster) {
+            const ClusterBounds bounds = GetClusterBounds(m_settings, m_clusterCountX, cluster);
+
+            if (cluster % m_clusterCountX + 1 < m_clusterCountX) {
+                addEntrances(cluster, cluster + 1, bounds.maxZ - bounds.minZ,
+                             [&](const UInt32 position) { return GetCell(bounds.maxX - 1, bounds.minZ + position); },
+                             [&](const UInt32 position) { return GetCell(bounds.maxX, bounds.minZ + position); });
+            }
+
+            if (cluster / m_clusterCountX + 1 < m_clusterCountZ) {
+                addEntrances(cluster, cluster + m_clusterCountX, bounds.maxX - bounds.minX,
+                             [&](const UInt32 position) { return GetCell(bounds.minX + position, bounds.maxZ - 1); },
+                             [&](const UInt32 position) { return GetCell(bounds.minX + position, bounds.maxZ); });
+            }
+        }
+
+        for (std::vector<NodeId>& entrances : clusterEntrances) {
+            std::sort(entrances.begin(), entrances.end());
+            entrances.erase(std::unique(entrances.begin(), entrances.end()), entrances.end());
+        }
+
+        return edges;
+    }
+
+    bool NavigationGrid::FindPathInClusters(const NodeId from, const NodeId to,
+                                            const std::span<const RegionId> clusters, AStarSearch& search,
+                                            std::vector<NodeId>& cells) const {
+        const UInt32 size = m_settings.clusterSize;
+        const UInt32 width = m_settings.width;
+        const UInt32 clusterCellCount = size * size;
+
+        // Cells are searched with identifiers local to the clusters, in their order, which neighbors reach from
+        // the local coordinates without dividing
+        std::vector<UInt32> clusterIndices(GetClusterCount(), InvalidNode);
+        for (std::size_t i = 0; i < clusters.size(); ++i) {
+            clusterIndices[clusters[i]] = static_cast<UInt32>(i);
+        }
+
+        struct LocalCell {
+            UInt32 index;
+            UInt32 x;
+            UInt32 z;
+        };
+
+        const auto toLocal = [&](const NodeId cell) {
+            const UInt32 x = cell % width;
+            const UInt32 z = cell / width;
+            return clusterIndices[GetRegion(cell)] * clusterCellCount + (z % size) * size + x % size;
+        };
+        const auto decode = [&](const NodeId local) {
+            const UInt32 index = local / clusterCellCount;
+            const UInt32 clusterLocal = local - index * clusterCellCount;
+            const UInt32 z = clusterLocal / size;
+            return LocalCell{index, clusterLocal - z * size, z};
+        };
+        const auto getCoordinates = [&](const LocalCell& localCell) {
+            const RegionId cluster = clusters[localCell.index];
+            return std::pair((cluster % m_clusterCountX) * size + localCell.x,
+                             (cluster / m_clusterCountX) * size + localCell.z);
+        };
+
+        const auto goalX = static_cast<Int64>(to % width);
+        const auto goalZ = static_cast<Int64>(to / width);
+
+        const bool isFound = search.Search(
+            clusters.size() * clusterCellCount, toLocal(from), toLocal(to),
+            [&](const NodeId local, auto&& visit) {
+                const LocalCell localCell = decode(local);
+                const auto [x, z] = getCoordinates(localCell);
+                const RegionId cluster = clusters[localCell.index];
+
+                ForEachNeighbor(x, z, [&](const UInt32 neighborX, const UInt32 neighborZ, const float cost) {
+                    UInt32 neighborLocalX = localCell.x + (neighborX - x);
+                    UInt32 neighborLocalZ = localCell.z + (neighborZ - z);
+                    RegionId neighborCluster = cluster;
+
+                    // Wrapped below zero, or past the cluster size, when stepping into a neighboring cluster
+                    if (neighborLocalX >= size) {
+                        neighborCluster = (neighborX > x) ? neighborCluster + 1 : neighborCluster - 1;
+                        neighborLocalX = (neighborX > x) ? 0 : size - 1;
+                    }
+
+                    if (neighborLocalZ >= size) {
+                        neighborCluster = (neighborZ > z) ? neighborCluster + m_clusterCountX
+                                                         : neighborCluster - m_clusterCountX;
+                        neighborLocalZ = (neighborZ > z) ? 0 : size - 1;
+                    }
+
+                    const UInt32 neighborIndex = clusterIndices[neighborCluster];
+                    if (neighborIndex != InvalidNode) {
+                        visit(neighborIndex * clusterCellCount + neighborLocalZ * size + neighborLocalX, cost);
+                    }
+                });
+            },
+            [&](const NodeId local) {
+                const auto [x, z] = getCoordinates(decode(local));
+                const auto dx = static_cast<float>(std::abs(static_cast<Int64>(x) - goalX));
+                const auto dz = static_cast<float>(std::abs(static_cast<Int64>(z) - goalZ));
+                return std::max(dx, dz) + (std::numbers::sqrt2_v<float> - 1.0f) * std::min(dx, dz);
+            });
+
+        if (!isFound) {
+            return false;
+        }
+
+        search.GetPath(toLocal(to), cells);
+        for (NodeId& cell : cells) {
+            const auto [x, z] = getCoordinates(decode(cell));
+            cell = GetCell(x, z);
+        }
+
+        return true;
+    }
+
+    template <typename F>
+    void NavigationGrid::ForEachNeighbor(const UInt32 x, const UInt32 z, F&& func) const {
+        const UInt32 cell = GetCell(x, z);
+        const auto isWalkable = [&](const UInt32 neighborX, const UInt32 neighborZ) {
+            return m_cellCosts[GetCell(neighborX, neighborZ)] != BlockedCell;
+        };
+
+        for (Int32 dz = -1; dz <= 1; ++dz) {
+            for (Int32 dx = -1; dx <= 1; ++dx) {
+                const UInt32 neighborX = x + static_cast<UInt32>(dx);
+                const UInt32 neighborZ = z + static_cast<UInt32>(dz);
+                if ((dx == 0 && dz == 0) || neighborX >= m_settings.width || neighborZ >= m_settings.depth ||
+                    !isWalkable(neighborX, neighborZ)) {
+                    continue;
+                }
+
+                // Diagonal steps don't cut corners
+                const bool isDiagonal = dx != 0 && dz != 0;
+                if (isDiagonal && (!isWalkable(neighborX, z) || !isWalkable(x, neighborZ))) {
+                    continue;
+                }
+
+                const NodeId neighbor = GetCell(neighborX, neighborZ);
+                const float length = isDiagonal ? std::numbers::sqrt2_v<float> : 1.0f;
+                func(neighborX, neighborZ, length * 0.5f * (m_cellCosts[cell] + m_cellCosts[neighbor]));
+            }
+        }
+    }
+} // namespace Fl
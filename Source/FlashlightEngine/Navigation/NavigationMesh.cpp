@@ -0,0 +1,346 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Navigation/NavigationMesh.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        /**
+         * @brief Computes the vertical component of the cross product, positive when second is counter-clockwise
+         *        from first seen from above.
+         */
+        float Cross2(const Vector3& first, const Vector3& second) {
+            return first.z * second.x - first.x * second.z;
+        }
+
+        bool AreEqual(const Vector3& first, const Vector3& second) {
+            constexpr float SquaredTolerance = 1e-6f * 1e-6f;
+            return (first - second).GetSquaredLength() < SquaredTolerance;
+        }
+
+        struct HalfEdge {
+            UInt64 key; //< Lower then higher vertex index
+            UInt32 polygon;
+            UInt32 from;
+            UInt32 to;
+        };
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    NavigationMesh::NavigationMesh(const std::span<const Vector3> vertices, const std::span<const UInt32> indices,
+                                   const std::span<const UInt32> polygonSizes) :
+    m_vertices(vertices.begin(), vertices.end()), m_indices(indices.begin(), indices.end()) {
+        FlAssertMsg(!polygonSizes.empty(), "[Navigation/NavigationMesh] Mesh without polygon.");
+
+        m_polygons.reserve(polygonSizes.size());
+        std::vector<HalfEdge> halfEdges;
+        halfEdges.reserve(indices.size());
+
+        UInt32 firstIndex = 0;
+        for (const UInt32 size : polygonSizes) {
+            FlAssertMsg(size >= 3 && firstIndex + size <= indices.size(),
+                        "[Navigation/NavigationMesh] Invalid polygon size.");
+
+            const auto polygon = static_cast<NodeId>(m_polygons.size());
+            Vector3 center = Vector3::Zero();
+            for (UInt32 i = 0; i < size; ++i) {
+                const UInt32 from = indices[firstIndex + i];
+                const UInt32 to = indices[firstIndex + (i + 1) % size];
+                FlAssertMsg(from < vertices.size(), "[Navigation/NavigationMesh] Invalid vertex index.");
+
+                center += vertices[from];
+                halfEdges.push_back({(static_cast<UInt64>(std::min(from, to)) << 32) | std::max(from, to), polygon,
+                                     from, to});
+            }
+
+            m_polygons.push_back({center / static_cast<float>(size), 1.0f, firstIndex, size, 0, 0});
+            firstIndex += size;
+        }
+
+        FlAssertMsg(firstIndex == indices.size(), "[Navigation/NavigationMesh] Polygon sizes don't match the indices.");
+
+        // Polygons sharing an edge hold the same key, leaving a polygon through its edge from -> to means having
+        // from on the right
+        std::sort(halfEdges.begin(), halfEdges.end(), [](const HalfEdge& lhs, const HalfEdge& rhs) {
+            return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.polygon < rhs.polygon);
+        });
+
+        std::vector<std::pair<NodeId, Link>> links;
+        for (std::size_t first = 0; first < halfEdges.size();) {
+            std::size_t last = first + 1;
+            while (last < halfEdges.size() && halfEdges[last].key == halfEdges[first].key) {
+                ++last;
+            }
+
+            for (std::size_t i = first; i < last; ++i) {
+                for (std::size_t j = first; j < last; ++j) {
+                    const HalfEdge& from = halfEdges[i];
+                    const HalfEdge& to = halfEdges[j];
+                    if (from.polygon == to.polygon) {
+                        continue;
+                    }
+
+                    const Vector3 middle = (vertices[from.from] + vertices[from.to]) * 0.5f;
+                    links.emplace_back(from.polygon,
+                                       Link{to.polygon, from.to, from.from,
+                                            (middle - m_polygons[from.polygon].center).GetLength(),
+                                            (m_polygons[to.polygon].center - middle).GetLength()});
+                }
+            }
+
+            first = last;
+        }
+
+        std::stable_sort(links.begin(), links.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        m_links.reserve(links.size());
+        for (const auto& [polygon, link] : links) {
+            if (m_polygons[polygon].linkCount++ == 0) {
+                m_polygons[polygon].firstLink = static_cast<UInt32>(m_links.size());
+            }
+
+            m_links.push_back(link);
+        }
+
+        // Buckets of about one polygon each
+        float maxX = vertices[indices[0]].x;
+        float maxZ = vertices[indices[0]].z;
+        m_bucketMinX = maxX;
+        m_bucketMinZ = maxZ;
+        for (const UInt32 index : indices) {
+            m_bucketMinX = std::min(m_bucketMinX, vertices[index].x);
+            m_bucketMinZ = std::min(m_bucketMinZ, vertices[index].z);
+            maxX = std::max(maxX, vertices[index].x);
+            maxZ = std::max(maxZ, vertices[index].z);
+        }
+
+        m_bucketCountX = static_cast<UInt32>(std::ceil(std::sqrt(static_cast<float>(m_polygons.size()))));
+        m_bucketCountZ = m_bucketCountX;
+        m_bucketSizeX = std::max((maxX - m_bucketMinX) / static_cast<float>(m_bucketCountX), 1e-3f);
+        m_bucketSizeZ = std::max((maxZ - m_bucketMinZ) / static_cast<float>(m_bucketCountZ), 1e-3f);
+
+        const auto forEachBucket = [&](const Polygon& polygon, auto&& func) {
+            float minPolygonX = std::numeric_limits<float>::max();
+            float minPolygonZ = std::numeric_limits<float>::max();
+            float maxPolygonX = std::numeric_limits<float>::lowest();
+            float maxPolygonZ = std::numeric_limits<float>::lowest();
+            for (UInt32 i = 0; i < polygon.indexCount; ++i) {
+                const Vector3& vertex = vertices[indices[polygon.firstIndex + i]];
+                minPolygonX = std::min(minPolygonX, vertex.x);
+                minPolygonZ = std::min(minPolygonZ, vertex.z);
+                maxPolygonX = std::max(maxPolygonX, vertex.x);
+                maxPolygonZ = std::max(maxPolygonZ, vertex.z);
+            }
+
+            const auto getBucket = [](const float value, const float min, const float size, const UInt32 count) {
+                return std::min(static_cast<UInt32>(std::max((value - min) / size, 0.0f)), count - 1);
+            };
+
+            const UInt32 firstX = getBucket(minPolygonX, m_bucketMinX, m_bucketSizeX, m_bucketCountX);
+            const UInt32 lastX = getBucket(maxPolygonX, m_bucketMinX, m_bucketSizeX, m_bucketCountX);
+            const UInt32 firstZ = getBucket(minPolygonZ, m_bucketMinZ, m_bucketSizeZ, m_bucketCountZ);
+            const UInt32 lastZ = getBucket(maxPolygonZ, m_bucketMinZ, m_bucketSizeZ, m_bucketCountZ);
+            for (UInt32 z = firstZ; z <= lastZ; ++z) {
+                for (UInt32 x = firstX; x <= lastX; ++x) {
+                    func(z * m_bucketCountX + x);
+                }
+            }
+        };
+
+        m_bucketOffsets.assign(static_cast<std::size_t>(m_bucketCountX) * m_bucketCountZ + 1, 0);
+        for (const Polygon& polygon : m_polygons) {
+            forEachBucket(polygon, [&](const UInt32 bucket) { ++m_bucketOffsets[bucket + 1]; });
+        }
+
+        for (std::size_t bucket = 1; bucket < m_bucketOffsets.size(); ++bucket) {
+            m_bucketOffsets[bucket] += m_bucketOffsets[bucket - 1];
+        }
+
+        std::vector<UInt32> bucketCounts(m_bucketOffsets.size() - 1, 0);
+        m_bucketPolygons.resize(m_bucketOffsets.back());
+        for (NodeId polygon = 0; polygon < m_polygons.size(); ++polygon) {
+            forEachBucket(m_polygons[polygon], [&](const UInt32 bucket) {
+                m_bucketPolygons[m_bucketOffsets[bucket] + bucketCounts[bucket]++] = polygon;
+            });
+        }
+
+        SetRegionCount(m_polygons.size());
+    }
+
+    void NavigationMesh::BuildPath(const std::span<const NodeId> corridor, const Vector3& start, const Vector3& goal,
+                                   std::vector<Vector3>& path) const {
+        FlAssertMsg(!corridor.empty(), "[Navigation/NavigationMesh] Empty corridor.");
+
+        path.clear();
+        path.push_back(start);
+
+        // Edges crossed by the corridor, between the start and the goal seen as edges of null length
+        const auto getPortal = [&](const std::size_t index) -> std::pair<Vector3, Vector3> {
+            if (index == 0) {
+                return {start, start};
+            }
+
+            if (index == corridor.size()) {
+                return {goal, goal};
+            }
+
+            const Polygon& polygon = m_polygons[corridor[index - 1]];
+            for (UInt32 i = 0; i < polygon.linkCount; ++i) {
+                const Link& link = m_links[polygon.firstLink + i];
+                if (link.polygon == corridor[index]) {
+                    return {m_vertices[link.leftVertex], m_vertices[link.rightVertex]};
+                }
+            }
+
+            FlAssertMsg(false, "[Navigation/NavigationMesh] Corridor polygons aren't linked.");
+            return {goal, goal};
+        };
+
+        // The funnel narrows while the portals stay between its sides; once a side crosses the other, its end
+        // becomes a corner of the path and the funnel restarts from there
+        Vector3 apex = start;
+        Vector3 left = start;
+        Vector3 right = start;
+        std::size_t apexIndex = 0;
+        std::size_t leftIndex = 0;
+        std::size_t rightIndex = 0;
+
+        const auto addCorner = [&](const Vector3& corner, const std::size_t cornerIndex) {
+            if (!AreEqual(path.back(), corner)) {
+                path.push_back(corner);
+            }
+
+            apex = corner;
+            left = corner;
+            right = corner;
+            apexIndex = cornerIndex;
+            leftIndex = cornerIndex;
+            rightIndex = cornerIndex;
+        };
+
+        for (std::size_t i = 1; i <= corridor.size(); ++i) {
+            const auto [portalLeft, portalRight] = getPortal(i);
+
+            // Right side, narrowing when the new point is counter-clockwise from it
+            if (Cross2(right - apex, portalRight - apex) >= 0.0f) {
+                if (AreEqual(apex, right) || Cross2(left - apex, portalRight - apex) < 0.0f) {
+                    right = portalRight;
+                    rightIndex = i;
+                } else {
+                    addCorner(left, leftIndex);
+                    i = apexIndex;
+                    continue;
+                }
+            }
+
+            // Left side, narrowing when the new point is clockwise from it
+            if (Cross2(left - apex, portalLeft - apex) <= 0.0f) {
+                if (AreEqual(apex, left) || Cross2(right - apex, portalLeft - apex) > 0.0f) {
+                    left = portalLeft;
+                    leftIndex = i;
+                } else {
+                    addCorner(right, rightIndex);
+                    i = apexIndex;
+                    continue;
+                }
+            }
+        }
+
+        if (!AreEqual(path.back(), goal) || path.size() == 1) {
+            path.push_back(goal);
+        }
+    }
+
+    bool NavigationMesh::FindCorridor(const NodeId start, const NodeId goal, AStarSearch& search,
+                                      std::vector<NodeId>& corridor) const {
+        FlAssertMsg(start < m_polygons.size() && goal < m_polygons.size(),
+                    "[Navigation/NavigationMesh] Invalid polygon.");
+
+        corridor.clear();
+        if (!std::isfinite(m_polygons[start].cost) || !std::isfinite(m_polygons[goal].cost)) {
+            return false;
+        }
+
+        const Vector3& goalCenter = m_polygons[goal].center;
+        const auto forEachNeighbor = [&](const NodeId node, auto&& visit) {
+            const Polygon& polygon = m_polygons[node];
+            for (UInt32 i = 0; i < polygon.linkCount; ++i) {
+                const Link& link = m_links[polygon.firstLink + i];
+                const float neighborCost = m_polygons[link.polygon].cost;
+                if (std::isfinite(neighborCost)) {
+                    visit(link.polygon, link.fromDistance * polygon.cost + link.toDistance * neighborCost);
+                }
+            }
+        };
+
+        const auto heuristic = [&](const NodeId node) { return (goalCenter - m_polygons[node].center).GetLength(); };
+
+        if (!search.Search(m_polygons.size(), start, goal, forEachNeighbor, heuristic)) {
+            return false;
+        }
+
+        search.GetPath(goal, corridor);
+        return true;
+    }
+
+    auto NavigationMesh::FindNode(const Vector3& position) const -> NodeId {
+        const float x = (position.x - m_bucketMinX) / m_bucketSizeX;
+        const float z = (position.z - m_bucketMinZ) / m_bucketSizeZ;
+        if (!(x >= 0.0f && z >= 0.0f && x <= static_cast<float>(m_bucketCountX) &&
+              z <= static_cast<float>(m_bucketCountZ))) {
+            return InvalidNode;
+        }
+
+        const UInt32 bucket = std::min(static_cast<UInt32>(z), m_bucketCountZ - 1) * m_bucketCountX +
+                              std::min(static_cast<UInt32>(x), m_bucketCountX - 1);
+
+        NodeId bestPolygon = InvalidNode;
+        float bestDistance = std::numeric_limits<float>::infinity();
+        for (UInt32 i = m_bucketOffsets[bucket]; i < m_bucketOffsets[bucket + 1]; ++i) {
+            const NodeId polygon = m_bucketPolygons[i];
+            const float distance = std::abs(position.y - m_polygons[polygon].center.y);
+            if (distance < bestDistance && ContainsPoint(m_polygons[polygon], position)) {
+                bestPolygon = polygon;
+                bestDistance = distance;
+            }
+        }
+
+        return bestPolygon;
+    }
+
+    auto NavigationMesh::GetRegion(const NodeId node) const -> RegionId {
+        return node;
+    }
+
+    void NavigationMesh::SetPolygonCost(const NodeId polygon, const float cost) {
+        FlAssertMsg(polygon < m_polygons.size(), "[Navigation/NavigationMesh] Invalid polygon.");
+        FlAssertMsg(cost >= 1.0f, "[Navigation/NavigationMesh] Polygon costs must be at least 1.");
+
+        const float previousCost = m_polygons[polygon].cost;
+        if (cost != previousCost) {
+            m_polygons[polygon].cost = cost;
+            InvalidateRegion(polygon, cost < previousCost);
+        }
+    }
+
+    bool NavigationMesh::ContainsPoint(const Polygon& polygon, const Vector3& position) const {
+        constexpr float Tolerance = 1e-5f;
+
+        for (UInt32 i = 0; i < polygon.indexCount; ++i) {
+            const Vector3& from = m_vertices[m_indices[polygon.firstIndex + i]];
+            const Vector3& to = m_vertices[m_indices[polygon.firstIndex + (i + 1) % polygon.indexCount]];
+            if (Cross2(to - from, position - from) < -Tolerance) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+} // namespace Fl
@@ -0,0 +1,218 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Navigation/PathfindingService.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    PathfindingService::PathfindingService(const NavigationGraph& graph) :
+    PathfindingService(graph, Settings{}) {}
+
+    PathfindingService::PathfindingService(const NavigationGraph& graph, const Settings& settings) :
+    m_graph(graph), m_settings(settings), m_statistics(), m_nextRequest(InvalidRequest + 1),
+    m_pendingRequestCount(0) {}
+
+    void PathfindingService::CancelRequest(const RequestId request) {
+        const auto it = m_requests.find(request);
+        if (it == m_requests.end()) {
+            return;
+        }
+
+        if (it->second.status == PathStatus::Pending) {
+            --m_pendingRequestCount;
+        }
+
+        m_requests.erase(it);
+    }
+
+    void PathfindingService::ClearCache() {
+        m_cache.clear();
+        m_cacheUseOrder.clear();
+    }
+
+    auto PathfindingService::PollPath(const RequestId request, std::vector<Vector3>& path) -> PathStatus {
+        const auto it = m_requests.find(request);
+        if (it == m_requests.end()) {
+            return PathStatus::Unknown;
+        }
+
+        const PathStatus status = it->second.status;
+        if (status == PathStatus::Pending) {
+            return status;
+        }
+
+        if (status == PathStatus::Found) {
+            path = std::move(it->second.path);
+        }
+
+        m_requests.erase(it);
+        return status;
+    }
+
+    auto PathfindingService::RequestPath(const Vector3& start, const Vector3& goal) -> RequestId {
+        const RequestId request = m_nextRequest++;
+        m_requests.emplace(request, Request{start, goal, {}, PathStatus::Pending});
+        m_pendingRequests.push_back(request);
+        ++m_pendingRequestCount;
+
+        return request;
+    }
+
+    void PathfindingService::Update(const Clock::duration timeBudget, ThreadPool* threadPool) {
+        const Clock clock;
+
+        m_statistics = {};
+
+        const std::size_t threadCount = threadPool ? threadPool->GetWorkerCount() + 1 : 1;
+        if (m_searchStates.size() < threadCount) {
+            m_searchStates.resize(threadCount);
+        }
+
+        while (!m_pendingRequests.empty()) {
+            // Requests without walkable ends or with a cached corridor are answered right away
+            std::size_t searchCount = 0;
+            while (!m_pendingRequests.empty() && searchCount < threadCount * BatchSize) {
+                const auto it = m_requests.find(m_pendingRequests.front());
+                m_pendingRequests.pop_front();
+                if (it == m_requests.end()) {
+                    continue;
+                }
+
+                Request& request = it->second;
+                --m_pendingRequestCount;
+                ++m_statistics.requestCount;
+
+                const NodeId start = m_graph.FindNode(request.start);
+                const NodeId goal = m_graph.FindNode(request.goal);
+                if (start == NavigationGraph::InvalidNode || goal == NavigationGraph::InvalidNode) {
+                    request.status = PathStatus::NotFound;
+                    ++m_statistics.failedRequestCount;
+                    continue;
+                }
+
+                const UInt64 key = (static_cast<UInt64>(start) << 32) | goal;
+                if (const std::vector<NodeId>* corridor = FindCachedCorridor(key)) {
+                    m_graph.BuildPath(*corridor, request.start, request.goal, request.path);
+                    request.status = PathStatus::Found;
+                    ++m_statistics.cacheHitCount;
+                    continue;
+                }
+
+                if (m_searches.size() <= searchCount) {
+                    m_searches.emplace_back();
+                }
+
+                Search& search = m_searches[searchCount++];
+                search.request = &request;
+                search.key = key;
+                search.start = start;
+                search.goal = goal;
+            }
+
+            // Each batch is searched by a single thread, with its own search state
+            const auto searchBatches = [&](const std::size_t firstBatch, const std::size_t lastBatch) {
+                for (std::size_t batch = firstBatch; batch < lastBatch; ++batch) {
+                    AStarSearch& searchState = m_searchStates[batch];
+
+                    const std::size_t last = std::min((batch + 1) * BatchSize, searchCount);
+                    for (std::size_t i = batch * BatchSize; i < last; ++i) {
+                        Search& search = m_searches[i];
+                        search.isFound = m_graph.FindCorridor(search.start, search.goal, searchState, search.corridor);
+                        if (search.isFound) {
+                            m_graph.BuildPath(search.corridor, search.request->start, search.request->goal,
+                                              search.request->path);
+                        }
+                    }
+                }
+            };
+
+            const std::size_t batchCount = (searchCount + BatchSize - 1) / BatchSize;
+            if (threadPool && batchCount > 1) {
+                threadPool->ParallelFor(batchCount, 1, searchBatches);
+            } else {
+                searchBatches(0, batchCount);
+            }
+
+            for (std::size_t i = 0; i < searchCount; ++i) {
+                const Search& search = m_searches[i];
+                if (search.isFound) {
+                    search.request->status = PathStatus::Found;
+                    AddCachedCorridor(search.key, search.corridor);
+                } else {
+                    search.request->status = PathStatus::NotFound;
+                    ++m_statistics.failedRequestCount;
+                }
+            }
+
+            if (clock.GetElapsedTime() >= timeBudget) {
+                break;
+            }
+        }
+
+        m_statistics.updateTime = clock.GetElapsedTime();
+    }
+
+    void PathfindingService::AddCachedCorridor(const UInt64 key, const std::span<const NodeId> corridor) {
+        if (m_settings.cacheCapacity == 0) {
+            return;
+        }
+
+        const auto [it, isInserted] = m_cache.try_emplace(key);
+        CachedCorridor& cachedCorridor = it->second;
+        if (isInserted) {
+            m_cacheUseOrder.push_front(key);
+            cachedCorridor.usePosition = m_cacheUseOrder.begin();
+        } else {
+            m_cacheUseOrder.splice(m_cacheUseOrder.begin(), m_cacheUseOrder, cachedCorridor.usePosition);
+        }
+
+        cachedCorridor.nodes.assign(corridor.begin(), corridor.end());
+        cachedCorridor.graphVersion = m_graph.GetVersion();
+
+        // Consecutive nodes are often in the same region
+        std::vector<std::pair<RegionId, UInt64>>& regionVersions = cachedCorridor.regionVersions;
+        regionVersions.clear();
+        for (const NodeId node : corridor) {
+            const RegionId region = m_graph.GetRegion(node);
+            if (regionVersions.empty() || regionVersions.back().first != region) {
+                regionVersions.emplace_back(region, m_graph.GetRegionVersion(region));
+            }
+        }
+
+        std::sort(regionVersions.begin(), regionVersions.end());
+        regionVersions.erase(std::unique(regionVersions.begin(), regionVersions.end()), regionVersions.end());
+
+        if (m_cache.size() > m_settings.cacheCapacity) {
+            m_cache.erase(m_cacheUseOrder.back());
+            m_cacheUseOrder.pop_back();
+        }
+    }
+
+    auto PathfindingService::FindCachedCorridor(const UInt64 key) -> const std::vector<NodeId>* {
+        const auto it = m_cache.find(key);
+        if (it == m_cache.end()) {
+            return nullptr;
+        }
+
+        CachedCorridor& cachedCorridor = it->second;
+        const bool isValid = cachedCorridor.graphVersion == m_graph.GetVersion() &&
+                             std::all_of(cachedCorridor.regionVersions.begin(), cachedCorridor.regionVersions.end(),
+                                         [&](const std::pair<RegionId, UInt64>& regionVersion) {
+                                             return m_graph.GetRegionVersion(regionVersion.first) ==
+                                                    regionVersion.second;
+                                         });
+        if (!isValid) {
+            m_cacheUseOrder.erase(cachedCorridor.usePosition);
+            m_cache.erase(it);
+            return nullptr;
+        }
+
+        m_cacheUseOrder.splice(m_cacheUseOrder.begin(), m_cacheUseOrder, cachedCorridor.usePosition);
+        return &cachedCorridor.nodes;
+    }
+} // namespace Fl
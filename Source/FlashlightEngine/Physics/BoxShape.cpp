@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/BoxShape.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <cmath>
+
+namespace Fl {
+    BoxShape::BoxShape(const Vector3& halfExtents) :
+    Shape(GetInfo<BoxShape>().id),
+    m_halfExtents(halfExtents) {
+        FlAssertMsg(halfExtents.x > 0.f && halfExtents.y > 0.f && halfExtents.z > 0.f,
+                    "[Physics/BoxShape] Half extents must be positive.");
+    }
+
+    Aabb BoxShape::ComputeBounds(const Vector3& position, const Quaternion& rotation) const {
+        // Extents of the rotated box: absolute rotation matrix times the half extents
+        const Vector3 axisX = rotation * Vector3(m_halfExtents.x, 0.f, 0.f);
+        const Vector3 axisY = rotation * Vector3(0.f, m_halfExtents.y, 0.f);
+        const Vector3 axisZ = rotation * Vector3(0.f, 0.f, m_halfExtents.z);
+
+        const Vector3 extents(std::abs(axisX.x) + std::abs(axisY.x) + std::abs(axisZ.x),
+                              std::abs(axisX.y) + std::abs(axisY.y) + std::abs(axisZ.y),
+                              std::abs(axisX.z) + std::abs(axisY.z) + std::abs(axisZ.z));
+
+        return Aabb::FromCenterExtents(position, extents);
+    }
+} // namespace Fl
@@ -0,0 +1,62 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/Broadphase.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    const Aabb& Broadphase::GetProxyBounds(const ProxyId proxy) const {
+        FlAssertMsg(IsValid(proxy), "[Physics/Broadphase] Invalid proxy.");
+
+        return m_proxyBounds[proxy];
+    }
+
+    std::size_t Broadphase::GetProxyCount() const {
+        return m_validProxies.size() - m_freeProxies.size() - m_destroyedProxies.size();
+    }
+
+    UInt64 Broadphase::GetUserData(const ProxyId proxy) const {
+        FlAssertMsg(IsValid(proxy), "[Physics/Broadphase] Invalid proxy.");
+
+        return m_userData[proxy];
+    }
+
+    bool Broadphase::IsValid(const ProxyId proxy) const {
+        return proxy < m_validProxies.size() && m_validProxies[proxy];
+    }
+
+    auto Broadphase::AllocateProxy(const Aabb& bounds, const UInt64 userData) -> ProxyId {
+        FlAssertMsg(bounds.IsValid(), "[Physics/Broadphase] Invalid proxy bounds.");
+
+        ProxyId proxy;
+        if (!m_freeProxies.empty()) {
+            proxy = m_freeProxies.back();
+            m_freeProxies.pop_back();
+        } else {
+            proxy = static_cast<ProxyId>(m_validProxies.size());
+            m_proxyBounds.emplace_back();
+            m_userData.emplace_back();
+            m_validProxies.emplace_back();
+        }
+
+        m_proxyBounds[proxy] = bounds;
+        m_userData[proxy] = userData;
+        m_validProxies[proxy] = 1;
+
+        return proxy;
+    }
+
+    void Broadphase::FreeProxy(const ProxyId proxy) {
+        FlAssertMsg(IsValid(proxy), "[Physics/Broadphase] Invalid proxy.");
+
+        m_validProxies[proxy] = 0;
+        m_destroyedProxies.push_back(proxy);
+    }
+
+    void Broadphase::RecycleProxies() {
+        m_freeProxies.insert(m_freeProxies.end(), m_destroyedProxies.begin(), m_destroyedProxies.end());
+        m_destroyedProxies.clear();
+    }
+} // namespace Fl
@@ -0,0 +1,25 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/CapsuleShape.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    CapsuleShape::CapsuleShape(const float halfHeight, const float radius) :
+    Shape(GetInfo<CapsuleShape>().id),
+    m_halfHeight(halfHeight),
+    m_radius(radius) {
+        FlAssertMsg(halfHeight >= 0.f, "[Physics/CapsuleShape] Half height must be positive.");
+        FlAssertMsg(radius > 0.f, "[Physics/CapsuleShape] Radius must be positive.");
+    }
+
+    Aabb CapsuleShape::ComputeBounds(const Vector3& position, const Quaternion& rotation) const {
+        const Vector3 axis = rotation * Vector3(0.f, m_halfHeight, 0.f);
+        const Vector3 start = position - axis;
+        const Vector3 end = position + axis;
+
+        return {Vector3::Min(start, end) - Vector3(m_radius), Vector3::Max(start, end) + Vector3(m_radius)};
+    }
+} // namespace Fl
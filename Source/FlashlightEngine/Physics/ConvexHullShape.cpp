@@ -0,0 +1,24 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/ConvexHullShape.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    ConvexHullShape::ConvexHullShape(const std::span<const Vector3> points) :
+    Shape(GetInfo<ConvexHullShape>().id),
+    m_points(points.begin(), points.end()) {
+        FlAssertMsg(m_points.size() >= 4, "[Physics/ConvexHullShape] A hull needs at least four points.");
+    }
+
+    Aabb ConvexHullShape::ComputeBounds(const Vector3& position, const Quaternion& rotation) const {
+        Aabb bounds = Aabb::Empty();
+        for (const Vector3& point : m_points) {
+            bounds.Merge(position + rotation * point);
+        }
+
+        return bounds;
+    }
+} // namespace Fl
@@ -0,0 +1,307 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/DynamicTreeBroadphase.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    DynamicTreeBroadphase::DynamicTreeBroadphase(const float margin) :
+    m_margin(margin) {
+        FlAssertMsg(margin >= 0.f, "[Physics/DynamicTreeBroadphase] Margin must be positive.");
+    }
+
+    auto DynamicTreeBroadphase::CreateProxy(const Aabb& bounds, const UInt64 userData) -> ProxyId {
+        const ProxyId proxy = AllocateProxy(bounds, userData);
+
+        const UInt32 leaf = AllocateNode();
+        m_nodes[leaf].bounds = Aabb{bounds.min - Vector3(m_margin), bounds.max + Vector3(m_margin)};
+        m_nodes[leaf].proxy = proxy;
+
+        if (proxy >= m_proxyLeaves.size()) {
+            m_proxyLeaves.resize(proxy + 1, InvalidNode);
+        }
+
+        m_proxyLeaves[proxy] = leaf;
+        InsertLeaf(leaf);
+
+        return proxy;
+    }
+
+    void DynamicTreeBroadphase::DestroyProxy(const ProxyId proxy) {
+        FlAssertMsg(IsValid(proxy), "[Physics/DynamicTreeBroadphase] Invalid proxy.");
+
+        const UInt32 leaf = m_proxyLeaves[proxy];
+        RemoveLeaf(leaf);
+        FreeNode(leaf);
+
+        m_proxyLeaves[proxy] = InvalidNode;
+        FreeProxy(proxy);
+    }
+
+    void DynamicTreeBroadphase::FindPairs(std::vector<BroadphasePair>& pairs, ThreadPool* threadPool) {
+        RecycleProxies();
+
+        // Proxies are queried in the order of the tree leaves, consecutive queries visiting the same nodes
+        m_queryOrder.clear();
+        if (m_root != InvalidNode) {
+            SmallVector<UInt32, 64> stack;
+            stack.push_back(m_root);
+            while (!stack.empty()) {
+                const Node& node = m_nodes[stack.back()];
+                stack.pop_back();
+
+                if (node.IsLeaf()) {
+                    m_queryOrder.push_back(node.proxy);
+                } else {
+                    stack.push_back(node.children[1]);
+                    stack.push_back(node.children[0]);
+                }
+            }
+        }
+
+        const auto findRange = [&](std::vector<BroadphasePair>& output, const std::size_t first,
+                                   const std::size_t last) {
+            SmallVector<UInt32, 64> stack;
+
+            for (std::size_t i = first; i < last; ++i) {
+                const ProxyId proxy = m_queryOrder[i];
+                const Aabb& bounds = m_proxyBounds[proxy];
+
+                stack.push_back(m_root);
+                while (!stack.empty()) {
+                    const Node& node = m_nodes[stack.back()];
+                    stack.pop_back();
+
+                    if (!node.bounds.Overlaps(bounds)) {
+                        continue;
+                    }
+
+                    if (!node.IsLeaf()) {
+                        stack.push_back(node.children[0]);
+                        stack.push_back(node.children[1]);
+                        continue;
+                    }
+
+                    // Each pair is found from both of its proxies, only the lowest one reports it
+                    if (node.proxy > proxy && m_proxyBounds[node.proxy].Overlaps(bounds)) {
+                        output.push_back({proxy, node.proxy});
+                    }
+                }
+            }
+        };
+
+        FindPairsInBatches(m_queryOrder.size(), pairs, threadPool, findRange);
+
+        // The leaf order depends on the tree history, the pair order must not
+        std::sort(pairs.begin(), pairs.end(), [](const BroadphasePair& lhs, const BroadphasePair& rhs) {
+            return lhs.GetKey() < rhs.GetKey();
+        });
+    }
+
+    const Aabb& DynamicTreeBroadphase::GetFatBounds(const ProxyId proxy) const {
+        FlAssertMsg(IsValid(proxy), "[Physics/DynamicTreeBroadphase] Invalid proxy.");
+
+        return m_nodes[m_proxyLeaves[proxy]].bounds;
+    }
+
+    Int32 DynamicTreeBroadphase::GetHeight() const {
+        return (m_root != InvalidNode) ? m_nodes[m_root].height : -1;
+    }
+
+    float DynamicTreeBroadphase::GetMargin() const {
+        return m_margin;
+    }
+
+    void DynamicTreeBroadphase::MoveProxy(const ProxyId proxy, const Aabb& bounds) {
+        FlAssertMsg(IsValid(proxy), "[Physics/DynamicTreeBroadphase] Invalid proxy.");
+        FlAssertMsg(bounds.IsValid(), "[Physics/DynamicTreeBroadphase] Invalid proxy bounds.");
+
+        m_proxyBounds[proxy] = bounds;
+
+        // Small moves stay inside the fattened bounds and leave the tree untouched
+        const UInt32 leaf = m_proxyLeaves[proxy];
+        if (m_nodes[leaf].bounds.Contains(bounds)) {
+            return;
+        }
+
+        RemoveLeaf(leaf);
+        m_nodes[leaf].bounds = Aabb{bounds.min - Vector3(m_margin), bounds.max + Vector3(m_margin)};
+        InsertLeaf(leaf);
+    }
+
+    UInt32 DynamicTreeBroadphase::AllocateNode() {
+        UInt32 nodeIndex;
+        if (!m_freeNodes.empty()) {
+            nodeIndex = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        } else {
+            nodeIndex = static_cast<UInt32>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        Node& node = m_nodes[nodeIndex];
+        node.bounds = Aabb::Empty();
+        node.parent = InvalidNode;
+        node.children[0] = InvalidNode;
+        node.children[1] = InvalidNode;
+        node.proxy = InvalidProxy;
+        node.height = 0;
+
+        return nodeIndex;
+    }
+
+    void DynamicTreeBroadphase::FreeNode(const UInt32 nodeIndex) {
+        m_nodes[nodeIndex].height = -1;
+        m_freeNodes.push_back(nodeIndex);
+    }
+
+    void DynamicTreeBroadphase::InsertLeaf(const UInt32 leaf) {
+        if (m_root == InvalidNode) {
+            m_root = leaf;
+            m_nodes[leaf].parent = InvalidNode;
+            return;
+        }
+
+        // Descend toward the sibling minimizing the total area increase
+        const Aabb leafBounds = m_nodes[leaf].bounds;
+        UInt32 sibling = m_root;
+        while (!m_nodes[sibling].IsLeaf()) {
+            const Node& node = m_nodes[sibling];
+            const float area = node.bounds.GetSurfaceArea();
+            const float combinedArea = Aabb::Merge(node.bounds, leafBounds).GetSurfaceArea();
+
+            // Creating a parent for this node and the leaf, versus the area added to this node by going deeper
+            const float cost = 2.f * combinedArea;
+            const float inheritanceCost = 2.f * (combinedArea - area);
+
+            float childCosts[2];
+            for (std::size_t slot = 0; slot < 2; ++slot) {
+                const Node& child = m_nodes[node.children[slot]];
+                const float mergedArea = Aabb::Merge(child.bounds, leafBounds).GetSurfaceArea();
+                childCosts[slot] = inheritanceCost +
+                                   (child.IsLeaf() ? mergedArea : mergedArea - child.bounds.GetSurfaceArea());
+            }
+
+            if (cost < childCosts[0] && cost < childCosts[1]) {
+                break;
+            }
+
+            sibling = node.children[(childCosts[0] <= childCosts[1]) ? 0 : 1];
+        }
+
+        const UInt32 oldParent = m_nodes[sibling].parent;
+        const UInt32 newParent = AllocateNode();
+
+        Node& parentNode = m_nodes[newParent];
+        parentNode.parent = oldParent;
+        parentNode.children[0] = sibling;
+        parentNode.children[1] = leaf;
+        parentNode.bounds = Aabb::Merge(m_nodes[sibling].bounds, leafBounds);
+        parentNode.height = m_nodes[sibling].height + 1;
+
+        if (oldParent != InvalidNode) {
+            ReplaceChild(oldParent, sibling, newParent);
+        } else {
+            m_root = newParent;
+        }
+
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        for (UInt32 nodeIndex = oldParent; nodeIndex != InvalidNode; nodeIndex = m_nodes[nodeIndex].parent) {
+            UpdateNode(nodeIndex);
+            RotateNode(nodeIndex);
+        }
+    }
+
+    void DynamicTreeBroadphase::RemoveLeaf(const UInt32 leaf) {
+        if (leaf == m_root) {
+            m_root = InvalidNode;
+            return;
+        }
+
+        const UInt32 parent = m_nodes[leaf].parent;
+        const UInt32 grandParent = m_nodes[parent].parent;
+        const UInt32 sibling = m_nodes[parent].children[(m_nodes[parent].children[0] == leaf) ? 1 : 0];
+
+        // The sibling takes the place of the parent
+        m_nodes[sibling].parent = grandParent;
+        FreeNode(parent);
+
+        if (grandParent == InvalidNode) {
+            m_root = sibling;
+            return;
+        }
+
+        ReplaceChild(grandParent, parent, sibling);
+
+        for (UInt32 nodeIndex = grandParent; nodeIndex != InvalidNode; nodeIndex = m_nodes[nodeIndex].parent) {
+            UpdateNode(nodeIndex);
+            RotateNode(nodeIndex);
+        }
+    }
+
+    void DynamicTreeBroadphase::ReplaceChild(const UInt32 parent, const UInt32 oldChild, const UInt32 newChild) {
+        Node& parentNode = m_nodes[parent];
+        parentNode.children[(parentNode.children[0] == oldChild) ? 0 : 1] = newChild;
+    }
+
+    void DynamicTreeBroadphase::RotateNode(const UInt32 nodeIndex) {
+        const Node& node = m_nodes[nodeIndex];
+
+        // Swapping a child with one of the grand-children on the other side only changes the bounds of the other
+        // child, pick the swap shrinking it the most
+        float bestGain = 0.f;
+        std::size_t bestSlot = 0;
+        std::size_t bestGrandChildSlot = 0;
+
+        for (std::size_t slot = 0; slot < 2; ++slot) {
+            const Node& child = m_nodes[node.children[slot]];
+            const Node& otherChild = m_nodes[node.children[1 - slot]];
+            if (otherChild.IsLeaf()) {
+                continue;
+            }
+
+            const float otherArea = otherChild.bounds.GetSurfaceArea();
+            for (std::size_t grandChildSlot = 0; grandChildSlot < 2; ++grandChildSlot) {
+                const Node& keptGrandChild = m_nodes[otherChild.children[1 - grandChildSlot]];
+                const float gain = otherArea - Aabb::Merge(child.bounds, keptGrandChild.bounds).GetSurfaceArea();
+                if (gain > bestGain) {
+                    bestGain = gain;
+                    bestSlot = slot;
+                    bestGrandChildSlot = grandChildSlot;
+                }
+            }
+        }
+
+        if (bestGain <= 0.f) {
+            return;
+        }
+
+        const UInt32 child = node.children[bestSlot];
+        const UInt32 otherChild = node.children[1 - bestSlot];
+        const UInt32 grandChild = m_nodes[otherChild].children[bestGrandChildSlot];
+
+        m_nodes[nodeIndex].children[bestSlot] = grandChild;
+        m_nodes[grandChild].parent = nodeIndex;
+        m_nodes[otherChild].children[bestGrandChildSlot] = child;
+        m_nodes[child].parent = otherChild;
+
+        UpdateNode(otherChild);
+        UpdateNode(nodeIndex);
+    }
+
+    void DynamicTreeBroadphase::UpdateNode(const UInt32 nodeIndex) {
+        Node& node = m_nodes[nodeIndex];
+        const Node& first = m_nodes[node.children[0]];
+        const Node& second = m_nodes[node.children[1]];
+
+        node.bounds = Aabb::Merge(first.bounds, second.bounds);
+        node.height = 1 + std::max(first.height, second.height);
+    }
+} // namespace Fl
@@ -0,0 +1,695 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/IslandSolver.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr std::size_t OverflowColor = IslandSolver::MaxColors;
+        constexpr std::size_t IslandGrain = 8; //< Small islands given to a thread at once
+        constexpr std::size_t BatchGrain = 16; //< Batches of a color of a large island given to a thread at once
+        constexpr std::size_t RowOrder[] = {1, 2, 0}; //< Friction rows first, the normal row matters most
+
+        using Lanes = float[SimdFloat4::Width];
+        using VectorLanes = float[3][SimdFloat4::Width];
+        using IndexLanes = UInt32[SimdFloat4::Width];
+
+        struct SimdVector3 {
+            SimdFloat4 x;
+            SimdFloat4 y;
+            SimdFloat4 z;
+        };
+
+        SimdVector3 operator+(const SimdVector3& lhs, const SimdVector3& rhs) {
+            return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z};
+        }
+
+        SimdVector3 operator-(const SimdVector3& lhs, const SimdVector3& rhs) {
+            return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+        }
+
+        SimdVector3 operator*(const SimdVector3& vec, const SimdFloat4& scale) {
+            return {vec.x * scale, vec.y * scale, vec.z * scale};
+        }
+
+        SimdFloat4 Dot(const SimdVector3& lhs, const SimdVector3& rhs) {
+            return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+        }
+
+        SimdVector3 LoadVector(const VectorLanes& lanes) {
+            return {SimdFloat4::LoadAligned(lanes[0]), SimdFloat4::LoadAligned(lanes[1]),
+                    SimdFloat4::LoadAligned(lanes[2])};
+        }
+
+        void StoreLane(VectorLanes& lanes, const std::size_t lane, const Vector3& vec) {
+            lanes[0][lane] = vec.x;
+            lanes[1][lane] = vec.y;
+            lanes[2][lane] = vec.z;
+        }
+
+        /**
+         * @brief Velocities of the bodies of the lanes of a batch.
+         */
+        struct BatchVelocities {
+            SimdVector3 linearA;
+            SimdVector3 angularA;
+            SimdVector3 linearB;
+            SimdVector3 angularB;
+
+            void ApplyImpulse(const SimdVector3& direction, const SimdVector3& inertiaAngularA,
+                              const SimdVector3& inertiaAngularB, const SimdFloat4& inverseMassA,
+                              const SimdFloat4& inverseMassB, const SimdFloat4& impulse) {
+                linearA = linearA - direction * (inverseMassA * impulse);
+                angularA = angularA - inertiaAngularA * impulse;
+                linearB = linearB + direction * (inverseMassB * impulse);
+                angularB = angularB + inertiaAngularB * impulse;
+            }
+        };
+
+        SimdVector3 GatherVelocities(const std::span<const RigidBody> bodies, const IndexLanes& indices,
+                                     Vector3 RigidBody::*velocity) {
+            alignas(16) VectorLanes lanes;
+            for (std::size_t lane = 0; lane < SimdFloat4::Width; ++lane) {
+                StoreLane(lanes, lane, bodies[indices[lane]].*velocity);
+            }
+
+            return LoadVector(lanes);
+        }
+
+        BatchVelocities GatherBatchVelocities(const std::span<const RigidBody> bodies, const IndexLanes& bodyA,
+                                              const IndexLanes& bodyB) {
+            return {GatherVelocities(bodies, bodyA, &RigidBody::linearVelocity),
+                    GatherVelocities(bodies, bodyA, &RigidBody::angularVelocity),
+                    GatherVelocities(bodies, bodyB, &RigidBody::linearVelocity),
+                    GatherVelocities(bodies, bodyB, &RigidBody::angularVelocity)};
+        }
+
+        void ScatterVelocities(const std::span<RigidBody> bodies, const IndexLanes& indices,
+                               const Lanes& inverseMasses, const std::size_t laneCount,
+                               Vector3 RigidBody::*velocity, const SimdVector3& values) {
+            alignas(16) VectorLanes lanes;
+            values.x.StoreAligned(lanes[0]);
+            values.y.StoreAligned(lanes[1]);
+            values.z.StoreAligned(lanes[2]);
+
+            // Static bodies are shared by batches solved in parallel, they must not be written
+            for (std::size_t lane = 0; lane < laneCount; ++lane) {
+                if (inverseMasses[lane] != 0.f) {
+                    bodies[indices[lane]].*velocity = Vector3(lanes[0][lane], lanes[1][lane], lanes[2][lane]);
+                }
+            }
+        }
+
+        Vector3 ApplyInverseInertia(const RigidBody& body, const Vector3& vec) {
+            return body.rotation * (body.inverseInertia * (body.rotation.GetConjugate() * vec));
+        }
+
+        /**
+         * @brief Builds two tangents orthogonal to a normal, only depending on the normal so that the friction
+         *        impulses of the previous step can warm start the next one.
+         */
+        void ComputeTangents(const Vector3& normal, Vector3& tangent, Vector3& bitangent) {
+            // Duff et al., "Building an Orthonormal Basis, Revisited"
+            const float sign = std::copysign(1.f, normal.z);
+            const float a = -1.f / (sign + normal.z);
+            const float b = normal.x * normal.y * a;
+            tangent = Vector3(1.f + sign * normal.x * normal.x * a, sign * b, -sign * normal.x);
+            bitangent = Vector3(b, sign + normal.y * normal.y * a, -normal.y);
+        }
+
+        UInt32 FindRoot(std::vector<UInt32>& parents, UInt32 body) {
+            // Path halving
+            while (parents[body] != body) {
+                parents[body] = parents[parents[body]];
+                body = parents[body];
+            }
+
+            return body;
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    IslandSolver::IslandSolver() :
+        IslandSolver(Settings{}) {
+    }
+
+    IslandSolver::IslandSolver(const Settings& settings) :
+        m_settings(settings), m_statistics() {
+        FlAssertMsg(m_settings.velocityIterations > 0, "[Physics/IslandSolver] At least one iteration is required.");
+        FlAssertMsg(m_settings.baumgarteFactor >= 0.f && m_settings.baumgarteFactor <= 1.f,
+                    "[Physics/IslandSolver] Baumgarte factor must be between 0 and 1.");
+    }
+
+    auto IslandSolver::GetSettings() const -> const Settings& {
+        return m_settings;
+    }
+
+    auto IslandSolver::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+
+    bool IslandSolver::IsSleeping(const UInt32 body) const {
+        return body < m_bodySleepingIslands.size() && m_bodySleepingIslands[body] != InvalidIsland;
+    }
+
+    void IslandSolver::Step(const std::span<RigidBody> bodies, const std::span<ContactManifold> manifolds,
+                            const float deltaTime, ThreadPool* threadPool) {
+        FlAssertMsg(bodies.size() >= m_bodySleepingIslands.size(), "[Physics/IslandSolver] Bodies can't be removed.");
+        FlAssertMsg(deltaTime > 0.f, "[Physics/IslandSolver] Time step must be positive.");
+
+        // New bodies start awake
+        for (std::size_t body = m_bodySleepingIslands.size(); body < bodies.size(); ++body) {
+            if (!bodies[body].IsStatic()) {
+                m_awakeBodies.push_back(static_cast<UInt32>(body));
+            }
+        }
+
+        m_bodySleepingIslands.resize(bodies.size(), InvalidIsland);
+        m_bodyIslands.resize(bodies.size());
+        m_parents.resize(bodies.size());
+        m_colorMasks.resize(bodies.size());
+        m_sleepTimers.resize(bodies.size(), 0.f);
+
+        WakeTouchedIslands(bodies, manifolds);
+
+        // Woken bodies were appended, islands are numbered in the order of their first body
+        std::sort(m_awakeBodies.begin(), m_awakeBodies.end());
+
+        BuildIslands(bodies, manifolds);
+        ColorIslands(bodies, manifolds);
+
+        // Small islands are solved by a single thread each, large ones spread their colors over the thread pool
+        const auto solveSmallIslands = [&](const std::size_t first, const std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                if (m_islands[i].contactCount <= m_settings.largeIslandContactCount) {
+                    SolveIsland(m_islands[i], bodies, manifolds, deltaTime, nullptr);
+                }
+            }
+        };
+
+        if (threadPool) {
+            threadPool->ParallelFor(m_islands.size(), IslandGrain, solveSmallIslands);
+        } else {
+            solveSmallIslands(0, m_islands.size());
+        }
+
+        m_statistics = {};
+        for (Island& island : m_islands) {
+            if (island.contactCount > m_settings.largeIslandContactCount) {
+                SolveIsland(island, bodies, manifolds, deltaTime, threadPool);
+                ++m_statistics.largeIslandCount;
+            }
+
+            m_statistics.colorCount = std::max<std::size_t>(m_statistics.colorCount, island.colorCount);
+        }
+
+        m_statistics.awakeBodyCount = m_awakeBodies.size();
+        m_statistics.islandCount = m_islands.size();
+        m_statistics.contactCount = m_islandContacts.size();
+        m_statistics.batchCount = m_batches.size();
+
+        PutIslandsToSleep(bodies);
+        m_statistics.sleepingIslandCount = m_sleepingIslands.size() - m_freeSleepingIslands.size();
+    }
+
+    void IslandSolver::WakeBody(const UInt32 body) {
+        if (IsSleeping(body)) {
+            WakeIsland(m_bodySleepingIslands[body]);
+        }
+    }
+
+    void IslandSolver::BuildIslands(const std::span<const RigidBody> bodies,
+                                    const std::span<const ContactManifold> manifolds) {
+        const auto isActive = [&](const ContactManifold& manifold) {
+            return manifold.pointCount > 0 &&
+                   (IsAwakeDynamic(bodies, manifold.bodyA) || IsAwakeDynamic(bodies, manifold.bodyB));
+        };
+
+        for (const UInt32 body : m_awakeBodies) {
+            m_parents[body] = body;
+        }
+
+        // Roots are the lowest body of their tree, which keeps the islands independent from the manifold order
+        for (const ContactManifold& manifold : manifolds) {
+            if (manifold.pointCount == 0 || !IsAwakeDynamic(bodies, manifold.bodyA) ||
+                !IsAwakeDynamic(bodies, manifold.bodyB)) {
+                continue;
+            }
+
+            const UInt32 rootA = FindRoot(m_parents, manifold.bodyA);
+            const UInt32 rootB = FindRoot(m_parents, manifold.bodyB);
+            m_parents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+        }
+
+        // Bodies are sorted, the root of an island comes before the other bodies of the island
+        m_islands.clear();
+        for (const UInt32 body : m_awakeBodies) {
+            const UInt32 root = FindRoot(m_parents, body);
+            if (root == body) {
+                m_bodyIslands[body] = static_cast<UInt32>(m_islands.size());
+                m_islands.push_back({});
+            } else {
+                m_bodyIslands[body] = m_bodyIslands[root];
+            }
+
+            ++m_islands[m_bodyIslands[body]].bodyCount;
+        }
+
+        for (const ContactManifold& manifold : manifolds) {
+            if (isActive(manifold)) {
+                const UInt32 body = IsAwakeDynamic(bodies, manifold.bodyA) ? manifold.bodyA : manifold.bodyB;
+                ++m_islands[m_bodyIslands[body]].contactCount;
+            }
+        }
+
+        // Bodies and manifolds are grouped by island, in their order
+        UInt32 bodyOffset = 0;
+        UInt32 contactOffset = 0;
+        for (Island& island : m_islands) {
+            island.firstBody = bodyOffset;
+            island.firstContact = contactOffset;
+            bodyOffset += island.bodyCount;
+            contactOffset += island.contactCount;
+            island.bodyCount = 0;
+            island.contactCount = 0;
+        }
+
+        m_islandBodies.resize(bodyOffset);
+        m_islandContacts.resize(contactOffset);
+
+        for (const UInt32 body : m_awakeBodies) {
+            Island& island = m_islands[m_bodyIslands[body]];
+            m_islandBodies[island.firstBody + island.bodyCount++] = body;
+        }
+
+        for (std::size_t i = 0; i < manifolds.size(); ++i) {
+            const ContactManifold& manifold = manifolds[i];
+            if (isActive(manifold)) {
+                const UInt32 body = IsAwakeDynamic(bodies, manifold.bodyA) ? manifold.bodyA : manifold.bodyB;
+                Island& island = m_islands[m_bodyIslands[body]];
+                m_islandContacts[island.firstContact + island.contactCount++] = static_cast<UInt32>(i);
+            }
+        }
+    }
+
+    void IslandSolver::ColorIslands(const std::span<const RigidBody> bodies,
+                                    const std::span<const ContactManifold> manifolds) {
+        m_colors.clear();
+        m_batches.clear();
+        m_contactColors.resize(m_islandContacts.size());
+
+        for (Island& island : m_islands) {
+            for (UInt32 i = 0; i < island.bodyCount; ++i) {
+                m_colorMasks[m_islandBodies[island.firstBody + i]] = 0;
+            }
+
+            // Each contact takes the lowest color none of its dynamic bodies uses yet
+            std::array<UInt32, MaxColors + 1> colorSizes = {};
+            for (UInt32 i = island.firstContact; i < island.firstContact + island.contactCount; ++i) {
+                const ContactManifold& manifold = manifolds[m_islandContacts[i]];
+                const bool isDynamicA = !bodies[manifold.bodyA].IsStatic();
+                const bool isDynamicB = !bodies[manifold.bodyB].IsStatic();
+
+                const UInt64 usedColors = (isDynamicA ? m_colorMasks[manifold.bodyA] : 0) |
+                                          (isDynamicB ? m_colorMasks[manifold.bodyB] : 0);
+
+                std::size_t color = OverflowColor;
+                if (usedColors != ~UInt64(0)) {
+                    color = static_cast<std::size_t>(std::countr_one(usedColors));
+                    const UInt64 colorBit = UInt64(1) << color;
+                    m_colorMasks[manifold.bodyA] |= isDynamicA ? colorBit : 0;
+                    m_colorMasks[manifold.bodyB] |= isDynamicB ? colorBit : 0;
+                }
+
+                m_contactColors[i] = static_cast<UInt8>(color);
+                ++colorSizes[color];
+            }
+
+            // Contacts of the overflow color may share bodies, they get a batch each and are solved in order
+            island.firstColor = static_cast<UInt32>(m_colors.size());
+            island.firstBatch = static_cast<UInt32>(m_batches.size());
+
+            std::array<UInt32, MaxColors + 1> colorFirstBatches;
+            UInt32 batchOffset = island.firstBatch;
+            for (std::size_t color = 0; color <= OverflowColor; ++color) {
+                if (colorSizes[color] == 0) {
+                    continue;
+                }
+
+                const std::size_t laneCount = (color == OverflowColor) ? 1 : Width;
+                const auto batchCount = static_cast<UInt32>((colorSizes[color] + laneCount - 1) / laneCount);
+                m_colors.push_back({batchOffset, batchCount, color == OverflowColor});
+
+                colorFirstBatches[color] = batchOffset;
+                batchOffset += batchCount;
+            }
+
+            island.colorCount = static_cast<UInt32>(m_colors.size()) - island.firstColor;
+            island.batchCount = batchOffset - island.firstBatch;
+            m_batches.resize(batchOffset);
+
+            std::array<UInt32, MaxColors + 1> colorRanks = {};
+            for (UInt32 i = island.firstContact; i < island.firstContact + island.contactCount; ++i) {
+                const std::size_t color = m_contactColors[i];
+                const std::size_t laneCount = (color == OverflowColor) ? 1 : Width;
+                const UInt32 rank = colorRanks[color]++;
+
+                Batch& batch = m_batches[colorFirstBatches[color] + rank / laneCount];
+                const std::size_t lane = rank % laneCount;
+                batch.manifoldIndices[lane] = m_islandContacts[i];
+                batch.laneCount = static_cast<UInt32>(lane + 1);
+            }
+        }
+    }
+
+    void IslandSolver::PutIslandsToSleep(const std::span<RigidBody> bodies) {
+        m_awakeBodies.clear();
+
+        for (const Island& island : m_islands) {
+            const std::span<const UInt32> islandBodies(m_islandBodies.data() + island.firstBody, island.bodyCount);
+            if (!island.fallsAsleep) {
+                m_awakeBodies.insert(m_awakeBodies.end(), islandBodies.begin(), islandBodies.end());
+                continue;
+            }
+
+            UInt32 sleepingIsland;
+            if (!m_freeSleepingIslands.empty()) {
+                sleepingIsland = m_freeSleepingIslands.back();
+                m_freeSleepingIslands.pop_back();
+            } else {
+                sleepingIsland = static_cast<UInt32>(m_sleepingIslands.size());
+                m_sleepingIslands.emplace_back();
+            }
+
+            m_sleepingIslands[sleepingIsland].assign(islandBodies.begin(), islandBodies.end());
+            for (const UInt32 body : islandBodies) {
+                m_bodySleepingIslands[body] = sleepingIsland;
+                bodies[body].linearVelocity = Vector3::Zero();
+                bodies[body].angularVelocity = Vector3::Zero();
+            }
+        }
+    }
+
+    void IslandSolver::SolveIsland(Island& island, const std::span<RigidBody> bodies,
+                                   const std::span<ContactManifold> manifolds, const float deltaTime,
+                                   ThreadPool* threadPool) {
+        const std::span<const UInt32> islandBodies(m_islandBodies.data() + island.firstBody, island.bodyCount);
+        for (const UInt32 body : islandBodies) {
+            bodies[body].linearVelocity += m_settings.gravity * deltaTime;
+        }
+
+        // Batches of a color share no dynamic body, they can be solved in any order
+        const auto forEachBatch = [&](const UInt32 firstBatch, const UInt32 batchCount, const bool isSequential,
+                                      auto&& func) {
+            if (threadPool && !isSequential && batchCount > BatchGrain) {
+                threadPool->ParallelFor(batchCount, BatchGrain, [&](const std::size_t first, const std::size_t last) {
+                    for (std::size_t i = first; i < last; ++i) {
+                        func(m_batches[firstBatch + i]);
+                    }
+                });
+            } else {
+                for (UInt32 i = 0; i < batchCount; ++i) {
+                    func(m_batches[firstBatch + i]);
+                }
+            }
+        };
+
+        const auto forEachColor = [&](auto&& func) {
+            for (UInt32 i = 0; i < island.colorCount; ++i) {
+                const Color& color = m_colors[island.firstColor + i];
+                forEachBatch(color.firstBatch, color.batchCount, color.isSequential, func);
+            }
+        };
+
+        // Preparing only reads the bodies, batches of every color can be prepared at once
+        forEachBatch(island.firstBatch, island.batchCount, false, [&](Batch& batch) {
+            batch.Prepare(bodies, manifolds, m_settings, deltaTime);
+        });
+
+        forEachColor([&](const Batch& batch) { batch.WarmStart(bodies); });
+
+        for (UInt32 iteration = 0; iteration < m_settings.velocityIterations; ++iteration) {
+            forEachColor([&](Batch& batch) { batch.Solve(bodies); });
+        }
+
+        forEachBatch(island.firstBatch, island.batchCount, false, [&](const Batch& batch) {
+            batch.StoreImpulses(manifolds);
+        });
+
+        const float squaredSleepLinearVelocity = m_settings.sleepLinearVelocity * m_settings.sleepLinearVelocity;
+        const float squaredSleepAngularVelocity = m_settings.sleepAngularVelocity * m_settings.sleepAngularVelocity;
+
+        float minSleepTimer = m_settings.timeToSleep;
+        for (const UInt32 body : islandBodies) {
+            RigidBody& rigidBody = bodies[body];
+            rigidBody.position += rigidBody.linearVelocity * deltaTime;
+
+            // First order integration of the rotation, q' = q + dt/2 * w * q
+            const Vector3& angularVelocity = rigidBody.angularVelocity;
+            const Quaternion& rotation = rigidBody.rotation;
+            const Quaternion spin = Quaternion(angularVelocity.x, angularVelocity.y, angularVelocity.z, 0.f) * rotation;
+            const float halfStep = 0.5f * deltaTime;
+            rigidBody.rotation = Quaternion(rotation.x + spin.x * halfStep, rotation.y + spin.y * halfStep,
+                                            rotation.z + spin.z * halfStep, rotation.w + spin.w * halfStep)
+                                     .GetNormal();
+
+            const bool isStill = rigidBody.linearVelocity.GetSquaredLength() <= squaredSleepLinearVelocity &&
+                                 angularVelocity.GetSquaredLength() <= squaredSleepAngularVelocity;
+            m_sleepTimers[body] = isStill ? m_sleepTimers[body] + deltaTime : 0.f;
+            minSleepTimer = std::min(minSleepTimer, m_sleepTimers[body]);
+        }
+
+        island.fallsAsleep = minSleepTimer >= m_settings.timeToSleep;
+    }
+
+    void IslandSolver::WakeIsland(const UInt32 sleepingIsland) {
+        std::vector<UInt32>& islandBodies = m_sleepingIslands[sleepingIsland];
+        for (const UInt32 body : islandBodies) {
+            m_bodySleepingIslands[body] = InvalidIsland;
+            m_sleepTimers[body] = 0.f;
+            m_awakeBodies.push_back(body);
+        }
+
+        islandBodies.clear();
+        m_freeSleepingIslands.push_back(sleepingIsland);
+    }
+
+    void IslandSolver::WakeTouchedIslands(const std::span<const RigidBody> bodies,
+                                          const std::span<const ContactManifold> manifolds) {
+        // Woken bodies can wake the islands they touch in turn
+        bool hasWokenIslands = true;
+        while (hasWokenIslands) {
+            hasWokenIslands = false;
+
+            for (const ContactManifold& manifold : manifolds) {
+                FlAssertMsg(manifold.bodyA < bodies.size() && manifold.bodyB < bodies.size(),
+                            "[Physics/IslandSolver] Manifold body out of range.");
+
+                if (manifold.pointCount == 0) {
+                    continue;
+                }
+
+                const UInt32 sleepingIslandA = m_bodySleepingIslands[manifold.bodyA];
+                const UInt32 sleepingIslandB = m_bodySleepingIslands[manifold.bodyB];
+
+                if (sleepingIslandA != InvalidIsland && IsAwakeDynamic(bodies, manifold.bodyB)) {
+                    WakeIsland(sleepingIslandA);
+                    hasWokenIslands = true;
+                } else if (sleepingIslandB != InvalidIsland && IsAwakeDynamic(bodies, manifold.bodyA)) {
+                    WakeIsland(sleepingIslandB);
+                    hasWokenIslands = true;
+                }
+            }
+        }
+    }
+
+    void IslandSolver::Batch::Prepare(const std::span<const RigidBody> bodies,
+                                      const std::span<const ContactManifold> manifolds, const Settings& settings,
+                                      const float deltaTime) {
+        const float inverseDeltaTime = 1.f / deltaTime;
+
+        const auto clearPoint = [&](const std::size_t point, const std::size_t lane) {
+            for (std::size_t row = 0; row < RowCount; ++row) {
+                StoreLane(angularA[point][row], lane, Vector3::Zero());
+                StoreLane(angularB[point][row], lane, Vector3::Zero());
+                StoreLane(inertiaAngularA[point][row], lane, Vector3::Zero());
+                StoreLane(inertiaAngularB[point][row], lane, Vector3::Zero());
+                masses[point][row][lane] = 0.f;
+                impulses[point][row][lane] = 0.f;
+            }
+
+            biases[point][lane] = 0.f;
+        };
+
+        pointCount = 0;
+        for (std::size_t lane = 0; lane < Width; ++lane) {
+            // Unused lanes repeat the bodies of the first one, with zero masses they don't change their velocities
+            if (lane >= laneCount) {
+                bodyA[lane] = bodyA[0];
+                bodyB[lane] = bodyB[0];
+                manifoldIndices[lane] = manifoldIndices[0];
+                inverseMassA[lane] = 0.f;
+                inverseMassB[lane] = 0.f;
+                friction[lane] = 0.f;
+
+                for (std::size_t row = 0; row < RowCount; ++row) {
+                    StoreLane(directions[row], lane, Vector3::Zero());
+                }
+
+                for (std::size_t point = 0; point < ContactManifold::MaxPoints; ++point) {
+                    clearPoint(point, lane);
+                }
+
+                continue;
+            }
+
+            const ContactManifold& manifold = manifolds[manifoldIndices[lane]];
+            const RigidBody& rigidBodyA = bodies[manifold.bodyA];
+            const RigidBody& rigidBodyB = bodies[manifold.bodyB];
+
+            bodyA[lane] = manifold.bodyA;
+            bodyB[lane] = manifold.bodyB;
+            inverseMassA[lane] = rigidBodyA.inverseMass;
+            inverseMassB[lane] = rigidBodyB.inverseMass;
+            friction[lane] = std::sqrt(rigidBodyA.friction * rigidBodyB.friction);
+            const float restitution = std::max(rigidBodyA.restitution, rigidBodyB.restitution);
+
+            Vector3 rowDirections[RowCount];
+            rowDirections[0] = manifold.normal;
+            ComputeTangents(manifold.normal, rowDirections[1], rowDirections[2]);
+            for (std::size_t row = 0; row < RowCount; ++row) {
+                StoreLane(directions[row], lane, rowDirections[row]);
+            }
+
+            pointCount = std::max(pointCount, manifold.pointCount);
+            for (std::size_t point = 0; point < ContactManifold::MaxPoints; ++point) {
+                if (point >= manifold.pointCount) {
+                    clearPoint(point, lane);
+                    continue;
+                }
+
+                const ContactPoint& contactPoint = manifold.points[point];
+                const Vector3 offsetA = contactPoint.position - rigidBodyA.position;
+                const Vector3 offsetB = contactPoint.position - rigidBodyB.position;
+
+                for (std::size_t row = 0; row < RowCount; ++row) {
+                    const Vector3 rowAngularA = offsetA.Cross(rowDirections[row]);
+                    const Vector3 rowAngularB = offsetB.Cross(rowDirections[row]);
+                    const Vector3 rowInertiaAngularA = ApplyInverseInertia(rigidBodyA, rowAngularA);
+                    const Vector3 rowInertiaAngularB = ApplyInverseInertia(rigidBodyB, rowAngularB);
+                    StoreLane(angularA[point][row], lane, rowAngularA);
+                    StoreLane(angularB[point][row], lane, rowAngularB);
+                    StoreLane(inertiaAngularA[point][row], lane, rowInertiaAngularA);
+                    StoreLane(inertiaAngularB[point][row], lane, rowInertiaAngularB);
+
+                    const float effectiveMass = rigidBodyA.inverseMass + rigidBodyB.inverseMass +
+                                                rowAngularA.Dot(rowInertiaAngularA) +
+                                                rowAngularB.Dot(rowInertiaAngularB);
+                    masses[point][row][lane] = (effectiveMass > 0.f) ? 1.f / effectiveMass : 0.f;
+                }
+
+                impulses[point][0][lane] = contactPoint.normalImpulse;
+                impulses[point][1][lane] = contactPoint.tangentImpulses[0];
+                impulses[point][2][lane] = contactPoint.tangentImpulses[1];
+
+                // Separated points let the bodies approach until they touch, penetrating ones push them apart
+                float bias = (contactPoint.depth < 0.f)
+                                 ? -contactPoint.depth * inverseDeltaTime
+                                 : -settings.baumgarteFactor * inverseDeltaTime *
+                                       std::max(contactPoint.depth - settings.linearSlop, 0.f);
+
+                // Normal velocity, positive when the bodies separate
+                const Vector3 velocityA = rigidBodyA.linearVelocity + rigidBodyA.angularVelocity.Cross(offsetA);
+                const Vector3 velocityB = rigidBodyB.linearVelocity + rigidBodyB.angularVelocity.Cross(offsetB);
+                const float normalVelocity = manifold.normal.Dot(velocityB - velocityA);
+                if (normalVelocity < -settings.restitutionThreshold) {
+                    bias = std::min(bias, restitution * normalVelocity);
+                }
+
+                biases[point][lane] = bias;
+            }
+        }
+    }
+
+    void IslandSolver::Batch::Solve(const std::span<RigidBody> bodies) {
+        BatchVelocities velocities = GatherBatchVelocities(bodies, bodyA, bodyB);
+        const SimdFloat4 lanesInverseMassA = SimdFloat4::LoadAligned(inverseMassA);
+        const SimdFloat4 lanesInverseMassB = SimdFloat4::LoadAligned(inverseMassB);
+        const SimdFloat4 lanesFriction = SimdFloat4::LoadAligned(friction);
+
+        for (std::size_t point = 0; point < pointCount; ++point) {
+            for (const std::size_t row : RowOrder) {
+                const SimdVector3 direction = LoadVector(directions[row]);
+                const SimdVector3 rowAngularA = LoadVector(angularA[point][row]);
+                const SimdVector3 rowAngularB = LoadVector(angularB[point][row]);
+
+                const SimdFloat4 relativeVelocity = Dot(direction, velocities.linearB - velocities.linearA) +
+                                                    Dot(rowAngularB, velocities.angularB) -
+                                                    Dot(rowAngularA, velocities.angularA);
+                const SimdFloat4 mass = SimdFloat4::LoadAligned(masses[point][row]);
+                const SimdFloat4 oldImpulse = SimdFloat4::LoadAligned(impulses[point][row]);
+
+                // The accumulated impulse is clamped, not the increment, so that iterations can undo each other
+                SimdFloat4 impulse;
+                if (row == 0) {
+                    const SimdFloat4 bias = SimdFloat4::LoadAligned(biases[point]);
+                    impulse = SimdFloat4::Max(oldImpulse - mass * (relativeVelocity + bias), SimdFloat4::Zero());
+                } else {
+                    const SimdFloat4 limit = lanesFriction * SimdFloat4::LoadAligned(impulses[point][0]);
+                    impulse = SimdFloat4::Min(SimdFloat4::Max(oldImpulse - mass * relativeVelocity, -limit), limit);
+                }
+
+                impulse.StoreAligned(impulses[point][row]);
+                velocities.ApplyImpulse(direction, LoadVector(inertiaAngularA[point][row]),
+                                        LoadVector(inertiaAngularB[point][row]), lanesInverseMassA, lanesInverseMassB,
+                                        impulse - oldImpulse);
+            }
+        }
+
+        ScatterVelocities(bodies, bodyA, inverseMassA, laneCount, &RigidBody::linearVelocity, velocities.linearA);
+        ScatterVelocities(bodies, bodyA, inverseMassA, laneCount, &RigidBody::angularVelocity, velocities.angularA);
+        ScatterVelocities(bodies, bodyB, inverseMassB, laneCount, &RigidBody::linearVelocity, velocities.linearB);
+        ScatterVelocities(bodies, bodyB, inverseMassB, laneCount, &RigidBody::angularVelocity, velocities.angularB);
+    }
+
+    void IslandSolver::Batch::StoreImpulses(const std::span<ContactManifold> manifolds) const {
+        for (std::size_t lane = 0; lane < laneCount; ++lane) {
+            ContactManifold& manifold = manifolds[manifoldIndices[lane]];
+            for (std::size_t point = 0; point < manifold.pointCount; ++point) {
+                ContactPoint& contactPoint = manifold.points[point];
+                contactPoint.normalImpulse = impulses[point][0][lane];
+                contactPoint.tangentImpulses[0] = impulses[point][1][lane];
+                contactPoint.tangentImpulses[1] = impulses[point][2][lane];
+            }
+        }
+    }
+
+    void IslandSolver::Batch::WarmStart(const std::span<RigidBody> bodies) const {
+        BatchVelocities velocities = GatherBatchVelocities(bodies, bodyA, bodyB);
+        const SimdFloat4 lanesInverseMassA = SimdFloat4::LoadAligned(inverseMassA);
+        const SimdFloat4 lanesInverseMassB = SimdFloat4::LoadAligned(inverseMassB);
+
+        for (std::size_t point = 0; point < pointCount; ++point) {
+            for (std::size_t row = 0; row < RowCount; ++row) {
+                velocities.ApplyImpulse(LoadVector(directions[row]), LoadVector(inertiaAngularA[point][row]),
+                                        LoadVector(inertiaAngularB[point][row]), lanesInverseMassA, lanesInverseMassB,
+                                        SimdFloat4::LoadAligned(impulses[point][row]));
+            }
+        }
+
+        ScatterVelocities(bodies, bodyA, inverseMassA, laneCount, &RigidBody::linearVelocity, velocities.linearA);
+        ScatterVelocities(bodies, bodyA, inverseMassA, laneCount, &RigidBody::angularVelocity, velocities.angularA);
+        ScatterVelocities(bodies, bodyB, inverseMassB, laneCount, &RigidBody::linearVelocity, velocities.linearB);
+        ScatterVelocities(bodies, bodyB, inverseMassB, laneCount, &RigidBody::angularVelocity, velocities.angularB);
+    }
+} // namespace Fl
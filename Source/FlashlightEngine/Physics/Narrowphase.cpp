@@ -0,0 +1,1127 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/Narrowphase.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Physics/BoxShape.hpp>
+#include <FlashlightEngine/Physics/CapsuleShape.hpp>
+#include <FlashlightEngine/Physics/ConvexHullShape.hpp>
+#include <FlashlightEngine/Physics/Gjk.hpp>
+#include <FlashlightEngine/Physics/SphereShape.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        // Shape classes, in the order of ShapeType
+        using ShapeClasses = std::tuple<SphereShape, CapsuleShape, BoxShape, ConvexHullShape>;
+
+        template <std::size_t... I>
+        constexpr bool MatchesShapeTypes(std::index_sequence<I...>) {
+            return ((std::tuple_element_t<I, ShapeClasses>::Type == static_cast<ShapeType>(I)) && ...);
+        }
+
+        static_assert(std::tuple_size_v<ShapeClasses> == Narrowphase::ShapeTypeCount &&
+                      MatchesShapeTypes(std::make_index_sequence<Narrowphase::ShapeTypeCount>()),
+                      "Shape classes must follow the order of ShapeType.");
+
+        constexpr UInt32 InvalidManifold = std::numeric_limits<UInt32>::max();
+        constexpr float PersistenceDistance = 0.04f; //< Distance under which a point continues a previous one
+        constexpr float ParallelTolerance = 0.05f; //< Sine of the angle under which segments are parallel
+
+        struct CollideContext {
+            std::span<const CollisionBody> bodies;
+            std::span<const BroadphasePair> tasks;
+            std::span<const UInt32> taskPairs;
+            std::span<ContactManifold> pairManifolds;
+            float contactMargin;
+        };
+
+        using CollideFunction = void (*)(const CollideContext& context, std::size_t firstTask, std::size_t lastTask);
+
+        ContactManifold& BeginManifold(const CollideContext& context, const std::size_t task) {
+            ContactManifold& manifold = context.pairManifolds[context.taskPairs[task]];
+            manifold.bodyA = context.tasks[task].first;
+            manifold.bodyB = context.tasks[task].second;
+            manifold.pointCount = 0;
+
+            return manifold;
+        }
+
+        void AddContactPoint(ContactManifold& manifold, const CollisionBody& bodyA, const CollisionBody& bodyB,
+                             const Vector3& pointA, const Vector3& pointB, const float depth) {
+            ContactPoint& point = manifold.points[manifold.pointCount++];
+            point.localPointA = bodyA.rotation.GetConjugate() * (pointA - bodyA.position);
+            point.localPointB = bodyB.rotation.GetConjugate() * (pointB - bodyB.position);
+            point.position = (pointA + pointB) * 0.5f;
+            point.depth = depth;
+            point.normalImpulse = 0.f;
+            point.tangentImpulses[0] = 0.f;
+            point.tangentImpulses[1] = 0.f;
+            point.featureId = 0;
+        }
+
+        // --- Lanes of SimdFloat4::Width pairs ---
+
+        struct SimdVector3 {
+            SimdFloat4 x;
+            SimdFloat4 y;
+            SimdFloat4 z;
+        };
+
+        struct SimdQuaternion {
+            SimdVector3 axis;
+            SimdFloat4 w;
+        };
+
+        SimdVector3 operator+(const SimdVector3& lhs, const SimdVector3& rhs) {
+            return {lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z};
+        }
+
+        SimdVector3 operator-(const SimdVector3& lhs, const SimdVector3& rhs) {
+            return {lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z};
+        }
+
+        SimdVector3 operator*(const SimdVector3& vec, const SimdFloat4& scale) {
+            return {vec.x * scale, vec.y * scale, vec.z * scale};
+        }
+
+        SimdVector3 Cross(const SimdVector3& lhs, const SimdVector3& rhs) {
+            return {lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x};
+        }
+
+        SimdFloat4 Dot(const SimdVector3& lhs, const SimdVector3& rhs) {
+            return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+        }
+
+        SimdVector3 Rotate(const SimdQuaternion& rotation, const SimdVector3& vec) {
+            const SimdVector3 t = Cross(rotation.axis, vec) * SimdFloat4::Splat(2.f);
+            return vec + t * rotation.w + Cross(rotation.axis, t);
+        }
+
+        /**
+         * @brief Gathers a value for each lane, the lanes past the last task repeating it.
+         */
+        template <typename F>
+        SimdFloat4 GatherLanes(const std::size_t firstTask, const std::size_t taskCount, F&& getValue) {
+            alignas(16) float values[SimdFloat4::Width];
+            for (std::size_t lane = 0; lane < SimdFloat4::Width; ++lane) {
+                values[lane] = getValue(firstTask + std::min(lane, taskCount - 1));
+            }
+
+            return SimdFloat4::LoadAligned(values);
+        }
+
+        template <auto Body>
+        SimdVector3 GatherPositions(const CollideContext& context, const std::size_t firstTask,
+                                    const std::size_t taskCount) {
+            alignas(16) float values[3][SimdFloat4::Width];
+            for (std::size_t lane = 0; lane < SimdFloat4::Width; ++lane) {
+                const std::size_t task = firstTask + std::min(lane, taskCount - 1);
+                const Vector3& position = context.bodies[context.tasks[task].*Body].position;
+                values[0][lane] = position.x;
+                values[1][lane] = position.y;
+                values[2][lane] = position.z;
+            }
+
+            return {SimdFloat4::LoadAligned(values[0]), SimdFloat4::LoadAligned(values[1]),
+                    SimdFloat4::LoadAligned(values[2])};
+        }
+
+        template <auto Body>
+        SimdQuaternion GatherRotations(const CollideContext& context, const std::size_t firstTask,
+                                       const std::size_t taskCount) {
+            alignas(16) float values[4][SimdFloat4::Width];
+            for (std::size_t lane = 0; lane < SimdFloat4::Width; ++lane) {
+                const std::size_t task = firstTask + std::min(lane, taskCount - 1);
+                const Quaternion& rotation = context.bodies[context.tasks[task].*Body].rotation;
+                values[0][lane] = rotation.x;
+                values[1][lane] = rotation.y;
+                values[2][lane] = rotation.z;
+                values[3][lane] = rotation.w;
+            }
+
+            return {{SimdFloat4::LoadAligned(values[0]), SimdFloat4::LoadAligned(values[1]),
+                     SimdFloat4::LoadAligned(values[2])},
+                    SimdFloat4::LoadAligned(values[3])};
+        }
+
+        template <typename T, auto Body, typename F>
+        SimdFloat4 GatherShapeLanes(const CollideContext& context, const std::size_t firstTask,
+                                    const std::size_t taskCount, F&& getValue) {
+            return GatherLanes(firstTask, taskCount, [&](const std::size_t task) {
+                return getValue(static_cast<const T&>(*context.bodies[context.tasks[task].*Body].shape));
+            });
+        }
+
+        struct SimdContacts {
+            alignas(16) float normal[3][SimdFloat4::Width];
+            alignas(16) float pointA[3][SimdFloat4::Width];
+            alignas(16) float pointB[3][SimdFloat4::Width];
+            alignas(16) float depth[SimdFloat4::Width];
+            int touchingMask;
+
+            void Store(const SimdVector3& normalLanes, const SimdVector3& pointALanes, const SimdVector3& pointBLanes,
+                       const SimdFloat4& depthLanes) {
+                const SimdVector3* lanes[3] = {&normalLanes, &pointALanes, &pointBLanes};
+                float (*outputs[3])[SimdFloat4::Width] = {normal, pointA, pointB};
+                for (std::size_t i = 0; i < 3; ++i) {
+                    lanes[i]->x.StoreAligned(outputs[i][0]);
+                    lanes[i]->y.StoreAligned(outputs[i][1]);
+                    lanes[i]->z.StoreAligned(outputs[i][2]);
+                }
+
+                depthLanes.StoreAligned(depth);
+            }
+
+            bool IsTouching(const std::size_t lane) const {
+                return (touchingMask >> lane) & 1;
+            }
+
+            static Vector3 GetLane(const float (&values)[3][SimdFloat4::Width], const std::size_t lane) {
+                return {values[0][lane], values[1][lane], values[2][lane]};
+            }
+        };
+
+        /**
+         * @brief Computes the contacts between spheres, or between spheres and the closest points of round shapes.
+         */
+        void ComputeSphereContacts(const CollideContext& context, const SimdVector3& centerA,
+                                   const SimdFloat4& radiusA, const SimdVector3& centerB, const SimdFloat4& radiusB,
+                                   SimdContacts& contacts) {
+            const SimdVector3 offset = centerB - centerA;
+            const SimdFloat4 squaredDistance = Dot(offset, offset);
+            const SimdFloat4 radiusSum = radiusA + radiusB;
+            const SimdFloat4 maxDistance = radiusSum + SimdFloat4::Splat(context.contactMargin);
+            contacts.touchingMask = SimdFloat4::LessEqual(squaredDistance, maxDistance * maxDistance).GetMoveMask();
+
+            // Concentric spheres are pushed apart along Y
+            constexpr float MinDistance = 1e-6f;
+            const SimdFloat4 distance = SimdFloat4::Sqrt(squaredDistance);
+            const SimdFloat4 separated = SimdFloat4::Greater(distance, SimdFloat4::Splat(MinDistance));
+            const SimdFloat4 inverseDistance =
+                SimdFloat4::Splat(1.f) / SimdFloat4::Max(distance, SimdFloat4::Splat(MinDistance));
+            SimdVector3 normal = offset * inverseDistance;
+            normal.y = SimdFloat4::Select(separated, normal.y, SimdFloat4::Splat(1.f));
+
+            contacts.Store(normal, centerA + normal * radiusA, centerB - normal * radiusB, radiusSum - distance);
+        }
+
+        void WriteContacts(const CollideContext& context, const std::size_t firstTask, const std::size_t taskCount,
+                           const SimdContacts& contacts) {
+            for (std::size_t lane = 0; lane < taskCount; ++lane) {
+                ContactManifold& manifold = BeginManifold(context, firstTask + lane);
+                if (!contacts.IsTouching(lane)) {
+                    continue;
+                }
+
+                manifold.normal = SimdContacts::GetLane(contacts.normal, lane);
+                AddContactPoint(manifold, context.bodies[manifold.bodyA], context.bodies[manifold.bodyB],
+                                SimdContacts::GetLane(contacts.pointA, lane),
+                                SimdContacts::GetLane(contacts.pointB, lane), contacts.depth[lane]);
+            }
+        }
+
+        void CollideSpheres(const CollideContext& context, const std::size_t firstTask, const std::size_t lastTask) {
+            for (std::size_t first = firstTask; first < lastTask; first += SimdFloat4::Width) {
+                const std::size_t count = std::min(SimdFloat4::Width, lastTask - first);
+
+                const auto getRadius = [](const SphereShape& sphere) { return sphere.GetRadius(); };
+                SimdContacts contacts;
+                ComputeSphereContacts(context, GatherPositions<&BroadphasePair::first>(context, first, count),
+                                      GatherShapeLanes<SphereShape, &BroadphasePair::first>(context, first, count,
+                                                                                            getRadius),
+                                      GatherPositions<&BroadphasePair::second>(context, first, count),
+                                      GatherShapeLanes<SphereShape, &BroadphasePair::second>(context, first, count,
+                                                                                             getRadius),
+                                      contacts);
+
+                WriteContacts(context, first, count, contacts);
+            }
+        }
+
+        void CollideSphereCapsule(const CollideContext& context, const std::size_t firstTask,
+                                  const std::size_t lastTask) {
+            for (std::size_t first = firstTask; first < lastTask; first += SimdFloat4::Width) {
+                const std::size_t count = std::min(SimdFloat4::Width, lastTask - first);
+
+                const SimdVector3 center = GatherPositions<&BroadphasePair::first>(context, first, count);
+                const SimdFloat4 radius = GatherShapeLanes<SphereShape, &BroadphasePair::first>(
+                    context, first, count, [](const SphereShape& sphere) { return sphere.GetRadius(); });
+
+                const SimdVector3 capsuleCenter = GatherPositions<&BroadphasePair::second>(context, first, count);
+                const SimdQuaternion capsuleRotation = GatherRotations<&BroadphasePair::second>(context, first, count);
+                const SimdFloat4 halfHeight = GatherShapeLanes<CapsuleShape, &BroadphasePair::second>(
+                    context, first, count, [](const CapsuleShape& capsule) { return capsule.GetHalfHeight(); });
+                const SimdFloat4 capsuleRadius = GatherShapeLanes<CapsuleShape, &BroadphasePair::second>(
+                    context, first, count, [](const CapsuleShape& capsule) { return capsule.GetRadius(); });
+
+                // Point of the capsule segment closest to the sphere center
+                const SimdVector3 axis = Rotate(capsuleRotation, {SimdFloat4::Zero(), halfHeight, SimdFloat4::Zero()});
+                const SimdVector3 start = capsuleCenter - axis;
+                const SimdVector3 segment = axis * SimdFloat4::Splat(2.f);
+
+                const SimdFloat4 squaredLength =
+                    SimdFloat4::Max(Dot(segment, segment), SimdFloat4::Splat(std::numeric_limits<float>::min()));
+                const SimdFloat4 t = SimdFloat4::Min(
+                    SimdFloat4::Max(Dot(center - start, segment) / squaredLength, SimdFloat4::Zero()),
+                    SimdFloat4::Splat(1.f));
+
+                SimdContacts contacts;
+                ComputeSphereContacts(context, center, radius, start + segment * t, capsuleRadius, contacts);
+
+                WriteContacts(context, first, count, contacts);
+            }
+        }
+
+        void CollideSphereBox(const CollideContext& context, const std::size_t firstTask, const std::size_t lastTask) {
+            for (std::size_t first = firstTask; first < lastTask; first += SimdFloat4::Width) {
+                const std::size_t count = std::min(SimdFloat4::Width, lastTask - first);
+
+                const SimdVector3 center = GatherPositions<&BroadphasePair::first>(context, first, count);
+                const SimdFloat4 radius = GatherShapeLanes<SphereShape, &BroadphasePair::first>(
+                    context, first, count, [](const SphereShape& sphere) { return sphere.GetRadius(); });
+
+                const SimdVector3 boxCenter = GatherPositions<&BroadphasePair::second>(context, first, count);
+                const SimdQuaternion boxRotation = GatherRotations<&BroadphasePair::second>(context, first, count);
+                const SimdVector3 halfExtents = {
+                    GatherShapeLanes<BoxShape, &BroadphasePair::second>(
+                        context, first, count, [](const BoxShape& box) { return box.GetHalfExtents().x; }),
+                    GatherShapeLanes<BoxShape, &BroadphasePair::second>(
+                        context, first, count, [](const BoxShape& box) { return box.GetHalfExtents().y; }),
+                    GatherShapeLanes<BoxShape, &BroadphasePair::second>(
+                        context, first, count, [](const BoxShape& box) { return box.GetHalfExtents().z; })};
+
+                // Point of the box closest to the sphere center, in the box space
+                const SimdQuaternion inverseRotation = {
+                    {-boxRotation.axis.x, -boxRotation.axis.y, -boxRotation.axis.z}, boxRotation.w};
+                const SimdVector3 localCenter = Rotate(inverseRotation, center - boxCenter);
+                const SimdVector3 localClosest = {
+                    SimdFloat4::Min(SimdFloat4::Max(localCenter.x, -halfExtents.x), halfExtents.x),
+                    SimdFloat4::Min(SimdFloat4::Max(localCenter.y, -halfExtents.y), halfExtents.y),
+                    SimdFloat4::Min(SimdFloat4::Max(localCenter.z, -halfExtents.z), halfExtents.z)};
+
+                const SimdVector3 localOffset = localClosest - localCenter;
+                const SimdFloat4 squaredDistance = Dot(localOffset, localOffset);
+                const SimdFloat4 maxDistance = radius + SimdFloat4::Splat(context.contactMargin);
+                const SimdFloat4 distance = SimdFloat4::Sqrt(squaredDistance);
+
+                constexpr float MinDistance = 1e-6f;
+                const SimdFloat4 inverseDistance =
+                    SimdFloat4::Splat(1.f) / SimdFloat4::Max(distance, SimdFloat4::Splat(MinDistance));
+                const SimdVector3 normal = Rotate(boxRotation, localOffset * inverseDistance);
+
+                SimdContacts contacts;
+                contacts.touchingMask = SimdFloat4::LessEqual(squaredDistance, maxDistance * maxDistance).GetMoveMask();
+                contacts.Store(normal, center + normal * radius, boxCenter + Rotate(boxRotation, localClosest),
+                               radius - distance);
+                const int insideMask =
+                    SimdFloat4::LessEqual(distance, SimdFloat4::Splat(MinDistance)).GetMoveMask();
+
+                alignas(16) float localCenters[3][SimdFloat4::Width];
+                localCenter.x.StoreAligned(localCenters[0]);
+                localCenter.y.StoreAligned(localCenters[1]);
+                localCenter.z.StoreAligned(localCenters[2]);
+
+                // Centers inside the box are pushed out through the closest face
+                for (std::size_t lane = 0; lane < count; ++lane) {
+                    if (!((insideMask >> lane) & 1)) {
+                        continue;
+                    }
+
+                    const BroadphasePair& task = context.tasks[first + lane];
+                    const CollisionBody& sphereBody = context.bodies[task.first];
+                    const CollisionBody& boxBody = context.bodies[task.second];
+                    const float sphereRadius = static_cast<const SphereShape&>(*sphereBody.shape).GetRadius();
+                    const Vector3& boxHalfExtents = static_cast<const BoxShape&>(*boxBody.shape).GetHalfExtents();
+
+                    float local[3] = {localCenters[0][lane], localCenters[1][lane], localCenters[2][lane]};
+                    const float extents[3] = {boxHalfExtents.x, boxHalfExtents.y, boxHalfExtents.z};
+
+                    std::size_t faceAxis = 0;
+                    for (std::size_t axis = 1; axis < 3; ++axis) {
+                        if (extents[axis] - std::abs(local[axis]) < extents[faceAxis] - std::abs(local[faceAxis])) {
+                            faceAxis = axis;
+                        }
+                    }
+
+                    const float faceSign = (local[faceAxis] >= 0.f) ? 1.f : -1.f;
+                    const float faceDistance = extents[faceAxis] - std::abs(local[faceAxis]);
+                    local[faceAxis] = faceSign * extents[faceAxis];
+
+                    float faceNormal[3] = {0.f, 0.f, 0.f};
+                    faceNormal[faceAxis] = faceSign;
+
+                    const Vector3 worldNormal =
+                        -(boxBody.rotation * Vector3(faceNormal[0], faceNormal[1], faceNormal[2]));
+                    const Vector3 pointA = sphereBody.position + worldNormal * sphereRadius;
+                    const Vector3 pointB = boxBody.position + boxBody.rotation * Vector3(local[0], local[1], local[2]);
+
+                    for (std::size_t component = 0; component < 3; ++component) {
+                        const float values[3][3] = {{worldNormal.x, worldNormal.y, worldNormal.z},
+                                                    {pointA.x, pointA.y, pointA.z},
+                                                    {pointB.x, pointB.y, pointB.z}};
+                        contacts.normal[component][lane] = values[0][component];
+                        contacts.pointA[component][lane] = values[1][component];
+                        contacts.pointB[component][lane] = values[2][component];
+                    }
+
+                    contacts.depth[lane] = sphereRadius + faceDistance;
+                }
+
+                WriteContacts(context, first, count, contacts);
+            }
+        }
+
+        // --- Feature clipping ---
+
+        struct Point2 {
+            float x;
+            float y;
+
+            Point2 operator+(const Point2& point) const { return {x + point.x, y + point.y}; }
+            Point2 operator-(const Point2& point) const { return {x - point.x, y - point.y}; }
+            Point2 operator*(const float scale) const { return {x * scale, y * scale}; }
+        };
+
+        float Cross2(const Point2& lhs, const Point2& rhs) {
+            return lhs.x * rhs.y - lhs.y * rhs.x;
+        }
+
+        float Dot2(const Point2& lhs, const Point2& rhs) {
+            return lhs.x * rhs.x + lhs.y * rhs.y;
+        }
+
+        struct ClipPoint {
+            Vector3 pointA;
+            Vector3 pointB;
+        };
+
+        struct ContactCandidate {
+            Vector3 pointA;
+            Vector3 pointB;
+            float depth;
+        };
+
+        /**
+         * @brief Plane coordinates in which the features are clipped, heights being measured along the normal.
+         */
+        struct ClipFrame {
+            Vector3 origin;
+            Vector3 tangent;
+            Vector3 bitangent;
+            Vector3 normal;
+
+            ClipFrame(const Vector3& frameOrigin, const Vector3& frameNormal) :
+            origin(frameOrigin),
+            normal(frameNormal) {
+                // Building an orthonormal basis from a unit vector, Duff et al. 2017
+                const float sign = std::copysign(1.f, normal.z);
+                const float a = -1.f / (sign + normal.z);
+                const float b = normal.x * normal.y * a;
+                tangent = {1.f + sign * normal.x * normal.x * a, sign * b, -sign * normal.x};
+                bitangent = {b, sign + normal.y * normal.y * a, -normal.y};
+            }
+
+            Point2 Project(const Vector3& point) const {
+                const Vector3 offset = point - origin;
+                return {offset.Dot(tangent), offset.Dot(bitangent)};
+            }
+
+            Vector3 Unproject(const Point2& point, const float height) const {
+                return origin + tangent * point.x + bitangent * point.y + normal * height;
+            }
+        };
+
+        /**
+         * @brief Computes the convex hull of projected points, counter-clockwise, with Andrew's monotone chain.
+         * @return Hull vertices, as indices of the points. Collinear points give the two ends of the segment.
+         */
+        SmallVector<UInt32, 8> ComputeHull(const SmallVector<Point2, 8>& points) {
+            constexpr float Epsilon = 1e-6f;
+
+            SmallVector<UInt32, 8> order;
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                order.push_back(static_cast<UInt32>(i));
+            }
+
+            std::sort(order.begin(), order.end(), [&](const UInt32 lhs, const UInt32 rhs) {
+                return points[lhs].x < points[rhs].x ||
+                       (points[lhs].x == points[rhs].x && points[lhs].y < points[rhs].y);
+            });
+
+            SmallVector<UInt32, 8> hull;
+            const auto addToChain = [&](const UInt32 index, const std::size_t chainStart) {
+                while (hull.size() >= chainStart + 2 &&
+                       Cross2(points[hull[hull.size() - 1]] - points[hull[hull.size() - 2]],
+                              points[index] - points[hull[hull.size() - 2]]) <= Epsilon) {
+                    hull.pop_back();
+                }
+
+                hull.push_back(index);
+            };
+
+            for (const UInt32 index : order) {
+                addToChain(index, 0);
+            }
+
+            const std::size_t upperStart = hull.size() - 1;
+            for (std::size_t i = order.size() - 1; i-- > 0;) {
+                addToChain(order[i], upperStart);
+            }
+
+            // The last point closes the chain on the first one
+            if (hull.size() > 1) {
+                hull.pop_back();
+            }
+
+            if (hull.size() == 2) {
+                const Point2 offset = points[hull[1]] - points[hull[0]];
+                if (Dot2(offset, offset) <= Epsilon * Epsilon) {
+                    hull.pop_back();
+                }
+            }
+
+            return hull;
+        }
+
+        /**
+         * @brief Height of a feature along the clipping normal, at any point of the clipping plane.
+         */
+        class FeatureSurface {
+        public:
+            FeatureSurface(const ClipFrame& frame, const ShapeFeature& feature, const SmallVector<Point2, 8>& projected,
+                           const SmallVector<UInt32, 8>& hull) :
+            m_hullSize(hull.size()) {
+                m_origin = projected[hull[0]];
+                m_heights[0] = (feature[hull[0]] - frame.origin).Dot(frame.normal);
+                m_flat = true;
+
+                if (m_hullSize == 2) {
+                    m_direction = projected[hull[1]] - m_origin;
+                    m_heights[1] = (feature[hull[1]] - frame.origin).Dot(frame.normal);
+                } else if (m_hullSize >= 3) {
+                    // Newell's method gives the plane normal of a polygon
+                    Vector3 planeNormal = Vector3::Zero();
+                    Vector3 centroid = Vector3::Zero();
+                    for (std::size_t i = 0; i < m_hullSize; ++i) {
+                        const Vector3& current = feature[hull[i]];
+                        const Vector3& next = feature[hull[(i + 1) % m_hullSize]];
+                        planeNormal += Vector3((current.y - next.y) * (current.z + next.z),
+                                               (current.z - next.z) * (current.x + next.x),
+                                               (current.x - next.x) * (current.y + next.y));
+                        centroid += current;
+                    }
+
+                    centroid = centroid / static_cast<float>(m_hullSize);
+                    m_heights[0] = (centroid - frame.origin).Dot(frame.normal);
+
+                    // Faces almost parallel to the normal are taken as flat
+                    const float alignment = planeNormal.Dot(frame.normal);
+                    if (std::abs(alignment) > 0.1f * planeNormal.GetLength()) {
+                        m_origin = frame.Project(centroid);
+                        m_slope = {-planeNormal.Dot(frame.tangent) / alignment,
+                                   -planeNormal.Dot(frame.bitangent) / alignment};
+                        m_flat = false;
+                    }
+                }
+            }
+
+            float GetHeight(const Point2& point) const {
+                if (m_hullSize == 2) {
+                    const float squaredLength = Dot2(m_direction, m_direction);
+                    const float t = std::clamp(Dot2(point - m_origin, m_direction) / squaredLength, 0.f, 1.f);
+                    return m_heights[0] + (m_heights[1] - m_heights[0]) * t;
+                }
+
+                if (m_hullSize >= 3 && !m_flat) {
+                    return m_heights[0] + Dot2(point - m_origin, m_slope);
+                }
+
+                return m_heights[0];
+            }
+
+        private:
+            std::size_t m_hullSize;
+            Point2 m_origin;
+            Point2 m_direction;
+            Point2 m_slope;
+            float m_heights[2];
+            bool m_flat;
+        };
+
+        /**
+         * @brief Clips a point, a segment or a convex polygon against a counter-clockwise convex polygon.
+         */
+        void ClipAgainstPolygon(const SmallVector<Point2, 8>& subject, const SmallVector<Point2, 8>& polygon,
+                                SmallVector<Point2, 16>& output) {
+            const auto getSide = [&](const std::size_t edge, const Point2& point) {
+                const Point2& start = polygon[edge];
+                return Cross2(polygon[(edge + 1) % polygon.size()] - start, point - start);
+            };
+
+            if (subject.size() == 1) {
+                for (std::size_t edge = 0; edge < polygon.size(); ++edge) {
+                    if (getSide(edge, subject[0]) < 0.f) {
+                        return;
+                    }
+                }
+
+                output.push_back(subject[0]);
+                return;
+            }
+
+            if (subject.size() == 2) {
+                // Parametric clipping of the segment by each edge
+                const Point2 direction = subject[1] - subject[0];
+                float tMin = 0.f;
+                float tMax = 1.f;
+                for (std::size_t edge = 0; edge < polygon.size() && tMin <= tMax; ++edge) {
+                    const float start = getSide(edge, subject[0]);
+                    const float slope = getSide(edge, subject[0] + direction) - start;
+                    if (slope == 0.f) {
+                        tMax = (start < 0.f) ? -1.f : tMax;
+                    } else if (slope > 0.f) {
+                        tMin = std::max(tMin, -start / slope);
+                    } else {
+                        tMax = std::min(tMax, -start / slope);
+                    }
+                }
+
+                if (tMin <= tMax) {
+                    output.push_back(subject[0] + direction * tMin);
+                    output.push_back(subject[0] + direction * tMax);
+                }
+
+                return;
+            }
+
+            // Sutherland-Hodgman
+            SmallVector<Point2, 16> clipped(subject.begin(), subject.end());
+            SmallVector<Point2, 16> input;
+            for (std::size_t edge = 0; edge < polygon.size() && !clipped.empty(); ++edge) {
+                std::swap(input, clipped);
+                clipped.clear();
+
+                for (std::size_t i = 0; i < input.size(); ++i) {
+                    const Point2& current = input[i];
+                    const Point2& next = input[(i + 1) % input.size()];
+                    const float currentSide = getSide(edge, current);
+                    const float nextSide = getSide(edge, next);
+
+                    if (currentSide >= 0.f) {
+                        clipped.push_back(current);
+                    }
+
+                    if ((currentSide >= 0.f) != (nextSide >= 0.f)) {
+                        clipped.push_back(current + (next - current) * (currentSide / (currentSide - nextSide)));
+                    }
+                }
+            }
+
+            output.insert(output.end(), clipped.begin(), clipped.end());
+        }
+
+        /**
+         * @brief Intersects the features of two shapes facing each other, projected on the plane of the normal.
+         * @param featureA World points of the feature of the first shape.
+         * @param featureB World points of the feature of the second shape.
+         * @param normal Unit normal pointing from the first shape toward the second one.
+         * @param output Receives the pairs of points of both features above and below each point of the intersection.
+         */
+        void ClipFeatures(const ShapeFeature& featureA, const ShapeFeature& featureB, const Vector3& normal,
+                          SmallVector<ClipPoint, 16>& output) {
+            const ClipFrame frame(featureA[0], normal);
+
+            SmallVector<Point2, 8> projectedA;
+            SmallVector<Point2, 8> projectedB;
+            for (const Vector3& point : featureA) {
+                projectedA.push_back(frame.Project(point));
+            }
+
+            for (const Vector3& point : featureB) {
+                projectedB.push_back(frame.Project(point));
+            }
+
+            const SmallVector<UInt32, 8> hullA = ComputeHull(projectedA);
+            const SmallVector<UInt32, 8> hullB = ComputeHull(projectedB);
+
+            SmallVector<Point2, 8> polygonA;
+            SmallVector<Point2, 8> polygonB;
+            for (const UInt32 index : hullA) {
+                polygonA.push_back(projectedA[index]);
+            }
+
+            for (const UInt32 index : hullB) {
+                polygonB.push_back(projectedB[index]);
+            }
+
+            SmallVector<Point2, 16> intersection;
+            if (polygonA.size() >= 3) {
+                ClipAgainstPolygon(polygonB, polygonA, intersection);
+            } else if (polygonB.size() >= 3) {
+                ClipAgainstPolygon(polygonA, polygonB, intersection);
+            } else if (polygonA.size() == 2 && polygonB.size() == 2) {
+                // Parallel edges touch along their common part, crossing edges at a single point GJK already found
+                const Point2 directionA = polygonA[1] - polygonA[0];
+                const Point2 directionB = polygonB[1] - polygonB[0];
+                const float squaredLengthA = Dot2(directionA, directionA);
+                const float cross = Cross2(directionA, directionB);
+
+                const float squaredLengths = squaredLengthA * Dot2(directionB, directionB);
+                if (cross * cross <= ParallelTolerance * ParallelTolerance * squaredLengths) {
+                    const float t0 = Dot2(polygonB[0] - polygonA[0], directionA) / squaredLengthA;
+                    const float t1 = Dot2(polygonB[1] - polygonA[0], directionA) / squaredLengthA;
+                    const float tMin = std::max(std::min(t0, t1), 0.f);
+                    const float tMax = std::min(std::max(t0, t1), 1.f);
+
+                    if (tMin <= tMax) {
+                        intersection.push_back(polygonA[0] + directionA * tMin);
+                        intersection.push_back(polygonA[0] + directionA * tMax);
+                    }
+                }
+            }
+
+            if (intersection.empty()) {
+                return;
+            }
+
+            const FeatureSurface surfaceA(frame, featureA, projectedA, hullA);
+            const FeatureSurface surfaceB(frame, featureB, projectedB, hullB);
+            for (const Point2& point : intersection) {
+                output.push_back({frame.Unproject(point, surfaceA.GetHeight(point)),
+                                  frame.Unproject(point, surfaceB.GetHeight(point))});
+            }
+        }
+
+        /**
+         * @brief Keeps the ContactManifold::MaxPoints candidates best holding the bodies: the deepest one, the one
+         *        farthest from it and the two spanning the largest area on both sides of them.
+         */
+        SmallVector<std::size_t, ContactManifold::MaxPoints> ReduceContacts(
+            const SmallVector<ContactCandidate, 16>& candidates, const Vector3& normal) {
+            SmallVector<std::size_t, ContactManifold::MaxPoints> kept;
+            if (candidates.size() <= ContactManifold::MaxPoints) {
+                for (std::size_t i = 0; i < candidates.size(); ++i) {
+                    kept.push_back(i);
+                }
+
+                return kept;
+            }
+
+            const auto isKept = [&](const std::size_t index) {
+                return std::find(kept.begin(), kept.end(), index) != kept.end();
+            };
+
+            std::size_t deepest = 0;
+            for (std::size_t i = 1; i < candidates.size(); ++i) {
+                if (candidates[i].depth > candidates[deepest].depth) {
+                    deepest = i;
+                }
+            }
+
+            kept.push_back(deepest);
+            const Vector3& first = candidates[deepest].pointB;
+
+            std::size_t farthest = deepest;
+            for (std::size_t i = 0; i < candidates.size(); ++i) {
+                if ((candidates[i].pointB - first).GetSquaredLength() >
+                    (candidates[farthest].pointB - first).GetSquaredLength()) {
+                    farthest = i;
+                }
+            }
+
+            if (farthest == deepest) {
+                return kept;
+            }
+
+            kept.push_back(farthest);
+            const Vector3 edge = candidates[farthest].pointB - first;
+
+            // Signed areas of the triangles formed with the first two points
+            constexpr float MinArea = 1e-8f;
+            std::size_t positive = candidates.size();
+            std::size_t negative = candidates.size();
+            float maxArea = MinArea;
+            float minArea = -MinArea;
+            for (std::size_t i = 0; i < candidates.size(); ++i) {
+                const float area = edge.Cross(candidates[i].pointB - first).Dot(normal);
+                if (area > maxArea) {
+                    maxArea = area;
+                    positive = i;
+                } else if (area < minArea) {
+                    minArea = area;
+                    negative = i;
+                }
+            }
+
+            for (const std::size_t index : {positive, negative}) {
+                if (index < candidates.size()) {
+                    kept.push_back(index);
+                }
+            }
+
+            // All points on one side of the first two, complete with the point farthest from the kept ones
+            while (kept.size() < ContactManifold::MaxPoints && kept.size() > 2) {
+                std::size_t best = candidates.size();
+                float bestDistance = 0.f;
+                for (std::size_t i = 0; i < candidates.size(); ++i) {
+                    if (isKept(i)) {
+                        continue;
+                    }
+
+                    float distance = std::numeric_limits<float>::infinity();
+                    for (const std::size_t index : kept) {
+                        const Vector3 offset = candidates[i].pointB - candidates[index].pointB;
+                        distance = std::min(distance, offset.GetSquaredLength());
+                    }
+
+                    if (distance > bestDistance) {
+                        bestDistance = distance;
+                        best = i;
+                    }
+                }
+
+                if (best == candidates.size()) {
+                    break;
+                }
+
+                kept.push_back(best);
+            }
+
+            return kept;
+        }
+
+        /**
+         * @brief Collides any two convex shapes: GJK and EPA find the normal, then the features of both shapes along
+         *        it are clipped against each other.
+         */
+        template <typename ShapeA, typename ShapeB>
+        void CollideConvex(const CollideContext& context, const std::size_t firstTask, const std::size_t lastTask) {
+            ShapeFeature featureA;
+            ShapeFeature featureB;
+            SmallVector<ClipPoint, 16> clipPoints;
+            SmallVector<ContactCandidate, 16> candidates;
+
+            for (std::size_t task = firstTask; task < lastTask; ++task) {
+                ContactManifold& manifold = BeginManifold(context, task);
+
+                const CollisionBody& bodyA = context.bodies[manifold.bodyA];
+                const CollisionBody& bodyB = context.bodies[manifold.bodyB];
+                const auto& shapeA = static_cast<const ShapeA&>(*bodyA.shape);
+                const auto& shapeB = static_cast<const ShapeB&>(*bodyB.shape);
+                const Quaternion inverseRotationA = bodyA.rotation.GetConjugate();
+                const Quaternion inverseRotationB = bodyB.rotation.GetConjugate();
+
+                const auto supportA = [&](const Vector3& direction) {
+                    return bodyA.position + bodyA.rotation * shapeA.GetSupport(inverseRotationA * direction);
+                };
+
+                const auto supportB = [&](const Vector3& direction) {
+                    return bodyB.position + bodyB.rotation * shapeB.GetSupport(inverseRotationB * direction);
+                };
+
+                // Core shapes are collided, then inflated by their rounding radii
+                const float radiusA = shapeA.GetRoundingRadius();
+                const float radiusB = shapeB.GetRoundingRadius();
+                const GjkResult distance = ComputeGjkDistance(supportA, supportB, bodyB.position - bodyA.position);
+
+                Vector3 normal;
+                ClipPoint closest;
+                float coreDepth;
+                if (!distance.overlapping) {
+                    if (distance.distance > radiusA + radiusB + context.contactMargin) {
+                        continue;
+                    }
+
+                    normal = (distance.pointB - distance.pointA) / distance.distance;
+                    closest = {distance.pointA, distance.pointB};
+                    coreDepth = -distance.distance;
+                } else {
+                    const std::optional<EpaResult> penetration =
+                        ComputeEpaPenetration(supportA, supportB, distance.simplex);
+                    if (!penetration) {
+                        continue;
+                    }
+
+                    normal = penetration->normal;
+                    closest = {penetration->pointA, penetration->pointB};
+                    coreDepth = penetration->depth;
+                }
+
+                shapeA.GetSupportingFeature(inverseRotationA * normal, featureA);
+                shapeB.GetSupportingFeature(inverseRotationB * -normal, featureB);
+                for (Vector3& point : featureA) {
+                    point = bodyA.position + bodyA.rotation * point;
+                }
+
+                for (Vector3& point : featureB) {
+                    point = bodyB.position + bodyB.rotation * point;
+                }
+
+                clipPoints.clear();
+                ClipFeatures(featureA, featureB, normal, clipPoints);
+
+                candidates.clear();
+                for (const ClipPoint& point : clipPoints) {
+                    const float depth = (point.pointA - point.pointB).Dot(normal) + radiusA + radiusB;
+                    if (depth >= -context.contactMargin) {
+                        candidates.push_back({point.pointA + normal * radiusA, point.pointB - normal * radiusB, depth});
+                    }
+                }
+
+                // Crossing edges, or features too tilted to be clipped
+                if (candidates.empty()) {
+                    candidates.push_back({closest.pointA + normal * radiusA, closest.pointB - normal * radiusB,
+                                          coreDepth + radiusA + radiusB});
+                }
+
+                manifold.normal = normal;
+                for (const std::size_t index : ReduceContacts(candidates, normal)) {
+                    const ContactCandidate& candidate = candidates[index];
+                    AddContactPoint(manifold, bodyA, bodyB, candidate.pointA, candidate.pointB, candidate.depth);
+                }
+            }
+        }
+
+        // --- Dispatch table ---
+
+        template <std::size_t A, std::size_t B>
+        constexpr CollideFunction SelectCollideFunction() {
+            using ShapeA = std::tuple_element_t<A, ShapeClasses>;
+            using ShapeB = std::tuple_element_t<B, ShapeClasses>;
+
+            if constexpr (A > B) {
+                return nullptr; //< Pairs are ordered by shape type, only the upper half of the table is used
+            } else if constexpr (ShapeA::Type == ShapeType::Sphere && ShapeB::Type == ShapeType::Sphere) {
+                return &CollideSpheres;
+            } else if constexpr (ShapeA::Type == ShapeType::Sphere && ShapeB::Type == ShapeType::Capsule) {
+                return &CollideSphereCapsule;
+            } else if constexpr (ShapeA::Type == ShapeType::Sphere && ShapeB::Type == ShapeType::Box) {
+                return &CollideSphereBox;
+            } else {
+                return &CollideConvex<ShapeA, ShapeB>;
+            }
+        }
+
+        template <std::size_t... I>
+        constexpr std::array<CollideFunction, sizeof...(I)> BuildCollideTable(std::index_sequence<I...>) {
+            return {SelectCollideFunction<I / Narrowphase::ShapeTypeCount, I % Narrowphase::ShapeTypeCount>()...};
+        }
+
+        // Collision routine of each pair of shape types, indexed by typeA * ShapeTypeCount + typeB
+        constexpr std::array<CollideFunction, Narrowphase::ShapeTypeCount * Narrowphase::ShapeTypeCount> CollideTable =
+            BuildCollideTable(std::make_index_sequence<Narrowphase::ShapeTypeCount * Narrowphase::ShapeTypeCount>());
+
+        template <std::size_t... I>
+        std::array<UInt64, sizeof...(I)> GetShapeClassIds(std::index_sequence<I...>) {
+            return {BaseObject::GetInfo<std::tuple_element_t<I, ShapeClasses>>().id...};
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    Narrowphase::Narrowphase(const float contactMargin) :
+    m_contactMargin(contactMargin) {
+        FlAssertMsg(contactMargin >= 0.f, "[Physics/Narrowphase] Contact margin must be positive.");
+    }
+
+    void Narrowphase::Collide(const std::span<const CollisionBody> bodies, const std::span<const BroadphasePair> pairs,
+                              ThreadPool* threadPool) {
+        FlAssertMsg(std::is_sorted(pairs.begin(), pairs.end(),
+                                   [](const BroadphasePair& lhs, const BroadphasePair& rhs) {
+                                       return lhs.GetKey() < rhs.GetKey();
+                                   }),
+                    "[Physics/Narrowphase] Pairs must be sorted by key.");
+
+        std::swap(m_manifolds, m_previousManifolds);
+        MatchPreviousManifolds(pairs);
+        BuildTasks(bodies, pairs);
+        m_pairManifolds.resize(pairs.size());
+
+        const CollideContext context{bodies, m_tasks, m_taskPairs, m_pairManifolds, m_contactMargin};
+        const auto collideRange = [&](const std::size_t first, const std::size_t last) {
+            // Batches may span several type pairs
+            for (std::size_t group = 0; group < CollideTable.size(); ++group) {
+                const std::size_t groupFirst = std::max<std::size_t>(first, m_groupOffsets[group]);
+                const std::size_t groupLast = std::min<std::size_t>(last, m_groupOffsets[group + 1]);
+                if (groupFirst < groupLast) {
+                    CollideTable[group](context, groupFirst, groupLast);
+                }
+            }
+
+            WarmStart(first, last);
+        };
+
+        if (threadPool && m_tasks.size() > BatchSize) {
+            threadPool->ParallelFor(m_tasks.size(), BatchSize, collideRange);
+        } else {
+            collideRange(0, m_tasks.size());
+        }
+
+        // Manifolds of touching pairs, in the order of the pairs
+        m_manifolds.clear();
+        for (const ContactManifold& manifold : m_pairManifolds) {
+            if (manifold.pointCount > 0) {
+                m_manifolds.push_back(manifold);
+            }
+        }
+    }
+
+    const ContactManifold* Narrowphase::FindManifold(const UInt32 bodyA, const UInt32 bodyB) const {
+        const UInt64 key = BroadphasePair{std::min(bodyA, bodyB), std::max(bodyA, bodyB)}.GetKey();
+        const auto it = std::lower_bound(m_manifolds.begin(), m_manifolds.end(), key,
+                                         [](const ContactManifold& manifold, const UInt64 value) {
+                                             return manifold.GetKey() < value;
+                                         });
+
+        return (it != m_manifolds.end() && it->GetKey() == key) ? &*it : nullptr;
+    }
+
+    float Narrowphase::GetContactMargin() const {
+        return m_contactMargin;
+    }
+
+    std::span<ContactManifold> Narrowphase::GetManifolds() {
+        return m_manifolds;
+    }
+
+    std::span<const ContactManifold> Narrowphase::GetManifolds() const {
+        return m_manifolds;
+    }
+
+    ShapeType Narrowphase::GetShapeType(const Shape& shape) {
+        // Class identifiers are assigned at runtime, the first time each class asks for one
+        static const std::array<UInt64, ShapeTypeCount> classIds =
+            GetShapeClassIds(std::make_index_sequence<ShapeTypeCount>());
+
+        for (std::size_t type = 0; type < classIds.size(); ++type) {
+            if (classIds[type] == shape.GetClassId()) {
+                return static_cast<ShapeType>(type);
+            }
+        }
+
+        FlAssertMsg(false, "[Physics/Narrowphase] Shape class has no collision routine.");
+        return ShapeType::ConvexHull;
+    }
+
+    void Narrowphase::BuildTasks(const std::span<const CollisionBody> bodies,
+                                 const std::span<const BroadphasePair> pairs) {
+        // Bodies of a task are ordered by shape type, so that a routine only handles one order
+        const auto getTask = [&](const BroadphasePair& pair, std::size_t& group) {
+            FlAssertMsg(pair.first < pair.second && pair.second < bodies.size(),
+                        "[Physics/Narrowphase] Invalid pair.");
+            FlAssertMsg(bodies[pair.first].shape && bodies[pair.second].shape,
+                        "[Physics/Narrowphase] Paired body has no shape.");
+
+            const auto typeA = static_cast<std::size_t>(GetShapeType(*bodies[pair.first].shape));
+            const auto typeB = static_cast<std::size_t>(GetShapeType(*bodies[pair.second].shape));
+            group = std::min(typeA, typeB) * ShapeTypeCount + std::max(typeA, typeB);
+
+            return (typeA <= typeB) ? pair : BroadphasePair{pair.second, pair.first};
+        };
+
+        // Counting sort of the pairs by type pair, keeping their order within each group
+        m_groupOffsets.fill(0);
+        for (const BroadphasePair& pair : pairs) {
+            std::size_t group;
+            getTask(pair, group);
+            ++m_groupOffsets[group + 1];
+        }
+
+        for (std::size_t group = 1; group < m_groupOffsets.size(); ++group) {
+            m_groupOffsets[group] += m_groupOffsets[group - 1];
+        }
+
+        std::array<UInt32, ShapeTypeCount * ShapeTypeCount> cursors;
+        std::copy_n(m_groupOffsets.begin(), cursors.size(), cursors.begin());
+
+        m_tasks.resize(pairs.size());
+        m_taskPairs.resize(pairs.size());
+        for (std::size_t i = 0; i < pairs.size(); ++i) {
+            std::size_t group;
+            const BroadphasePair task = getTask(pairs[i], group);
+
+            const UInt32 taskIndex = cursors[group]++;
+            m_tasks[taskIndex] = task;
+            m_taskPairs[taskIndex] = static_cast<UInt32>(i);
+        }
+    }
+
+    void Narrowphase::MatchPreviousManifolds(const std::span<const BroadphasePair> pairs) {
+        // Both pairs and previous manifolds are sorted by key
+        m_previousIndices.assign(pairs.size(), InvalidManifold);
+
+        std::size_t previous = 0;
+        for (std::size_t i = 0; i < pairs.size() && previous < m_previousManifolds.size(); ++i) {
+            const UInt64 key = pairs[i].GetKey();
+            while (previous < m_previousManifolds.size() && m_previousManifolds[previous].GetKey() < key) {
+                ++previous;
+            }
+
+            if (previous < m_previousManifolds.size() && m_previousManifolds[previous].GetKey() == key) {
+                m_previousIndices[i] = static_cast<UInt32>(previous);
+            }
+        }
+    }
+
+    void Narrowphase::WarmStart(const std::size_t firstTask, const std::size_t lastTask) {
+        for (std::size_t task = firstTask; task < lastTask; ++task) {
+            const UInt32 pair = m_taskPairs[task];
+            ContactManifold& manifold = m_pairManifolds[pair];
+
+            UInt32 nextFeatureId = 0;
+            bool matched[ContactManifold::MaxPoints] = {};
+
+            const UInt32 previousIndex = m_previousIndices[pair];
+            if (previousIndex != InvalidManifold && m_previousManifolds[previousIndex].bodyA == manifold.bodyA) {
+                const ContactManifold& previous = m_previousManifolds[previousIndex];
+                for (std::size_t i = 0; i < previous.pointCount; ++i) {
+                    nextFeatureId = std::max(nextFeatureId, previous.points[i].featureId + 1);
+                }
+
+                // A point continues the closest previous point, if it didn't move much on both bodies
+                for (std::size_t i = 0; i < manifold.pointCount; ++i) {
+                    ContactPoint& point = manifold.points[i];
+
+                    std::size_t best = previous.pointCount;
+                    float bestDistance = PersistenceDistance * PersistenceDistance;
+                    for (std::size_t j = 0; j < previous.pointCount; ++j) {
+                        const ContactPoint& previousPoint = previous.points[j];
+                        const float distanceA = (point.localPointA - previousPoint.localPointA).GetSquaredLength();
+                        const float distanceB = (point.localPointB - previousPoint.localPointB).GetSquaredLength();
+                        if (!matched[j] && distanceA <= bestDistance && distanceB <= bestDistance) {
+                            best = j;
+                            bestDistance = std::max(distanceA, distanceB);
+                        }
+                    }
+
+                    if (best == previous.pointCount) {
+                        point.featureId = nextFeatureId++;
+                        continue;
+                    }
+
+                    matched[best] = true;
+                    point.featureId = previous.points[best].featureId;
+                    point.normalImpulse = previous.points[best].normalImpulse;
+                    point.tangentImpulses[0] = previous.points[best].tangentImpulses[0];
+                    point.tangentImpulses[1] = previous.points[best].tangentImpulses[1];
+                }
+
+                continue;
+            }
+
+            for (std::size_t i = 0; i < manifold.pointCount; ++i) {
+                manifold.points[i].featureId = nextFeatureId++;
+            }
+        }
+    }
+} // namespace Fl
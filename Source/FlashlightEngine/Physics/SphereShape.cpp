@@ -0,0 +1,19 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/SphereShape.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+namespace Fl {
+    SphereShape::SphereShape(const float radius) :
+    Shape(GetInfo<SphereShape>().id),
+    m_radius(radius) {
+        FlAssertMsg(radius > 0.f, "[Physics/SphereShape] Radius must be positive.");
+    }
+
+    Aabb SphereShape::ComputeBounds(const Vector3& position, const Quaternion&) const {
+        return Aabb::FromCenterExtents(position, Vector3(m_radius));
+    }
+} // namespace Fl
@@ -0,0 +1,238 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Physics/SweepAndPruneBroadphase.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <span>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        float GetComponent(const Vector3& vector, const std::size_t axis) {
+            return (axis == 0) ? vector.x : ((axis == 1) ? vector.y : vector.z);
+        }
+
+        /**
+         * @brief Sorts almost sorted elements, giving up once too many elements were shifted.
+         * @return Whether the elements are sorted.
+         */
+        template <typename T, typename Compare>
+        bool InsertionSort(const std::span<T> elements, std::size_t maxShifts, Compare&& compare) {
+            for (std::size_t i = 1; i < elements.size(); ++i) {
+                const T element = elements[i];
+
+                std::size_t position = i;
+                for (; position > 0 && compare(element, elements[position - 1]); --position) {
+                    if (maxShifts-- == 0) {
+                        elements[position] = element;
+                        return false;
+                    }
+
+                    elements[position] = elements[position - 1];
+                }
+
+                elements[position] = element;
+            }
+
+            return true;
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    auto SweepAndPruneBroadphase::CreateProxy(const Aabb& bounds, const UInt64 userData) -> ProxyId {
+        const ProxyId proxy = AllocateProxy(bounds, userData);
+
+        // Appended unsorted, the next update sorts them
+        for (std::size_t axis = 0; axis < m_axes.size(); ++axis) {
+            m_axes[axis].push_back({GetComponent(bounds.min, axis), GetComponent(bounds.max, axis), proxy});
+        }
+
+        return proxy;
+    }
+
+    void SweepAndPruneBroadphase::DestroyProxy(const ProxyId proxy) {
+        FreeProxy(proxy);
+        m_hasDestroyedProxies = true;
+    }
+
+    void SweepAndPruneBroadphase::FindPairs(std::vector<BroadphasePair>& pairs, ThreadPool* threadPool) {
+        if (threadPool) {
+            threadPool->ParallelFor(m_axes.size(), 1, [&](const std::size_t first, std::size_t) { UpdateAxis(first); });
+        } else {
+            for (std::size_t axis = 0; axis < m_axes.size(); ++axis) {
+                UpdateAxis(axis);
+            }
+        }
+
+        // Destroyed proxies left the axes, their identifiers can be given to new proxies
+        m_sortedCount = m_axes[0].size();
+        m_hasDestroyedProxies = false;
+        RecycleProxies();
+
+        m_sweepAxis = SelectSweepAxis();
+        PackSweepAxis();
+
+        const std::vector<Interval>& intervals = m_axes[m_sweepAxis];
+        const auto sweepRange = [&](std::vector<BroadphasePair>& output, const std::size_t first,
+                                    const std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                const SimdFloat4 sweepMax = SimdFloat4::Splat(m_sweepMax[i]);
+                const SimdFloat4 crossMinA = SimdFloat4::Splat(m_crossMin[0][i]);
+                const SimdFloat4 crossMaxA = SimdFloat4::Splat(m_crossMax[0][i]);
+                const SimdFloat4 crossMinB = SimdFloat4::Splat(m_crossMin[1][i]);
+                const SimdFloat4 crossMaxB = SimdFloat4::Splat(m_crossMax[1][i]);
+
+                // Only the intervals starting before the end of this one can overlap it, they come first
+                for (std::size_t j = i + 1;; j += SimdFloat4::Width) {
+                    const SimdFloat4 candidates = SimdFloat4::LessEqual(SimdFloat4::Load(&m_sweepMin[j]), sweepMax);
+                    if (candidates.GetMoveMask() == 0) {
+                        break;
+                    }
+
+                    const SimdFloat4 overlapA =
+                        SimdFloat4::LessEqual(SimdFloat4::Load(&m_crossMin[0][j]), crossMaxA) &
+                        SimdFloat4::GreaterEqual(SimdFloat4::Load(&m_crossMax[0][j]), crossMinA);
+                    const SimdFloat4 overlapB =
+                        SimdFloat4::LessEqual(SimdFloat4::Load(&m_crossMin[1][j]), crossMaxB) &
+                        SimdFloat4::GreaterEqual(SimdFloat4::Load(&m_crossMax[1][j]), crossMinB);
+
+                    auto mask = static_cast<unsigned int>((candidates & overlapA & overlapB).GetMoveMask());
+                    for (; mask != 0; mask &= mask - 1) {
+                        const ProxyId proxy = intervals[i].proxy;
+                        const ProxyId other = intervals[j + static_cast<std::size_t>(std::countr_zero(mask))].proxy;
+                        output.push_back({std::min(proxy, other), std::max(proxy, other)});
+                    }
+                }
+            }
+        };
+
+        FindPairsInBatches(intervals.size(), pairs, threadPool, sweepRange);
+
+        // Pairs come in sweep order, which depends on the positions
+        std::sort(pairs.begin(), pairs.end(), [](const BroadphasePair& lhs, const BroadphasePair& rhs) {
+            return lhs.GetKey() < rhs.GetKey();
+        });
+    }
+
+    std::size_t SweepAndPruneBroadphase::GetSweepAxis() const {
+        return m_sweepAxis;
+    }
+
+    void SweepAndPruneBroadphase::MoveProxy(const ProxyId proxy, const Aabb& bounds) {
+        FlAssertMsg(IsValid(proxy), "[Physics/SweepAndPruneBroadphase] Invalid proxy.");
+        FlAssertMsg(bounds.IsValid(), "[Physics/SweepAndPruneBroadphase] Invalid proxy bounds.");
+
+        m_proxyBounds[proxy] = bounds;
+    }
+
+    void SweepAndPruneBroadphase::PackSweepAxis() {
+        const std::vector<Interval>& intervals = m_axes[m_sweepAxis];
+        const std::size_t crossAxes[2] = {(m_sweepAxis + 1) % 3, (m_sweepAxis + 2) % 3};
+
+        // Two SIMD groups of padding: a sweep stops at the first group without candidate, which may start right
+        // after the last interval
+        constexpr float Infinity = std::numeric_limits<float>::infinity();
+        const std::size_t paddedSize = intervals.size() + 2 * SimdFloat4::Width;
+        m_sweepMin.assign(paddedSize, Infinity);
+        m_sweepMax.assign(paddedSize, -Infinity);
+        for (std::size_t i = 0; i < 2; ++i) {
+            m_crossMin[i].assign(paddedSize, Infinity);
+            m_crossMax[i].assign(paddedSize, -Infinity);
+        }
+
+        for (std::size_t i = 0; i < intervals.size(); ++i) {
+            const Aabb& bounds = m_proxyBounds[intervals[i].proxy];
+            m_sweepMin[i] = intervals[i].min;
+            m_sweepMax[i] = intervals[i].max;
+
+            for (std::size_t crossAxis = 0; crossAxis < 2; ++crossAxis) {
+                m_crossMin[crossAxis][i] = GetComponent(bounds.min, crossAxes[crossAxis]);
+                m_crossMax[crossAxis][i] = GetComponent(bounds.max, crossAxes[crossAxis]);
+            }
+        }
+    }
+
+    std::size_t SweepAndPruneBroadphase::SelectSweepAxis() const {
+        // Variance of the proxy centers along each axis, accumulated in double to stay accurate on large worlds
+        double sums[3] = {};
+        double squaredSums[3] = {};
+        std::size_t count = 0;
+
+        for (std::size_t proxy = 0; proxy < m_validProxies.size(); ++proxy) {
+            if (!m_validProxies[proxy]) {
+                continue;
+            }
+
+            const Vector3 center = m_proxyBounds[proxy].GetCenter();
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                const double value = GetComponent(center, axis);
+                sums[axis] += value;
+                squaredSums[axis] += value * value;
+            }
+
+            ++count;
+        }
+
+        std::size_t bestAxis = 0;
+        double bestVariance = -1.0;
+        for (std::size_t axis = 0; axis < 3 && count > 0; ++axis) {
+            const double mean = sums[axis] / static_cast<double>(count);
+            const double variance = squaredSums[axis] / static_cast<double>(count) - mean * mean;
+            if (variance > bestVariance) {
+                bestAxis = axis;
+                bestVariance = variance;
+            }
+        }
+
+        return bestAxis;
+    }
+
+    void SweepAndPruneBroadphase::UpdateAxis(const std::size_t axis) {
+        std::vector<Interval>& intervals = m_axes[axis];
+        std::size_t sortedCount = m_sortedCount;
+
+        if (m_hasDestroyedProxies) {
+            std::size_t keptCount = 0;
+            std::size_t keptSortedCount = 0;
+            for (std::size_t i = 0; i < intervals.size(); ++i) {
+                if (!m_validProxies[intervals[i].proxy]) {
+                    continue;
+                }
+
+                keptSortedCount += (i < sortedCount) ? 1 : 0;
+                intervals[keptCount++] = intervals[i];
+            }
+
+            intervals.resize(keptCount);
+            sortedCount = keptSortedCount;
+        }
+
+        for (Interval& interval : intervals) {
+            const Aabb& bounds = m_proxyBounds[interval.proxy];
+            interval.min = GetComponent(bounds.min, axis);
+            interval.max = GetComponent(bounds.max, axis);
+        }
+
+        // Ties are broken by proxy so that the order only depends on the bounds
+        const auto compare = [](const Interval& lhs, const Interval& rhs) {
+            return lhs.min < rhs.min || (lhs.min == rhs.min && lhs.proxy < rhs.proxy);
+        };
+
+        // Intervals moved by a few neighbors since the last update, unless bodies teleported
+        const auto sortedEnd = intervals.begin() + static_cast<std::ptrdiff_t>(sortedCount);
+        if (!InsertionSort(std::span(intervals.begin(), sortedEnd), 8 * sortedCount + 64, compare)) {
+            std::sort(intervals.begin(), sortedEnd, compare);
+        }
+
+        // New intervals are sorted on their own then merged
+        std::sort(sortedEnd, intervals.end(), compare);
+        std::inplace_merge(intervals.begin(), sortedEnd, intervals.end(), compare);
+    }
+} // namespace Fl
@@ -0,0 +1,266 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Renderer/Framebuffer.hpp>
+
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        using ColorPlanes = float* const[4];
+        using ConstColorPlanes = const float* const[4];
+
+        /**
+         * @brief Row conversions of a color format, from and to the planes of a tile.
+         */
+        struct ColorFormatInfo {
+            std::size_t bytesPerPixel;
+            void (*loadRow)(const UInt8* pixels, std::size_t count, ColorPlanes& planes);
+            void (*storeRow)(UInt8* pixels, std::size_t count, ConstColorPlanes& planes);
+        };
+
+        struct DepthFormatInfo {
+            std::size_t bytesPerPixel;
+            void (*loadRow)(const UInt8* pixels, std::size_t count, float* depths);
+            void (*storeRow)(UInt8* pixels, std::size_t count, const float* depths);
+        };
+
+        // NaNs become zero
+        constexpr float Saturate(const float value) {
+            return (value > 0.f) ? ((value < 1.f) ? value : 1.f) : 0.f;
+        }
+
+        // Adding 1.5 * 2^23 to a float in [0, 2^22] leaves it rounded to the nearest integer in the low mantissa bits,
+        // which vectorizes unlike float to integer conversions
+        UInt8 ToUnorm8(const float value) {
+            return static_cast<UInt8>(BitCast<UInt32>(Saturate(value) * 255.f + 12582912.f));
+        }
+
+        UInt16 ToUnorm16(const float value) {
+            return static_cast<UInt16>(BitCast<UInt32>(Saturate(value) * 65535.f + 12582912.f));
+        }
+
+        template <std::size_t R, std::size_t G, std::size_t B, std::size_t A>
+        constexpr ColorFormatInfo Unorm8ColorFormat() {
+            // Channel by channel, each loop being a single stream of pixels
+            return {4,
+                    [](const UInt8* pixels, const std::size_t count, ColorPlanes& planes) {
+                        constexpr std::size_t Offsets[] = {R, G, B, A};
+                        for (std::size_t channel = 0; channel < 4; ++channel) {
+                            const UInt8* source = pixels + Offsets[channel];
+                            float* destination = planes[channel];
+                            for (std::size_t i = 0; i < count; ++i) {
+                                destination[i] = static_cast<float>(source[i * 4]) * (1.f / 255.f);
+                            }
+                        }
+                    },
+                    [](UInt8* pixels, const std::size_t count, ConstColorPlanes& planes) {
+                        constexpr std::size_t Offsets[] = {R, G, B, A};
+                        for (std::size_t channel = 0; channel < 4; ++channel) {
+                            const float* source = planes[channel];
+                            UInt8* destination = pixels + Offsets[channel];
+                            for (std::size_t i = 0; i < count; ++i) {
+                                destination[i * 4] = ToUnorm8(source[i]);
+                            }
+                        }
+                    }};
+        }
+
+        // Indexed by format
+        constexpr std::array<ColorFormatInfo, EnumValueCount_v<ColorFormat>> ColorFormats = {
+            Unorm8ColorFormat<0, 1, 2, 3>(),
+            Unorm8ColorFormat<2, 1, 0, 3>(),
+            ColorFormatInfo{16,
+                            [](const UInt8* pixels, const std::size_t count, ColorPlanes& planes) {
+                                for (std::size_t i = 0; i < count; ++i) {
+                                    for (std::size_t channel = 0; channel < 4; ++channel) {
+                                        std::memcpy(&planes[channel][i], pixels + i * 16 + channel * 4, 4);
+                                    }
+                                }
+                            },
+                            [](UInt8* pixels, const std::size_t count, ConstColorPlanes& planes) {
+                                for (std::size_t i = 0; i < count; ++i) {
+                                    for (std::size_t channel = 0; channel < 4; ++channel) {
+                                        std::memcpy(pixels + i * 16 + channel * 4, &planes[channel][i], 4);
+                                    }
+                                }
+                            }}};
+
+        constexpr std::array<DepthFormatInfo, EnumValueCount_v<DepthFormat>> DepthFormats = {
+            DepthFormatInfo{2,
+                            [](const UInt8* pixels, const std::size_t count, float* depths) {
+                                for (std::size_t i = 0; i < count; ++i) {
+                                    UInt16 value;
+                                    std::memcpy(&value, pixels + i * 2, 2);
+                                    depths[i] = static_cast<float>(value) * (1.f / 65535.f);
+                                }
+                            },
+                            [](UInt8* pixels, const std::size_t count, const float* depths) {
+                                for (std::size_t i = 0; i < count; ++i) {
+                                    const UInt16 value = ToUnorm16(depths[i]);
+                                    std::memcpy(pixels + i * 2, &value, 2);
+                                }
+                            }},
+            DepthFormatInfo{4,
+                            [](const UInt8* pixels, const std::size_t count, float* depths) {
+                                std::memcpy(depths, pixels, count * 4);
+                            },
+                            [](UInt8* pixels, const std::size_t count, const float* depths) {
+                                for (std::size_t i = 0; i < count; ++i) {
+                                    const float depth = Saturate(depths[i]);
+                                    std::memcpy(pixels + i * 4, &depth, 4);
+                                }
+                            }}};
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    Framebuffer::Framebuffer(const UInt32 width, const UInt32 height, const ColorFormat colorFormat,
+                             const DepthFormat depthFormat) :
+        m_colorFormat(colorFormat), m_depthFormat(depthFormat), m_height(height), m_width(width) {
+        FlAssertMsg(width > 0 && height > 0, "[Renderer/Framebuffer] Framebuffer must not be empty.");
+
+        const std::size_t pixelCount = std::size_t(width) * height;
+        m_colorData.resize(pixelCount * GetBytesPerPixel(colorFormat));
+        m_depthData.resize(pixelCount * GetBytesPerPixel(depthFormat));
+    }
+
+    void Framebuffer::Clear(const Color& color, const float depth) {
+        SetColor(0, 0, color);
+        SetDepth(0, 0, depth);
+
+        // Every pixel is a copy of the first one, the filled part doubles at each copy
+        for (std::vector<UInt8>* data : {&m_colorData, &m_depthData}) {
+            const std::size_t size = data->size();
+            for (std::size_t filled = size / (std::size_t(m_width) * m_height); filled < size; filled *= 2) {
+                std::memcpy(data->data() + filled, data->data(), std::min(filled, size - filled));
+            }
+        }
+    }
+
+    Color Framebuffer::GetColor(const UInt32 x, const UInt32 y) const {
+        FlAssertMsg(x < m_width && y < m_height, "[Renderer/Framebuffer] Pixel out of the framebuffer.");
+
+        Color color;
+        const ColorPlanes planes = {&color.r, &color.g, &color.b, &color.a};
+        const std::size_t pixel = std::size_t(y) * m_width + x;
+        ColorFormats[static_cast<std::size_t>(m_colorFormat)].loadRow(
+            &m_colorData[pixel * GetBytesPerPixel(m_colorFormat)], 1, planes);
+
+        return color;
+    }
+
+    std::span<const UInt8> Framebuffer::GetColorData() const {
+        return m_colorData;
+    }
+
+    ColorFormat Framebuffer::GetColorFormat() const {
+        return m_colorFormat;
+    }
+
+    float Framebuffer::GetDepth(const UInt32 x, const UInt32 y) const {
+        FlAssertMsg(x < m_width && y < m_height, "[Renderer/Framebuffer] Pixel out of the framebuffer.");
+
+        float depth;
+        const std::size_t pixel = std::size_t(y) * m_width + x;
+        DepthFormats[static_cast<std::size_t>(m_depthFormat)].loadRow(
+            &m_depthData[pixel * GetBytesPerPixel(m_depthFormat)], 1, &depth);
+
+        return depth;
+    }
+
+    std::span<const UInt8> Framebuffer::GetDepthData() const {
+        return m_depthData;
+    }
+
+    DepthFormat Framebuffer::GetDepthFormat() const {
+        return m_depthFormat;
+    }
+
+    UInt32 Framebuffer::GetHeight() const {
+        return m_height;
+    }
+
+    UInt32 Framebuffer::GetTileCountX() const {
+        return (m_width + TileSize - 1) / TileSize;
+    }
+
+    UInt32 Framebuffer::GetTileCountY() const {
+        return (m_height + TileSize - 1) / TileSize;
+    }
+
+    UInt32 Framebuffer::GetWidth() const {
+        return m_width;
+    }
+
+    void Framebuffer::LoadTile(const UInt32 tileX, const UInt32 tileY, Tile& tile) const {
+        FlAssertMsg(tileX < GetTileCountX() && tileY < GetTileCountY(), "[Renderer/Framebuffer] Invalid tile.");
+
+        const ColorFormatInfo& colorFormat = ColorFormats[static_cast<std::size_t>(m_colorFormat)];
+        const DepthFormatInfo& depthFormat = DepthFormats[static_cast<std::size_t>(m_depthFormat)];
+
+        const UInt32 x = tileX * TileSize;
+        const UInt32 width = std::min(TileSize, m_width - x);
+        const UInt32 rowCount = std::min(TileSize, m_height - tileY * TileSize);
+        for (UInt32 row = 0; row < rowCount; ++row) {
+            const std::size_t pixel = std::size_t(tileY * TileSize + row) * m_width + x;
+            const std::size_t tilePixel = std::size_t(row) * TileSize;
+
+            const ColorPlanes planes = {&tile.colors[0][tilePixel], &tile.colors[1][tilePixel],
+                                        &tile.colors[2][tilePixel], &tile.colors[3][tilePixel]};
+            colorFormat.loadRow(&m_colorData[pixel * colorFormat.bytesPerPixel], width, planes);
+            depthFormat.loadRow(&m_depthData[pixel * depthFormat.bytesPerPixel], width, &tile.depths[tilePixel]);
+        }
+    }
+
+    void Framebuffer::SetColor(const UInt32 x, const UInt32 y, const Color& color) {
+        FlAssertMsg(x < m_width && y < m_height, "[Renderer/Framebuffer] Pixel out of the framebuffer.");
+
+        const ConstColorPlanes planes = {&color.r, &color.g, &color.b, &color.a};
+        const std::size_t pixel = std::size_t(y) * m_width + x;
+        ColorFormats[static_cast<std::size_t>(m_colorFormat)].storeRow(
+            &m_colorData[pixel * GetBytesPerPixel(m_colorFormat)], 1, planes);
+    }
+
+    void Framebuffer::SetDepth(const UInt32 x, const UInt32 y, const float depth) {
+        FlAssertMsg(x < m_width && y < m_height, "[Renderer/Framebuffer] Pixel out of the framebuffer.");
+
+        const std::size_t pixel = std::size_t(y) * m_width + x;
+        DepthFormats[static_cast<std::size_t>(m_depthFormat)].storeRow(
+            &m_depthData[pixel * GetBytesPerPixel(m_depthFormat)], 1, &depth);
+    }
+
+    void Framebuffer::StoreTile(const UInt32 tileX, const UInt32 tileY, const Tile& tile) {
+        FlAssertMsg(tileX < GetTileCountX() && tileY < GetTileCountY(), "[Renderer/Framebuffer] Invalid tile.");
+
+        const ColorFormatInfo& colorFormat = ColorFormats[static_cast<std::size_t>(m_colorFormat)];
+        const DepthFormatInfo& depthFormat = DepthFormats[static_cast<std::size_t>(m_depthFormat)];
+
+        const UInt32 x = tileX * TileSize;
+        const UInt32 width = std::min(TileSize, m_width - x);
+        const UInt32 rowCount = std::min(TileSize, m_height - tileY * TileSize);
+        for (UInt32 row = 0; row < rowCount; ++row) {
+            const std::size_t pixel = std::size_t(tileY * TileSize + row) * m_width + x;
+            const std::size_t tilePixel = std::size_t(row) * TileSize;
+
+            const ConstColorPlanes planes = {&tile.colors[0][tilePixel], &tile.colors[1][tilePixel],
+                                             &tile.colors[2][tilePixel], &tile.colors[3][tilePixel]};
+            colorFormat.storeRow(&m_colorData[pixel * colorFormat.bytesPerPixel], width, planes);
+            depthFormat.storeRow(&m_depthData[pixel * depthFormat.bytesPerPixel], width, &tile.depths[tilePixel]);
+        }
+    }
+
+    std::size_t Framebuffer::GetBytesPerPixel(const ColorFormat format) {
+        return ColorFormats[static_cast<std::size_t>(format)].bytesPerPixel;
+    }
+
+    std::size_t Framebuffer::GetBytesPerPixel(const DepthFormat format) {
+        return DepthFormats[static_cast<std::size_t>(format)].bytesPerPixel;
+    }
+} // namespace Fl
@@ -0,0 +1,131 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Renderer/RenderQueue.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+#include <FlashlightEngine/Utility/ParallelAlgorithm.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        using DrawItem = RenderQueue::DrawItem;
+
+        template <typename F>
+        void ForEachBlock(ThreadPool* threadPool, const std::size_t blockCount, F&& func) {
+            if (threadPool) {
+                threadPool->ParallelFor(blockCount, 1, [&](const std::size_t block, std::size_t) { func(block); });
+            } else {
+                for (std::size_t block = 0; block < blockCount; ++block) {
+                    func(block);
+                }
+            }
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    RenderQueue::RenderQueue() :
+    m_statistics() {
+        m_depthOrders.fill(DepthOrder::FrontToBack);
+    }
+
+    void RenderQueue::Clear() {
+        for (Recorder& recorder : m_recorders) {
+            recorder.m_items.clear();
+        }
+
+        m_items.clear();
+    }
+
+    auto RenderQueue::GetRecorder(const std::size_t index) -> Recorder& {
+        while (m_recorders.size() <= index) {
+            m_recorders.emplace_back(*this);
+        }
+
+        return m_recorders[index];
+    }
+
+    void RenderQueue::Replay(RenderCommandStream& stream) {
+        const Clock clock;
+
+        stream.Clear();
+        stream.instances.reserve(m_items.size());
+
+        RenderCommand command{};
+        bool isPassStarted = false;
+        bool isMaterialSet = false;
+        for (const DrawItem& item : m_items) {
+            const UInt8 pass = RenderKey::DecodePass(item.key);
+            const RenderKey key = RenderKey::Decode(item.key, m_depthOrders[pass]);
+
+            if (!isPassStarted || key.layer != command.layer || key.pass != command.pass) {
+                command.type = RenderCommandType::BeginPass;
+                command.layer = key.layer;
+                command.pass = key.pass;
+                stream.commands.push_back(command);
+
+                isPassStarted = true;
+                isMaterialSet = false;
+            }
+
+            if (!isMaterialSet || key.material != command.material) {
+                command.type = RenderCommandType::SetMaterial;
+                command.material = key.material;
+                stream.commands.push_back(command);
+
+                isMaterialSet = true;
+            }
+
+            // Instances of a mesh following each other are drawn at once
+            RenderCommand& lastCommand = stream.commands.back();
+            if (lastCommand.type == RenderCommandType::Draw && lastCommand.mesh == key.mesh) {
+                ++lastCommand.instanceCount;
+            } else {
+                command.type = RenderCommandType::Draw;
+                command.mesh = key.mesh;
+                command.firstInstance = static_cast<UInt32>(stream.instances.size());
+                command.instanceCount = 1;
+                stream.commands.push_back(command);
+            }
+
+            stream.instances.push_back(item.instance);
+        }
+
+        m_statistics.commandCount = stream.commands.size();
+        m_statistics.drawCommandCount = static_cast<std::size_t>(
+            std::count_if(stream.commands.begin(), stream.commands.end(),
+                          [](const RenderCommand& command) { return command.type == RenderCommandType::Draw; }));
+        m_statistics.replayTime = clock.GetElapsedTime();
+    }
+
+    void RenderQueue::SetDepthOrder(const UInt8 pass, const DepthOrder depthOrder) {
+        m_depthOrders[pass] = depthOrder;
+    }
+
+    void RenderQueue::Sort(ThreadPool* threadPool) {
+        const Clock clock;
+
+        std::vector<std::size_t> offsets(m_recorders.size() + 1, 0);
+        for (std::size_t i = 0; i < m_recorders.size(); ++i) {
+            offsets[i + 1] = offsets[i] + m_recorders[i].m_items.size();
+        }
+
+        m_items.resize(offsets.back());
+        ForEachBlock(threadPool, m_recorders.size(), [&](const std::size_t recorder) {
+            const std::vector<DrawItem>& items = m_recorders[recorder].m_items;
+            if (!items.empty()) {
+                std::memcpy(&m_items[offsets[recorder]], items.data(), items.size() * sizeof(DrawItem));
+            }
+        });
+
+        m_statistics.itemCount = m_items.size();
+        m_statistics.radixPassCount = RadixSortByKey(std::span(m_items), [](const DrawItem& item) { return item.key; },
+                                                     threadPool, ScratchAllocator<DrawItem>(m_scratchBuffer));
+        m_statistics.sortTime = clock.GetElapsedTime();
+    }
+} // namespace Fl
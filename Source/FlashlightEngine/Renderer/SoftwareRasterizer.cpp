@@ -0,0 +1,523 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Renderer/SoftwareRasterizer.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        using ClipVertex = SoftwareRasterizer::ClipVertex;
+        using ClipPolygon = SmallVector<ClipVertex, 9>; //< A triangle clipped by 5 planes has at most 8 vertices
+
+        constexpr std::size_t VertexBatchSize = 1024;
+        constexpr std::size_t TileBatchSize = 2;
+        constexpr float SubpixelScale = 16.f;
+        constexpr float GuardBand = 16.f; //< Triangles are clipped past this many times the viewport half-size
+
+        alignas(16) constexpr float LaneOffsets[SimdFloat4::Width] = {0.5f, 1.5f, 2.5f, 3.5f};
+
+        // Out codes, one bit per plane
+        constexpr UInt32 Near = 1 << 0;
+        constexpr UInt32 GuardLeft = 1 << 1;
+        constexpr UInt32 GuardRight = 1 << 2;
+        constexpr UInt32 GuardBottom = 1 << 3;
+        constexpr UInt32 GuardTop = 1 << 4;
+        constexpr UInt32 ClippingPlanes = (1 << 5) - 1;
+
+        // Only used to reject triangles entirely outside the view
+        constexpr UInt32 Far = 1 << 5;
+        constexpr UInt32 Left = 1 << 6;
+        constexpr UInt32 Right = 1 << 7;
+        constexpr UInt32 Bottom = 1 << 8;
+        constexpr UInt32 Top = 1 << 9;
+
+        UInt32 ComputeOutCode(const ClipVertex& vertex) {
+            const float guard = GuardBand * vertex.w;
+
+            UInt32 outCode = 0;
+            outCode |= (vertex.z < 0.f) ? Near : 0;
+            outCode |= (vertex.x < -guard) ? GuardLeft : 0;
+            outCode |= (vertex.x > guard) ? GuardRight : 0;
+            outCode |= (vertex.y < -guard) ? GuardBottom : 0;
+            outCode |= (vertex.y > guard) ? GuardTop : 0;
+            outCode |= (vertex.z > vertex.w) ? Far : 0;
+            outCode |= (vertex.x < -vertex.w) ? Left : 0;
+            outCode |= (vertex.x > vertex.w) ? Right : 0;
+            outCode |= (vertex.y < -vertex.w) ? Bottom : 0;
+            outCode |= (vertex.y > vertex.w) ? Top : 0;
+
+            return outCode;
+        }
+
+        // Positive on the visible side of the plane
+        float GetClipDistance(const ClipVertex& vertex, const UInt32 plane) {
+            switch (plane) {
+                case Near:
+                    return vertex.z;
+                case GuardLeft:
+                    return GuardBand * vertex.w + vertex.x;
+                case GuardRight:
+                    return GuardBand * vertex.w - vertex.x;
+                case GuardBottom:
+                    return GuardBand * vertex.w + vertex.y;
+                default:
+                    return GuardBand * vertex.w - vertex.y;
+            }
+        }
+
+        ClipVertex Interpolate(const ClipVertex& from, const ClipVertex& to, const float t, const UInt32 varyingCount) {
+            ClipVertex vertex;
+            vertex.x = from.x + (to.x - from.x) * t;
+            vertex.y = from.y + (to.y - from.y) * t;
+            vertex.z = from.z + (to.z - from.z) * t;
+            vertex.w = from.w + (to.w - from.w) * t;
+            for (UInt32 i = 0; i < varyingCount; ++i) {
+                vertex.varyings[i] = from.varyings[i] + (to.varyings[i] - from.varyings[i]) * t;
+            }
+
+            return vertex;
+        }
+
+        void ClipPolygonAgainst(const ClipPolygon& input, ClipPolygon& output, const UInt32 plane,
+                                const UInt32 varyingCount) {
+            output.clear();
+            for (std::size_t i = 0; i < input.size(); ++i) {
+                const ClipVertex& previous = input[(i + input.size() - 1) % input.size()];
+                const ClipVertex& current = input[i];
+                const float previousDistance = GetClipDistance(previous, plane);
+                const float currentDistance = GetClipDistance(current, plane);
+
+                // Always interpolated from the visible vertex, so that both triangles sharing an edge agree
+                if ((previousDistance >= 0.f) != (currentDistance >= 0.f)) {
+                    if (previousDistance >= 0.f) {
+                        const float t = previousDistance / (previousDistance - currentDistance);
+                        output.push_back(Interpolate(previous, current, t, varyingCount));
+                    } else {
+                        const float t = currentDistance / (currentDistance - previousDistance);
+                        output.push_back(Interpolate(current, previous, t, varyingCount));
+                    }
+                }
+
+                if (currentDistance >= 0.f) {
+                    output.push_back(current);
+                }
+            }
+        }
+
+        template <typename F>
+        void ForEachBatch(ThreadPool* threadPool, const std::size_t count, const std::size_t batchSize, F&& func) {
+            if (threadPool) {
+                threadPool->ParallelFor(count, batchSize, func);
+            } else if (count > 0) {
+                func(std::size_t(0), count);
+            }
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    void SoftwareRasterizer::Draw(Framebuffer& framebuffer, const DrawCall& drawCall, ThreadPool* threadPool) {
+        FlAssertMsg(drawCall.indices.size() % 3 == 0, "[Renderer/SoftwareRasterizer] Indices must form triangles.");
+        FlAssertMsg(drawCall.varyingCount <= MaxVaryings, "[Renderer/SoftwareRasterizer] Too many varyings.");
+        FlAssertMsg(drawCall.vertexShader, "[Renderer/SoftwareRasterizer] Draw calls need a vertex shader.");
+
+        m_statistics = {};
+        m_statistics.triangleCount = drawCall.indices.size() / 3;
+
+        m_vertices.resize(drawCall.vertexCount);
+        ForEachBatch(threadPool, m_vertices.size(), VertexBatchSize, [&](const std::size_t first,
+                                                                        const std::size_t last) {
+            for (std::size_t vertex = first; vertex < last; ++vertex) {
+                drawCall.vertexShader(static_cast<UInt32>(vertex), m_vertices[vertex]);
+            }
+        });
+
+        BinTriangles(framebuffer, drawCall, threadPool);
+
+        // Each tile is owned by a single thread from its load to its store
+        ForEachBatch(threadPool, m_activeTiles.size(), TileBatchSize, [&](const std::size_t first,
+                                                                         const std::size_t last) {
+            const auto tileData = std::make_unique<Framebuffer::Tile>();
+            for (std::size_t i = first; i < last; ++i) {
+                const UInt32 tile = m_activeTiles[i];
+                const UInt32 tileX = tile % m_tileCountX;
+                const UInt32 tileY = tile / m_tileCountX;
+
+                framebuffer.LoadTile(tileX, tileY, *tileData);
+                RasterizeTile(drawCall, tile, *tileData);
+                framebuffer.StoreTile(tileX, tileY, *tileData);
+            }
+        });
+    }
+
+    auto SoftwareRasterizer::GetStatistics() const -> const Statistics& {
+        return m_statistics;
+    }
+
+    void SoftwareRasterizer::BinTriangles(const Framebuffer& framebuffer, const DrawCall& drawCall,
+                                          ThreadPool* threadPool) {
+        const UInt32 width = framebuffer.GetWidth();
+        const UInt32 height = framebuffer.GetHeight();
+        m_tileCountX = framebuffer.GetTileCountX();
+        const std::size_t tileCount = std::size_t(m_tileCountX) * framebuffer.GetTileCountY();
+
+        const std::size_t triangleCount = m_statistics.triangleCount;
+        m_setupBatches.resize((triangleCount + SetupBatchSize - 1) / SetupBatchSize);
+
+        ForEachBatch(threadPool, m_setupBatches.size(), 1, [&](const std::size_t firstBatch,
+                                                             const std::size_t lastBatch) {
+            ClipPolygon polygon;
+            ClipPolygon clippedPolygon;
+
+            for (std::size_t batchIndex = firstBatch; batchIndex < lastBatch; ++batchIndex) {
+                SetupBatch& batch = m_setupBatches[batchIndex];
+                batch.triangles.clear();
+                batch.binEntries.clear();
+                batch.culledTriangleCount = 0;
+                batch.clippedTriangleCount = 0;
+
+                const auto setupTriangle = [&](const std::array<const ClipVertex*, 3>& vertices) {
+                    TriangleSetup& setup = batch.triangles.emplace_back();
+                    if (!SetupTriangle(vertices, drawCall, width, height, setup)) {
+                        batch.triangles.pop_back();
+                        return false;
+                    }
+
+                    const auto triangle = static_cast<UInt32>(batch.triangles.size() - 1);
+                    for (UInt32 tileY = setup.minY / Framebuffer::TileSize;
+                         tileY <= setup.maxY / Framebuffer::TileSize; ++tileY) {
+                        for (UInt32 tileX = setup.minX / Framebuffer::TileSize;
+                             tileX <= setup.maxX / Framebuffer::TileSize; ++tileX) {
+                            // Pixel centers of the tile within the bounds of the triangle
+                            const float minX = static_cast<float>(std::max(setup.minX, tileX * Framebuffer::TileSize));
+                            const float minY = static_cast<float>(std::max(setup.minY, tileY * Framebuffer::TileSize));
+                            const float maxX =
+                                static_cast<float>(std::min(setup.maxX, (tileX + 1) * Framebuffer::TileSize - 1));
+                            const float maxY =
+                                static_cast<float>(std::min(setup.maxY, (tileY + 1) * Framebuffer::TileSize - 1));
+
+                            // Edge functions are evaluated like the rasterization does, rounding errors keep them
+                            // monotonic: the tile is skipped when one of them is negative at its most inside pixel
+                            bool isOutside = false;
+                            for (std::size_t edge = 0; edge < 3 && !isOutside; ++edge) {
+                                const float x = ((setup.edgeA[edge] > 0.f) ? maxX : minX) + 0.5f;
+                                const float y = ((setup.edgeB[edge] > 0.f) ? maxY : minY) + 0.5f;
+                                const float value = setup.edgeB[edge] * (y - setup.edgeY[edge]) +
+                                                    setup.edgeA[edge] * (x - setup.edgeX[edge]);
+                                isOutside = value < 0.f;
+                            }
+
+                            if (!isOutside) {
+                                batch.binEntries.push_back({tileY * m_tileCountX + tileX, triangle});
+                            }
+                        }
+                    }
+
+                    return true;
+                };
+
+                const std::size_t lastTriangle = std::min(triangleCount, (batchIndex + 1) * SetupBatchSize);
+                for (std::size_t triangle = batchIndex * SetupBatchSize; triangle < lastTriangle; ++triangle) {
+                    std::array<const ClipVertex*, 3> vertices;
+                    std::array<UInt32, 3> outCodes;
+                    for (std::size_t i = 0; i < 3; ++i) {
+                        const UInt32 index = drawCall.indices[triangle * 3 + i];
+                        FlAssertMsg(index < m_vertices.size(), "[Renderer/SoftwareRasterizer] Index out of range.");
+
+                        vertices[i] = &m_vertices[index];
+                        outCodes[i] = ComputeOutCode(*vertices[i]);
+                    }
+
+                    // Entirely on the outer side of a plane
+                    if ((outCodes[0] & outCodes[1] & outCodes[2]) != 0) {
+                        ++batch.culledTriangleCount;
+                        continue;
+                    }
+
+                    const UInt32 crossedPlanes = (outCodes[0] | outCodes[1] | outCodes[2]) & ClippingPlanes;
+                    if (crossedPlanes == 0) {
+                        batch.culledTriangleCount += setupTriangle(vertices) ? 0 : 1;
+                        continue;
+                    }
+
+                    ++batch.clippedTriangleCount;
+
+                    polygon.clear();
+                    for (const ClipVertex* vertex : vertices) {
+                        polygon.push_back(*vertex);
+                    }
+
+                    for (UInt32 planes = crossedPlanes; planes != 0 && polygon.size() >= 3; planes &= planes - 1) {
+                        ClipPolygonAgainst(polygon, clippedPolygon, planes & (~planes + 1), drawCall.varyingCount);
+                        std::swap(polygon, clippedPolygon);
+                    }
+
+                    // The clipped polygon is convex, drawn as a fan
+                    bool isVisible = false;
+                    for (std::size_t i = 2; i < polygon.size(); ++i) {
+                        isVisible |= setupTriangle({&polygon[0], &polygon[i - 1], &polygon[i]});
+                    }
+
+                    batch.culledTriangleCount += isVisible ? 0 : 1;
+                }
+            }
+        });
+
+        // Counting sort of the bin entries by tile, keeping the submission order within each tile
+        m_tileOffsets.assign(tileCount + 1, 0);
+        for (const SetupBatch& batch : m_setupBatches) {
+            m_statistics.culledTriangleCount += batch.culledTriangleCount;
+            m_statistics.clippedTriangleCount += batch.clippedTriangleCount;
+            for (const BinEntry& entry : batch.binEntries) {
+                ++m_tileOffsets[entry.tile + 1];
+            }
+        }
+
+        m_activeTiles.clear();
+        for (std::size_t tile = 0; tile < tileCount; ++tile) {
+            if (m_tileOffsets[tile + 1] != 0) {
+                m_activeTiles.push_back(static_cast<UInt32>(tile));
+            }
+
+            m_tileOffsets[tile + 1] += m_tileOffsets[tile];
+        }
+
+        m_tileTriangles.resize(m_tileOffsets.back());
+        std::vector<UInt32> cursors(m_tileOffsets.begin(), m_tileOffsets.end() - 1);
+        for (std::size_t batchIndex = 0; batchIndex < m_setupBatches.size(); ++batchIndex) {
+            for (const BinEntry& entry : m_setupBatches[batchIndex].binEntries) {
+                m_tileTriangles[cursors[entry.tile]++] = {static_cast<UInt32>(batchIndex), entry.triangle};
+            }
+        }
+
+        m_statistics.binnedTriangleCount = m_tileTriangles.size();
+        m_statistics.tileCount = m_activeTiles.size();
+    }
+
+    void SoftwareRasterizer::RasterizeTile(const DrawCall& drawCall, const UInt32 tile,
+                                           Framebuffer::Tile& tileData) const {
+        const UInt32 tileMinX = (tile % m_tileCountX) * Framebuffer::TileSize;
+        const UInt32 tileMinY = (tile / m_tileCountX) * Framebuffer::TileSize;
+        const SimdFloat4 laneOffsets = SimdFloat4::LoadAligned(LaneOffsets);
+        const SimdFloat4 zero = SimdFloat4::Zero();
+        const SimdFloat4 one = SimdFloat4::Splat(1.f);
+
+        Fragments fragments;
+        FragmentColors colors;
+
+        for (UInt32 i = m_tileOffsets[tile]; i < m_tileOffsets[tile + 1]; ++i) {
+            const TriangleRef& triangle = m_tileTriangles[i];
+            const TriangleSetup& setup = m_setupBatches[triangle.batch].triangles[triangle.triangle];
+
+            const UInt32 minX = std::max(setup.minX, tileMinX);
+            const UInt32 maxX = std::min(setup.maxX, tileMinX + Framebuffer::TileSize - 1);
+            const UInt32 minY = std::max(setup.minY, tileMinY);
+            const UInt32 maxY = std::min(setup.maxY, tileMinY + Framebuffer::TileSize - 1);
+
+            // Pixels before minX or after maxX of the SIMD groups are masked out
+            const SimdFloat4 firstCenter = SimdFloat4::Splat(static_cast<float>(minX) + 0.5f);
+            const SimdFloat4 lastCenter = SimdFloat4::Splat(static_cast<float>(maxX) + 0.5f);
+
+            std::array<SimdFloat4, 3> edgeA;
+            std::array<SimdFloat4, 3> edgeX;
+            for (std::size_t edge = 0; edge < 3; ++edge) {
+                edgeA[edge] = SimdFloat4::Splat(setup.edgeA[edge]);
+                edgeX[edge] = SimdFloat4::Splat(setup.edgeX[edge]);
+            }
+
+            const std::size_t planeCount = 2 + drawCall.varyingCount;
+            std::array<SimdFloat4, PlaneCount> planeDx;
+            for (std::size_t plane = 0; plane < planeCount; ++plane) {
+                planeDx[plane] = SimdFloat4::Splat(setup.planes[plane][1]);
+            }
+
+            const SimdFloat4 referenceX = SimdFloat4::Splat(setup.referenceX);
+
+            for (UInt32 y = minY; y <= maxY; ++y) {
+                const float centerY = static_cast<float>(y) + 0.5f;
+
+                // Terms of the edge functions and planes constant along the row
+                std::array<SimdFloat4, 3> edgeRows;
+                for (std::size_t edge = 0; edge < 3; ++edge) {
+                    edgeRows[edge] = SimdFloat4::Splat(setup.edgeB[edge] * (centerY - setup.edgeY[edge]));
+                }
+
+                std::array<SimdFloat4, PlaneCount> planeRows;
+                for (std::size_t plane = 0; plane < planeCount; ++plane) {
+                    const std::array<float, 3>& values = setup.planes[plane];
+                    planeRows[plane] = SimdFloat4::Splat(values[0] + values[2] * (centerY - setup.referenceY));
+                }
+
+                const std::size_t rowOffset = std::size_t(y - tileMinY) * Framebuffer::TileSize;
+                for (UInt32 x = minX & ~UInt32(SimdFloat4::Width - 1); x <= maxX; x += SimdFloat4::Width) {
+                    const SimdFloat4 centersX = SimdFloat4::Splat(static_cast<float>(x)) + laneOffsets;
+
+                    SimdFloat4 mask = SimdFloat4::GreaterEqual(centersX, firstCenter) &
+                                      SimdFloat4::LessEqual(centersX, lastCenter);
+                    for (std::size_t edge = 0; edge < 3; ++edge) {
+                        const SimdFloat4 value = edgeRows[edge] + edgeA[edge] * (centersX - edgeX[edge]);
+                        mask = mask & ((setup.topLeftEdges & (1u << edge)) ? SimdFloat4::GreaterEqual(value, zero)
+                                                                          : SimdFloat4::Greater(value, zero));
+                    }
+
+                    if (mask.GetMoveMask() == 0) {
+                        continue;
+                    }
+
+                    const std::size_t pixel = rowOffset + (x - tileMinX);
+                    const SimdFloat4 offsetsX = centersX - referenceX;
+                    const SimdFloat4 depth = planeRows[0] + planeDx[0] * offsetsX;
+                    const SimdFloat4 storedDepth = SimdFloat4::LoadAligned(&tileData.depths[pixel]);
+
+                    // Depths past the far plane are only rejected here, the triangles crossing it aren't clipped
+                    mask = mask & SimdFloat4::LessEqual(depth, one);
+                    if (drawCall.depthTest) {
+                        mask = mask & SimdFloat4::Less(depth, storedDepth);
+                    }
+
+                    fragments.mask = mask.GetMoveMask();
+                    if (fragments.mask == 0) {
+                        continue;
+                    }
+
+                    if (drawCall.fragmentShader) {
+                        const SimdFloat4 w = one / (planeRows[1] + planeDx[1] * offsetsX);
+                        for (std::size_t varying = 0; varying < drawCall.varyingCount; ++varying) {
+                            const std::size_t plane = 2 + varying;
+                            fragments.varyings[varying] = (planeRows[plane] + planeDx[plane] * offsetsX) * w;
+                        }
+
+                        fragments.x = centersX;
+                        fragments.y = SimdFloat4::Splat(centerY);
+                        fragments.depth = depth;
+
+                        drawCall.fragmentShader(fragments, colors);
+
+                        const SimdFloat4* channels[4] = {&colors.r, &colors.g, &colors.b, &colors.a};
+                        for (std::size_t channel = 0; channel < 4; ++channel) {
+                            float* destination = &tileData.colors[channel][pixel];
+                            SimdFloat4::Select(mask, *channels[channel], SimdFloat4::LoadAligned(destination))
+                                .StoreAligned(destination);
+                        }
+                    }
+
+                    if (drawCall.depthWrite) {
+                        SimdFloat4::Select(mask, depth, storedDepth).StoreAligned(&tileData.depths[pixel]);
+                    }
+                }
+            }
+        }
+    }
+
+    bool SoftwareRasterizer::SetupTriangle(const std::array<const ClipVertex*, 3>& vertices, const DrawCall& drawCall,
+                                           const UInt32 width, const UInt32 height, TriangleSetup& setup) {
+        std::array<float, 3> screenX;
+        std::array<float, 3> screenY;
+        std::array<float, 3> inverseW;
+        for (std::size_t i = 0; i < 3; ++i) {
+            const ClipVertex& vertex = *vertices[i];
+            if (!(vertex.w > 0.f)) {
+                return false;
+            }
+
+            inverseW[i] = 1.f / vertex.w;
+
+            // Snapped to the sub-pixel grid, y pointing down
+            const float x = (vertex.x * inverseW[i] * 0.5f + 0.5f) * static_cast<float>(width);
+            const float y = (0.5f - vertex.y * inverseW[i] * 0.5f) * static_cast<float>(height);
+            screenX[i] = std::round(x * SubpixelScale) / SubpixelScale;
+            screenY[i] = std::round(y * SubpixelScale) / SubpixelScale;
+        }
+
+        // Twice the signed area, positive for triangles appearing clockwise
+        float area = (screenX[2] - screenX[1]) * (screenY[0] - screenY[1]) -
+                     (screenY[2] - screenY[1]) * (screenX[0] - screenX[1]);
+        if (area == 0.f) {
+            return false;
+        }
+
+        const bool isFrontFacing = area < 0.f;
+        if ((drawCall.cullMode == CullMode::Back && !isFrontFacing) ||
+            (drawCall.cullMode == CullMode::Front && isFrontFacing)) {
+            return false;
+        }
+
+        std::array<std::size_t, 3> order = {0, 1, 2};
+        if (area < 0.f) {
+            std::swap(order[1], order[2]);
+            area = -area;
+        }
+
+        const auto toPixel = [](const float value) { return value - 0.5f; };
+        const float minX = std::max(std::ceil(toPixel(std::min({screenX[0], screenX[1], screenX[2]}))), 0.f);
+        const float minY = std::max(std::ceil(toPixel(std::min({screenY[0], screenY[1], screenY[2]}))), 0.f);
+        const float maxX = std::min(std::floor(toPixel(std::max({screenX[0], screenX[1], screenX[2]}))),
+                                    static_cast<float>(width - 1));
+        const float maxY = std::min(std::floor(toPixel(std::max({screenY[0], screenY[1], screenY[2]}))),
+                                    static_cast<float>(height - 1));
+        if (minX > maxX || minY > maxY) {
+            return false;
+        }
+
+        setup.minX = static_cast<UInt32>(minX);
+        setup.minY = static_cast<UInt32>(minY);
+        setup.maxX = static_cast<UInt32>(maxX);
+        setup.maxY = static_cast<UInt32>(maxY);
+
+        // The edge facing each vertex, evaluated from its lowest endpoint: the triangles sharing an edge compute the
+        // exact opposite of each other and the top-left rule gives pixels on the edge to only one of them
+        setup.topLeftEdges = 0;
+        for (std::size_t edge = 0; edge < 3; ++edge) {
+            const std::size_t from = order[(edge + 1) % 3];
+            const std::size_t to = order[(edge + 2) % 3];
+            const float deltaX = screenX[to] - screenX[from];
+            const float deltaY = screenY[to] - screenY[from];
+
+            const bool isFromLowest = screenY[from] < screenY[to] ||
+                                      (screenY[from] == screenY[to] && screenX[from] < screenX[to]);
+            const std::size_t reference = isFromLowest ? from : to;
+
+            setup.edgeA[edge] = -deltaY;
+            setup.edgeB[edge] = deltaX;
+            setup.edgeX[edge] = screenX[reference];
+            setup.edgeY[edge] = screenY[reference];
+            setup.topLeftEdges |= (deltaY < 0.f || (deltaY == 0.f && deltaX > 0.f)) ? (1u << edge) : 0u;
+        }
+
+        // Barycentric coordinates are the edge functions divided by the area, their derivatives give the planes
+        const float inverseArea = 1.f / area;
+        std::array<float, 3> gradientX;
+        std::array<float, 3> gradientY;
+        for (std::size_t edge = 0; edge < 3; ++edge) {
+            gradientX[order[edge]] = setup.edgeA[edge] * inverseArea;
+            gradientY[order[edge]] = setup.edgeB[edge] * inverseArea;
+        }
+
+        const auto setPlane = [&](const std::size_t plane, const std::array<float, 3>& values) {
+            setup.planes[plane] = {values[0],
+                                   values[0] * gradientX[0] + values[1] * gradientX[1] + values[2] * gradientX[2],
+                                   values[0] * gradientY[0] + values[1] * gradientY[1] + values[2] * gradientY[2]};
+        };
+
+        setPlane(0, {vertices[0]->z * inverseW[0], vertices[1]->z * inverseW[1], vertices[2]->z * inverseW[2]});
+        setPlane(1, inverseW);
+        for (std::size_t varying = 0; varying < drawCall.varyingCount; ++varying) {
+            setPlane(2 + varying, {vertices[0]->varyings[varying] * inverseW[0],
+                                   vertices[1]->varyings[varying] * inverseW[1],
+                                   vertices[2]->varyings[varying] * inverseW[2]});
+        }
+
+        setup.referenceX = screenX[0];
+        setup.referenceY = screenY[0];
+
+        return true;
+    }
+} // namespace Fl
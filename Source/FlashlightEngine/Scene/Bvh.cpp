@@ -0,0 +1,528 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Scene/Bvh.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        float GetAxis(const Vector3& vec, const int axis) {
+            return (axis == 0) ? vec.x : (axis == 1) ? vec.y : vec.z;
+        }
+
+        float& GetAxis(Vector3& vec, const int axis) {
+            return (axis == 0) ? vec.x : (axis == 1) ? vec.y : vec.z;
+        }
+
+        std::size_t GetBin(const float value, const std::size_t binCount) {
+            // Conversion to int is a single instruction, unlike the one to an unsigned type
+            return std::min(static_cast<std::size_t>(static_cast<int>(value)), binCount - 1);
+        }
+
+        float GetSurfaceArea(const SimdFloat4& min, const SimdFloat4& max) {
+            alignas(16) float size[4];
+            (max - min).StoreAligned(size);
+
+            // Empty boxes have a negative size
+            if (size[0] < 0.f || size[1] < 0.f || size[2] < 0.f) {
+                return 0.f;
+            }
+
+            return 2.f * (size[0] * size[1] + size[1] * size[2] + size[2] * size[0]);
+        }
+
+        SimdFloat4 ToSimd(const Vector3& vec) {
+            return SimdFloat4(vec.x, vec.y, vec.z, 0.f);
+        }
+
+        Aabb ToAabb(const SimdFloat4& min, const SimdFloat4& max) {
+            alignas(16) float minValues[4];
+            alignas(16) float maxValues[4];
+            min.StoreAligned(minValues);
+            max.StoreAligned(maxValues);
+
+            return {{minValues[0], minValues[1], minValues[2]}, {maxValues[0], maxValues[1], maxValues[2]}};
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    void Bvh::Build(const std::span<const Aabb> primitiveBounds) {
+        FlAssertMsg(primitiveBounds.size() < PrimitiveBit, "[Scene/Bvh] Too many primitives.");
+
+        Clear();
+
+        const auto count = static_cast<UInt32>(primitiveBounds.size());
+        m_primitiveBounds.assign(primitiveBounds.begin(), primitiveBounds.end());
+        m_primitiveSlots.resize(count);
+        if (count == 0) {
+            return;
+        }
+
+        m_buildPrimitives.resize(count);
+        for (UInt32 i = 0; i < count; ++i) {
+            const SimdFloat4 min = ToSimd(m_primitiveBounds[i].min);
+            const SimdFloat4 max = ToSimd(m_primitiveBounds[i].max);
+            m_buildPrimitives[i] = {min, max, i};
+        }
+
+        // Every node holds up to NodeWidth primitives or nodes, a third of the primitive count is the usual node count
+        m_nodes.reserve(count / 3 + 1);
+        BuildNode(AllocateNode(InvalidNode), ComputeRange(0, count));
+
+        m_dirtyNodes.assign(m_nodes.size(), 0);
+
+        m_buildPrimitives = {};
+    }
+
+    void Bvh::Clear() {
+        m_nodes.clear();
+        m_primitiveBounds.clear();
+        m_primitiveSlots.clear();
+        m_dirtyNodes.clear();
+    }
+
+    Aabb Bvh::GetBounds() const {
+        return m_nodes.empty() ? Aabb::Empty() : GetNodeBounds(m_nodes.front());
+    }
+
+    std::size_t Bvh::GetNodeCount() const {
+        return m_nodes.size();
+    }
+
+    const Aabb& Bvh::GetPrimitiveBounds(const UInt32 primitive) const {
+        FlAssertMsg(primitive < m_primitiveBounds.size(), "[Scene/Bvh] Invalid primitive index.");
+
+        return m_primitiveBounds[primitive];
+    }
+
+    std::size_t Bvh::GetPrimitiveCount() const {
+        return m_primitiveBounds.size();
+    }
+
+    float Bvh::GetSahCost() const {
+        const float rootArea = GetBounds().GetSurfaceArea();
+        if (rootArea <= 0.f) {
+            return 0.f;
+        }
+
+        float area = 0.f;
+        for (const Node& node : m_nodes) {
+            for (std::size_t slot = 0; slot < node.childCount; ++slot) {
+                area += GetChildBounds(node, slot).GetSurfaceArea();
+            }
+        }
+
+        return area / rootArea;
+    }
+
+    void Bvh::QueryOverlaps(const std::span<const Aabb> boxes, std::vector<UInt32>& primitives,
+                            std::vector<UInt32>& offsets, ThreadPool* threadPool) const {
+        primitives.clear();
+        offsets.assign(boxes.size() + 1, 0);
+
+        // Query counts are stored in offsets[i + 1], then turned into offsets once all batches are done
+        const auto queryRange = [&](std::vector<UInt32>& output, const std::size_t first, const std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                const std::size_t previousSize = output.size();
+                QueryOverlaps(boxes[i], [&](const UInt32 primitive) { output.push_back(primitive); });
+
+                offsets[i + 1] = static_cast<UInt32>(output.size() - previousSize);
+            }
+        };
+
+        if (threadPool) {
+            // Batch boundaries are deterministic, concatenating their results in order gives the sequential output
+            std::vector<std::vector<UInt32>> batchPrimitives((boxes.size() + BatchSize - 1) / BatchSize);
+            threadPool->ParallelFor(boxes.size(), BatchSize, [&](const std::size_t first, const std::size_t last) {
+                queryRange(batchPrimitives[first / BatchSize], first, last);
+            });
+
+            std::size_t totalCount = 0;
+            for (const std::vector<UInt32>& batch : batchPrimitives) {
+                totalCount += batch.size();
+            }
+
+            primitives.reserve(totalCount);
+            for (const std::vector<UInt32>& batch : batchPrimitives) {
+                primitives.insert(primitives.end(), batch.begin(), batch.end());
+            }
+        } else {
+            queryRange(primitives, 0, boxes.size());
+        }
+
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    }
+
+    BvhRayHit Bvh::RayCast(const Ray& ray, const float maxDistance) const {
+        return RayCast(ray, maxDistance, [this](const UInt32 primitive, const Ray& primitiveRay, const float distance) {
+            float hitDistance;
+            if (m_primitiveBounds[primitive].Intersect(primitiveRay, distance, hitDistance)) {
+                return hitDistance;
+            }
+
+            return std::numeric_limits<float>::infinity();
+        });
+    }
+
+    void Bvh::RayCast(const std::span<const Ray> rays, const std::span<BvhRayHit> hits, const float maxDistance,
+                      ThreadPool* threadPool) const {
+        FlAssertMsg(hits.size() >= rays.size(), "[Scene/Bvh] Hit span is smaller than the ray span.");
+
+        const auto castRange = [&](const std::size_t first, const std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                hits[i] = RayCast(rays[i], maxDistance);
+            }
+        };
+
+        if (threadPool) {
+            threadPool->ParallelFor(rays.size(), BatchSize, castRange);
+        } else {
+            castRange(0, rays.size());
+        }
+    }
+
+    void Bvh::Refit(const bool allowRotations) {
+        if (m_nodes.empty() || !m_dirtyNodes.front()) {
+            return;
+        }
+
+        RefitNode(0, allowRotations);
+    }
+
+    void Bvh::UpdatePrimitive(const UInt32 primitive, const Aabb& bounds) {
+        FlAssertMsg(primitive < m_primitiveBounds.size(), "[Scene/Bvh] Invalid primitive index.");
+
+        m_primitiveBounds[primitive] = bounds;
+
+        // Ancestors of a dirty node are always dirty, the walk stops at the first one already marked
+        UInt32 nodeIndex = m_primitiveSlots[primitive] / NodeWidth;
+        while (nodeIndex != InvalidNode && !m_dirtyNodes[nodeIndex]) {
+            m_dirtyNodes[nodeIndex] = 1;
+            nodeIndex = m_nodes[nodeIndex].parent;
+        }
+    }
+
+    UInt32 Bvh::AllocateNode(const UInt32 parent) {
+        Node& node = m_nodes.emplace_back();
+        for (std::size_t slot = 0; slot < NodeWidth; ++slot) {
+            SetChildBounds(node, slot, Aabb::Empty());
+            node.children[slot] = InvalidNode;
+        }
+
+        node.parent = parent;
+        node.childCount = 0;
+
+        return static_cast<UInt32>(m_nodes.size() - 1);
+    }
+
+    void Bvh::BuildNode(const UInt32 nodeIndex, const BuildRange& range) {
+        // Small ranges directly become the children of the node, there is nothing to gain in splitting them
+        if (range.last - range.first <= NodeWidth) {
+            m_nodes[nodeIndex].childCount = range.last - range.first;
+            for (UInt32 i = range.first; i < range.last; ++i) {
+                const UInt32 primitive = m_buildPrimitives[i].index;
+                SetChild(nodeIndex, i - range.first, primitive | PrimitiveBit, m_primitiveBounds[primitive]);
+            }
+
+            return;
+        }
+
+        // Split the range up to NodeWidth times, always splitting the largest range left
+        BuildRange ranges[NodeWidth];
+        std::size_t rangeCount = 1;
+        ranges[0] = range;
+
+        while (rangeCount < NodeWidth) {
+            std::size_t largest = rangeCount;
+            float largestArea = -1.f;
+            for (std::size_t i = 0; i < rangeCount; ++i) {
+                const float area = ranges[i].bounds.GetSurfaceArea();
+                if (ranges[i].last - ranges[i].first > 1 && area > largestArea) {
+                    largest = i;
+                    largestArea = area;
+                }
+            }
+
+            if (largest == rangeCount) {
+                break;
+            }
+
+            const BuildRange splitRange = ranges[largest];
+            SplitRange(splitRange, ranges[largest], ranges[rangeCount++]);
+        }
+
+        m_nodes[nodeIndex].childCount = static_cast<UInt32>(rangeCount);
+
+        for (std::size_t slot = 0; slot < rangeCount; ++slot) {
+            const BuildRange& childRange = ranges[slot];
+            if (childRange.last - childRange.first == 1) {
+                const UInt32 primitive = m_buildPrimitives[childRange.first].index;
+                SetChild(nodeIndex, slot, primitive | PrimitiveBit, childRange.bounds);
+                continue;
+            }
+
+            const UInt32 child = AllocateNode(nodeIndex);
+            SetChild(nodeIndex, slot, child, childRange.bounds);
+            BuildNode(child, childRange);
+        }
+    }
+
+    auto Bvh::ComputeRange(const UInt32 first, const UInt32 last) const -> BuildRange {
+        const Aabb empty = Aabb::Empty();
+        SimdFloat4 boundsMin = ToSimd(empty.min);
+        SimdFloat4 boundsMax = ToSimd(empty.max);
+        SimdFloat4 centroidMin = boundsMin;
+        SimdFloat4 centroidMax = boundsMax;
+
+        for (UInt32 i = first; i < last; ++i) {
+            const BuildPrimitive& primitive = m_buildPrimitives[i];
+            boundsMin = SimdFloat4::Min(boundsMin, primitive.boundsMin);
+            boundsMax = SimdFloat4::Max(boundsMax, primitive.boundsMax);
+            centroidMin = SimdFloat4::Min(centroidMin, primitive.GetCentroid());
+            centroidMax = SimdFloat4::Max(centroidMax, primitive.GetCentroid());
+        }
+
+        return {first, last, ToAabb(boundsMin, boundsMax), ToAabb(centroidMin, centroidMax)};
+    }
+
+    Aabb Bvh::GetChildBounds(const Node& node, const std::size_t slot) const {
+        return {
+            {node.minX[slot], node.minY[slot], node.minZ[slot]},
+            {node.maxX[slot], node.maxY[slot], node.maxZ[slot]}
+        };
+    }
+
+    Aabb Bvh::GetNodeBounds(const Node& node) const {
+        Aabb bounds = Aabb::Empty();
+        for (std::size_t slot = 0; slot < node.childCount; ++slot) {
+            bounds.Merge(GetChildBounds(node, slot));
+        }
+
+        return bounds;
+    }
+
+    void Bvh::RefitNode(const UInt32 nodeIndex, const bool allowRotations) {
+        Node& node = m_nodes[nodeIndex];
+        for (std::size_t slot = 0; slot < node.childCount; ++slot) {
+            const UInt32 child = node.children[slot];
+            if (child & PrimitiveBit) {
+                SetChildBounds(node, slot, m_primitiveBounds[child & ~PrimitiveBit]);
+                continue;
+            }
+
+            if (m_dirtyNodes[child]) {
+                RefitNode(child, allowRotations);
+            }
+
+            SetChildBounds(node, slot, GetNodeBounds(m_nodes[child]));
+        }
+
+        if (allowRotations) {
+            RotateNode(nodeIndex);
+        }
+
+        m_dirtyNodes[nodeIndex] = 0;
+    }
+
+    void Bvh::RotateNode(const UInt32 nodeIndex) {
+        // Swapping child B with grand-child K (child of A) only changes the area of A, the areas of B and K are still
+        // counted once. Pick the swap shrinking A the most, if any.
+        const Node& node = m_nodes[nodeIndex];
+
+        float bestGain = 0.f;
+        std::size_t bestInner = NodeWidth;
+        std::size_t bestOuter = NodeWidth;
+        std::size_t bestGrandChild = NodeWidth;
+        Aabb bestBounds;
+
+        for (std::size_t inner = 0; inner < node.childCount; ++inner) {
+            if (node.children[inner] & PrimitiveBit) {
+                continue;
+            }
+
+            const Node& innerNode = m_nodes[node.children[inner]];
+            const float innerArea = GetChildBounds(node, inner).GetSurfaceArea();
+
+            for (std::size_t grandChild = 0; grandChild < innerNode.childCount; ++grandChild) {
+                Aabb remainingBounds = Aabb::Empty();
+                for (std::size_t slot = 0; slot < innerNode.childCount; ++slot) {
+                    if (slot != grandChild) {
+                        remainingBounds.Merge(GetChildBounds(innerNode, slot));
+                    }
+                }
+
+                for (std::size_t outer = 0; outer < node.childCount; ++outer) {
+                    if (outer == inner) {
+                        continue;
+                    }
+
+                    const Aabb bounds = Aabb::Merge(remainingBounds, GetChildBounds(node, outer));
+                    const float gain = innerArea - bounds.GetSurfaceArea();
+                    if (gain > bestGain) {
+                        bestGain = gain;
+                        bestInner = inner;
+                        bestOuter = outer;
+                        bestGrandChild = grandChild;
+                        bestBounds = bounds;
+                    }
+                }
+            }
+        }
+
+        if (bestInner == NodeWidth) {
+            return;
+        }
+
+        const UInt32 innerIndex = node.children[bestInner];
+        const UInt32 outerChild = node.children[bestOuter];
+        const Aabb outerBounds = GetChildBounds(node, bestOuter);
+        const UInt32 grandChild = m_nodes[innerIndex].children[bestGrandChild];
+        const Aabb grandChildBounds = GetChildBounds(m_nodes[innerIndex], bestGrandChild);
+
+        SetChild(innerIndex, bestGrandChild, outerChild, outerBounds);
+        SetChild(nodeIndex, bestOuter, grandChild, grandChildBounds);
+        SetChildBounds(m_nodes[nodeIndex], bestInner, bestBounds);
+    }
+
+    void Bvh::SetChild(const UInt32 nodeIndex, const std::size_t slot, const UInt32 child, const Aabb& bounds) {
+        Node& node = m_nodes[nodeIndex];
+        node.children[slot] = child;
+        SetChildBounds(node, slot, bounds);
+
+        if (child & PrimitiveBit) {
+            m_primitiveSlots[child & ~PrimitiveBit] = static_cast<UInt32>(nodeIndex * NodeWidth + slot);
+        } else {
+            m_nodes[child].parent = nodeIndex;
+        }
+    }
+
+    void Bvh::SetChildBounds(Node& node, const std::size_t slot, const Aabb& bounds) {
+        node.minX[slot] = bounds.min.x;
+        node.minY[slot] = bounds.min.y;
+        node.minZ[slot] = bounds.min.z;
+        node.maxX[slot] = bounds.max.x;
+        node.maxY[slot] = bounds.max.y;
+        node.maxZ[slot] = bounds.max.z;
+    }
+
+    void Bvh::SplitRange(const BuildRange& range, BuildRange& left, BuildRange& right) {
+        struct Bin {
+            SimdFloat4 boundsMin;
+            SimdFloat4 boundsMax;
+            UInt32 count;
+        };
+
+        // Small ranges use fewer bins, initializing and sweeping them would cost more than binning the primitives
+        const std::size_t binCount = std::min<std::size_t>(BinCount, range.last - range.first);
+
+        const Aabb empty = Aabb::Empty();
+        const SimdFloat4 emptyMin = ToSimd(empty.min);
+        const SimdFloat4 emptyMax = ToSimd(empty.max);
+
+        Bin bins[3][BinCount];
+        for (int axis = 0; axis < 3; ++axis) {
+            for (std::size_t bin = 0; bin < binCount; ++bin) {
+                bins[axis][bin] = {emptyMin, emptyMax, 0};
+            }
+        }
+
+        // Bin the three axes in a single pass, axes without extent put everything in their first bin
+        const SimdFloat4 centroidMin = ToSimd(range.centroidBounds.min);
+        const Vector3 extent = range.centroidBounds.max - range.centroidBounds.min;
+        const SimdFloat4 scale((extent.x > 0.f) ? binCount / extent.x : 0.f,
+                               (extent.y > 0.f) ? binCount / extent.y : 0.f,
+                               (extent.z > 0.f) ? binCount / extent.z : 0.f, 0.f);
+
+        for (UInt32 i = range.first; i < range.last; ++i) {
+            const BuildPrimitive& primitive = m_buildPrimitives[i];
+
+            alignas(16) float binPositions[4];
+            ((primitive.GetCentroid() - centroidMin) * scale).StoreAligned(binPositions);
+
+            for (int axis = 0; axis < 3; ++axis) {
+                Bin& bin = bins[axis][GetBin(binPositions[axis], binCount)];
+                bin.boundsMin = SimdFloat4::Min(bin.boundsMin, primitive.boundsMin);
+                bin.boundsMax = SimdFloat4::Max(bin.boundsMax, primitive.boundsMax);
+                ++bin.count;
+            }
+        }
+
+        float bestCost = std::numeric_limits<float>::infinity();
+        int bestAxis = -1;
+        std::size_t bestSplit = 0;
+
+        for (int axis = 0; axis < 3; ++axis) {
+            // Sweep from the right to get the area and count on the right side of every split plane
+            float rightAreas[BinCount];
+            UInt32 rightCounts[BinCount];
+            SimdFloat4 rightMin = emptyMin;
+            SimdFloat4 rightMax = emptyMax;
+            UInt32 rightCount = 0;
+            for (std::size_t bin = binCount - 1; bin > 0; --bin) {
+                rightMin = SimdFloat4::Min(rightMin, bins[axis][bin].boundsMin);
+                rightMax = SimdFloat4::Max(rightMax, bins[axis][bin].boundsMax);
+                rightCount += bins[axis][bin].count;
+                rightAreas[bin] = GetSurfaceArea(rightMin, rightMax);
+                rightCounts[bin] = rightCount;
+            }
+
+            SimdFloat4 leftMin = emptyMin;
+            SimdFloat4 leftMax = emptyMax;
+            UInt32 leftCount = 0;
+            for (std::size_t split = 1; split < binCount; ++split) {
+                leftMin = SimdFloat4::Min(leftMin, bins[axis][split - 1].boundsMin);
+                leftMax = SimdFloat4::Max(leftMax, bins[axis][split - 1].boundsMax);
+                leftCount += bins[axis][split - 1].count;
+                if (leftCount == 0 || rightCounts[split] == 0) {
+                    continue;
+                }
+
+                const float cost = leftCount * GetSurfaceArea(leftMin, leftMax) + rightCounts[split] * rightAreas[split];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = split;
+                }
+            }
+        }
+
+        // All centroids are at the same place, any split is as good as another
+        if (bestAxis < 0) {
+            const UInt32 middle = range.first + (range.last - range.first) / 2;
+            left = ComputeRange(range.first, middle);
+            right = ComputeRange(middle, range.last);
+            return;
+        }
+
+        const float axisMin = GetAxis(range.centroidBounds.min, bestAxis);
+        const float axisScale = scale.GetLane(bestAxis);
+        const auto middle = std::partition(m_buildPrimitives.begin() + range.first, m_buildPrimitives.begin() + range.last,
+                                           [&](const BuildPrimitive& primitive) {
+                                               const float centroid = primitive.GetCentroid().GetLane(bestAxis);
+                                               return GetBin((centroid - axisMin) * axisScale, binCount) < bestSplit;
+                                           });
+
+        // Both sides are the union of their bins, their centroid bounds are the parent ones cut by the split plane
+        SimdFloat4 sideBounds[2][2] = {{emptyMin, emptyMax}, {emptyMin, emptyMax}};
+        for (std::size_t bin = 0; bin < binCount; ++bin) {
+            SimdFloat4* side = sideBounds[(bin < bestSplit) ? 0 : 1];
+            side[0] = SimdFloat4::Min(side[0], bins[bestAxis][bin].boundsMin);
+            side[1] = SimdFloat4::Max(side[1], bins[bestAxis][bin].boundsMax);
+        }
+
+        const auto middleIndex = static_cast<UInt32>(middle - m_buildPrimitives.begin());
+        left = {range.first, middleIndex, ToAabb(sideBounds[0][0], sideBounds[0][1]), range.centroidBounds};
+        right = {middleIndex, range.last, ToAabb(sideBounds[1][0], sideBounds[1][1]), range.centroidBounds};
+
+        const float splitPosition = axisMin + bestSplit / axisScale;
+        GetAxis(left.centroidBounds.max, bestAxis) = splitPosition;
+        GetAxis(right.centroidBounds.min, bestAxis) = splitPosition;
+    }
+} // namespace Fl
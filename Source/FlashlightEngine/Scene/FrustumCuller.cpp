@@ -0,0 +1,334 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Scene/FrustumCuller.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Fl {
+    struct FrustumCuller::SimdFrustum {
+        static constexpr std::size_t PlaneCount = EnumValueCount_v<FrustumPlane>;
+
+        const Frustum* frustum;
+        SimdFloat4 normalX[PlaneCount];
+        SimdFloat4 normalY[PlaneCount];
+        SimdFloat4 normalZ[PlaneCount];
+        SimdFloat4 absNormalX[PlaneCount];
+        SimdFloat4 absNormalY[PlaneCount];
+        SimdFloat4 absNormalZ[PlaneCount];
+        SimdFloat4 distance[PlaneCount];
+    };
+
+    void FrustumCuller::VisibilityList::CopyTo(std::vector<UInt32>& indices) const {
+        indices.clear();
+        indices.reserve(GetCount());
+
+        for (std::size_t batch = 0; batch < m_batchCounts.size(); ++batch) {
+            const std::span<const UInt32> batchIndices = GetBatch(batch);
+            indices.insert(indices.end(), batchIndices.begin(), batchIndices.end());
+        }
+    }
+
+    std::size_t FrustumCuller::VisibilityList::GetCount() const {
+        std::size_t count = 0;
+        for (const UInt32 batchCount : m_batchCounts) {
+            count += batchCount;
+        }
+
+        return count;
+    }
+
+    FrustumCuller::FrustumCuller(const BoundingVolumeType volumeType) :
+    m_volumeType(volumeType) {
+    }
+
+    UInt32 FrustumCuller::AddBox(const Aabb& box) {
+        FlAssertMsg(m_volumeType == BoundingVolumeType::Box, "[Scene/FrustumCuller] Culler doesn't store boxes.");
+
+        return AddObject(box.GetCenter(), box.GetExtents());
+    }
+
+    UInt32 FrustumCuller::AddSphere(const Vector3& center, const float radius) {
+        FlAssertMsg(m_volumeType == BoundingVolumeType::Sphere, "[Scene/FrustumCuller] Culler doesn't store spheres.");
+
+        return AddObject(center, Vector3(radius));
+    }
+
+    void FrustumCuller::Clear() {
+        m_centerX.clear();
+        m_centerY.clear();
+        m_centerZ.clear();
+        m_extentX.clear();
+        m_extentY.clear();
+        m_extentZ.clear();
+        m_clusterBounds.clear();
+        m_dirtyClusters.clear();
+        m_count = 0;
+        m_hasDirtyClusters = false;
+    }
+
+    auto FrustumCuller::Cull(const std::span<const Frustum> frusta, const std::span<VisibilityList> visibilityLists,
+                             ThreadPool* threadPool) -> Statistics {
+        FlAssertMsg(visibilityLists.size() >= frusta.size(), "[Scene/FrustumCuller] Missing visibility lists.");
+
+        UpdateClusters();
+
+        // Broadcast every plane once, all batches share them
+        std::vector<SimdFrustum> simdFrusta(frusta.size());
+        for (std::size_t i = 0; i < frusta.size(); ++i) {
+            SimdFrustum& simdFrustum = simdFrusta[i];
+            simdFrustum.frustum = &frusta[i];
+
+            for (std::size_t plane = 0; plane < SimdFrustum::PlaneCount; ++plane) {
+                const Plane& frustumPlane = frusta[i].planes[plane];
+                simdFrustum.normalX[plane] = SimdFloat4::Splat(frustumPlane.normal.x);
+                simdFrustum.normalY[plane] = SimdFloat4::Splat(frustumPlane.normal.y);
+                simdFrustum.normalZ[plane] = SimdFloat4::Splat(frustumPlane.normal.z);
+                simdFrustum.absNormalX[plane] = SimdFloat4::Splat(std::abs(frustumPlane.normal.x));
+                simdFrustum.absNormalY[plane] = SimdFloat4::Splat(std::abs(frustumPlane.normal.y));
+                simdFrustum.absNormalZ[plane] = SimdFloat4::Splat(std::abs(frustumPlane.normal.z));
+                simdFrustum.distance[plane] = SimdFloat4::Splat(frustumPlane.distance);
+            }
+        }
+
+        const std::size_t batchCount = (m_count + BatchSize - 1) / BatchSize;
+        for (std::size_t i = 0; i < frusta.size(); ++i) {
+            // Compaction stores whole SIMD groups, lanes past the end of the last one write to the padding
+            visibilityLists[i].m_indices.resize(m_centerX.size());
+            visibilityLists[i].m_batchCounts.assign(batchCount, 0);
+        }
+
+        std::vector<Statistics> batchStatistics(batchCount);
+        const auto cullBatch = [&](const std::size_t first, const std::size_t last) {
+            batchStatistics[first / BatchSize] = CullBatch(simdFrusta, visibilityLists, first, last);
+        };
+
+        if (threadPool) {
+            threadPool->ParallelFor(m_count, BatchSize, cullBatch);
+        } else {
+            for (std::size_t first = 0; first < m_count; first += BatchSize) {
+                cullBatch(first, std::min(first + BatchSize, m_count));
+            }
+        }
+
+        Statistics statistics;
+        for (const Statistics& batch : batchStatistics) {
+            statistics.acceptedClusters += batch.acceptedClusters;
+            statistics.rejectedClusters += batch.rejectedClusters;
+            statistics.testedClusters += batch.testedClusters;
+        }
+
+        return statistics;
+    }
+
+    Aabb FrustumCuller::GetBounds(const UInt32 index) const {
+        FlAssertMsg(index < m_count, "[Scene/FrustumCuller] Invalid object index.");
+
+        const Vector3 center(m_centerX[index], m_centerY[index], m_centerZ[index]);
+        if (m_volumeType == BoundingVolumeType::Sphere) {
+            return Aabb::FromCenterExtents(center, Vector3(m_extentX[index]));
+        }
+
+        return Aabb::FromCenterExtents(center, {m_extentX[index], m_extentY[index], m_extentZ[index]});
+    }
+
+    std::size_t FrustumCuller::GetCount() const {
+        return m_count;
+    }
+
+    BoundingVolumeType FrustumCuller::GetVolumeType() const {
+        return m_volumeType;
+    }
+
+    void FrustumCuller::Reserve(const std::size_t capacity) {
+        const std::size_t paddedCapacity = (capacity + SimdFloat4::Width - 1) / SimdFloat4::Width * SimdFloat4::Width;
+        m_centerX.reserve(paddedCapacity);
+        m_centerY.reserve(paddedCapacity);
+        m_centerZ.reserve(paddedCapacity);
+        m_extentX.reserve(paddedCapacity);
+        if (m_volumeType == BoundingVolumeType::Box) {
+            m_extentY.reserve(paddedCapacity);
+            m_extentZ.reserve(paddedCapacity);
+        }
+
+        m_clusterBounds.reserve((capacity + ClusterSize - 1) / ClusterSize);
+        m_dirtyClusters.reserve((capacity + ClusterSize - 1) / ClusterSize);
+    }
+
+    void FrustumCuller::SetBox(const UInt32 index, const Aabb& box) {
+        FlAssertMsg(m_volumeType == BoundingVolumeType::Box, "[Scene/FrustumCuller] Culler doesn't store boxes.");
+
+        SetObject(index, box.GetCenter(), box.GetExtents());
+    }
+
+    void FrustumCuller::SetSphere(const UInt32 index, const Vector3& center, const float radius) {
+        FlAssertMsg(m_volumeType == BoundingVolumeType::Sphere, "[Scene/FrustumCuller] Culler doesn't store spheres.");
+
+        SetObject(index, center, Vector3(radius));
+    }
+
+    UInt32 FrustumCuller::AddObject(const Vector3& center, const Vector3& extents) {
+        const auto index = static_cast<UInt32>(m_count++);
+
+        // Grow by whole SIMD groups, padding lanes are masked by the kernels
+        if (m_count > m_centerX.size()) {
+            const std::size_t paddedSize = m_centerX.size() + SimdFloat4::Width;
+            m_centerX.resize(paddedSize, 0.f);
+            m_centerY.resize(paddedSize, 0.f);
+            m_centerZ.resize(paddedSize, 0.f);
+            m_extentX.resize(paddedSize, 0.f);
+            if (m_volumeType == BoundingVolumeType::Box) {
+                m_extentY.resize(paddedSize, 0.f);
+                m_extentZ.resize(paddedSize, 0.f);
+            }
+        }
+
+        if (index % ClusterSize == 0) {
+            m_clusterBounds.push_back(Aabb::Empty());
+            m_dirtyClusters.push_back(0);
+        }
+
+        SetObject(index, center, extents);
+
+        return index;
+    }
+
+    auto FrustumCuller::CullBatch(const std::span<const SimdFrustum> frusta,
+                                  const std::span<VisibilityList> visibilityLists, const std::size_t first,
+                                  const std::size_t last) const -> Statistics {
+        Statistics statistics;
+
+        // Clusters are processed for all frusta before moving to the next, their objects stay in cache meanwhile
+        for (std::size_t clusterFirst = first; clusterFirst < last; clusterFirst += ClusterSize) {
+            const std::size_t clusterLast = std::min(clusterFirst + ClusterSize, last);
+            const Aabb& clusterBounds = m_clusterBounds[clusterFirst / ClusterSize];
+
+            for (std::size_t i = 0; i < frusta.size(); ++i) {
+                VisibilityList& visibilityList = visibilityLists[i];
+                UInt32* output = visibilityList.m_indices.data() + first;
+                UInt32& count = visibilityList.m_batchCounts[first / BatchSize];
+
+                switch (frusta[i].frustum->Intersect(clusterBounds)) {
+                    case IntersectionType::Outside:
+                        ++statistics.rejectedClusters;
+                        break;
+
+                    case IntersectionType::Inside:
+                        ++statistics.acceptedClusters;
+                        for (std::size_t index = clusterFirst; index < clusterLast; ++index) {
+                            output[count++] = static_cast<UInt32>(index);
+                        }
+                        break;
+
+                    case IntersectionType::Intersecting: {
+                        ++statistics.testedClusters;
+
+                        const std::size_t visibleCount =
+                            (m_volumeType == BoundingVolumeType::Sphere)
+                                ? CullObjects<true>(frusta[i], clusterFirst, clusterLast, output + count)
+                                : CullObjects<false>(frusta[i], clusterFirst, clusterLast, output + count);
+
+                        count += static_cast<UInt32>(visibleCount);
+                        break;
+                    }
+                }
+            }
+        }
+
+        return statistics;
+    }
+
+    template <bool IsSphere>
+    std::size_t FrustumCuller::CullObjects(const SimdFrustum& frustum, const std::size_t first, const std::size_t last,
+                                           UInt32* output) const {
+        std::size_t count = 0;
+        for (std::size_t i = first; i < last; i += SimdFloat4::Width) {
+            const SimdFloat4 centerX = SimdFloat4::Load(&m_centerX[i]);
+            const SimdFloat4 centerY = SimdFloat4::Load(&m_centerY[i]);
+            const SimdFloat4 centerZ = SimdFloat4::Load(&m_centerZ[i]);
+            const SimdFloat4 extentX = SimdFloat4::Load(&m_extentX[i]);
+
+            SimdFloat4 extentY;
+            SimdFloat4 extentZ;
+            if constexpr (!IsSphere) {
+                extentY = SimdFloat4::Load(&m_extentY[i]);
+                extentZ = SimdFloat4::Load(&m_extentZ[i]);
+            }
+
+            // An object is outside as soon as it is entirely behind one of the planes
+            SimdFloat4 visible;
+            for (std::size_t plane = 0; plane < SimdFrustum::PlaneCount; ++plane) {
+                const SimdFloat4 distance = frustum.normalX[plane] * centerX + frustum.normalY[plane] * centerY +
+                                            frustum.normalZ[plane] * centerZ + frustum.distance[plane];
+
+                SimdFloat4 radius;
+                if constexpr (IsSphere) {
+                    radius = extentX;
+                } else {
+                    radius = frustum.absNormalX[plane] * extentX + frustum.absNormalY[plane] * extentY +
+                             frustum.absNormalZ[plane] * extentZ;
+                }
+
+                const SimdFloat4 inFront = SimdFloat4::GreaterEqual(distance, -radius);
+                visible = (plane == 0) ? inFront : (visible & inFront);
+            }
+
+            int mask = visible.GetMoveMask();
+            if (i + SimdFloat4::Width > last) {
+                mask &= (1 << (last - i)) - 1;
+            }
+
+            // Branchless compaction: every lane is written, only visible ones advance the output
+            for (std::size_t lane = 0; lane < SimdFloat4::Width; ++lane) {
+                output[count] = static_cast<UInt32>(i + lane);
+                count += (mask >> lane) & 1;
+            }
+        }
+
+        return count;
+    }
+
+    void FrustumCuller::SetObject(const UInt32 index, const Vector3& center, const Vector3& extents) {
+        FlAssertMsg(index < m_count, "[Scene/FrustumCuller] Invalid object index.");
+
+        m_centerX[index] = center.x;
+        m_centerY[index] = center.y;
+        m_centerZ[index] = center.z;
+        m_extentX[index] = extents.x;
+        if (m_volumeType == BoundingVolumeType::Box) {
+            m_extentY[index] = extents.y;
+            m_extentZ[index] = extents.z;
+        }
+
+        m_dirtyClusters[index / ClusterSize] = 1;
+        m_hasDirtyClusters = true;
+    }
+
+    void FrustumCuller::UpdateClusters() {
+        if (!m_hasDirtyClusters) {
+            return;
+        }
+
+        for (std::size_t cluster = 0; cluster < m_clusterBounds.size(); ++cluster) {
+            if (!m_dirtyClusters[cluster]) {
+                continue;
+            }
+
+            Aabb bounds = Aabb::Empty();
+            const std::size_t last = std::min((cluster + 1) * ClusterSize, m_count);
+            for (std::size_t index = cluster * ClusterSize; index < last; ++index) {
+                bounds.Merge(GetBounds(static_cast<UInt32>(index)));
+            }
+
+            m_clusterBounds[cluster] = bounds;
+            m_dirtyClusters[cluster] = 0;
+        }
+
+        m_hasDirtyClusters = false;
+    }
+} // namespace Fl
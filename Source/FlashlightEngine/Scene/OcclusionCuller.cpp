@@ -0,0 +1,520 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Scene/OcclusionCuller.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        using ClipVertex = std::array<float, 4>;
+
+        alignas(16) constexpr float LaneOffsets[SimdFloat4::Width] = {0.5f, 1.5f, 2.5f, 3.5f};
+
+        // Rounding errors must never bring occluders closer
+        constexpr float DepthBias = 1e-5f;
+
+        // Written so that the scalar and SIMD paths round the same way
+        float TransformRow(const Matrix4& matrix, const std::size_t row, const float x, const float y, const float z) {
+            return ((matrix.GetElement(row, 0) * x + matrix.GetElement(row, 1) * y) + matrix.GetElement(row, 2) * z) +
+                   matrix.GetElement(row, 3);
+        }
+
+        ClipVertex ClipNear(const ClipVertex& inside, const ClipVertex& outside) {
+            const float t = inside[2] / (inside[2] - outside[2]);
+
+            ClipVertex vertex;
+            for (std::size_t i = 0; i < 4; ++i) {
+                vertex[i] = inside[i] + (outside[i] - inside[i]) * t;
+            }
+
+            vertex[2] = 0.f;
+            return vertex;
+        }
+
+        template <typename F>
+        void ForEachBatch(ThreadPool* threadPool, const std::size_t count, const std::size_t batchSize, F&& func) {
+            if (threadPool) {
+                threadPool->ParallelFor(count, batchSize, func);
+            } else if (count > 0) {
+                func(std::size_t(0), count);
+            }
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    OcclusionCuller::OcclusionCuller() :
+    OcclusionCuller(Settings{}) {
+    }
+
+    OcclusionCuller::OcclusionCuller(const Settings& settings) :
+    m_viewProjection(Matrix4::Identity()), m_statistics(), m_settings(settings) {
+        FlAssertMsg(settings.width > 0 && settings.width % TileWidth == 0,
+                    "[Scene/OcclusionCuller] Width must be a multiple of the tile width.");
+        FlAssertMsg(settings.height > 0 && settings.height % TileHeight == 0,
+                    "[Scene/OcclusionCuller] Height must be a multiple of the tile height.");
+
+        m_depths.assign(std::size_t(settings.width) * settings.height, 1.f);
+
+        for (UInt32 width = settings.width, height = settings.height; width > 1 || height > 1;) {
+            width = (width + 1) / 2;
+            height = (height + 1) / 2;
+
+            Level& level = m_levels.emplace_back();
+            level.width = width;
+            level.height = height;
+            level.minDepths.assign(std::size_t(width) * height, 1.f);
+            level.maxDepths.assign(std::size_t(width) * height, 1.f);
+        }
+    }
+
+    void OcclusionCuller::AddOccluder(const std::span<const Vector3> positions, const std::span<const UInt32> indices,
+                                      const Matrix4& worldViewProjection) {
+        FlAssertMsg(indices.size() % 3 == 0, "[Scene/OcclusionCuller] Indices must form triangles.");
+
+        m_statistics.occluderTriangleCount += indices.size() / 3;
+
+        for (std::size_t triangle = 0; triangle < indices.size(); triangle += 3) {
+            std::array<ClipVertex, 3> vertices;
+            UInt32 behindMask = 0;
+            UInt32 outsideMasks[4] = {0, 0, 0, 0};
+            for (std::size_t i = 0; i < 3; ++i) {
+                FlAssertMsg(indices[triangle + i] < positions.size(), "[Scene/OcclusionCuller] Index out of range.");
+
+                const Vector3& position = positions[indices[triangle + i]];
+                for (std::size_t row = 0; row < 4; ++row) {
+                    vertices[i][row] = TransformRow(worldViewProjection, row, position.x, position.y, position.z);
+                }
+
+                const ClipVertex& vertex = vertices[i];
+                behindMask |= (vertex[2] < 0.f) ? (1u << i) : 0u;
+                outsideMasks[0] |= (vertex[0] < -vertex[3]) ? (1u << i) : 0u;
+                outsideMasks[1] |= (vertex[0] > vertex[3]) ? (1u << i) : 0u;
+                outsideMasks[2] |= (vertex[1] < -vertex[3]) ? (1u << i) : 0u;
+                outsideMasks[3] |= (vertex[1] > vertex[3]) ? (1u << i) : 0u;
+            }
+
+            if (behindMask == 0b111 || std::find(std::begin(outsideMasks), std::end(outsideMasks), 0b111u) !=
+                                           std::end(outsideMasks)) {
+                continue;
+            }
+
+            if (behindMask == 0) {
+                AddTriangle(vertices);
+                continue;
+            }
+
+            // Cut by the near plane: one vertex behind leaves a quad, two vertices leave a triangle
+            const bool isSingleBehind = std::popcount(behindMask) == 1;
+            const auto first = static_cast<std::size_t>(std::countr_zero(isSingleBehind ? behindMask
+                                                                                         : ~behindMask & 0b111));
+            const ClipVertex& single = vertices[first];
+            const ClipVertex& next = vertices[(first + 1) % 3];
+            const ClipVertex& previous = vertices[(first + 2) % 3];
+
+            if (isSingleBehind) {
+                const ClipVertex nextCut = ClipNear(next, single);
+                const ClipVertex previousCut = ClipNear(previous, single);
+                AddTriangle({nextCut, next, previous});
+                AddTriangle({nextCut, previous, previousCut});
+            } else {
+                AddTriangle({single, ClipNear(single, next), ClipNear(single, previous)});
+            }
+        }
+    }
+
+    void OcclusionCuller::BeginFrame(const Matrix4& viewProjection) {
+        m_viewProjection = viewProjection;
+        m_triangles.clear();
+        m_statistics = {};
+
+        std::fill(m_depths.begin(), m_depths.end(), 1.f);
+        for (Level& level : m_levels) {
+            std::fill(level.minDepths.begin(), level.minDepths.end(), 1.f);
+            std::fill(level.maxDepths.begin(), level.maxDepths.end(), 1.f);
+        }
+    }
+
+    float OcclusionCuller::GetMaxDepth(const std::size_t level, const UInt32 x, const UInt32 y) const {
+        FlAssertMsg(level < GetLevelCount(), "[Scene/OcclusionCuller] Invalid level.");
+
+        if (level == 0) {
+            return GetDepth(x, y);
+        }
+
+        return m_levels[level - 1].maxDepths[std::size_t(y) * m_levels[level - 1].width + x];
+    }
+
+    float OcclusionCuller::GetMinDepth(const std::size_t level, const UInt32 x, const UInt32 y) const {
+        FlAssertMsg(level < GetLevelCount(), "[Scene/OcclusionCuller] Invalid level.");
+
+        if (level == 0) {
+            return GetDepth(x, y);
+        }
+
+        return m_levels[level - 1].minDepths[std::size_t(y) * m_levels[level - 1].width + x];
+    }
+
+    bool OcclusionCuller::IsOccluded(const Aabb& box) const {
+        return IsUsingSimd() ? IsOccludedImpl<true>(box) : IsOccludedImpl<false>(box);
+    }
+
+    void OcclusionCuller::RenderOccluders(ThreadPool* threadPool) {
+        const Clock clock;
+
+        const UInt32 tileCountX = m_settings.width / TileWidth;
+        const std::size_t tileCount = std::size_t(tileCountX) * (m_settings.height / TileHeight);
+
+        // Counting sort of the triangles by the tiles their bounds overlap
+        m_tileOffsets.assign(tileCount + 1, 0);
+        for (const OccluderTriangle& triangle : m_triangles) {
+            for (UInt32 tileY = triangle.minY / TileHeight; tileY <= triangle.maxY / TileHeight; ++tileY) {
+                for (UInt32 tileX = triangle.minX / TileWidth; tileX <= triangle.maxX / TileWidth; ++tileX) {
+                    ++m_tileOffsets[tileY * tileCountX + tileX + 1];
+                }
+            }
+        }
+
+        for (std::size_t tile = 0; tile < tileCount; ++tile) {
+            m_tileOffsets[tile + 1] += m_tileOffsets[tile];
+        }
+
+        m_tileTriangles.resize(m_tileOffsets.back());
+        std::vector<UInt32> cursors(m_tileOffsets.begin(), m_tileOffsets.end() - 1);
+        for (std::size_t index = 0; index < m_triangles.size(); ++index) {
+            const OccluderTriangle& triangle = m_triangles[index];
+            for (UInt32 tileY = triangle.minY / TileHeight; tileY <= triangle.maxY / TileHeight; ++tileY) {
+                for (UInt32 tileX = triangle.minX / TileWidth; tileX <= triangle.maxX / TileWidth; ++tileX) {
+                    m_tileTriangles[cursors[tileY * tileCountX + tileX]++] = static_cast<UInt32>(index);
+                }
+            }
+        }
+
+        // Tiles own disjoint pixels of the depth buffer
+        ForEachBatch(threadPool, tileCount, 1, [&](const std::size_t first, const std::size_t last) {
+            for (std::size_t tile = first; tile < last; ++tile) {
+                if (IsUsingSimd()) {
+                    RasterizeTile<true>(static_cast<UInt32>(tile));
+                } else {
+                    RasterizeTile<false>(static_cast<UInt32>(tile));
+                }
+            }
+        });
+
+        BuildHierarchy();
+
+        m_statistics.rasterizedTriangleCount = m_triangles.size();
+        m_statistics.rasterizationTime += clock.GetElapsedTime();
+    }
+
+    std::size_t OcclusionCuller::TestOccludees(const std::span<const Aabb> boxes, const std::span<UInt8> visibility,
+                                               ThreadPool* threadPool) {
+        FlAssertMsg(visibility.size() == boxes.size(), "[Scene/OcclusionCuller] Visibility size mismatch.");
+
+        const Clock clock;
+
+        ForEachBatch(threadPool, boxes.size(), OccludeeBatchSize, [&](const std::size_t first,
+                                                                      const std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                visibility[i] = IsOccluded(boxes[i]) ? 0 : 1;
+            }
+        });
+
+        const auto culledCount = static_cast<std::size_t>(std::count(visibility.begin(), visibility.end(), 0));
+
+        m_statistics.occludeeCount += boxes.size();
+        m_statistics.culledOccludeeCount += culledCount;
+        m_statistics.testTime += clock.GetElapsedTime();
+
+        return culledCount;
+    }
+
+    void OcclusionCuller::AddTriangle(const std::array<ClipVertex, 3>& vertices) {
+        const auto width = static_cast<float>(m_settings.width);
+        const auto height = static_cast<float>(m_settings.height);
+
+        std::array<float, 3> screenX;
+        std::array<float, 3> screenY;
+        std::array<float, 3> depths;
+        for (std::size_t i = 0; i < 3; ++i) {
+            const float inverseW = 1.f / vertices[i][3];
+            screenX[i] = (vertices[i][0] * inverseW * 0.5f + 0.5f) * width;
+            screenY[i] = (0.5f - vertices[i][1] * inverseW * 0.5f) * height;
+            depths[i] = vertices[i][2] * inverseW;
+        }
+
+        // Pixels whose center is within the bounds of the triangle
+        const float minX = std::max(std::ceil(std::min({screenX[0], screenX[1], screenX[2]}) - 0.5f), 0.f);
+        const float minY = std::max(std::ceil(std::min({screenY[0], screenY[1], screenY[2]}) - 0.5f), 0.f);
+        const float maxX = std::min(std::floor(std::max({screenX[0], screenX[1], screenX[2]}) - 0.5f), width - 1.f);
+        const float maxY = std::min(std::floor(std::max({screenY[0], screenY[1], screenY[2]}) - 0.5f), height - 1.f);
+        if (!(minX <= maxX && minY <= maxY)) {
+            return;
+        }
+
+        float area = (screenX[1] - screenX[0]) * (screenY[2] - screenY[0]) -
+                     (screenX[2] - screenX[0]) * (screenY[1] - screenY[0]);
+        if (area == 0.f) {
+            return;
+        }
+
+        // Both orientations occlude
+        if (area < 0.f) {
+            std::swap(screenX[1], screenX[2]);
+            std::swap(screenY[1], screenY[2]);
+            std::swap(depths[1], depths[2]);
+            area = -area;
+        }
+
+        OccluderTriangle& triangle = m_triangles.emplace_back();
+        triangle.minX = static_cast<UInt32>(minX);
+        triangle.minY = static_cast<UInt32>(minY);
+        triangle.maxX = static_cast<UInt32>(maxX);
+        triangle.maxY = static_cast<UInt32>(maxY);
+
+        float depthX = 0.f;
+        float depthY = 0.f;
+        for (std::size_t edge = 0; edge < 3; ++edge) {
+            const std::size_t from = (edge + 1) % 3;
+            const std::size_t to = (edge + 2) % 3;
+            const float a = screenY[from] - screenY[to];
+            const float b = screenX[to] - screenX[from];
+
+            // Pixels on shared edges are written by both triangles, which leaves no crack in meshes
+            triangle.edgeA[edge] = a;
+            triangle.edgeB[edge] = b;
+            triangle.edgeC[edge] = -(a * screenX[from] + b * screenY[from]);
+
+            depthX += depths[edge] * a;
+            depthY += depths[edge] * b;
+        }
+
+        // Furthest depth over the pixel
+        triangle.depthX = depthX / area;
+        triangle.depthY = depthY / area;
+        triangle.depthC = depths[0] - triangle.depthX * screenX[0] - triangle.depthY * screenY[0] +
+                          0.5f * (std::abs(triangle.depthX) + std::abs(triangle.depthY)) + DepthBias;
+    }
+
+    void OcclusionCuller::BuildHierarchy() {
+        UInt32 childWidth = m_settings.width;
+        UInt32 childHeight = m_settings.height;
+        const float* childMinDepths = m_depths.data();
+        const float* childMaxDepths = m_depths.data();
+
+        for (Level& level : m_levels) {
+            for (UInt32 y = 0; y < level.height; ++y) {
+                const UInt32 childY = 2 * y;
+                const UInt32 childRowCount = std::min(2u, childHeight - childY);
+
+                for (UInt32 x = 0; x < level.width; ++x) {
+                    const UInt32 childX = 2 * x;
+                    const UInt32 childColumnCount = std::min(2u, childWidth - childX);
+
+                    float minDepth = 1.f;
+                    float maxDepth = 0.f;
+                    for (UInt32 row = 0; row < childRowCount; ++row) {
+                        for (UInt32 column = 0; column < childColumnCount; ++column) {
+                            const std::size_t child = std::size_t(childY + row) * childWidth + childX + column;
+                            minDepth = std::min(minDepth, childMinDepths[child]);
+                            maxDepth = std::max(maxDepth, childMaxDepths[child]);
+                        }
+                    }
+
+                    level.minDepths[std::size_t(y) * level.width + x] = minDepth;
+                    level.maxDepths[std::size_t(y) * level.width + x] = maxDepth;
+                }
+            }
+
+            childWidth = level.width;
+            childHeight = level.height;
+            childMinDepths = level.minDepths.data();
+            childMaxDepths = level.maxDepths.data();
+        }
+    }
+
+    template <bool UseSimd>
+    bool OcclusionCuller::IsOccludedImpl(const Aabb& box) const {
+        // Corners ordered by x, then y, then z
+        alignas(16) float clip[4][8];
+        if constexpr (UseSimd) {
+            const SimdFloat4 cornerX(box.min.x, box.max.x, box.min.x, box.max.x);
+            const SimdFloat4 cornerY(box.min.y, box.min.y, box.max.y, box.max.y);
+            for (std::size_t row = 0; row < 4; ++row) {
+                const SimdFloat4 partial = SimdFloat4::Splat(m_viewProjection.GetElement(row, 0)) * cornerX +
+                                           SimdFloat4::Splat(m_viewProjection.GetElement(row, 1)) * cornerY;
+                for (std::size_t half = 0; half < 2; ++half) {
+                    const float z = (half == 0) ? box.min.z : box.max.z;
+                    ((partial + SimdFloat4::Splat(m_viewProjection.GetElement(row, 2) * z)) +
+                     SimdFloat4::Splat(m_viewProjection.GetElement(row, 3)))
+                        .StoreAligned(&clip[row][half * SimdFloat4::Width]);
+                }
+            }
+        } else {
+            for (std::size_t corner = 0; corner < 8; ++corner) {
+                const float x = (corner & 1) ? box.max.x : box.min.x;
+                const float y = (corner & 2) ? box.max.y : box.min.y;
+                const float z = (corner & 4) ? box.max.z : box.min.z;
+                for (std::size_t row = 0; row < 4; ++row) {
+                    clip[row][corner] = TransformRow(m_viewProjection, row, x, y, z);
+                }
+            }
+        }
+
+        const auto width = static_cast<float>(m_settings.width);
+        const auto height = static_cast<float>(m_settings.height);
+
+        float minX = width;
+        float minY = height;
+        float maxX = 0.f;
+        float maxY = 0.f;
+        float minDepth = 1.f;
+        for (std::size_t corner = 0; corner < 8; ++corner) {
+            // Crossing the near plane, the projection of the box isn't bounded
+            if (!(clip[2][corner] >= 0.f) || !(clip[3][corner] > 0.f)) {
+                return false;
+            }
+
+            const float inverseW = 1.f / clip[3][corner];
+            const float x = (clip[0][corner] * inverseW * 0.5f + 0.5f) * width;
+            const float y = (0.5f - clip[1][corner] * inverseW * 0.5f) * height;
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            minDepth = std::min(minDepth, clip[2][corner] * inverseW);
+        }
+
+        if (minX >= width || minY >= height || maxX <= 0.f || maxY <= 0.f) {
+            return false;
+        }
+
+        // Pixels overlapped by the screen bounds
+        const auto firstX = static_cast<UInt32>(std::max(minX, 0.f));
+        const auto firstY = static_cast<UInt32>(std::max(minY, 0.f));
+        const UInt32 lastX = std::max(firstX, static_cast<UInt32>(std::min(std::ceil(maxX), width) - 1.f));
+        const UInt32 lastY = std::max(firstY, static_cast<UInt32>(std::min(std::ceil(maxY), height) - 1.f));
+
+        // Coarsest level where the bounds overlap at most 2x2 texels
+        const UInt32 extent = std::max(lastX - firstX, lastY - firstY) + 1;
+        const std::size_t startLevel = std::min(static_cast<std::size_t>(std::bit_width(extent - 1)), m_levels.size());
+
+        struct Texel {
+            std::size_t level;
+            UInt32 x;
+            UInt32 y;
+        };
+
+        SmallVector<Texel, 64> stack;
+        const auto pushTexels = [&](const std::size_t level, const UInt32 minTexelX, const UInt32 minTexelY,
+                                    const UInt32 maxTexelX, const UInt32 maxTexelY) {
+            for (UInt32 y = std::max(minTexelY, firstY >> level); y <= std::min(maxTexelY, lastY >> level); ++y) {
+                for (UInt32 x = std::max(minTexelX, firstX >> level); x <= std::min(maxTexelX, lastX >> level); ++x) {
+                    stack.push_back({level, x, y});
+                }
+            }
+        };
+
+        pushTexels(startLevel, 0, 0, m_settings.width, m_settings.height);
+        while (!stack.empty()) {
+            const Texel texel = stack.back();
+            stack.pop_back();
+
+            if (minDepth > GetMaxDepth(texel.level, texel.x, texel.y)) {
+                continue;
+            }
+
+            if (texel.level == 0) {
+                return false;
+            }
+
+            // Everything below a texel entirely within the bounds is behind the box
+            const bool isWithinBounds = (texel.x << texel.level) >= firstX && (texel.y << texel.level) >= firstY &&
+                                        ((texel.x + 1) << texel.level) - 1 <= lastX &&
+                                        ((texel.y + 1) << texel.level) - 1 <= lastY;
+            if (isWithinBounds && minDepth <= GetMinDepth(texel.level, texel.x, texel.y)) {
+                return false;
+            }
+
+            pushTexels(texel.level - 1, 2 * texel.x, 2 * texel.y, 2 * texel.x + 1, 2 * texel.y + 1);
+        }
+
+        return true;
+    }
+
+    template <bool UseSimd>
+    void OcclusionCuller::RasterizeTile(const UInt32 tile) {
+        const UInt32 tileCountX = m_settings.width / TileWidth;
+        const UInt32 tileMinX = (tile % tileCountX) * TileWidth;
+        const UInt32 tileMinY = (tile / tileCountX) * TileHeight;
+        const SimdFloat4 laneOffsets = SimdFloat4::LoadAligned(LaneOffsets);
+        const SimdFloat4 zero = SimdFloat4::Zero();
+
+        for (UInt32 i = m_tileOffsets[tile]; i < m_tileOffsets[tile + 1]; ++i) {
+            const OccluderTriangle& triangle = m_triangles[m_tileTriangles[i]];
+            const UInt32 minX = std::max(triangle.minX, tileMinX);
+            const UInt32 maxX = std::min(triangle.maxX, tileMinX + TileWidth - 1);
+            const UInt32 minY = std::max(triangle.minY, tileMinY);
+            const UInt32 maxY = std::min(triangle.maxY, tileMinY + TileHeight - 1);
+
+            for (UInt32 y = minY; y <= maxY; ++y) {
+                const float centerY = static_cast<float>(y) + 0.5f;
+                std::array<float, 3> edgeRows;
+                for (std::size_t edge = 0; edge < 3; ++edge) {
+                    edgeRows[edge] = triangle.edgeB[edge] * centerY + triangle.edgeC[edge];
+                }
+
+                const float depthRow = triangle.depthY * centerY + triangle.depthC;
+                float* depths = &m_depths[std::size_t(y) * m_settings.width];
+
+                if constexpr (UseSimd) {
+                    // Groups start aligned, the lanes out of the bounds are masked like the scalar path skips them
+                    const SimdFloat4 columnMin = SimdFloat4::Splat(static_cast<float>(minX));
+                    const SimdFloat4 columnMax = SimdFloat4::Splat(static_cast<float>(maxX + 1));
+                    for (UInt32 x = minX & ~UInt32(SimdFloat4::Width - 1); x <= maxX; x += SimdFloat4::Width) {
+                        const SimdFloat4 centersX = SimdFloat4::Splat(static_cast<float>(x)) + laneOffsets;
+
+                        SimdFloat4 mask = SimdFloat4::Greater(centersX, columnMin) &
+                                          SimdFloat4::Less(centersX, columnMax);
+                        for (std::size_t edge = 0; edge < 3; ++edge) {
+                            mask = mask & SimdFloat4::GreaterEqual(SimdFloat4::Splat(triangle.edgeA[edge]) * centersX +
+                                                                       SimdFloat4::Splat(edgeRows[edge]),
+                                                                   zero);
+                        }
+
+                        if (mask.GetMoveMask() == 0) {
+                            continue;
+                        }
+
+                        const SimdFloat4 depth = SimdFloat4::Splat(triangle.depthX) * centersX +
+                                                 SimdFloat4::Splat(depthRow);
+                        const SimdFloat4 stored = SimdFloat4::Load(&depths[x]);
+                        SimdFloat4::Select(mask, SimdFloat4::Min(stored, depth), stored).Store(&depths[x]);
+                    }
+                } else {
+                    for (UInt32 x = minX; x <= maxX; ++x) {
+                        const float centerX = static_cast<float>(x) + 0.5f;
+
+                        bool isCovered = true;
+                        for (std::size_t edge = 0; edge < 3; ++edge) {
+                            isCovered &= triangle.edgeA[edge] * centerX + edgeRows[edge] >= 0.f;
+                        }
+
+                        if (isCovered) {
+                            depths[x] = std::min(depths[x], triangle.depthX * centerX + depthRow);
+                        }
+                    }
+                }
+            }
+        }
+    }
+} // namespace Fl
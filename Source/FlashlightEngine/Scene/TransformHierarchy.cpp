@@ -0,0 +1,307 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Scene/TransformHierarchy.hpp>
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <algorithm>
+
+namespace Fl {
+    namespace FL_ANONYMOUS_NAMESPACE {
+        constexpr UInt32 UnknownDepth = std::numeric_limits<UInt32>::max();
+        constexpr UInt32 DeadDepth = UnknownDepth - 1;
+
+        template <typename T>
+        void Permute(std::vector<T>& values, const std::vector<UInt32>& newIndices, const std::size_t newCount) {
+            std::vector<T> permuted(newCount);
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                if (newIndices[i] != std::numeric_limits<UInt32>::max()) {
+                    permuted[newIndices[i]] = std::move(values[i]);
+                }
+            }
+
+            values = std::move(permuted);
+        }
+    } // namespace FL_ANONYMOUS_NAMESPACE
+
+    FL_USE_ANONYMOUS_NAMESPACE
+
+    auto TransformHierarchy::Create(const TransformId parent) -> TransformId {
+        UInt32 parentIndex = InvalidIndex;
+        if (parent != InvalidId) {
+            parentIndex = GetIndex(parent);
+            FlAssertMsg(!(m_flags[parentIndex] & DestroyedFlag), "[Scene/TransformHierarchy] Parent was destroyed.");
+        }
+
+        TransformId id;
+        if (!m_freeIds.empty()) {
+            id = m_freeIds.back();
+            m_freeIds.pop_back();
+        } else {
+            id = static_cast<TransformId>(m_idToIndex.size());
+            m_idToIndex.push_back(InvalidIndex);
+        }
+
+        const auto index = static_cast<UInt32>(m_ids.size());
+        m_idToIndex[id] = index;
+
+        m_worldMatrices.push_back(Matrix4::Identity());
+        m_localRotations.push_back(Quaternion::Identity());
+        m_localPositions.push_back(Vector3::Zero());
+        m_localScales.push_back(Vector3::Unit());
+        m_parentIndices.push_back(parentIndex);
+        m_ids.push_back(id);
+        m_flags.push_back(DirtyFlag);
+
+        m_isStructureDirty = true;
+        m_hasDirtyTransforms = true;
+
+        return id;
+    }
+
+    void TransformHierarchy::Destroy(const TransformId id) {
+        m_flags[GetIndex(id)] |= DestroyedFlag;
+        m_isStructureDirty = true;
+    }
+
+    std::size_t TransformHierarchy::GetCount() const {
+        return m_ids.size();
+    }
+
+    std::size_t TransformHierarchy::GetDepthCount() const {
+        return m_depthOffsets.empty() ? 0 : m_depthOffsets.size() - 1;
+    }
+
+    const Vector3& TransformHierarchy::GetLocalPosition(const TransformId id) const {
+        return m_localPositions[GetIndex(id)];
+    }
+
+    const Quaternion& TransformHierarchy::GetLocalRotation(const TransformId id) const {
+        return m_localRotations[GetIndex(id)];
+    }
+
+    const Vector3& TransformHierarchy::GetLocalScale(const TransformId id) const {
+        return m_localScales[GetIndex(id)];
+    }
+
+    auto TransformHierarchy::GetParent(const TransformId id) const -> TransformId {
+        const UInt32 parentIndex = m_parentIndices[GetIndex(id)];
+        return (parentIndex != InvalidIndex) ? m_ids[parentIndex] : InvalidId;
+    }
+
+    const Matrix4& TransformHierarchy::GetWorldMatrix(const TransformId id) const {
+        return m_worldMatrices[GetIndex(id)];
+    }
+
+    bool TransformHierarchy::IsValid(const TransformId id) const {
+        return id < m_idToIndex.size() && m_idToIndex[id] != InvalidIndex &&
+               !(m_flags[m_idToIndex[id]] & DestroyedFlag);
+    }
+
+    void TransformHierarchy::Reserve(const std::size_t capacity) {
+        m_worldMatrices.reserve(capacity);
+        m_localRotations.reserve(capacity);
+        m_localPositions.reserve(capacity);
+        m_localScales.reserve(capacity);
+        m_parentIndices.reserve(capacity);
+        m_ids.reserve(capacity);
+        m_flags.reserve(capacity);
+        m_idToIndex.reserve(capacity);
+    }
+
+    void TransformHierarchy::SetLocalPosition(const TransformId id, const Vector3& position) {
+        const UInt32 index = GetIndex(id);
+        m_localPositions[index] = position;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetLocalRotation(const TransformId id, const Quaternion& rotation) {
+        const UInt32 index = GetIndex(id);
+        m_localRotations[index] = rotation;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetLocalScale(const TransformId id, const Vector3& scale) {
+        const UInt32 index = GetIndex(id);
+        m_localScales[index] = scale;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetLocalTransform(const TransformId id, const Vector3& position,
+                                               const Quaternion& rotation, const Vector3& scale) {
+        const UInt32 index = GetIndex(id);
+        m_localPositions[index] = position;
+        m_localRotations[index] = rotation;
+        m_localScales[index] = scale;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetParent(const TransformId id, const TransformId parent) {
+        const UInt32 index = GetIndex(id);
+
+        UInt32 parentIndex = InvalidIndex;
+        if (parent != InvalidId) {
+            parentIndex = GetIndex(parent);
+
+#if defined(FL_DEBUG)
+            for (UInt32 ancestor = parentIndex; ancestor != InvalidIndex; ancestor = m_parentIndices[ancestor]) {
+                FlAssertMsg(ancestor != index, "[Scene/TransformHierarchy] Reparenting would create a cycle.");
+            }
+#endif
+        }
+
+        m_parentIndices[index] = parentIndex;
+        m_isStructureDirty = true;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::Update(ThreadPool* threadPool) {
+        if (m_isStructureDirty) {
+            Rebuild();
+        }
+
+        if (!m_hasDirtyTransforms) {
+            return;
+        }
+
+        // Levels must be processed in order, but the batches of a level only read the previous ones
+        for (std::size_t depth = 0; depth + 1 < m_depthOffsets.size(); ++depth) {
+            const UInt32 first = m_depthOffsets[depth];
+            const UInt32 last = m_depthOffsets[depth + 1];
+
+            if (threadPool) {
+                threadPool->ParallelFor(last - first, BatchSize, [&](const std::size_t begin, const std::size_t end) {
+                    UpdateRange(first + static_cast<UInt32>(begin), first + static_cast<UInt32>(end));
+                });
+            } else {
+                UpdateRange(first, last);
+            }
+        }
+
+        std::fill(m_flags.begin(), m_flags.end(), UInt8(0));
+        m_hasDirtyTransforms = false;
+    }
+
+    UInt32 TransformHierarchy::GetIndex(const TransformId id) const {
+        FlAssertMsg(id < m_idToIndex.size() && m_idToIndex[id] != InvalidIndex,
+                    "[Scene/TransformHierarchy] Invalid transform identifier.");
+
+        return m_idToIndex[id];
+    }
+
+    void TransformHierarchy::MarkDirty(const UInt32 index) {
+        m_flags[index] |= DirtyFlag;
+        m_hasDirtyTransforms = true;
+    }
+
+    void TransformHierarchy::Rebuild() {
+        const std::size_t count = m_ids.size();
+
+        // Compute the depth of every transform by walking up to the first ancestor with a known depth
+        std::vector<UInt32> depths(count, UnknownDepth);
+        std::vector<UInt32> path;
+        UInt32 maxDepth = 0;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            if (depths[i] != UnknownDepth) {
+                continue;
+            }
+
+            path.clear();
+            UInt32 ancestor = static_cast<UInt32>(i);
+            while (ancestor != InvalidIndex && depths[ancestor] == UnknownDepth) {
+                path.push_back(ancestor);
+                ancestor = m_parentIndices[ancestor];
+            }
+
+            UInt32 depth = 0;
+            if (ancestor != InvalidIndex) {
+                depth = (depths[ancestor] == DeadDepth) ? DeadDepth : depths[ancestor] + 1;
+            }
+
+            // Descendants of destroyed transforms are destroyed too
+            for (auto it = path.rbegin(); it != path.rend(); ++it) {
+                if (depth != DeadDepth && (m_flags[*it] & DestroyedFlag)) {
+                    depth = DeadDepth;
+                }
+
+                depths[*it] = depth;
+                if (depth != DeadDepth) {
+                    maxDepth = std::max(maxDepth, depth);
+                    ++depth;
+                }
+            }
+        }
+
+        // Counting sort by depth, stable to keep siblings close to each other
+        m_depthOffsets.assign(count > 0 ? maxDepth + 2 : 0, 0);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (depths[i] != DeadDepth) {
+                ++m_depthOffsets[depths[i] + 1];
+            }
+        }
+
+        for (std::size_t depth = 1; depth < m_depthOffsets.size(); ++depth) {
+            m_depthOffsets[depth] += m_depthOffsets[depth - 1];
+        }
+
+        const std::size_t liveCount = m_depthOffsets.empty() ? 0 : m_depthOffsets.back();
+
+        std::vector<UInt32> cursors(m_depthOffsets);
+        std::vector<UInt32> newIndices(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (depths[i] == DeadDepth) {
+                newIndices[i] = InvalidIndex;
+
+                m_idToIndex[m_ids[i]] = InvalidIndex;
+                m_freeIds.push_back(m_ids[i]);
+            } else {
+                newIndices[i] = cursors[depths[i]]++;
+            }
+        }
+
+        for (UInt32& parentIndex : m_parentIndices) {
+            if (parentIndex != InvalidIndex) {
+                parentIndex = newIndices[parentIndex];
+            }
+        }
+
+        Permute(m_worldMatrices, newIndices, liveCount);
+        Permute(m_localRotations, newIndices, liveCount);
+        Permute(m_localPositions, newIndices, liveCount);
+        Permute(m_localScales, newIndices, liveCount);
+        Permute(m_parentIndices, newIndices, liveCount);
+        Permute(m_ids, newIndices, liveCount);
+        Permute(m_flags, newIndices, liveCount);
+
+        for (std::size_t i = 0; i < liveCount; ++i) {
+            m_idToIndex[m_ids[i]] = static_cast<UInt32>(i);
+        }
+
+        m_isStructureDirty = false;
+    }
+
+    void TransformHierarchy::UpdateRange(const UInt32 first, const UInt32 last) {
+        for (UInt32 i = first; i < last; ++i) {
+            const UInt32 parentIndex = m_parentIndices[i];
+
+            UInt8 flags = m_flags[i];
+            if (parentIndex != InvalidIndex) {
+                flags |= m_flags[parentIndex] & DirtyFlag;
+            }
+
+            if (!(flags & DirtyFlag)) {
+                continue;
+            }
+
+            // Children (in the next level) read this flag to know whether their parent changed
+            m_flags[i] = flags;
+
+            const Matrix4 localMatrix = Matrix4::FromTransform(m_localPositions[i], m_localRotations[i], m_localScales[i]);
+            m_worldMatrices[i] = (parentIndex != InvalidIndex) ? m_worldMatrices[parentIndex] * localMatrix : localMatrix;
+        }
+    }
+} // namespace Fl
@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Utility/ScratchAllocator.hpp>
+
+#include <FlashlightEngine/Utility/Assert.hpp>
+
+#include <new>
+
+namespace Fl {
+    ScratchBuffer::~ScratchBuffer() {
+        FlAssertMsg(m_allocationCount == 0, "[Utility/ScratchBuffer] Buffer destroyed with live allocations.");
+
+        for (void* block : m_overflowBlocks) {
+            ::operator delete(block, std::align_val_t(BlockAlignment));
+        }
+
+        ::operator delete(m_block, std::align_val_t(BlockAlignment));
+    }
+
+    void* ScratchBuffer::Allocate(const std::size_t size, const std::size_t alignment) {
+        FlAssertMsg(alignment > 0 && (alignment & (alignment - 1)) == 0,
+                    "[Utility/ScratchBuffer] Alignment must be a power of two.");
+        FlAssertMsg(alignment <= BlockAlignment, "[Utility/ScratchBuffer] Alignment is too large.");
+
+        ++m_allocationCount;
+
+        // Worst case padding included, the block grown from it must fit the same allocations whatever their order
+        m_usedSize += size + alignment - 1;
+
+        const std::size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= m_capacity) {
+            m_offset = offset + size;
+            return m_block + offset;
+        }
+
+        void* block = ::operator new(size, std::align_val_t(BlockAlignment));
+        m_overflowBlocks.push_back(block);
+
+        return block;
+    }
+
+    void ScratchBuffer::Deallocate(void*) {
+        FlAssertMsg(m_allocationCount > 0, "[Utility/ScratchBuffer] No allocation to release.");
+
+        // Memory is only reclaimed when the arena rewinds
+        if (--m_allocationCount == 0) {
+            Rewind();
+        }
+    }
+
+    void ScratchBuffer::Rewind() {
+        for (void* block : m_overflowBlocks) {
+            ::operator delete(block, std::align_val_t(BlockAlignment));
+        }
+
+        if (!m_overflowBlocks.empty() && m_usedSize > m_capacity) {
+            ::operator delete(m_block, std::align_val_t(BlockAlignment));
+            m_block = static_cast<std::byte*>(::operator new(m_usedSize, std::align_val_t(BlockAlignment)));
+            m_capacity = m_usedSize;
+        }
+
+        m_overflowBlocks.clear();
+        m_offset = 0;
+        m_usedSize = 0;
+    }
+} // namespace Fl
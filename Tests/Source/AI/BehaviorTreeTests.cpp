@@ -0,0 +1,216 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/AI/BehaviorTree.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+    enum class Activity : Fl::UInt8 {
+        None,
+        Flee,
+        Attack,
+        Wander
+    };
+
+    struct Agents {
+        std::vector<float> health;
+        std::vector<Fl::UInt8> hasTarget;
+        std::vector<float> targetDistance;
+        std::vector<Activity> activities;
+        std::size_t leafCallCount = 0;
+    };
+
+    Fl::BehaviorTree::LeafCallback MakeCondition(Agents& agents, bool (*predicate)(const Agents&, Fl::UInt32)) {
+        return [&agents, predicate](std::span<const Fl::UInt32> ids, std::span<Fl::BehaviorStatus> statuses) {
+            ++agents.leafCallCount;
+            for (std::size_t i = 0; i < ids.size(); ++i) {
+                statuses[i] = predicate(agents, ids[i]) ? Fl::BehaviorStatus::Success : Fl::BehaviorStatus::Failure;
+            }
+        };
+    }
+
+    Fl::BehaviorTree::LeafCallback MakeAction(Agents& agents, const Activity activity,
+                                              const Fl::BehaviorStatus status) {
+        return [&agents, activity, status](std::span<const Fl::UInt32> ids, std::span<Fl::BehaviorStatus> statuses) {
+            ++agents.leafCallCount;
+            for (std::size_t i = 0; i < ids.size(); ++i) {
+                agents.activities[ids[i]] = activity;
+                statuses[i] = status;
+            }
+        };
+    }
+
+    bool IsHurt(const Agents& agents, const Fl::UInt32 id) {
+        return agents.health[id] < 0.25f;
+    }
+
+    // Flees when hurt, attacks close targets and wanders otherwise
+    void BuildTree(Fl::BehaviorTree& tree, Agents& agents) {
+        tree.BeginNode(Fl::BehaviorNodeKind::Selector);
+        {
+            tree.BeginNode(Fl::BehaviorNodeKind::Sequence);
+            tree.AddLeaf(Fl::BehaviorNodeKind::Condition, MakeCondition(agents, &IsHurt));
+            tree.AddLeaf(Fl::BehaviorNodeKind::Action, MakeAction(agents, Activity::Flee, Fl::BehaviorStatus::Running));
+            tree.EndNode();
+
+            tree.BeginNode(Fl::BehaviorNodeKind::Sequence);
+            tree.AddLeaf(Fl::BehaviorNodeKind::Condition, MakeCondition(agents, [](const Agents& a, Fl::UInt32 id) {
+                return a.hasTarget[id] != 0;
+            }));
+            tree.BeginNode(Fl::BehaviorNodeKind::Inverter);
+            tree.AddLeaf(Fl::BehaviorNodeKind::Condition, MakeCondition(agents, [](const Agents& a, Fl::UInt32 id) {
+                return a.targetDistance[id] > 10.0f;
+            }));
+            tree.EndNode();
+            tree.AddLeaf(Fl::BehaviorNodeKind::Action,
+                         MakeAction(agents, Activity::Attack, Fl::BehaviorStatus::Success));
+            tree.EndNode();
+
+            tree.AddLeaf(Fl::BehaviorNodeKind::Action,
+                         MakeAction(agents, Activity::Wander, Fl::BehaviorStatus::Running));
+        }
+        tree.EndNode();
+    }
+
+    Fl::BehaviorStatus GetExpectedStatus(const Agents& agents, const Fl::UInt32 id, Activity& activity) {
+        if (IsHurt(agents, id)) {
+            activity = Activity::Flee;
+            return Fl::BehaviorStatus::Running;
+        }
+        if (agents.hasTarget[id] != 0 && agents.targetDistance[id] <= 10.0f) {
+            activity = Activity::Attack;
+            return Fl::BehaviorStatus::Success;
+        }
+
+        activity = Activity::Wander;
+        return Fl::BehaviorStatus::Running;
+    }
+} // namespace
+
+SCENARIO("BehaviorTree", "[AI][BehaviorTree]") {
+    GIVEN("A tree of composites, decorators and leaves") {
+        Agents agents;
+        Fl::BehaviorTree tree;
+        BuildTree(tree, agents);
+
+        THEN("Nodes are stored depth-first with the end of their subtree") {
+            REQUIRE(tree.IsComplete());
+            REQUIRE(tree.GetNodes().size() == 10);
+            CHECK(tree.GetDepth() == 4);
+            CHECK(tree.GetNode(0).end == 10);
+            CHECK(tree.GetNode(1).kind == Fl::BehaviorNodeKind::Sequence);
+            CHECK(tree.GetNode(1).end == 4);
+            CHECK(tree.GetNode(4).end == 9);
+            CHECK(tree.GetNode(6).kind == Fl::BehaviorNodeKind::Inverter);
+            CHECK(tree.GetNode(6).end == 8);
+            CHECK(tree.GetNode(9).kind == Fl::BehaviorNodeKind::Action);
+        }
+
+        WHEN("Ticking agents spanning several batches") {
+            constexpr std::size_t AgentCount = 3 * Fl::BehaviorTree::BatchSize + 17;
+
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<float> values(0.0f, 1.0f);
+            for (std::size_t i = 0; i < AgentCount; ++i) {
+                agents.health.push_back(values(rng));
+                agents.hasTarget.push_back(values(rng) < 0.5f);
+                agents.targetDistance.push_back(values(rng) * 20.0f);
+            }
+            agents.activities.assign(AgentCount, Activity::None);
+
+            // Shuffled agents, to check that leaves receive identifiers and not positions
+            std::vector<Fl::UInt32> ids(AgentCount);
+            std::iota(ids.begin(), ids.end(), 0u);
+            std::shuffle(ids.begin(), ids.end(), rng);
+
+            std::vector<Fl::BehaviorStatus> statuses(AgentCount);
+            tree.Tick(ids, statuses);
+
+            THEN("Every agent gets the status and action of a node by node evaluation") {
+                for (std::size_t i = 0; i < AgentCount; ++i) {
+                    Activity activity;
+                    CHECK(statuses[i] == GetExpectedStatus(agents, ids[i], activity));
+                    CHECK(agents.activities[ids[i]] == activity);
+                }
+            }
+
+            THEN("Leaves are called at most once per batch") {
+                CHECK(agents.leafCallCount <= 6 * 4);
+            }
+        }
+    }
+
+    GIVEN("Trees with edge cases") {
+        Agents agents;
+        agents.health = {0.1f, 0.5f};
+        agents.activities.assign(2, Activity::None);
+        const std::vector<Fl::UInt32> ids = {0, 1};
+        std::vector<Fl::BehaviorStatus> statuses(2);
+
+        WHEN("Composites are empty") {
+            Fl::BehaviorTree sequence;
+            sequence.BeginNode(Fl::BehaviorNodeKind::Sequence);
+            sequence.EndNode();
+
+            Fl::BehaviorTree selector;
+            selector.BeginNode(Fl::BehaviorNodeKind::Selector);
+            selector.EndNode();
+
+            THEN("Sequences succeed and selectors fail") {
+                sequence.Tick(ids, statuses);
+                CHECK(statuses[0] == Fl::BehaviorStatus::Success);
+                selector.Tick(ids, statuses);
+                CHECK(statuses[1] == Fl::BehaviorStatus::Failure);
+            }
+        }
+
+        WHEN("Decorating conditions and running actions") {
+            Fl::BehaviorTree succeeder;
+            succeeder.BeginNode(Fl::BehaviorNodeKind::Succeeder);
+            succeeder.AddLeaf(Fl::BehaviorNodeKind::Condition, MakeCondition(agents, &IsHurt));
+            succeeder.EndNode();
+
+            Fl::BehaviorTree inverter;
+            inverter.BeginNode(Fl::BehaviorNodeKind::Inverter);
+            inverter.AddLeaf(Fl::BehaviorNodeKind::Action,
+                             MakeAction(agents, Activity::Flee, Fl::BehaviorStatus::Running));
+            inverter.EndNode();
+
+            THEN("Succeeders hide failures and inverters keep running statuses") {
+                succeeder.Tick(ids, statuses);
+                CHECK(statuses[0] == Fl::BehaviorStatus::Success);
+                CHECK(statuses[1] == Fl::BehaviorStatus::Success);
+
+                inverter.Tick(ids, statuses);
+                CHECK(statuses[0] == Fl::BehaviorStatus::Running);
+                CHECK(agents.activities[1] == Activity::Flee);
+            }
+        }
+
+        WHEN("The tree is cleared and rebuilt with a single leaf") {
+            Fl::BehaviorTree tree;
+            BuildTree(tree, agents);
+            tree.Clear();
+            CHECK_FALSE(tree.IsComplete());
+
+            tree.AddLeaf(Fl::BehaviorNodeKind::Action,
+                         MakeAction(agents, Activity::Wander, Fl::BehaviorStatus::Success));
+
+            THEN("The leaf is the root") {
+                REQUIRE(tree.IsComplete());
+                CHECK(tree.GetDepth() == 1);
+
+                tree.Tick(ids, statuses);
+                CHECK(statuses[0] == Fl::BehaviorStatus::Success);
+                CHECK(agents.activities[0] == Activity::Wander);
+            }
+        }
+    }
+}
@@ -0,0 +1,239 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/AI/BehaviorTree.hpp>
+#include <FlashlightEngine/AI/DecisionScheduler.hpp>
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace {
+    // Counts the updates of each agent
+    struct UpdateLog {
+        std::vector<std::atomic<Fl::UInt32>> updateCounts;
+        std::vector<Fl::UInt32> updatedAgents; //< Of the last frame, in update order
+
+        explicit UpdateLog(const std::size_t agentCount) :
+        updateCounts(agentCount) {
+        }
+
+        Fl::DecisionScheduler::UpdateCallback MakeCallback() {
+            return [this](std::span<const Fl::UInt32> agents) {
+                for (const Fl::UInt32 agent : agents) {
+                    updateCounts[agent].fetch_add(1, std::memory_order_relaxed);
+                }
+            };
+        }
+
+        Fl::DecisionScheduler::UpdateCallback MakeOrderedCallback() {
+            return [this](std::span<const Fl::UInt32> agents) {
+                for (const Fl::UInt32 agent : agents) {
+                    updateCounts[agent].fetch_add(1, std::memory_order_relaxed);
+                    updatedAgents.push_back(agent);
+                }
+            };
+        }
+    };
+
+    Fl::DecisionScheduler::Settings MakeSettings(const Fl::Clock::duration frameBudget) {
+        Fl::DecisionScheduler::Settings settings;
+        settings.frameBudget = frameBudget;
+        return settings;
+    }
+} // namespace
+
+SCENARIO("DecisionScheduler", "[AI][DecisionScheduler]") {
+    constexpr Fl::Clock::duration UnlimitedBudget = std::chrono::hours(1);
+
+    GIVEN("Relevant agents and an unlimited budget") {
+        constexpr std::size_t AgentCount = 500;
+
+        Fl::DecisionScheduler scheduler(MakeSettings(UnlimitedBudget));
+        for (std::size_t i = 0; i < AgentCount; ++i) {
+            scheduler.AddAgent(1.0f);
+        }
+        UpdateLog log(AgentCount);
+
+        WHEN("Running a few frames") {
+            const Fl::DecisionScheduler::UpdateCallback callback = log.MakeCallback();
+            for (int frame = 0; frame < 5; ++frame) {
+                scheduler.Update(callback);
+            }
+
+            THEN("Every agent is updated every frame") {
+                const Fl::DecisionScheduler::Statistics& statistics = scheduler.GetStatistics();
+                CHECK(scheduler.GetFrameIndex() == 5);
+                CHECK(statistics.agentCount == AgentCount);
+                CHECK(statistics.updatedAgentCount == AgentCount);
+                CHECK(statistics.deferredAgentCount == 0);
+                CHECK(statistics.maxStaleness == 0);
+                CHECK(std::ranges::all_of(log.updateCounts, [](const auto& count) { return count == 5; }));
+            }
+        }
+    }
+
+    GIVEN("Agents of the lowest level of detail") {
+        constexpr std::size_t AgentCount = 800;
+        constexpr Fl::UInt32 Interval = 8;
+
+        Fl::DecisionScheduler scheduler(MakeSettings(UnlimitedBudget));
+        for (std::size_t i = 0; i < AgentCount; ++i) {
+            scheduler.AddAgent(0.1f);
+        }
+        REQUIRE(scheduler.GetLod(0) == 3);
+        UpdateLog log(AgentCount);
+
+        WHEN("Running frames") {
+            const Fl::DecisionScheduler::UpdateCallback callback = log.MakeCallback();
+
+            THEN("Agents are spread evenly over the frames of their interval") {
+                for (Fl::UInt32 frame = 0; frame < 4 * Interval; ++frame) {
+                    scheduler.Update(callback);
+
+                    const Fl::DecisionScheduler::Statistics& statistics = scheduler.GetStatistics();
+                    CHECK(statistics.updatedAgentCount == AgentCount / Interval);
+                    CHECK(statistics.maxStaleness == Interval - 1);
+                    CHECK(statistics.averageStaleness == (Interval - 1) / 2.0f);
+                }
+
+                CHECK(std::ranges::all_of(log.updateCounts, [](const auto& count) { return count == 4; }));
+            }
+        }
+
+        WHEN("Raising the relevance of an agent") {
+            const Fl::DecisionScheduler::UpdateCallback callback = log.MakeCallback();
+            scheduler.SetRelevance(42, 0.9f);
+            REQUIRE(scheduler.GetLod(42) == 0);
+
+            THEN("It's updated every frame") {
+                for (Fl::UInt32 frame = 0; frame < Interval; ++frame) {
+                    scheduler.Update(callback);
+                    CHECK(scheduler.GetStaleness(42) == 0);
+                }
+
+                CHECK(log.updateCounts[42].load() == Interval);
+                CHECK(log.updateCounts[43].load() == 1);
+            }
+        }
+    }
+
+    GIVEN("More due agents than the budget allows") {
+        constexpr std::size_t AgentCount = 1000;
+        constexpr std::size_t BatchSize = 64;
+        constexpr std::size_t FramesPerRound = (AgentCount + BatchSize - 1) / BatchSize;
+
+        Fl::DecisionScheduler::Settings settings = MakeSettings(Fl::Clock::duration::zero());
+        settings.batchSize = BatchSize;
+
+        Fl::DecisionScheduler scheduler(settings);
+        for (std::size_t i = 0; i < AgentCount; ++i) {
+            scheduler.AddAgent(i < 10 ? 1.0f : 0.6f);
+        }
+        UpdateLog log(AgentCount);
+
+        WHEN("Running frames with a zero budget") {
+            const Fl::DecisionScheduler::UpdateCallback callback = log.MakeOrderedCallback();
+
+            THEN("A single batch is updated per frame, the stalest agents first") {
+                for (std::size_t frame = 0; frame < 4 * FramesPerRound; ++frame) {
+                    log.updatedAgents.clear();
+                    scheduler.Update(callback);
+
+                    const Fl::DecisionScheduler::Statistics& statistics = scheduler.GetStatistics();
+                    CHECK(statistics.updatedAgentCount == BatchSize);
+                    CHECK(statistics.deferredAgentCount == statistics.dueAgentCount - BatchSize);
+                    CHECK(statistics.maxStaleness <= FramesPerRound + 1);
+                    CHECK(std::ranges::all_of(log.updatedAgents, [&](const Fl::UInt32 agent) {
+                        return scheduler.GetStaleness(agent) == 0;
+                    }));
+                }
+
+                CHECK(std::ranges::all_of(log.updateCounts, [](const auto& count) { return count >= 3; }));
+            }
+        }
+
+        WHEN("Running a frame with an unlimited budget on a thread pool") {
+            scheduler = Fl::DecisionScheduler(MakeSettings(UnlimitedBudget));
+            for (std::size_t i = 0; i < AgentCount; ++i) {
+                scheduler.AddAgent(1.0f);
+            }
+
+            Fl::ThreadPool threadPool(3);
+            scheduler.Update(log.MakeCallback(), &threadPool);
+
+            THEN("All due agents are updated once") {
+                CHECK(scheduler.GetStatistics().updatedAgentCount == AgentCount);
+                CHECK(std::ranges::all_of(log.updateCounts, [](const auto& count) { return count == 1; }));
+            }
+        }
+    }
+}
+
+TEST_CASE("DecisionScheduler benchmarks", "[AI][.benchmark]") {
+    constexpr std::size_t AgentCount = 100'000;
+    constexpr int FrameCount = 64;
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> values(0.0f, 1.0f);
+    std::vector<float> health(AgentCount);
+    for (float& value : health) {
+        value = values(rng);
+    }
+
+    // Small tree standing for the decisions of the agents
+    Fl::BehaviorTree tree;
+    tree.BeginNode(Fl::BehaviorNodeKind::Selector);
+    tree.AddLeaf(Fl::BehaviorNodeKind::Condition,
+                 [&](std::span<const Fl::UInt32> agents, std::span<Fl::BehaviorStatus> statuses) {
+                     for (std::size_t i = 0; i < agents.size(); ++i) {
+                         statuses[i] = (health[agents[i]] < 0.5f) ? Fl::BehaviorStatus::Success
+                                                                  : Fl::BehaviorStatus::Failure;
+                     }
+                 });
+    tree.AddLeaf(Fl::BehaviorNodeKind::Action,
+                 [&](std::span<const Fl::UInt32> agents, std::span<Fl::BehaviorStatus> statuses) {
+                     for (std::size_t i = 0; i < agents.size(); ++i) {
+                         health[agents[i]] = std::min(health[agents[i]] + 0.01f, 1.0f);
+                         statuses[i] = Fl::BehaviorStatus::Running;
+                     }
+                 });
+    tree.EndNode();
+
+    Fl::DecisionScheduler::Settings settings;
+    settings.frameBudget = std::chrono::milliseconds(1);
+
+    Fl::DecisionScheduler scheduler(settings);
+    scheduler.Reserve(AgentCount);
+    for (std::size_t i = 0; i < AgentCount; ++i) {
+        scheduler.AddAgent(values(rng));
+    }
+
+    std::vector<Fl::BehaviorStatus> statuses(settings.batchSize);
+    const Fl::DecisionScheduler::UpdateCallback callback = [&](std::span<const Fl::UInt32> agents) {
+        tree.Tick(agents, std::span<Fl::BehaviorStatus>(statuses).first(agents.size()));
+    };
+
+    Fl::Clock::duration frameTime = Fl::Clock::duration::zero();
+    Fl::Clock::duration scheduleTime = Fl::Clock::duration::zero();
+    Fl::UInt32 maxStaleness = 0;
+    for (int frame = 0; frame < FrameCount; ++frame) {
+        scheduler.Update(callback);
+
+        const Fl::DecisionScheduler::Statistics& statistics = scheduler.GetStatistics();
+        frameTime = std::max(frameTime, statistics.GetFrameTime());
+        scheduleTime += statistics.scheduleTime;
+        maxStaleness = std::max(maxStaleness, statistics.maxStaleness);
+    }
+
+    const double maxFrameTime = std::chrono::duration<double, std::milli>(frameTime).count();
+    const double averageScheduleTime = std::chrono::duration<double, std::milli>(scheduleTime).count() / FrameCount;
+    WARN("100K agents, 1 ms budget: max frame " << maxFrameTime << " ms, schedule " << averageScheduleTime
+                                                << " ms, max staleness " << maxStaleness << " frames");
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/AI/UtilityEvaluator.hpp>
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+SCENARIO("UtilityEvaluator", "[AI][UtilityEvaluator]") {
+    GIVEN("Response curves") {
+        THEN("They follow their kind, clamped to [0, 1]") {
+            CHECK(Fl::ResponseCurve{}.Evaluate(0.25f) == Catch::Approx(0.25f));
+            CHECK(Fl::ResponseCurve{}.Evaluate(-1.0f) == Catch::Approx(0.0f));
+            CHECK(Fl::ResponseCurve{Fl::ResponseCurveKind::Linear, -1.0f, 1.0f, 0.0f, 1.0f}.Evaluate(0.75f) ==
+                  Catch::Approx(0.25f));
+            CHECK(Fl::ResponseCurve{Fl::ResponseCurveKind::Linear, 2.0f}.Evaluate(0.75f) == Catch::Approx(1.0f));
+
+            CHECK(Fl::ResponseCurve{Fl::ResponseCurveKind::Polynomial, 1.0f, 2.0f}.Evaluate(0.5f) ==
+                  Catch::Approx(0.25f));
+            CHECK(Fl::ResponseCurve{Fl::ResponseCurveKind::Polynomial, 1.0f, 2.0f, 0.75f}.Evaluate(0.5f) ==
+                  Catch::Approx(0.0f));
+
+            const Fl::ResponseCurve logistic{Fl::ResponseCurveKind::Logistic, 1.0f, 20.0f, 0.5f};
+            CHECK(logistic.Evaluate(0.5f) == Catch::Approx(0.5f));
+            CHECK(logistic.Evaluate(0.0f) < 0.001f);
+            CHECK(logistic.Evaluate(1.0f) > 0.999f);
+
+            const Fl::ResponseCurve step{Fl::ResponseCurveKind::Step, 0.5f, 1.0f, 0.4f, 0.25f};
+            CHECK(step.Evaluate(0.3f) == Catch::Approx(0.25f));
+            CHECK(step.Evaluate(0.4f) == Catch::Approx(0.75f));
+        }
+    }
+
+    GIVEN("Options scored from hunger and fatigue") {
+        constexpr Fl::UInt32 Hunger = 0;
+        constexpr Fl::UInt32 Fatigue = 1;
+
+        Fl::UtilityEvaluator evaluator;
+        const Fl::UInt32 eat = evaluator.AddOption();
+        evaluator.AddConsideration(Hunger, {});
+        const Fl::UInt32 sleep = evaluator.AddOption();
+        evaluator.AddConsideration(Fatigue, {});
+        const Fl::UInt32 rest = evaluator.AddOption(0.9f);
+        evaluator.AddConsideration(Hunger, {Fl::ResponseCurveKind::Linear, -1.0f, 1.0f, 0.0f, 1.0f});
+        evaluator.AddConsideration(Fatigue, {});
+        const Fl::UInt32 idle = evaluator.AddOption(0.1f);
+
+        REQUIRE(evaluator.GetOptionCount() == 4);
+        REQUIRE(evaluator.GetInputCount() == 2);
+        CHECK(evaluator.GetConsiderations(rest).size() == 2);
+        CHECK(evaluator.GetConsiderations(idle).empty());
+
+        WHEN("Evaluating a few agents") {
+            // Input-major: the hunger of every agent, then their fatigue
+            const std::vector<float> inputs = {0.9f, 0.2f, 0.05f, 0.1f, 0.3f, 0.8f, 0.05f, 0.5f};
+            std::vector<Fl::UInt32> choices(4);
+            std::vector<float> scores(4);
+            evaluator.Evaluate(inputs, choices, scores);
+
+            THEN("Each agent picks its best option") {
+                CHECK(choices[0] == eat);
+                CHECK(scores[0] == Catch::Approx(0.9f));
+                CHECK(choices[1] == sleep);
+                CHECK(choices[2] == idle);
+                CHECK(scores[2] == Catch::Approx(0.1f));
+            }
+
+            THEN("Scores of options with several considerations are compensated") {
+                // Without compensation, rest would score 0.9 * 0.9 * 0.5, below sleep
+                const float hungerScore = 0.9f + 0.9f * 0.1f * 0.5f;
+                const float fatigueScore = 0.5f + 0.5f * 0.5f * 0.5f;
+                CHECK(choices[3] == rest);
+                CHECK(scores[3] == Catch::Approx(0.9f * hungerScore * fatigueScore));
+            }
+        }
+
+        WHEN("Evaluating many agents in parallel") {
+            constexpr std::size_t AgentCount = 1000;
+
+            std::mt19937 rng(3);
+            std::uniform_real_distribution<float> values(0.0f, 1.0f);
+            std::vector<float> inputs(2 * AgentCount);
+            for (float& input : inputs) {
+                input = values(rng);
+            }
+
+            std::vector<Fl::UInt32> choices(AgentCount);
+            std::vector<float> scores(AgentCount);
+            evaluator.Evaluate(inputs, choices, scores);
+
+            Fl::ThreadPool threadPool(3);
+            std::vector<Fl::UInt32> parallelChoices(AgentCount);
+            std::vector<float> parallelScores(AgentCount);
+            evaluator.Evaluate(inputs, parallelChoices, parallelScores, &threadPool);
+
+            THEN("Results match the serial evaluation and the options of a single agent") {
+                CHECK(parallelChoices == choices);
+                CHECK(parallelScores == scores);
+
+                for (std::size_t agent = 0; agent < AgentCount; agent += 97) {
+                    const float hunger = inputs[agent];
+                    const float fatigue = inputs[AgentCount + agent];
+                    const std::vector<float> single = {hunger, fatigue};
+                    std::vector<Fl::UInt32> choice(1);
+                    std::vector<float> score(1);
+                    evaluator.Evaluate(single, choice, score);
+
+                    CHECK(choice[0] == choices[agent]);
+                    CHECK(score[0] == scores[agent]);
+                    CHECK(scores[agent] >= std::max({hunger, fatigue, 0.1f}));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,198 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Animation/AnimationClip.hpp>
+#include <FlashlightEngine/Animation/LocalPose.hpp>
+#include <FlashlightEngine/Animation/Skeleton.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+    Fl::Quaternion MakeRotation(const Fl::Vector3& axis, const float angle) {
+        const float length = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+        const float sine = std::sin(angle * 0.5f) / length;
+        return {axis.x * sine, axis.y * sine, axis.z * sine, std::cos(angle * 0.5f)};
+    }
+
+    float GetAngle(const Fl::Quaternion& lhs, const Fl::Quaternion& rhs) {
+        // From the chord between the quaternions, acos() of their dot product being inaccurate for small angles
+        const float sign = (lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w < 0.0f) ? -1.0f : 1.0f;
+        const float x = lhs.x - sign * rhs.x;
+        const float y = lhs.y - sign * rhs.y;
+        const float z = lhs.z - sign * rhs.z;
+        const float w = lhs.w - sign * rhs.w;
+        return 4.0f * std::asin(std::min(std::sqrt(x * x + y * y + z * z + w * w) * 0.5f, 1.0f));
+    }
+
+    float GetDistance(const Fl::Vector3& lhs, const Fl::Vector3& rhs) {
+        const float x = lhs.x - rhs.x;
+        const float y = lhs.y - rhs.y;
+        const float z = lhs.z - rhs.z;
+        return std::sqrt(x * x + y * y + z * z);
+    }
+
+    // Joints with smooth motions of different frequencies, the last one being still
+    Fl::RawAnimation MakeAnimation(const std::size_t jointCount, const Fl::UInt32 frameCount) {
+        Fl::RawAnimation animation;
+        animation.frameRate = 30.0f;
+        animation.frameCount = frameCount;
+        animation.tracks.resize(jointCount);
+
+        for (std::size_t joint = 0; joint < jointCount; ++joint) {
+            Fl::RawAnimation::JointTrack& track = animation.tracks[joint];
+            if (joint + 1 == jointCount) {
+                track.translations = {{0.0f, 1.0f, 0.0f}};
+                track.rotations = {MakeRotation({0.0f, 0.0f, 1.0f}, 0.5f)};
+                track.scales = {Fl::Vector3::Unit()};
+                continue;
+            }
+
+            const auto frequency = static_cast<float>(joint + 1) * 0.01f;
+            for (Fl::UInt32 frame = 0; frame < frameCount; ++frame) {
+                const float phase = static_cast<float>(frame) * frequency;
+                track.translations.push_back({std::sin(phase), 0.5f * std::cos(phase), static_cast<float>(joint)});
+                const Fl::Vector3 axis = {1.0f, 2.0f, static_cast<float>(joint)};
+                track.rotations.push_back(MakeRotation(axis, 3.0f * std::sin(phase)));
+                track.scales.push_back({1.0f + 0.25f * std::sin(phase), 1.0f, 1.0f});
+            }
+        }
+
+        return animation;
+    }
+} // namespace
+
+SCENARIO("AnimationClip", "[Animation][AnimationClip]") {
+    GIVEN("A clip and a skeleton") {
+        WHEN("Getting their class info") {
+            const Fl::BaseObject::ClassInfo clipInfo = Fl::BaseObject::GetInfo<Fl::AnimationClip>();
+            const Fl::BaseObject::ClassInfo skeletonInfo = Fl::BaseObject::GetInfo<Fl::Skeleton>();
+
+            THEN("Each class has its own name and identifier") {
+                CHECK(clipInfo.name.find("AnimationClip") != std::string::npos);
+                CHECK(skeletonInfo.name.find("Skeleton") != std::string::npos);
+                CHECK(clipInfo.id != skeletonInfo.id);
+                CHECK(Fl::BaseObject::GetInfo<Fl::AnimationClip>().id == clipInfo.id);
+            }
+        }
+    }
+
+    GIVEN("A compressed animation") {
+        constexpr std::size_t JointCount = 7;
+        constexpr Fl::UInt32 FrameCount = 120;
+        const Fl::RawAnimation animation = MakeAnimation(JointCount, FrameCount);
+
+        Fl::AnimationClip::CompressionSettings settings;
+        settings.translationTolerance = 2e-3f;
+        settings.rotationTolerance = 2e-3f;
+        settings.scaleTolerance = 2e-3f;
+        const Fl::AnimationClip clip(animation, settings);
+
+        THEN("It keeps the animation timing") {
+            CHECK(clip.GetJointCount() == JointCount);
+            CHECK(clip.GetFrameRate() == 30.0f);
+            CHECK(std::abs(clip.GetDuration() - 119.0f / 30.0f) < 1e-5f);
+        }
+
+        WHEN("Sampling it at every frame") {
+            Fl::LocalPose pose(JointCount);
+
+            float maxTranslationError = 0.0f;
+            float maxRotationError = 0.0f;
+            float maxScaleError = 0.0f;
+            for (Fl::UInt32 frame = 0; frame < FrameCount; ++frame) {
+                clip.Sample(static_cast<float>(frame) / animation.frameRate, pose);
+
+                for (std::size_t joint = 0; joint < JointCount; ++joint) {
+                    const Fl::RawAnimation::JointTrack& track = animation.tracks[joint];
+                    const std::size_t index = std::min<std::size_t>(frame, track.translations.size() - 1);
+                    maxTranslationError = std::max(maxTranslationError,
+                                                   GetDistance(pose.GetTranslation(joint), track.translations[index]));
+                    maxRotationError =
+                        std::max(maxRotationError, GetAngle(pose.GetRotation(joint), track.rotations[index]));
+                    maxScaleError = std::max(maxScaleError, GetDistance(pose.GetScale(joint), track.scales[index]));
+                }
+            }
+
+            THEN("Every frame is reconstructed within the tolerances") {
+                CHECK(maxTranslationError <= settings.translationTolerance * 1.01f);
+                CHECK(maxRotationError <= settings.rotationTolerance * 1.01f);
+                CHECK(maxScaleError <= settings.scaleTolerance * 1.01f);
+            }
+        }
+
+        WHEN("Sampling it between two frames and out of its range") {
+            Fl::LocalPose pose(JointCount);
+            Fl::LocalPose previousPose(JointCount);
+            Fl::LocalPose nextPose(JointCount);
+            clip.Sample(10.5f / 30.0f, pose);
+            clip.Sample(10.0f / 30.0f, previousPose);
+            clip.Sample(11.0f / 30.0f, nextPose);
+
+            Fl::LocalPose firstPose(JointCount);
+            Fl::LocalPose beforePose(JointCount);
+            Fl::LocalPose lastPose(JointCount);
+            Fl::LocalPose afterPose(JointCount);
+            clip.Sample(0.0f, firstPose);
+            clip.Sample(-1.0f, beforePose);
+            clip.Sample(clip.GetDuration(), lastPose);
+            clip.Sample(clip.GetDuration() + 1.0f, afterPose);
+
+            THEN("Values are interpolated, and clamped at the ends") {
+                for (std::size_t joint = 0; joint < JointCount; ++joint) {
+                    const Fl::Vector3 translation = pose.GetTranslation(joint);
+                    const Fl::Vector3 previous = previousPose.GetTranslation(joint);
+                    const Fl::Vector3 next = nextPose.GetTranslation(joint);
+                    CHECK(translation.x >= std::min(previous.x, next.x) - 1e-5f);
+                    CHECK(translation.x <= std::max(previous.x, next.x) + 1e-5f);
+                    const Fl::Quaternion rotation = pose.GetRotation(joint);
+                    const float squaredLength = rotation.x * rotation.x + rotation.y * rotation.y +
+                                                rotation.z * rotation.z + rotation.w * rotation.w;
+                    CHECK(std::abs(squaredLength - 1.0f) < 1e-5f);
+
+                    CHECK(GetDistance(beforePose.GetTranslation(joint), firstPose.GetTranslation(joint)) == 0.0f);
+                    CHECK(GetDistance(afterPose.GetTranslation(joint), lastPose.GetTranslation(joint)) == 0.0f);
+                }
+            }
+        }
+
+        THEN("Keys are reduced and the clip is much smaller than the raw animation") {
+            // The still joint keeps a single key per curve
+            CHECK(clip.GetKeyCount() < (JointCount - 1) * Fl::AnimationClip::CurvesPerJoint * FrameCount / 3);
+            CHECK(clip.GetKeyCount() >= JointCount * Fl::AnimationClip::CurvesPerJoint);
+            CHECK(clip.GetMemoryFootprint() < animation.GetSize() / 4);
+        }
+    }
+
+    GIVEN("An animation with a step") {
+        Fl::RawAnimation animation;
+        animation.frameCount = 40;
+        animation.tracks.resize(1);
+        for (Fl::UInt32 frame = 0; frame < animation.frameCount; ++frame) {
+            animation.tracks[0].translations.push_back({(frame < 20) ? 0.0f : 4.0f, 0.0f, 0.0f});
+        }
+
+        animation.tracks[0].rotations = {Fl::Quaternion::Identity()};
+        animation.tracks[0].scales = {Fl::Vector3::Unit()};
+        const Fl::AnimationClip clip(animation);
+
+        WHEN("Sampling it") {
+            Fl::LocalPose pose(1);
+            clip.Sample(19.0f / 30.0f, pose);
+            const Fl::Vector3 beforeStep = pose.GetTranslation(0);
+            clip.Sample(20.0f / 30.0f, pose);
+            const Fl::Vector3 afterStep = pose.GetTranslation(0);
+
+            THEN("The keys around the step are kept, the flat parts being removed") {
+                CHECK(clip.GetKeyCount() == 4 + 2);
+                CHECK(std::abs(beforeStep.x) < 1e-3f);
+                CHECK(std::abs(afterStep.x - 4.0f) < 1e-3f);
+                CHECK(GetAngle(pose.GetRotation(0), Fl::Quaternion::Identity()) < 1e-3f);
+            }
+        }
+    }
+}
@@ -0,0 +1,286 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Animation/AnimationClip.hpp>
+#include <FlashlightEngine/Animation/AnimationEvaluator.hpp>
+#include <FlashlightEngine/Animation/LocalPose.hpp>
+#include <FlashlightEngine/Animation/Skeleton.hpp>
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr float Tolerance = 1e-4f;
+
+    Fl::Quaternion MakeRotation(const Fl::Vector3& axis, const float angle) {
+        const float length = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+        const float sine = std::sin(angle * 0.5f) / length;
+        return {axis.x * sine, axis.y * sine, axis.z * sine, std::cos(angle * 0.5f)};
+    }
+
+    bool AreEqual(const Fl::Matrix4& lhs, const Fl::Matrix4& rhs, const float tolerance = Tolerance) {
+        for (std::size_t i = 0; i < 16; ++i) {
+            if (std::abs(lhs.data[i] - rhs.data[i]) > tolerance) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Spine of jointCount joints, with a branch on every third one
+    std::vector<Fl::Skeleton::Joint> MakeJoints(const std::size_t jointCount) {
+        std::vector<Fl::Skeleton::Joint> joints(jointCount);
+        for (std::size_t joint = 0; joint < jointCount; ++joint) {
+            joints[joint].name = "Joint" + std::to_string(joint);
+            if (joint > 0) {
+                joints[joint].parent = static_cast<Fl::UInt32>((joint % 3 == 0) ? joint / 3 : joint - 1);
+            }
+
+            joints[joint].translation = {0.0f, 1.0f, 0.1f * static_cast<float>(joint)};
+            joints[joint].rotation = MakeRotation({0.0f, 0.0f, 1.0f}, 0.1f * static_cast<float>(joint));
+            joints[joint].scale = {1.0f, 1.0f + 0.01f * static_cast<float>(joint), 1.0f};
+        }
+
+        return joints;
+    }
+
+    Fl::RawAnimation MakeAnimation(const std::size_t jointCount, const Fl::UInt32 frameCount, const float frequency) {
+        Fl::RawAnimation animation;
+        animation.frameCount = frameCount;
+        animation.tracks.resize(jointCount);
+
+        for (std::size_t joint = 0; joint < jointCount; ++joint) {
+            Fl::RawAnimation::JointTrack& track = animation.tracks[joint];
+            track.scales = {Fl::Vector3::Unit()};
+            for (Fl::UInt32 frame = 0; frame < frameCount; ++frame) {
+                const float phase = static_cast<float>(frame) * frequency + static_cast<float>(joint);
+                track.translations.push_back({0.1f * std::sin(phase), 1.0f, 0.0f});
+                track.rotations.push_back(MakeRotation({1.0f, 0.5f, 0.0f}, std::sin(phase)));
+            }
+        }
+
+        return animation;
+    }
+} // namespace
+
+SCENARIO("LocalPose", "[Animation][LocalPose]") {
+    GIVEN("Two poses") {
+        Fl::LocalPose first(5);
+        Fl::LocalPose second(5);
+        for (std::size_t joint = 0; joint < 5; ++joint) {
+            const auto offset = static_cast<float>(joint);
+            first.SetTransform(joint, {offset, 0.0f, 0.0f}, MakeRotation({0.0f, 1.0f, 0.0f}, 0.2f),
+                               Fl::Vector3::Unit());
+            // The second rotation is in the other hemisphere, it must be flipped
+            const Fl::Quaternion rotation = MakeRotation({0.0f, 1.0f, 0.0f}, 1.0f);
+            second.SetTransform(joint, {offset, 2.0f, 0.0f}, {-rotation.x, -rotation.y, -rotation.z, -rotation.w},
+                                {3.0f, 1.0f, 1.0f});
+        }
+
+        THEN("Joints are padded to the SIMD width") {
+            CHECK(first.GetJointCount() == 5);
+            CHECK(first.GetPaddedJointCount() % Fl::SimdFloat4::Width == 0);
+            CHECK(first.GetComponents(Fl::PoseComponent::RotationW).size() == first.GetPaddedJointCount());
+        }
+
+        WHEN("Blending them") {
+            Fl::LocalPose blended;
+            Fl::LocalPose::Blend(first, second, 0.25f, blended);
+
+            THEN("Translations and scales are interpolated and rotations take the shortest path") {
+                REQUIRE(blended.GetJointCount() == 5);
+                for (std::size_t joint = 0; joint < 5; ++joint) {
+                    const Fl::Vector3 translation = blended.GetTranslation(joint);
+                    CHECK(std::abs(translation.x - static_cast<float>(joint)) < Tolerance);
+                    CHECK(std::abs(translation.y - 0.5f) < Tolerance);
+                    CHECK(std::abs(blended.GetScale(joint).x - 1.5f) < Tolerance);
+
+                    // Normalized lerp stays close to the slerp at 0.2 + 0.25 * 0.8 = 0.4 radians
+                    const Fl::Quaternion rotation = blended.GetRotation(joint);
+                    const Fl::Quaternion expected = MakeRotation({0.0f, 1.0f, 0.0f}, 0.4f);
+                    CHECK(std::abs(rotation.y - expected.y) < 2e-3f);
+                    CHECK(std::abs(rotation.w - expected.w) < 2e-3f);
+                    CHECK(std::abs(rotation.y * rotation.y + rotation.w * rotation.w - 1.0f) < Tolerance);
+                }
+            }
+        }
+    }
+
+    GIVEN("A skeleton") {
+        const std::vector<Fl::Skeleton::Joint> joints = MakeJoints(11);
+        const Fl::Skeleton skeleton(joints);
+
+        THEN("Joints are found by name") {
+            CHECK(skeleton.GetJointCount() == 11);
+            CHECK(skeleton.FindJoint("Joint6") == 6);
+            CHECK(skeleton.FindJoint("Head") == Fl::Skeleton::InvalidJoint);
+            CHECK(skeleton.GetJointName(4) == "Joint4");
+            CHECK(skeleton.GetParent(6) == 2);
+            CHECK(skeleton.GetParent(0) == Fl::Skeleton::InvalidJoint);
+        }
+
+        WHEN("Computing the model matrices of its bind pose") {
+            std::vector<Fl::Matrix4> matrices(skeleton.GetJointCount());
+            skeleton.GetBindPose().ComputeModelMatrices(skeleton, matrices);
+
+            THEN("They match the chained transform matrices") {
+                for (std::size_t joint = 0; joint < joints.size(); ++joint) {
+                    Fl::Matrix4 expected = Fl::Matrix4::FromTransform(joints[joint].translation,
+                                                                      joints[joint].rotation, joints[joint].scale);
+                    for (Fl::UInt32 parent = joints[joint].parent; parent != Fl::Skeleton::InvalidJoint;
+                         parent = joints[parent].parent) {
+                        expected = Fl::Matrix4::FromTransform(joints[parent].translation, joints[parent].rotation,
+                                                              joints[parent].scale) *
+                                   expected;
+                    }
+
+                    CHECK(AreEqual(matrices[joint], expected));
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("AnimationEvaluator", "[Animation][AnimationEvaluator]") {
+    GIVEN("Characters playing blended clips") {
+        constexpr std::size_t JointCount = 13;
+        constexpr std::size_t CharacterCount = 100;
+
+        const Fl::Skeleton skeleton(MakeJoints(JointCount));
+        const Fl::AnimationClip walk(MakeAnimation(JointCount, 60, 0.1f));
+        const Fl::AnimationClip run(MakeAnimation(JointCount, 40, 0.2f));
+
+        std::vector<Fl::AnimationEvaluator::Layer> layers;
+        for (std::size_t i = 0; i < CharacterCount; ++i) {
+            const float time = 0.013f * static_cast<float>(i);
+            layers.push_back({&walk, time, 1.0f - 0.01f * static_cast<float>(i)});
+            layers.push_back({&run, time, 0.01f * static_cast<float>(i)});
+        }
+
+        std::vector<Fl::Matrix4> matrices(CharacterCount * JointCount);
+        std::vector<Fl::AnimationEvaluator::Character> characters;
+        for (std::size_t i = 0; i < CharacterCount; ++i) {
+            // The last character has no layer and keeps its bind pose
+            const std::size_t layerCount = (i + 1 == CharacterCount) ? 0 : 2;
+            characters.push_back({&skeleton, std::span(layers).subspan(2 * i, layerCount),
+                                  std::span(matrices).subspan(i * JointCount, JointCount)});
+        }
+
+        WHEN("Evaluating them") {
+            Fl::AnimationEvaluator evaluator;
+            evaluator.Evaluate(characters);
+
+            THEN("Each character gets the model matrices of its blended pose") {
+                for (const std::size_t i : {std::size_t(0), std::size_t(37), CharacterCount - 2}) {
+                    Fl::LocalPose walkPose(JointCount);
+                    Fl::LocalPose runPose(JointCount);
+                    walk.Sample(layers[2 * i].time, walkPose);
+                    run.Sample(layers[2 * i + 1].time, runPose);
+
+                    Fl::LocalPose pose;
+                    Fl::LocalPose::Blend(walkPose, runPose, layers[2 * i + 1].weight, pose);
+
+                    std::vector<Fl::Matrix4> expected(JointCount);
+                    pose.ComputeModelMatrices(skeleton, expected);
+                    for (std::size_t joint = 0; joint < JointCount; ++joint) {
+                        CHECK(AreEqual(matrices[i * JointCount + joint], expected[joint]));
+                    }
+                }
+
+                std::vector<Fl::Matrix4> bindMatrices(JointCount);
+                skeleton.GetBindPose().ComputeModelMatrices(skeleton, bindMatrices);
+                for (std::size_t joint = 0; joint < JointCount; ++joint) {
+                    CHECK(AreEqual(matrices[(CharacterCount - 1) * JointCount + joint], bindMatrices[joint], 0.0f));
+                }
+            }
+
+            THEN("Statistics are updated") {
+                const Fl::AnimationEvaluator::Statistics& statistics = evaluator.GetStatistics();
+                CHECK(statistics.characterCount == CharacterCount);
+                CHECK(statistics.jointCount == CharacterCount * JointCount);
+                // The first character doesn't weight its second layer
+                CHECK(statistics.sampledClipCount == 2 * (CharacterCount - 1) - 1);
+            }
+        }
+
+        WHEN("Evaluating them with a thread pool") {
+            Fl::AnimationEvaluator evaluator;
+            evaluator.Evaluate(characters);
+            const std::vector<Fl::Matrix4> expected = matrices;
+
+            Fl::ThreadPool threadPool(3);
+            evaluator.Evaluate(characters, &threadPool);
+
+            THEN("The results are the same") {
+                for (std::size_t i = 0; i < matrices.size(); ++i) {
+                    CHECK(AreEqual(matrices[i], expected[i], 0.0f));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("AnimationEvaluator benchmarks", "[Animation][.benchmark]") {
+    constexpr std::size_t JointCount = 64;
+
+    const Fl::Skeleton skeleton(MakeJoints(JointCount));
+    const Fl::AnimationClip walk(MakeAnimation(JointCount, 300, 0.1f));
+    const Fl::AnimationClip run(MakeAnimation(JointCount, 300, 0.2f));
+
+    Fl::LocalPose pose(JointCount);
+    BENCHMARK("Sample 64 joints") {
+        walk.Sample(3.3f, pose);
+        return pose.GetTranslation(0).x;
+    };
+
+    std::vector<Fl::Matrix4> jointMatrices(JointCount);
+    BENCHMARK("Model matrices of 64 joints") {
+        pose.ComputeModelMatrices(skeleton, jointMatrices);
+        return jointMatrices[JointCount - 1].data[12];
+    };
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> times(0.0f, walk.GetDuration());
+    std::uniform_real_distribution<float> weights(0.0f, 1.0f);
+
+    Fl::ThreadPool threadPool;
+    for (const std::size_t characterCount : {256u, 4096u}) {
+        std::vector<Fl::AnimationEvaluator::Layer> layers;
+        for (std::size_t i = 0; i < characterCount; ++i) {
+            layers.push_back({&walk, times(rng), 1.0f});
+            layers.push_back({&run, times(rng), weights(rng)});
+        }
+
+        std::vector<Fl::Matrix4> matrices(characterCount * JointCount);
+        std::vector<Fl::AnimationEvaluator::Character> characters;
+        for (std::size_t i = 0; i < characterCount; ++i) {
+            characters.push_back({&skeleton, std::span(layers).subspan(2 * i, 2),
+                                  std::span(matrices).subspan(i * JointCount, JointCount)});
+        }
+
+        Fl::AnimationEvaluator evaluator;
+        BENCHMARK(std::to_string(characterCount) + " characters, 2 layers") {
+            evaluator.Evaluate(characters);
+            return matrices[0].data[0];
+        };
+
+        BENCHMARK(std::to_string(characterCount) + " characters, 2 layers, thread pool") {
+            evaluator.Evaluate(characters, &threadPool);
+            return matrices[0].data[0];
+        };
+    }
+
+    const Fl::RawAnimation animation = MakeAnimation(JointCount, 300, 0.1f);
+    BENCHMARK("Compress 64 joints, 300 frames") {
+        return Fl::AnimationClip(animation).GetKeyCount();
+    };
+}
@@ -0,0 +1,402 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Audio/AudioBuffer.hpp>
+#include <FlashlightEngine/Audio/AudioDeviceLibrary.hpp>
+#include <FlashlightEngine/Audio/AudioMixer.hpp>
+#include <FlashlightEngine/Audio/NullAudioDevice.hpp>
+#include <FlashlightEngine/Audio/WavAudioDevice.hpp>
+#include <FlashlightEngine/Utility/PathUtils.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(FL_COMPILER_GCC) || defined(FL_COMPILER_CLANG)
+#   define PREFIX "lib"
+#else
+#   define PREFIX ""
+#endif
+
+namespace {
+    constexpr float Tolerance = 1e-5f;
+
+    // Sound whose sample i is (i + 1) / count, to recognize the interpolated positions
+    Fl::AudioBuffer GenerateRamp(const std::size_t count, const Fl::UInt32 sampleRate) {
+        std::vector<float> samples(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            samples[i] = static_cast<float>(i + 1) / static_cast<float>(count);
+        }
+
+        return Fl::AudioBuffer(std::move(samples), sampleRate);
+    }
+
+    Fl::AudioBuffer GenerateNoise(const std::size_t count, const Fl::UInt32 sampleRate, std::mt19937& rng) {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+        std::vector<float> samples(count);
+        for (float& sample : samples) {
+            sample = distribution(rng);
+        }
+
+        return Fl::AudioBuffer(std::move(samples), sampleRate);
+    }
+
+    Fl::AudioMixer::Settings MakeSettings() {
+        Fl::AudioMixer::Settings settings;
+        settings.blockFrameCount = 64;
+        settings.maxVoiceCount = 8;
+        settings.maxBusCount = 4;
+        return settings;
+    }
+
+    bool AreNear(const float lhs, const float rhs) {
+        return std::abs(lhs - rhs) <= Tolerance;
+    }
+}
+
+SCENARIO("AudioMixer", "[Audio][AudioMixer]") {
+    const float centerGain = std::sqrt(0.5f);
+
+    WHEN("Mixing voices at the mixer rate") {
+        Fl::AudioMixer mixer(MakeSettings());
+        const Fl::AudioBuffer ramp = GenerateRamp(100, 48000);
+
+        std::vector<float> samples(2 * 128, 1.0f);
+        mixer.Render(samples);
+        CHECK(std::all_of(samples.begin(), samples.end(), [](const float sample) { return sample == 0.0f; }));
+
+        const Fl::AudioMixer::VoiceId centered = mixer.Play(ramp);
+        Fl::AudioMixer::VoiceParameters parameters;
+        parameters.pan = -1.0f;
+        parameters.gain = 0.5f;
+        const Fl::AudioMixer::VoiceId left = mixer.Play(ramp, parameters);
+        REQUIRE(centered != Fl::AudioMixer::InvalidVoice);
+        REQUIRE(left != Fl::AudioMixer::InvalidVoice);
+        CHECK(centered != left);
+        CHECK(mixer.IsPlaying(centered));
+        CHECK(mixer.GetPlayingVoiceCount() == 2);
+
+        mixer.Render(samples);
+
+        bool isMatching = true;
+        for (std::size_t frame = 0; frame < 128; ++frame) {
+            const float expected = (frame < 100) ? ramp.GetSamples()[frame] : 0.0f;
+            isMatching &= AreNear(samples[2 * frame], expected * (centerGain + 0.5f));
+            isMatching &= AreNear(samples[2 * frame + 1], expected * centerGain);
+        }
+        CHECK(isMatching);
+
+        // Both sounds ended during the second block
+        CHECK_FALSE(mixer.IsPlaying(centered));
+        CHECK_FALSE(mixer.IsPlaying(left));
+        CHECK(mixer.GetPlayingVoiceCount() == 0);
+
+        const Fl::AudioMixer::Statistics& statistics = mixer.GetStatistics();
+        CHECK(statistics.blockCount == 4);
+        CHECK(statistics.frameCount == 256);
+        CHECK(statistics.voiceCount == 4);
+    }
+
+    WHEN("Resampling voices") {
+        Fl::AudioMixer mixer(MakeSettings());
+        const Fl::AudioBuffer ramp = GenerateRamp(40, 24000);
+
+        Fl::AudioMixer::VoiceParameters parameters;
+        parameters.pan = 1.0f;
+        mixer.Play(ramp, parameters);
+        parameters.pan = -1.0f;
+        parameters.pitch = 0.75f;
+        mixer.Play(ramp, parameters);
+
+        std::vector<float> samples(2 * 100);
+        mixer.Render(samples);
+
+        // Half then three eighths of a sample per frame, the last sample being interpolated towards silence
+        const auto sampleAt = [&](const double position) {
+            const auto index = static_cast<std::size_t>(position);
+            const auto fraction = static_cast<float>(position - static_cast<double>(index));
+            const float first = (index < 40) ? ramp.GetSamples()[index] : 0.0f;
+            const float second = (index + 1 < 40) ? ramp.GetSamples()[index + 1] : 0.0f;
+            return first + (second - first) * fraction;
+        };
+
+        bool isMatching = true;
+        for (std::size_t frame = 0; frame < 100; ++frame) {
+            isMatching &= AreNear(samples[2 * frame], sampleAt(0.375 * static_cast<double>(frame)));
+            isMatching &= AreNear(samples[2 * frame + 1], (frame < 80) ? sampleAt(0.5 * static_cast<double>(frame)) :
+                                                                         0.0f);
+        }
+        CHECK(isMatching);
+        CHECK(mixer.GetPlayingVoiceCount() == 1);
+    }
+
+    WHEN("Looping a voice") {
+        Fl::AudioMixer mixer(MakeSettings());
+        const Fl::AudioBuffer ramp = GenerateRamp(10, 48000);
+
+        Fl::AudioMixer::VoiceParameters parameters;
+        parameters.isLooping = true;
+        parameters.pan = 1.0f;
+        const Fl::AudioMixer::VoiceId voice = mixer.Play(ramp, parameters);
+
+        std::vector<float> samples(2 * 300);
+        mixer.Render(samples);
+
+        bool isMatching = true;
+        for (std::size_t frame = 0; frame < 300; ++frame) {
+            isMatching &= AreNear(samples[2 * frame + 1], ramp.GetSamples()[frame % 10]);
+        }
+        CHECK(isMatching);
+        CHECK(mixer.IsPlaying(voice));
+
+        // Stopping fades the voice out over a block, then releases it
+        CHECK(mixer.StopVoice(voice));
+        mixer.Render(std::span(samples).first(2 * 64));
+        CHECK(AreNear(samples[1], ramp.GetSamples()[0] * 63.0f / 64.0f));
+        CHECK(samples[2 * 63 + 1] == 0.0f);
+        CHECK_FALSE(mixer.IsPlaying(voice));
+
+        // The slot is given to a new voice, commands sent to the old one are ignored
+        const Fl::AudioMixer::VoiceId newVoice = mixer.Play(ramp, parameters);
+        CHECK(newVoice != voice);
+        CHECK((newVoice & 0xFFFF) == (voice & 0xFFFF));
+        CHECK(mixer.SetVoiceGain(voice, 0.0f));
+        mixer.Render(std::span(samples).first(2 * 64));
+        CHECK(AreNear(samples[2 * 63 + 1], ramp.GetSamples()[3]));
+    }
+
+    WHEN("Changing the parameters of a voice") {
+        Fl::AudioMixer mixer(MakeSettings());
+        const Fl::AudioBuffer constant(std::vector<float>(1000, 1.0f), 48000);
+
+        const Fl::AudioMixer::VoiceId voice = mixer.Play(constant);
+        std::vector<float> samples(2 * 64);
+        mixer.Render(samples);
+        CHECK(AreNear(samples[2 * 63], centerGain));
+
+        // Gains ramp over the next block
+        CHECK(mixer.SetVoiceGain(voice, 2.0f));
+        CHECK(mixer.SetVoicePan(voice, 1.0f));
+        mixer.Render(samples);
+        CHECK(AreNear(samples[0], centerGain * 63.0f / 64.0f));
+        CHECK(AreNear(samples[1], centerGain + (2.0f - centerGain) / 64.0f));
+        CHECK(AreNear(samples[2 * 31], centerGain / 2.0f));
+        CHECK(AreNear(samples[2 * 63], 0.0f));
+        CHECK(AreNear(samples[2 * 63 + 1], 2.0f));
+
+        mixer.Render(samples);
+        CHECK(samples[2 * 10] == 0.0f);
+        CHECK(samples[2 * 10 + 1] == 2.0f);
+
+        // Twice as fast, reaching the end of the sound sooner
+        CHECK(mixer.SetVoicePitch(voice, 2.0f));
+        std::vector<float> tail(2 * 704);
+        mixer.Render(tail);
+        CHECK(tail[2 * 403 + 1] == 2.0f);
+        CHECK(tail[2 * 404 + 1] == 0.0f);
+        CHECK_FALSE(mixer.IsPlaying(voice));
+    }
+
+    WHEN("Mixing through buses") {
+        Fl::AudioMixer mixer(MakeSettings());
+        const Fl::AudioBuffer constant(std::vector<float>(1000, 1.0f), 48000);
+
+        const Fl::AudioMixer::BusId music = mixer.CreateBus(Fl::AudioMixer::MasterBus, 0.5f);
+        const Fl::AudioMixer::BusId ambience = mixer.CreateBus(music, 0.5f);
+        const Fl::AudioMixer::BusId effects = mixer.CreateBus();
+        CHECK(music == 1);
+        CHECK(ambience == 2);
+        CHECK(effects == 3);
+        CHECK(mixer.CreateBus() == Fl::AudioMixer::InvalidBus);
+
+        Fl::AudioMixer::VoiceParameters parameters;
+        parameters.pan = -1.0f;
+        parameters.bus = ambience;
+        mixer.Play(constant, parameters);
+        parameters.pan = 1.0f;
+        parameters.bus = effects;
+        mixer.Play(constant, parameters);
+
+        std::vector<float> samples(2 * 64);
+        mixer.Render(samples);
+        CHECK(AreNear(samples[0], 0.25f));
+        CHECK(AreNear(samples[1], 1.0f));
+
+        CHECK(mixer.SetBusGain(Fl::AudioMixer::MasterBus, 2.0f));
+        CHECK(mixer.SetBusGain(music, 1.0f));
+        mixer.Render(samples);
+        mixer.Render(samples);
+        CHECK(AreNear(samples[0], 1.0f));
+        CHECK(AreNear(samples[1], 2.0f));
+    }
+
+    WHEN("Running out of voices") {
+        Fl::AudioMixer mixer(MakeSettings());
+        const Fl::AudioBuffer ramp = GenerateRamp(10, 48000);
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            CHECK(mixer.Play(ramp) != Fl::AudioMixer::InvalidVoice);
+        }
+        CHECK(mixer.Play(ramp) == Fl::AudioMixer::InvalidVoice);
+
+        std::vector<float> samples(2 * 64);
+        mixer.Render(samples);
+        CHECK(mixer.GetPlayingVoiceCount() == 0);
+        CHECK(mixer.Play(ramp) != Fl::AudioMixer::InvalidVoice);
+    }
+
+    WHEN("Mixing on a thread") {
+        Fl::AudioMixer mixer(MakeSettings());
+        const Fl::AudioBuffer ramp = GenerateRamp(480, 48000);
+
+        Fl::NullAudioDevice device;
+        REQUIRE(device.Open(48000));
+        CHECK_FALSE(device.IsRealTime());
+
+        mixer.Start(device);
+        CHECK(mixer.IsRunning());
+
+        std::vector<Fl::AudioMixer::VoiceId> voices;
+        for (std::size_t i = 0; i < 8; ++i) {
+            voices.push_back(mixer.Play(ramp));
+            CHECK(voices.back() != Fl::AudioMixer::InvalidVoice);
+        }
+
+        // The device takes blocks as fast as they are mixed
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (mixer.GetPlayingVoiceCount() > 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+
+        mixer.Stop();
+        CHECK_FALSE(mixer.IsRunning());
+        CHECK(mixer.GetPlayingVoiceCount() == 0);
+        CHECK(device.GetFrameCount() == mixer.GetStatistics().frameCount);
+        CHECK(device.GetFrameCount() >= 480);
+    }
+
+    WHEN("Recording to a WAV file") {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        const std::string filePath = Fl::PathToString(directory / "FlashlightAudio.wav");
+
+        {
+            Fl::WavAudioDevice device(filePath);
+            REQUIRE(device.Open(22050));
+            CHECK(device.GetSampleRate() == 22050);
+
+            const float frames[] = {0.5f, -0.25f, 2.0f, 1.0f, -1.0f, -3.0f};
+            CHECK(device.Write(frames));
+            CHECK(device.GetFrameCount() == 3);
+        }
+
+        CHECK(std::filesystem::file_size(Fl::Utf8Path(filePath)) == 44 + 3 * 4);
+
+        std::string errorMessage;
+        const std::optional<Fl::AudioBuffer> buffer = Fl::AudioBuffer::LoadFromFile(filePath, &errorMessage);
+        REQUIRE(buffer);
+        CHECK(errorMessage.empty());
+        CHECK(buffer->GetSampleRate() == 22050);
+        REQUIRE(buffer->GetSampleCount() == 3);
+
+        // Channels are averaged, after being clamped and quantized to 16 bits
+        constexpr float Quantum = 1.0f / 32768.0f;
+        CHECK(std::abs(buffer->GetSamples()[0] - 0.125f) <= Quantum);
+        CHECK(std::abs(buffer->GetSamples()[1] - 1.0f) <= Quantum);
+        CHECK(std::abs(buffer->GetSamples()[2] + 1.0f) <= Quantum);
+        CHECK(buffer->GetDuration() == 3.0 / 22050.0);
+
+        std::filesystem::remove(Fl::Utf8Path(filePath));
+        CHECK_FALSE(Fl::AudioBuffer::LoadFromFile(filePath, &errorMessage));
+        CHECK(errorMessage == "Failed to open " + filePath + ".");
+    }
+
+    WHEN("Loading devices from plugins") {
+        Fl::AudioDeviceLibrary nullLibrary;
+        REQUIRE(nullLibrary.Load(PREFIX "FlashlightAudioNull"));
+        CHECK(nullLibrary.IsLoaded());
+
+        Fl::AudioDeviceLibrary::DevicePtr nullDevice = nullLibrary.CreateDevice("realtime");
+        REQUIRE(nullDevice);
+        CHECK(dynamic_cast<Fl::NullAudioDevice&>(*nullDevice).IsRealTime());
+        REQUIRE(nullDevice->Open(48000));
+
+        // Paced like real hardware
+        const std::vector<float> samples(2 * 2400);
+        const auto start = std::chrono::steady_clock::now();
+        CHECK(nullDevice->Write(samples));
+        CHECK(nullDevice->Write(samples));
+        CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(50));
+        nullDevice.reset();
+
+        const std::string filePath = Fl::PathToString(std::filesystem::temp_directory_path() / "FlashlightPlugin.wav");
+        Fl::AudioDeviceLibrary wavLibrary;
+        REQUIRE(wavLibrary.Load(PREFIX "FlashlightAudioWav"));
+        CHECK_FALSE(wavLibrary.CreateDevice(""));
+
+        {
+            Fl::AudioDeviceLibrary::DevicePtr wavDevice = wavLibrary.CreateDevice(filePath.c_str());
+            REQUIRE(wavDevice);
+            REQUIRE(wavDevice->Open(48000));
+
+            Fl::AudioMixer mixer(MakeSettings());
+            mixer.Start(*wavDevice);
+            mixer.Stop();
+            CHECK(wavDevice->GetFrameCount() == mixer.GetStatistics().frameCount);
+        }
+
+        const std::optional<Fl::AudioBuffer> buffer = Fl::AudioBuffer::LoadFromFile(filePath);
+        REQUIRE(buffer);
+        CHECK(buffer->GetSampleRate() == 48000);
+        std::filesystem::remove(Fl::Utf8Path(filePath));
+
+        wavLibrary.Unload();
+        CHECK_FALSE(wavLibrary.IsLoaded());
+    }
+}
+
+TEST_CASE("AudioMixer benchmarks", "[Audio][.benchmark]") {
+    std::mt19937 rng(42);
+    const Fl::AudioBuffer noise = GenerateNoise(48000, 48000, rng);
+    const Fl::AudioBuffer lowRateNoise = GenerateNoise(22050, 22050, rng);
+
+    std::uniform_real_distribution<float> pans(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> pitches(0.5f, 2.0f);
+
+    for (const Fl::UInt32 voiceCount : {64u, 256u, 1024u}) {
+        for (const bool isResampled : {false, true}) {
+            Fl::AudioMixer::Settings settings;
+            settings.maxVoiceCount = voiceCount;
+            Fl::AudioMixer mixer(settings);
+
+            const Fl::AudioMixer::BusId buses[] = {Fl::AudioMixer::MasterBus, mixer.CreateBus(), mixer.CreateBus(1)};
+            for (Fl::UInt32 i = 0; i < voiceCount; ++i) {
+                Fl::AudioMixer::VoiceParameters parameters;
+                parameters.bus = buses[i % 3];
+                parameters.pan = pans(rng);
+                parameters.pitch = isResampled ? pitches(rng) : 1.0f;
+                parameters.isLooping = true;
+                mixer.Play(isResampled ? lowRateNoise : noise, parameters);
+            }
+
+            std::vector<float> samples(2 * static_cast<std::size_t>(settings.blockFrameCount));
+            const std::string name =
+                std::to_string(voiceCount) + " voices, " + (isResampled ? "resampled" : "mixer rate") + ", 1 block";
+            BENCHMARK(std::string(name)) {
+                mixer.Render(samples);
+                return samples[0];
+            };
+
+            WARN(name << ": " << mixer.GetStatistics().GetVoicesPerMillisecond() << " voices/ms");
+        }
+    }
+}
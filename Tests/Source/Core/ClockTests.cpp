@@ -0,0 +1,31 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/Clock.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+
+SCENARIO("Clock", "[Clock]") {
+    WHEN("Reading the current time") {
+        const Fl::Clock::time_point first = Fl::Clock::now();
+        const Fl::Clock::time_point second = Fl::Clock::now();
+
+        CHECK(second >= first);
+    }
+
+    WHEN("Using the clock as a stopwatch") {
+        Fl::Clock clock;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        const Fl::Clock::duration elapsed = clock.GetElapsedTime();
+        CHECK(elapsed >= std::chrono::milliseconds(5));
+
+        const Fl::Clock::time_point start = clock.GetStartTime();
+        CHECK(clock.Restart() >= elapsed);
+        CHECK(clock.GetStartTime() > start);
+        CHECK(clock.GetElapsedTime() < elapsed + std::chrono::seconds(1));
+    }
+}
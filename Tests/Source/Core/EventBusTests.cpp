@@ -0,0 +1,231 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/EventBus.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    struct DamageEvent {
+        Fl::UInt32 entity;
+        int amount;
+    };
+
+    struct SpawnEvent {
+        Fl::UInt32 entity;
+    };
+
+    struct LogEvent {
+        std::string message;
+    };
+
+    using TestBus = Fl::EventBus<DamageEvent, SpawnEvent, LogEvent>;
+}
+
+SCENARIO("EventBus", "[EventBus]") {
+    TestBus bus(4);
+
+    WHEN("Dispatching events to handlers") {
+        int damage = 0;
+        std::size_t batchCount = 0;
+        std::vector<Fl::UInt32> spawned;
+
+        bus.Subscribe<DamageEvent>([&](const DamageEvent& event) { damage += event.amount; });
+        bus.Subscribe<DamageEvent>([&](std::span<const DamageEvent>) { ++batchCount; });
+        bus.Subscribe<SpawnEvent>([&](const SpawnEvent& event) { spawned.push_back(event.entity); });
+
+        bus.Publish<DamageEvent>(1u, 10);
+        bus.Publish<DamageEvent>(2u, 5);
+        bus.Publish<SpawnEvent>(7u);
+        CHECK(bus.GetPendingCount<DamageEvent>() == 2);
+        CHECK(damage == 0);
+
+        bus.Dispatch();
+        CHECK(bus.GetPendingCount<DamageEvent>() == 0);
+        CHECK(damage == 15);
+        CHECK(batchCount == 1);
+        CHECK(spawned == std::vector<Fl::UInt32>{7});
+
+        bus.Dispatch();
+        CHECK(batchCount == 1);
+    }
+
+    WHEN("Subscribing with an Overloaded visitor") {
+        int damage = 0;
+        std::string log;
+
+        const TestBus::SubscriptionId subscription = bus.SubscribeAll(Fl::Overloaded{
+            [&](const DamageEvent& event) { damage += event.amount; },
+            [&](const LogEvent& event) { log += event.message; }});
+
+        bus.Publish<DamageEvent>(1u, 3);
+        bus.Publish<LogEvent>("Hello");
+        bus.Publish<SpawnEvent>(1u);
+        bus.Dispatch();
+
+        CHECK(damage == 3);
+        CHECK(log == "Hello");
+
+        bus.Unsubscribe(subscription);
+        bus.Publish<DamageEvent>(1u, 3);
+        bus.Dispatch();
+        CHECK(damage == 3);
+    }
+
+    WHEN("Publishing more events than the queue can hold") {
+        std::vector<int> amounts;
+        bus.Subscribe<DamageEvent>([&](const DamageEvent& event) { amounts.push_back(event.amount); });
+
+        for (int i = 0; i < 10; ++i) {
+            bus.Publish<DamageEvent>(0u, i);
+        }
+
+        const DamageEvent batch[] = {{0, 10}, {0, 11}};
+        bus.Publish(std::span<const DamageEvent>(batch));
+
+        bus.Dispatch();
+
+        std::vector<int> expected(12);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(amounts == expected);
+
+        // Queues grew and still work
+        amounts.clear();
+        bus.Publish<DamageEvent>(0u, 42);
+        bus.Dispatch();
+        CHECK(amounts == std::vector<int>{42});
+    }
+
+    WHEN("Publishing from handlers") {
+        int logCount = 0;
+        int spawnCount = 0;
+        bus.Subscribe<LogEvent>([&](const LogEvent&) { ++logCount; });
+        bus.Subscribe<SpawnEvent>([&](const SpawnEvent& event) {
+            ++spawnCount;
+            bus.Publish<LogEvent>("Spawned");
+            bus.Publish<SpawnEvent>(event.entity + 1);
+        });
+
+        bus.Publish<SpawnEvent>(0u);
+        bus.Dispatch();
+
+        // The log event type is dispatched after spawn events, in the same Dispatch call
+        CHECK(spawnCount == 1);
+        CHECK(logCount == 1);
+        CHECK(bus.GetPendingCount<SpawnEvent>() == 1);
+
+        bus.Dispatch();
+        CHECK(spawnCount == 2);
+        CHECK(logCount == 2);
+    }
+
+    WHEN("Publishing from multiple threads") {
+        constexpr int ThreadCount = 4;
+        constexpr int EventCount = 10'000;
+
+        std::vector<int> lastAmount(ThreadCount, -1);
+        bool ordered = true;
+        long long total = 0;
+        bus.Subscribe<DamageEvent>([&](const DamageEvent& event) {
+            total += event.amount;
+
+            // Each thread publishes increasing amounts, which must be seen in order
+            ordered = ordered && (event.amount > lastAmount[event.entity]);
+            lastAmount[event.entity] = event.amount;
+        });
+
+        for (int frame = 0; frame < 2; ++frame) {
+            std::vector<std::thread> threads;
+            for (int t = 0; t < ThreadCount; ++t) {
+                threads.emplace_back([&, t] {
+                    for (int i = 0; i < EventCount; ++i) {
+                        bus.Publish<DamageEvent>(static_cast<Fl::UInt32>(t), i + frame * EventCount);
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            CHECK(bus.GetPendingCount<DamageEvent>() == ThreadCount * EventCount);
+            bus.Dispatch();
+        }
+
+        const long long perFrame = static_cast<long long>(EventCount) * (EventCount - 1) / 2;
+        CHECK(total == ThreadCount * (2 * perFrame + static_cast<long long>(EventCount) * EventCount));
+        CHECK(ordered);
+    }
+}
+
+TEST_CASE("EventBus benchmarks", "[EventBus][.benchmark]") {
+    constexpr int EventCount = 1'000'000;
+
+    TestBus bus(EventCount);
+    long long total = 0;
+    bus.Subscribe<DamageEvent>([&](const DamageEvent& event) { total += event.amount; });
+
+    BENCHMARK("Fl::EventBus, 1M events per frame") {
+        for (int i = 0; i < EventCount; ++i) {
+            bus.Publish<DamageEvent>(0u, i);
+        }
+
+        bus.Dispatch();
+        return total;
+    };
+
+    BENCHMARK("Fl::EventBus, 1M events per frame published by batches of 256") {
+        std::array<DamageEvent, 256> batch;
+        for (int i = 0; i < EventCount; i += static_cast<int>(batch.size())) {
+            for (std::size_t j = 0; j < batch.size(); ++j) {
+                batch[j] = {0u, i + static_cast<int>(j)};
+            }
+
+            bus.Publish(std::span<const DamageEvent>(batch));
+        }
+
+        bus.Dispatch();
+        return total;
+    };
+
+    BENCHMARK("Fl::EventBus, 1M events per frame from 4 threads") {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < EventCount / 4; ++i) {
+                    bus.Publish<DamageEvent>(0u, i);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        bus.Dispatch();
+        return total;
+    };
+
+    std::vector<std::function<void(const DamageEvent&)>> handlers;
+    handlers.emplace_back([&](const DamageEvent& event) { total += event.amount; });
+
+    BENCHMARK("Immediate std::function dispatch, 1M events per frame") {
+        for (int i = 0; i < EventCount; ++i) {
+            const DamageEvent event{0u, i};
+            for (const auto& handler : handlers) {
+                handler(event);
+            }
+        }
+
+        return total;
+    };
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/GameLoop.hpp>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+SCENARIO("GameLoop", "[GameLoop]") {
+    Fl::GameLoop::Settings settings;
+    settings.fixedStep = 10ms;
+    settings.maxCatchUpSteps = 4;
+    settings.statisticsWindow = 100;
+
+    Fl::GameLoop loop(settings);
+    CHECK(loop.GetSettings().hitchThreshold == 20ms);
+
+    const Fl::Clock::time_point start{};
+
+    int stepCount = 0;
+    Fl::Clock::duration lastFrameTime{};
+    float lastAlpha = -1.f;
+    const Fl::GameLoop::FixedUpdateCallback fixedUpdate = [&](const Fl::Clock::duration step) {
+        CHECK(step == 10ms);
+        ++stepCount;
+    };
+    const Fl::GameLoop::UpdateCallback update = [&](const Fl::Clock::duration frameTime, const float alpha) {
+        lastFrameTime = frameTime;
+        lastAlpha = alpha;
+    };
+
+    WHEN("Accumulating frame time into fixed steps") {
+        CHECK(loop.Tick(start, fixedUpdate, update) == 0);
+        CHECK(lastAlpha == 0.f);
+
+        CHECK(loop.Tick(start + 25ms, fixedUpdate, update) == 2);
+        CHECK(stepCount == 2);
+        CHECK(lastFrameTime == 25ms);
+        CHECK(lastAlpha == Catch::Approx(0.5f));
+
+        // The remaining half step is carried over
+        CHECK(loop.Tick(start + 30ms, fixedUpdate, update) == 1);
+        CHECK(lastAlpha == Catch::Approx(0.f));
+        CHECK(loop.GetAlpha() == lastAlpha);
+    }
+
+    WHEN("Falling behind the simulation") {
+        loop.Tick(start, fixedUpdate, update);
+        CHECK(loop.Tick(start + 1005ms, fixedUpdate, update) == 4);
+
+        // Time which couldn't be simulated is dropped, only the fraction of step is kept
+        CHECK(lastAlpha == Catch::Approx(0.5f));
+        CHECK(loop.GetStatistics().droppedStepCount == 96);
+
+        CHECK(loop.Tick(start + 1015ms, fixedUpdate, update) == 1);
+        CHECK(stepCount == 5);
+    }
+
+    WHEN("Computing frame statistics") {
+        CHECK(loop.GetStatistics().windowFrameCount == 0);
+        CHECK(loop.GetFrameTimePercentile(50.0) == Fl::Clock::duration::zero());
+
+        // Frame times from 1 to 200ms, only the last 100 are kept
+        Fl::Clock::time_point now = start;
+        loop.Tick(now, nullptr, nullptr);
+        for (int i = 1; i <= 200; ++i) {
+            now += std::chrono::milliseconds(i);
+            loop.Tick(now, nullptr, nullptr);
+        }
+
+        const Fl::GameLoop::FrameStatistics statistics = loop.GetStatistics();
+        CHECK(statistics.frameCount == 200);
+        CHECK(statistics.windowFrameCount == 100);
+        CHECK(statistics.minFrameTime == 101ms);
+        CHECK(statistics.maxFrameTime == 200ms);
+        CHECK(statistics.averageFrameTime == 150500us);
+        CHECK(statistics.medianFrameTime == 150ms);
+        CHECK(statistics.percentile95FrameTime == 195ms);
+        CHECK(statistics.percentile99FrameTime == 199ms);
+        CHECK(loop.GetFrameTimePercentile(95.0) == 195ms);
+
+        // Every frame longer than 20ms is a hitch
+        CHECK(statistics.hitchCount == 180);
+        CHECK(statistics.windowHitchCount == 100);
+    }
+
+    WHEN("Running a paced loop") {
+        Fl::GameLoop::Settings pacedSettings;
+        pacedSettings.fixedStep = 5ms;
+        pacedSettings.targetFrameTime = 5ms;
+        pacedSettings.spinThreshold = 1ms;
+
+        Fl::GameLoop pacedLoop(pacedSettings);
+
+        int frameCount = 0;
+        const Fl::Clock clock;
+        pacedLoop.Run(nullptr, [&](Fl::Clock::duration, float) {
+            if (++frameCount == 11) {
+                pacedLoop.Stop();
+            }
+        });
+
+        CHECK_FALSE(pacedLoop.IsRunning());
+        CHECK(clock.GetElapsedTime() >= 50ms);
+        CHECK(pacedLoop.GetStatistics().frameCount == 10);
+    }
+}
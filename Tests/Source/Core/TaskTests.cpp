@@ -0,0 +1,203 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/CoroutineFramePool.hpp>
+#include <FlashlightEngine/Core/CoroutineScheduler.hpp>
+#include <FlashlightEngine/Core/Task.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    Fl::Task<int> Add(const int a, const int b) {
+        co_return a + b;
+    }
+
+    Fl::Task<int> AddTwice(const int a, const int b) {
+        const int first = co_await Add(a, b);
+        const int second = co_await Add(first, b);
+        co_return second;
+    }
+
+    Fl::Task<int> CountDown(const int depth) {
+        if (depth == 0) {
+            co_return 0;
+        }
+
+        co_return 1 + co_await CountDown(depth - 1);
+    }
+
+    Fl::Task<> Throw() {
+        throw std::runtime_error("Task failure");
+        co_return;
+    }
+
+    Fl::Task<std::string> CatchFromChild() {
+        try {
+            co_await Throw();
+        } catch (const std::runtime_error& e) {
+            co_return e.what();
+        }
+
+        co_return "";
+    }
+
+    Fl::Task<> WaitFrames(Fl::CoroutineScheduler& scheduler, const int frameCount, int& counter) {
+        for (int i = 0; i < frameCount; ++i) {
+            co_await scheduler.NextFrame();
+        }
+
+        ++counter;
+    }
+
+    Fl::Task<> WaitFramesNested(Fl::CoroutineScheduler& scheduler, int& counter) {
+        co_await WaitFrames(scheduler, 2, counter);
+        co_await scheduler.NextFrame();
+    }
+
+    Fl::Task<bool> HopThreads(Fl::CoroutineScheduler& scheduler) {
+        const std::thread::id mainThreadId = std::this_thread::get_id();
+
+        co_await scheduler.SwitchToThreadPool();
+        const bool onWorker = (std::this_thread::get_id() != mainThreadId);
+
+        co_await scheduler.SwitchToMainThread();
+        co_return onWorker && std::this_thread::get_id() == mainThreadId;
+    }
+
+    Fl::Task<std::size_t> ReadSize(Fl::CoroutineScheduler& scheduler, std::filesystem::path path) {
+        const std::optional<std::vector<Fl::UInt8>> content = co_await scheduler.ReadFile(std::move(path));
+        co_return content ? content->size() : 0;
+    }
+
+    template <typename T>
+    void RunUntilDone(Fl::CoroutineScheduler& scheduler, Fl::Task<T>& task) {
+        while (!task.IsDone()) {
+            scheduler.Update();
+            std::this_thread::yield();
+        }
+    }
+}
+
+SCENARIO("Task", "[Task]") {
+    WHEN("Awaiting tasks") {
+        Fl::Task<int> task = AddTwice(1, 2);
+        CHECK_FALSE(task.IsDone());
+
+        task.Start();
+        REQUIRE(task.IsDone());
+        CHECK(task.GetResult() == 5);
+    }
+
+    WHEN("Chaining a lot of tasks") {
+        // Only works without stack overflow thanks to symmetric transfer
+        Fl::Task<int> task = CountDown(10'000);
+        task.Start();
+
+        REQUIRE(task.IsDone());
+        CHECK(task.GetResult() == 10'000);
+    }
+
+    WHEN("Propagating exceptions") {
+        Fl::Task<std::string> task = CatchFromChild();
+        task.Start();
+
+        REQUIRE(task.IsDone());
+        CHECK(task.GetResult() == "Task failure");
+
+        Fl::Task<> failing = Throw();
+        failing.Start();
+        CHECK_THROWS_AS(failing.GetResult(), std::runtime_error);
+    }
+
+    WHEN("Using the scheduler") {
+        Fl::ThreadPool threadPool(2);
+        Fl::CoroutineScheduler scheduler(threadPool);
+
+        int counter = 0;
+        Fl::Task<> frames = WaitFrames(scheduler, 3, counter);
+        frames.Start();
+
+        CHECK(scheduler.GetWaitingCount() == 1);
+        scheduler.Update();
+        scheduler.Update();
+        CHECK_FALSE(frames.IsDone());
+        scheduler.Update();
+        CHECK(frames.IsDone());
+        CHECK(counter == 1);
+
+        Fl::Task<bool> hop = HopThreads(scheduler);
+        hop.Start();
+        RunUntilDone(scheduler, hop);
+        CHECK(hop.GetResult());
+
+        const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "FlashlightTaskTest.bin";
+        {
+            std::ofstream file(filePath, std::ios::binary);
+            file << "0123456789";
+        }
+
+        Fl::Task<std::size_t> read = ReadSize(scheduler, filePath);
+        read.Start();
+        RunUntilDone(scheduler, read);
+        CHECK(read.GetResult() == 10);
+        std::filesystem::remove(filePath);
+
+        Fl::Task<std::size_t> missing = ReadSize(scheduler, filePath);
+        missing.Start();
+        RunUntilDone(scheduler, missing);
+        CHECK(missing.GetResult() == 0);
+
+        const auto delayed = [&]() -> Fl::Task<> { co_await scheduler.Delay(std::chrono::milliseconds(10)); };
+        Fl::Task<> delay = delayed();
+        delay.Start();
+        scheduler.Update();
+        CHECK_FALSE(delay.IsDone());
+        scheduler.Update(Fl::CoroutineScheduler::Clock::now() + std::chrono::milliseconds(20));
+        CHECK(delay.IsDone());
+    }
+
+    WHEN("Running ten thousand tasks with pooled frames") {
+        constexpr std::size_t TaskCount = 10'000;
+
+        Fl::ThreadPool threadPool(1);
+        Fl::CoroutineScheduler scheduler(threadPool);
+        Fl::CoroutineFramePool framePool(1024, 2 * TaskCount);
+        Fl::SetCoroutineFrameAllocator(framePool.GetAllocator());
+
+        int counter = 0;
+        std::vector<Fl::Task<>> tasks;
+        tasks.reserve(TaskCount);
+
+        for (int round = 0; round < 2; ++round) {
+            for (std::size_t i = 0; i < TaskCount; ++i) {
+                tasks.push_back(WaitFramesNested(scheduler, counter));
+                tasks.back().Start();
+            }
+
+            // Each in-flight task holds its own frame and the one of its child
+            CHECK(framePool.GetLiveFrameCount() == 2 * TaskCount);
+
+            for (int frame = 0; frame < 3; ++frame) {
+                scheduler.Update();
+            }
+
+            CHECK(scheduler.GetWaitingCount() == 0);
+            tasks.clear();
+            CHECK(framePool.GetLiveFrameCount() == 0);
+        }
+
+        // The second round reused the frames of the first one
+        CHECK(counter == 2 * TaskCount);
+        CHECK(framePool.GetSystemAllocationCount() == 2 * TaskCount);
+
+        Fl::ResetCoroutineFrameAllocator();
+    }
+}
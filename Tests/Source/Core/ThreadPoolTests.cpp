@@ -0,0 +1,54 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+SCENARIO("ThreadPool", "[ThreadPool]") {
+    Fl::ThreadPool threadPool(3);
+    CHECK(threadPool.GetWorkerCount() == 3);
+
+    WHEN("Running a parallel for") {
+        std::vector<int> values(10'000, 0);
+        threadPool.ParallelFor(values.size(), 128, [&](const std::size_t first, const std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                values[i] = static_cast<int>(i);
+            }
+        });
+
+        std::vector<int> expected(values.size());
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(values == expected);
+    }
+
+    WHEN("Nesting parallel fors") {
+        std::atomic<int> count = 0;
+        threadPool.ParallelFor(16, 1, [&](std::size_t, std::size_t) {
+            threadPool.ParallelFor(100, 10, [&](const std::size_t first, const std::size_t last) {
+                count.fetch_add(static_cast<int>(last - first), std::memory_order_relaxed);
+            });
+        });
+
+        CHECK(count.load() == 1600);
+    }
+
+    WHEN("Submitting jobs") {
+        std::atomic<int> count = 0;
+        for (int i = 0; i < 1000; ++i) {
+            threadPool.Submit(Fl::ThreadPool::Job{
+                [](void* userdata) { static_cast<std::atomic<int>*>(userdata)->fetch_add(1); }, &count});
+        }
+
+        while (count.load() < 1000) {
+            threadPool.TryExecuteJob();
+        }
+
+        CHECK(count.load() == 1000);
+    }
+}
@@ -0,0 +1,333 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Image/BlockCompressor.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+    constexpr std::array Formats = {Fl::BlockFormat::BC1, Fl::BlockFormat::BC3, Fl::BlockFormat::BC4,
+                                    Fl::BlockFormat::BC5, Fl::BlockFormat::BC7};
+    constexpr std::array Qualities = {Fl::CompressionQuality::Fast, Fl::CompressionQuality::Normal,
+                                      Fl::CompressionQuality::Exhaustive};
+
+    // Smooth gradients, sharp edges and noise, with an alpha gradient unless opaque
+    Fl::Image GenerateTestImage(const Fl::UInt32 width, const Fl::UInt32 height, const bool isOpaque) {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> noise(-8, 8);
+
+        Fl::Image image(width, height, Fl::ImageFormat::RGBA8);
+        for (Fl::UInt32 y = 0; y < height; ++y) {
+            Fl::UInt8* row = image.GetRow(y);
+            for (Fl::UInt32 x = 0; x < width; ++x) {
+                const float u = static_cast<float>(x) / static_cast<float>(width);
+                const float v = static_cast<float>(y) / static_cast<float>(height);
+                const int values[4] = {static_cast<int>(128.f + 100.f * std::sin(6.f * u + 2.f * v)),
+                                       static_cast<int>(128.f + 90.f * std::cos(5.f * v - 3.f * u)),
+                                       (((x / 8) + (y / 8)) % 2 == 0) ? 200 : 40,
+                                       isOpaque ? 255 : static_cast<int>(255.f * u * v)};
+                for (int channel = 0; channel < 4; ++channel) {
+                    const int value = (isOpaque && channel == 3) ? 255 : values[channel] + noise(rng);
+                    row[x * 4 + channel] = static_cast<Fl::UInt8>(std::clamp(value, 0, 255));
+                }
+            }
+        }
+
+        return image;
+    }
+
+    // Channels encoded by a format, alpha being only kept by BC1 for the transparent pixels
+    int GetChannelCount(const Fl::BlockFormat format) {
+        switch (format) {
+            case Fl::BlockFormat::BC1:
+                return 3;
+
+            case Fl::BlockFormat::BC4:
+                return 1;
+
+            case Fl::BlockFormat::BC5:
+                return 2;
+
+            default:
+                return 4;
+        }
+    }
+
+    double ComputePsnr(const Fl::Image& lhs, const Fl::Image& rhs, const int channelCount) {
+        double squaredError = 0.0;
+        for (Fl::UInt32 y = 0; y < lhs.GetHeight(); ++y) {
+            for (Fl::UInt32 x = 0; x < lhs.GetWidth(); ++x) {
+                for (int channel = 0; channel < channelCount; ++channel) {
+                    const double difference = lhs.GetRow(y)[x * 4 + channel] - rhs.GetRow(y)[x * 4 + channel];
+                    squaredError += difference * difference;
+                }
+            }
+        }
+
+        const double pixelCount = static_cast<double>(lhs.GetWidth()) * lhs.GetHeight();
+        const double meanError = squaredError / (pixelCount * channelCount);
+        return (meanError > 0.0) ? 10.0 * std::log10(255.0 * 255.0 / meanError) : 100.0;
+    }
+
+    void SetBits(Fl::UInt8* block, const Fl::UInt32 first, const Fl::UInt32 count) {
+        for (Fl::UInt32 bit = first; bit < first + count; ++bit) {
+            block[bit / 8] |= static_cast<Fl::UInt8>(1u << (bit % 8));
+        }
+    }
+}
+
+SCENARIO("BlockCompressor", "[Image]") {
+    using Fl::BlockCompressor;
+    using Fl::BlockFormat;
+
+    WHEN("Computing sizes") {
+        CHECK(BlockCompressor::GetBlockByteSize(BlockFormat::BC1) == 8);
+        CHECK(BlockCompressor::GetBlockByteSize(BlockFormat::BC3) == 16);
+        CHECK(BlockCompressor::GetBlockByteSize(BlockFormat::BC4) == 8);
+        CHECK(BlockCompressor::GetBlockByteSize(BlockFormat::BC5) == 16);
+        CHECK(BlockCompressor::GetBlockByteSize(BlockFormat::BC7) == 16);
+
+        // Partial blocks take a whole block
+        CHECK(BlockCompressor::GetCompressedSize(5, 9, BlockFormat::BC1) == 2 * 3 * 8);
+        CHECK(BlockCompressor::GetCompressedSize(8, 4, BlockFormat::BC7) == 2 * 16);
+        CHECK(BlockCompressor::GetCompressedSize(1, 1, BlockFormat::BC5) == 16);
+    }
+
+    WHEN("Decoding known blocks") {
+        Fl::UInt8 pixels[64];
+
+        // Red and blue endpoints in four-color mode, indices 0 to 3 along each row
+        const Fl::UInt8 bc1Block[8] = {0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4};
+        BlockCompressor::DecodeBlock(bc1Block, BlockFormat::BC1, pixels);
+        CHECK(std::vector<Fl::UInt8>(pixels, pixels + 16) ==
+              std::vector<Fl::UInt8>{255, 0, 0, 255, 0, 0, 255, 255, 170, 0, 85, 255, 85, 0, 170, 255});
+
+        // Swapped endpoints select three colors and transparent black
+        const Fl::UInt8 bc1TransparentBlock[8] = {0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4};
+        BlockCompressor::DecodeBlock(bc1TransparentBlock, BlockFormat::BC1, pixels);
+        CHECK(std::vector<Fl::UInt8>(pixels + 8, pixels + 16) == std::vector<Fl::UInt8>{128, 0, 128, 255, 0, 0, 0, 0});
+
+        // BC3 colors always have four, the alpha block interpolating between 255 and 0 with indices 0 to 7
+        Fl::UInt8 bc3Block[16] = {255, 0, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA};
+        std::copy_n(bc1TransparentBlock, 8, bc3Block + 8);
+        BlockCompressor::DecodeBlock(bc3Block, BlockFormat::BC3, pixels);
+        CHECK(std::vector<Fl::UInt8>(pixels + 8, pixels + 16) ==
+              std::vector<Fl::UInt8>{85, 0, 170, 219, 170, 0, 85, 182});
+        CHECK(pixels[7 * 4 + 3] == 36);
+
+        // Increasing endpoints select six values with 0 and 255
+        const Fl::UInt8 bc4Block[8] = {10, 200, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA};
+        BlockCompressor::DecodeBlock(bc4Block, BlockFormat::BC4, pixels);
+        CHECK(std::vector<Fl::UInt8>(pixels, pixels + 8) == std::vector<Fl::UInt8>{10, 0, 0, 255, 200, 0, 0, 255});
+        CHECK(pixels[2 * 4] == 48);
+        CHECK(pixels[6 * 4] == 0);
+        CHECK(pixels[7 * 4] == 255);
+
+        Fl::UInt8 bc5Block[16] = {};
+        std::copy_n(bc4Block, 8, bc5Block);
+        bc5Block[8] = 77;
+        bc5Block[9] = 77;
+        BlockCompressor::DecodeBlock(bc5Block, BlockFormat::BC5, pixels);
+        CHECK(std::vector<Fl::UInt8>(pixels + 4, pixels + 8) == std::vector<Fl::UInt8>{200, 77, 0, 255});
+
+        // Mode 6 with every endpoint and p-bit set, then the reserved mode
+        Fl::UInt8 bc7Block[16] = {};
+        SetBits(bc7Block, 6, 1);
+        SetBits(bc7Block, 7, 8 * 7 + 2);
+        BlockCompressor::DecodeBlock(bc7Block, BlockFormat::BC7, pixels);
+        CHECK(std::all_of(pixels, pixels + 64, [](const Fl::UInt8 value) { return value == 255; }));
+
+        const Fl::UInt8 reservedBlock[16] = {};
+        BlockCompressor::DecodeBlock(reservedBlock, BlockFormat::BC7, pixels);
+        CHECK(std::all_of(pixels, pixels + 64, [](const Fl::UInt8 value) { return value == 0; }));
+
+        // Mode 5 swapping alpha and red, with red endpoints 0 and 255 and both alpha endpoints 255
+        Fl::UInt8 bc7RotatedBlock[16] = {};
+        SetBits(bc7RotatedBlock, 5, 1);
+        SetBits(bc7RotatedBlock, 6, 1);
+        SetBits(bc7RotatedBlock, 8 + 7, 7);
+        SetBits(bc7RotatedBlock, 8 + 42, 16);
+        BlockCompressor::DecodeBlock(bc7RotatedBlock, BlockFormat::BC7, pixels);
+        CHECK(std::vector<Fl::UInt8>(pixels, pixels + 4) == std::vector<Fl::UInt8>{255, 0, 0, 0});
+    }
+
+    WHEN("Encoding solid blocks") {
+        std::mt19937 rng(3);
+        for (BlockFormat format : Formats) {
+            for (Fl::CompressionQuality quality : Qualities) {
+                int maxError = 0;
+                for (int i = 0; i < 50; ++i) {
+                    Fl::UInt8 color[4];
+                    for (Fl::UInt8& channel : color) {
+                        channel = static_cast<Fl::UInt8>(rng() & 255u);
+                    }
+
+                    if (format == BlockFormat::BC1) {
+                        color[3] = 255;
+                    }
+
+                    Fl::UInt8 pixels[64];
+                    for (std::size_t j = 0; j < 64; ++j) {
+                        pixels[j] = color[j % 4];
+                    }
+
+                    Fl::UInt8 block[16];
+                    Fl::UInt8 decodedPixels[64];
+                    BlockCompressor::EncodeBlock(pixels, format, quality, block);
+                    BlockCompressor::DecodeBlock(block, format, decodedPixels);
+                    for (std::size_t j = 0; j < 64; ++j) {
+                        if (static_cast<int>(j % 4) < GetChannelCount(format) || format == BlockFormat::BC1) {
+                            maxError = std::max(maxError, std::abs(decodedPixels[j] - pixels[j]));
+                        }
+                    }
+                }
+
+                INFO("Format " << static_cast<int>(format) << ", quality " << static_cast<int>(quality));
+                if (format == BlockFormat::BC4 || format == BlockFormat::BC5) {
+                    CHECK(maxError == 0);
+                } else if (format == BlockFormat::BC7) {
+                    CHECK(maxError <= 1);
+                } else {
+                    CHECK(maxError <= 4);
+                }
+            }
+        }
+    }
+
+    WHEN("Compressing images") {
+        const Fl::Image opaqueImage = GenerateTestImage(32, 32, true);
+        const Fl::Image translucentImage = GenerateTestImage(32, 32, false);
+
+        // Minimum PSNR per format and quality
+        const std::array<std::array<double, 3>, 5> minPsnrs = {{{28.5, 30.0, 30.0},
+                                                                 {30.0, 31.0, 31.0},
+                                                                 {40.5, 41.5, 42.0},
+                                                                 {41.0, 42.0, 42.5},
+                                                                 {30.5, 33.5, 35.0}}};
+
+        for (std::size_t formatIndex = 0; formatIndex < Formats.size(); ++formatIndex) {
+            const BlockFormat format = Formats[formatIndex];
+            const Fl::Image& image = (format == BlockFormat::BC1) ? opaqueImage : translucentImage;
+
+            double previousPsnr = 0.0;
+            for (std::size_t qualityIndex = 0; qualityIndex < Qualities.size(); ++qualityIndex) {
+                BlockCompressor compressor({format, Qualities[qualityIndex]});
+                const std::vector<Fl::UInt8> blocks = compressor.Compress(image);
+                REQUIRE(blocks.size() == BlockCompressor::GetCompressedSize(32, 32, format));
+
+                const Fl::Image decodedImage = BlockCompressor::Decompress(blocks, 32, 32, format);
+                REQUIRE(decodedImage.GetWidth() == 32);
+                REQUIRE(decodedImage.GetFormat() == Fl::ImageFormat::RGBA8);
+
+                const double psnr = ComputePsnr(image, decodedImage, GetChannelCount(format));
+                INFO("Format " << formatIndex << ", quality " << qualityIndex << ", PSNR " << psnr);
+                CHECK(psnr >= minPsnrs[formatIndex][qualityIndex]);
+                CHECK(psnr >= previousPsnr - 0.05);
+                previousPsnr = psnr;
+
+                CHECK(compressor.GetStatistics().blockCount == 64);
+                CHECK(compressor.GetStatistics().pixelCount == 1024);
+            }
+        }
+    }
+
+    WHEN("Compressing transparent pixels to BC1") {
+        Fl::Image image = GenerateTestImage(8, 8, true);
+        for (Fl::UInt32 y = 0; y < 8; ++y) {
+            for (Fl::UInt32 x = 0; x < 8; ++x) {
+                image.GetRow(y)[x * 4 + 3] = ((x + y) % 3 == 0) ? 100 : 200;
+            }
+        }
+
+        const Fl::Image decodedImage =
+            BlockCompressor::Decompress(BlockCompressor({BlockFormat::BC1}).Compress(image), 8, 8, BlockFormat::BC1);
+        bool areAlphasBinary = true;
+        for (Fl::UInt32 y = 0; y < 8; ++y) {
+            for (Fl::UInt32 x = 0; x < 8; ++x) {
+                areAlphasBinary = areAlphasBinary &&
+                                  decodedImage.GetRow(y)[x * 4 + 3] == (((x + y) % 3 == 0) ? 0 : 255);
+            }
+        }
+
+        CHECK(areAlphasBinary);
+    }
+
+    WHEN("Compressing partial blocks and other formats") {
+        const Fl::Image image = GenerateTestImage(6, 5, false);
+
+        BlockCompressor compressor({BlockFormat::BC7, Fl::CompressionQuality::Normal});
+        const std::vector<Fl::UInt8> blocks = compressor.Compress(image);
+        CHECK(blocks.size() == 4 * 16);
+        CHECK(compressor.GetStatistics().pixelCount == 64);
+
+        const Fl::Image decodedImage =
+            BlockCompressor::Decompress(blocks, 6, 5, BlockFormat::BC7, Fl::ColorSpace::Srgb);
+        CHECK(decodedImage.GetWidth() == 6);
+        CHECK(decodedImage.GetHeight() == 5);
+        CHECK(decodedImage.GetColorSpace() == Fl::ColorSpace::Srgb);
+        CHECK(ComputePsnr(image, decodedImage, 4) >= 24.0);
+
+        // Floating point images are converted to RGBA8 first
+        const Fl::Image floatImage = image.Convert(Fl::ImageFormat::RGBA32F, Fl::ColorSpace::Linear);
+        CHECK(compressor.Compress(floatImage) == blocks);
+
+        // Levels are compressed on their own
+        Fl::Image mipmappedImage = GenerateTestImage(16, 16, false);
+        mipmappedImage.GenerateMipmaps();
+        CHECK(compressor.Compress(mipmappedImage, 2).size() == 16);
+        CHECK(compressor.GetStatistics().blockCount == 1);
+    }
+
+    WHEN("Compressing with a thread pool") {
+        Fl::ThreadPool threadPool(3);
+        const Fl::Image image = GenerateTestImage(40, 28, false);
+
+        for (BlockFormat format : {BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC7}) {
+            BlockCompressor compressor({format, Fl::CompressionQuality::Normal});
+            CHECK(compressor.Compress(image, 0, &threadPool) == compressor.Compress(image));
+        }
+    }
+}
+
+TEST_CASE("BlockCompressor benchmarks", "[Image][.benchmark]") {
+    Fl::ThreadPool threadPool;
+
+    const Fl::Image image = GenerateTestImage(512, 512, false);
+    const Fl::Image smallImage = GenerateTestImage(128, 128, false);
+
+    constexpr std::array formatNames = {"BC1", "BC3", "BC4", "BC5", "BC7"};
+    constexpr std::array qualityNames = {"fast", "normal", "exhaustive"};
+
+    for (std::size_t formatIndex = 0; formatIndex < Formats.size(); ++formatIndex) {
+        for (std::size_t qualityIndex = 0; qualityIndex < Qualities.size(); ++qualityIndex) {
+            // Exhaustive BC7 is orders of magnitude slower
+            const bool isSlow = (Formats[formatIndex] == Fl::BlockFormat::BC7 &&
+                                 Qualities[qualityIndex] == Fl::CompressionQuality::Exhaustive);
+            const Fl::Image& source = isSlow ? smallImage : image;
+
+            const std::string name = std::string(formatNames[formatIndex]) + " " + qualityNames[qualityIndex] + ", " +
+                                     std::to_string(source.GetWidth()) + "x" + std::to_string(source.GetHeight());
+
+            Fl::BlockCompressor compressor({Formats[formatIndex], Qualities[qualityIndex]});
+            BENCHMARK(std::string(name)) {
+                return compressor.Compress(source).size();
+            };
+
+            BENCHMARK(name + ", thread pool") {
+                return compressor.Compress(source, 0, &threadPool).size();
+            };
+        }
+    }
+}
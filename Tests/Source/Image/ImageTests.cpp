@@ -0,0 +1,375 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Image/Image.hpp>
+#include <FlashlightEngine/Utility/PathUtils.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+    Fl::Image GenerateNoise(const Fl::UInt32 width, const Fl::UInt32 height, const Fl::ImageFormat format,
+                            const Fl::ColorSpace colorSpace) {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> byte(0, 255);
+
+        Fl::Image image(width, height, Fl::ImageFormat::RGBA8, colorSpace);
+        for (Fl::UInt32 y = 0; y < height; ++y) {
+            Fl::UInt8* row = image.GetRow(y);
+            for (Fl::UInt32 i = 0; i < width * 4; ++i) {
+                row[i] = static_cast<Fl::UInt8>(byte(rng));
+            }
+        }
+
+        return image.Convert(format, colorSpace);
+    }
+
+    bool AreEqual(const Fl::Image& lhs, const Fl::Image& rhs) {
+        if (lhs.GetLevelCount() != rhs.GetLevelCount() || lhs.GetFormat() != rhs.GetFormat()) {
+            return false;
+        }
+
+        for (Fl::UInt32 level = 0; level < lhs.GetLevelCount(); ++level) {
+            const std::size_t rowSize = lhs.GetWidth(level) * Fl::Image::GetBytesPerPixel(lhs.GetFormat());
+            for (Fl::UInt32 y = 0; y < lhs.GetHeight(level); ++y) {
+                if (std::memcmp(lhs.GetRow(y, level), rhs.GetRow(y, level), rowSize) != 0) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+SCENARIO("Image", "[Image]") {
+    WHEN("Creating an image with its mip levels") {
+        Fl::Image image(100, 24, Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear, 0);
+
+        CHECK(image.GetLevelCount() == 7);
+        CHECK(Fl::Image::GetFullLevelCount(4096, 2048) == 13);
+        CHECK(image.GetWidth(2) == 25);
+        CHECK(image.GetHeight(2) == 6);
+        CHECK(image.GetWidth(6) == 1);
+        CHECK(image.GetHeight(6) == 1);
+
+        // Rows start on their own cache line
+        CHECK(image.GetRowPitch() == 832);
+        CHECK(image.GetRowPitch(3) == 128);
+        for (Fl::UInt32 level = 0; level < image.GetLevelCount(); ++level) {
+            CHECK(reinterpret_cast<std::uintptr_t>(image.GetRow(image.GetHeight(level) - 1, level)) %
+                      Fl::Image::RowAlignment == 0);
+        }
+
+        CHECK(image.GetPixel(99, 23) == Fl::Color{0.f, 0.f, 0.f, 0.f});
+        CHECK_FALSE(Fl::Image().IsValid());
+    }
+
+    WHEN("Converting between formats and color spaces") {
+        // Every sRGB code survives a trip through linear floats
+        Fl::Image codes(256, 1, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+        for (Fl::UInt32 x = 0; x < 256; ++x) {
+            std::memset(codes.GetRow(0) + x * 4, static_cast<int>(x), 4);
+        }
+
+        const Fl::Image linear = codes.Convert(Fl::ImageFormat::RGBA32F, Fl::ColorSpace::Linear);
+        CHECK(linear.GetPixel(0, 0).r == 0.f);
+        CHECK(linear.GetPixel(128, 0).g == Catch::Approx(0.2158605f).epsilon(1e-5));
+        CHECK(linear.GetPixel(128, 0).a == Catch::Approx(128.f / 255.f));
+        CHECK(linear.GetPixel(255, 0).b == Catch::Approx(1.f));
+        CHECK(AreEqual(linear.Convert(Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb), codes));
+        CHECK(AreEqual(codes.Convert(Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Srgb)
+                           .Convert(Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb),
+                       codes));
+
+        // Encoding rounds to the nearest code of the transfer function
+        Fl::Image encoded(1, 1, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+        encoded.SetPixel(0, 0, {0.5f, 2.f, -1.f, 0.5f});
+        CHECK(encoded.GetRow(0)[0] == 188);
+        CHECK(encoded.GetRow(0)[1] == 255);
+        CHECK(encoded.GetRow(0)[2] == 0);
+        CHECK(encoded.GetRow(0)[3] == 128);
+
+        // Half floats round to nearest even and saturate
+        Fl::Image halves(4, 1, Fl::ImageFormat::RGBA16F);
+        halves.SetPixel(0, 0, {1.f / 3.f, -2.5f, 65504.f, 1e6f});
+        halves.SetPixel(1, 0, {1e-7f, 6.1035156e-5f, 1.f + 1.f / 2048.f, 1.f + 3.f / 2048.f});
+
+        const Fl::Color first = halves.GetPixel(0, 0);
+        CHECK(first.r == 0.333251953125f);
+        CHECK(first.g == -2.5f);
+        CHECK(first.b == 65504.f);
+        CHECK(first.a == 65504.f);
+
+        const Fl::Color second = halves.GetPixel(1, 0);
+        CHECK(second.r == std::ldexp(2.f, -24)); // Subnormal
+        CHECK(second.g == 6.1035156e-5f);
+        CHECK(second.b == 1.f);
+        CHECK(second.a == 1.f + 4.f / 2048.f);
+
+        // Floats convert to half and back exactly when they fit
+        const Fl::Image noise = GenerateNoise(37, 19, Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear);
+        const Fl::Image floats = noise.Convert(Fl::ImageFormat::RGBA32F, Fl::ColorSpace::Linear);
+        CHECK(AreEqual(floats.Convert(Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear), noise));
+
+        Fl::ThreadPool threadPool(3);
+        const Fl::Image large = GenerateNoise(300, 300, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+        CHECK(AreEqual(large.Convert(Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear, &threadPool),
+                       large.Convert(Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear)));
+    }
+
+    WHEN("Premultiplying alpha") {
+        Fl::Image image(2, 1, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Linear);
+        image.SetPixel(0, 0, {200.f / 255.f, 100.f / 255.f, 50.f / 255.f, 128.f / 255.f});
+        image.Premultiply();
+        CHECK(image.GetRow(0)[0] == 100);
+        CHECK(image.GetRow(0)[1] == 50);
+        CHECK(image.GetRow(0)[2] == 25);
+        CHECK(image.GetRow(0)[3] == 128);
+
+        // sRGB colors are premultiplied in linear space
+        Fl::Image srgb(1, 1, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+        srgb.SetPixel(0, 0, {1.f, 1.f, 1.f, 0.5f});
+        srgb.Premultiply();
+        CHECK(srgb.GetRow(0)[0] == 188);
+        CHECK(srgb.GetRow(0)[3] == 128);
+    }
+
+    WHEN("Generating mipmaps") {
+        // A checkerboard averages to half the light, not to half the sRGB code
+        Fl::Image checkerboard(64, 32, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+        for (Fl::UInt32 y = 0; y < 32; ++y) {
+            for (Fl::UInt32 x = 0; x < 64; ++x) {
+                std::memset(checkerboard.GetRow(y) + x * 4, ((x + y) % 2 == 0) ? 255 : 0, 3);
+                checkerboard.GetRow(y)[x * 4 + 3] = 255;
+            }
+        }
+
+        checkerboard.GenerateMipmaps();
+        REQUIRE(checkerboard.GetLevelCount() == 7);
+        for (Fl::UInt32 level = 1; level < checkerboard.GetLevelCount(); ++level) {
+            const Fl::UInt8* row = checkerboard.GetRow(checkerboard.GetHeight(level) - 1, level);
+            CHECK(row[0] == 188);
+            CHECK(row[3] == 255);
+        }
+
+        // Odd sizes average all the pixels covered by the destination ones
+        Fl::Image ramp(5, 3, Fl::ImageFormat::RGBA32F, Fl::ColorSpace::Linear);
+        for (Fl::UInt32 y = 0; y < 3; ++y) {
+            for (Fl::UInt32 x = 0; x < 5; ++x) {
+                ramp.SetPixel(x, y, {static_cast<float>(x), static_cast<float>(y), 0.f, 1.f});
+            }
+        }
+
+        ramp.GenerateMipmaps(Fl::ImageFilter::Box, 2);
+        REQUIRE(ramp.GetLevelCount() == 2);
+        CHECK(ramp.GetWidth(1) == 2);
+        CHECK(ramp.GetHeight(1) == 1);
+        CHECK(ramp.GetPixel(0, 0, 1).r == Catch::Approx(0.8f));
+        CHECK(ramp.GetPixel(1, 0, 1).r == Catch::Approx(3.2f));
+        CHECK(ramp.GetPixel(1, 0, 1).g == Catch::Approx(1.f));
+        CHECK(ramp.GetPixel(0, 0).r == 0.f);
+
+        // Windowed sincs keep flat areas flat
+        Fl::Image flat(40, 24, Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear);
+        for (Fl::UInt32 y = 0; y < 24; ++y) {
+            for (Fl::UInt32 x = 0; x < 40; ++x) {
+                flat.SetPixel(x, y, {0.25f, 0.5f, 0.75f, 1.f});
+            }
+        }
+
+        flat.GenerateMipmaps(Fl::ImageFilter::Kaiser);
+        const Fl::Color smallest = flat.GetPixel(0, 0, flat.GetLevelCount() - 1);
+        CHECK(smallest.r == Catch::Approx(0.25f).margin(1e-3));
+        CHECK(smallest.b == Catch::Approx(0.75f).margin(1e-3));
+
+        // Bands are independent, the thread pool doesn't change the result
+        Fl::ThreadPool threadPool(3);
+        for (Fl::ImageFilter filter : {Fl::ImageFilter::Box, Fl::ImageFilter::Kaiser}) {
+            Fl::Image noise = GenerateNoise(333, 257, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+            Fl::Image parallelNoise = noise;
+            noise.GenerateMipmaps(filter);
+            parallelNoise.GenerateMipmaps(filter, 0, &threadPool);
+
+            CHECK(noise.GetLevelCount() == 9);
+            CHECK(AreEqual(noise, parallelNoise));
+        }
+    }
+
+    WHEN("Resizing") {
+        Fl::Image ramp(8, 2, Fl::ImageFormat::RGBA32F, Fl::ColorSpace::Linear);
+        for (Fl::UInt32 y = 0; y < 2; ++y) {
+            for (Fl::UInt32 x = 0; x < 8; ++x) {
+                ramp.SetPixel(x, y, {static_cast<float>(x), 0.f, 0.f, 1.f});
+            }
+        }
+
+        // Linear interpolation reproduces the ramp away from the edges
+        const Fl::Image upsampled = ramp.Resize(32, 8, Fl::ImageFilter::Triangle);
+        for (Fl::UInt32 x = 2; x < 30; ++x) {
+            CHECK(upsampled.GetPixel(x, 5).r == Catch::Approx((x + 0.5f) / 4.f - 0.5f));
+        }
+
+        CHECK(upsampled.GetPixel(0, 0).r == 0.f);
+        CHECK(upsampled.GetPixel(31, 7).r == Catch::Approx(7.f));
+
+        const Fl::Image downsampled = ramp.Resize(2, 1, Fl::ImageFilter::Box);
+        CHECK(downsampled.GetPixel(0, 0).r == Catch::Approx(1.5f));
+        CHECK(downsampled.GetPixel(1, 0).r == Catch::Approx(5.5f));
+
+        for (Fl::ImageFilter filter : {Fl::ImageFilter::Kaiser, Fl::ImageFilter::Lanczos3}) {
+            const Fl::Image sharp = ramp.Resize(20, 5, filter);
+            CHECK(sharp.GetPixel(10, 2).r == Catch::Approx(ramp.Resize(20, 5, Fl::ImageFilter::Triangle)
+                                                               .GetPixel(10, 2).r).margin(0.05));
+            CHECK(sharp.GetPixel(10, 2).a == Catch::Approx(1.f));
+        }
+
+        Fl::ThreadPool threadPool(3);
+        const Fl::Image noise = GenerateNoise(640, 480, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+        for (const auto& [width, height] : {std::pair(300u, 200u), std::pair(1000u, 700u), std::pair(7u, 900u)}) {
+            const Fl::Image resized = noise.Resize(width, height, Fl::ImageFilter::Kaiser, &threadPool);
+            CHECK(resized.GetWidth() == width);
+            CHECK(resized.GetHeight() == height);
+            CHECK(AreEqual(resized, noise.Resize(width, height, Fl::ImageFilter::Kaiser)));
+        }
+    }
+
+    WHEN("Saving and loading files") {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path();
+        const std::string filePath = Fl::PathToString(directory / Fl::Utf8Path("FlashlightImage\xC3\xA9.pam"));
+
+        Fl::Image image = GenerateNoise(13, 7, Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Srgb);
+        REQUIRE(image.SaveToFile(filePath));
+
+        std::string errorMessage;
+        const std::optional<Fl::Image> loaded = Fl::Image::LoadFromFile(filePath, &errorMessage);
+        REQUIRE(loaded);
+        CHECK(errorMessage.empty());
+        CHECK(loaded->GetColorSpace() == Fl::ColorSpace::Srgb);
+        CHECK(AreEqual(*loaded, image.Convert(Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb)));
+        std::filesystem::remove(Fl::Utf8Path(filePath));
+
+        // PPM files have no alpha, their pixels are opaque
+        const std::string ppmPath = Fl::PathToString(directory / "FlashlightImage.ppm");
+        {
+            std::ofstream file(Fl::Utf8Path(ppmPath), std::ios::binary);
+            file << "P6\n# Comment\n2 1\n255\n";
+            file.write("\x10\x20\x30\x40\x50\x60", 6);
+        }
+
+        const std::optional<Fl::Image> ppm = Fl::Image::LoadFromFile(ppmPath);
+        REQUIRE(ppm);
+        CHECK(ppm->GetWidth() == 2);
+        CHECK(ppm->GetRow(0)[4] == 0x40);
+        CHECK(ppm->GetRow(0)[7] == 255);
+
+        {
+            std::ofstream file(Fl::Utf8Path(ppmPath), std::ios::binary);
+            file << "P6\n2 1\n255\n";
+            file.write("\x10\x20\x30", 3);
+        }
+
+        CHECK_FALSE(Fl::Image::LoadFromFile(ppmPath, &errorMessage));
+        CHECK(errorMessage == ppmPath + " is truncated.");
+        std::filesystem::remove(Fl::Utf8Path(ppmPath));
+
+        CHECK_FALSE(Fl::Image::LoadFromFile(ppmPath, &errorMessage));
+        CHECK(errorMessage == "Failed to open " + ppmPath + ".");
+    }
+}
+
+TEST_CASE("Image benchmarks", "[Image][.benchmark]") {
+    Fl::ThreadPool threadPool;
+
+    for (const auto& [width, height, name] : {std::tuple(3840u, 2160u, "4K"), std::tuple(7680u, 4320u, "8K")}) {
+        const std::string suffix = std::string(", ") + name;
+        const Fl::Image source = GenerateNoise(width, height, Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb);
+
+        // Reference: averaging sRGB codes directly, which is fast but darkens the mips
+        BENCHMARK("Naive sRGB box mipmaps" + suffix) {
+            std::vector<Fl::UInt8> previous(source.GetRow(0), source.GetRow(0) + source.GetRowPitch() * height);
+            Fl::UInt32 levelWidth = width;
+            Fl::UInt32 levelHeight = height;
+            while (levelWidth > 1 || levelHeight > 1) {
+                const Fl::UInt32 nextWidth = std::max(levelWidth / 2, 1u);
+                const Fl::UInt32 nextHeight = std::max(levelHeight / 2, 1u);
+                std::vector<Fl::UInt8> next(static_cast<std::size_t>(nextWidth) * nextHeight * 4);
+                for (Fl::UInt32 y = 0; y < nextHeight; ++y) {
+                    const std::size_t pitch = (levelWidth == width) ? source.GetRowPitch() : levelWidth * 4;
+                    const Fl::UInt8* rows[2] = {&previous[std::min(2 * y, levelHeight - 1) * pitch],
+                                                &previous[std::min(2 * y + 1, levelHeight - 1) * pitch]};
+                    for (Fl::UInt32 i = 0; i < nextWidth * 4; ++i) {
+                        const Fl::UInt32 x = (i / 4) * 2;
+                        const Fl::UInt32 x1 = std::min(x + 1, levelWidth - 1);
+                        const std::size_t channel = i % 4;
+                        next[y * nextWidth * 4 + i] = static_cast<Fl::UInt8>(
+                            (rows[0][x * 4 + channel] + rows[0][x1 * 4 + channel] + rows[1][x * 4 + channel] +
+                             rows[1][x1 * 4 + channel] + 2) / 4);
+                    }
+                }
+
+                previous = std::move(next);
+                levelWidth = nextWidth;
+                levelHeight = nextHeight;
+            }
+
+            return previous[0];
+        };
+
+        // Levels are allocated once, regenerating them doesn't reallocate the image
+        Fl::Image mipmapped = source;
+        mipmapped.GenerateMipmaps();
+
+        for (Fl::ImageFilter filter : {Fl::ImageFilter::Box, Fl::ImageFilter::Kaiser}) {
+            const std::string filterName = (filter == Fl::ImageFilter::Box) ? "box" : "Kaiser";
+
+            BENCHMARK("sRGB " + filterName + " mipmaps" + suffix) {
+                mipmapped.GenerateMipmaps(filter);
+                return mipmapped.GetRow(0, 1)[0];
+            };
+
+            BENCHMARK("sRGB " + filterName + " mipmaps, thread pool" + suffix) {
+                mipmapped.GenerateMipmaps(filter, 0, &threadPool);
+                return mipmapped.GetRow(0, 1)[0];
+            };
+        }
+
+        BENCHMARK("Kaiser resize to 1080p, thread pool" + suffix) {
+            return source.Resize(1920, 1080, Fl::ImageFilter::Kaiser, &threadPool).GetWidth();
+        };
+
+        Fl::Image premultiplied = source;
+        BENCHMARK("Premultiply, thread pool" + suffix) {
+            premultiplied.Premultiply(&threadPool);
+            return premultiplied.GetRow(0)[0];
+        };
+
+        const Fl::Image halves = source.Convert(Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear);
+        BENCHMARK("RGBA8 sRGB to RGBA16F, thread pool" + suffix) {
+            return source.Convert(Fl::ImageFormat::RGBA16F, Fl::ColorSpace::Linear, &threadPool).GetWidth();
+        };
+
+        BENCHMARK("RGBA16F to RGBA32F, thread pool" + suffix) {
+            return halves.Convert(Fl::ImageFormat::RGBA32F, Fl::ColorSpace::Linear, &threadPool).GetWidth();
+        };
+
+        BENCHMARK("RGBA16F to RGBA8 sRGB, thread pool" + suffix) {
+            return halves.Convert(Fl::ImageFormat::RGBA8, Fl::ColorSpace::Srgb, &threadPool).GetWidth();
+        };
+    }
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Math/Matrix4.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <numbers>
+
+SCENARIO("Matrix4", "[Matrix4]") {
+    const Fl::Quaternion quarterTurn =
+        Fl::Quaternion::FromAxisAngle(Fl::Vector3::UnitZ(), std::numbers::pi_v<float> / 2.f);
+
+    WHEN("Rotating vectors") {
+        CHECK((quarterTurn * Fl::Vector3::UnitX()).ApproxEqual(Fl::Vector3::UnitY()));
+        CHECK((quarterTurn * quarterTurn * Fl::Vector3::UnitX()).ApproxEqual(-Fl::Vector3::UnitX()));
+        CHECK((quarterTurn * quarterTurn.GetConjugate()).ApproxEqual(Fl::Quaternion::Identity()));
+    }
+
+    WHEN("Building transform matrices") {
+        const Fl::Matrix4 matrix = Fl::Matrix4::FromTransform({1.f, 2.f, 3.f}, quarterTurn, Fl::Vector3(2.f));
+
+        // Scale, then rotate, then translate
+        CHECK(matrix.TransformPoint(Fl::Vector3::UnitX()).ApproxEqual({1.f, 4.f, 3.f}));
+        CHECK(matrix.TransformPoint(Fl::Vector3::UnitZ()).ApproxEqual({1.f, 2.f, 5.f}));
+        CHECK(matrix.GetTranslation() == Fl::Vector3(1.f, 2.f, 3.f));
+        CHECK(matrix.GetElement(3, 3) == 1.f);
+
+        const Fl::Matrix4 identity =
+            Fl::Matrix4::FromTransform(Fl::Vector3::Zero(), Fl::Quaternion::Identity(), Fl::Vector3::Unit());
+        CHECK(identity.ApproxEqual(Fl::Matrix4::Identity()));
+    }
+
+    WHEN("Multiplying matrices") {
+        const Fl::Matrix4 translation = Fl::Matrix4::Translate({10.f, 0.f, 0.f});
+        const Fl::Matrix4 rotation = Fl::Matrix4::FromTransform(Fl::Vector3::Zero(), quarterTurn, Fl::Vector3::Unit());
+
+        // Rotation is applied first
+        const Fl::Matrix4 combined = translation * rotation;
+        CHECK(combined.TransformPoint(Fl::Vector3::UnitX()).ApproxEqual({10.f, 1.f, 0.f}));
+        CHECK((rotation * translation).TransformPoint(Fl::Vector3::UnitX()).ApproxEqual({0.f, 11.f, 0.f}));
+        CHECK((combined * Fl::Matrix4::Identity()).ApproxEqual(combined));
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Math/SimdFloat4.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+namespace {
+    std::array<float, 4> ToArray(const Fl::SimdFloat4& vec) {
+        std::array<float, 4> values;
+        vec.Store(values.data());
+
+        return values;
+    }
+}
+
+SCENARIO("SimdFloat4", "[SimdFloat4]") {
+    const Fl::SimdFloat4 a(1.f, -2.f, 3.f, -4.f);
+    const Fl::SimdFloat4 b(4.f, 3.f, 2.f, 1.f);
+
+    WHEN("Doing arithmetic") {
+        CHECK(ToArray(a + b) == std::array{5.f, 1.f, 5.f, -3.f});
+        CHECK(ToArray(a - b) == std::array{-3.f, -5.f, 1.f, -5.f});
+        CHECK(ToArray(a * b) == std::array{4.f, -6.f, 6.f, -4.f});
+        CHECK(ToArray(a / b) == std::array{0.25f, -2.f / 3.f, 1.5f, -4.f});
+        CHECK(ToArray(-a) == std::array{-1.f, 2.f, -3.f, 4.f});
+        CHECK(ToArray(Fl::SimdFloat4::MultiplyAdd(a, b, Fl::SimdFloat4::Splat(1.f))) ==
+              std::array{5.f, -5.f, 7.f, -3.f});
+        CHECK(ToArray(Fl::SimdFloat4::Abs(a)) == std::array{1.f, 2.f, 3.f, 4.f});
+        CHECK(ToArray(Fl::SimdFloat4::Sqrt(b * b)) == std::array{4.f, 3.f, 2.f, 1.f});
+        CHECK(ToArray(Fl::SimdFloat4::Min(a, b)) == std::array{1.f, -2.f, 2.f, -4.f});
+        CHECK(ToArray(Fl::SimdFloat4::Max(a, b)) == std::array{4.f, 3.f, 3.f, 1.f});
+        CHECK(a.HorizontalSum() == -2.f);
+    }
+
+    WHEN("Accessing lanes") {
+        CHECK(a.GetX() == 1.f);
+        CHECK(a.GetLane(3) == -4.f);
+        CHECK(ToArray(a.Broadcast<2>()) == std::array{3.f, 3.f, 3.f, 3.f});
+        CHECK(ToArray(a.ShiftLanesUp<1>()) == std::array{0.f, 1.f, -2.f, 3.f});
+        CHECK(ToArray(a.ShiftLanesUp<3>()) == std::array{0.f, 0.f, 0.f, 1.f});
+        CHECK(ToArray(Fl::SimdFloat4::Zero()) == std::array{0.f, 0.f, 0.f, 0.f});
+
+        alignas(16) float values[4] = {5.f, 6.f, 7.f, 8.f};
+        CHECK(ToArray(Fl::SimdFloat4::LoadAligned(values)) == std::array{5.f, 6.f, 7.f, 8.f});
+    }
+
+    WHEN("Comparing and selecting") {
+        const Fl::SimdFloat4 less = Fl::SimdFloat4::Less(a, b);
+        CHECK(less.GetMoveMask() == 0b1011);
+        CHECK(Fl::SimdFloat4::LessEqual(a, a).GetMoveMask() == 0b1111);
+        CHECK(Fl::SimdFloat4::Greater(a, b).GetMoveMask() == 0b0100);
+        CHECK(Fl::SimdFloat4::GreaterEqual(b, a).GetMoveMask() == 0b1011);
+        CHECK(Fl::SimdFloat4::Equal(a, b).GetMoveMask() == 0);
+        CHECK(ToArray(Fl::SimdFloat4::Select(less, a, b)) == std::array{1.f, -2.f, 2.f, -4.f});
+        CHECK((less & Fl::SimdFloat4::Less(a, Fl::SimdFloat4::Zero())).GetMoveMask() == 0b1010);
+        CHECK((less | Fl::SimdFloat4::Greater(a, b)).GetMoveMask() == 0b1111);
+        CHECK((less ^ less).GetMoveMask() == 0);
+        CHECK(Fl::SimdFloat4::AndNot(less, Fl::SimdFloat4::Less(a, Fl::SimdFloat4::Splat(10.f))).GetMoveMask() ==
+              0b0100);
+    }
+}
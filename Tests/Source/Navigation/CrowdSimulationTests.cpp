@@ -0,0 +1,241 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Navigation/CrowdSimulation.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr float DeltaTime = 1.0f / 30.0f;
+
+    // Heads to the goals at full speed, slowing down on the last meter
+    void SetPreferredVelocities(Fl::CrowdSimulation& crowd, const std::vector<Fl::Vector3>& goals,
+                                std::mt19937* perturbation = nullptr) {
+        std::uniform_real_distribution<float> offsets(-0.01f, 0.01f);
+        for (Fl::UInt32 agent = 0; agent < crowd.GetAgentCount(); ++agent) {
+            Fl::Vector3 offset = goals[agent] - crowd.GetPosition(agent);
+            offset.y = 0.0f;
+
+            const float distance = offset.GetLength();
+            const float speed = crowd.GetMaxSpeed(agent) * std::min(distance, 1.0f);
+            Fl::Vector3 velocity = (distance > 0.0f) ? offset * (speed / distance) : Fl::Vector3::Zero();
+
+            // Breaks the symmetric configurations where all agents wait for each other
+            if (perturbation) {
+                velocity.x += offsets(*perturbation);
+                velocity.z += offsets(*perturbation);
+            }
+
+            crowd.SetPreferredVelocity(agent, velocity);
+        }
+    }
+
+    float GetPlanarDistance(const Fl::Vector3& lhs, const Fl::Vector3& rhs) {
+        return std::hypot(lhs.x - rhs.x, lhs.z - rhs.z);
+    }
+
+    std::vector<Fl::Vector3> AddRandomAgents(Fl::CrowdSimulation& crowd, const std::size_t count, const float size,
+                                             std::mt19937& rng) {
+        std::uniform_real_distribution<float> positions(0.0f, size);
+        std::uniform_real_distribution<float> radii(0.3f, 0.6f);
+        std::uniform_real_distribution<float> speeds(1.0f, 2.0f);
+
+        std::vector<Fl::Vector3> goals;
+        for (std::size_t i = 0; i < count; ++i) {
+            crowd.AddAgent({positions(rng), 1.0f, positions(rng)}, radii(rng), speeds(rng));
+            goals.emplace_back(positions(rng), 0.0f, positions(rng));
+        }
+
+        return goals;
+    }
+} // namespace
+
+SCENARIO("CrowdSimulation", "[Navigation][CrowdSimulation]") {
+    GIVEN("Two agents walking toward each other") {
+        Fl::CrowdSimulation crowd;
+        const Fl::UInt32 first = crowd.AddAgent({-5.0f, 2.0f, 0.0f}, 0.5f, 1.5f);
+        const Fl::UInt32 second = crowd.AddAgent({5.0f, 2.0f, 0.0f}, 0.5f, 1.5f);
+        const std::vector<Fl::Vector3> goals = {{5.0f, 2.0f, 0.0f}, {-5.0f, 2.0f, 0.0f}};
+
+        WHEN("Simulating their crossing") {
+            float minDistance = std::numeric_limits<float>::infinity();
+            bool haveMet = false;
+            for (int step = 0; step < 300; ++step) {
+                SetPreferredVelocities(crowd, goals);
+                crowd.Step(DeltaTime);
+
+                minDistance = std::min(minDistance, GetPlanarDistance(crowd.GetPosition(first),
+                                                                      crowd.GetPosition(second)));
+                haveMet = haveMet || !crowd.GetNeighbors(first).empty();
+            }
+
+            THEN("They avoid each other and reach their goals") {
+                CHECK(haveMet);
+                CHECK(minDistance >= 0.99f);
+                CHECK(GetPlanarDistance(crowd.GetPosition(first), goals[first]) < 0.1f);
+                CHECK(GetPlanarDistance(crowd.GetPosition(second), goals[second]) < 0.1f);
+                CHECK(crowd.GetPosition(first).y == 2.0f);
+                CHECK(crowd.GetStatistics().agentCount == 2);
+            }
+        }
+    }
+
+    GIVEN("Agents on a circle heading to the opposite side") {
+        constexpr std::size_t AgentCount = 48;
+        constexpr float CircleRadius = 15.0f;
+
+        Fl::CrowdSimulation crowd;
+        std::vector<Fl::Vector3> goals;
+        for (std::size_t i = 0; i < AgentCount; ++i) {
+            const float angle = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / AgentCount;
+            const Fl::Vector3 position = {CircleRadius * std::cos(angle), 0.0f, CircleRadius * std::sin(angle)};
+            crowd.AddAgent(position, 0.5f, 2.0f);
+            goals.push_back(-position);
+        }
+
+        WHEN("Simulating them") {
+            std::mt19937 rng(3);
+            float minClearance = std::numeric_limits<float>::infinity();
+            for (int step = 0; step < 900; ++step) {
+                SetPreferredVelocities(crowd, goals, &rng);
+                crowd.Step(DeltaTime);
+
+                for (Fl::UInt32 i = 0; i < AgentCount; ++i) {
+                    for (Fl::UInt32 j = i + 1; j < AgentCount; ++j) {
+                        const float distance = GetPlanarDistance(crowd.GetPosition(i), crowd.GetPosition(j));
+                        minClearance = std::min(minClearance, distance - crowd.GetRadius(i) - crowd.GetRadius(j));
+                    }
+                }
+            }
+
+            THEN("They never overlap significantly and all arrive") {
+                CHECK(minClearance > -0.05f);
+                for (Fl::UInt32 agent = 0; agent < AgentCount; ++agent) {
+                    CHECK(GetPlanarDistance(crowd.GetPosition(agent), goals[agent]) < 0.5f);
+                }
+            }
+        }
+    }
+
+    GIVEN("Many agents in a small hash") {
+        Fl::CrowdSimulation::Settings settings;
+        settings.neighborDistance = 3.0f;
+        settings.maxNeighbors = 6;
+        settings.bucketCount = 64; // Distant cells share buckets
+
+        std::mt19937 rng(11);
+        Fl::CrowdSimulation crowd(settings);
+        const std::vector<Fl::Vector3> goals = AddRandomAgents(crowd, 2000, 60.0f, rng);
+
+        WHEN("Stepping") {
+            std::vector<Fl::Vector3> positions;
+            for (Fl::UInt32 agent = 0; agent < crowd.GetAgentCount(); ++agent) {
+                positions.push_back(crowd.GetPosition(agent));
+            }
+
+            SetPreferredVelocities(crowd, goals);
+            crowd.Step(DeltaTime);
+
+            THEN("Each agent avoids its nearest neighbors, nearest first") {
+                const float rangeSq = settings.neighborDistance * settings.neighborDistance;
+                std::size_t neighborCount = 0;
+                for (Fl::UInt32 agent = 0; agent < positions.size(); ++agent) {
+                    std::vector<std::pair<float, Fl::UInt32>> candidates;
+                    for (Fl::UInt32 other = 0; other < positions.size(); ++other) {
+                        const float offsetX = positions[other].x - positions[agent].x;
+                        const float offsetZ = positions[other].z - positions[agent].z;
+                        const float distanceSq = offsetX * offsetX + offsetZ * offsetZ;
+                        if (other != agent && distanceSq < rangeSq) {
+                            candidates.emplace_back(distanceSq, other);
+                        }
+                    }
+
+                    std::sort(candidates.begin(), candidates.end());
+                    candidates.resize(std::min<std::size_t>(candidates.size(), settings.maxNeighbors));
+
+                    std::vector<Fl::UInt32> expected;
+                    for (const auto& candidate : candidates) {
+                        expected.push_back(candidate.second);
+                    }
+
+                    const std::span<const Fl::UInt32> neighbors = crowd.GetNeighbors(agent);
+                    REQUIRE(std::vector<Fl::UInt32>(neighbors.begin(), neighbors.end()) == expected);
+                    neighborCount += expected.size();
+                }
+
+                CHECK(crowd.GetStatistics().neighborCount == neighborCount);
+                CHECK(neighborCount > positions.size());
+            }
+        }
+    }
+
+    GIVEN("The same crowd simulated in several ways") {
+        const auto simulate = [](Fl::ThreadPool* threadPool, const bool useSimd) {
+            Fl::CrowdSimulation::Settings settings;
+            settings.useSimd = useSimd;
+
+            std::mt19937 rng(5);
+            Fl::CrowdSimulation crowd(settings);
+            const std::vector<Fl::Vector3> goals = AddRandomAgents(crowd, 3000, 80.0f, rng);
+            for (int step = 0; step < 30; ++step) {
+                SetPreferredVelocities(crowd, goals);
+                crowd.Step(DeltaTime, threadPool);
+            }
+
+            std::vector<Fl::Vector3> state;
+            for (Fl::UInt32 agent = 0; agent < crowd.GetAgentCount(); ++agent) {
+                state.push_back(crowd.GetPosition(agent));
+                state.push_back(crowd.GetVelocity(agent));
+            }
+
+            return state;
+        };
+
+        WHEN("Changing the thread count and the path") {
+            Fl::ThreadPool threadPool(3);
+            const std::vector<Fl::Vector3> state = simulate(nullptr, true);
+
+            THEN("The results are the same") {
+                CHECK(simulate(nullptr, true) == state);
+                CHECK(simulate(&threadPool, true) == state);
+                CHECK(simulate(nullptr, false) == state);
+                CHECK(simulate(&threadPool, false) == state);
+            }
+        }
+    }
+}
+
+TEST_CASE("CrowdSimulation benchmarks", "[Navigation][.benchmark]") {
+    constexpr std::size_t AgentCount = 50'000;
+
+    Fl::ThreadPool threadPool;
+    for (const bool isParallel : {false, true}) {
+        std::mt19937 rng(42);
+        Fl::CrowdSimulation crowd;
+        crowd.Reserve(AgentCount);
+        const std::vector<Fl::Vector3> goals = AddRandomAgents(crowd, AgentCount, 700.0f, rng);
+        SetPreferredVelocities(crowd, goals);
+
+        const std::string name = std::string("50K agents step") + (isParallel ? ", thread pool" : "");
+        BENCHMARK(std::string(name)) {
+            crowd.Step(DeltaTime, isParallel ? &threadPool : nullptr);
+            return crowd.GetStatistics().neighborCount;
+        };
+
+        const Fl::CrowdSimulation::Statistics& statistics = crowd.GetStatistics();
+        const double hashTime = std::chrono::duration<double, std::milli>(statistics.hashTime).count();
+        const double solveTime = std::chrono::duration<double, std::milli>(statistics.solveTime).count();
+        WARN(name << ": hash " << hashTime << " ms, solve " << solveTime << " ms (budget at 30 Hz: 33.3 ms)");
+    }
+}
@@ -0,0 +1,316 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Navigation/NavigationGrid.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace {
+    // Cost of a corridor, checking that its cells are walkable neighbors which don't cut corners
+    float GetCorridorCost(const Fl::NavigationGrid& grid, const std::vector<Fl::UInt32>& corridor) {
+        const Fl::UInt32 width = grid.GetWidth();
+
+        float cost = 0.0f;
+        for (std::size_t i = 0; i < corridor.size(); ++i) {
+            const Fl::UInt32 x = corridor[i] % width;
+            const Fl::UInt32 z = corridor[i] / width;
+            REQUIRE(grid.GetCellCost(x, z) != Fl::NavigationGrid::BlockedCell);
+            if (i == 0) {
+                continue;
+            }
+
+            const Fl::UInt32 previousX = corridor[i - 1] % width;
+            const Fl::UInt32 previousZ = corridor[i - 1] / width;
+            const auto dx = static_cast<int>(x) - static_cast<int>(previousX);
+            const auto dz = static_cast<int>(z) - static_cast<int>(previousZ);
+            REQUIRE(std::abs(dx) <= 1);
+            REQUIRE(std::abs(dz) <= 1);
+            REQUIRE((dx != 0 || dz != 0));
+
+            const bool isDiagonal = dx != 0 && dz != 0;
+            if (isDiagonal) {
+                REQUIRE(grid.GetCellCost(x, previousZ) != Fl::NavigationGrid::BlockedCell);
+                REQUIRE(grid.GetCellCost(previousX, z) != Fl::NavigationGrid::BlockedCell);
+            }
+
+            const float length = isDiagonal ? std::numbers::sqrt2_v<float> : 1.0f;
+            cost += length * 0.5f * static_cast<float>(grid.GetCellCost(x, z) + grid.GetCellCost(previousX, previousZ));
+        }
+
+        return cost;
+    }
+
+    // Optimal cost over the whole grid, infinity when unreachable
+    float FindOptimalCost(const Fl::NavigationGrid& grid, const Fl::UInt32 start, const Fl::UInt32 goal) {
+        const Fl::UInt32 width = grid.GetWidth();
+        const Fl::UInt32 depth = grid.GetDepth();
+        const auto isWalkable = [&](const Fl::UInt32 x, const Fl::UInt32 z) {
+            return x < width && z < depth && grid.GetCellCost(x, z) != Fl::NavigationGrid::BlockedCell;
+        };
+
+        Fl::AStarSearch search;
+        search.Search(
+            static_cast<std::size_t>(width) * depth, start, Fl::AStarSearch::InvalidNode,
+            [&](const Fl::UInt32 cell, auto&& visit) {
+                const Fl::UInt32 x = cell % width;
+                const Fl::UInt32 z = cell / width;
+                for (int dz = -1; dz <= 1; ++dz) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        const Fl::UInt32 neighborX = x + static_cast<Fl::UInt32>(dx);
+                        const Fl::UInt32 neighborZ = z + static_cast<Fl::UInt32>(dz);
+                        if ((dx == 0 && dz == 0) || !isWalkable(neighborX, neighborZ) ||
+                            (dx != 0 && dz != 0 && (!isWalkable(neighborX, z) || !isWalkable(x, neighborZ)))) {
+                            continue;
+                        }
+
+                        const float length = (dx != 0 && dz != 0) ? std::numbers::sqrt2_v<float> : 1.0f;
+                        visit(grid.GetCell(neighborX, neighborZ),
+                              length * 0.5f *
+                                  static_cast<float>(grid.GetCellCost(x, z) + grid.GetCellCost(neighborX, neighborZ)));
+                    }
+                }
+            },
+            [](Fl::UInt32) { return 0.0f; });
+
+        return search.GetCost(goal);
+    }
+
+    Fl::NavigationGrid::Settings MakeSettings(const Fl::UInt32 width, const Fl::UInt32 depth) {
+        Fl::NavigationGrid::Settings settings;
+        settings.width = width;
+        settings.depth = depth;
+        settings.clusterSize = 8;
+        settings.cellSize = 0.5f;
+        settings.origin = {-10.0f, 1.0f, 4.0f};
+        return settings;
+    }
+} // namespace
+
+SCENARIO("AStarSearch", "[Navigation][AStarSearch]") {
+    GIVEN("A line graph with a shortcut") {
+        // 0 - 1 - 2 - 3 - 4, with 0 - 4 costing more than going through the line
+        const auto forEachNeighbor = [](const Fl::UInt32 node, auto&& visit) {
+            if (node > 0) {
+                visit(node - 1, 1.0f);
+            }
+
+            if (node < 4) {
+                visit(node + 1, 1.0f);
+            }
+
+            if (node == 0 || node == 4) {
+                visit(4 - node, 5.0f);
+            }
+        };
+
+        WHEN("Searching the line end to end several times") {
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> path;
+            for (int i = 0; i < 3; ++i) {
+                REQUIRE(search.Search(5, 0, 4, forEachNeighbor, [](const Fl::UInt32 node) {
+                    return static_cast<float>(4 - node);
+                }));
+            }
+
+            search.GetPath(4, path);
+
+            THEN("The cheapest path is found") {
+                CHECK(search.GetCost(4) == 4.0f);
+                CHECK(path == std::vector<Fl::UInt32>{0, 1, 2, 3, 4});
+                CHECK(search.GetExpandedNodeCount() == 4);
+            }
+        }
+
+        WHEN("Searching without goal") {
+            Fl::AStarSearch search;
+            const auto heuristic = [](Fl::UInt32) { return 0.0f; };
+            REQUIRE(search.Search(6, 2, Fl::AStarSearch::InvalidNode, forEachNeighbor, heuristic));
+
+            THEN("The cost of every reachable node is known") {
+                CHECK(search.GetCost(0) == 2.0f);
+                CHECK(search.GetCost(4) == 2.0f);
+                CHECK(std::isinf(search.GetCost(5)));
+            }
+        }
+    }
+}
+
+SCENARIO("NavigationGrid", "[Navigation][NavigationGrid]") {
+    GIVEN("A grid with a wall pierced by a gap") {
+        // Wall along Z at x = 20, open at z = 30
+        Fl::NavigationGrid grid(MakeSettings(45, 37));
+        for (Fl::UInt32 z = 0; z < grid.GetDepth(); ++z) {
+            if (z != 30) {
+                grid.SetCellCost(20, z, Fl::NavigationGrid::BlockedCell);
+            }
+        }
+
+        // Expensive area on the way
+        for (Fl::UInt32 z = 0; z < 10; ++z) {
+            for (Fl::UInt32 x = 5; x < 15; ++x) {
+                grid.SetCellCost(x, z, 4);
+            }
+        }
+
+        grid.Update();
+
+        THEN("Clusters cover the grid and have entrances") {
+            CHECK(grid.GetClusterCount() == 6 * 5);
+            CHECK(grid.GetRegionCount() == grid.GetClusterCount());
+            CHECK(grid.GetEntranceCount() > 0);
+        }
+
+        WHEN("Finding nodes") {
+            THEN("Positions map to their walkable cell") {
+                CHECK(grid.FindNode({-10.0f + 0.75f, 0.0f, 4.0f + 1.25f}) == grid.GetCell(1, 2));
+                CHECK(grid.FindNode({-10.0f + 10.25f, 0.0f, 4.0f + 0.25f}) == Fl::NavigationGraph::InvalidNode);
+                CHECK(grid.FindNode({-10.5f, 0.0f, 5.0f}) == Fl::NavigationGraph::InvalidNode);
+                CHECK(grid.FindNode({100.0f, 0.0f, 5.0f}) == Fl::NavigationGraph::InvalidNode);
+
+                const Fl::Vector3 center = grid.GetCellCenter(grid.GetCell(1, 2));
+                CHECK(center == Fl::Vector3(-10.0f + 0.75f, 1.0f, 4.0f + 1.25f));
+            }
+        }
+
+        WHEN("Finding a corridor through the wall") {
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> corridor;
+            const Fl::UInt32 start = grid.GetCell(2, 3);
+            const Fl::UInt32 goal = grid.GetCell(40, 2);
+            REQUIRE(grid.FindCorridor(start, goal, search, corridor));
+
+            THEN("It goes through the gap, close to the optimal cost") {
+                REQUIRE(corridor.front() == start);
+                REQUIRE(corridor.back() == goal);
+                CHECK(std::find(corridor.begin(), corridor.end(), grid.GetCell(20, 30)) != corridor.end());
+
+                const float cost = GetCorridorCost(grid, corridor);
+                const float optimalCost = FindOptimalCost(grid, start, goal);
+                CHECK(cost >= optimalCost - 1e-3f);
+                CHECK(cost <= optimalCost * 1.15f);
+            }
+
+            AND_WHEN("Building the path") {
+                std::vector<Fl::Vector3> path;
+                const Fl::Vector3 startPosition = {-8.9f, 1.0f, 5.6f};
+                const Fl::Vector3 goalPosition = {10.1f, 1.0f, 5.2f};
+                grid.BuildPath(corridor, startPosition, goalPosition, path);
+
+                THEN("It starts and ends at the given positions, turning at cell centers") {
+                    REQUIRE(path.size() >= 4);
+                    CHECK(path.front() == startPosition);
+                    CHECK(path.back() == goalPosition);
+                    CHECK(std::find(path.begin(), path.end(), grid.GetCellCenter(grid.GetCell(20, 30))) == path.end());
+                    for (std::size_t i = 1; i + 1 < path.size(); ++i) {
+                        CHECK(grid.FindNode(path[i]) != Fl::NavigationGraph::InvalidNode);
+                    }
+                }
+            }
+        }
+
+        WHEN("Finding corridors inside a cluster and to the same cell") {
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> corridor;
+
+            THEN("They are direct") {
+                REQUIRE(grid.FindCorridor(grid.GetCell(1, 1), grid.GetCell(4, 4), search, corridor));
+                CHECK(corridor.size() == 4);
+
+                REQUIRE(grid.FindCorridor(grid.GetCell(1, 1), grid.GetCell(1, 1), search, corridor));
+                CHECK(corridor == std::vector<Fl::UInt32>{grid.GetCell(1, 1)});
+            }
+        }
+
+        WHEN("Closing the gap") {
+            const Fl::UInt64 version = grid.GetVersion();
+            const Fl::NavigationGraph::RegionId gapCluster = grid.GetRegion(grid.GetCell(20, 30));
+            const Fl::UInt64 gapVersion = grid.GetRegionVersion(gapCluster);
+            const Fl::UInt64 otherVersion = grid.GetRegionVersion(0);
+
+            grid.SetCellCost(20, 30, Fl::NavigationGrid::BlockedCell);
+            grid.Update();
+
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> corridor;
+
+            THEN("The sides are disconnected and only the changed cluster is invalidated") {
+                CHECK_FALSE(grid.FindCorridor(grid.GetCell(2, 3), grid.GetCell(40, 2), search, corridor));
+                CHECK(corridor.empty());
+                CHECK(grid.GetRegionVersion(gapCluster) == gapVersion + 1);
+                CHECK(grid.GetRegionVersion(0) == otherVersion);
+                CHECK(grid.GetVersion() == version);
+            }
+
+            AND_WHEN("Opening it again") {
+                grid.SetCellCost(20, 30, 1);
+                grid.Update();
+
+                THEN("Paths are found again, and every path may have shortened") {
+                    CHECK(grid.FindCorridor(grid.GetCell(2, 3), grid.GetCell(40, 2), search, corridor));
+                    CHECK(grid.GetVersion() > version);
+                }
+            }
+        }
+    }
+
+    GIVEN("Random grids") {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> costs(0, 9);
+
+        for (int test = 0; test < 4; ++test) {
+            Fl::NavigationGrid::Settings settings = MakeSettings(50, 41);
+            settings.clusterSize = 6 + 2 * static_cast<Fl::UInt32>(test);
+
+            // A fifth of the cells are blocked, the others cost 1 or more
+            std::vector<Fl::UInt8> cellCosts(static_cast<std::size_t>(settings.width) * settings.depth);
+            for (Fl::UInt8& cost : cellCosts) {
+                const int value = costs(rng);
+                cost = static_cast<Fl::UInt8>((value < 2) ? Fl::NavigationGrid::BlockedCell : (value < 7 ? 1 : value));
+            }
+
+            Fl::ThreadPool threadPool(3);
+            const Fl::NavigationGrid grid(settings, cellCosts, &threadPool);
+
+            WHEN("Finding corridors between random cells") {
+                Fl::AStarSearch search;
+                std::vector<Fl::UInt32> corridor;
+                std::uniform_int_distribution<Fl::UInt32> cells(0, static_cast<Fl::UInt32>(cellCosts.size() - 1));
+
+                THEN("They are found when a path exists, and close to optimal") {
+                    float costRatioSum = 0.0f;
+                    int foundCount = 0;
+                    for (int query = 0; query < 40; ++query) {
+                        const Fl::UInt32 start = cells(rng);
+                        const Fl::UInt32 goal = cells(rng);
+                        const float optimalCost = FindOptimalCost(grid, start, goal);
+                        const bool isFound = grid.FindCorridor(start, goal, search, corridor);
+
+                        const bool isWalkable = cellCosts[start] != 0 && cellCosts[goal] != 0;
+                        REQUIRE(isFound == (isWalkable && std::isfinite(optimalCost)));
+                        if (isFound) {
+                            CHECK(corridor.front() == start);
+                            CHECK(corridor.back() == goal);
+
+                            const float cost = GetCorridorCost(grid, corridor);
+                            CHECK(cost >= optimalCost - 1e-3f);
+                            CHECK(cost <= optimalCost * 1.4f + 2.0f);
+                            costRatioSum += cost / std::max(optimalCost, 1.0f);
+                            ++foundCount;
+                        }
+                    }
+
+                    // Detours through the clusters chosen by the abstract search are rare
+                    CHECK(costRatioSum <= 1.15f * static_cast<float>(foundCount));
+                }
+            }
+        }
+    }
+}
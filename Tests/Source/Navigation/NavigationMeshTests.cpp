@@ -0,0 +1,174 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Navigation/NavigationMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+    struct MeshData {
+        std::vector<Fl::Vector3> vertices;
+        std::vector<Fl::UInt32> indices;
+        std::vector<Fl::UInt32> polygonSizes;
+        std::vector<Fl::UInt32> cellPolygons; //< Polygon of each cell, or InvalidNode
+    };
+
+    // One unit quad per '#' of the rows (row z covering [z, z + 1]), heights rising by slope along Z
+    MeshData MakeMesh(const std::vector<std::string>& rows, const float slope = 0.0f) {
+        const auto width = static_cast<Fl::UInt32>(rows[0].size());
+        const auto depth = static_cast<Fl::UInt32>(rows.size());
+
+        MeshData mesh;
+        for (Fl::UInt32 z = 0; z <= depth; ++z) {
+            for (Fl::UInt32 x = 0; x <= width; ++x) {
+                mesh.vertices.push_back({static_cast<float>(x), slope * static_cast<float>(z), static_cast<float>(z)});
+            }
+        }
+
+        const auto getVertex = [&](const Fl::UInt32 x, const Fl::UInt32 z) { return z * (width + 1) + x; };
+        for (Fl::UInt32 z = 0; z < depth; ++z) {
+            for (Fl::UInt32 x = 0; x < width; ++x) {
+                if (rows[z][x] != '#') {
+                    mesh.cellPolygons.push_back(Fl::NavigationGraph::InvalidNode);
+                    continue;
+                }
+
+                // Counter-clockwise seen from above
+                mesh.cellPolygons.push_back(static_cast<Fl::UInt32>(mesh.polygonSizes.size()));
+                mesh.indices.insert(mesh.indices.end(), {getVertex(x, z + 1), getVertex(x + 1, z + 1),
+                                                         getVertex(x + 1, z), getVertex(x, z)});
+                mesh.polygonSizes.push_back(4);
+            }
+        }
+
+        return mesh;
+    }
+
+    bool AreClose(const Fl::Vector3& lhs, const Fl::Vector3& rhs) {
+        return (lhs - rhs).GetLength() < 1e-4f;
+    }
+} // namespace
+
+SCENARIO("NavigationMesh", "[Navigation][NavigationMesh]") {
+    GIVEN("An L-shaped ramp") {
+        const std::vector<std::string> rows = {
+            "#####",
+            "....#",
+            "....#",
+            "....#",
+            "....#",
+        };
+        const MeshData data = MakeMesh(rows, 0.1f);
+        Fl::NavigationMesh mesh(data.vertices, data.indices, data.polygonSizes);
+
+        const auto getPolygon = [&](const Fl::UInt32 x, const Fl::UInt32 z) { return data.cellPolygons[z * 5 + x]; };
+
+        THEN("Polygons and their centers are known") {
+            CHECK(mesh.GetPolygonCount() == 9);
+            CHECK(mesh.GetRegionCount() == 9);
+            CHECK(AreClose(mesh.GetPolygonCenter(getPolygon(4, 2)), {4.5f, 0.25f, 2.5f}));
+        }
+
+        WHEN("Finding nodes") {
+            THEN("Positions map to the polygon below them") {
+                CHECK(mesh.FindNode({2.5f, 0.0f, 0.5f}) == getPolygon(2, 0));
+                CHECK(mesh.FindNode({4.2f, 0.3f, 3.7f}) == getPolygon(4, 3));
+                CHECK(mesh.FindNode({2.5f, 0.0f, 2.5f}) == Fl::NavigationGraph::InvalidNode);
+                CHECK(mesh.FindNode({-1.0f, 0.0f, 0.5f}) == Fl::NavigationGraph::InvalidNode);
+            }
+        }
+
+        WHEN("Finding a path around the corner") {
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> corridor;
+            const Fl::Vector3 start = {0.5f, 0.0f, 0.5f};
+            const Fl::Vector3 goal = {4.5f, 0.45f, 4.5f};
+            REQUIRE(mesh.FindCorridor(mesh.FindNode(start), mesh.FindNode(goal), search, corridor));
+
+            std::vector<Fl::Vector3> path;
+            mesh.BuildPath(corridor, start, goal, path);
+
+            THEN("The corridor follows the L and the path only turns at the inner corner") {
+                CHECK(corridor.size() == 9);
+                REQUIRE(path.size() == 3);
+                CHECK(path[0] == start);
+                CHECK(AreClose(path[1], {4.0f, 0.1f, 1.0f}));
+                CHECK(path[2] == goal);
+            }
+        }
+
+        WHEN("Finding a path in a straight line") {
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> corridor;
+            const Fl::Vector3 start = {0.2f, 0.0f, 0.8f};
+            const Fl::Vector3 goal = {3.7f, 0.0f, 0.1f};
+            REQUIRE(mesh.FindCorridor(mesh.FindNode(start), mesh.FindNode(goal), search, corridor));
+
+            std::vector<Fl::Vector3> path;
+            mesh.BuildPath(corridor, start, goal, path);
+
+            THEN("It goes straight to the goal") {
+                CHECK(corridor.size() == 4);
+                CHECK(path == std::vector<Fl::Vector3>{start, goal});
+            }
+        }
+
+        WHEN("Blocking a polygon of the way") {
+            const Fl::UInt64 version = mesh.GetVersion();
+            mesh.SetPolygonCost(getPolygon(4, 2), std::numeric_limits<float>::infinity());
+
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> corridor;
+
+            THEN("The goal can't be reached, and only that polygon changed") {
+                CHECK_FALSE(mesh.FindCorridor(getPolygon(0, 0), getPolygon(4, 4), search, corridor));
+                CHECK_FALSE(mesh.FindCorridor(getPolygon(4, 2), getPolygon(0, 0), search, corridor));
+                CHECK(mesh.FindCorridor(getPolygon(0, 0), getPolygon(4, 1), search, corridor));
+                CHECK(mesh.GetRegionVersion(getPolygon(4, 2)) == 1);
+                CHECK(mesh.GetRegionVersion(getPolygon(4, 1)) == 0);
+                CHECK(mesh.GetVersion() == version);
+            }
+
+            AND_WHEN("Unblocking it") {
+                mesh.SetPolygonCost(getPolygon(4, 2), 1.0f);
+
+                THEN("The goal is reachable again, and every path may have shortened") {
+                    CHECK(mesh.FindCorridor(getPolygon(0, 0), getPolygon(4, 4), search, corridor));
+                    CHECK(mesh.GetVersion() > version);
+                }
+            }
+        }
+    }
+
+    GIVEN("A ring of polygons") {
+        const std::vector<std::string> rows = {
+            "###",
+            "#.#",
+            "###",
+        };
+        const MeshData data = MakeMesh(rows);
+        Fl::NavigationMesh mesh(data.vertices, data.indices, data.polygonSizes);
+
+        WHEN("Making one side expensive") {
+            mesh.SetPolygonCost(data.cellPolygons[1], 3.0f);
+
+            Fl::AStarSearch search;
+            std::vector<Fl::UInt32> corridor;
+            REQUIRE(mesh.FindCorridor(data.cellPolygons[0], data.cellPolygons[8], search, corridor));
+
+            THEN("The corridor goes around the other side") {
+                const std::vector<Fl::UInt32> expected = {data.cellPolygons[0], data.cellPolygons[3],
+                                                          data.cellPolygons[6], data.cellPolygons[7],
+                                                          data.cellPolygons[8]};
+                CHECK(corridor == expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,276 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Navigation/NavigationGrid.hpp>
+#include <FlashlightEngine/Navigation/PathfindingService.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace std::chrono_literals;
+
+    // Grid of rooms separated by walls with a door in each, and scattered obstacles; size is a multiple of roomSize
+    Fl::NavigationGrid MakeMap(const Fl::UInt32 size, const Fl::UInt32 roomSize, std::mt19937& rng,
+                               Fl::ThreadPool* threadPool = nullptr) {
+        std::uniform_int_distribution<Fl::UInt32> doors(1, roomSize - 2);
+        std::uniform_int_distribution<int> obstacles(0, 19);
+
+        std::vector<Fl::UInt8> cellCosts(static_cast<std::size_t>(size) * size, 1);
+        for (Fl::UInt32 z = 0; z < size; ++z) {
+            for (Fl::UInt32 x = 0; x < size; ++x) {
+                const bool isWall = (x % roomSize == 0 && x > 0) || (z % roomSize == 0 && z > 0);
+                if (isWall || obstacles(rng) == 0) {
+                    cellCosts[z * size + x] = Fl::NavigationGrid::BlockedCell;
+                }
+            }
+        }
+
+        for (Fl::UInt32 room = roomSize; room < size; room += roomSize) {
+            for (Fl::UInt32 offset = 0; offset < size; offset += roomSize) {
+                const Fl::UInt32 door = offset + doors(rng);
+                cellCosts[door * size + room] = 1;
+                cellCosts[door * size + room - 1] = 1;
+                cellCosts[door * size + room + 1] = 1;
+                cellCosts[room * size + door] = 1;
+                cellCosts[(room - 1) * size + door] = 1;
+                cellCosts[(room + 1) * size + door] = 1;
+            }
+        }
+
+        Fl::NavigationGrid::Settings settings;
+        settings.width = size;
+        settings.depth = size;
+        return Fl::NavigationGrid(settings, cellCosts, threadPool);
+    }
+
+    Fl::Vector3 GetRandomPosition(const Fl::NavigationGrid& grid, std::mt19937& rng) {
+        std::uniform_real_distribution<float> positions(0.0f, static_cast<float>(grid.GetWidth()));
+        for (;;) {
+            const Fl::Vector3 position = {positions(rng), 0.0f, positions(rng)};
+            if (grid.FindNode(position) != Fl::NavigationGraph::InvalidNode) {
+                return position;
+            }
+        }
+    }
+} // namespace
+
+SCENARIO("PathfindingService", "[Navigation][PathfindingService]") {
+    GIVEN("A service over a grid") {
+        Fl::NavigationGrid::Settings settings;
+        settings.width = 32;
+        settings.depth = 32;
+        settings.clusterSize = 8;
+        Fl::NavigationGrid grid(settings);
+
+        // Wall along X at z = 16, open at x = 5 only, far from the ends
+        for (Fl::UInt32 x = 0; x < 32; ++x) {
+            if (x != 5) {
+                grid.SetCellCost(x, 16, Fl::NavigationGrid::BlockedCell);
+            }
+        }
+
+        grid.Update();
+
+        Fl::PathfindingService service(grid);
+        const Fl::Vector3 start = {30.5f, 0.0f, 2.5f};
+        const Fl::Vector3 goal = {30.5f, 0.0f, 30.5f};
+
+        WHEN("Requesting paths") {
+            const Fl::PathfindingService::RequestId request = service.RequestPath(start, goal);
+            const Fl::PathfindingService::RequestId blockedRequest = service.RequestPath(start, {10.5f, 0.0f, 16.5f});
+            const Fl::PathfindingService::RequestId outsideRequest = service.RequestPath(start, {-1.0f, 0.0f, 0.0f});
+
+            THEN("They are answered by the next update") {
+                std::vector<Fl::Vector3> path;
+                CHECK(request != Fl::PathfindingService::InvalidRequest);
+                CHECK(request != blockedRequest);
+                CHECK(service.GetPendingRequestCount() == 3);
+                CHECK(service.PollPath(request, path) == Fl::PathfindingService::PathStatus::Pending);
+
+                service.Update(1s);
+
+                CHECK(service.GetPendingRequestCount() == 0);
+                CHECK(service.GetStatistics().requestCount == 3);
+                CHECK(service.GetStatistics().failedRequestCount == 2);
+                CHECK(service.GetStatistics().cacheHitCount == 0);
+
+                REQUIRE(service.PollPath(request, path) == Fl::PathfindingService::PathStatus::Found);
+                REQUIRE(path.size() >= 3);
+                CHECK(path.front() == start);
+                CHECK(path.back() == goal);
+                CHECK(std::any_of(path.begin(), path.end(), [](const Fl::Vector3& point) { return point.x < 7.0f; }));
+
+                CHECK(service.PollPath(blockedRequest, path) == Fl::PathfindingService::PathStatus::NotFound);
+                CHECK(service.PollPath(outsideRequest, path) == Fl::PathfindingService::PathStatus::NotFound);
+                CHECK(service.PollPath(request, path) == Fl::PathfindingService::PathStatus::Unknown);
+            }
+        }
+
+        WHEN("Requesting the same cells again") {
+            service.RequestPath(start, goal);
+            service.Update(1s);
+
+            const Fl::PathfindingService::RequestId request = service.RequestPath({30.2f, 0.0f, 2.7f}, goal);
+            service.Update(1s);
+
+            THEN("The cached corridor is reused with the new positions") {
+                std::vector<Fl::Vector3> path;
+                CHECK(service.GetCachedCorridorCount() == 1);
+                CHECK(service.GetStatistics().cacheHitCount == 1);
+                REQUIRE(service.PollPath(request, path) == Fl::PathfindingService::PathStatus::Found);
+                CHECK(path.front() == Fl::Vector3(30.2f, 0.0f, 2.7f));
+            }
+
+            AND_WHEN("Blocking a cell of the corridor") {
+                grid.SetCellCost(5, 16, Fl::NavigationGrid::BlockedCell);
+                grid.Update();
+
+                const Fl::PathfindingService::RequestId blockedRequest = service.RequestPath(start, goal);
+                service.Update(1s);
+
+                THEN("The cached corridor is invalidated") {
+                    std::vector<Fl::Vector3> path;
+                    CHECK(service.GetStatistics().cacheHitCount == 0);
+                    CHECK(service.PollPath(blockedRequest, path) == Fl::PathfindingService::PathStatus::NotFound);
+                    CHECK(service.GetCachedCorridorCount() == 0);
+                }
+            }
+
+            AND_WHEN("Changing a cell away from the corridor") {
+                grid.SetCellCost(0, 31, 5);
+                grid.SetCellCost(0, 0, 5);
+                grid.Update();
+
+                service.RequestPath(start, goal);
+                service.Update(1s);
+
+                THEN("The cached corridor is still used") {
+                    CHECK(service.GetStatistics().cacheHitCount == 1);
+                }
+            }
+
+            AND_WHEN("Opening a shortcut") {
+                grid.SetCellCost(28, 16, 1);
+                grid.Update();
+
+                const Fl::PathfindingService::RequestId shortRequest = service.RequestPath(start, goal);
+                service.Update(1s);
+
+                THEN("The path is searched again and takes it") {
+                    std::vector<Fl::Vector3> path;
+                    CHECK(service.GetStatistics().cacheHitCount == 0);
+                    REQUIRE(service.PollPath(shortRequest, path) == Fl::PathfindingService::PathStatus::Found);
+                    CHECK(std::none_of(path.begin(), path.end(), [](const Fl::Vector3& point) { return point.x < 7.0f; }));
+                }
+            }
+        }
+
+        WHEN("Cancelling a request") {
+            const Fl::PathfindingService::RequestId request = service.RequestPath(start, goal);
+            service.CancelRequest(request);
+            service.Update(1s);
+
+            THEN("It is never answered") {
+                std::vector<Fl::Vector3> path;
+                CHECK(service.GetPendingRequestCount() == 0);
+                CHECK(service.GetStatistics().requestCount == 0);
+                CHECK(service.PollPath(request, path) == Fl::PathfindingService::PathStatus::Unknown);
+            }
+        }
+
+        WHEN("Updating without time budget") {
+            for (std::size_t i = 0; i < 3 * Fl::PathfindingService::BatchSize; ++i) {
+                service.RequestPath(start, {static_cast<float>(i % 30) + 0.5f, 0.0f, 30.5f});
+            }
+
+            service.Update(0s);
+
+            THEN("A single round is processed") {
+                CHECK(service.GetStatistics().requestCount == Fl::PathfindingService::BatchSize);
+                CHECK(service.GetPendingRequestCount() == 2 * Fl::PathfindingService::BatchSize);
+            }
+        }
+    }
+
+    GIVEN("A larger map and many requests") {
+        std::mt19937 rng(3);
+        const Fl::NavigationGrid grid = MakeMap(128, 32, rng);
+
+        std::vector<std::pair<Fl::Vector3, Fl::Vector3>> queries;
+        for (int i = 0; i < 100; ++i) {
+            queries.emplace_back(GetRandomPosition(grid, rng), GetRandomPosition(grid, rng));
+        }
+
+        WHEN("Answering them with and without thread pool") {
+            const auto answer = [&](Fl::ThreadPool* threadPool) {
+                Fl::PathfindingService service(grid);
+                std::vector<Fl::PathfindingService::RequestId> requests;
+                for (const auto& [start, goal] : queries) {
+                    requests.push_back(service.RequestPath(start, goal));
+                }
+
+                while (service.GetPendingRequestCount() > 0) {
+                    service.Update(1ms, threadPool);
+                }
+
+                std::vector<std::vector<Fl::Vector3>> paths(requests.size());
+                for (std::size_t i = 0; i < requests.size(); ++i) {
+                    service.PollPath(requests[i], paths[i]);
+                }
+
+                return paths;
+            };
+
+            Fl::ThreadPool threadPool(3);
+            const std::vector<std::vector<Fl::Vector3>> paths = answer(nullptr);
+            const std::vector<std::vector<Fl::Vector3>> parallelPaths = answer(&threadPool);
+
+            THEN("The paths are the same") {
+                CHECK(paths == parallelPaths);
+                CHECK(std::count_if(paths.begin(), paths.end(), [](const auto& path) { return !path.empty(); }) > 50);
+            }
+        }
+    }
+}
+
+TEST_CASE("PathfindingService benchmarks", "[Navigation][.benchmark]") {
+    std::mt19937 rng(42);
+    Fl::ThreadPool threadPool;
+
+    const Fl::Clock buildClock;
+    const Fl::NavigationGrid grid = MakeMap(1024, 32, rng, &threadPool);
+    const double buildTime = std::chrono::duration<double, std::milli>(buildClock.GetElapsedTime()).count();
+    WARN("1024x1024 grid built in " << buildTime << " ms, " << grid.GetEntranceCount() << " entrances");
+
+    std::vector<std::pair<Fl::Vector3, Fl::Vector3>> queries;
+    for (int i = 0; i < 256; ++i) {
+        queries.emplace_back(GetRandomPosition(grid, rng), GetRandomPosition(grid, rng));
+    }
+
+    for (const bool isParallel : {false, true}) {
+        Fl::PathfindingService::Settings settings;
+        settings.cacheCapacity = 0;
+        Fl::PathfindingService service(grid, settings);
+
+        const std::string name = std::string("256 paths on a 1024x1024 grid") + (isParallel ? ", thread pool" : "");
+        BENCHMARK(std::string(name)) {
+            for (const auto& [start, goal] : queries) {
+                service.RequestPath(start, goal);
+            }
+
+            service.Update(std::chrono::hours(1), isParallel ? &threadPool : nullptr);
+            return service.GetStatistics().requestCount;
+        };
+
+        WARN(name << ": " << service.GetStatistics().GetPathsPerSecond() << " paths/s");
+    }
+}
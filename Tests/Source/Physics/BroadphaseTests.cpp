@@ -0,0 +1,245 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Physics/DynamicTreeBroadphase.hpp>
+#include <FlashlightEngine/Physics/SweepAndPruneBroadphase.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    Fl::Aabb GenerateBox(const Fl::Vector3& worldSize, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-1.f, 1.f);
+        std::uniform_real_distribution<float> size(0.2f, 1.5f);
+
+        const Fl::Vector3 center = Fl::Vector3(position(rng), position(rng), position(rng)) * worldSize;
+        return Fl::Aabb::FromCenterExtents(center, {size(rng), size(rng), size(rng)});
+    }
+
+    // Proxies are stored in a vector indexed by their identifier, invalid boxes marking the destroyed ones
+    std::vector<Fl::BroadphasePair> BruteForcePairs(const std::vector<Fl::Aabb>& boxes) {
+        std::vector<Fl::BroadphasePair> pairs;
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            for (std::size_t j = i + 1; j < boxes.size(); ++j) {
+                if (boxes[i].IsValid() && boxes[j].IsValid() && boxes[i].Overlaps(boxes[j])) {
+                    pairs.push_back({static_cast<Fl::UInt32>(i), static_cast<Fl::UInt32>(j)});
+                }
+            }
+        }
+
+        return pairs;
+    }
+
+    void CheckBroadphase(Fl::Broadphase& broadphase) {
+        std::mt19937 rng(42);
+        const Fl::Vector3 worldSize(40.f, 10.f, 40.f);
+
+        std::vector<Fl::Aabb> boxes;
+        for (std::size_t i = 0; i < 2000; ++i) {
+            boxes.push_back(GenerateBox(worldSize, rng));
+            CHECK(broadphase.CreateProxy(boxes.back(), i * 10) == i);
+        }
+
+        CHECK(broadphase.GetProxyCount() == boxes.size());
+        CHECK(broadphase.GetUserData(12) == 120);
+
+        std::vector<Fl::BroadphasePair> pairs;
+        broadphase.FindPairs(pairs);
+        CHECK_FALSE(pairs.empty());
+        CHECK(pairs == BruteForcePairs(boxes));
+
+        Fl::ThreadPool threadPool(3);
+        std::uniform_real_distribution<float> offset(-0.5f, 0.5f);
+        std::uniform_int_distribution<std::size_t> pick(0, boxes.size() - 1);
+
+        for (int step = 0; step < 5; ++step) {
+            // Every body moves a little and a few teleport
+            for (std::size_t i = 0; i < boxes.size(); ++i) {
+                if (!boxes[i].IsValid()) {
+                    continue;
+                }
+
+                const Fl::Vector3 move(offset(rng), offset(rng), offset(rng));
+                boxes[i] = (i % 50 == 0) ? GenerateBox(worldSize, rng)
+                                         : Fl::Aabb{boxes[i].min + move, boxes[i].max + move};
+                broadphase.MoveProxy(static_cast<Fl::UInt32>(i), boxes[i]);
+            }
+
+            // Destroyed identifiers are only reused after the next update
+            std::vector<Fl::UInt32> destroyed;
+            for (int i = 0; i < 20; ++i) {
+                const auto proxy = static_cast<Fl::UInt32>(pick(rng));
+                if (boxes[proxy].IsValid()) {
+                    broadphase.DestroyProxy(proxy);
+                    boxes[proxy] = Fl::Aabb::Empty();
+                    destroyed.push_back(proxy);
+                }
+            }
+
+            const Fl::Aabb createdBox = GenerateBox(worldSize, rng);
+            const Fl::UInt32 created = broadphase.CreateProxy(createdBox, 0);
+            CHECK(std::find(destroyed.begin(), destroyed.end(), created) == destroyed.end());
+
+            if (created < boxes.size()) {
+                CHECK_FALSE(boxes[created].IsValid());
+                boxes[created] = createdBox;
+            } else {
+                boxes.push_back(createdBox);
+            }
+
+            std::vector<Fl::BroadphasePair> parallelPairs;
+            broadphase.FindPairs(parallelPairs, &threadPool);
+            CHECK(parallelPairs == BruteForcePairs(boxes));
+
+            broadphase.FindPairs(pairs);
+            CHECK(pairs == parallelPairs);
+        }
+
+        CHECK_FALSE(broadphase.IsValid(static_cast<Fl::UInt32>(boxes.size())));
+
+        // Identifiers of the proxies destroyed before the last update are recycled
+        const Fl::UInt32 recycled = broadphase.CreateProxy(GenerateBox(worldSize, rng), 7);
+        REQUIRE(recycled < boxes.size());
+        CHECK_FALSE(boxes[recycled].IsValid());
+        CHECK(broadphase.GetUserData(recycled) == 7);
+    }
+}
+
+SCENARIO("Broadphase", "[Broadphase]") {
+    WHEN("Using the dynamic tree") {
+        Fl::DynamicTreeBroadphase broadphase(0.2f);
+        CheckBroadphase(broadphase);
+
+        // Rotations keep the tree balanced
+        CHECK(broadphase.GetHeight() <= 2 * static_cast<int>(std::log2(broadphase.GetProxyCount())) + 2);
+
+        // Bodies staying within the margin keep their fattened bounds
+        const Fl::Aabb fatBounds = broadphase.GetFatBounds(3);
+        const Fl::Aabb bounds = broadphase.GetProxyBounds(3);
+        broadphase.MoveProxy(3, {bounds.min + Fl::Vector3(0.1f), bounds.max + Fl::Vector3(0.1f)});
+        CHECK(broadphase.GetFatBounds(3) == fatBounds);
+    }
+
+    WHEN("Using sweep and prune") {
+        Fl::SweepAndPruneBroadphase broadphase;
+        CheckBroadphase(broadphase);
+
+        // The world is flat along Y, sweeping along it would test many more intervals
+        CHECK(broadphase.GetSweepAxis() != 1);
+    }
+
+    WHEN("Comparing backends on a dense cluster") {
+        std::mt19937 rng(7);
+
+        std::unique_ptr<Fl::Broadphase> backends[] = {std::make_unique<Fl::DynamicTreeBroadphase>(),
+                                                      std::make_unique<Fl::SweepAndPruneBroadphase>()};
+
+        for (std::size_t i = 0; i < 500; ++i) {
+            const Fl::Aabb box = GenerateBox(Fl::Vector3(3.f), rng);
+            for (const std::unique_ptr<Fl::Broadphase>& backend : backends) {
+                backend->CreateProxy(box, i);
+            }
+        }
+
+        std::vector<Fl::BroadphasePair> treePairs, sweepPairs;
+        backends[0]->FindPairs(treePairs);
+        backends[1]->FindPairs(sweepPairs);
+
+        CHECK(treePairs.size() > 10'000);
+        CHECK(treePairs == sweepPairs);
+    }
+
+    WHEN("Finding pairs without proxies") {
+        Fl::DynamicTreeBroadphase tree;
+        Fl::SweepAndPruneBroadphase sweepAndPrune;
+
+        std::vector<Fl::BroadphasePair> pairs = {{0, 1}};
+        tree.FindPairs(pairs);
+        CHECK(pairs.empty());
+
+        pairs = {{0, 1}};
+        sweepAndPrune.FindPairs(pairs);
+        CHECK(pairs.empty());
+        CHECK(tree.GetHeight() == -1);
+    }
+}
+
+TEST_CASE("Broadphase benchmarks", "[Broadphase][.benchmark]") {
+    Fl::ThreadPool threadPool;
+
+    for (const std::size_t bodyCount : {std::size_t(1'000), std::size_t(10'000), std::size_t(50'000),
+                                        std::size_t(200'000)}) {
+        std::mt19937 rng(42);
+
+        // Keep the density constant: about 4 pairs per body
+        const float worldSize = 2.5f * std::cbrt(static_cast<float>(bodyCount));
+        std::vector<Fl::Aabb> boxes(bodyCount);
+        for (Fl::Aabb& box : boxes) {
+            box = GenerateBox(Fl::Vector3(worldSize), rng);
+        }
+
+        std::vector<Fl::Vector3> velocities(bodyCount);
+        std::uniform_real_distribution<float> velocity(-0.05f, 0.05f);
+        for (Fl::Vector3& bodyVelocity : velocities) {
+            bodyVelocity = {velocity(rng), velocity(rng), velocity(rng)};
+        }
+
+        const std::string suffix = std::to_string(bodyCount / 1000) + "K moving bodies";
+
+        if (bodyCount <= 10'000) {
+            BENCHMARK("Brute force, " + suffix) {
+                std::size_t pairCount = 0;
+                for (std::size_t i = 0; i < bodyCount; ++i) {
+                    for (std::size_t j = i + 1; j < bodyCount; ++j) {
+                        pairCount += boxes[i].Overlaps(boxes[j]);
+                    }
+                }
+
+                return pairCount;
+            };
+        }
+
+        Fl::DynamicTreeBroadphase tree;
+        Fl::SweepAndPruneBroadphase sweepAndPrune;
+        for (std::size_t i = 0; i < bodyCount; ++i) {
+            tree.CreateProxy(boxes[i], i);
+            sweepAndPrune.CreateProxy(boxes[i], i);
+        }
+
+        std::vector<Fl::BroadphasePair> pairs;
+        const auto step = [&](Fl::Broadphase& broadphase, Fl::ThreadPool* pool) {
+            for (std::size_t i = 0; i < bodyCount; ++i) {
+                boxes[i] = {boxes[i].min + velocities[i], boxes[i].max + velocities[i]};
+                broadphase.MoveProxy(static_cast<Fl::UInt32>(i), boxes[i]);
+            }
+
+            broadphase.FindPairs(pairs, pool);
+            return pairs.size();
+        };
+
+        BENCHMARK("Dynamic tree, " + suffix) {
+            return step(tree, nullptr);
+        };
+
+        BENCHMARK("Dynamic tree, thread pool, " + suffix) {
+            return step(tree, &threadPool);
+        };
+
+        BENCHMARK("Sweep and prune, " + suffix) {
+            return step(sweepAndPrune, nullptr);
+        };
+
+        BENCHMARK("Sweep and prune, thread pool, " + suffix) {
+            return step(sweepAndPrune, &threadPool);
+        };
+    }
+}
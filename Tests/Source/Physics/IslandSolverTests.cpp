@@ -0,0 +1,346 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Physics/BoxShape.hpp>
+#include <FlashlightEngine/Physics/CapsuleShape.hpp>
+#include <FlashlightEngine/Physics/DynamicTreeBroadphase.hpp>
+#include <FlashlightEngine/Physics/IslandSolver.hpp>
+#include <FlashlightEngine/Physics/Narrowphase.hpp>
+#include <FlashlightEngine/Physics/SphereShape.hpp>
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr float TimeStep = 1.f / 60.f;
+
+    // Broadphase, narrowphase and solver stepped together
+    struct World {
+        std::vector<std::unique_ptr<Fl::Shape>> shapes;
+        std::vector<Fl::RigidBody> bodies;
+        std::vector<Fl::CollisionBody> collisionBodies;
+        std::vector<Fl::BroadphasePair> pairs;
+        std::vector<Fl::BroadphasePair> awakePairs;
+        Fl::DynamicTreeBroadphase broadphase;
+        Fl::Narrowphase narrowphase;
+        Fl::IslandSolver solver;
+
+        explicit World(const Fl::IslandSolver::Settings& settings = {}) :
+            solver(settings) {
+        }
+
+        Fl::UInt32 AddBody(std::unique_ptr<Fl::Shape> shape, const Fl::Vector3& position, const float mass,
+                           const Fl::Vector3& inertia = Fl::Vector3::Zero()) {
+            Fl::RigidBody body;
+            body.position = position;
+            body.inverseMass = (mass > 0.f) ? 1.f / mass : 0.f;
+            body.inverseInertia = (mass > 0.f) ? Fl::Vector3::Unit() / inertia : Fl::Vector3::Zero();
+
+            bodies.push_back(body);
+            collisionBodies.push_back({shape.get(), body.position, body.rotation});
+            broadphase.CreateProxy(shape->ComputeBounds(body.position, body.rotation), bodies.size() - 1);
+            shapes.push_back(std::move(shape));
+
+            return static_cast<Fl::UInt32>(bodies.size() - 1);
+        }
+
+        Fl::UInt32 AddBox(const Fl::Vector3& halfExtents, const Fl::Vector3& position, const float mass) {
+            const Fl::Vector3 squared = halfExtents * halfExtents;
+            const Fl::Vector3 inertia = Fl::Vector3(squared.y + squared.z, squared.x + squared.z,
+                                                    squared.x + squared.y) * (mass / 3.f);
+            return AddBody(std::make_unique<Fl::BoxShape>(halfExtents), position, mass, inertia);
+        }
+
+        Fl::UInt32 AddSphere(const float radius, const Fl::Vector3& position, const float mass) {
+            return AddBody(std::make_unique<Fl::SphereShape>(radius), position, mass,
+                           Fl::Vector3(0.4f * mass * radius * radius));
+        }
+
+        void Step(Fl::ThreadPool* threadPool = nullptr) {
+            for (std::size_t i = 0; i < bodies.size(); ++i) {
+                if (!bodies[i].IsStatic() && !solver.IsSleeping(static_cast<Fl::UInt32>(i))) {
+                    collisionBodies[i].position = bodies[i].position;
+                    collisionBodies[i].rotation = bodies[i].rotation;
+                    broadphase.MoveProxy(static_cast<Fl::UInt32>(i),
+                                         shapes[i]->ComputeBounds(bodies[i].position, bodies[i].rotation));
+                }
+            }
+
+            broadphase.FindPairs(pairs, threadPool);
+
+            // Pairs of sleeping or static bodies don't need to be collided
+            const auto isResting = [&](const Fl::UInt32 body) {
+                return bodies[body].IsStatic() || solver.IsSleeping(body);
+            };
+
+            awakePairs.clear();
+            for (const Fl::BroadphasePair& pair : pairs) {
+                if (!isResting(pair.first) || !isResting(pair.second)) {
+                    awakePairs.push_back(pair);
+                }
+            }
+
+            narrowphase.Collide(collisionBodies, awakePairs, threadPool);
+            solver.Step(bodies, narrowphase.GetManifolds(), TimeStep, threadPool);
+        }
+
+        Fl::UInt64 ComputeStateHash() const {
+            // FNV-1a over the bits of the state
+            Fl::UInt64 hash = 14695981039346656037ull;
+            const auto combine = [&](const float value) {
+                hash = (hash ^ Fl::BitCast<Fl::UInt32>(value)) * 1099511628211ull;
+            };
+
+            for (const Fl::RigidBody& body : bodies) {
+                for (const float value : {body.position.x, body.position.y, body.position.z, body.rotation.x,
+                                          body.rotation.y, body.rotation.z, body.rotation.w, body.linearVelocity.x,
+                                          body.linearVelocity.y, body.linearVelocity.z, body.angularVelocity.x,
+                                          body.angularVelocity.y, body.angularVelocity.z}) {
+                    combine(value);
+                }
+            }
+
+            return hash;
+        }
+    };
+
+    // Mixed bodies dropped in a pit, settling in a single large island
+    void BuildPile(World& world, const int layerCount) {
+        world.AddBox({12.f, 1.f, 12.f}, {0.f, -1.f, 0.f}, 0.f);
+        world.AddBox({1.f, 4.f, 6.f}, {-5.f, 3.f, 0.f}, 0.f);
+        world.AddBox({1.f, 4.f, 6.f}, {5.f, 3.f, 0.f}, 0.f);
+        world.AddBox({4.f, 4.f, 1.f}, {0.f, 3.f, -5.f}, 0.f);
+        world.AddBox({4.f, 4.f, 1.f}, {0.f, 3.f, 5.f}, 0.f);
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+        for (int layer = 0; layer < layerCount; ++layer) {
+            for (int x = 0; x < 8; ++x) {
+                for (int z = 0; z < 8; ++z) {
+                    const Fl::Vector3 position(-3.5f + static_cast<float>(x) + jitter(rng),
+                                               0.5f + static_cast<float>(layer) * 1.05f,
+                                               -3.5f + static_cast<float>(z) + jitter(rng));
+                    switch ((x + z + layer) % 3) {
+                        case 0: world.AddSphere(0.45f, position, 1.f); break;
+                        case 1: world.AddBox(Fl::Vector3(0.45f), position, 1.f); break;
+                        default:
+                            world.AddBody(std::make_unique<Fl::CapsuleShape>(0.2f, 0.25f), position, 1.f,
+                                          Fl::Vector3(0.05f));
+                            break;
+                    }
+                }
+            }
+        }
+    }
+
+    Fl::UInt64 SimulatePile(Fl::ThreadPool* threadPool, std::size_t& maxLargeIslandCount,
+                            std::size_t& maxColorCount) {
+        World world;
+        BuildPile(world, 3);
+
+        maxLargeIslandCount = 0;
+        maxColorCount = 0;
+        for (int step = 0; step < 90; ++step) {
+            world.Step(threadPool);
+            maxLargeIslandCount = std::max(maxLargeIslandCount, world.solver.GetStatistics().largeIslandCount);
+            maxColorCount = std::max(maxColorCount, world.solver.GetStatistics().colorCount);
+        }
+
+        return world.ComputeStateHash();
+    }
+}
+
+SCENARIO("Island solver", "[IslandSolver]") {
+    WHEN("Dropping a box on the ground") {
+        World world;
+        world.AddBox({10.f, 1.f, 10.f}, {0.f, -1.f, 0.f}, 0.f);
+        const Fl::UInt32 box = world.AddBox(Fl::Vector3(0.5f), {0.f, 1.5f, 0.f}, 2.f);
+
+        for (int step = 0; step < 60; ++step) {
+            world.Step();
+        }
+
+        // Resting on the ground, penetrating by about the slop
+        CHECK(world.bodies[box].position.y == Catch::Approx(0.5f).margin(0.02f));
+        CHECK(std::abs(world.bodies[box].position.x) < 1e-3f);
+        CHECK(world.bodies[box].rotation.ApproxEqual(Fl::Quaternion::Identity(), 1e-3f));
+        CHECK(world.bodies[0].position == Fl::Vector3(0.f, -1.f, 0.f));
+
+        const Fl::ContactManifold* manifold = world.narrowphase.FindManifold(0, box);
+        REQUIRE(manifold);
+        CHECK(manifold->pointCount == 4);
+        CHECK(manifold->points[0].normalImpulse > 0.f);
+
+        // The whole weight is carried by the contact points
+        float normalImpulse = 0.f;
+        for (std::size_t i = 0; i < manifold->pointCount; ++i) {
+            normalImpulse += manifold->points[i].normalImpulse;
+        }
+        CHECK(normalImpulse == Catch::Approx(2.f * 9.81f * TimeStep).epsilon(0.05f));
+
+        THEN("It falls asleep") {
+            for (int step = 0; step < 60 && !world.solver.IsSleeping(box); ++step) {
+                world.Step();
+            }
+
+            CHECK(world.solver.IsSleeping(box));
+            CHECK_FALSE(world.solver.IsSleeping(0));
+            CHECK(world.solver.GetStatistics().sleepingIslandCount == 1);
+            CHECK(world.bodies[box].linearVelocity == Fl::Vector3::Zero());
+
+            // Sleeping bodies are left untouched
+            const Fl::Vector3 position = world.bodies[box].position;
+            world.Step();
+            CHECK(world.bodies[box].position == position);
+            CHECK(world.solver.GetStatistics().islandCount == 0);
+            CHECK(world.solver.GetStatistics().awakeBodyCount == 0);
+
+            world.solver.WakeBody(box);
+            CHECK_FALSE(world.solver.IsSleeping(box));
+            CHECK(world.solver.GetStatistics().sleepingIslandCount == 1);
+        }
+    }
+
+    WHEN("Stacking boxes") {
+        World world;
+        world.AddBox({10.f, 1.f, 10.f}, {0.f, -1.f, 0.f}, 0.f);
+        for (int i = 0; i < 5; ++i) {
+            world.AddBox(Fl::Vector3(0.5f), {0.f, 0.5f + static_cast<float>(i), 0.f}, 1.f);
+        }
+
+        // A second tower, apart from the first one
+        for (int i = 0; i < 3; ++i) {
+            world.AddBox(Fl::Vector3(0.5f), {4.f, 0.5f + static_cast<float>(i), 0.f}, 1.f);
+        }
+
+        world.Step();
+        CHECK(world.solver.GetStatistics().islandCount == 2);
+        CHECK(world.solver.GetStatistics().contactCount == 8);
+        CHECK(world.solver.GetStatistics().largeIslandCount == 0);
+        // Every box but the top ones touches two others, contacts of a tower alternate between two colors
+        CHECK(world.solver.GetStatistics().colorCount == 2);
+
+        for (int step = 0; step < 240; ++step) {
+            world.Step();
+        }
+
+        const Fl::RigidBody& top = world.bodies[5];
+        CHECK(top.position.y == Catch::Approx(4.5f).margin(0.05f));
+        CHECK(std::abs(top.position.x) < 0.01f);
+        CHECK(std::abs(top.position.z) < 0.01f);
+        CHECK(world.solver.IsSleeping(5));
+        CHECK(world.solver.IsSleeping(8));
+
+        THEN("A falling sphere wakes the island it hits only") {
+            const Fl::UInt32 sphere = world.AddSphere(0.5f, {0.f, 6.f, 0.f}, 1.f);
+            for (int step = 0; step < 60 && world.solver.IsSleeping(5); ++step) {
+                world.Step();
+            }
+
+            CHECK_FALSE(world.solver.IsSleeping(5));
+            CHECK_FALSE(world.solver.IsSleeping(1));
+            CHECK(world.solver.IsSleeping(8));
+
+            // Pairs of sleeping bodies weren't collided, the tower joins the island of the sphere a step later
+            world.Step();
+            CHECK(world.solver.GetStatistics().islandCount == 1);
+            CHECK(world.solver.IsSleeping(8));
+            CHECK(world.bodies[sphere].position.y > 5.f);
+        }
+    }
+
+    WHEN("Bouncing a sphere") {
+        World world;
+        world.AddBox({10.f, 1.f, 10.f}, {0.f, -1.f, 0.f}, 0.f);
+        const Fl::UInt32 sphere = world.AddSphere(0.5f, {0.f, 3.f, 0.f}, 1.f);
+        world.bodies[sphere].restitution = 0.8f;
+
+        float lowestHeight = 3.f;
+        float highestBounce = 0.f;
+        for (int step = 0; step < 90; ++step) {
+            world.Step();
+
+            const Fl::RigidBody& body = world.bodies[sphere];
+            lowestHeight = std::min(lowestHeight, body.position.y);
+            if (lowestHeight < 0.6f) {
+                highestBounce = std::max(highestBounce, body.position.y);
+            }
+        }
+
+        // Without speculative bounds the sphere sinks by less than the distance it covers in a step
+        CHECK(lowestHeight > 0.5f - 7.f * TimeStep);
+        // Dropped from 2.5 above the ground, a restitution of 0.8 brings it back to about 1.6
+        CHECK(highestBounce > 0.5f + 1.2f);
+        CHECK(highestBounce < 0.5f + 2.f);
+    }
+
+    WHEN("Solving a pile on several threads") {
+        std::size_t largeIslandCount;
+        std::size_t colorCount;
+        const Fl::UInt64 hash = SimulatePile(nullptr, largeIslandCount, colorCount);
+
+        // The pile is a single island, large enough to be colored and spread over the threads
+        CHECK(largeIslandCount == 1);
+        CHECK(colorCount > 2);
+
+        // Repeating the simulation gives the same state, bit for bit
+        CHECK(SimulatePile(nullptr, largeIslandCount, colorCount) == hash);
+
+        for (const std::size_t workerCount : {std::size_t(1), std::size_t(3), std::size_t(8)}) {
+            Fl::ThreadPool threadPool(workerCount);
+            CHECK(SimulatePile(&threadPool, largeIslandCount, colorCount) == hash);
+            CHECK(SimulatePile(&threadPool, largeIslandCount, colorCount) == hash);
+        }
+    }
+}
+
+TEST_CASE("Island solver benchmarks", "[IslandSolver][.benchmark]") {
+    Fl::ThreadPool threadPool;
+
+    // Bodies don't fall asleep, each run solves the same settled pile
+    Fl::IslandSolver::Settings settings;
+    settings.timeToSleep = std::numeric_limits<float>::infinity();
+
+    for (const int layerCount : {2, 8, 24}) {
+        World world(settings);
+        BuildPile(world, layerCount);
+        for (int step = 0; step < 60; ++step) {
+            world.Step(&threadPool);
+        }
+
+        const std::vector<Fl::RigidBody> settledBodies = world.bodies;
+        const std::span<Fl::ContactManifold> manifolds = world.narrowphase.GetManifolds();
+        const std::vector<Fl::ContactManifold> settledManifolds(manifolds.begin(), manifolds.end());
+
+        const std::string suffix = std::to_string(world.bodies.size()) + " bodies, " +
+                                   std::to_string(manifolds.size()) + " contacts";
+
+        const auto solve = [&](Fl::IslandSolver& solver, Fl::ThreadPool* pool) {
+            world.bodies = settledBodies;
+            std::copy(settledManifolds.begin(), settledManifolds.end(), manifolds.begin());
+            solver.Step(world.bodies, manifolds, TimeStep, pool);
+            return world.bodies[10].position.y;
+        };
+
+        Fl::IslandSolver solver(settings);
+        BENCHMARK("Solve, " + suffix) {
+            return solve(solver, nullptr);
+        };
+
+        BENCHMARK("Solve, thread pool, " + suffix) {
+            return solve(solver, &threadPool);
+        };
+    }
+}
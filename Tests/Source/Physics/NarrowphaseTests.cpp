@@ -0,0 +1,403 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Physics/BoxShape.hpp>
+#include <FlashlightEngine/Physics/CapsuleShape.hpp>
+#include <FlashlightEngine/Physics/ConvexHullShape.hpp>
+#include <FlashlightEngine/Physics/DynamicTreeBroadphase.hpp>
+#include <FlashlightEngine/Physics/Gjk.hpp>
+#include <FlashlightEngine/Physics/Narrowphase.hpp>
+#include <FlashlightEngine/Physics/SphereShape.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    bool IsNear(const Fl::Vector3& lhs, const Fl::Vector3& rhs, const float epsilon = 1e-3f) {
+        return (lhs - rhs).GetLength() <= epsilon;
+    }
+
+    const Fl::ContactManifold& CollidePair(Fl::Narrowphase& narrowphase, const Fl::CollisionBody& bodyA,
+                                           const Fl::CollisionBody& bodyB) {
+        static const Fl::ContactManifold empty{};
+
+        const Fl::CollisionBody bodies[] = {bodyA, bodyB};
+        const Fl::BroadphasePair pair{0, 1};
+        narrowphase.Collide(bodies, {&pair, 1});
+
+        const Fl::ContactManifold* manifold = narrowphase.FindManifold(0, 1);
+        return manifold ? *manifold : empty;
+    }
+
+    Fl::Quaternion RandomRotation(std::mt19937& rng) {
+        std::uniform_real_distribution<float> component(-1.f, 1.f);
+        return Fl::Quaternion(component(rng), component(rng), component(rng), component(rng)).GetNormal();
+    }
+
+    // Mixed shapes scattered in a box, with the pairs of overlapping bounds
+    struct Scene {
+        std::vector<std::unique_ptr<Fl::Shape>> shapes;
+        std::vector<Fl::CollisionBody> bodies;
+        std::vector<Fl::BroadphasePair> pairs;
+
+        Scene(const std::size_t bodyCount, const float worldSize, const unsigned int seed) {
+            std::mt19937 rng(seed);
+            std::uniform_real_distribution<float> position(-worldSize, worldSize);
+            std::uniform_real_distribution<float> size(0.3f, 1.f);
+
+            const std::vector<Fl::Vector3> hullPoints = {{-0.6f, -0.5f, -0.4f}, {0.7f, -0.5f, -0.3f},
+                                                         {0.f, -0.5f, 0.8f},    {0.1f, 0.7f, 0.f},
+                                                         {0.3f, 0.2f, 0.4f},    {-0.3f, 0.1f, -0.2f}};
+
+            Fl::DynamicTreeBroadphase broadphase;
+            for (std::size_t i = 0; i < bodyCount; ++i) {
+                switch (i % 4) {
+                    case 0: shapes.push_back(std::make_unique<Fl::SphereShape>(size(rng))); break;
+                    case 1: shapes.push_back(std::make_unique<Fl::CapsuleShape>(size(rng), size(rng) * 0.5f)); break;
+                    case 2:
+                        shapes.push_back(std::make_unique<Fl::BoxShape>(Fl::Vector3(size(rng), size(rng), size(rng))));
+                        break;
+                    default: shapes.push_back(std::make_unique<Fl::ConvexHullShape>(hullPoints)); break;
+                }
+
+                const Fl::CollisionBody body{shapes.back().get(), {position(rng), position(rng), position(rng)},
+                                             RandomRotation(rng)};
+                bodies.push_back(body);
+                broadphase.CreateProxy(body.shape->ComputeBounds(body.position, body.rotation), i);
+            }
+
+            broadphase.FindPairs(pairs);
+        }
+    };
+}
+
+SCENARIO("Narrowphase", "[Narrowphase]") {
+    Fl::Narrowphase narrowphase(0.05f);
+    const Fl::Quaternion identity = Fl::Quaternion::Identity();
+
+    WHEN("Looking up shape types") {
+        const Fl::SphereShape sphere(1.f);
+        const Fl::CapsuleShape capsule(1.f, 0.5f);
+        const Fl::BoxShape box(Fl::Vector3(1.f));
+        const Fl::ConvexHullShape hull(std::vector<Fl::Vector3>{{0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {0.f, 1.f, 0.f},
+                                                                {0.f, 0.f, 1.f}});
+
+        CHECK(Fl::Narrowphase::GetShapeType(sphere) == Fl::ShapeType::Sphere);
+        CHECK(Fl::Narrowphase::GetShapeType(capsule) == Fl::ShapeType::Capsule);
+        CHECK(Fl::Narrowphase::GetShapeType(box) == Fl::ShapeType::Box);
+        CHECK(Fl::Narrowphase::GetShapeType(hull) == Fl::ShapeType::ConvexHull);
+        CHECK(sphere.GetClassId() == Fl::SphereShape(2.f).GetClassId());
+        CHECK(sphere.GetClassId() != box.GetClassId());
+    }
+
+    WHEN("Colliding spheres") {
+        const Fl::SphereShape small(0.5f);
+        const Fl::SphereShape large(1.f);
+
+        const Fl::ContactManifold& manifold =
+            CollidePair(narrowphase, {&small, {0.f, 0.f, 0.f}, identity}, {&large, {1.2f, 0.f, 0.f}, identity});
+        REQUIRE(manifold.pointCount == 1);
+        CHECK(IsNear(manifold.normal, Fl::Vector3::UnitX()));
+        CHECK(manifold.points[0].depth == Catch::Approx(0.3f));
+        CHECK(IsNear(manifold.points[0].position, {0.35f, 0.f, 0.f}));
+        CHECK(IsNear(manifold.points[0].localPointB, {-1.f, 0.f, 0.f}));
+
+        // Within the margin the contact is kept with a negative depth, past it there is none
+        const Fl::ContactManifold& speculative =
+            CollidePair(narrowphase, {&small, {0.f, 0.f, 0.f}, identity}, {&large, {1.53f, 0.f, 0.f}, identity});
+        REQUIRE(speculative.pointCount == 1);
+        CHECK(speculative.points[0].depth == Catch::Approx(-0.03f).margin(1e-5f));
+
+        CHECK(CollidePair(narrowphase, {&small, {0.f, 0.f, 0.f}, identity}, {&large, {1.6f, 0.f, 0.f}, identity})
+                  .pointCount == 0);
+    }
+
+    WHEN("Colliding a sphere with a capsule") {
+        const Fl::SphereShape sphere(0.5f);
+        const Fl::CapsuleShape capsule(1.f, 0.25f);
+
+        // Lying along X, the sphere touches the middle of the segment from above
+        const Fl::Quaternion lying =
+            Fl::Quaternion::FromAxisAngle(Fl::Vector3::UnitZ(), std::numbers::pi_v<float> / 2.f);
+        const Fl::ContactManifold& manifold =
+            CollidePair(narrowphase, {&sphere, {0.5f, 0.7f, 0.f}, identity}, {&capsule, {0.f, 0.f, 0.f}, lying});
+        REQUIRE(manifold.pointCount == 1);
+        CHECK(IsNear(manifold.normal, -Fl::Vector3::UnitY()));
+        CHECK(manifold.points[0].depth == Catch::Approx(0.05f).margin(1e-5f));
+        CHECK(manifold.bodyA == 0);
+
+        // Bodies are swapped to follow the shape type order, the normal follows them
+        const Fl::ContactManifold& swapped =
+            CollidePair(narrowphase, {&capsule, {0.f, 0.f, 0.f}, lying}, {&sphere, {1.7f, 0.f, 0.f}, identity});
+        REQUIRE(swapped.pointCount == 1);
+        CHECK(swapped.bodyA == 1);
+        CHECK(IsNear(swapped.normal, -Fl::Vector3::UnitX()));
+        CHECK(swapped.points[0].depth == Catch::Approx(0.05f).margin(1e-5f));
+    }
+
+    WHEN("Colliding a sphere with a box") {
+        const Fl::SphereShape sphere(0.5f);
+        const Fl::BoxShape box({1.f, 0.5f, 2.f});
+
+        const Fl::ContactManifold& outside =
+            CollidePair(narrowphase, {&sphere, {0.f, 0.9f, 0.f}, identity}, {&box, {0.f, 0.f, 0.f}, identity});
+        REQUIRE(outside.pointCount == 1);
+        CHECK(IsNear(outside.normal, -Fl::Vector3::UnitY()));
+        CHECK(outside.points[0].depth == Catch::Approx(0.1f).margin(1e-5f));
+        CHECK(IsNear(outside.points[0].localPointB, {0.f, 0.5f, 0.f}));
+
+        // A center inside the box leaves through the closest face
+        const Fl::ContactManifold& inside =
+            CollidePair(narrowphase, {&sphere, {0.8f, 0.f, 0.f}, identity}, {&box, {0.f, 0.f, 0.f}, identity});
+        REQUIRE(inside.pointCount == 1);
+        CHECK(IsNear(inside.normal, -Fl::Vector3::UnitX()));
+        CHECK(inside.points[0].depth == Catch::Approx(0.7f).margin(1e-5f));
+    }
+
+    WHEN("Computing distances and penetrations with GJK and EPA") {
+        const Fl::BoxShape box(Fl::Vector3(1.f));
+        const auto makeSupport = [&](const Fl::Vector3& position) {
+            return [&box, position](const Fl::Vector3& direction) { return position + box.GetSupport(direction); };
+        };
+
+        const Fl::GjkResult apart =
+            Fl::ComputeGjkDistance(makeSupport({0.f, 0.f, 0.f}), makeSupport({3.f, 0.5f, 0.f}), Fl::Vector3::UnitX());
+        CHECK_FALSE(apart.overlapping);
+        CHECK(apart.distance == Catch::Approx(1.f));
+        CHECK(apart.pointA.x == Catch::Approx(1.f));
+        CHECK(apart.pointB.x == Catch::Approx(2.f));
+
+        const Fl::GjkResult overlapping =
+            Fl::ComputeGjkDistance(makeSupport({0.f, 0.f, 0.f}), makeSupport({1.7f, 0.2f, 0.1f}), Fl::Vector3::UnitX());
+        REQUIRE(overlapping.overlapping);
+
+        const std::optional<Fl::EpaResult> penetration = Fl::ComputeEpaPenetration(
+            makeSupport({0.f, 0.f, 0.f}), makeSupport({1.7f, 0.2f, 0.1f}), overlapping.simplex);
+        REQUIRE(penetration);
+        CHECK(IsNear(penetration->normal, Fl::Vector3::UnitX()));
+        CHECK(penetration->depth == Catch::Approx(0.3f).margin(1e-3f));
+
+        // Shapes starting at the same position give a degenerate simplex, which EPA expands
+        const Fl::GjkResult centered =
+            Fl::ComputeGjkDistance(makeSupport({0.f, 0.f, 0.f}), makeSupport({0.f, 0.f, 0.f}), Fl::Vector3::Zero());
+        REQUIRE(centered.overlapping);
+        const std::optional<Fl::EpaResult> centeredPenetration = Fl::ComputeEpaPenetration(
+            makeSupport({0.f, 0.f, 0.f}), makeSupport({0.f, 0.f, 0.f}), centered.simplex);
+        REQUIRE(centeredPenetration);
+        CHECK(centeredPenetration->depth == Catch::Approx(2.f).margin(1e-3f));
+    }
+
+    WHEN("Resting a box on a box") {
+        const Fl::BoxShape ground({5.f, 0.5f, 5.f});
+        const Fl::BoxShape crate(Fl::Vector3(0.5f));
+
+        std::vector<Fl::CollisionBody> bodies = {{&ground, {0.f, 0.f, 0.f}, identity},
+                                                 {&crate, {0.3f, 0.98f, -0.2f}, identity}};
+        const Fl::BroadphasePair pair{0, 1};
+        narrowphase.Collide(bodies, {&pair, 1});
+
+        // The whole face touches, in a single step
+        REQUIRE(narrowphase.GetManifolds().size() == 1);
+        Fl::ContactManifold& manifold = narrowphase.GetManifolds()[0];
+        REQUIRE(manifold.pointCount == 4);
+        CHECK(IsNear(manifold.normal, Fl::Vector3::UnitY()));
+        for (std::size_t i = 0; i < manifold.pointCount; ++i) {
+            CHECK(manifold.points[i].depth == Catch::Approx(0.02f).margin(1e-4f));
+            CHECK(std::abs(manifold.points[i].position.x - 0.3f) == Catch::Approx(0.5f).margin(1e-4f));
+            CHECK(manifold.points[i].normalImpulse == 0.f);
+
+            // The solver stores its impulses in the manifold
+            manifold.points[i].normalImpulse = static_cast<float>(i + 1);
+            manifold.points[i].tangentImpulses[1] = -static_cast<float>(i + 1);
+        }
+
+        // Points of the next step continue the previous ones and warm start from their impulses
+        bodies[1].position += Fl::Vector3(0.01f, -0.001f, 0.f);
+        narrowphase.Collide(bodies, {&pair, 1});
+        const Fl::ContactManifold& next = narrowphase.GetManifolds()[0];
+        REQUIRE(next.pointCount == 4);
+        for (std::size_t i = 0; i < next.pointCount; ++i) {
+            const Fl::ContactPoint& point = next.points[i];
+            CHECK(point.featureId < 4);
+            CHECK(point.normalImpulse == static_cast<float>(point.featureId + 1));
+            CHECK(point.tangentImpulses[1] == -point.normalImpulse);
+        }
+
+        // Tilted, the crate only touches along an edge
+        bodies[1].rotation = Fl::Quaternion::FromAxisAngle(Fl::Vector3::UnitZ(), 0.3f);
+        bodies[1].position = {0.f, 0.5f + 0.5f * (std::cos(0.3f) + std::sin(0.3f)) - 0.01f, 0.f};
+        narrowphase.Collide(bodies, {&pair, 1});
+        const Fl::ContactManifold& edge = narrowphase.GetManifolds()[0];
+        REQUIRE(edge.pointCount == 2);
+        CHECK(edge.points[0].depth == Catch::Approx(0.01f).margin(1e-3f));
+        CHECK(IsNear(edge.points[0].position, {edge.points[1].position.x, edge.points[1].position.y,
+                                               -edge.points[1].position.z}));
+        CHECK(edge.points[0].normalImpulse == 0.f);
+    }
+
+    WHEN("Lying capsules on other shapes") {
+        const Fl::CapsuleShape capsule(1.f, 0.25f);
+        const Fl::BoxShape ground({5.f, 0.5f, 5.f});
+        const Fl::Quaternion lying =
+            Fl::Quaternion::FromAxisAngle(Fl::Vector3::UnitZ(), std::numbers::pi_v<float> / 2.f);
+
+        // The segment lies on the face, both of its ends touch
+        const Fl::ContactManifold& onBox =
+            CollidePair(narrowphase, {&capsule, {0.f, 0.74f, 0.f}, lying}, {&ground, {0.f, 0.f, 0.f}, identity});
+        REQUIRE(onBox.pointCount == 2);
+        CHECK(IsNear(onBox.normal, -Fl::Vector3::UnitY()));
+        CHECK(onBox.points[0].depth == Catch::Approx(0.01f).margin(1e-4f));
+        CHECK(std::abs(onBox.points[0].position.x) == Catch::Approx(1.f).margin(1e-4f));
+
+        // Parallel capsules touch along their common part
+        const Fl::ContactManifold& parallel =
+            CollidePair(narrowphase, {&capsule, {0.f, 0.f, 0.f}, lying}, {&capsule, {0.5f, 0.45f, 0.f}, lying});
+        REQUIRE(parallel.pointCount == 2);
+        CHECK(IsNear(parallel.normal, Fl::Vector3::UnitY()));
+        CHECK(parallel.points[0].depth == Catch::Approx(0.05f).margin(1e-4f));
+        CHECK(std::min(parallel.points[0].position.x, parallel.points[1].position.x) == Catch::Approx(-0.5f));
+        CHECK(std::max(parallel.points[0].position.x, parallel.points[1].position.x) == Catch::Approx(1.f));
+
+        // Crossing capsules touch at a single point
+        const Fl::Quaternion crossed =
+            Fl::Quaternion::FromAxisAngle(Fl::Vector3::UnitX(), std::numbers::pi_v<float> / 2.f);
+        const Fl::ContactManifold& crossing =
+            CollidePair(narrowphase, {&capsule, {0.f, 0.f, 0.f}, lying}, {&capsule, {0.f, 0.45f, 0.f}, crossed});
+        REQUIRE(crossing.pointCount == 1);
+        CHECK(crossing.points[0].depth == Catch::Approx(0.05f).margin(1e-3f));
+    }
+
+    WHEN("Comparing the SIMD routines with GJK") {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> offset(-1.5f, 1.5f);
+
+        const Fl::SphereShape sphere(0.4f);
+        const Fl::CapsuleShape capsule(0.6f, 0.3f);
+        const Fl::BoxShape box({0.7f, 0.4f, 0.5f});
+
+        // Lanes mix touching, speculative and separated pairs, the last batch being partial
+        std::vector<Fl::CollisionBody> bodies;
+        std::vector<Fl::BroadphasePair> pairs;
+        for (std::size_t i = 0; i < 150; ++i) {
+            const Fl::Shape* other = (i % 3 == 0) ? static_cast<const Fl::Shape*>(&sphere)
+                                                  : ((i % 3 == 1) ? static_cast<const Fl::Shape*>(&capsule) : &box);
+            bodies.push_back({&sphere, {offset(rng), offset(rng), offset(rng)}, identity});
+            bodies.push_back({other, {0.f, 0.f, 0.f}, RandomRotation(rng)});
+            pairs.push_back({static_cast<Fl::UInt32>(2 * i), static_cast<Fl::UInt32>(2 * i + 1)});
+        }
+
+        narrowphase.Collide(bodies, pairs);
+
+        std::size_t checkedCount = 0;
+        for (const Fl::BroadphasePair& pair : pairs) {
+            const Fl::CollisionBody& sphereBody = bodies[pair.first];
+            const Fl::CollisionBody& otherBody = bodies[pair.second];
+
+            const auto sphereSupport = [&](const Fl::Vector3&) { return sphereBody.position; };
+            const auto otherSupport = [&](const Fl::Vector3& direction) {
+                const Fl::Vector3 localDirection = otherBody.rotation.GetConjugate() * direction;
+                Fl::Vector3 support = Fl::Vector3::Zero();
+                if (otherBody.shape == &capsule) {
+                    support = capsule.GetSupport(localDirection);
+                } else if (otherBody.shape == &box) {
+                    support = box.GetSupport(localDirection);
+                }
+
+                return otherBody.position + otherBody.rotation * support;
+            };
+
+            const float otherRadius = (otherBody.shape == &sphere) ? sphere.GetRadius()
+                                      : ((otherBody.shape == &capsule) ? capsule.GetRadius() : 0.f);
+            const Fl::GjkResult distance = Fl::ComputeGjkDistance(sphereSupport, otherSupport, Fl::Vector3::UnitX());
+            const Fl::ContactManifold* manifold = narrowphase.FindManifold(pair.first, pair.second);
+
+            // Centers inside boxes are beyond GJK on the cores, their depth is checked by the sphere box case
+            if (distance.overlapping) {
+                CHECK(manifold);
+                continue;
+            }
+
+            const float expectedDepth = sphere.GetRadius() + otherRadius - distance.distance;
+            if (expectedDepth < -narrowphase.GetContactMargin() - 1e-4f) {
+                CHECK_FALSE(manifold);
+                continue;
+            }
+
+            if (expectedDepth < -narrowphase.GetContactMargin() + 1e-4f) {
+                continue;
+            }
+
+            REQUIRE(manifold);
+            REQUIRE(manifold->pointCount == 1);
+            CHECK(manifold->points[0].depth == Catch::Approx(expectedDepth).margin(1e-3f));
+            CHECK(IsNear(manifold->normal, (distance.pointB - distance.pointA) / distance.distance));
+            ++checkedCount;
+        }
+
+        CHECK(checkedCount > 20);
+    }
+
+    WHEN("Colliding on a thread pool") {
+        Scene scene(2000, 12.f, 5);
+        REQUIRE(scene.pairs.size() > 500);
+
+        Fl::Narrowphase parallel(narrowphase.GetContactMargin());
+        Fl::ThreadPool threadPool(3);
+        for (int step = 0; step < 2; ++step) {
+            narrowphase.Collide(scene.bodies, scene.pairs);
+            parallel.Collide(scene.bodies, scene.pairs, &threadPool);
+        }
+
+        const std::span<const Fl::ContactManifold> expected = narrowphase.GetManifolds();
+        const std::span<const Fl::ContactManifold> manifolds = parallel.GetManifolds();
+        REQUIRE(manifolds.size() == expected.size());
+        CHECK(manifolds.size() > 100);
+
+        std::size_t pointCount = 0;
+        bool identical = true;
+        for (std::size_t i = 0; i < manifolds.size(); ++i) {
+            identical &= manifolds[i].GetKey() == expected[i].GetKey() &&
+                         manifolds[i].pointCount == expected[i].pointCount && manifolds[i].normal == expected[i].normal;
+            for (std::size_t j = 0; j < manifolds[i].pointCount && identical; ++j) {
+                identical &= manifolds[i].points[j].position == expected[i].points[j].position &&
+                             manifolds[i].points[j].depth == expected[i].points[j].depth &&
+                             manifolds[i].points[j].featureId == expected[i].points[j].featureId;
+            }
+
+            // Manifolds are sorted by key and only keep touching pairs
+            CHECK((i == 0 || manifolds[i - 1].GetKey() < manifolds[i].GetKey()));
+            CHECK(manifolds[i].pointCount > 0);
+            CHECK(std::abs(manifolds[i].normal.GetLength() - 1.f) < 1e-3f);
+            pointCount += manifolds[i].pointCount;
+        }
+
+        CHECK(identical);
+        CHECK(pointCount > manifolds.size());
+    }
+}
+
+TEST_CASE("Narrowphase benchmarks", "[Narrowphase][.benchmark]") {
+    Fl::ThreadPool threadPool;
+    Scene scene(50'000, 60.f, 42);
+
+    Fl::Narrowphase narrowphase;
+    BENCHMARK("Narrowphase, " + std::to_string(scene.pairs.size()) + " pairs") {
+        narrowphase.Collide(scene.bodies, scene.pairs);
+        return narrowphase.GetManifolds().size();
+    };
+
+    BENCHMARK("Narrowphase, thread pool, " + std::to_string(scene.pairs.size()) + " pairs") {
+        narrowphase.Collide(scene.bodies, scene.pairs, &threadPool);
+        return narrowphase.GetManifolds().size();
+    };
+}
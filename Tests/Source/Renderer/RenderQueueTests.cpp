@@ -0,0 +1,299 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Renderer/RenderQueue.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    struct SceneObject {
+        Fl::RenderKey key;
+        bool isTransparent;
+    };
+
+    // Pass 0 is opaque and pass 1 transparent, every layer having both
+    std::vector<SceneObject> GenerateObjects(const std::size_t count, std::mt19937& rng) {
+        std::uniform_int_distribution<Fl::UInt32> layer(0, 3);
+        std::uniform_int_distribution<Fl::UInt32> material(0, 199);
+        std::uniform_int_distribution<Fl::UInt32> mesh(0, 49);
+        std::uniform_real_distribution<float> depth(0.1f, 500.f);
+        std::bernoulli_distribution isTransparent(0.2);
+
+        std::vector<SceneObject> objects(count);
+        for (SceneObject& object : objects) {
+            object.isTransparent = isTransparent(rng);
+            object.key = Fl::RenderKey::Make(layer(rng), object.isTransparent ? 1 : 0, material(rng), mesh(rng),
+                                             depth(rng));
+        }
+
+        return objects;
+    }
+
+    void RecordObjects(Fl::RenderQueue& queue, const std::vector<SceneObject>& objects, Fl::ThreadPool* threadPool) {
+        queue.Record(objects.size(), threadPool, [&](Fl::RenderQueue::Recorder& recorder, const std::size_t first,
+                                                     const std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                recorder.Push(objects[i].key, static_cast<Fl::UInt32>(i));
+            }
+        });
+    }
+}
+
+SCENARIO("RenderKey", "[Renderer][RenderQueue]") {
+    WHEN("Encoding and decoding keys") {
+        const Fl::RenderKey key = Fl::RenderKey::Make(3, 7, 1234, 65535, 12.5f);
+        CHECK(Fl::RenderKey::DecodeLayer(key.Encode(Fl::DepthOrder::FrontToBack)) == 3);
+        CHECK(Fl::RenderKey::DecodePass(key.Encode(Fl::DepthOrder::BackToFront)) == 7);
+
+        for (const Fl::DepthOrder depthOrder : {Fl::DepthOrder::FrontToBack, Fl::DepthOrder::BackToFront}) {
+            const Fl::RenderKey decoded = Fl::RenderKey::Decode(key.Encode(depthOrder), depthOrder);
+            CHECK(decoded.layer == 3);
+            CHECK(decoded.pass == 7);
+            CHECK(decoded.material == 1234);
+            CHECK(decoded.mesh == 65535);
+            CHECK(decoded.depth == 12.5f);
+        }
+
+        // Depth keeps 8 significant bits
+        CHECK(Fl::RenderKey::QuantizeDepth(1.f) == 1.f);
+        CHECK(Fl::RenderKey::QuantizeDepth(1.005f) == 1.f);
+        CHECK(Fl::RenderKey::QuantizeDepth(-0.f) == 0.f);
+        CHECK(Fl::RenderKey::QuantizeDepth(300.7f) == 300.f);
+    }
+
+    WHEN("Comparing keys") {
+        const auto encode = [](const Fl::UInt32 layer, const Fl::UInt32 pass, const Fl::UInt32 material,
+                               const Fl::UInt32 mesh, const float depth, const Fl::DepthOrder depthOrder) {
+            return Fl::RenderKey::Make(layer, pass, material, mesh, depth).Encode(depthOrder);
+        };
+
+        constexpr Fl::DepthOrder FrontToBack = Fl::DepthOrder::FrontToBack;
+        constexpr Fl::DepthOrder BackToFront = Fl::DepthOrder::BackToFront;
+
+        // Layers, then passes come first
+        CHECK(encode(0, 9, 9, 9, 9.f, FrontToBack) < encode(1, 0, 0, 0, 0.f, FrontToBack));
+        CHECK(encode(1, 2, 9, 9, 9.f, FrontToBack) < encode(1, 3, 0, 0, 0.f, BackToFront));
+
+        // Opaque draws are sorted by state, then front to back
+        CHECK(encode(0, 0, 1, 9, 9.f, FrontToBack) < encode(0, 0, 2, 0, 0.f, FrontToBack));
+        CHECK(encode(0, 0, 1, 1, 9.f, FrontToBack) < encode(0, 0, 1, 2, 0.f, FrontToBack));
+        CHECK(encode(0, 0, 1, 1, 1.f, FrontToBack) < encode(0, 0, 1, 1, 2.f, FrontToBack));
+
+        // Transparent draws are sorted back to front first
+        CHECK(encode(0, 0, 9, 9, 2.f, BackToFront) < encode(0, 0, 0, 0, 1.f, BackToFront));
+        CHECK(encode(0, 0, 1, 9, 1.f, BackToFront) < encode(0, 0, 2, 0, 1.f, BackToFront));
+    }
+}
+
+SCENARIO("RenderQueue", "[Renderer][RenderQueue]") {
+    WHEN("Sorting draws recorded from several threads") {
+        std::mt19937 rng(42);
+        const std::vector<SceneObject> objects = GenerateObjects(100'000, rng);
+
+        Fl::RenderQueue queue;
+        queue.SetDepthOrder(1, Fl::DepthOrder::BackToFront);
+        CHECK(queue.GetDepthOrder(0) == Fl::DepthOrder::FrontToBack);
+        CHECK(queue.GetDepthOrder(1) == Fl::DepthOrder::BackToFront);
+
+        // Reference: stable sort of the draws in recording order
+        std::vector<Fl::RenderQueue::DrawItem> expected;
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            expected.push_back({objects[i].key.Encode(queue.GetDepthOrder(objects[i].key.pass)),
+                                static_cast<Fl::UInt32>(i)});
+        }
+
+        std::stable_sort(expected.begin(), expected.end(),
+                         [](const Fl::RenderQueue::DrawItem& lhs, const Fl::RenderQueue::DrawItem& rhs) {
+                             return lhs.key < rhs.key;
+                         });
+
+        const auto checkSortedItems = [&](const Fl::RenderQueue& renderQueue) {
+            const std::span<const Fl::RenderQueue::DrawItem> items = renderQueue.GetSortedItems();
+            REQUIRE(items.size() == expected.size());
+            CHECK(std::equal(items.begin(), items.end(), expected.begin(),
+                             [](const Fl::RenderQueue::DrawItem& lhs, const Fl::RenderQueue::DrawItem& rhs) {
+                                 return lhs.key == rhs.key && lhs.instance == rhs.instance;
+                             }));
+        };
+
+        RecordObjects(queue, objects, nullptr);
+        CHECK(queue.GetRecorderCount() == (objects.size() + Fl::RenderQueue::RecordBatchSize - 1) /
+                                              Fl::RenderQueue::RecordBatchSize);
+        queue.Sort();
+        checkSortedItems(queue);
+
+        const Fl::RenderQueue::Statistics& statistics = queue.GetStatistics();
+        CHECK(statistics.itemCount == objects.size());
+        CHECK(statistics.radixPassCount < 8); // Layers and passes use a few bits of their bytes
+
+        Fl::ThreadPool threadPool(3);
+        queue.Clear();
+        CHECK(queue.GetSortedItems().empty());
+
+        RecordObjects(queue, objects, &threadPool);
+        queue.Sort(&threadPool);
+        checkSortedItems(queue);
+    }
+
+    WHEN("Replaying sorted draws") {
+        Fl::RenderQueue queue;
+        queue.SetDepthOrder(1, Fl::DepthOrder::BackToFront);
+
+        Fl::RenderQueue::Recorder& recorder = queue.GetRecorder(1);
+        recorder.Push(Fl::RenderKey::Make(0, 1, 5, 2, 10.f), 0); // Transparent, far
+        recorder.Push(Fl::RenderKey::Make(0, 0, 4, 3, 8.f), 1);
+        recorder.Push(Fl::RenderKey::Make(0, 0, 4, 3, 2.f), 2);
+        recorder.Push(Fl::RenderKey::Make(0, 0, 3, 3, 5.f), 3);
+        recorder.Push(Fl::RenderKey::Make(0, 1, 5, 2, 1.f), 4); // Transparent, near
+        recorder.Push(Fl::RenderKey::Make(0, 1, 5, 2, 3.f), 5);
+        recorder.Push(Fl::RenderKey::Make(1, 0, 3, 3, 1.f), 6);
+        queue.GetRecorder(0).Push(Fl::RenderKey::Make(0, 0, 4, 1, 9.f), 7);
+
+        queue.Sort();
+
+        Fl::RenderCommandStream stream;
+        stream.instances.push_back(42);
+        queue.Replay(stream);
+
+        CHECK(stream.instances == std::vector<Fl::UInt32>{3, 7, 2, 1, 0, 5, 4, 6});
+
+        using Fl::RenderCommandType;
+        const std::vector<RenderCommandType> expectedTypes = {
+            RenderCommandType::BeginPass, RenderCommandType::SetMaterial, RenderCommandType::Draw,
+            RenderCommandType::SetMaterial, RenderCommandType::Draw, RenderCommandType::Draw,
+            RenderCommandType::BeginPass, RenderCommandType::SetMaterial, RenderCommandType::Draw,
+            RenderCommandType::BeginPass, RenderCommandType::SetMaterial, RenderCommandType::Draw};
+
+        REQUIRE(stream.commands.size() == expectedTypes.size());
+        for (std::size_t i = 0; i < expectedTypes.size(); ++i) {
+            CHECK(stream.commands[i].type == expectedTypes[i]);
+        }
+
+        // Opaque pass of layer 0: material 3, then material 4 with mesh 1, then both instances of mesh 3
+        CHECK(stream.commands[1].material == 3);
+        CHECK(stream.commands[3].material == 4);
+        CHECK(stream.commands[4].mesh == 1);
+        CHECK(stream.commands[5].mesh == 3);
+        CHECK(stream.commands[5].firstInstance == 2);
+        CHECK(stream.commands[5].instanceCount == 2);
+
+        // Transparent pass: one draw of the three instances, back to front
+        CHECK(stream.commands[6].layer == 0);
+        CHECK(stream.commands[6].pass == 1);
+        CHECK(stream.commands[8].firstInstance == 4);
+        CHECK(stream.commands[8].instanceCount == 3);
+
+        CHECK(stream.commands[9].layer == 1);
+        CHECK(stream.commands[9].pass == 0);
+
+        CHECK(queue.GetStatistics().commandCount == stream.commands.size());
+        CHECK(queue.GetStatistics().drawCommandCount == 5);
+    }
+
+    WHEN("Sorting an empty queue") {
+        Fl::RenderQueue queue;
+        queue.Sort();
+
+        Fl::RenderCommandStream stream;
+        queue.Replay(stream);
+        CHECK(stream.commands.empty());
+        CHECK(queue.GetStatistics().radixPassCount == 0);
+    }
+}
+
+TEST_CASE("RenderQueue benchmarks", "[.benchmark]") {
+    std::mt19937 rng(42);
+    const std::vector<SceneObject> objects = GenerateObjects(500'000, rng);
+
+    Fl::ThreadPool threadPool;
+    Fl::RenderQueue queue;
+    queue.SetDepthOrder(1, Fl::DepthOrder::BackToFront);
+    Fl::RenderCommandStream stream;
+
+    // Baseline: draws submitted through virtual calls on heap objects, sorted by comparisons
+    struct Drawable {
+        virtual ~Drawable() = default;
+        virtual Fl::UInt64 GetSortKey() const = 0;
+    };
+
+    struct MeshDrawable final : Drawable {
+        explicit MeshDrawable(const Fl::UInt64 key) :
+        key(key) {
+        }
+
+        Fl::UInt64 GetSortKey() const override {
+            return key;
+        }
+
+        Fl::UInt64 key;
+    };
+
+    std::vector<std::unique_ptr<Drawable>> drawables;
+    for (const SceneObject& object : objects) {
+        drawables.push_back(std::make_unique<MeshDrawable>(object.key.Encode(queue.GetDepthOrder(object.key.pass))));
+    }
+
+    std::shuffle(drawables.begin(), drawables.end(), rng);
+    std::vector<Drawable*> drawList;
+
+    BENCHMARK("Virtual calls and std::sort, 500K draws") {
+        drawList.clear();
+        for (const std::unique_ptr<Drawable>& drawable : drawables) {
+            drawList.push_back(drawable.get());
+        }
+
+        std::sort(drawList.begin(), drawList.end(), [](const Drawable* lhs, const Drawable* rhs) {
+            return lhs->GetSortKey() < rhs->GetSortKey();
+        });
+
+        return drawList.front();
+    };
+
+    std::vector<Fl::RenderQueue::DrawItem> items;
+    for (std::size_t i = 0; i < drawables.size(); ++i) {
+        items.push_back({drawables[i]->GetSortKey(), static_cast<Fl::UInt32>(i)});
+    }
+
+    std::vector<Fl::RenderQueue::DrawItem> sortedItems;
+    BENCHMARK("std::sort, 500K draws") {
+        sortedItems = items;
+        std::sort(sortedItems.begin(), sortedItems.end(),
+                  [](const Fl::RenderQueue::DrawItem& lhs, const Fl::RenderQueue::DrawItem& rhs) {
+                      return lhs.key < rhs.key;
+                  });
+
+        return sortedItems.front().instance;
+    };
+
+    for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+        const char* suffix = pool ? ", thread pool, 500K draws" : ", 500K draws";
+
+        BENCHMARK(std::string("Record") + suffix) {
+            queue.Clear();
+            RecordObjects(queue, objects, pool);
+            return queue.GetRecorderCount();
+        };
+
+        BENCHMARK(std::string("Sort") + suffix) {
+            queue.Sort(pool);
+            return queue.GetStatistics().radixPassCount;
+        };
+
+        BENCHMARK(std::string("Record, sort and replay") + suffix) {
+            queue.Clear();
+            RecordObjects(queue, objects, pool);
+            queue.Sort(pool);
+            queue.Replay(stream);
+            return stream.commands.size();
+        };
+    }
+}
@@ -0,0 +1,610 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/Matrix4.hpp>
+#include <FlashlightEngine/Renderer/SoftwareRasterizer.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    using ClipVertex = Fl::SoftwareRasterizer::ClipVertex;
+    using Fragments = Fl::SoftwareRasterizer::Fragments;
+    using FragmentColors = Fl::SoftwareRasterizer::FragmentColors;
+
+    struct Mesh {
+        std::vector<Fl::Vector3> positions;
+        std::vector<Fl::Vector3> attributes; //< Colors or normals
+        std::vector<Fl::UInt32> indices;
+
+        void AddQuad(const Fl::Vector3& center, const Fl::Vector3& u, const Fl::Vector3& v,
+                     const Fl::Vector3& attribute) {
+            // Counter-clockwise seen from the side u x v points to
+            const auto first = static_cast<Fl::UInt32>(positions.size());
+            for (const Fl::Vector3& corner : {center - u - v, center + u - v, center + u + v, center - u + v}) {
+                positions.push_back(corner);
+                attributes.push_back(attribute);
+            }
+
+            for (const Fl::UInt32 index : {0u, 1u, 2u, 0u, 2u, 3u}) {
+                indices.push_back(first + index);
+            }
+        }
+    };
+
+    void TransformToClip(const Fl::Matrix4& matrix, const Fl::Vector3& position, ClipVertex& vertex) {
+        float* const outputs[4] = {&vertex.x, &vertex.y, &vertex.z, &vertex.w};
+        for (std::size_t row = 0; row < 4; ++row) {
+            *outputs[row] = matrix.GetElement(row, 0) * position.x + matrix.GetElement(row, 1) * position.y +
+                            matrix.GetElement(row, 2) * position.z + matrix.GetElement(row, 3);
+        }
+    }
+
+    Fl::SoftwareRasterizer::DrawCall MakeColoredDrawCall(const Mesh& mesh) {
+        Fl::SoftwareRasterizer::DrawCall drawCall;
+        drawCall.indices = mesh.indices;
+        drawCall.vertexCount = static_cast<Fl::UInt32>(mesh.positions.size());
+        drawCall.varyingCount = 3;
+        drawCall.fragmentShader = [](const Fragments& fragments, FragmentColors& colors) {
+            colors = {fragments.varyings[0], fragments.varyings[1], fragments.varyings[2], Fl::SimdFloat4::Splat(1.f)};
+        };
+
+        return drawCall;
+    }
+
+    // Two triangles crossing each other, given in clip space with different w
+    void DrawCrossingTriangles(Fl::Framebuffer& framebuffer, Fl::ThreadPool* threadPool = nullptr) {
+        Mesh mesh;
+        mesh.positions = {{-0.9f, -0.8f, 0.1f}, {0.8f, -0.6f, 0.9f}, {-0.2f, 0.9f, 0.5f},
+                          {0.9f, 0.8f, 0.1f}, {-0.8f, 0.1f, 0.9f}, {0.7f, -0.9f, 0.5f}};
+        mesh.attributes = {{1.f, 0.f, 0.f}, {1.f, 1.f, 0.f}, {1.f, 0.f, 1.f},
+                           {0.f, 0.f, 1.f}, {0.f, 1.f, 1.f}, {0.f, 1.f, 0.f}};
+        mesh.indices = {0, 1, 2, 3, 4, 5};
+
+        Fl::SoftwareRasterizer::DrawCall drawCall = MakeColoredDrawCall(mesh);
+        drawCall.cullMode = Fl::CullMode::None;
+        drawCall.vertexShader = [&mesh](const Fl::UInt32 index, ClipVertex& vertex) {
+            const float w = 1.f + static_cast<float>(index % 3);
+            const Fl::Vector3& position = mesh.positions[index];
+            vertex = {position.x * w, position.y * w, position.z * w, w, {}};
+            for (std::size_t i = 0; i < 3; ++i) {
+                vertex.varyings[i] = (&mesh.attributes[index].x)[i];
+            }
+        };
+
+        Fl::SoftwareRasterizer rasterizer;
+        rasterizer.Draw(framebuffer, drawCall, threadPool);
+    }
+
+    // Checkered floor running behind the camera and a lit cube
+    void DrawScene(Fl::Framebuffer& framebuffer, Fl::ThreadPool* threadPool = nullptr) {
+        Mesh floor;
+        floor.AddQuad({0.f, -1.f, 0.f}, {0.f, 0.f, 40.f}, {40.f, 0.f, 0.f}, Fl::Vector3::UnitY());
+
+        Mesh cube;
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            for (const float sign : {-1.f, 1.f}) {
+                Fl::Vector3 normal = Fl::Vector3::Zero();
+                Fl::Vector3 u = Fl::Vector3::Zero();
+                Fl::Vector3 v = Fl::Vector3::Zero();
+                (&normal.x)[axis] = sign;
+                (&u.x)[(axis + 1) % 3] = sign;
+                (&v.x)[(axis + 2) % 3] = 1.f;
+                cube.AddQuad(normal, u, v, normal);
+            }
+        }
+
+        const float aspectRatio = static_cast<float>(framebuffer.GetWidth()) / framebuffer.GetHeight();
+        const Fl::Matrix4 viewProjection = Fl::Matrix4::Perspective(std::numbers::pi_v<float> / 3.f, aspectRatio,
+                                                                    0.5f, 100.f) *
+                                           Fl::Matrix4::Translate({0.f, -0.5f, -5.f});
+        const Fl::Matrix4 cubeTransform =
+            Fl::Matrix4::FromTransform({0.5f, 0.f, 0.f},
+                                       Fl::Quaternion::FromAxisAngle(Fl::Vector3(1.f, 2.f, 0.5f).GetNormal(), 0.8f),
+                                       Fl::Vector3(0.8f));
+
+        Fl::SoftwareRasterizer rasterizer;
+
+        Fl::SoftwareRasterizer::DrawCall floorCall;
+        floorCall.indices = floor.indices;
+        floorCall.vertexCount = static_cast<Fl::UInt32>(floor.positions.size());
+        floorCall.varyingCount = 2;
+        floorCall.vertexShader = [&](const Fl::UInt32 index, ClipVertex& vertex) {
+            TransformToClip(viewProjection, floor.positions[index], vertex);
+            vertex.varyings[0] = floor.positions[index].x;
+            vertex.varyings[1] = floor.positions[index].z;
+        };
+        floorCall.fragmentShader = [](const Fragments& fragments, FragmentColors& colors) {
+            alignas(16) float u[Fl::SimdFloat4::Width];
+            alignas(16) float v[Fl::SimdFloat4::Width];
+            alignas(16) float checker[Fl::SimdFloat4::Width];
+            fragments.varyings[0].StoreAligned(u);
+            fragments.varyings[1].StoreAligned(v);
+            for (std::size_t lane = 0; lane < Fl::SimdFloat4::Width; ++lane) {
+                const auto cell = static_cast<long>(std::floor(u[lane]) + std::floor(v[lane]));
+                checker[lane] = (cell % 2 == 0) ? 0.9f : 0.2f;
+            }
+
+            const Fl::SimdFloat4 value = Fl::SimdFloat4::LoadAligned(checker);
+            colors = {value, value, value * Fl::SimdFloat4::Splat(0.8f), Fl::SimdFloat4::Splat(1.f)};
+        };
+
+        rasterizer.Draw(framebuffer, floorCall, threadPool);
+
+        Fl::SoftwareRasterizer::DrawCall cubeCall = MakeColoredDrawCall(cube);
+        cubeCall.vertexShader = [&](const Fl::UInt32 index, ClipVertex& vertex) {
+            TransformToClip(viewProjection * cubeTransform, cube.positions[index], vertex);
+
+            const Fl::Vector3 normal =
+                (cubeTransform.TransformPoint(cube.attributes[index]) - cubeTransform.GetTranslation()).GetNormal();
+            for (std::size_t i = 0; i < 3; ++i) {
+                vertex.varyings[i] = (&normal.x)[i];
+            }
+        };
+        cubeCall.fragmentShader = [](const Fragments& fragments, FragmentColors& colors) {
+            const Fl::Vector3 light = Fl::Vector3(0.4f, 0.8f, 0.6f).GetNormal();
+            const Fl::SimdFloat4 lambert = fragments.varyings[0] * Fl::SimdFloat4::Splat(light.x) +
+                                           fragments.varyings[1] * Fl::SimdFloat4::Splat(light.y) +
+                                           fragments.varyings[2] * Fl::SimdFloat4::Splat(light.z);
+            const Fl::SimdFloat4 intensity = Fl::SimdFloat4::Max(lambert, Fl::SimdFloat4::Zero()) *
+                                                 Fl::SimdFloat4::Splat(0.8f) + Fl::SimdFloat4::Splat(0.2f);
+            colors = {intensity, intensity * Fl::SimdFloat4::Splat(0.5f), intensity * Fl::SimdFloat4::Splat(0.2f),
+                      Fl::SimdFloat4::Splat(1.f)};
+        };
+
+        rasterizer.Draw(framebuffer, cubeCall, threadPool);
+        CHECK(rasterizer.GetStatistics().culledTriangleCount >= 4); //< At least half the faces are back-facing
+    }
+
+    std::vector<Fl::UInt8> ToRgb(const Fl::Framebuffer& framebuffer) {
+        std::vector<Fl::UInt8> pixels;
+        for (Fl::UInt32 y = 0; y < framebuffer.GetHeight(); ++y) {
+            for (Fl::UInt32 x = 0; x < framebuffer.GetWidth(); ++x) {
+                const Fl::Color color = framebuffer.GetColor(x, y);
+                for (const float channel : {color.r, color.g, color.b}) {
+                    pixels.push_back(static_cast<Fl::UInt8>(std::clamp(channel, 0.f, 1.f) * 255.f + 0.5f));
+                }
+            }
+        }
+
+        return pixels;
+    }
+
+    void WritePpm(const std::string& path, const Fl::UInt32 width, const Fl::UInt32 height,
+                  const std::vector<Fl::UInt8>& pixels) {
+        std::ofstream file(path, std::ios::binary);
+        file << "P6\n" << width << ' ' << height << "\n255\n";
+        file.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+    }
+
+    bool ReadPpm(const std::string& path, Fl::UInt32& width, Fl::UInt32& height, std::vector<Fl::UInt8>& pixels) {
+        std::ifstream file(path, std::ios::binary);
+        std::string magic;
+        int maxValue = 0;
+        if (!(file >> magic >> width >> height >> maxValue) || magic != "P6" || maxValue != 255) {
+            return false;
+        }
+
+        file.get();
+        pixels.resize(std::size_t(width) * height * 3);
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(pixels.data()),
+                                           static_cast<std::streamsize>(pixels.size())));
+    }
+
+    /**
+     * Compares the framebuffer against Tests/Resources/SoftwareRasterizer/<name>.ppm, tolerating small differences
+     * coming from the floating-point environment. Set FL_UPDATE_GOLDEN to regenerate the images.
+     */
+    void CheckGolden(const Fl::Framebuffer& framebuffer, const std::string& name) {
+        const std::string path = std::string(FL_TEST_RESOURCE_DIRECTORY) + "/SoftwareRasterizer/" + name + ".ppm";
+        const std::vector<Fl::UInt8> pixels = ToRgb(framebuffer);
+
+        if (std::getenv("FL_UPDATE_GOLDEN")) {
+            WritePpm(path, framebuffer.GetWidth(), framebuffer.GetHeight(), pixels);
+            return;
+        }
+
+        Fl::UInt32 width, height;
+        std::vector<Fl::UInt8> golden;
+        REQUIRE(ReadPpm(path, width, height, golden));
+        REQUIRE(width == framebuffer.GetWidth());
+        REQUIRE(height == framebuffer.GetHeight());
+
+        std::size_t mismatchCount = 0;
+        for (std::size_t pixel = 0; pixel < golden.size(); pixel += 3) {
+            for (std::size_t channel = 0; channel < 3; ++channel) {
+                if (std::abs(int(pixels[pixel + channel]) - int(golden[pixel + channel])) > 2) {
+                    ++mismatchCount;
+                    break;
+                }
+            }
+        }
+
+        // Pixels whose center lies on an edge may change of triangle
+        const std::size_t pixelCount = golden.size() / 3;
+        CHECK(mismatchCount <= pixelCount / 500);
+        if (mismatchCount > pixelCount / 500) {
+            WritePpm(name + ".actual.ppm", width, height, pixels);
+        }
+    }
+}
+
+SCENARIO("SoftwareRasterizer", "[Renderer][SoftwareRasterizer]") {
+    WHEN("Drawing triangles crossing each other") {
+        Fl::Framebuffer framebuffer(128, 96);
+        framebuffer.Clear(Fl::Color(0.1f, 0.1f, 0.1f));
+        DrawCrossingTriangles(framebuffer);
+
+        CheckGolden(framebuffer, "CrossingTriangles");
+    }
+
+    WHEN("Drawing a scene in perspective") {
+        Fl::Framebuffer framebuffer(160, 120);
+        framebuffer.Clear(Fl::Color(0.3f, 0.5f, 0.8f));
+        DrawScene(framebuffer);
+
+        CheckGolden(framebuffer, "Scene");
+
+        // The floor runs behind the camera, it is clipped and reaches the bottom of the screen
+        CHECK(framebuffer.GetColor(80, 119) != Fl::Color(0.3f, 0.5f, 0.8f));
+        CHECK(framebuffer.GetColor(80, 0).b == Catch::Approx(0.8f).margin(0.01f));
+    }
+
+    WHEN("Drawing on a thread pool") {
+        Fl::ThreadPool threadPool(3);
+
+        // Sizes which aren't multiples of the tile size
+        Fl::Framebuffer framebuffer(333, 150);
+        Fl::Framebuffer parallelFramebuffer(333, 150);
+        for (Fl::Framebuffer* target : {&framebuffer, &parallelFramebuffer}) {
+            target->Clear(Fl::Color::Black());
+            DrawScene(*target, (target == &framebuffer) ? nullptr : &threadPool);
+            DrawCrossingTriangles(*target, (target == &framebuffer) ? nullptr : &threadPool);
+        }
+
+        CHECK(std::ranges::equal(framebuffer.GetColorData(), parallelFramebuffer.GetColorData()));
+        CHECK(std::ranges::equal(framebuffer.GetDepthData(), parallelFramebuffer.GetDepthData()));
+    }
+
+    WHEN("Drawing a mesh without gaps or overlaps") {
+        constexpr Fl::UInt32 Width = 200;
+        constexpr Fl::UInt32 Height = 150;
+        constexpr std::size_t GridSize = 23;
+
+        // Jittered grid running past the screen edges, the counter of every pixel is incremented by its fragments
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> jitter(-0.3f, 0.3f);
+
+        std::vector<Fl::Vector3> positions;
+        for (std::size_t y = 0; y <= GridSize; ++y) {
+            for (std::size_t x = 0; x <= GridSize; ++x) {
+                const bool isBorder = x == 0 || y == 0 || x == GridSize || y == GridSize;
+                const float offsetX = isBorder ? 0.f : jitter(rng);
+                const float offsetY = isBorder ? 0.f : jitter(rng);
+                positions.emplace_back(2.4f * (static_cast<float>(x) + offsetX) / GridSize - 1.2f,
+                                       2.4f * (static_cast<float>(y) + offsetY) / GridSize - 1.2f, 0.5f);
+            }
+        }
+
+        std::vector<Fl::UInt32> indices;
+        for (Fl::UInt32 y = 0; y < GridSize; ++y) {
+            for (Fl::UInt32 x = 0; x < GridSize; ++x) {
+                const Fl::UInt32 corner = y * (GridSize + 1) + x;
+                const Fl::UInt32 next = corner + GridSize + 1;
+                indices.insert(indices.end(), {corner, corner + 1, next + 1, corner, next + 1, next});
+            }
+        }
+
+        std::vector<int> counters(Width * Height, 0);
+        Fl::SoftwareRasterizer::DrawCall drawCall;
+        drawCall.indices = indices;
+        drawCall.vertexCount = static_cast<Fl::UInt32>(positions.size());
+        drawCall.depthTest = false;
+        drawCall.vertexShader = [&](const Fl::UInt32 index, ClipVertex& vertex) {
+            vertex = {positions[index].x, positions[index].y, positions[index].z, 1.f, {}};
+        };
+        drawCall.fragmentShader = [&counters](const Fragments& fragments, FragmentColors& colors) {
+            alignas(16) float x[Fl::SimdFloat4::Width];
+            alignas(16) float y[Fl::SimdFloat4::Width];
+            fragments.x.StoreAligned(x);
+            fragments.y.StoreAligned(y);
+            for (std::size_t lane = 0; lane < Fl::SimdFloat4::Width; ++lane) {
+                if (fragments.mask & (1 << lane)) {
+                    ++counters[static_cast<std::size_t>(y[lane]) * Width + static_cast<std::size_t>(x[lane])];
+                }
+            }
+
+            colors = {};
+        };
+
+        Fl::ThreadPool threadPool(3);
+        Fl::Framebuffer framebuffer(Width, Height);
+        Fl::SoftwareRasterizer rasterizer;
+        rasterizer.Draw(framebuffer, drawCall, &threadPool);
+
+        CHECK(std::ranges::count(counters, 1) == static_cast<long>(counters.size()));
+        CHECK(rasterizer.GetStatistics().triangleCount == 2 * GridSize * GridSize);
+        CHECK(rasterizer.GetStatistics().tileCount == 4 * 3);
+
+        // A fan of thin triangles around a point which isn't on a pixel center
+        positions = {{0.013f, -0.027f, 0.5f}};
+        indices.clear();
+        constexpr Fl::UInt32 SliceCount = 37;
+        for (Fl::UInt32 slice = 0; slice < SliceCount; ++slice) {
+            const float angle = 2.f * std::numbers::pi_v<float> * static_cast<float>(slice) / SliceCount;
+            positions.emplace_back(0.013f + 0.7f * std::cos(angle), -0.027f + 0.9f * std::sin(angle), 0.5f);
+            indices.insert(indices.end(), {0, 1 + slice, 1 + (slice + 1) % SliceCount});
+        }
+
+        drawCall.indices = indices;
+        drawCall.vertexCount = static_cast<Fl::UInt32>(positions.size());
+        std::ranges::fill(counters, 0);
+        rasterizer.Draw(framebuffer, drawCall, &threadPool);
+
+        CHECK(std::ranges::count_if(counters, [](const int counter) { return counter > 1; }) == 0);
+        CHECK(counters[75 * Width + 101] == 1);
+        CHECK(counters[Height / 2 * Width + Width / 2 + 60] == 1);
+        CHECK(counters[Height / 2 * Width + Width / 2 + 75] == 0);
+    }
+
+    WHEN("Interpolating varyings") {
+        // Full-screen quad, its right side being three times further than its left side
+        const std::array<ClipVertex, 4> vertices = {ClipVertex{-1.f, -1.f, 0.5f, 1.f, {0.f}},
+                                                    ClipVertex{3.f, -3.f, 1.5f, 3.f, {1.f}},
+                                                    ClipVertex{3.f, 3.f, 1.5f, 3.f, {1.f}},
+                                                    ClipVertex{-1.f, 1.f, 0.5f, 1.f, {0.f}}};
+        const std::array<Fl::UInt32, 6> indices = {0, 1, 2, 0, 2, 3};
+
+        Fl::SoftwareRasterizer::DrawCall drawCall;
+        drawCall.indices = indices;
+        drawCall.vertexCount = 4;
+        drawCall.varyingCount = 1;
+        drawCall.vertexShader = [&vertices](const Fl::UInt32 index, ClipVertex& vertex) { vertex = vertices[index]; };
+        drawCall.fragmentShader = [](const Fragments& fragments, FragmentColors& colors) {
+            colors = {fragments.varyings[0], fragments.depth, Fl::SimdFloat4::Zero(), Fl::SimdFloat4::Splat(1.f)};
+        };
+
+        Fl::Framebuffer framebuffer(100, 20, Fl::ColorFormat::RGBA32F);
+        framebuffer.Clear(Fl::Color(-1.f, -1.f, -1.f));
+        Fl::SoftwareRasterizer rasterizer;
+        rasterizer.Draw(framebuffer, drawCall);
+
+        // Perspective-correct interpolation between u = 0 at w = 1 and u = 1 at w = 3
+        for (Fl::UInt32 x = 0; x < framebuffer.GetWidth(); ++x) {
+            const float s = (static_cast<float>(x) + 0.5f) / static_cast<float>(framebuffer.GetWidth());
+            const Fl::Color color = framebuffer.GetColor(x, 10);
+            CHECK(color.r == Catch::Approx((s / 3.f) / (1.f - s + s / 3.f)).margin(1e-4f));
+            CHECK(color.g == Catch::Approx(0.5f).margin(1e-6f));
+            CHECK(framebuffer.GetDepth(x, 10) == Catch::Approx(0.5f).margin(1e-6f));
+        }
+    }
+
+    WHEN("Culling and clipping triangles") {
+        std::array<ClipVertex, 3> vertices = {ClipVertex{-0.5f, -0.5f, 0.5f, 1.f, {}},
+                                              ClipVertex{0.5f, -0.5f, 0.5f, 1.f, {}},
+                                              ClipVertex{0.f, 0.5f, 0.5f, 1.f, {}}};
+        std::array<Fl::UInt32, 3> indices = {0, 1, 2};
+
+        Fl::SoftwareRasterizer::DrawCall drawCall;
+        drawCall.indices = indices;
+        drawCall.vertexCount = 3;
+        drawCall.vertexShader = [&vertices](const Fl::UInt32 index, ClipVertex& vertex) { vertex = vertices[index]; };
+        drawCall.fragmentShader = [](const Fragments&, FragmentColors& colors) {
+            colors = {Fl::SimdFloat4::Splat(1.f), Fl::SimdFloat4::Zero(), Fl::SimdFloat4::Zero(),
+                      Fl::SimdFloat4::Splat(1.f)};
+        };
+
+        Fl::Framebuffer framebuffer(64, 64);
+        Fl::SoftwareRasterizer rasterizer;
+        const auto draw = [&](const Fl::CullMode cullMode) {
+            framebuffer.Clear(Fl::Color::Black());
+            drawCall.cullMode = cullMode;
+            rasterizer.Draw(framebuffer, drawCall);
+            return framebuffer.GetColor(32, 32) == Fl::Color(1.f, 0.f, 0.f);
+        };
+
+        // Counter-clockwise
+        CHECK(draw(Fl::CullMode::Back));
+        CHECK_FALSE(draw(Fl::CullMode::Front));
+        CHECK(rasterizer.GetStatistics().culledTriangleCount == 1);
+        CHECK(draw(Fl::CullMode::None));
+
+        std::swap(indices[1], indices[2]);
+        CHECK_FALSE(draw(Fl::CullMode::Back));
+        CHECK(draw(Fl::CullMode::Front));
+
+        // Top vertex behind the camera: the triangle is cut by the near plane and spans the upper part of the screen
+        vertices[2] = {0.f, 2.f, -1.f, 0.5f, {}};
+        CHECK(draw(Fl::CullMode::None));
+        CHECK(rasterizer.GetStatistics().clippedTriangleCount == 1);
+        CHECK(rasterizer.GetStatistics().culledTriangleCount == 0);
+        CHECK(framebuffer.GetDepth(32, 32) >= 0.f);
+
+        // Entirely behind or past the far plane
+        for (ClipVertex& vertex : vertices) {
+            vertex.z = -0.5f;
+        }
+
+        CHECK_FALSE(draw(Fl::CullMode::None));
+        CHECK(rasterizer.GetStatistics().culledTriangleCount == 1);
+        CHECK(rasterizer.GetStatistics().tileCount == 0);
+
+        for (ClipVertex& vertex : vertices) {
+            vertex.z = 2.f;
+        }
+
+        CHECK_FALSE(draw(Fl::CullMode::None));
+    }
+
+    WHEN("Testing depth") {
+        std::array<ClipVertex, 6> vertices = {ClipVertex{-1.f, -1.f, 0.3f, 1.f, {}},
+                                              ClipVertex{1.f, -1.f, 0.3f, 1.f, {}},
+                                              ClipVertex{0.f, 1.f, 0.3f, 1.f, {}}};
+        std::array<Fl::UInt32, 3> indices = {0, 1, 2};
+
+        float red = 0.f;
+        Fl::SoftwareRasterizer::DrawCall drawCall;
+        drawCall.indices = indices;
+        drawCall.vertexCount = 3;
+        drawCall.vertexShader = [&vertices](const Fl::UInt32 index, ClipVertex& vertex) { vertex = vertices[index]; };
+        drawCall.fragmentShader = [&red](const Fragments&, FragmentColors& colors) {
+            colors = {Fl::SimdFloat4::Splat(red), Fl::SimdFloat4::Zero(), Fl::SimdFloat4::Zero(),
+                      Fl::SimdFloat4::Splat(1.f)};
+        };
+
+        Fl::Framebuffer framebuffer(32, 32, Fl::ColorFormat::RGBA8, Fl::DepthFormat::D16);
+        framebuffer.Clear(Fl::Color::Black());
+        Fl::SoftwareRasterizer rasterizer;
+
+        red = 1.f;
+        rasterizer.Draw(framebuffer, drawCall);
+        CHECK(framebuffer.GetDepth(16, 16) == Catch::Approx(0.3f).margin(1e-4f));
+
+        // Further away: hidden
+        red = 0.5f;
+        for (ClipVertex& vertex : vertices) {
+            vertex.z = 0.6f;
+        }
+
+        rasterizer.Draw(framebuffer, drawCall);
+        CHECK(framebuffer.GetColor(16, 16).r == 1.f);
+
+        // Without depth test but without depth write either
+        drawCall.depthTest = false;
+        drawCall.depthWrite = false;
+        rasterizer.Draw(framebuffer, drawCall);
+        CHECK(framebuffer.GetColor(16, 16).r == Catch::Approx(0.5f).margin(1.f / 255.f));
+        CHECK(framebuffer.GetDepth(16, 16) == Catch::Approx(0.3f).margin(1e-4f));
+
+        // Depth-only pass
+        drawCall.depthTest = true;
+        drawCall.depthWrite = true;
+        drawCall.fragmentShader = nullptr;
+        for (ClipVertex& vertex : vertices) {
+            vertex.z = 0.1f;
+        }
+
+        rasterizer.Draw(framebuffer, drawCall);
+        CHECK(framebuffer.GetColor(16, 16).r == Catch::Approx(0.5f).margin(1.f / 255.f));
+        CHECK(framebuffer.GetDepth(16, 16) == Catch::Approx(0.1f).margin(1e-4f));
+    }
+}
+
+SCENARIO("Framebuffer", "[Renderer][Framebuffer]") {
+    WHEN("Storing pixels in the different formats") {
+        const Fl::Color color(0.2f, 0.4f, 0.6f, 0.8f);
+
+        Fl::Framebuffer rgba(3, 2, Fl::ColorFormat::RGBA8);
+        rgba.Clear(color);
+        CHECK(rgba.GetColorData().size() == 3 * 2 * 4);
+        CHECK(rgba.GetColorData()[4] == 51);
+        CHECK(rgba.GetColorData()[6] == 153);
+
+        Fl::Framebuffer bgra(3, 2, Fl::ColorFormat::BGRA8);
+        bgra.Clear(color);
+        CHECK(bgra.GetColorData()[4] == 153);
+        CHECK(bgra.GetColorData()[6] == 51);
+        CHECK(bgra.GetColor(2, 1) == rgba.GetColor(2, 1));
+
+        // Values out of range are clamped by the normalized formats only
+        const Fl::Color bright(2.f, -1.f, 0.5f, 1.f);
+        Fl::Framebuffer hdr(3, 2, Fl::ColorFormat::RGBA32F, Fl::DepthFormat::D16);
+        hdr.SetColor(1, 1, bright);
+        rgba.SetColor(1, 1, bright);
+        CHECK(hdr.GetColor(1, 1) == bright);
+        CHECK(rgba.GetColor(1, 1) == Fl::Color(1.f, 0.f, 128.f / 255.f, 1.f));
+        CHECK(Fl::Framebuffer::GetBytesPerPixel(Fl::ColorFormat::RGBA32F) == 16);
+
+        hdr.SetDepth(2, 0, 0.25f);
+        CHECK(hdr.GetDepthData().size() == 3 * 2 * 2);
+        CHECK(hdr.GetDepth(2, 0) == Catch::Approx(0.25f).margin(1.f / 65535.f));
+        hdr.SetDepth(2, 0, 1.5f);
+        CHECK(hdr.GetDepth(2, 0) == 1.f);
+    }
+
+    WHEN("Transferring tiles") {
+        Fl::Framebuffer framebuffer(70, 65, Fl::ColorFormat::BGRA8);
+        framebuffer.Clear(Fl::Color::White(), 0.5f);
+        CHECK(framebuffer.GetTileCountX() == 2);
+        CHECK(framebuffer.GetTileCountY() == 2);
+
+        auto tile = std::make_unique<Fl::Framebuffer::Tile>();
+        framebuffer.LoadTile(1, 1, *tile);
+        CHECK(tile->depths[0] == 0.5f);
+        CHECK(tile->colors[2][Fl::Framebuffer::TileSize * 0 + 5] == 1.f);
+
+        tile->colors[0][5] = 0.f;
+        tile->depths[5] = 0.25f;
+        framebuffer.StoreTile(1, 1, *tile);
+        CHECK(framebuffer.GetColor(69, 64) == Fl::Color(0.f, 1.f, 1.f, 1.f));
+        CHECK(framebuffer.GetDepth(69, 64) == 0.25f);
+        CHECK(framebuffer.GetDepth(68, 64) == 0.5f);
+    }
+}
+
+TEST_CASE("SoftwareRasterizer benchmarks", "[SoftwareRasterizer][.benchmark]") {
+    Fl::ThreadPool threadPool;
+
+    // Grid of small triangles covering a 1080p screen, in front of a grid of larger ones
+    for (const std::size_t gridSize : {std::size_t(100), std::size_t(300)}) {
+        std::vector<Fl::UInt32> indices;
+        for (Fl::UInt32 layer = 0; layer < 2; ++layer) {
+            const Fl::UInt32 first = layer * Fl::UInt32((gridSize + 1) * (gridSize + 1));
+            for (Fl::UInt32 y = 0; y < gridSize; ++y) {
+                for (Fl::UInt32 x = 0; x < gridSize; ++x) {
+                    const Fl::UInt32 corner = first + y * Fl::UInt32(gridSize + 1) + x;
+                    const Fl::UInt32 next = corner + Fl::UInt32(gridSize + 1);
+                    indices.insert(indices.end(), {corner, corner + 1, next + 1, corner, next + 1, next});
+                }
+            }
+        }
+
+        Fl::SoftwareRasterizer::DrawCall drawCall;
+        drawCall.indices = indices;
+        drawCall.vertexCount = 2 * Fl::UInt32((gridSize + 1) * (gridSize + 1));
+        drawCall.varyingCount = 3;
+        drawCall.vertexShader = [gridSize](const Fl::UInt32 index, ClipVertex& vertex) {
+            const std::size_t layer = index / ((gridSize + 1) * (gridSize + 1));
+            const std::size_t corner = index % ((gridSize + 1) * (gridSize + 1));
+            const float u = static_cast<float>(corner % (gridSize + 1)) / static_cast<float>(gridSize);
+            const float v = static_cast<float>(corner / (gridSize + 1)) / static_cast<float>(gridSize);
+
+            // The front layer is drawn first: the back one fails the depth test
+            const float z = (layer == 0) ? 0.25f : 0.75f;
+            vertex = {2.f * u - 1.f, 2.f * v - 1.f, z, 1.f, {u, v, z}};
+        };
+        drawCall.fragmentShader = [](const Fragments& fragments, FragmentColors& colors) {
+            colors = {fragments.varyings[0], fragments.varyings[1], fragments.varyings[2], Fl::SimdFloat4::Splat(1.f)};
+        };
+
+        Fl::Framebuffer framebuffer(1920, 1080);
+        Fl::SoftwareRasterizer rasterizer;
+        const std::string suffix = std::to_string(indices.size() / 3000) + "K triangles at 1080p";
+
+        BENCHMARK("Draw, " + suffix) {
+            framebuffer.Clear(Fl::Color::Black());
+            rasterizer.Draw(framebuffer, drawCall);
+            return rasterizer.GetStatistics().binnedTriangleCount;
+        };
+
+        BENCHMARK("Draw, thread pool, " + suffix) {
+            framebuffer.Clear(Fl::Color::Black());
+            rasterizer.Draw(framebuffer, drawCall, &threadPool);
+            return rasterizer.GetStatistics().binnedTriangleCount;
+        };
+    }
+}
@@ -0,0 +1,290 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Scene/Bvh.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<Fl::Aabb> GenerateBoxes(const std::size_t count, const float worldSize, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-worldSize, worldSize);
+        std::uniform_real_distribution<float> size(0.1f, 2.f);
+
+        std::vector<Fl::Aabb> boxes(count);
+        for (Fl::Aabb& box : boxes) {
+            box = Fl::Aabb::FromCenterExtents({position(rng), position(rng), position(rng)},
+                                              {size(rng), size(rng), size(rng)});
+        }
+
+        return boxes;
+    }
+
+    std::vector<Fl::Ray> GenerateRays(const std::size_t count, const float worldSize, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-worldSize, worldSize);
+        std::uniform_real_distribution<float> direction(-1.f, 1.f);
+
+        std::vector<Fl::Ray> rays(count);
+        for (Fl::Ray& ray : rays) {
+            ray.origin = {position(rng), position(rng), position(rng)};
+            ray.direction = Fl::Vector3(direction(rng), direction(rng), direction(rng)).GetNormal();
+        }
+
+        return rays;
+    }
+
+    float BruteForceRayCast(const std::vector<Fl::Aabb>& boxes, const Fl::Ray& ray) {
+        float closest = std::numeric_limits<float>::infinity();
+        for (const Fl::Aabb& box : boxes) {
+            float distance;
+            if (box.Intersect(ray, closest, distance)) {
+                closest = std::min(closest, distance);
+            }
+        }
+
+        return closest;
+    }
+
+    std::vector<Fl::UInt32> BruteForceOverlaps(const std::vector<Fl::Aabb>& boxes, const Fl::Aabb& query) {
+        std::vector<Fl::UInt32> primitives;
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (boxes[i].Overlaps(query)) {
+                primitives.push_back(static_cast<Fl::UInt32>(i));
+            }
+        }
+
+        return primitives;
+    }
+
+    bool CheckQueries(const Fl::Bvh& bvh, const std::vector<Fl::Aabb>& boxes, const std::vector<Fl::Ray>& rays,
+                      const std::vector<Fl::Aabb>& queries) {
+        for (const Fl::Ray& ray : rays) {
+            const Fl::BvhRayHit hit = bvh.RayCast(ray);
+            if (hit.distance != BruteForceRayCast(boxes, ray)) {
+                return false;
+            }
+        }
+
+        for (const Fl::Aabb& query : queries) {
+            std::vector<Fl::UInt32> primitives;
+            bvh.QueryOverlaps(query, [&](const Fl::UInt32 primitive) { primitives.push_back(primitive); });
+            std::sort(primitives.begin(), primitives.end());
+
+            if (primitives != BruteForceOverlaps(boxes, query)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+SCENARIO("Bvh", "[Bvh]") {
+    std::mt19937 rng(42);
+
+    Fl::Bvh bvh;
+
+    WHEN("Querying an empty hierarchy") {
+        bvh.Build({});
+
+        CHECK(bvh.GetNodeCount() == 0);
+        CHECK_FALSE(bvh.GetBounds().IsValid());
+        CHECK(bvh.RayCast({Fl::Vector3::Zero(), Fl::Vector3::UnitX()}).primitive == Fl::Bvh::InvalidPrimitive);
+
+        bool called = false;
+        bvh.QueryOverlaps(Fl::Aabb{Fl::Vector3(-1.f), Fl::Vector3(1.f)}, [&](Fl::UInt32) { called = true; });
+        CHECK_FALSE(called);
+    }
+
+    WHEN("Casting rays and querying overlaps") {
+        const std::vector<Fl::Aabb> boxes = GenerateBoxes(5000, 50.f, rng);
+        bvh.Build(boxes);
+
+        CHECK(bvh.GetPrimitiveCount() == boxes.size());
+        CHECK(bvh.GetBounds().Contains(boxes.front()));
+        CHECK(CheckQueries(bvh, boxes, GenerateRays(500, 60.f, rng), GenerateBoxes(500, 50.f, rng)));
+
+        // Axis-aligned rays have null direction components
+        const Fl::Vector3 origin = boxes[10].GetCenter() - Fl::Vector3(100.f, 0.f, 0.f);
+        const Fl::BvhRayHit hit = bvh.RayCast({origin, Fl::Vector3::UnitX()});
+        CHECK(hit.primitive != Fl::Bvh::InvalidPrimitive);
+        CHECK(hit.distance == BruteForceRayCast(boxes, {origin, Fl::Vector3::UnitX()}));
+
+        // Hits beyond the maximum distance are ignored
+        CHECK(bvh.RayCast({origin, Fl::Vector3::UnitX()}, hit.distance * 0.5f).primitive == Fl::Bvh::InvalidPrimitive);
+    }
+
+    WHEN("Using a custom primitive intersection") {
+        const std::vector<Fl::Aabb> boxes = GenerateBoxes(1000, 20.f, rng);
+        bvh.Build(boxes);
+
+        // Only even primitives can be hit
+        const Fl::Ray ray{Fl::Vector3(-30.f, 0.f, 0.f), Fl::Vector3::UnitX()};
+        const auto intersectEven = [&](const Fl::UInt32 primitive, const Fl::Ray& r, const float maxDistance) {
+            float distance;
+            if (primitive % 2 == 0 && boxes[primitive].Intersect(r, maxDistance, distance)) {
+                return distance;
+            }
+
+            return std::numeric_limits<float>::infinity();
+        };
+
+        const Fl::BvhRayHit hit = bvh.RayCast(ray, 100.f, intersectEven);
+
+        REQUIRE(hit.primitive != Fl::Bvh::InvalidPrimitive);
+        CHECK(hit.primitive % 2 == 0);
+    }
+
+    WHEN("Building from coincident primitives") {
+        const std::vector<Fl::Aabb> boxes(100, Fl::Aabb{Fl::Vector3(-1.f), Fl::Vector3(1.f)});
+        bvh.Build(boxes);
+
+        std::vector<Fl::UInt32> primitives;
+        bvh.QueryOverlaps(Fl::Aabb{Fl::Vector3::Zero(), Fl::Vector3::Zero()},
+                          [&](const Fl::UInt32 primitive) { primitives.push_back(primitive); });
+        CHECK(primitives.size() == boxes.size());
+    }
+
+    WHEN("Moving primitives") {
+        std::vector<Fl::Aabb> boxes = GenerateBoxes(4000, 50.f, rng);
+        bvh.Build(boxes);
+
+        Fl::Bvh refitOnly = bvh;
+
+        // Primitives drift and some teleport, which degrades the initial tree
+        std::uniform_real_distribution<float> offset(-5.f, 5.f);
+        std::uniform_int_distribution<std::size_t> pick(0, boxes.size() - 1);
+        for (int frame = 0; frame < 10; ++frame) {
+            for (std::size_t i = 0; i < boxes.size() / 10; ++i) {
+                const auto primitive = static_cast<Fl::UInt32>(pick(rng));
+                const Fl::Vector3 move = (i % 8 == 0) ? Fl::Vector3(offset(rng), offset(rng), offset(rng)) * 10.f
+                                                      : Fl::Vector3(offset(rng), offset(rng), offset(rng));
+
+                boxes[primitive] = {boxes[primitive].min + move, boxes[primitive].max + move};
+                bvh.UpdatePrimitive(primitive, boxes[primitive]);
+                refitOnly.UpdatePrimitive(primitive, boxes[primitive]);
+            }
+
+            bvh.Refit();
+            refitOnly.Refit(false);
+        }
+
+        CHECK(CheckQueries(bvh, boxes, GenerateRays(300, 60.f, rng), GenerateBoxes(300, 50.f, rng)));
+        CHECK(CheckQueries(refitOnly, boxes, GenerateRays(300, 60.f, rng), GenerateBoxes(300, 50.f, rng)));
+
+        // Rotations keep the tree closer to a fresh build
+        Fl::Bvh rebuilt;
+        rebuilt.Build(boxes);
+        CHECK(bvh.GetSahCost() < refitOnly.GetSahCost());
+        CHECK(rebuilt.GetSahCost() < refitOnly.GetSahCost());
+    }
+
+    WHEN("Running batched queries") {
+        const std::vector<Fl::Aabb> boxes = GenerateBoxes(5000, 50.f, rng);
+        bvh.Build(boxes);
+
+        const std::vector<Fl::Ray> rays = GenerateRays(3000, 60.f, rng);
+        const std::vector<Fl::Aabb> queries = GenerateBoxes(3000, 50.f, rng);
+
+        Fl::ThreadPool threadPool(3);
+
+        std::vector<Fl::BvhRayHit> hits(rays.size());
+        std::vector<Fl::BvhRayHit> parallelHits(rays.size());
+        bvh.RayCast(rays, hits);
+        bvh.RayCast(rays, parallelHits, std::numeric_limits<float>::infinity(), &threadPool);
+
+        bool hitsMatch = true;
+        for (std::size_t i = 0; i < rays.size(); ++i) {
+            hitsMatch &= hits[i].primitive == parallelHits[i].primitive && hits[i].distance == parallelHits[i].distance &&
+                         hits[i].distance == BruteForceRayCast(boxes, rays[i]);
+        }
+        CHECK(hitsMatch);
+
+        std::vector<Fl::UInt32> primitives, offsets;
+        std::vector<Fl::UInt32> parallelPrimitives, parallelOffsets;
+        bvh.QueryOverlaps(queries, primitives, offsets);
+        bvh.QueryOverlaps(queries, parallelPrimitives, parallelOffsets, &threadPool);
+
+        CHECK(primitives == parallelPrimitives);
+        CHECK(offsets == parallelOffsets);
+        REQUIRE(offsets.size() == queries.size() + 1);
+
+        bool overlapsMatch = true;
+        for (std::size_t i = 0; i < queries.size(); ++i) {
+            std::vector<Fl::UInt32> queryPrimitives(primitives.begin() + offsets[i], primitives.begin() + offsets[i + 1]);
+            std::sort(queryPrimitives.begin(), queryPrimitives.end());
+            overlapsMatch &= queryPrimitives == BruteForceOverlaps(boxes, queries[i]);
+        }
+        CHECK(overlapsMatch);
+    }
+}
+
+TEST_CASE("Bvh benchmarks", "[Bvh][.benchmark]") {
+    Fl::ThreadPool threadPool;
+
+    for (const std::size_t primitiveCount : {std::size_t(100'000), std::size_t(1'000'000)}) {
+        std::mt19937 rng(42);
+
+        // Keep the density constant: about one primitive per 10x10x10 cell
+        const float worldSize = 5.f * std::cbrt(static_cast<float>(primitiveCount));
+        std::vector<Fl::Aabb> boxes = GenerateBoxes(primitiveCount, worldSize, rng);
+        const std::vector<Fl::Ray> rays = GenerateRays(100'000, worldSize, rng);
+        const std::vector<Fl::Aabb> queries = GenerateBoxes(100'000, worldSize, rng);
+        const std::string suffix = std::to_string(primitiveCount / 1000) + "K primitives";
+
+        Fl::Bvh bvh;
+        BENCHMARK("Build, " + suffix) {
+            bvh.Build(boxes);
+            return bvh.GetNodeCount();
+        };
+
+        std::vector<Fl::BvhRayHit> hits(rays.size());
+        BENCHMARK("100K ray casts, " + suffix) {
+            bvh.RayCast(rays, hits);
+            return hits.front().distance;
+        };
+
+        BENCHMARK("100K ray casts, thread pool, " + suffix) {
+            bvh.RayCast(rays, hits, std::numeric_limits<float>::infinity(), &threadPool);
+            return hits.front().distance;
+        };
+
+        std::vector<Fl::UInt32> primitives, offsets;
+        BENCHMARK("100K overlap queries, " + suffix) {
+            bvh.QueryOverlaps(queries, primitives, offsets);
+            return primitives.size();
+        };
+
+        BENCHMARK("100K overlap queries, thread pool, " + suffix) {
+            bvh.QueryOverlaps(queries, primitives, offsets, &threadPool);
+            return primitives.size();
+        };
+
+        // 10% of the primitives move each frame
+        std::uniform_int_distribution<std::size_t> pick(0, boxes.size() - 1);
+        std::uniform_real_distribution<float> offset(-0.5f, 0.5f);
+        std::vector<Fl::UInt32> moved(boxes.size() / 10);
+        for (Fl::UInt32& primitive : moved) {
+            primitive = static_cast<Fl::UInt32>(pick(rng));
+        }
+
+        BENCHMARK("Refit with rotations, 10% moving, " + suffix) {
+            for (const Fl::UInt32 primitive : moved) {
+                const Fl::Vector3 move(offset(rng), offset(rng), offset(rng));
+                boxes[primitive] = {boxes[primitive].min + move, boxes[primitive].max + move};
+                bvh.UpdatePrimitive(primitive, boxes[primitive]);
+            }
+
+            bvh.Refit();
+            return bvh.GetBounds().min.x;
+        };
+    }
+}
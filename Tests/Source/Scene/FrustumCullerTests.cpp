@@ -0,0 +1,272 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Math/Matrix4.hpp>
+#include <FlashlightEngine/Scene/FrustumCuller.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+    // Objects sorted by cell of a 2D grid, so consecutive objects are close to each other like in a real scene
+    std::vector<Fl::Vector3> GenerateCenters(const std::size_t count, const float worldSize, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-worldSize, worldSize);
+        std::uniform_real_distribution<float> height(-10.f, 10.f);
+
+        std::vector<Fl::Vector3> centers(count);
+        for (Fl::Vector3& center : centers) {
+            center = {position(rng), height(rng), position(rng)};
+        }
+
+        constexpr float CellSize = 16.f;
+        std::sort(centers.begin(), centers.end(), [&](const Fl::Vector3& lhs, const Fl::Vector3& rhs) {
+            const auto lhsCell = std::make_pair(std::floor(lhs.z / CellSize), std::floor(lhs.x / CellSize));
+            const auto rhsCell = std::make_pair(std::floor(rhs.z / CellSize), std::floor(rhs.x / CellSize));
+            return lhsCell < rhsCell;
+        });
+
+        return centers;
+    }
+
+    Fl::Frustum MakeFrustum(const Fl::Vector3& eye, const float farDistance) {
+        const Fl::Matrix4 projection = Fl::Matrix4::Perspective(std::numbers::pi_v<float> / 3.f, 16.f / 9.f, 0.1f,
+                                                                farDistance);
+        return Fl::Frustum::FromMatrix(projection * Fl::Matrix4::Translate(-eye));
+    }
+
+    std::vector<Fl::UInt32> ReferenceCull(const std::vector<Fl::Aabb>& boxes, const Fl::Frustum& frustum) {
+        std::vector<Fl::UInt32> visible;
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (frustum.Intersect(boxes[i]) != Fl::IntersectionType::Outside) {
+                visible.push_back(static_cast<Fl::UInt32>(i));
+            }
+        }
+
+        return visible;
+    }
+
+    std::vector<Fl::UInt32> ReferenceCull(const std::vector<Fl::Vector3>& centers, const std::vector<float>& radii,
+                                          const Fl::Frustum& frustum) {
+        std::vector<Fl::UInt32> visible;
+        for (std::size_t i = 0; i < centers.size(); ++i) {
+            if (frustum.Intersect(centers[i], radii[i]) != Fl::IntersectionType::Outside) {
+                visible.push_back(static_cast<Fl::UInt32>(i));
+            }
+        }
+
+        return visible;
+    }
+
+    std::vector<Fl::UInt32> GetIndices(const Fl::FrustumCuller::VisibilityList& visibilityList) {
+        std::vector<Fl::UInt32> indices;
+        visibilityList.CopyTo(indices);
+
+        return indices;
+    }
+}
+
+SCENARIO("Frustum", "[Frustum]") {
+    const Fl::Frustum frustum = MakeFrustum(Fl::Vector3::Zero(), 100.f);
+
+    WHEN("Testing points and volumes") {
+        CHECK(frustum.Intersect(Fl::Vector3(0.f, 0.f, -10.f), 0.f) == Fl::IntersectionType::Inside);
+        CHECK(frustum.Intersect(Fl::Vector3(0.f, 0.f, 10.f), 0.f) == Fl::IntersectionType::Outside);
+        CHECK(frustum.Intersect(Fl::Vector3(0.f, 0.f, -150.f), 0.f) == Fl::IntersectionType::Outside);
+        CHECK(frustum.Intersect(Fl::Vector3(0.f, 0.f, -100.f), 1.f) == Fl::IntersectionType::Intersecting);
+
+        CHECK(frustum.Intersect(Fl::Aabb::FromCenterExtents({0.f, 0.f, -50.f}, Fl::Vector3(1.f))) ==
+              Fl::IntersectionType::Inside);
+        CHECK(frustum.Intersect(Fl::Aabb::FromCenterExtents({0.f, 0.f, 0.f}, Fl::Vector3(1.f))) ==
+              Fl::IntersectionType::Intersecting);
+        CHECK(frustum.Intersect(Fl::Aabb::FromCenterExtents({200.f, 0.f, -50.f}, Fl::Vector3(1.f))) ==
+              Fl::IntersectionType::Outside);
+    }
+
+    WHEN("Extracting planes") {
+        // Planes point toward the inside of the frustum
+        CHECK(frustum.GetPlane(Fl::FrustumPlane::Near).normal.z < 0.f);
+        CHECK(frustum.GetPlane(Fl::FrustumPlane::Far).normal.z > 0.f);
+        CHECK(frustum.GetPlane(Fl::FrustumPlane::Left).normal.x > 0.f);
+        CHECK(frustum.GetPlane(Fl::FrustumPlane::Right).normal.x < 0.f);
+        CHECK(std::abs(frustum.GetPlane(Fl::FrustumPlane::Far).GetSignedDistance({0.f, 0.f, -100.f})) < 1e-3f);
+    }
+}
+
+SCENARIO("FrustumCuller", "[FrustumCuller]") {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> size(0.1f, 3.f);
+
+    const std::vector<Fl::Vector3> centers = GenerateCenters(20'000, 300.f, rng);
+    const std::vector<Fl::Frustum> frusta = {MakeFrustum(Fl::Vector3::Zero(), 200.f),
+                                             MakeFrustum(Fl::Vector3(100.f, 0.f, 150.f), 100.f),
+                                             MakeFrustum(Fl::Vector3(-250.f, 5.f, 0.f), 400.f)};
+
+    Fl::ThreadPool threadPool(3);
+
+    WHEN("Culling boxes") {
+        std::vector<Fl::Aabb> boxes(centers.size());
+        for (std::size_t i = 0; i < centers.size(); ++i) {
+            boxes[i] = Fl::Aabb::FromCenterExtents(centers[i], {size(rng), size(rng), size(rng)});
+        }
+
+        Fl::FrustumCuller culler(Fl::BoundingVolumeType::Box);
+        culler.Reserve(boxes.size());
+        for (const Fl::Aabb& box : boxes) {
+            culler.AddBox(box);
+        }
+
+        CHECK(culler.GetCount() == boxes.size());
+        // Objects are stored as center and extents, the bounds may differ by a rounding error
+        const Fl::Aabb bounds = culler.GetBounds(7);
+        CHECK((bounds.min - boxes[7].min).GetLength() < 1e-4f);
+        CHECK((bounds.max - boxes[7].max).GetLength() < 1e-4f);
+
+        std::vector<Fl::FrustumCuller::VisibilityList> visibilityLists(frusta.size());
+        const Fl::FrustumCuller::Statistics statistics = culler.Cull(frusta, visibilityLists);
+
+        bool matches = true;
+        for (std::size_t i = 0; i < frusta.size(); ++i) {
+            matches &= GetIndices(visibilityLists[i]) == ReferenceCull(boxes, frusta[i]);
+        }
+        CHECK(matches);
+
+        // Most clusters are resolved without testing their objects
+        CHECK(statistics.acceptedClusters > 0);
+        CHECK(statistics.rejectedClusters > statistics.testedClusters);
+
+        THEN("Multithreaded culling gives the same lists") {
+            std::vector<Fl::FrustumCuller::VisibilityList> parallelLists(frusta.size());
+            const Fl::FrustumCuller::Statistics parallelStatistics = culler.Cull(frusta, parallelLists, &threadPool);
+
+            CHECK(parallelStatistics.acceptedClusters == statistics.acceptedClusters);
+            CHECK(parallelStatistics.rejectedClusters == statistics.rejectedClusters);
+            CHECK(parallelStatistics.testedClusters == statistics.testedClusters);
+
+            for (std::size_t i = 0; i < frusta.size(); ++i) {
+                CHECK(GetIndices(parallelLists[i]) == GetIndices(visibilityLists[i]));
+                CHECK(parallelLists[i].GetBatchCount() ==
+                      (boxes.size() + Fl::FrustumCuller::BatchSize - 1) / Fl::FrustumCuller::BatchSize);
+            }
+        }
+
+        THEN("Moving objects updates their cluster") {
+            // Teleport objects far away from their cluster, in front of the first camera
+            for (std::size_t i = 0; i < boxes.size(); i += 97) {
+                boxes[i] = Fl::Aabb::FromCenterExtents({0.f, 0.f, -20.f - static_cast<float>(i % 50)}, Fl::Vector3(1.f));
+                culler.SetBox(static_cast<Fl::UInt32>(i), boxes[i]);
+            }
+
+            Fl::FrustumCuller::VisibilityList visibilityList;
+            culler.Cull(frusta.front(), visibilityList, &threadPool);
+
+            const std::vector<Fl::UInt32> visible = GetIndices(visibilityList);
+            CHECK(visible == ReferenceCull(boxes, frusta.front()));
+            CHECK(std::binary_search(visible.begin(), visible.end(), 97u * 100));
+        }
+    }
+
+    WHEN("Culling spheres") {
+        std::vector<float> radii(centers.size());
+        Fl::FrustumCuller culler(Fl::BoundingVolumeType::Sphere);
+        for (std::size_t i = 0; i < centers.size(); ++i) {
+            radii[i] = size(rng);
+            culler.AddSphere(centers[i], radii[i]);
+        }
+
+        // Object count not multiple of the SIMD width, the padding lanes must never be reported
+        culler.AddSphere(Fl::Vector3(0.f, 0.f, -10.f), 1.f);
+        culler.AddSphere(Fl::Vector3(0.f, 0.f, 50.f), 1.f);
+        radii.insert(radii.end(), {1.f, 1.f});
+        std::vector<Fl::Vector3> allCenters = centers;
+        allCenters.insert(allCenters.end(), {Fl::Vector3(0.f, 0.f, -10.f), Fl::Vector3(0.f, 0.f, 50.f)});
+
+        std::vector<Fl::FrustumCuller::VisibilityList> visibilityLists(frusta.size());
+        culler.Cull(frusta, visibilityLists, &threadPool);
+
+        for (std::size_t i = 0; i < frusta.size(); ++i) {
+            CHECK(GetIndices(visibilityLists[i]) == ReferenceCull(allCenters, radii, frusta[i]));
+        }
+
+        std::size_t visitedCount = 0;
+        visibilityLists.front().ForEach([&](Fl::UInt32) { ++visitedCount; });
+        CHECK(visitedCount == visibilityLists.front().GetCount());
+    }
+
+    WHEN("Culling nothing") {
+        Fl::FrustumCuller culler(Fl::BoundingVolumeType::Box);
+
+        Fl::FrustumCuller::VisibilityList visibilityList;
+        const Fl::FrustumCuller::Statistics statistics = culler.Cull(frusta.front(), visibilityList, &threadPool);
+
+        CHECK(visibilityList.GetCount() == 0);
+        CHECK(visibilityList.GetBatchCount() == 0);
+        CHECK(statistics.testedClusters == 0);
+    }
+}
+
+TEST_CASE("FrustumCuller benchmarks", "[FrustumCuller][.benchmark]") {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> size(0.1f, 3.f);
+
+    constexpr std::size_t ObjectCount = 1'000'000;
+    const std::vector<Fl::Vector3> centers = GenerateCenters(ObjectCount, 2000.f, rng);
+
+    Fl::FrustumCuller boxCuller(Fl::BoundingVolumeType::Box);
+    Fl::FrustumCuller sphereCuller(Fl::BoundingVolumeType::Sphere);
+    boxCuller.Reserve(ObjectCount);
+    sphereCuller.Reserve(ObjectCount);
+
+    std::vector<Fl::Aabb> boxes(ObjectCount);
+    for (std::size_t i = 0; i < ObjectCount; ++i) {
+        boxes[i] = Fl::Aabb::FromCenterExtents(centers[i], {size(rng), size(rng), size(rng)});
+        boxCuller.AddBox(boxes[i]);
+        sphereCuller.AddSphere(centers[i], size(rng));
+    }
+
+    const Fl::Frustum frustum = MakeFrustum(Fl::Vector3(0.f, 0.f, 1000.f), 1500.f);
+    const std::vector<Fl::Frustum> frusta = {frustum, MakeFrustum(Fl::Vector3(-500.f, 0.f, 0.f), 1000.f),
+                                             MakeFrustum(Fl::Vector3(500.f, 0.f, 0.f), 1000.f),
+                                             MakeFrustum(Fl::Vector3(0.f, 0.f, -500.f), 1000.f)};
+
+    Fl::ThreadPool threadPool;
+    Fl::FrustumCuller::VisibilityList visibilityList;
+    std::vector<Fl::FrustumCuller::VisibilityList> visibilityLists(frusta.size());
+
+    BENCHMARK("Scalar reference, 1M boxes") {
+        std::size_t visibleCount = 0;
+        for (const Fl::Aabb& box : boxes) {
+            visibleCount += frustum.Intersect(box) != Fl::IntersectionType::Outside;
+        }
+
+        return visibleCount;
+    };
+
+    BENCHMARK("1M boxes") {
+        boxCuller.Cull(frustum, visibilityList);
+        return visibilityList.GetCount();
+    };
+
+    BENCHMARK("1M boxes, thread pool") {
+        boxCuller.Cull(frustum, visibilityList, &threadPool);
+        return visibilityList.GetCount();
+    };
+
+    BENCHMARK("1M spheres, thread pool") {
+        sphereCuller.Cull(frustum, visibilityList, &threadPool);
+        return visibilityList.GetCount();
+    };
+
+    BENCHMARK("1M boxes, 4 frusta, thread pool") {
+        boxCuller.Cull(frusta, visibilityLists, &threadPool);
+        return visibilityLists.front().GetCount();
+    };
+}
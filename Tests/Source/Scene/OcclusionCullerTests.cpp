@@ -0,0 +1,328 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Scene/OcclusionCuller.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Mesh {
+        std::vector<Fl::Vector3> positions;
+        std::vector<Fl::UInt32> indices;
+
+        void AddQuad(const Fl::Vector3& center, const Fl::Vector3& u, const Fl::Vector3& v) {
+            const auto first = static_cast<Fl::UInt32>(positions.size());
+            for (const Fl::Vector3& corner : {center - u - v, center + u - v, center + u + v, center - u + v}) {
+                positions.push_back(corner);
+            }
+
+            for (const Fl::UInt32 index : {0u, 1u, 2u, 0u, 2u, 3u}) {
+                indices.push_back(first + index);
+            }
+        }
+    };
+
+    // Camera at the origin looking down -Z
+    Fl::Matrix4 MakeProjection(const Fl::OcclusionCuller& culler) {
+        const float aspectRatio = static_cast<float>(culler.GetWidth()) / static_cast<float>(culler.GetHeight());
+        return Fl::Matrix4::Perspective(std::numbers::pi_v<float> / 3.f, aspectRatio, 0.5f, 200.f);
+    }
+
+    // Scattered walls facing the camera at various angles, and boxes mostly behind them
+    void GenerateScene(Mesh& occluders, std::vector<Fl::Aabb>& boxes, const std::size_t wallCount,
+                       const std::size_t boxCount, std::mt19937& rng) {
+        std::uniform_real_distribution<float> lateral(-15.f, 15.f);
+        std::uniform_real_distribution<float> depth(-40.f, -5.f);
+        std::uniform_real_distribution<float> size(1.f, 6.f);
+        std::uniform_real_distribution<float> tilt(-0.6f, 0.6f);
+
+        for (std::size_t i = 0; i < wallCount; ++i) {
+            const Fl::Vector3 center(lateral(rng), 0.5f * lateral(rng), depth(rng));
+            occluders.AddQuad(center, Fl::Vector3(size(rng), 0.f, tilt(rng) * 4.f),
+                              Fl::Vector3(0.f, size(rng), tilt(rng) * 4.f));
+        }
+
+        std::uniform_real_distribution<float> boxDepth(-80.f, -3.f);
+        std::uniform_real_distribution<float> extent(0.1f, 1.5f);
+        for (std::size_t i = 0; i < boxCount; ++i) {
+            const Fl::Vector3 center(2.f * lateral(rng), lateral(rng), boxDepth(rng));
+            boxes.push_back(Fl::Aabb::FromCenterExtents(center, {extent(rng), extent(rng), extent(rng)}));
+        }
+    }
+
+    // Whether the segment from the camera to a point goes through a triangle of the mesh
+    bool IsHidden(const Mesh& mesh, const Fl::Vector3& point) {
+        const std::array<double, 3> direction = {point.x, point.y, point.z};
+
+        for (std::size_t i = 0; i < mesh.indices.size(); i += 3) {
+            std::array<std::array<double, 3>, 3> vertices;
+            for (std::size_t vertex = 0; vertex < 3; ++vertex) {
+                const Fl::Vector3& position = mesh.positions[mesh.indices[i + vertex]];
+                vertices[vertex] = {position.x, position.y, position.z};
+            }
+
+            // Möller-Trumbore from the origin
+            std::array<double, 3> edge1, edge2;
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                edge1[axis] = vertices[1][axis] - vertices[0][axis];
+                edge2[axis] = vertices[2][axis] - vertices[0][axis];
+            }
+
+            const auto cross = [](const std::array<double, 3>& lhs, const std::array<double, 3>& rhs) {
+                return std::array<double, 3>{lhs[1] * rhs[2] - lhs[2] * rhs[1], lhs[2] * rhs[0] - lhs[0] * rhs[2],
+                                             lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+            };
+            const auto dot = [](const std::array<double, 3>& lhs, const std::array<double, 3>& rhs) {
+                return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+            };
+
+            const std::array<double, 3> p = cross(direction, edge2);
+            const double determinant = dot(edge1, p);
+            if (std::abs(determinant) < 1e-12) {
+                continue;
+            }
+
+            const std::array<double, 3> t = {-vertices[0][0], -vertices[0][1], -vertices[0][2]};
+            const double u = dot(t, p) / determinant;
+            const std::array<double, 3> q = cross(t, edge1);
+            const double v = dot(direction, q) / determinant;
+            const double distance = dot(edge2, q) / determinant;
+            if (u >= 0.0 && v >= 0.0 && u + v <= 1.0 && distance > 0.0 && distance < 1.0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+SCENARIO("OcclusionCuller", "[Scene][OcclusionCuller]") {
+    WHEN("Culling boxes behind a wall") {
+        Fl::OcclusionCuller culler;
+        CHECK(culler.GetLevelCount() == 9);
+
+        const Fl::Matrix4 viewProjection = MakeProjection(culler);
+        culler.BeginFrame(viewProjection);
+
+        Mesh wall;
+        wall.AddQuad({0.f, 0.f, -10.f}, {3.f, 0.f, 0.f}, {0.f, 2.f, 0.f});
+        culler.AddOccluder(wall.positions, wall.indices, viewProjection);
+        culler.RenderOccluders();
+
+        // The wall covers the center of the screen, with a depth slightly further than its actual one
+        const float wallDepth = viewProjection.GetElement(2, 2) * -10.f + viewProjection.GetElement(2, 3);
+        const float centerDepth = culler.GetDepth(128, 72);
+        CHECK(centerDepth >= wallDepth / 10.f);
+        CHECK(centerDepth < wallDepth / 10.f + 1e-4f);
+        CHECK(culler.GetDepth(2, 2) == 1.f);
+
+        const std::size_t topLevel = culler.GetLevelCount() - 1;
+        CHECK(culler.GetMinDepth(topLevel, 0, 0) == centerDepth);
+        CHECK(culler.GetMaxDepth(topLevel, 0, 0) == 1.f);
+
+        const std::vector<Fl::Aabb> boxes = {
+            Fl::Aabb::FromCenterExtents({0.f, 0.f, -20.f}, Fl::Vector3(1.f)), // Behind
+            Fl::Aabb::FromCenterExtents({1.5f, -1.f, -12.f}, Fl::Vector3(0.5f)), // Behind
+            Fl::Aabb::FromCenterExtents({0.f, 0.f, -5.f}, Fl::Vector3(1.f)), // In front
+            Fl::Aabb::FromCenterExtents({10.f, 0.f, -20.f}, Fl::Vector3(1.f)), // Beside
+            Fl::Aabb::FromCenterExtents({0.f, 4.2f, -20.f}, Fl::Vector3(0.5f)), // Peeking over
+            Fl::Aabb::FromCenterExtents({0.f, 0.f, -10.f}, Fl::Vector3(1.f)), // Through
+            Fl::Aabb::FromCenterExtents({0.f, 0.f, 0.f}, Fl::Vector3(1.f)), // Crossing the near plane
+            Fl::Aabb::FromCenterExtents({0.f, 0.f, 10.f}, Fl::Vector3(1.f)) // Behind the camera
+        };
+
+        std::vector<Fl::UInt8> visibility(boxes.size());
+        CHECK(culler.TestOccludees(boxes, visibility) == 2);
+        CHECK(visibility == std::vector<Fl::UInt8>{0, 0, 1, 1, 1, 1, 1, 1});
+
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            CHECK(culler.IsOccluded(boxes[i]) == (visibility[i] == 0));
+        }
+
+        const Fl::OcclusionCuller::Statistics& statistics = culler.GetStatistics();
+        CHECK(statistics.occluderTriangleCount == 2);
+        CHECK(statistics.rasterizedTriangleCount == 2);
+        CHECK(statistics.occludeeCount == boxes.size());
+        CHECK(statistics.culledOccludeeCount == 2);
+        CHECK(statistics.GetCulledFraction() == 0.25f);
+        CHECK(statistics.rasterizationTime.count() > 0);
+        CHECK(statistics.testTime.count() > 0);
+
+        // A new frame forgets the occluders
+        culler.BeginFrame(viewProjection);
+        culler.RenderOccluders();
+        CHECK(culler.TestOccludees(boxes, visibility) == 0);
+        CHECK(culler.GetStatistics().occluderTriangleCount == 0);
+        CHECK(culler.GetStatistics().GetCulledFraction() == 0.f);
+    }
+
+    WHEN("Occluding with a ground crossing the near plane") {
+        Fl::OcclusionCuller culler;
+
+        // Looking slightly down at a ground running behind the camera
+        const Fl::Matrix4 viewProjection =
+            MakeProjection(culler) * Fl::Matrix4::FromTransform(Fl::Vector3::Zero(),
+                                                                 Fl::Quaternion::FromAxisAngle(Fl::Vector3::UnitX(),
+                                                                                               0.3f),
+                                                                 Fl::Vector3(1.f)) *
+            Fl::Matrix4::Translate({0.f, -2.f, 0.f});
+        culler.BeginFrame(viewProjection);
+
+        Mesh ground;
+        ground.AddQuad(Fl::Vector3::Zero(), {0.f, 0.f, 100.f}, {100.f, 0.f, 0.f});
+        culler.AddOccluder(ground.positions, ground.indices, viewProjection);
+        culler.RenderOccluders();
+
+        CHECK(culler.GetStatistics().rasterizedTriangleCount >= 2);
+        CHECK(culler.IsOccluded(Fl::Aabb::FromCenterExtents({0.f, -3.f, -20.f}, Fl::Vector3(1.f))));
+        CHECK(culler.IsOccluded(Fl::Aabb::FromCenterExtents({-5.f, -1.5f, -8.f}, Fl::Vector3(0.5f, 1.f, 0.5f))));
+        CHECK_FALSE(culler.IsOccluded(Fl::Aabb::FromCenterExtents({0.f, 1.f, -20.f}, Fl::Vector3(1.f))));
+        CHECK_FALSE(culler.IsOccluded(Fl::Aabb::FromCenterExtents({0.f, -0.5f, -20.f}, Fl::Vector3(1.f))));
+    }
+
+    WHEN("Comparing the scalar and SIMD paths") {
+        std::mt19937 rng(42);
+        Mesh occluders;
+        std::vector<Fl::Aabb> boxes;
+        GenerateScene(occluders, boxes, 60, 3000, rng);
+
+        Fl::ThreadPool threadPool(3);
+
+        std::vector<float> referenceDepths;
+        std::vector<Fl::UInt8> referenceVisibility;
+        for (const bool useSimd : {false, true}) {
+            for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+                Fl::OcclusionCuller culler({.width = 320, .height = 160, .useSimd = useSimd});
+                CHECK(culler.IsUsingSimd() == (useSimd && Fl::OcclusionCuller::HasSimdPath));
+
+                const Fl::Matrix4 viewProjection = MakeProjection(culler);
+                culler.BeginFrame(viewProjection);
+                culler.AddOccluder(occluders.positions, occluders.indices, viewProjection);
+                culler.RenderOccluders(pool);
+
+                std::vector<Fl::UInt8> visibility(boxes.size());
+                culler.TestOccludees(boxes, visibility, pool);
+
+                const std::vector<float> depths(culler.GetDepths().begin(), culler.GetDepths().end());
+                if (referenceDepths.empty()) {
+                    referenceDepths = depths;
+                    referenceVisibility = visibility;
+
+                    const float culledFraction = culler.GetStatistics().GetCulledFraction();
+                    CHECK(culledFraction > 0.1f);
+                    CHECK(culledFraction < 0.9f);
+                } else {
+                    CHECK(depths == referenceDepths);
+                    CHECK(visibility == referenceVisibility);
+                }
+            }
+        }
+    }
+
+    WHEN("Checking that culled boxes are hidden at the buffer resolution") {
+        std::mt19937 rng(7);
+        Mesh occluders;
+        std::vector<Fl::Aabb> boxes;
+        GenerateScene(occluders, boxes, 40, 1000, rng);
+
+        // Boxes going through the walls, partially in front of them
+        for (std::size_t i = 0; i < occluders.positions.size(); i += 4) {
+            const Fl::Vector3 center = (occluders.positions[i] + occluders.positions[i + 2]) * 0.5f;
+            boxes.push_back(Fl::Aabb::FromCenterExtents(center + Fl::Vector3(0.f, 0.f, -0.3f), Fl::Vector3(0.4f)));
+        }
+
+        Fl::OcclusionCuller culler;
+        const Fl::Matrix4 viewProjection = MakeProjection(culler);
+        culler.BeginFrame(viewProjection);
+        culler.AddOccluder(occluders.positions, occluders.indices, viewProjection);
+        culler.RenderOccluders();
+
+        std::vector<Fl::UInt8> visibility(boxes.size());
+        const std::size_t culledCount = culler.TestOccludees(boxes, visibility);
+        CHECK(culledCount > 100);
+
+        // Ray traced reference: the rays through the pixel centers must hit an occluder before any culled box
+        std::size_t visiblePixelCount = 0;
+        for (std::size_t y = 0; y < culler.GetHeight(); ++y) {
+            for (std::size_t x = 0; x < culler.GetWidth(); ++x) {
+                const double ndcX = (static_cast<double>(x) + 0.5) / culler.GetWidth() * 2.0 - 1.0;
+                const double ndcY = 1.0 - (static_cast<double>(y) + 0.5) / culler.GetHeight() * 2.0;
+                const std::array<double, 3> direction = {ndcX / viewProjection.GetElement(0, 0),
+                                                         ndcY / viewProjection.GetElement(1, 1), -1.0};
+
+                for (std::size_t i = 0; i < boxes.size(); ++i) {
+                    if (visibility[i] != 0) {
+                        continue;
+                    }
+
+                    double entry = 0.0;
+                    double exit = std::numeric_limits<double>::infinity();
+                    for (std::size_t axis = 0; axis < 3; ++axis) {
+                        const double first = (&boxes[i].min.x)[axis] / direction[axis];
+                        const double second = (&boxes[i].max.x)[axis] / direction[axis];
+                        entry = std::max(entry, std::min(first, second));
+                        exit = std::min(exit, std::max(first, second));
+                    }
+
+                    const Fl::Vector3 point(static_cast<float>(direction[0] * entry),
+                                            static_cast<float>(direction[1] * entry),
+                                            static_cast<float>(direction[2] * entry));
+                    if (entry <= exit && !IsHidden(occluders, point)) {
+                        ++visiblePixelCount;
+                    }
+                }
+            }
+        }
+
+        CHECK(visiblePixelCount == 0);
+    }
+}
+
+TEST_CASE("OcclusionCuller benchmarks", "[.benchmark]") {
+    std::mt19937 rng(42);
+    Mesh occluders;
+    std::vector<Fl::Aabb> boxes;
+    GenerateScene(occluders, boxes, 500, 20'000, rng);
+
+    Fl::ThreadPool threadPool;
+    std::vector<Fl::UInt8> visibility(boxes.size());
+
+    for (const bool useSimd : {false, true}) {
+        Fl::OcclusionCuller culler({.useSimd = useSimd});
+        const Fl::Matrix4 viewProjection = MakeProjection(culler);
+        const auto cull = [&](Fl::ThreadPool* pool) {
+            culler.BeginFrame(viewProjection);
+            culler.AddOccluder(occluders.positions, occluders.indices, viewProjection);
+            culler.RenderOccluders(pool);
+            return culler.TestOccludees(boxes, visibility, pool);
+        };
+
+        BENCHMARK(std::string(useSimd ? "SIMD" : "Scalar") + ", 1K occluder triangles, 20K occludees") {
+            return cull(nullptr);
+        };
+
+        BENCHMARK(std::string(useSimd ? "SIMD" : "Scalar") + ", thread pool, 1K occluder triangles, 20K occludees") {
+            return cull(&threadPool);
+        };
+
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        const Fl::OcclusionCuller::Statistics& statistics = culler.GetStatistics();
+        INFO("Culled " << statistics.GetCulledFraction() * 100.f << "%, rasterization "
+                       << Milliseconds(statistics.rasterizationTime).count() << " ms, tests "
+                       << Milliseconds(statistics.testTime).count() << " ms");
+        CHECK(statistics.GetCulledFraction() > 0.f);
+    }
+}
@@ -0,0 +1,261 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Scene/TransformHierarchy.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+    using TransformId = Fl::TransformHierarchy::TransformId;
+
+    // Reference world matrix, computed by walking up to the root
+    Fl::Matrix4 ComputeWorldMatrix(const Fl::TransformHierarchy& hierarchy, const TransformId id) {
+        const Fl::Matrix4 local = Fl::Matrix4::FromTransform(hierarchy.GetLocalPosition(id),
+                                                             hierarchy.GetLocalRotation(id),
+                                                             hierarchy.GetLocalScale(id));
+
+        const TransformId parent = hierarchy.GetParent(id);
+        return (parent != Fl::TransformHierarchy::InvalidId) ? ComputeWorldMatrix(hierarchy, parent) * local : local;
+    }
+
+    bool CheckWorldMatrices(const Fl::TransformHierarchy& hierarchy, const std::vector<TransformId>& ids) {
+        for (const TransformId id : ids) {
+            if (!hierarchy.GetWorldMatrix(id).ApproxEqual(ComputeWorldMatrix(hierarchy, id), 1e-3f)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Builds a forest of roots, each level having childCount children per parent
+    std::vector<TransformId> BuildForest(Fl::TransformHierarchy& hierarchy, const std::size_t rootCount,
+                                         const std::vector<std::size_t>& childCounts) {
+        std::vector<TransformId> ids;
+        std::vector<TransformId> level;
+        for (std::size_t i = 0; i < rootCount; ++i) {
+            level.push_back(hierarchy.Create());
+        }
+        ids.insert(ids.end(), level.begin(), level.end());
+
+        for (const std::size_t childCount : childCounts) {
+            std::vector<TransformId> nextLevel;
+            for (const TransformId parent : level) {
+                for (std::size_t i = 0; i < childCount; ++i) {
+                    nextLevel.push_back(hierarchy.Create(parent));
+                }
+            }
+
+            ids.insert(ids.end(), nextLevel.begin(), nextLevel.end());
+            level = std::move(nextLevel);
+        }
+
+        return ids;
+    }
+
+    void Randomize(Fl::TransformHierarchy& hierarchy, const TransformId id, std::mt19937& rng) {
+        std::uniform_real_distribution<float> dis(-1.f, 1.f);
+
+        const Fl::Vector3 axis = Fl::Vector3(dis(rng), dis(rng), dis(rng) + 2.f).GetNormal();
+        hierarchy.SetLocalTransform(id, {dis(rng), dis(rng), dis(rng)}, Fl::Quaternion::FromAxisAngle(axis, dis(rng)),
+                                    Fl::Vector3(1.f + 0.1f * dis(rng)));
+    }
+}
+
+SCENARIO("TransformHierarchy", "[TransformHierarchy]") {
+    Fl::TransformHierarchy hierarchy;
+    std::mt19937 rng(42);
+
+    WHEN("Updating a hierarchy") {
+        const TransformId root = hierarchy.Create();
+        const TransformId child = hierarchy.Create(root);
+        const TransformId grandChild = hierarchy.Create(child);
+
+        hierarchy.SetLocalPosition(root, {1.f, 0.f, 0.f});
+        hierarchy.SetLocalPosition(child, {0.f, 1.f, 0.f});
+        hierarchy.SetLocalScale(child, Fl::Vector3(2.f));
+        hierarchy.SetLocalPosition(grandChild, {0.f, 0.f, 1.f});
+        hierarchy.Update();
+
+        CHECK(hierarchy.GetDepthCount() == 3);
+        CHECK(hierarchy.GetParent(grandChild) == child);
+        CHECK(hierarchy.GetWorldMatrix(grandChild).GetTranslation().ApproxEqual({1.f, 1.f, 2.f}));
+
+        // Only moving the root must still move its descendants
+        hierarchy.SetLocalPosition(root, {5.f, 0.f, 0.f});
+        hierarchy.Update();
+        CHECK(hierarchy.GetWorldMatrix(grandChild).GetTranslation().ApproxEqual({5.f, 1.f, 2.f}));
+    }
+
+    WHEN("Changing the structure") {
+        const std::vector<TransformId> ids = BuildForest(hierarchy, 4, {3, 3});
+        for (const TransformId id : ids) {
+            Randomize(hierarchy, id, rng);
+        }
+        hierarchy.Update();
+        CHECK(hierarchy.GetCount() == 52);
+        CHECK(CheckWorldMatrices(hierarchy, ids));
+
+        // Move the first root under a grand-child of the second one, its subtree goes two levels deeper
+        const TransformId firstRoot = ids[0];
+        const TransformId target = ids[16 + 3 * 3];
+        CHECK(hierarchy.GetParent(hierarchy.GetParent(target)) == ids[1]);
+
+        hierarchy.SetParent(firstRoot, target);
+        hierarchy.Update();
+        CHECK(hierarchy.GetDepthCount() == 6);
+        CHECK(hierarchy.GetParent(firstRoot) == target);
+        CHECK(CheckWorldMatrices(hierarchy, ids));
+
+        // Destroying the second root destroys everything below it, including the moved subtree
+        hierarchy.Destroy(ids[1]);
+        CHECK_FALSE(hierarchy.IsValid(ids[1]));
+        hierarchy.Update();
+
+        CHECK(hierarchy.GetCount() == 26);
+        CHECK_FALSE(hierarchy.IsValid(firstRoot));
+        CHECK_FALSE(hierarchy.IsValid(target));
+
+        std::vector<TransformId> remaining;
+        for (const TransformId id : ids) {
+            if (hierarchy.IsValid(id)) {
+                remaining.push_back(id);
+            }
+        }
+        CHECK(remaining.size() == 26);
+        CHECK(CheckWorldMatrices(hierarchy, remaining));
+
+        // Identifiers are recycled
+        const TransformId recycled = hierarchy.Create(remaining.back());
+        CHECK(recycled < ids.size());
+        hierarchy.Update();
+        CHECK(hierarchy.GetWorldMatrix(recycled).ApproxEqual(hierarchy.GetWorldMatrix(remaining.back())));
+    }
+
+    WHEN("Updating dirty transforms in parallel") {
+        Fl::ThreadPool threadPool(3);
+
+        const std::vector<TransformId> ids = BuildForest(hierarchy, 16, {8, 8, 8});
+        for (const TransformId id : ids) {
+            Randomize(hierarchy, id, rng);
+        }
+        hierarchy.Update(&threadPool);
+        CHECK(CheckWorldMatrices(hierarchy, ids));
+
+        std::uniform_int_distribution<std::size_t> pick(0, ids.size() - 1);
+        for (int frame = 0; frame < 3; ++frame) {
+            for (std::size_t i = 0; i < ids.size() / 20; ++i) {
+                Randomize(hierarchy, ids[pick(rng)], rng);
+            }
+
+            hierarchy.Update(&threadPool);
+            CHECK(CheckWorldMatrices(hierarchy, ids));
+        }
+    }
+}
+
+namespace {
+    // Node-per-object hierarchy, the layout the SoA hierarchy replaces
+    struct PointerNode {
+        Fl::Matrix4 worldMatrix;
+        Fl::Quaternion rotation;
+        Fl::Vector3 position;
+        Fl::Vector3 scale;
+        std::vector<std::unique_ptr<PointerNode>> children;
+        bool isDirty = true;
+
+        void Update(const Fl::Matrix4* parentMatrix, bool isParentDirty) {
+            isDirty = isDirty || isParentDirty;
+            if (isDirty) {
+                const Fl::Matrix4 local = Fl::Matrix4::FromTransform(position, rotation, scale);
+                worldMatrix = parentMatrix ? *parentMatrix * local : local;
+            }
+
+            for (const auto& child : children) {
+                child->Update(&worldMatrix, isDirty);
+            }
+
+            isDirty = false;
+        }
+    };
+}
+
+TEST_CASE("TransformHierarchy benchmarks", "[TransformHierarchy][.benchmark]") {
+    // 1000 roots, 10 children per root and 99 grand-children per child: 1001000 transforms
+    constexpr std::size_t RootCount = 1000;
+    const std::vector<std::size_t> childCounts = {10, 99};
+
+    std::mt19937 rng(42);
+
+    Fl::TransformHierarchy hierarchy;
+    hierarchy.Reserve(1'001'000);
+    const std::vector<TransformId> ids = BuildForest(hierarchy, RootCount, childCounts);
+    hierarchy.Update();
+
+    // 5% of the transforms change each frame
+    std::vector<TransformId> changed(ids.size() / 20);
+    std::uniform_int_distribution<std::size_t> pick(0, ids.size() - 1);
+    for (TransformId& id : changed) {
+        id = ids[pick(rng)];
+    }
+
+    const auto touch = [&] {
+        for (const TransformId id : changed) {
+            hierarchy.SetLocalPosition(id, hierarchy.GetLocalPosition(id) + Fl::Vector3(0.01f));
+        }
+    };
+
+    BENCHMARK("Fl::TransformHierarchy, 1M transforms, 5% dirty") {
+        touch();
+        hierarchy.Update();
+        return hierarchy.GetWorldMatrix(ids.back()).data[12];
+    };
+
+    Fl::ThreadPool threadPool;
+    BENCHMARK("Fl::TransformHierarchy, 1M transforms, 5% dirty, thread pool") {
+        touch();
+        hierarchy.Update(&threadPool);
+        return hierarchy.GetWorldMatrix(ids.back()).data[12];
+    };
+
+    std::vector<std::unique_ptr<PointerNode>> roots;
+    std::vector<PointerNode*> nodes;
+    for (std::size_t i = 0; i < RootCount; ++i) {
+        PointerNode& root = *roots.emplace_back(std::make_unique<PointerNode>());
+        nodes.push_back(&root);
+        for (std::size_t j = 0; j < childCounts[0]; ++j) {
+            PointerNode& child = *root.children.emplace_back(std::make_unique<PointerNode>());
+            nodes.push_back(&child);
+            for (std::size_t k = 0; k < childCounts[1]; ++k) {
+                nodes.push_back(child.children.emplace_back(std::make_unique<PointerNode>()).get());
+            }
+        }
+    }
+
+    for (PointerNode* node : nodes) {
+        node->rotation = Fl::Quaternion::Identity();
+        node->position = Fl::Vector3::Zero();
+        node->scale = Fl::Vector3::Unit();
+    }
+
+    BENCHMARK("Pointer-based nodes, 1M transforms, 5% dirty") {
+        for (std::size_t i = 0; i < changed.size(); ++i) {
+            PointerNode* node = nodes[(i * 7919) % nodes.size()];
+            node->position += Fl::Vector3(0.01f);
+            node->isDirty = true;
+        }
+
+        for (const auto& root : roots) {
+            root->Update(nullptr, false);
+        }
+
+        return roots.back()->worldMatrix.data[12];
+    };
+}
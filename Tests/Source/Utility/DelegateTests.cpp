@@ -0,0 +1,69 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Utility/Delegate.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace {
+    int Square(const int value) {
+        return value * value;
+    }
+}
+
+SCENARIO("Delegate", "[Delegate]") {
+    WHEN("Storing callables") {
+        Fl::Delegate<int(int)> empty;
+        CHECK_FALSE(empty.IsValid());
+        CHECK_FALSE(empty);
+
+        Fl::Delegate<int(int)> function = &Square;
+        CHECK(function(3) == 9);
+
+        int offset = 10;
+        Fl::Delegate<int(int)> lambda = [&offset](const int value) { return value + offset; };
+        CHECK(lambda(5) == 15);
+        offset = 20;
+        CHECK(lambda(5) == 25);
+
+        int calls = 0;
+        Fl::Delegate<void()> stateful = [&calls, counter = 0]() mutable { calls = ++counter; };
+        stateful();
+        stateful();
+        CHECK(calls == 2);
+    }
+
+    WHEN("Moving delegates") {
+        auto shared = std::make_shared<int>(42);
+        Fl::Delegate<int()> delegate = [shared] { return *shared; };
+        CHECK(shared.use_count() == 2);
+
+        Fl::Delegate<int()> moved = std::move(delegate);
+        CHECK_FALSE(delegate.IsValid());
+        CHECK(moved() == 42);
+        CHECK(shared.use_count() == 2);
+
+        Fl::Delegate<int()> assigned;
+        assigned = std::move(moved);
+        CHECK(assigned() == 42);
+        CHECK(shared.use_count() == 2);
+
+        assigned.Reset();
+        CHECK_FALSE(assigned.IsValid());
+        CHECK(shared.use_count() == 1);
+    }
+
+    WHEN("Checking buffer capacity") {
+        struct Large {
+            char data[64];
+            void operator()() const {}
+        };
+
+        CHECK_FALSE(Fl::Delegate<void()>::Fits<Large>);
+        CHECK((Fl::Delegate<void(), 64>::Fits<Large>));
+    }
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/FixedVector.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr std::size_t ConstexprSize() {
+        Fl::FixedVector<int, 8> vec(3, 1);
+        vec.emplace_back(2);
+        vec.erase(vec.begin());
+
+        return Fl::CountOf(vec);
+    }
+}
+
+SCENARIO("FixedVector", "[FixedVector]") {
+    static_assert(ConstexprSize() == 3);
+    static_assert(Fl::FixedVector<int, 16>::capacity() == 16);
+
+    WHEN("Filling the vector") {
+        Fl::FixedVector<int, 4> vec;
+        for (int i = 0; i < 4; ++i) {
+            vec.push_back(i);
+        }
+
+        CHECK(vec.full());
+        CHECK(Fl::CountOf(vec) == 4);
+        CHECK(std::accumulate(vec.begin(), vec.end(), 0) == 6);
+
+        vec.erase(vec.begin() + 1);
+        vec.insert(vec.begin(), 10);
+        CHECK(vec == Fl::FixedVector<int, 4>{10, 0, 2, 3});
+        CHECK(std::vector<int>(vec.rbegin(), vec.rend()) == std::vector<int>{3, 2, 0, 10});
+    }
+
+    WHEN("Using non-trivial types") {
+        Fl::FixedVector<std::string, 4> vec = {"A", "B"};
+        Fl::FixedVector<std::string, 4> other = {"C", "D", "E"};
+
+        vec.swap(other);
+        CHECK(vec == Fl::FixedVector<std::string, 4>{"C", "D", "E"});
+        CHECK(other == Fl::FixedVector<std::string, 4>{"A", "B"});
+
+        other = std::move(vec);
+        CHECK(vec.empty());
+        CHECK(other.size() == 3);
+        CHECK(other.back() == "E");
+
+        other.resize(1);
+        CHECK(other.front() == "C");
+    }
+}
+
+TEST_CASE("FixedVector benchmarks", "[FixedVector][.benchmark]") {
+    constexpr int ElementCount = 16;
+
+    BENCHMARK("std::vector push/iterate") {
+        std::vector<int> vec;
+        for (int i = 0; i < ElementCount; ++i) {
+            vec.push_back(i);
+        }
+
+        return std::accumulate(vec.begin(), vec.end(), 0);
+    };
+
+    BENCHMARK("Fl::FixedVector push/iterate") {
+        Fl::FixedVector<int, ElementCount> vec;
+        for (int i = 0; i < ElementCount; ++i) {
+            vec.push_back(i);
+        }
+
+        return std::accumulate(vec.begin(), vec.end(), 0);
+    };
+}
@@ -0,0 +1,169 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Utility/MpmcQueue.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr int ProducerValueCount = 50'000;
+
+    // Every producer pushes values tagged with its index, consumers count the values they see
+    template <typename PushFunc, typename PopFunc>
+    std::vector<int> RunProducersConsumers(const int producerCount, const int consumerCount, PushFunc&& push,
+                                           PopFunc&& pop) {
+        std::vector<std::atomic<int>> seen(static_cast<std::size_t>(producerCount * ProducerValueCount));
+        std::atomic<int> remaining = producerCount * ProducerValueCount;
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producerCount; ++p) {
+            threads.emplace_back([&, p] {
+                for (int i = 0; i < ProducerValueCount; ++i) {
+                    push(p * ProducerValueCount + i);
+                }
+            });
+        }
+
+        for (int c = 0; c < consumerCount; ++c) {
+            threads.emplace_back([&] {
+                int value;
+                while (remaining.load(std::memory_order_relaxed) > 0) {
+                    if (pop(value)) {
+                        seen[static_cast<std::size_t>(value)].fetch_add(1, std::memory_order_relaxed);
+                        remaining.fetch_sub(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        std::vector<int> result;
+        result.reserve(seen.size());
+        for (const std::atomic<int>& count : seen) {
+            result.push_back(count.load());
+        }
+
+        return result;
+    }
+}
+
+SCENARIO("MpmcQueue", "[MpmcQueue]") {
+    WHEN("Using the queue from a single thread") {
+        Fl::MpmcQueue<std::string> queue(2);
+        CHECK(queue.GetCapacity() == 2);
+
+        CHECK(queue.TryPush("Hello"));
+        CHECK(queue.TryEmplace(5, 'a'));
+        CHECK_FALSE(queue.TryPush("World"));
+        CHECK(queue.GetSize() == 2);
+
+        std::string value;
+        REQUIRE(queue.TryPop(value));
+        CHECK(value == "Hello");
+        CHECK(queue.Pop() == "aaaaa");
+        CHECK_FALSE(queue.TryPop(value));
+    }
+
+    WHEN("Pushing and popping batches") {
+        Fl::MpmcQueue<int> queue(4);
+
+        const std::array<int, 6> input = {0, 1, 2, 3, 4, 5};
+        CHECK(queue.TryPushBatch(input) == 4);
+
+        std::array<int, 3> output{};
+        CHECK(queue.TryPopBatch(output) == 3);
+        CHECK(output == std::array<int, 3>{0, 1, 2});
+        CHECK(queue.TryPushBatch(std::span(input).subspan(4)) == 2);
+        CHECK(queue.TryPopBatch(output) == 3);
+        CHECK(output == std::array<int, 3>{3, 4, 5});
+    }
+
+    WHEN("Stressing the queue with multiple producers and consumers") {
+        Fl::MpmcQueue<int> queue(128);
+
+        const std::vector<int> seen = RunProducersConsumers(
+            4, 4, [&](const int value) { queue.Push(value); }, [&](int& value) { return queue.TryPop(value); });
+
+        bool allSeenOnce = true;
+        for (const int count : seen) {
+            allSeenOnce &= (count == 1);
+        }
+
+        CHECK(allSeenOnce);
+        CHECK(queue.IsEmpty());
+    }
+
+    WHEN("Blocking on both sides") {
+        Fl::MpmcQueue<int> queue(4);
+
+        std::atomic<long long> sum = 0;
+        std::vector<std::thread> consumers;
+        for (int c = 0; c < 3; ++c) {
+            consumers.emplace_back([&] {
+                for (int i = 0; i < 10'000; ++i) {
+                    sum.fetch_add(queue.Pop(), std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (int i = 0; i < 30'000; ++i) {
+            queue.Push(i);
+        }
+
+        for (std::thread& consumer : consumers) {
+            consumer.join();
+        }
+
+        CHECK(sum.load() == 30'000LL * 29'999 / 2);
+    }
+}
+
+TEST_CASE("MpmcQueue benchmarks", "[MpmcQueue][.benchmark]") {
+    const auto popValue = [](auto& queue) {
+        return [&queue](int& value) { return queue.TryPop(value); };
+    };
+
+    for (const int producerCount : {1, 2, 4, 8, 16}) {
+        BENCHMARK("Fl::MpmcQueue, " + std::to_string(producerCount) + " producer(s)") {
+            Fl::MpmcQueue<int> queue(1024);
+            return RunProducersConsumers(
+                producerCount, 1, [&](const int value) { queue.Push(value); }, popValue(queue));
+        };
+
+        BENCHMARK("std::mutex + std::deque, " + std::to_string(producerCount) + " producer(s)") {
+            std::mutex mutex;
+            std::deque<int> queue;
+            return RunProducersConsumers(
+                producerCount, 1,
+                [&](const int value) {
+                    std::scoped_lock lock(mutex);
+                    queue.push_back(value);
+                },
+                [&](int& value) {
+                    std::scoped_lock lock(mutex);
+                    if (queue.empty()) {
+                        return false;
+                    }
+
+                    value = queue.front();
+                    queue.pop_front();
+                    return true;
+                });
+        };
+    }
+}
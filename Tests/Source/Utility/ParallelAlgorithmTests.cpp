@@ -0,0 +1,448 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Utility/ParallelAlgorithm.hpp>
+#include <FlashlightEngine/Utility/ScratchAllocator.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// libstdc++ runs the parallel policies on TBB when its headers are found, the tests don't link it
+#if __has_include(<execution>) && !(defined(__GLIBCXX__) && __has_include(<tbb/tbb.h>))
+#include <execution>
+#if defined(__cpp_lib_parallel_algorithm)
+#define FL_TESTS_HAS_PARALLEL_POLICIES
+#endif
+#endif
+
+namespace {
+    struct Entry {
+        Fl::UInt32 key;
+        Fl::UInt32 index;
+
+        bool operator==(const Entry&) const = default;
+    };
+
+    template <typename T, typename Distribution>
+    std::vector<T> GenerateValues(const std::size_t count, Distribution distribution, std::mt19937& rng) {
+        std::vector<T> values(count);
+        for (T& value : values) {
+            value = static_cast<T>(distribution(rng));
+        }
+
+        return values;
+    }
+
+    // Many equal keys, the index telling whether their order was kept
+    std::vector<Entry> GenerateEntries(const std::size_t count, std::mt19937& rng) {
+        std::uniform_int_distribution<Fl::UInt32> key(0, 999);
+
+        std::vector<Entry> entries(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            entries[i] = {key(rng), static_cast<Fl::UInt32>(i)};
+        }
+
+        return entries;
+    }
+
+    bool CompareEntries(const Entry& lhs, const Entry& rhs) {
+        return lhs.key < rhs.key;
+    }
+}
+
+SCENARIO("ParallelAlgorithm", "[ParallelAlgorithm]") {
+    std::mt19937 rng(42);
+    Fl::ThreadPool threadPool(3);
+
+    // Small arrays are processed on the calling thread, large ones in several blocks
+    const std::size_t sizes[] = {0, 1, 31, 33, 1000, 100'000};
+
+    WHEN("Radix sorting numbers") {
+        for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+            for (const std::size_t size : sizes) {
+                std::vector<Fl::Int32> integers =
+                    GenerateValues<Fl::Int32>(size, std::uniform_int_distribution<Fl::Int32>(-100'000, 100'000), rng);
+                std::vector<Fl::Int32> expectedIntegers = integers;
+                std::sort(expectedIntegers.begin(), expectedIntegers.end());
+
+                Fl::RadixSort(std::span(integers), pool);
+                CHECK(integers == expectedIntegers);
+
+                std::vector<float> floats =
+                    GenerateValues<float>(size, std::uniform_real_distribution<float>(-1e6f, 1e6f), rng);
+                std::vector<float> expectedFloats = floats;
+                std::sort(expectedFloats.begin(), expectedFloats.end());
+
+                Fl::RadixSort(std::span(floats), pool);
+                CHECK(floats == expectedFloats);
+            }
+
+            // Bytes shared by all the keys are skipped
+            std::vector<Fl::UInt64> keys =
+                GenerateValues<Fl::UInt64>(100'000, std::uniform_int_distribution<Fl::UInt64>(0, 0xFFFF), rng);
+            for (Fl::UInt64& key : keys) {
+                key |= 0xAB00'0000'0000'0000;
+            }
+
+            std::vector<Fl::UInt64> expectedKeys = keys;
+            std::sort(expectedKeys.begin(), expectedKeys.end());
+
+            CHECK(Fl::RadixSort(std::span(keys), pool) == 2);
+            CHECK(keys == expectedKeys);
+
+            std::vector<Fl::UInt8> bytes = {3, 200, 0, 7, 7, 255, 1};
+            CHECK(Fl::RadixSort(std::span(bytes), pool) == 1);
+            CHECK(bytes == std::vector<Fl::UInt8>{0, 1, 3, 7, 7, 200, 255});
+
+            std::vector<double> doubles = {2.5, -0.0, -3.0, 0.0, -1e300, 1e-300, -2.5};
+            Fl::RadixSort(std::span(doubles), pool);
+            CHECK(doubles == std::vector<double>{-1e300, -3.0, -2.5, -0.0, 0.0, 1e-300, 2.5});
+            CHECK(std::signbit(doubles[3]));
+            CHECK_FALSE(std::signbit(doubles[4]));
+        }
+    }
+
+    WHEN("Radix sorting keys and values") {
+        for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+            const std::vector<Entry> entries = GenerateEntries(100'000, rng);
+            std::vector<Entry> expectedEntries = entries;
+            std::stable_sort(expectedEntries.begin(), expectedEntries.end(), CompareEntries);
+
+            std::vector<Entry> sortedEntries = entries;
+            Fl::RadixSortByKey(std::span(sortedEntries), [](const Entry& entry) { return entry.key; }, pool);
+            CHECK(sortedEntries == expectedEntries);
+
+            std::vector<Fl::Int16> keys(entries.size());
+            std::vector<Fl::UInt32> values(entries.size());
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                keys[i] = static_cast<Fl::Int16>(static_cast<int>(entries[i].key) - 500);
+                values[i] = entries[i].index;
+            }
+
+            Fl::RadixSort(std::span(keys), std::span(values), pool);
+
+            bool isStablySorted = true;
+            for (std::size_t i = 0; i < entries.size(); ++i) {
+                isStablySorted &= (keys[i] == static_cast<int>(expectedEntries[i].key) - 500);
+                isStablySorted &= (values[i] == expectedEntries[i].index);
+            }
+
+            CHECK(isStablySorted);
+        }
+    }
+
+    WHEN("Merge sorting") {
+        for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+            for (const std::size_t size : sizes) {
+                std::vector<Entry> entries = GenerateEntries(size, rng);
+                std::vector<Entry> expectedEntries = entries;
+                std::stable_sort(expectedEntries.begin(), expectedEntries.end(), CompareEntries);
+
+                Fl::MergeSort(std::span(entries), CompareEntries, pool);
+                CHECK(entries == expectedEntries);
+            }
+
+            // Elements owning memory are moved, the largest merges being split between threads
+            std::vector<std::string> strings(40'000);
+            for (std::string& string : strings) {
+                string = std::string(20, 'a') + std::to_string(rng() % 5000);
+            }
+
+            std::vector<std::string> expectedStrings = strings;
+            std::stable_sort(expectedStrings.begin(), expectedStrings.end(), std::greater<>());
+
+            Fl::MergeSort(std::span(strings), std::greater<>(), pool);
+            CHECK(strings == expectedStrings);
+        }
+    }
+
+    WHEN("Scanning") {
+        for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+            for (const std::size_t size : sizes) {
+                const std::vector<Fl::Int64> integers =
+                    GenerateValues<Fl::Int64>(size, std::uniform_int_distribution<Fl::Int64>(-1000, 1000), rng);
+
+                std::vector<Fl::Int64> expected(size);
+                std::vector<Fl::Int64> output(size);
+                std::inclusive_scan(integers.begin(), integers.end(), expected.begin());
+                Fl::InclusiveScan(integers, std::span(output), std::plus<>(), pool);
+                CHECK(output == expected);
+
+                std::exclusive_scan(integers.begin(), integers.end(), expected.begin(), Fl::Int64(7));
+                Fl::ExclusiveScan(integers, std::span(output), 7, std::plus<>(), pool);
+                CHECK(output == expected);
+
+                const auto max = [](const Fl::Int64 lhs, const Fl::Int64 rhs) { return std::max(lhs, rhs); };
+                std::inclusive_scan(integers.begin(), integers.end(), expected.begin(), max);
+                Fl::InclusiveScan(integers, std::span(output), max, pool);
+                CHECK(output == expected);
+
+                // Small integers are summed exactly by floats, whatever the grouping of the additions
+                const std::vector<float> floats =
+                    GenerateValues<float>(size, std::uniform_int_distribution<int>(0, 3), rng);
+                std::vector<float> expectedFloats(size);
+                std::exclusive_scan(floats.begin(), floats.end(), expectedFloats.begin(), 1.f);
+
+                std::vector<float> scannedFloats = floats;
+                Fl::ExclusiveScan(scannedFloats, std::span(scannedFloats), 1.f, std::plus<>(), pool);
+                CHECK(scannedFloats == expectedFloats);
+
+                std::inclusive_scan(floats.begin(), floats.end(), expectedFloats.begin());
+                scannedFloats = floats;
+                Fl::InclusiveScan(scannedFloats, std::span(scannedFloats), std::plus<>(), pool);
+                CHECK(scannedFloats == expectedFloats);
+            }
+        }
+    }
+
+    WHEN("Reducing") {
+        for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+            for (const std::size_t size : sizes) {
+                const std::vector<Fl::Int64> integers =
+                    GenerateValues<Fl::Int64>(size, std::uniform_int_distribution<Fl::Int64>(-1000, 1000), rng);
+                CHECK(Fl::Reduce(integers, Fl::Int64(5), std::plus<>(), pool) ==
+                      std::accumulate(integers.begin(), integers.end(), Fl::Int64(5)));
+
+                const auto min = [](const Fl::Int64 lhs, const Fl::Int64 rhs) { return std::min(lhs, rhs); };
+                CHECK(Fl::Reduce(integers, Fl::Int64(0), min, pool) ==
+                      std::accumulate(integers.begin(), integers.end(), Fl::Int64(0), min));
+
+                const std::vector<float> floats =
+                    GenerateValues<float>(size, std::uniform_int_distribution<int>(-8, 8), rng);
+                CHECK(Fl::Reduce(floats, 0.5f, std::plus<>(), pool) ==
+                      std::accumulate(floats.begin(), floats.end(), 0.5f));
+            }
+
+            // Rounding errors stay small with the SIMD accumulators
+            const std::vector<float> fractions =
+                GenerateValues<float>(100'000, std::uniform_real_distribution<float>(0.f, 1.f), rng);
+            const double exactSum = std::accumulate(fractions.begin(), fractions.end(), 0.0);
+            CHECK(std::abs(Fl::Reduce(fractions, 0.f, std::plus<>(), pool) - exactSum) < 1e-5 * exactSum);
+        }
+    }
+
+    WHEN("Compacting and partitioning") {
+        const auto isKept = [](const Entry& entry) { return entry.key % 3 == 0; };
+
+        for (Fl::ThreadPool* pool : {static_cast<Fl::ThreadPool*>(nullptr), &threadPool}) {
+            for (const std::size_t size : sizes) {
+                std::vector<Entry> entries = GenerateEntries(size, rng);
+
+                std::vector<Entry> expected;
+                std::copy_if(entries.begin(), entries.end(), std::back_inserter(expected), isKept);
+
+                std::vector<Entry> output(size);
+                const std::size_t keptCount = Fl::Compact(entries, std::span(output), isKept, pool);
+                output.resize(keptCount);
+                CHECK(output == expected);
+
+                std::vector<Entry> expectedPartition = entries;
+                std::stable_partition(expectedPartition.begin(), expectedPartition.end(), isKept);
+
+                CHECK(Fl::StablePartition(std::span(entries), isKept, pool) == keptCount);
+                CHECK(entries == expectedPartition);
+            }
+
+            std::vector<std::string> strings(40'000);
+            for (std::string& string : strings) {
+                string = std::string(20, 'a') + std::to_string(rng() % 5000);
+            }
+
+            const auto isShort = [](const std::string& string) { return string.size() < 24; };
+            std::vector<std::string> expectedStrings = strings;
+            std::stable_partition(expectedStrings.begin(), expectedStrings.end(), isShort);
+
+            CHECK(Fl::StablePartition(std::span(strings), isShort, pool) ==
+                  static_cast<std::size_t>(std::count_if(strings.begin(), strings.end(), isShort)));
+            CHECK(strings == expectedStrings);
+        }
+    }
+
+    WHEN("Sorting with a scratch buffer") {
+        Fl::ScratchBuffer scratchBuffer;
+        Fl::ScratchAllocator<std::byte> allocator(scratchBuffer);
+
+        std::vector<Entry> entries = GenerateEntries(100'000, rng);
+        std::vector<Entry> expectedEntries = entries;
+        std::stable_sort(expectedEntries.begin(), expectedEntries.end(), CompareEntries);
+
+        std::vector<Entry> sortedEntries = entries;
+        Fl::RadixSortByKey(std::span(sortedEntries), [](const Entry& entry) { return entry.key; }, &threadPool,
+                           allocator);
+        CHECK(sortedEntries == expectedEntries);
+
+        // The buffer grew to fit everything the sort needed at once
+        const std::size_t capacity = scratchBuffer.GetCapacity();
+        CHECK(capacity >= entries.size() * sizeof(Entry));
+
+        sortedEntries = entries;
+        Fl::MergeSort(std::span(sortedEntries), CompareEntries, &threadPool, allocator);
+        CHECK(sortedEntries == expectedEntries);
+
+        sortedEntries = entries;
+        Fl::RadixSortByKey(std::span(sortedEntries), [](const Entry& entry) { return entry.key; }, &threadPool,
+                           allocator);
+        CHECK(sortedEntries == expectedEntries);
+        CHECK(scratchBuffer.GetCapacity() == capacity);
+    }
+}
+
+TEST_CASE("ParallelAlgorithm benchmarks", "[.benchmark]") {
+    std::mt19937 rng(42);
+    Fl::ThreadPool threadPool;
+
+    constexpr std::size_t Count = 1'000'000;
+    const std::vector<Fl::UInt32> integers =
+        GenerateValues<Fl::UInt32>(Count, std::uniform_int_distribution<Fl::UInt32>(), rng);
+    const std::vector<float> floats =
+        GenerateValues<float>(Count, std::uniform_real_distribution<float>(-1000.f, 1000.f), rng);
+    const std::vector<Entry> entries = GenerateEntries(Count, rng);
+
+    // Sorts run on a copy, which all of them pay for
+    std::vector<Fl::UInt32> sortedIntegers;
+    std::vector<float> sortedFloats;
+    std::vector<Entry> sortedEntries;
+    std::vector<float> scannedFloats(Count);
+    Fl::ScratchBuffer scratchBuffer;
+    const Fl::ScratchAllocator<std::byte> allocator(scratchBuffer);
+
+    BENCHMARK("std::sort, 1M integers") {
+        sortedIntegers = integers;
+        std::sort(sortedIntegers.begin(), sortedIntegers.end());
+        return sortedIntegers[0];
+    };
+
+#ifdef FL_TESTS_HAS_PARALLEL_POLICIES
+    BENCHMARK("std::sort, std::execution::par, 1M integers") {
+        sortedIntegers = integers;
+        std::sort(std::execution::par, sortedIntegers.begin(), sortedIntegers.end());
+        return sortedIntegers[0];
+    };
+#endif
+
+    BENCHMARK("RadixSort, 1M integers") {
+        sortedIntegers = integers;
+        return Fl::RadixSort(std::span(sortedIntegers), nullptr, allocator);
+    };
+
+    BENCHMARK("RadixSort, thread pool, 1M integers") {
+        sortedIntegers = integers;
+        return Fl::RadixSort(std::span(sortedIntegers), &threadPool, allocator);
+    };
+
+    BENCHMARK("std::sort, 1M floats") {
+        sortedFloats = floats;
+        std::sort(sortedFloats.begin(), sortedFloats.end());
+        return sortedFloats[0];
+    };
+
+    BENCHMARK("RadixSort, thread pool, 1M floats") {
+        sortedFloats = floats;
+        return Fl::RadixSort(std::span(sortedFloats), &threadPool, allocator);
+    };
+
+    BENCHMARK("std::stable_sort, 1M entries") {
+        sortedEntries = entries;
+        std::stable_sort(sortedEntries.begin(), sortedEntries.end(), CompareEntries);
+        return sortedEntries[0].index;
+    };
+
+#ifdef FL_TESTS_HAS_PARALLEL_POLICIES
+    BENCHMARK("std::stable_sort, std::execution::par, 1M entries") {
+        sortedEntries = entries;
+        std::stable_sort(std::execution::par, sortedEntries.begin(), sortedEntries.end(), CompareEntries);
+        return sortedEntries[0].index;
+    };
+#endif
+
+    BENCHMARK("MergeSort, 1M entries") {
+        sortedEntries = entries;
+        Fl::MergeSort(std::span(sortedEntries), CompareEntries, nullptr, allocator);
+        return sortedEntries[0].index;
+    };
+
+    BENCHMARK("MergeSort, thread pool, 1M entries") {
+        sortedEntries = entries;
+        Fl::MergeSort(std::span(sortedEntries), CompareEntries, &threadPool, allocator);
+        return sortedEntries[0].index;
+    };
+
+    BENCHMARK("RadixSortByKey, thread pool, 1M entries") {
+        sortedEntries = entries;
+        return Fl::RadixSortByKey(std::span(sortedEntries), [](const Entry& entry) { return entry.key; },
+                                  &threadPool, allocator);
+    };
+
+    BENCHMARK("std::inclusive_scan, 1M floats") {
+        std::inclusive_scan(floats.begin(), floats.end(), scannedFloats.begin());
+        return scannedFloats.back();
+    };
+
+#ifdef FL_TESTS_HAS_PARALLEL_POLICIES
+    BENCHMARK("std::inclusive_scan, std::execution::par, 1M floats") {
+        std::inclusive_scan(std::execution::par, floats.begin(), floats.end(), scannedFloats.begin());
+        return scannedFloats.back();
+    };
+#endif
+
+    BENCHMARK("InclusiveScan, 1M floats") {
+        Fl::InclusiveScan(floats, std::span(scannedFloats));
+        return scannedFloats.back();
+    };
+
+    BENCHMARK("InclusiveScan, thread pool, 1M floats") {
+        Fl::InclusiveScan(floats, std::span(scannedFloats), std::plus<>(), &threadPool);
+        return scannedFloats.back();
+    };
+
+    BENCHMARK("std::accumulate, 1M floats") {
+        return std::accumulate(floats.begin(), floats.end(), 0.f);
+    };
+
+#ifdef FL_TESTS_HAS_PARALLEL_POLICIES
+    BENCHMARK("std::reduce, std::execution::par, 1M floats") {
+        return std::reduce(std::execution::par, floats.begin(), floats.end(), 0.f);
+    };
+#endif
+
+    BENCHMARK("Reduce, 1M floats") {
+        return Fl::Reduce(floats, 0.f);
+    };
+
+    BENCHMARK("Reduce, thread pool, 1M floats") {
+        return Fl::Reduce(floats, 0.f, std::plus<>(), &threadPool);
+    };
+
+    const auto isPositive = [](const float value) { return value > 0.f; };
+
+    BENCHMARK("std::copy_if, 1M floats") {
+        return std::copy_if(floats.begin(), floats.end(), scannedFloats.begin(), isPositive) - scannedFloats.begin();
+    };
+
+    BENCHMARK("Compact, 1M floats") {
+        return Fl::Compact(floats, std::span(scannedFloats), isPositive);
+    };
+
+    BENCHMARK("Compact, thread pool, 1M floats") {
+        return Fl::Compact(floats, std::span(scannedFloats), isPositive, &threadPool);
+    };
+
+    BENCHMARK("std::stable_partition, 1M floats") {
+        sortedFloats = floats;
+        return std::stable_partition(sortedFloats.begin(), sortedFloats.end(), isPositive) - sortedFloats.begin();
+    };
+
+    BENCHMARK("StablePartition, thread pool, 1M floats") {
+        sortedFloats = floats;
+        return Fl::StablePartition(std::span(sortedFloats), isPositive, &threadPool, allocator);
+    };
+}
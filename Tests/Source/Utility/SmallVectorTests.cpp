@@ -0,0 +1,193 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Utility/Algorithm.hpp>
+#include <FlashlightEngine/Utility/SmallVector.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+    std::size_t s_allocationCount = 0;
+
+    template <typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        CountingAllocator() = default;
+
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>&) noexcept {
+        }
+
+        T* allocate(const std::size_t count) {
+            ++s_allocationCount;
+            return std::allocator<T>().allocate(count);
+        }
+
+        void deallocate(T* ptr, const std::size_t count) noexcept {
+            std::allocator<T>().deallocate(ptr, count);
+        }
+
+        friend bool operator==(const CountingAllocator&, const CountingAllocator&) = default;
+    };
+
+    constexpr int ConstexprSum() {
+        Fl::SmallVector<int, 2> vec = {1, 2};
+        vec.push_back(3); //< Spills to the heap
+        vec.insert(vec.begin(), 0);
+        vec.erase(vec.begin() + 1);
+
+        return std::accumulate(vec.begin(), vec.end(), 0) + static_cast<int>(Fl::CountOf(vec));
+    }
+}
+
+SCENARIO("SmallVector", "[SmallVector]") {
+    static_assert(ConstexprSum() == 8);
+
+    WHEN("Staying under the inline capacity") {
+        s_allocationCount = 0;
+
+        Fl::SmallVector<int, 4, CountingAllocator<int>> vec;
+        for (int i = 0; i < 4; ++i) {
+            vec.push_back(i);
+        }
+
+        CHECK(vec.is_inline());
+        CHECK(vec.size() == 4);
+        CHECK(Fl::CountOf(vec) == 4);
+        CHECK(vec.capacity() == 4);
+        CHECK(s_allocationCount == 0);
+
+        AND_WHEN("Spilling to the heap") {
+            vec.push_back(4);
+
+            CHECK_FALSE(vec.is_inline());
+            CHECK(s_allocationCount == 1);
+            CHECK(vec == Fl::SmallVector<int, 4, CountingAllocator<int>>{0, 1, 2, 3, 4});
+
+            vec.pop_back();
+            vec.shrink_to_fit();
+            CHECK(vec.is_inline());
+            CHECK(vec.size() == 4);
+        }
+    }
+
+    WHEN("Using non-trivial types") {
+        Fl::SmallVector<std::string, 2> vec;
+        vec.emplace_back("Hello");
+        vec.emplace_back("World");
+        vec.insert(vec.begin() + 1, "there");
+        vec.insert(vec.begin(), vec.back()); //< Aliasing insertion
+
+        REQUIRE(vec.size() == 4);
+        CHECK(vec[0] == "World");
+        CHECK(vec[1] == "Hello");
+        CHECK(vec[2] == "there");
+        CHECK(vec[3] == "World");
+
+        vec.erase(vec.begin(), vec.begin() + 2);
+        CHECK(vec.size() == 2);
+        CHECK(vec.front() == "there");
+
+        vec.shrink_to_fit();
+        CHECK(vec.is_inline());
+        CHECK(vec.back() == "World");
+
+        Fl::SmallVector<std::string, 2> copy = vec;
+        Fl::SmallVector<std::string, 2> moved = std::move(vec);
+        CHECK(copy == moved);
+        CHECK(vec.empty());
+    }
+
+    WHEN("Using move-only types") {
+        Fl::SmallVector<std::unique_ptr<int>, 2> vec;
+        for (int i = 0; i < 8; ++i) {
+            vec.push_back(std::make_unique<int>(i));
+        }
+
+        vec.erase(vec.begin() + 2);
+        REQUIRE(vec.size() == 7);
+        CHECK(*vec[2] == 3);
+
+        Fl::SmallVector<std::unique_ptr<int>, 2> other;
+        other.push_back(std::make_unique<int>(42));
+        other.swap(vec);
+
+        CHECK(vec.size() == 1);
+        CHECK(*vec[0] == 42);
+        CHECK(other.size() == 7);
+        CHECK(*other.back() == 7);
+    }
+
+    WHEN("Resizing and assigning") {
+        Fl::SmallVector<int, 3> vec(5, 7);
+        CHECK(vec.size() == 5);
+        CHECK(vec[4] == 7);
+
+        vec.resize(2);
+        CHECK(vec.size() == 2);
+
+        vec.assign({3, 2, 1});
+        CHECK(vec == Fl::SmallVector<int, 3>{3, 2, 1});
+        CHECK(vec < Fl::SmallVector<int, 3>{3, 2, 2});
+
+        vec.insert(vec.begin() + 1, 4, 9);
+        CHECK(vec == Fl::SmallVector<int, 3>{3, 9, 9, 9, 9, 2, 1});
+        CHECK(vec.at(1) == 9);
+        CHECK_THROWS_AS(vec.at(7), std::out_of_range);
+    }
+}
+
+TEST_CASE("SmallVector benchmarks", "[SmallVector][.benchmark]") {
+    constexpr int ElementCount = 8;
+
+    BENCHMARK("std::vector push/iterate") {
+        s_allocationCount = 0;
+
+        std::vector<int, CountingAllocator<int>> vec;
+        for (int i = 0; i < ElementCount; ++i) {
+            vec.push_back(i);
+        }
+
+        return std::accumulate(vec.begin(), vec.end(), 0) + static_cast<int>(s_allocationCount);
+    };
+
+    BENCHMARK("Fl::SmallVector push/iterate") {
+        s_allocationCount = 0;
+
+        Fl::SmallVector<int, ElementCount, CountingAllocator<int>> vec;
+        for (int i = 0; i < ElementCount; ++i) {
+            vec.push_back(i);
+        }
+
+        return std::accumulate(vec.begin(), vec.end(), 0) + static_cast<int>(s_allocationCount);
+    };
+
+    s_allocationCount = 0;
+    {
+        std::vector<int, CountingAllocator<int>> vec;
+        for (int i = 0; i < ElementCount; ++i) {
+            vec.push_back(i);
+        }
+    }
+    const std::size_t vectorAllocations = s_allocationCount;
+
+    s_allocationCount = 0;
+    {
+        Fl::SmallVector<int, ElementCount, CountingAllocator<int>> vec;
+        for (int i = 0; i < ElementCount; ++i) {
+            vec.push_back(i);
+        }
+    }
+    const std::size_t smallVectorAllocations = s_allocationCount;
+
+    CHECK(smallVectorAllocations == 0);
+    CHECK(smallVectorAllocations < vectorAllocations);
+}
@@ -0,0 +1,121 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Utility/SpscQueue.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <memory>
+#include <thread>
+
+SCENARIO("SpscQueue", "[SpscQueue]") {
+    WHEN("Using the queue from a single thread") {
+        Fl::SpscQueue<std::unique_ptr<int>> queue(3);
+        CHECK(queue.GetCapacity() == 4);
+        CHECK(queue.IsEmpty());
+
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.TryPush(std::make_unique<int>(i)));
+        }
+
+        CHECK_FALSE(queue.TryPush(std::make_unique<int>(4)));
+        CHECK(queue.GetSize() == 4);
+
+        std::unique_ptr<int> value;
+        REQUIRE(queue.TryPop(value));
+        CHECK(*value == 0);
+        CHECK(*queue.Pop() == 1);
+    }
+
+    WHEN("Pushing and popping batches") {
+        Fl::SpscQueue<int> queue(8);
+
+        const std::array<int, 6> input = {0, 1, 2, 3, 4, 5};
+        CHECK(queue.TryPushBatch(input) == 6);
+        CHECK(queue.TryPushBatch(input) == 2);
+
+        std::array<int, 5> output{};
+        CHECK(queue.TryPopBatch(output) == 5);
+        CHECK(output == std::array<int, 5>{0, 1, 2, 3, 4});
+        CHECK(queue.TryPopBatch(output) == 3);
+        CHECK(output[2] == 1);
+        CHECK(queue.TryPopBatch(output) == 0);
+    }
+
+    WHEN("Stressing the queue with a producer and a consumer") {
+        constexpr int ValueCount = 200'000;
+        Fl::SpscQueue<int> queue(64);
+
+        std::thread producer([&] {
+            for (int i = 0; i < ValueCount; ++i) {
+                if (i % 2 == 0) {
+                    queue.Push(i);
+                } else {
+                    while (!queue.TryPush(i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+
+        bool ordered = true;
+        for (int i = 0; i < ValueCount; ++i) {
+            ordered &= (queue.Pop() == i);
+        }
+
+        producer.join();
+
+        CHECK(ordered);
+        CHECK(queue.IsEmpty());
+    }
+}
+
+TEST_CASE("SpscQueue benchmarks", "[SpscQueue][.benchmark]") {
+    constexpr int ValueCount = 1'000'000;
+
+    BENCHMARK("Push/Pop 1M integers") {
+        Fl::SpscQueue<int> queue(1024);
+
+        std::thread producer([&] {
+            for (int i = 0; i < ValueCount; ++i) {
+                queue.Push(i);
+            }
+        });
+
+        long long sum = 0;
+        for (int i = 0; i < ValueCount; ++i) {
+            sum += queue.Pop();
+        }
+
+        producer.join();
+
+        return sum;
+    };
+
+    BENCHMARK("Batched Push/Pop 1M integers") {
+        Fl::SpscQueue<int> queue(1024);
+
+        std::thread producer([&] {
+            std::array<int, 64> values{};
+            for (int i = 0; i < ValueCount; i += static_cast<int>(values.size())) {
+                std::span<const int> pending(values);
+                while (!pending.empty()) {
+                    pending = pending.subspan(queue.TryPushBatch(pending));
+                }
+            }
+        });
+
+        long long count = 0;
+        std::array<int, 64> values{};
+        while (count < ValueCount) {
+            count += static_cast<long long>(queue.TryPopBatch(values));
+        }
+
+        producer.join();
+
+        return count;
+    };
+}
@@ -33,7 +33,7 @@ target("flashlightTest-dummy", function(target)
 end)
 
 target("UnitTests", function(target)
-	add_deps("flashlightTest-dummy")
+	add_deps("flashlightTest-dummy", "FlashlightAudioNull", "FlashlightAudioWav")
 
 	add_files("Source/**.cpp")
 
@@ -43,6 +43,9 @@ target("UnitTests", function(target)
 
 	add_includedirs("Include")
 
+	-- Golden images and other files compared against by the tests
+	add_defines("FL_TEST_RESOURCE_DIRECTORY=\"" .. path.join(os.scriptdir(), "Resources"):gsub("\\", "/") .. "\"")
+
 	add_deps("FlashlightEngine")
 
 	add_packages("catch2")
@@ -0,0 +1,261 @@
+// Copyright (C) 2025 Jean "Pixfri" Letessier
+// This file is part of FlashlightEngine.
+// For conditions of distribution and use, see copyright notice in LICENSE.
+
+#include <FlashlightEngine/Core/ThreadPool.hpp>
+#include <FlashlightEngine/Image/BlockCompressor.hpp>
+#include <FlashlightEngine/Utility/PathUtils.hpp>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    constexpr std::array<std::string_view, 5> FormatNames = {"bc1", "bc3", "bc4", "bc5", "bc7"};
+    constexpr std::array<std::string_view, 3> QualityNames = {"fast", "normal", "exhaustive"};
+
+    struct Options {
+        std::string inputPath;
+        std::string outputPath;
+        Fl::BlockFormat format = Fl::BlockFormat::BC7;
+        Fl::CompressionQuality quality = Fl::CompressionQuality::Normal;
+        std::size_t threadCount = 0; //< 0 for the default worker count
+        bool generateMipmaps = false;
+        bool isLinear = false;
+        bool compareQualities = false;
+    };
+
+    template <typename T, std::size_t N>
+    std::optional<T> ParseName(const std::string_view name, const std::array<std::string_view, N>& names) {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (names[i] == name) {
+                return static_cast<T>(i);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    void PrintUsage() {
+        std::cout << "Usage: BlockCompressor <input.ppm|input.pam> <output.dds> [options]\n"
+                     "  --format bc1|bc3|bc4|bc5|bc7         Block format (default: bc7)\n"
+                     "  --quality fast|normal|exhaustive     Encoder quality (default: normal)\n"
+                     "  --mipmaps                            Compresses a full mipmap chain\n"
+                     "  --linear                             Keeps the pixels as linear data, for normal maps\n"
+                     "  --threads <count>                    Worker threads (default: one per hardware thread but one)\n"
+                     "  --compare                            Reports the throughput and PSNR of every quality\n";
+    }
+
+    std::optional<Options> ParseOptions(const int argc, char** argv) {
+        Options options;
+        std::vector<std::string_view> positionals;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view argument = argv[i];
+            const bool hasValue = (i + 1 < argc);
+
+            if (argument == "--format" && hasValue) {
+                const auto format = ParseName<Fl::BlockFormat>(argv[++i], FormatNames);
+                if (!format) {
+                    return std::nullopt;
+                }
+
+                options.format = *format;
+            } else if (argument == "--quality" && hasValue) {
+                const auto quality = ParseName<Fl::CompressionQuality>(argv[++i], QualityNames);
+                if (!quality) {
+                    return std::nullopt;
+                }
+
+                options.quality = *quality;
+            } else if (argument == "--threads" && hasValue) {
+                const std::string_view value = argv[++i];
+                if (std::from_chars(value.data(), value.data() + value.size(), options.threadCount).ec != std::errc{}) {
+                    return std::nullopt;
+                }
+            } else if (argument == "--mipmaps") {
+                options.generateMipmaps = true;
+            } else if (argument == "--linear") {
+                options.isLinear = true;
+            } else if (argument == "--compare") {
+                options.compareQualities = true;
+            } else if (!argument.starts_with("--")) {
+                positionals.push_back(argument);
+            } else {
+                return std::nullopt;
+            }
+        }
+
+        if (positionals.size() != 2) {
+            return std::nullopt;
+        }
+
+        options.inputPath = positionals[0];
+        options.outputPath = positionals[1];
+
+        return options;
+    }
+
+    double ComputePsnr(const Fl::Image& lhs, const Fl::Image& rhs, const Fl::UInt32 level, const int channelCount) {
+        const Fl::UInt32 width = lhs.GetWidth(level);
+        const Fl::UInt32 height = lhs.GetHeight(level);
+
+        double squaredError = 0.0;
+        for (Fl::UInt32 y = 0; y < height; ++y) {
+            const Fl::UInt8* lhsRow = lhs.GetRow(y, level);
+            const Fl::UInt8* rhsRow = rhs.GetRow(y);
+            for (Fl::UInt32 x = 0; x < width; ++x) {
+                for (int channel = 0; channel < channelCount; ++channel) {
+                    const double difference = lhsRow[x * 4 + channel] - rhsRow[x * 4 + channel];
+                    squaredError += difference * difference;
+                }
+            }
+        }
+
+        const double meanError = squaredError / (static_cast<double>(width) * height * channelCount);
+        return (meanError > 0.0) ? 10.0 * std::log10(255.0 * 255.0 / meanError) : INFINITY;
+    }
+
+    int GetChannelCount(const Fl::BlockFormat format) {
+        return (format == Fl::BlockFormat::BC4) ? 1 : ((format == Fl::BlockFormat::BC5) ? 2 : 4);
+    }
+
+    Fl::UInt32 GetDxgiFormat(const Fl::BlockFormat format, const bool isSrgb) {
+        switch (format) {
+            case Fl::BlockFormat::BC1:
+                return isSrgb ? 72 : 71;
+
+            case Fl::BlockFormat::BC3:
+                return isSrgb ? 78 : 77;
+
+            case Fl::BlockFormat::BC4:
+                return 80;
+
+            case Fl::BlockFormat::BC5:
+                return 83;
+
+            case Fl::BlockFormat::BC7:
+                return isSrgb ? 99 : 98;
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Writes compressed levels to a DDS file with the DX10 header extension.
+     */
+    bool WriteDds(const std::string& filePath, const Fl::Image& image, const Fl::BlockFormat format,
+                  const std::vector<std::vector<Fl::UInt8>>& levels) {
+        constexpr Fl::UInt32 HeaderFlags = 0x1 | 0x2 | 0x4 | 0x1000 | 0x80000; // Caps, height, width, format, size
+        constexpr Fl::UInt32 MipmapCountFlag = 0x20000;
+        constexpr Fl::UInt32 FourCcFlag = 0x4;
+        constexpr Fl::UInt32 TextureCaps = 0x1000;
+        constexpr Fl::UInt32 MipmapCaps = 0x8 | 0x400000; // Complex, mipmap
+        constexpr Fl::UInt32 Texture2D = 3;
+
+        const bool hasMipmaps = (levels.size() > 1);
+        const bool isSrgb = (image.GetColorSpace() == Fl::ColorSpace::Srgb);
+
+        std::vector<Fl::UInt32> header(1 + 31 + 5, 0);
+        header[0] = 0x20534444; // "DDS "
+        header[1] = 124;
+        header[2] = HeaderFlags | (hasMipmaps ? MipmapCountFlag : 0);
+        header[3] = image.GetHeight();
+        header[4] = image.GetWidth();
+        header[5] = static_cast<Fl::UInt32>(levels[0].size());
+        header[7] = static_cast<Fl::UInt32>(levels.size());
+        header[19] = 32;
+        header[20] = FourCcFlag;
+        header[21] = 0x30315844; // "DX10"
+        header[27] = TextureCaps | (hasMipmaps ? MipmapCaps : 0);
+        header[32] = GetDxgiFormat(format, isSrgb);
+        header[33] = Texture2D;
+        header[35] = 1; // Array size
+
+        std::ofstream file(Fl::Utf8Path(filePath), std::ios::binary | std::ios::trunc);
+        for (const Fl::UInt32 value : header) {
+            const char bytes[4] = {static_cast<char>(value), static_cast<char>(value >> 8),
+                                   static_cast<char>(value >> 16), static_cast<char>(value >> 24)};
+            file.write(bytes, 4);
+        }
+
+        for (const std::vector<Fl::UInt8>& level : levels) {
+            file.write(reinterpret_cast<const char*>(level.data()), static_cast<std::streamsize>(level.size()));
+        }
+
+        return static_cast<bool>(file);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::optional<Options> options = ParseOptions(argc, argv);
+    if (!options) {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    std::string errorMessage;
+    std::optional<Fl::Image> image = Fl::Image::LoadFromFile(options->inputPath, &errorMessage);
+    if (!image) {
+        std::cerr << errorMessage << '\n';
+        return EXIT_FAILURE;
+    }
+
+    Fl::ThreadPool threadPool((options->threadCount > 0) ? options->threadCount
+                                                         : Fl::ThreadPool::GetDefaultWorkerCount());
+
+    // Non-color data keeps its values, only relabeled as linear
+    if (options->isLinear) {
+        Fl::Image linearImage(image->GetWidth(), image->GetHeight(), Fl::ImageFormat::RGBA8, Fl::ColorSpace::Linear);
+        for (Fl::UInt32 y = 0; y < image->GetHeight(); ++y) {
+            std::copy_n(image->GetRow(y), image->GetWidth() * 4, linearImage.GetRow(y));
+        }
+
+        image = std::move(linearImage);
+    }
+
+    if (options->generateMipmaps) {
+        image->GenerateMipmaps(Fl::ImageFilter::Kaiser, 0, &threadPool);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    if (options->compareQualities) {
+        for (std::size_t quality = 0; quality < QualityNames.size(); ++quality) {
+            Fl::BlockCompressor compressor({options->format, static_cast<Fl::CompressionQuality>(quality)});
+            const std::vector<Fl::UInt8> blocks = compressor.Compress(*image, 0, &threadPool);
+            const Fl::Image decodedImage = Fl::BlockCompressor::Decompress(blocks, image->GetWidth(),
+                                                                           image->GetHeight(), options->format);
+
+            std::cout << std::setw(10) << QualityNames[quality] << ": "
+                      << compressor.GetStatistics().GetMegapixelsPerSecond() << " MP/s, PSNR "
+                      << ComputePsnr(*image, decodedImage, 0, GetChannelCount(options->format)) << " dB\n";
+        }
+    }
+
+    Fl::BlockCompressor compressor({options->format, options->quality});
+    std::vector<std::vector<Fl::UInt8>> levels;
+    for (Fl::UInt32 level = 0; level < image->GetLevelCount(); ++level) {
+        levels.push_back(compressor.Compress(*image, level, &threadPool));
+
+        const Fl::Image decodedImage = Fl::BlockCompressor::Decompress(levels.back(), image->GetWidth(level),
+                                                                       image->GetHeight(level), options->format);
+        std::cout << "Level " << level << " (" << image->GetWidth(level) << "x" << image->GetHeight(level)
+                  << "): " << compressor.GetStatistics().GetMegapixelsPerSecond() << " MP/s, PSNR "
+                  << ComputePsnr(*image, decodedImage, level, GetChannelCount(options->format)) << " dB\n";
+    }
+
+    if (!WriteDds(options->outputPath, *image, options->format, levels)) {
+        std::cerr << "Failed to write " << options->outputPath << ".\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
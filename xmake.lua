@@ -106,6 +106,29 @@ target(ProjectName, function (target)
   end
 end)
 
+target("BlockCompressor", function (target)
+  set_kind("binary")
+
+  add_files("Tools/BlockCompressor/**.cpp")
+
+  add_deps(ProjectName)
+
+  add_rpathdirs("$ORIGIN")
+end)
+
+-- Audio device backends loaded at runtime by AudioDeviceLibrary
+for _, device in ipairs({"Null", "Wav"}) do
+  target("FlashlightAudio" .. device, function (target)
+    set_kind("shared")
+
+    add_files("Plugins/Audio/" .. device .. "Device.cpp")
+
+    add_deps(ProjectName)
+
+    add_rpathdirs("$ORIGIN")
+  end)
+end
+
 includes("xmake/**.lua") -- Include external scripts
 
 if has_config("build_tests") then